@@ -96,6 +96,25 @@ struct HeapStatistics final {
     FreeListStatistics free_list_stats;
   };
 
+  /**
+   * Decisions of the compactor in the most recent garbage collection that
+   * compacted at least one space. Compactable spaces that are eligible for
+   * compaction are compacted in order of increasing live ratio as long as their
+   * live bytes fit into the evacuation budget.
+   */
+  struct CompactionStatistics {
+    /** Number of garbage collections that compacted at least one space. */
+    size_t compacting_gcs = 0;
+    /** Number of spaces that were eligible for compaction. */
+    size_t candidate_spaces = 0;
+    /** Number of spaces that were compacted. */
+    size_t compacted_spaces = 0;
+    /** Live bytes on the compacted spaces. */
+    size_t evacuated_bytes = 0;
+    /** Limit for the evacuated bytes per garbage collection. */
+    size_t evacuation_budget_bytes = 0;
+  };
+
   /** Overall committed amount of memory for the heap. */
   size_t committed_size_bytes = 0;
   /** Resident amount of memory held by the heap. */
@@ -115,6 +134,9 @@ struct HeapStatistics final {
    * Vector of `cppgc::GarbageCollected` type names.
    */
   std::vector<std::string> type_names;
+
+  /** Statistics of the compactor. */
+  CompactionStatistics compaction_stats;
 };
 
 }  // namespace cppgc
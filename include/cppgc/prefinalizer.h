@@ -5,6 +5,8 @@
 #ifndef INCLUDE_CPPGC_PREFINALIZER_H_
 #define INCLUDE_CPPGC_PREFINALIZER_H_
 
+#include <cstdint>
+
 #include "cppgc/internal/compiler-specific.h"
 #include "cppgc/liveness-broker.h"
 
@@ -16,7 +18,16 @@ class V8_EXPORT PrefinalizerRegistration final {
  public:
   using Callback = bool (*)(const cppgc::LivenessBroker&, void*);
 
+  enum class Kind : uint8_t {
+    // Invoked on the thread that created the object, see
+    // CPPGC_USING_PRE_FINALIZER.
+    kMutatorThread,
+    // May be invoked on any thread, see CPPGC_USING_CONCURRENT_PRE_FINALIZER.
+    kConcurrent,
+  };
+
   PrefinalizerRegistration(void*, Callback);
+  PrefinalizerRegistration(void*, Callback, Kind);
 
   void* operator new(size_t, void* location) = delete;
   void* operator new(size_t) = delete;
@@ -53,7 +64,29 @@ class V8_EXPORT PrefinalizerRegistration final {
  * };
  * \endcode
  */
-#define CPPGC_USING_PRE_FINALIZER(Class, PreFinalizer)                         \
+#define CPPGC_USING_PRE_FINALIZER(Class, PreFinalizer) \
+  CPPGC_INTERNAL_USING_PRE_FINALIZER(Class, PreFinalizer, kMutatorThread)
+
+/**
+ * Like CPPGC_USING_PRE_FINALIZER(), but registers a prefinalization callback
+ * that is thread-safe. Concurrent prefinalizers are invoked in parallel on
+ * worker threads, which shortens the atomic pause for heaps with many of them.
+ *
+ * Callback properties:
+ * - The callback is invoked before a possible destructor for the corresponding
+ *   object and before any prefinalizer registered via
+ *   CPPGC_USING_PRE_FINALIZER().
+ * - The callback may be invoked on any thread and concurrently with the
+ *   concurrent prefinalizers of other objects. There is no ordering between
+ *   concurrent prefinalizers.
+ * - The callback must only access the object itself and state that is safe to
+ *   be accessed from other threads. It must not allocate garbage-collected
+ *   objects.
+ */
+#define CPPGC_USING_CONCURRENT_PRE_FINALIZER(Class, PreFinalizer) \
+  CPPGC_INTERNAL_USING_PRE_FINALIZER(Class, PreFinalizer, kConcurrent)
+
+#define CPPGC_INTERNAL_USING_PRE_FINALIZER(Class, PreFinalizer, kind)          \
  public:                                                                       \
   static bool InvokePreFinalizer(const cppgc::LivenessBroker& liveness_broker, \
                                  void* object) {                               \
@@ -67,7 +100,9 @@ class V8_EXPORT PrefinalizerRegistration final {
                                                                                \
  private:                                                                      \
   CPPGC_NO_UNIQUE_ADDRESS cppgc::internal::PrefinalizerRegistration            \
-      prefinalizer_dummy_{this, Class::InvokePreFinalizer};                    \
+      prefinalizer_dummy_{                                                     \
+          this, Class::InvokePreFinalizer,                                     \
+          cppgc::internal::PrefinalizerRegistration::Kind::kind};              \
   static_assert(true, "Force semicolon.")
 
 }  // namespace cppgc
@@ -6,6 +6,7 @@
 #define V8_LIBPLATFORM_LIBPLATFORM_H_
 
 #include <memory>
+#include <vector>
 
 #include "libplatform/libplatform-export.h"
 #include "libplatform/v8-tracing.h"
@@ -24,6 +25,7 @@ enum class MessageLoopBehavior : bool {
 };
 
 enum class PriorityMode : bool { kDontApply, kApply };
+enum class JobConcurrencyMode : bool { kFixed, kAdaptive };
 
 /**
  * Returns a new instance of the default v8::Platform implementation.
@@ -40,6 +42,9 @@ enum class PriorityMode : bool { kDontApply, kApply };
  * If |priority_mode| is PriorityMode::kApply, the default platform will use
  * multiple task queues executed by threads different system-level priorities
  * (where available) to schedule tasks.
+ * If |job_concurrency_mode| is JobConcurrencyMode::kAdaptive, jobs measure the
+ * progress that their workers report via JobDelegate::NotifyProgress(), and
+ * run fewer workers while additional workers don't increase their throughput.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
@@ -47,7 +52,8 @@ V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
     std::unique_ptr<v8::TracingController> tracing_controller = {},
-    PriorityMode priority_mode = PriorityMode::kDontApply);
+    PriorityMode priority_mode = PriorityMode::kDontApply,
+    JobConcurrencyMode job_concurrency_mode = JobConcurrencyMode::kFixed);
 
 /**
  * The same as NewDefaultPlatform but disables the worker thread pool.
@@ -106,6 +112,23 @@ V8_PLATFORM_EXPORT void RunIdleTasks(v8::Platform* platform,
 V8_PLATFORM_EXPORT void NotifyIsolateShutdown(v8::Platform* platform,
                                               Isolate* isolate);
 
+/**
+ * Restricts the worker threads that run tasks with |priority| to the CPUs with
+ * the given indices, e.g. to keep background GC and compile tasks off the
+ * cores used by the main thread. An empty |cpus| lifts the restriction. If the
+ * platform was created with PriorityMode::kDontApply, all priorities share the
+ * same worker threads. The priority itself is still mapped to the OS' QoS
+ * classes, which on hybrid CPUs also steer threads between core types.
+ *
+ * Thread affinity is supported on Linux and Windows; returns false if the
+ * threads could not be restricted.
+ *
+ * The |platform| has to be created using |NewDefaultPlatform|.
+ */
+V8_PLATFORM_EXPORT bool SetWorkerThreadCpus(v8::Platform* platform,
+                                            TaskPriority priority,
+                                            const std::vector<int>& cpus);
+
 }  // namespace platform
 }  // namespace v8
 
@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8-object.h"        // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -171,6 +172,25 @@ class V8_EXPORT ArrayBuffer : public Object {
      */
     virtual void Free(void* data, size_t length) = 0;
 
+    /**
+     * A memory block that is freed as part of a batch.
+     */
+    struct FreeRequest {
+      void* data;
+      size_t length;
+    };
+
+    /**
+     * Free a batch of memory blocks. Called when V8 releases many array
+     * buffers at once, e.g., after a garbage collection, and may be called
+     * from any thread. Every block is guaranteed to be previously allocated
+     * by |Allocate| or |AllocateUninitialized|.
+     *
+     * The default implementation calls |Free| for each block. Allocators that
+     * pool memory can override it to reclaim all blocks in one go.
+     */
+    virtual void FreeBatch(MemorySpan<const FreeRequest> requests);
+
     /**
      * Reallocate the memory block of size |old_length| to a memory block of
      * size |new_length| by expanding, contracting, or copying the existing
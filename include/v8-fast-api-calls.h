@@ -154,9 +154,13 @@
  *   - uint32_t
  *   - float32_t
  *   - float64_t
+ *   - v8::Local<v8::Value> (see FastApiCallbackOptions)
  * Currently supported argument types:
  *  - pointer to an embedder type
  *  - JavaScript array of primitive types
+ *  - sequential one-byte strings (const FastOneByteString&)
+ *  - any ArrayBufferView (const FastApiArrayBufferView&)
+ *  - ArrayBuffer (const FastApiArrayBuffer&)
  *  - bool
  *  - int32_t
  *  - uint32_t
@@ -177,7 +181,6 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - TypedArrays and ArrayBuffers
  *  - arrays of embedder types
  *
  *
@@ -378,16 +381,23 @@ struct V8_DEPRECATE_SOON(
 // own instance type. It could be supported if we specify that
 // TypedArray<T> always has precedence over the generic ArrayBufferView,
 // but this complicates overload resolution.
+// The view is only passed on the fast path if its buffer is neither detached
+// nor resizable, and not shared unless kAllowSharedBit is set. |data| already
+// includes the view's byte offset. Both the data and the string views below
+// are only valid for the duration of the fast call.
 struct FastApiArrayBufferView {
   void* data;
   size_t byte_length;
 };
 
+// Same restrictions as for FastApiArrayBufferView apply.
 struct FastApiArrayBuffer {
   void* data;
   size_t byte_length;
 };
 
+// A view on the characters of a sequential one-byte string. Strings with a
+// different representation (e.g. cons strings) take the slow path.
 struct FastOneByteString {
   const char* data;
   uint32_t length;
@@ -465,6 +475,8 @@ union V8_TRIVIAL_ABI AnyCType {
   Local<Object> object_value;
   Local<Array> sequence_value;
   const FastOneByteString* string_value;
+  const FastApiArrayBufferView* array_buffer_view_value;
+  const FastApiArrayBuffer* array_buffer_value;
   FastApiCallbackOptions* options_value;
 };
 
@@ -587,6 +599,19 @@ struct FastApiCallbackOptions {
     return {};
   }
 
+  /**
+   * The isolate the fast call is made in. Fast callbacks that return a
+   * `v8::Local<v8::Value>` use it to allocate the result, e.g.
+   * \code
+   *    v8::Local<v8::Value> FastMethod(v8::Local<v8::Object> receiver,
+   *                                    FastApiCallbackOptions& options) {
+   *      return v8::Object::New(options.isolate);
+   *    }
+   * \endcode
+   * V8 opens a handle scope around such calls, so the returned handle must
+   * not be created in a handle scope that the callback closes itself. An
+   * empty handle is converted to `undefined`.
+   */
   v8::Isolate* isolate = nullptr;
 
   /**
@@ -634,6 +659,7 @@ class CFunctionInfoImpl : public CFunctionInfo {
                       kReturnType == CTypeInfo::Type::kFloat32 ||
                       kReturnType == CTypeInfo::Type::kFloat64 ||
                       kReturnType == CTypeInfo::Type::kPointer ||
+                      kReturnType == CTypeInfo::Type::kV8Value ||
                       kReturnType == CTypeInfo::Type::kAny,
                   "String and api object values are not currently "
                   "supported return types.");
@@ -757,6 +783,26 @@ struct TypeInfoHelper<FastApiCallbackOptions&> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastApiArrayBufferView&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() { return CTypeInfo::Type::kVoid; }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kIsTypedArray;
+  }
+};
+
+template <>
+struct TypeInfoHelper<const FastApiArrayBuffer&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() { return CTypeInfo::Type::kVoid; }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kIsArrayBuffer;
+  }
+};
+
 template <>
 struct TypeInfoHelper<const FastOneByteString&> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
@@ -315,6 +315,21 @@ class V8_EXPORT V8InspectorClient {
 
   virtual void maxAsyncCallStackDepthChanged(int depth) {}
 
+  // While a session has the Runtime domain enabled, console messages capture
+  // full stack traces. If this returns N > 1, only every Nth message of the
+  // context group does, and the others capture only their top frame, which
+  // keeps high-volume logging cheap. console.trace() is never sampled.
+  virtual int consoleStackTraceSamplingInterval(int contextGroupId) {
+    return 1;
+  }
+
+  // The estimated number of bytes of console messages, including the values
+  // they retain, kept for sessions that connect later. The oldest messages
+  // are dropped first.
+  virtual int maxConsoleMessageStorageSize(int contextGroupId) {
+    return 10 * 1024 * 1024;
+  }
+
   virtual std::unique_ptr<StringBuffer> resourceNameToUrl(
       const StringView& resourceName) {
     return nullptr;
@@ -909,6 +909,11 @@ class Internals {
   static const int kHandleScopeDataSize =
       2 * kApiSystemPointerSize + 2 * kApiInt32Size;
 
+  // HandleScopeData layout guarantees.
+  static const int kHandleScopeDataNextOffset = 0;
+  static const int kHandleScopeDataLimitOffset = kApiSystemPointerSize;
+  static const int kHandleScopeDataLevelOffset = 2 * kApiSystemPointerSize;
+
   // ExternalPointerTable and TrustedPointerTable layout guarantees.
   static const int kExternalPointerTableBasePointerOffset = 0;
   static const int kExternalPointerTableSize = 2 * kApiSystemPointerSize;
@@ -1199,6 +1204,14 @@ class Internals {
     ++(*reinterpret_cast<size_t*>(addr));
   }
 
+  template <typename T>
+  V8_INLINE static T* GetHandleScopeDataField(v8::Isolate* isolate,
+                                              int offset) {
+    Address addr = reinterpret_cast<Address>(isolate) +
+                   kIsolateHandleScopeDataOffset + offset;
+    return reinterpret_cast<T*>(addr);
+  }
+
   V8_INLINE static Address* GetRootSlot(v8::Isolate* isolate, int index) {
     Address addr = reinterpret_cast<Address>(isolate) + kIsolateRootsOffset +
                    index * kApiSystemPointerSize;
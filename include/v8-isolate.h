@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cppgc/common.h"
 #include "v8-array-buffer.h"       // NOLINT(build/include_directory)
@@ -39,12 +40,15 @@ class ScriptOrModule;
 class SharedArrayBuffer;
 
 namespace internal {
+class IsolatePoolImpl;
 class MicrotaskQueue;
 class ThreadLocalTop;
 }  // namespace internal
 
 namespace metrics {
 class Recorder;
+struct CompileJobHistograms;
+struct GarbageCollectionLatencyHistograms;
 }  // namespace metrics
 
 /**
@@ -154,6 +158,20 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The amount of time in milliseconds that garbage collection pauses are
+   * allowed to take per second of wall time. When set, V8 sizes the old
+   * generation such that the expected garbage collection time stays within the
+   * budget, trading memory for shorter pauses. A value of 0 (the default) uses
+   * V8's built-in heuristics.
+   */
+  double gc_pause_budget_in_ms_per_second() const {
+    return gc_pause_budget_in_ms_per_second_;
+  }
+  void set_gc_pause_budget_in_ms_per_second(double budget) {
+    gc_pause_budget_in_ms_per_second_ = budget;
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -162,6 +180,7 @@ class V8_EXPORT ResourceConstraints {
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
   uint32_t* stack_limit_ = nullptr;
+  double gc_pause_budget_in_ms_per_second_ = 0.0;
 };
 
 /**
@@ -196,6 +215,16 @@ enum RAILMode : unsigned {
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Load hint for SetLoadHint.
+ * kDefault lets V8 use its regular heuristics.
+ * kIdle hints V8 that the isolate is expected to stay idle for a longer period
+ * of time. V8 gradually releases memory that is committed but not in use.
+ * kLoadExpected hints V8 that the isolate is about to receive load. V8
+ * recommits memory it released while idle ahead of demand.
+ */
+enum class LoadHint { kDefault, kIdle, kLoadExpected };
+
 /**
  * Indicator for the stack state.
  */
@@ -386,6 +415,30 @@ class V8_EXPORT Isolate {
     friend class internal::ThreadLocalTop;
   };
 
+  /**
+   * Tags young generation allocations on the isolate's thread with an
+   * embedder-defined phase for the lifetime of the scope, e.g., the kind of
+   * request that is being handled. V8 tracks how much each phase allocates and
+   * how much of it survives, and sizes the young generation ahead of phases
+   * that are known to allocate heavily. The bytes each phase allocates in any
+   * space are reported by GetAllocationPhaseStatistics. Scopes may be nested,
+   * in which case only the innermost phase is tracked. Phase 0 is reserved for
+   * untagged allocations.
+   */
+  class V8_EXPORT V8_NODISCARD AllocationPhaseScope {
+   public:
+    AllocationPhaseScope(Isolate* isolate, uint32_t phase);
+    ~AllocationPhaseScope();
+
+    // Prevent copying of Scope objects.
+    AllocationPhaseScope(const AllocationPhaseScope&) = delete;
+    AllocationPhaseScope& operator=(const AllocationPhaseScope&) = delete;
+
+   private:
+    internal::Isolate* const i_isolate_;
+    const uint32_t previous_phase_;
+  };
+
   /**
    * Types of garbage collections that can be requested via
    * RequestGarbageCollectionForTesting.
@@ -802,7 +855,12 @@ class V8_EXPORT Isolate {
 
   /**
    * Sets a value that will be stored on continuations and reset while the
-   * continuation runs.
+   * continuation runs. Continuations are promise reactions (including those
+   * of await), microtasks enqueued by JavaScript or the embedder, and the
+   * cleanup callbacks of FinalizationRegistries, which see the value that
+   * was current when the FinalizationRegistry was created. Capturing and
+   * restoring the value happens inside V8 without calling into the embedder,
+   * so this is much cheaper than tracking contexts with a PromiseHook.
    */
   void SetContinuationPreservedEmbedderData(Local<Value> data);
 
@@ -811,6 +869,19 @@ class V8_EXPORT Isolate {
    */
   void GetHeapStatistics(HeapStatistics* heap_statistics);
 
+  /**
+   * Get latency histograms of the phases of the full garbage collections
+   * since isolate creation.
+   */
+  void GetGCLatencyHistograms(
+      metrics::GarbageCollectionLatencyHistograms* histograms);
+
+  /**
+   * Get the Sparkplug, Maglev and Turbofan compile jobs since isolate
+   * creation, aggregated per tier.
+   */
+  void GetCompileJobHistograms(metrics::CompileJobHistograms* histograms);
+
   /**
    * Returns the number of spaces in the heap.
    */
@@ -854,6 +925,51 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get the runtime call counters that have been entered at least once, on
+   * the isolate's thread or on its background threads. The counters are
+   * enabled by --runtime-call-stats or, with a much lower overhead, by
+   * --rcs-sampling-interval, and don't require tracing.
+   *
+   * \param counters The vector to replace with the counters.
+   * \returns false if runtime call stats are disabled.
+   */
+  bool GetRuntimeCallStats(std::vector<RuntimeCallCounterStatistics>* counters);
+
+  /**
+   * Get the property access sites whose inline caches missed recently, with
+   * their miss counts. Requires --ic-site-stats, which keeps a bounded summary
+   * of the misses.
+   *
+   * \param sites The vector to replace with the sites.
+   * \returns false if the inline cache statistics are disabled.
+   */
+  bool GetICStatistics(std::vector<ICSiteStatistics>* sites);
+
+  /**
+   * Get the recent deopts per source position and reason, and the recent
+   * failed optimizations per function and reason, with their counts.
+   * Requires --deopt-stats, which keeps a bounded summary of both.
+   *
+   * \param deopts The vector to replace with the deopts.
+   * \param bailouts The vector to replace with the bailouts.
+   * \returns false if the deopt statistics are disabled.
+   */
+  bool GetDeoptStatistics(std::vector<DeoptSiteStatistics>* deopts,
+                          std::vector<OptimizationBailoutStatistics>* bailouts);
+
+  /**
+   * Get the bytes allocated on the isolate's thread during each allocation
+   * phase (see AllocationPhaseScope) that allocated anything. Allocations are
+   * attributed whenever a linear allocation buffer is retired and when phases
+   * change, so this is cheap enough to leave on. Allocations of background
+   * threads aren't attributed to any phase.
+   *
+   * \param phases The vector to replace with the phases.
+   */
+  void GetAllocationPhaseStatistics(
+      std::vector<AllocationPhaseStatistics>* phases);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -1428,6 +1544,14 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Optional notification about the expected load of the isolate, e.g. for
+   * server isolates that alternate between bursts of load and long idle
+   * periods. V8 uses the hint to decide when to release and recommit memory
+   * that is committed but not in use. Must be called on the isolate's thread.
+   */
+  void SetLoadHint(LoadHint hint);
+
   /**
    * Update load start time of the RAIL mode
    */
@@ -1774,6 +1898,44 @@ MaybeLocal<T> Isolate::GetDataFromSnapshotOnce(size_t index) {
   return {};
 }
 
+/**
+ * A pool of isolates that are created ahead of time on worker threads, each
+ * with a context, so that a ready-to-run isolate can be taken from the pool
+ * without paying for isolate and context creation.
+ *
+ * The isolates are created under a v8::Locker, so they must be used under a
+ * v8::Locker as well. For the same reason, the create params should not set a
+ * stack limit.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * Starts creating |size| isolates with |params|. The data referenced by
+   * |params|, e.g. the snapshot blob and the array buffer allocator, must
+   * outlive the pool and the isolates taken from it.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t size);
+  /**
+   * Waits for the isolates that are being created and disposes all isolates
+   * that were not taken.
+   */
+  ~IsolatePool();
+
+  /**
+   * Takes an isolate from the pool, waiting for one to be ready if needed, and
+   * starts creating a replacement. The isolate's context is returned in
+   * |context|. The caller owns the isolate and disposes it when done.
+   */
+  Isolate* Take(Global<Context>* context);
+
+  // Disallow copying and assigning.
+  IsolatePool(const IsolatePool&) = delete;
+  void operator=(const IsolatePool&) = delete;
+
+ private:
+  internal::IsolatePoolImpl* impl_;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_ISOLATE_H_
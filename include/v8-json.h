@@ -5,7 +5,12 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -14,6 +19,10 @@ class Context;
 class Value;
 class String;
 
+namespace internal {
+class JsonStreamingParser;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +49,79 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the UTF-8 encoded output of StringifyToUtf8 in buffers provided
+   * by the embedder, e.g. the buffers of a socket.
+   */
+  class V8_EXPORT Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+
+    /**
+     * Returns a buffer for the next part of the output and stores its size in
+     * |size|, which must be at least kMinBufferSize bytes.
+     */
+    virtual char* GetBuffer(size_t* size) = 0;
+
+    /**
+     * Called with the number of bytes written to the buffer last returned by
+     * GetBuffer, before the next buffer is requested and once the output is
+     * complete. A buffer may not be filled completely, since characters are
+     * not split between buffers.
+     */
+    virtual void BufferWritten(size_t length) = 0;
+
+    static constexpr size_t kMinBufferSize = 4;
+  };
+
+  /**
+   * Like Stringify, but writes the result as UTF-8 to |sink| instead of
+   * creating a string. The sink is not called if an exception is thrown.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param sink The sink which receives the output.
+   * \return Nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<void> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Parses UTF-8 encoded JSON text which arrives in chunks, e.g. the body of
+   * an HTTP response, without first concatenating the chunks.
+   *
+   * The chunks are decoded as they are fed, and only the decoded text is
+   * kept. Multi-byte characters may be split between chunks. Invalid UTF-8 is
+   * replaced by U+FFFD, like in String::NewFromUtf8.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    StreamingParser();
+    ~StreamingParser();
+
+    // Prevent copying.
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Feeds the next |length| bytes of the text. The parser doesn't keep a
+     * reference to |data|.
+     */
+    void Feed(const char* data, size_t length);
+
+    /**
+     * Parses the text fed so far and returns its value if successful. The
+     * parser can be used for another text afterwards.
+     *
+     * \param the context in which to parse and create the value.
+     * \return The corresponding value if successfully parsed.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonStreamingParser> impl_;
+  };
 };
 
 }  // namespace v8
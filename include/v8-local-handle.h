@@ -98,7 +98,27 @@ class V8_EXPORT V8_NODISCARD HandleScope {
  public:
   explicit HandleScope(Isolate* isolate);
 
-  ~HandleScope();
+  /**
+   * Closing a scope is inlined unless handle blocks were allocated while it
+   * was open. With V8_ENABLE_CHECKS, scopes are always closed out of line,
+   * which verifies their nesting and zaps the released handles.
+   */
+  V8_INLINE ~HandleScope() {
+#ifndef V8_ENABLE_CHECKS
+    using I = internal::Internals;
+    Isolate* isolate = reinterpret_cast<Isolate*>(i_isolate_);
+    internal::Address** limit = I::GetHandleScopeDataField<internal::Address*>(
+        isolate, I::kHandleScopeDataLimitOffset);
+    if (V8_LIKELY(*limit == prev_limit_)) {
+      *I::GetHandleScopeDataField<internal::Address*>(
+          isolate, I::kHandleScopeDataNextOffset) = prev_next_;
+      --*I::GetHandleScopeDataField<int>(isolate,
+                                          I::kHandleScopeDataLevelOffset);
+      return;
+    }
+#endif  // V8_ENABLE_CHECKS
+    CloseScope();
+  }
 
   /**
    * Counts the number of allocated handles.
@@ -120,10 +140,34 @@ class V8_EXPORT V8_NODISCARD HandleScope {
 
   void Initialize(Isolate* isolate);
 
-  static internal::Address* CreateHandle(internal::Isolate* i_isolate,
-                                         internal::Address value);
+  /**
+   * Bumps the next handle pointer of the current scope in place, and only
+   * calls into V8 when the current handle block is full or sealed.
+   */
+  V8_INLINE static internal::Address* CreateHandle(internal::Isolate* i_isolate,
+                                                   internal::Address value) {
+#ifndef V8_ENABLE_CHECKS
+    using I = internal::Internals;
+    Isolate* isolate = reinterpret_cast<Isolate*>(i_isolate);
+    internal::Address** next = I::GetHandleScopeDataField<internal::Address*>(
+        isolate, I::kHandleScopeDataNextOffset);
+    internal::Address* result = *next;
+    if (V8_LIKELY(result != *I::GetHandleScopeDataField<internal::Address*>(
+                                isolate, I::kHandleScopeDataLimitOffset))) {
+      *next = result + 1;
+      *result = value;
+      return result;
+    }
+#endif  // V8_ENABLE_CHECKS
+    return CreateHandleSlow(i_isolate, value);
+  }
 
  private:
+  void CloseScope();
+
+  static internal::Address* CreateHandleSlow(internal::Isolate* i_isolate,
+                                             internal::Address value);
+
   // Declaring operator new and delete as deleted is not spec compliant.
   // Therefore declare them private instead to disable dynamic alloc
   void* operator new(size_t size);
@@ -35,6 +35,17 @@ struct GarbageCollectionSizes {
   int64_t bytes_freed = -1;
 };
 
+// Slow path entries of the write barrier and of allocation, see
+// v8::HeapStatistics.
+struct GarbageCollectionSlowPaths {
+  int64_t generational_write_barrier = -1;
+  int64_t marking_write_barrier = -1;
+  int64_t shared_write_barrier = -1;
+  int64_t allocation_lab_exhausted = -1;
+  int64_t allocation_observer_step = -1;
+  int64_t allocation_gc_needed = -1;
+};
+
 struct GarbageCollectionFullCycle {
   int reason = -1;
   GarbageCollectionPhases total;
@@ -60,6 +71,8 @@ struct GarbageCollectionFullCycle {
   double main_thread_collection_weight_in_percent = -1.0;
   double main_thread_collection_weight_cpp_in_percent = -1.0;
   int64_t incremental_marking_start_stop_wall_clock_duration_in_us = -1;
+  // Entries since the previous reported full cycle.
+  GarbageCollectionSlowPaths slow_paths;
 };
 
 struct GarbageCollectionFullMainThreadIncrementalMark {
@@ -101,6 +114,48 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+// Reported after each full garbage collection that recomputed the allocation
+// limits of the heap.
+struct GarbageCollectionLimits {
+  // The mutator utilization the heap growing heuristics aimed for. Derived
+  // from ResourceConstraints::gc_pause_budget_in_ms_per_second() if set.
+  double target_mutator_utilization = -1.0;
+  double growing_factor = -1.0;
+  int64_t old_generation_allocation_limit_in_bytes = -1;
+  int64_t global_allocation_limit_in_bytes = -1;
+  int64_t young_generation_capacity_in_bytes = -1;
+};
+
+/**
+ * Latency histograms of the phases of full garbage collection cycles since
+ * isolate creation, see Isolate::GetGCLatencyHistograms(). Bucket i counts
+ * the phase durations in
+ * [bucket_lower_bounds_in_us[i], bucket_lower_bounds_in_us[i + 1]); the last
+ * bucket is unbounded. Main thread and background durations are recorded
+ * separately, background durations are summed up over all threads of a cycle.
+ */
+struct GarbageCollectionLatencyHistograms {
+  enum class Phase : uint8_t {
+    kRootMarking,
+    kWeakProcessing,
+    kEvacuation,
+    kRememberedSetUpdate,
+    kSweeping,
+  };
+  static constexpr size_t kNumPhases = 5;
+
+  struct Histogram {
+    std::vector<uint64_t> bucket_counts;
+    uint64_t total_count = 0;
+    int64_t total_duration_in_us = 0;
+    int64_t max_duration_in_us = 0;
+  };
+
+  std::vector<int64_t> bucket_lower_bounds_in_us;
+  Histogram main_thread[kNumPhases];
+  Histogram background[kNumPhases];
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -160,6 +215,96 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+// Reported after each checkpoint of a MicrotaskQueue that ran at least one
+// microtask.
+struct MicrotasksRun {
+  int64_t microtask_count = -1;
+  int64_t wall_clock_duration_in_us = -1;
+};
+
+// Reported when a Sparkplug, Maglev or Turbofan compile job of a function
+// finished on the main thread, successfully or not.
+struct CompileJob {
+  enum class Tier : uint8_t { kSparkplug, kMaglev, kTurbofan };
+  static constexpr size_t kNumTiers = 3;
+
+  Tier tier = Tier::kTurbofan;
+  bool concurrent = false;
+  bool osr = false;
+  bool success = false;
+  size_t bytecode_size_in_bytes = 0;
+  // The instruction size of the installed code, 0 if the job failed.
+  size_t code_size_in_bytes = 0;
+  // How long the job waited for a background thread before it was executed.
+  int64_t queue_delay_in_us = -1;
+  // The wall clock and thread CPU time spent compiling, excluding the queue
+  // delay. The CPU time is -1 where thread CPU time is unsupported.
+  int64_t wall_clock_duration_in_us = -1;
+  int64_t cpu_duration_in_us = -1;
+  // The internal reason why the job failed, -1 if it succeeded.
+  int bailout_reason = -1;
+};
+
+/**
+ * Describes the creation of the isolate. Reported when a recorder is set with
+ * Isolate::SetMetricsRecorder(), as the isolate is already created by then.
+ * The phases do not add up to the total, which also covers the remaining
+ * setup of the isolate.
+ */
+struct IsolateCreated {
+  int64_t snapshot_decompression_in_us = -1;
+  int64_t read_only_space_setup_in_us = -1;
+  int64_t startup_deserialization_in_us = -1;
+  // Setting up, and possibly remapping, the embedded builtins.
+  int64_t embedded_builtins_setup_in_us = -1;
+  int64_t external_reference_table_setup_in_us = -1;
+  int64_t total_wall_clock_duration_in_us = -1;
+};
+
+// Reported after each context creation, successful or not. The deserializer
+// runs the embedder's internal field callbacks, so their duration is included
+// in the deserialization duration.
+struct ContextCreated {
+  bool success = false;
+  // Whether the context was deserialized from a context snapshot, rather than
+  // bootstrapped from scratch.
+  bool from_snapshot = false;
+  int64_t snapshot_decompression_in_us = -1;
+  int64_t deserialization_in_us = -1;
+  int64_t embedder_callbacks_in_us = -1;
+  int64_t total_wall_clock_duration_in_us = -1;
+};
+
+/**
+ * Compile jobs since isolate creation, aggregated per tier, see
+ * Isolate::GetCompileJobHistograms(). The histograms use the same buckets as
+ * GarbageCollectionLatencyHistograms: bucket i counts the durations in
+ * [bucket_lower_bounds_in_us[i], bucket_lower_bounds_in_us[i + 1]), the last
+ * bucket is unbounded.
+ */
+struct CompileJobHistograms {
+  struct Histogram {
+    std::vector<uint64_t> bucket_counts;
+    uint64_t total_count = 0;
+    int64_t total_duration_in_us = 0;
+    int64_t max_duration_in_us = 0;
+  };
+
+  struct Tier {
+    uint64_t job_count = 0;
+    uint64_t failed_job_count = 0;
+    uint64_t bytecode_size_in_bytes = 0;
+    uint64_t code_size_in_bytes = 0;
+    int64_t cpu_duration_in_us = 0;
+    Histogram wall_clock_duration;
+    Histogram queue_delay;
+  };
+
+  std::vector<int64_t> bucket_lower_bounds_in_us;
+  // Indexed by CompileJob::Tier.
+  Tier tiers[CompileJob::kNumTiers];
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -209,9 +354,14 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionLimits)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(MicrotasksRun)
+  ADD_MAIN_THREAD_EVENT(CompileJob)
+  ADD_MAIN_THREAD_EVENT(IsolateCreated)
+  ADD_MAIN_THREAD_EVENT(ContextCreated)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
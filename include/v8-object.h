@@ -303,6 +303,22 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the values of the properties |names| into |values|, which must have
+   * room for |length| entries. This is equivalent to calling Get() for each
+   * name, but own data properties of objects with fast properties are read
+   * directly from the object without a full property lookup. Other properties,
+   * e.g. accessors or properties found on the prototype chain, are looked up
+   * as usual.
+   *
+   * Returns Nothing if an exception was thrown, in which case the contents of
+   * |values| are unspecified.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<void> GetMany(Local<Context> context,
+                                            Local<Name>* names,
+                                            Local<Value>* values,
+                                            size_t length);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -816,6 +832,12 @@ class V8_EXPORT Object : public Value {
    * a prototype at all). This is similar to Object.create().
    * All properties will be created as enumerable, configurable
    * and writable properties.
+   *
+   * If prototype_or_null is an object and the names are distinct property
+   * names (no array indices), the object is created with fast properties.
+   * Objects created with the same prototype and the same names in the same
+   * order share their map, so creating many objects of the same shape only
+   * looks up the map transitions instead of adding properties one by one.
    */
   static Local<Object> New(Isolate* isolate, Local<Value> prototype_or_null,
                            Local<Name>* names, Local<Value>* values,
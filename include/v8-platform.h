@@ -232,6 +232,13 @@ class JobDelegate {
    * running JobHandle::Join().
    */
   virtual bool IsJoiningThread() const = 0;
+
+  /**
+   * Reports that the current worker completed |work_items| units of work. The
+   * platform may use this to measure the throughput of the job, and to run
+   * fewer workers if additional workers don't increase it.
+   */
+  virtual void NotifyProgress(size_t work_items) {}
 };
 
 /**
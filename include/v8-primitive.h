@@ -454,6 +454,18 @@ class V8_EXPORT String : public Name {
   static Local<String> Concat(Isolate* isolate, Local<String> left,
                               Local<String> right);
 
+  /**
+   * Creates a new string containing the characters of the given string from
+   * index start (inclusive) to end (exclusive). Unless the result is short,
+   * it refers to the characters of the given string instead of copying them.
+   * In particular, substrings of an external string share its resource, which
+   * is only disposed once the external string and all of its substrings are
+   * no longer live. This allows creating many strings that view into one
+   * large external buffer, e.g. a mmap'ed file, without copying it.
+   */
+  static Local<String> NewSubString(Isolate* isolate, Local<String> string,
+                                    int start, int end);
+
   /**
    * Creates a new external string using the data defined in the given
    * resource. When the external string is no longer live on V8's heap the
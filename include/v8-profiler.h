@@ -210,7 +210,8 @@ class V8_EXPORT OutputStream {
 class V8_EXPORT CpuProfile {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,  // See format description near 'Serialize' method.
+    kPprof = 1  // Uncompressed binary pprof 'Profile' protocol buffer.
   };
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
@@ -281,6 +282,10 @@ class V8_EXPORT CpuProfile {
    *    timeDeltas: [numbers array]
    *  }
    *
+   * For the pprof format, the aggregated call tree is written as one sample
+   * per call path with a sample count and the CPU time in nanoseconds.
+   * Individual samples and their timestamps are not included. The output is
+   * binary and is passed to OutputStream::WriteAsciiChunk as is.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -524,6 +529,17 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Returns everything the running profile with the given id collected since
+   * it was started or since the previous snapshot, and restarts that profile
+   * with an empty call tree. Taking snapshots periodically allows a profile
+   * to run continuously with bounded memory, e.g. when it is started without
+   * recording individual samples. The returned profile is finished and must
+   * be deleted with CpuProfile::Delete. Returns nullptr if no profile with
+   * this id is running.
+   */
+  CpuProfile* TakeSnapshot(ProfilerId id);
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -631,7 +647,8 @@ class V8_EXPORT HeapGraphNode {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -681,6 +698,21 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format holds the same nodes, edges, strings and locations
+   * without the allocation tracking data. All numbers are unsigned LEB128
+   * varints. The stream starts with the bytes "V8HS" and a version (1),
+   * followed by:
+   *   - node count, edge count and string count;
+   *   - the strings, each as a byte length followed by UTF-8 bytes;
+   *   - the nodes, each as type, name, id, self_size, edge_count,
+   *     trace_node_id and detachedness, like in the JSON format;
+   *   - the edges, each as type, name_or_index and the ordinal of the node
+   *     it points to (rather than its offset in the nodes array);
+   *   - location count, followed by the locations, each as node ordinal,
+   *     script id, line and column.
+   * The result is passed to OutputStream::WriteAsciiChunk as is.
+   * tools/heap-snapshot-processor.py reads it and converts it to JSON.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -1061,6 +1093,19 @@ class V8_EXPORT HeapProfiler {
     kExposeNumericValues
   };
 
+  enum class EdgesMode {
+    /**
+     * All edges are recorded together with their names.
+     */
+    kAllEdges,
+    /**
+     * Only strong edges are recorded and edge names are omitted. The snapshot
+     * still allows computing dominators, retained sizes and a class histogram
+     * but takes less time and memory to generate.
+     */
+    kStrongEdgesWithoutNames
+  };
+
   struct HeapSnapshotOptions final {
     // Manually define default constructor here to be able to use it in
     // `TakeSnapshot()` below.
@@ -1083,6 +1128,10 @@ class V8_EXPORT HeapProfiler {
      * Mode for dealing with numeric values, see `NumericsMode`.
      */
     NumericsMode numerics_mode = NumericsMode::kHideNumericValues;
+    /**
+     * Mode for recording edges, see `EdgesMode`.
+     */
+    EdgesMode edges_mode = EdgesMode::kAllEdges;
     /**
      * Whether stack is considered as a root set.
      */
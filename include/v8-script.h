@@ -423,9 +423,12 @@ class V8_EXPORT ScriptCompiler {
       kInvalidHeader = 7,
       kLengthMismatch = 8,
       kReadOnlySnapshotChecksumMismatch = 9,
+      // The data is a code cache delta, which only applies on top of the
+      // caches it was created from (see ScriptCompiler::CreateCodeCacheDelta).
+      kDeltaBaseMismatch = 10,
 
       // This should always point at the last real enum value.
-      kLast = kReadOnlySnapshotChecksumMismatch
+      kLast = kDeltaBaseMismatch
     };
 
     // Check if the CachedData can be loaded in the given isolate.
@@ -840,6 +843,28 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script);
 
+  /**
+   * Creates and returns a code cache delta for the specified unbound_script,
+   * on top of previous_cache, which was created for the same script by
+   * CreateCodeCache or CreateCodeCacheDelta. Functions which previous_cache
+   * already holds compiled are not serialized again; the delta refers to
+   * their bytecode instead. This will return nullptr if the script cannot be
+   * serialized or previous_cache does not belong to it. The CachedData
+   * returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                          const CachedData* previous_cache);
+
+  /**
+   * Applies a code cache delta created by CreateCodeCacheDelta to the
+   * specified unbound_script, which was compiled from the cache the delta was
+   * created on top of (with the deltas preceding it in the chain applied in
+   * order). Returns false and sets delta->rejected if the delta does not
+   * apply, e.g. because the bytecode it refers to has been flushed since.
+   */
+  static bool ApplyCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                  CachedData* delta);
+
   /**
    * Creates and returns code cache for the specified unbound_module_script.
    * This will return nullptr if the script cannot be serialized. The
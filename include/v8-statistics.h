@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -154,12 +155,60 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the size of pages that are committed but currently not used by
+   * any space. These pages are kept in a pool for reuse and are not included
+   * in total_heap_size().
+   */
+  size_t pooled_memory_size() { return pooled_memory_size_; }
+
+  /**
+   * Returns the total size of pooled pages that were released while the
+   * isolate was idle, see Isolate::SetLoadHint().
+   */
+  size_t idle_decommitted_memory_size() {
+    return idle_decommitted_memory_size_;
+  }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
    */
   size_t does_zap_garbage() { return does_zap_garbage_; }
 
+  /**
+   * Returns how often the write barrier took its slow path to record an
+   * old-to-new slot, to mark a value while marking is on, or to record a slot
+   * pointing into the shared heap, since the isolate was created. Entries are
+   * sampled per thread, so the counts may lag by up to
+   * --write-barrier-slow-path-sampling-interval entries per thread.
+   */
+  size_t generational_write_barrier_slow_paths() {
+    return generational_write_barrier_slow_paths_;
+  }
+  size_t marking_write_barrier_slow_paths() {
+    return marking_write_barrier_slow_paths_;
+  }
+  size_t shared_write_barrier_slow_paths() {
+    return shared_write_barrier_slow_paths_;
+  }
+
+  /**
+   * Returns how often allocation took its slow path since the isolate was
+   * created, because the linear allocation buffer was exhausted, because
+   * allocation observers had to be stepped, or because a garbage collection
+   * was needed to satisfy the allocation.
+   */
+  size_t allocation_slow_paths_lab_exhausted() {
+    return allocation_slow_paths_lab_exhausted_;
+  }
+  size_t allocation_slow_paths_observer_step() {
+    return allocation_slow_paths_observer_step_;
+  }
+  size_t allocation_slow_paths_gc_needed() {
+    return allocation_slow_paths_gc_needed_;
+  }
+
  private:
   size_t total_heap_size_;
   size_t total_heap_size_executable_;
@@ -175,6 +224,14 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t pooled_memory_size_;
+  size_t idle_decommitted_memory_size_;
+  size_t generational_write_barrier_slow_paths_;
+  size_t marking_write_barrier_slow_paths_;
+  size_t shared_write_barrier_slow_paths_;
+  size_t allocation_slow_paths_lab_exhausted_;
+  size_t allocation_slow_paths_observer_step_;
+  size_t allocation_slow_paths_gc_needed_;
 
   friend class V8;
   friend class Isolate;
@@ -233,6 +290,149 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * The call count and own time of one of V8's runtime call counters, see
+ * Isolate::GetRuntimeCallStats.
+ */
+class V8_EXPORT RuntimeCallCounterStatistics {
+ public:
+  RuntimeCallCounterStatistics();
+  const char* name() { return name_; }
+  uint64_t count() { return count_; }
+  /**
+   * The time spent in the counter's scopes, excluding the time spent in
+   * nested counters. With --rcs-sampling-interval, this is estimated from the
+   * timed entries.
+   */
+  int64_t time_in_microseconds() { return time_in_microseconds_; }
+
+ private:
+  const char* name_;
+  uint64_t count_;
+  int64_t time_in_microseconds_;
+
+  friend class Isolate;
+};
+
+/**
+ * The misses of the inline cache at a property access site, see
+ * Isolate::GetICStatistics. The counts are halved periodically, so that they
+ * reflect recent behavior.
+ */
+class V8_EXPORT ICSiteStatistics {
+ public:
+  ICSiteStatistics();
+  /** The kind of inline cache, like "LoadIC" or "KeyedStoreIC". */
+  const std::string& type() const { return type_; }
+  const std::string& function_name() const { return function_name_; }
+  /** The id of the script containing the site, or -1. */
+  int script_id() const { return script_id_; }
+  /** The source position of the site within the script. */
+  int source_position() const { return source_position_; }
+  /**
+   * Whether the inline cache is megamorphic or generic, i.e. it no longer
+   * tracks the maps seen at the site.
+   */
+  bool is_megamorphic() const { return is_megamorphic_; }
+  uint64_t miss_count() const { return miss_count_; }
+  /** The number of misses that changed the state of the inline cache. */
+  uint64_t transition_count() const { return transition_count_; }
+
+ private:
+  std::string type_;
+  std::string function_name_;
+  int script_id_;
+  int source_position_;
+  bool is_megamorphic_;
+  uint64_t miss_count_;
+  uint64_t transition_count_;
+
+  friend class Isolate;
+};
+
+/**
+ * The deopts at a source position for a reason, see
+ * Isolate::GetDeoptStatistics. The counts are halved periodically, so that
+ * they reflect recent behavior.
+ */
+class V8_EXPORT DeoptSiteStatistics {
+ public:
+  DeoptSiteStatistics();
+  /**
+   * The function containing the deopt. For deopts in inlined functions, this
+   * is the inlined function.
+   */
+  const std::string& function_name() const { return function_name_; }
+  /** The id of the script containing the function, or -1. */
+  int script_id() const { return script_id_; }
+  /** The source position of the deopt within the script, or -1. */
+  int source_position() const { return source_position_; }
+  /** The kind of deopt, like "deopt-eager" or "deopt-lazy". */
+  const std::string& kind() const { return kind_; }
+  /** The reason for the deopt, like "wrong map". */
+  const std::string& reason() const { return reason_; }
+  uint64_t count() const { return count_; }
+
+ private:
+  std::string function_name_;
+  int script_id_;
+  int source_position_;
+  std::string kind_;
+  std::string reason_;
+  uint64_t count_;
+
+  friend class Isolate;
+};
+
+/**
+ * The failed optimizations of a function for a reason, see
+ * Isolate::GetDeoptStatistics. The counts are halved periodically, so that
+ * they reflect recent behavior.
+ */
+class V8_EXPORT OptimizationBailoutStatistics {
+ public:
+  OptimizationBailoutStatistics();
+  const std::string& function_name() const { return function_name_; }
+  /** The id of the script containing the function, or -1. */
+  int script_id() const { return script_id_; }
+  /** The start position of the function within the script. */
+  int source_position() const { return source_position_; }
+  /** The tier that failed to optimize, like "MAGLEV" or "TURBOFAN". */
+  const std::string& tier() const { return tier_; }
+  /** The reason for the bailout. */
+  const std::string& reason() const { return reason_; }
+  uint64_t count() const { return count_; }
+
+ private:
+  std::string function_name_;
+  int script_id_;
+  int source_position_;
+  std::string tier_;
+  std::string reason_;
+  uint64_t count_;
+
+  friend class Isolate;
+};
+
+/**
+ * The bytes allocated on the isolate's thread during an allocation phase, see
+ * Isolate::AllocationPhaseScope and Isolate::GetAllocationPhaseStatistics.
+ */
+class V8_EXPORT AllocationPhaseStatistics {
+ public:
+  AllocationPhaseStatistics();
+  /** The phase, or 0 for allocations outside of any phase. */
+  uint32_t phase() const { return phase_; }
+  /** The bytes allocated in all spaces since the isolate was created. */
+  size_t allocated_bytes() const { return allocated_bytes_; }
+
+ private:
+  uint32_t phase_;
+  size_t allocated_bytes_;
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
@@ -112,6 +112,26 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
 
+    /**
+     * Called when the ValueSerializer is going to serialize the contents of a
+     * non-shared, non-resizable ArrayBuffer that was not passed to
+     * ValueSerializer::TransferArrayBuffer. The embedder can keep the contents
+     * out of band, e.g. by holding on to the ArrayBuffer's BackingStore or by
+     * copying the contents into memory it shares with the deserializing side,
+     * and write an ID to |contents_id| which is serialized in their place.
+     * When deserializing, this ID will be passed to
+     * ValueDeserializer::Delegate::GetArrayBufferFromContentsId.
+     *
+     * Returns Just(true) if the contents are kept out of band, Just(false) if
+     * they should be serialized inline, and Nothing<bool>() after throwing an
+     * exception.
+     *
+     * The default implementation serializes all contents inline.
+     */
+    virtual Maybe<bool> WriteArrayBufferContentsOutOfBand(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer,
+        uint32_t* contents_id);
+
     /**
      * Called when the first shared value is serialized. All subsequent shared
      * values will use the same conveyor.
@@ -148,6 +168,18 @@ class V8_EXPORT ValueSerializer {
      * The default implementation uses the stdlib's `free()` function.
      */
     virtual void FreeBufferMemory(void* buffer);
+
+    /**
+     * Called in streaming mode (see ValueSerializer::SetChunkSize) with the
+     * next chunk of serialized data. The data is only valid during the call.
+     *
+     * If the chunk cannot be consumed, false should be returned, which fails
+     * serialization like a failed allocation.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool WriteChunk(Isolate* isolate, const uint8_t* data,
+                            size_t size);
   };
 
   explicit ValueSerializer(Isolate* isolate);
@@ -190,6 +222,17 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Switches to streaming mode. Instead of growing a single buffer, the
+   * serialized data is passed to Delegate::WriteChunk whenever about
+   * |chunk_size| bytes have been written, and large raw payloads such as the
+   * contents of ArrayBuffers are passed without being copied. Release() then
+   * only returns the data which has not been passed to WriteChunk yet. This
+   * should not be called when no Delegate was passed, and must be called
+   * before anything is written.
+   */
+  void SetChunkSize(size_t chunk_size);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -239,6 +282,13 @@ class V8_EXPORT ValueDeserializer {
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
 
+    /**
+     * Get an ArrayBuffer given a contents_id previously provided by
+     * ValueSerializer::Delegate::WriteArrayBufferContentsOutOfBand.
+     */
+    virtual MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t contents_id);
+
     /**
      * Get the SharedValueConveyor previously provided by
      * ValueSerializer::Delegate::AdoptSharedValueConveyor.
@@ -111,6 +111,25 @@ class V8_EXPORT WasmModuleObject : public Object {
   static MaybeLocal<WasmModuleObject> Compile(
       Isolate* isolate, MemorySpan<const uint8_t> wire_bytes);
 
+  /**
+   * Get a profile of the execution of this module so far: which functions
+   * were executed or tiered up, and the targets of their calls. The profile
+   * can be passed to {CompileWithProfile} to compile the same wire bytes in
+   * another isolate or process. It is only valid for the same version of V8.
+   */
+  OwnedBuffer GetProfile();
+
+  /**
+   * Compile a Wasm module from the provided uncompiled bytes, like {Compile},
+   * and use a profile returned by {GetProfile} to eagerly compile the
+   * functions which were hot in the profiling run to the optimizing tier,
+   * with the call feedback of the profile. A profile which does not match the
+   * wire bytes is ignored.
+   */
+  static MaybeLocal<WasmModuleObject> CompileWithProfile(
+      Isolate* isolate, MemorySpan<const uint8_t> wire_bytes,
+      MemorySpan<const uint8_t> profile);
+
   V8_INLINE static WasmModuleObject* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -171,6 +190,9 @@ class V8_EXPORT WasmStreaming final {
    * buffer must remain valid until either {Finish} or {Abort} completes.
    * The compiled module bytes should not be used until {Finish(true)} is
    * called, because they can be invalidated later by {Finish(false)}.
+   * With --wasm-partial-deserialization, the bytes can also be a prefix of
+   * the serialized module, e.g. the part of a cache entry which was already
+   * loaded. Functions whose code is not in the prefix are compiled lazily.
    */
   bool SetCompiledModuleBytes(const uint8_t* bytes, size_t size);
 
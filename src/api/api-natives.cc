@@ -181,6 +181,25 @@ Tagged<Object> GetIntrinsic(Isolate* isolate, v8::Intrinsic intrinsic) {
   return Tagged<Object>();
 }
 
+// Makes room for {count} more properties in the property dictionary of {obj},
+// if it has one, so that it isn't rehashed repeatedly while a template's
+// properties are installed one by one. This is the case for prototypes, which
+// are instantiated in dictionary mode.
+void EnsurePropertyDictionaryCapacity(Isolate* isolate,
+                                      DirectHandle<JSObject> obj, int count) {
+  if (count == 0 || obj->HasFastProperties() || IsJSGlobalObject(*obj)) {
+    return;
+  }
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    // TODO(v8:11388): Presize SwissNameDictionaries, too.
+    return;
+  } else {
+    Handle<NameDictionary> dictionary(obj->property_dictionary(), isolate);
+    dictionary = NameDictionary::EnsureCapacity(isolate, dictionary, count);
+    obj->SetProperties(*dictionary);
+  }
+}
+
 template <typename TemplateInfoT>
 MaybeHandle<JSObject> ConfigureInstance(Isolate* isolate, Handle<JSObject> obj,
                                         Handle<TemplateInfoT> data) {
@@ -199,6 +218,8 @@ MaybeHandle<JSObject> ConfigureInstance(Isolate* isolate, Handle<JSObject> obj,
     }
     info = info->GetParent(isolate);
   }
+  EnsurePropertyDictionaryCapacity(
+      isolate, obj, max_number_of_properties + data->number_of_properties());
 
   if (max_number_of_properties > 0) {
     int valid_descriptors = 0;
@@ -6,6 +6,7 @@
 
 #include <algorithm>  // For min
 #include <cmath>      // For isnan.
+#include <deque>
 #include <limits>
 #include <optional>
 #include <sstream>
@@ -23,6 +24,7 @@
 #include "include/v8-function.h"
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
+#include "include/v8-metrics.h"
 #include "include/v8-primitive-object.h"
 #include "include/v8-profiler.h"
 #include "include/v8-source-location.h"
@@ -35,6 +37,7 @@
 #include "src/api/api-natives.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
@@ -44,6 +47,7 @@
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins-utils.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/compile-job-histograms.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/cpu-features.h"
 #include "src/codegen/script-details.h"
@@ -52,6 +56,7 @@
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/date/date.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-stats.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/execution.h"
@@ -66,14 +71,19 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/memory-allocator.h"
+#include "src/heap/memory-reducer.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -83,8 +93,10 @@
 #include "src/objects/api-callbacks.h"
 #include "src/objects/backing-store.h"
 #include "src/objects/contexts.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type-inl.h"
@@ -140,6 +152,7 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
@@ -898,7 +911,7 @@ void HandleScope::Initialize(Isolate* v8_isolate) {
 #endif
 }
 
-HandleScope::~HandleScope() {
+void HandleScope::CloseScope() {
 #ifdef V8_ENABLE_CHECKS
   CHECK_EQ(scope_level_, i_isolate_->handle_scope_data()->level);
 #endif
@@ -915,7 +928,8 @@ int HandleScope::NumberOfHandles(Isolate* v8_isolate) {
       reinterpret_cast<i::Isolate*>(v8_isolate));
 }
 
-i::Address* HandleScope::CreateHandle(i::Isolate* i_isolate, i::Address value) {
+i::Address* HandleScope::CreateHandleSlow(i::Isolate* i_isolate,
+                                          i::Address value) {
   return i::HandleScope::CreateHandle(i_isolate, value);
 }
 
@@ -2869,6 +2883,36 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheDelta(
+    Local<UnboundScript> unbound_script, const CachedData* previous_cache) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  DCHECK(!InReadOnlySpace(*shared));
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared);
+  Utils::ApiCheck(!i_isolate->serializer_enabled(),
+                  "ScriptCompiler::CreateCodeCacheDelta",
+                  "Cannot create code cache while creating a snapshot");
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  DCHECK(shared->is_toplevel());
+  i::AlignedCachedData previous(previous_cache->data, previous_cache->length);
+  return i::CodeSerializer::Serialize(i_isolate, shared, &previous);
+}
+
+// static
+bool ScriptCompiler::ApplyCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                         CachedData* delta) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  DCHECK(!InReadOnlySpace(*shared));
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  DCHECK(shared->is_toplevel());
+  i::AlignedCachedData cached_data(delta->data, delta->length);
+  bool applied = i::CodeSerializer::DeserializeDelta(i_isolate, &cached_data,
+                                                     shared);
+  delta->rejected = cached_data.rejected();
+  return applied;
+}
+
 // static
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
     Local<UnboundModuleScript> unbound_module_script) {
@@ -3377,6 +3421,41 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<void> JSON::StringifyToUtf8(Local<Context> context,
+                                  Local<Value> json_object, Utf8Sink* sink,
+                                  Local<String> gap) {
+  Utils::ApiCheck(sink != nullptr, "v8::JSON::StringifyToUtf8",
+                  "sink must not be null");
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, Stringify, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = i_isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  has_exception =
+      !i::JsonStringifyToUtf8(i_isolate, object, replacer, gap_string, sink);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+  return JustVoid();
+}
+
+JSON::StreamingParser::StreamingParser()
+    : impl_(std::make_unique<i::JsonStreamingParser>()) {}
+
+JSON::StreamingParser::~StreamingParser() = default;
+
+void JSON::StreamingParser::Feed(const char* data, size_t length) {
+  impl_->Feed(reinterpret_cast<const uint8_t*>(data), length);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(impl_->Finish(i_isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3430,6 +3509,12 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<bool> ValueSerializer::Delegate::WriteArrayBufferContentsOutOfBand(
+    Isolate* v8_isolate, Local<ArrayBuffer> array_buffer,
+    uint32_t* contents_id) {
+  return Just(false);
+}
+
 bool ValueSerializer::Delegate::AdoptSharedValueConveyor(
     Isolate* v8_isolate, SharedValueConveyor&& conveyor) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -3450,6 +3535,11 @@ void ValueSerializer::Delegate::FreeBufferMemory(void* buffer) {
   return base::Free(buffer);
 }
 
+bool ValueSerializer::Delegate::WriteChunk(Isolate* v8_isolate,
+                                           const uint8_t* data, size_t size) {
+  return false;
+}
+
 struct ValueSerializer::PrivateData {
   explicit PrivateData(i::Isolate* i, ValueSerializer::Delegate* delegate)
       : isolate(i), serializer(i, delegate) {}
@@ -3472,6 +3562,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetChunkSize(size_t chunk_size) {
+  private_->serializer.SetChunkSize(chunk_size);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3537,6 +3631,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+MaybeLocal<ArrayBuffer>
+ValueDeserializer::Delegate::GetArrayBufferFromContentsId(Isolate* v8_isolate,
+                                                          uint32_t id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<ArrayBuffer>();
+}
+
 const SharedValueConveyor* ValueDeserializer::Delegate::GetSharedValueConveyor(
     Isolate* v8_isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -4751,6 +4855,42 @@ MaybeLocal<Value> v8::Object::Get(Local<v8::Context> context, Local<Value> key,
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+Maybe<void> v8::Object::GetMany(Local<Context> context, Local<Name>* names,
+                                 Local<Value>* values, size_t length) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i::Handle<i::FixedArray> results;
+  {
+    // Collect the values in a FixedArray, so that a single handle needs to
+    // escape the scope.
+    ENTER_V8(i_isolate, context, Object, GetMany, InternalEscapableScope);
+    auto self = Utils::OpenHandle(this);
+    i::Handle<i::FixedArray> values_array =
+        i_isolate->factory()->NewFixedArray(static_cast<int>(length));
+    for (size_t i = 0; i < length; ++i) {
+      auto name = Utils::OpenHandle(*names[i]);
+      if (!IsUniqueName(*name)) {
+        name = i_isolate->factory()->InternalizeName(name);
+      }
+      i::Handle<i::Object> value;
+      // Getters and interceptors can change the map of {self}, so the fast
+      // path is checked again for every property.
+      if (!TryGetOwnFastDataProperty(i_isolate, self, name).ToHandle(&value)) {
+        has_exception =
+            !i::Runtime::GetObjectProperty(i_isolate, self, name)
+                 .ToHandle(&value);
+        RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+      }
+      values_array->set(static_cast<int>(i), *value);
+    }
+    results = handle_scope.Escape(values_array);
+  }
+  for (size_t i = 0; i < length; ++i) {
+    values[i] = Utils::ToLocal(
+        i::handle(results->get(static_cast<int>(i)), i_isolate));
+  }
+  return JustVoid();
+}
+
 MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   PREPARE_FOR_EXECUTION(context, Object, Get);
   auto self = Utils::OpenHandle(this);
@@ -6595,7 +6735,15 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      pooled_memory_size_(0),
+      idle_decommitted_memory_size_(0),
+      generational_write_barrier_slow_paths_(0),
+      marking_write_barrier_slow_paths_(0),
+      shared_write_barrier_slow_paths_(0),
+      allocation_slow_paths_lab_exhausted_(0),
+      allocation_slow_paths_observer_step_(0),
+      allocation_slow_paths_gc_needed_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -6616,6 +6764,25 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+RuntimeCallCounterStatistics::RuntimeCallCounterStatistics()
+    : name_(nullptr), count_(0), time_in_microseconds_(0) {}
+
+ICSiteStatistics::ICSiteStatistics()
+    : script_id_(-1),
+      source_position_(0),
+      is_megamorphic_(false),
+      miss_count_(0),
+      transition_count_(0) {}
+
+DeoptSiteStatistics::DeoptSiteStatistics()
+    : script_id_(-1), source_position_(-1), count_(0) {}
+
+OptimizationBailoutStatistics::OptimizationBailoutStatistics()
+    : script_id_(-1), source_position_(0), count_(0) {}
+
+AllocationPhaseStatistics::AllocationPhaseStatistics()
+    : phase_(0), allocated_bytes_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -7667,6 +7834,18 @@ Local<String> v8::String::Concat(Isolate* v8_isolate, Local<String> left,
   return Utils::ToLocal(result);
 }
 
+Local<String> v8::String::NewSubString(Isolate* v8_isolate,
+                                       Local<String> string, int start,
+                                       int end) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  auto str = Utils::OpenHandle(*string);
+  Utils::ApiCheck(0 <= start && start <= end && end <= str->length(),
+                  "v8::String::NewSubString", "Invalid substring range");
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewSubString);
+  return Utils::ToLocal(i_isolate->factory()->NewSubString(str, start, end));
+}
+
 MaybeLocal<String> v8::String::NewExternalTwoByte(
     Isolate* v8_isolate, v8::String::ExternalStringResource* resource) {
   CHECK(resource && resource->data());
@@ -7867,6 +8046,103 @@ void AddPropertiesAndElementsToObject(i::Isolate* i_isolate,
   }
 }
 
+// Creates an object with fast properties by following the map transitions
+// for {names} from the object literal map with {length} in-object properties.
+// The transition tree acts as the map cache, so objects with the same
+// prototype and names share their map. Returns an empty handle if the object
+// needs dictionary properties or elements instead.
+i::MaybeHandle<i::JSObject> TryNewFastJSObject(i::Isolate* i_isolate,
+                                               i::Handle<i::JSObject> proto,
+                                               Local<Name>* names,
+                                               Local<Value>* values,
+                                               size_t length) {
+  if (length >= i::JSObject::kMapCacheSize) return {};
+  i::Handle<i::Map> map = i_isolate->factory()->ObjectLiteralMapFromCache(
+      i_isolate->native_context(), static_cast<int>(length));
+  if (map->prototype() != *proto) {
+    map = i::Map::TransitionRootMapToPrototypeForNewObject(i_isolate, map,
+                                                           proto);
+  }
+
+  for (size_t i = 0; i < length; ++i) {
+    auto name = Utils::OpenHandle(*names[i]);
+    uint32_t index;
+    if (name->AsArrayIndex(&index)) return {};
+    name = i_isolate->factory()->InternalizeName(name);
+    if (map->is_dictionary_map()) return {};
+    if (map->is_deprecated()) map = i::Map::Update(i_isolate, map);
+    // Duplicate names would require overwriting an earlier field.
+    if (map->instance_descriptors(i_isolate)
+            ->SearchWithCache(i_isolate, *name, *map)
+            .is_found()) {
+      return {};
+    }
+    map = i::Map::TransitionToDataProperty(
+        i_isolate, map, name, Utils::OpenHandle(*values[i]), i::NONE,
+        i::PropertyConstness::kConst, i::StoreOrigin::kNamed);
+  }
+  if (map->is_dictionary_map() || map->is_deprecated()) return {};
+
+  // Box values of double fields before allocating the object, so that the
+  // object's fields can be initialized without any allocation in between.
+  i::DirectHandle<i::DescriptorArray> descriptors(
+      map->instance_descriptors(i_isolate), i_isolate);
+  std::vector<i::Handle<i::Object>> field_values(length);
+  for (size_t i = 0; i < length; ++i) {
+    i::PropertyDetails details =
+        descriptors->GetDetails(i::InternalIndex(static_cast<int>(i)));
+    if (details.location() != i::PropertyLocation::kField ||
+        !i::FieldIndex::ForDetails(*map, details).is_inobject()) {
+      return {};
+    }
+    field_values[i] = Utils::OpenHandle(*values[i]);
+    if (details.representation().IsDouble()) {
+      field_values[i] = i_isolate->factory()->NewHeapNumber(
+          i::Object::NumberValue(*field_values[i]));
+    }
+  }
+
+  i::Handle<i::JSObject> object =
+      i_isolate->factory()->NewJSObjectFromMap(map);
+  i::DisallowGarbageCollection no_gc;
+  i::Tagged<i::JSObject> raw_object = *object;
+  for (size_t i = 0; i < length; ++i) {
+    i::PropertyDetails details =
+        descriptors->GetDetails(i::InternalIndex(static_cast<int>(i)));
+    raw_object->FastPropertyAtPut(i::FieldIndex::ForDetails(*map, details),
+                                  *field_values[i]);
+  }
+  return object;
+}
+
+// Returns the value of the own data property {name} of {receiver} if it can
+// be read directly from a fast-mode object, or an empty handle if the
+// property needs a full lookup.
+i::MaybeHandle<i::Object> TryGetOwnFastDataProperty(
+    i::Isolate* i_isolate, i::DirectHandle<i::JSReceiver> receiver,
+    i::DirectHandle<i::Name> name) {
+  i::Tagged<i::Map> map = receiver->map();
+  if (!IsJSObjectMap(map) || map->is_dictionary_map() ||
+      i::IsSpecialReceiverMap(map)) {
+    return {};
+  }
+  uint32_t index;
+  if (!IsUniqueName(*name) || name->AsArrayIndex(&index)) return {};
+
+  i::Tagged<i::DescriptorArray> descriptors =
+      map->instance_descriptors(i_isolate);
+  i::InternalIndex entry = descriptors->SearchWithCache(i_isolate, *name, map);
+  if (entry.is_not_found()) return {};
+  i::PropertyDetails details = descriptors->GetDetails(entry);
+  if (details.kind() != i::PropertyKind::kData) return {};
+  if (details.location() == i::PropertyLocation::kDescriptor) {
+    return i::handle(descriptors->GetStrongValue(entry), i_isolate);
+  }
+  return i::JSObject::FastPropertyAt(
+      i_isolate, i::Cast<i::JSObject>(receiver), details.representation(),
+      i::FieldIndex::ForDetails(map, details));
+}
+
 }  // namespace
 
 Local<v8::Object> v8::Object::New(Isolate* v8_isolate,
@@ -7882,6 +8158,15 @@ Local<v8::Object> v8::Object::New(Isolate* v8_isolate,
   API_RCS_SCOPE(i_isolate, Object, New);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
 
+  if (IsJSObject(*proto)) {
+    i::Handle<i::JSObject> obj;
+    if (TryNewFastJSObject(i_isolate, i::Cast<i::JSObject>(proto), names,
+                           values, length)
+            .ToHandle(&obj)) {
+      return Utils::ToLocal(obj);
+    }
+  }
+
   i::Handle<i::FixedArrayBase> elements =
       i_isolate->factory()->empty_fixed_array();
 
@@ -8903,8 +9188,28 @@ MaybeLocal<WasmModuleObject> WasmModuleObject::FromCompiledModule(
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer WasmModuleObject::GetProfile() {
+#if V8_ENABLE_WEBASSEMBLY
+  auto obj = i::Cast<i::WasmModuleObject>(Utils::OpenDirectHandle(this));
+  i::wasm::NativeModule* native_module = obj->native_module();
+  base::OwnedVector<uint8_t> profile = i::wasm::GetProfile(
+      native_module->module(), native_module->wire_bytes(),
+      native_module->tiering_budget_array());
+  size_t size = profile.size();
+  return {profile.ReleaseData(), size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 MaybeLocal<WasmModuleObject> WasmModuleObject::Compile(
     Isolate* v8_isolate, MemorySpan<const uint8_t> wire_bytes) {
+  return CompileWithProfile(v8_isolate, wire_bytes, {});
+}
+
+MaybeLocal<WasmModuleObject> WasmModuleObject::CompileWithProfile(
+    Isolate* v8_isolate, MemorySpan<const uint8_t> wire_bytes,
+    MemorySpan<const uint8_t> profile) {
 #if V8_ENABLE_WEBASSEMBLY
   const uint8_t* start = wire_bytes.data();
   size_t length = wire_bytes.size();
@@ -8920,7 +9225,8 @@ MaybeLocal<WasmModuleObject> WasmModuleObject::Compile(
     // TODO(14179): Provide an API method that supports compile options.
     maybe_compiled = i::wasm::GetWasmEngine()->SyncCompile(
         i_isolate, enabled_features, i::wasm::CompileTimeImports{}, &thrower,
-        i::wasm::ModuleWireBytes(start, start + length));
+        i::wasm::ModuleWireBytes(start, start + length),
+        base::VectorOf(profile.data(), profile.size()));
   }
   CHECK_EQ(maybe_compiled.is_null(), i_isolate->has_exception());
   if (maybe_compiled.is_null()) {
@@ -8949,6 +9255,13 @@ void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
   return new_data;
 }
 
+void v8::ArrayBuffer::Allocator::FreeBatch(
+    MemorySpan<const FreeRequest> requests) {
+  for (const FreeRequest& request : requests) {
+    Free(request.data, request.length);
+  }
+}
+
 // static
 v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewDefaultAllocator() {
   return new ArrayBufferAllocator();
@@ -9807,6 +10120,7 @@ void Isolate::Initialize(Isolate* v8_isolate,
                          const v8::Isolate::CreateParams& params) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.IsolateInitialize");
+  const base::TimeTicks start = base::TimeTicks::Now();
   if (auto allocator = params.array_buffer_allocator_shared) {
     CHECK(params.array_buffer_allocator == nullptr ||
           params.array_buffer_allocator == allocator.get());
@@ -9897,6 +10211,8 @@ void Isolate::Initialize(Isolate* v8_isolate,
         "The current platform's foreground task runner does not have "
         "non-nestable tasks enabled. The embedder must provide one.");
   }
+  i_isolate->startup_timings()->IsolateCreated(base::TimeTicks::Now() -
+                                               start);
 }
 
 Isolate* Isolate::New(const Isolate::CreateParams& params) {
@@ -9914,6 +10230,96 @@ void Isolate::Dispose() {
   i::Isolate::Delete(i_isolate);
 }
 
+namespace internal {
+
+class IsolatePoolImpl {
+ public:
+  explicit IsolatePoolImpl(const v8::Isolate::CreateParams& params)
+      : params_(params) {}
+
+  ~IsolatePoolImpl() {
+    base::MutexGuard guard(&mutex_);
+    while (pending_ > 0) ready_cv_.Wait(&mutex_);
+    for (auto& [v8_isolate, context] : ready_) {
+      {
+        v8::Locker locker(v8_isolate);
+        context.Reset();
+      }
+      v8_isolate->Dispose();
+    }
+  }
+
+  void StartCreatingIsolate() {
+    {
+      base::MutexGuard guard(&mutex_);
+      pending_++;
+    }
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<CreateIsolateTask>(this));
+  }
+
+  v8::Isolate* Take(v8::Global<v8::Context>* context) {
+    v8::Isolate* v8_isolate;
+    {
+      base::MutexGuard guard(&mutex_);
+      while (ready_.empty()) ready_cv_.Wait(&mutex_);
+      v8_isolate = ready_.front().first;
+      *context = std::move(ready_.front().second);
+      ready_.pop_front();
+    }
+    StartCreatingIsolate();
+    return v8_isolate;
+  }
+
+ private:
+  class CreateIsolateTask final : public v8::Task {
+   public:
+    explicit CreateIsolateTask(IsolatePoolImpl* pool) : pool_(pool) {}
+
+    void Run() final {
+      v8::Isolate* v8_isolate = v8::Isolate::Allocate();
+      v8::Global<v8::Context> context;
+      {
+        v8::Locker locker(v8_isolate);
+        v8::Isolate::Initialize(v8_isolate, pool_->params_);
+        v8::Isolate::Scope isolate_scope(v8_isolate);
+        v8::HandleScope handle_scope(v8_isolate);
+        context.Reset(v8_isolate, v8::Context::New(v8_isolate));
+      }
+      base::MutexGuard guard(&pool_->mutex_);
+      pool_->ready_.emplace_back(v8_isolate, std::move(context));
+      pool_->pending_--;
+      pool_->ready_cv_.NotifyAll();
+    }
+
+   private:
+    IsolatePoolImpl* const pool_;
+  };
+
+  const v8::Isolate::CreateParams params_;
+  base::Mutex mutex_;
+  base::ConditionVariable ready_cv_;
+  // Isolates that are ready to be taken, in creation order.
+  std::deque<std::pair<v8::Isolate*, v8::Global<v8::Context>>> ready_;
+  // The number of isolates that are being created.
+  size_t pending_ = 0;
+};
+
+}  // namespace internal
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t size)
+    : impl_(new i::IsolatePoolImpl(params)) {
+  Utils::ApiCheck(size > 0, "v8::IsolatePool::IsolatePool",
+                  "The pool must hold at least one isolate");
+  for (size_t i = 0; i < size; i++) impl_->StartCreatingIsolate();
+}
+
+IsolatePool::~IsolatePool() { delete impl_; }
+
+Isolate* IsolatePool::Take(Global<Context>* context) {
+  return impl_->Take(context);
+}
+
 void Isolate::DumpAndResetStats() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
 #ifdef DEBUG
@@ -10046,6 +10452,15 @@ Isolate::SuppressMicrotaskExecutionScope::~SuppressMicrotaskExecutionScope() {
   i_isolate_->thread_local_top()->DecrementCallDepth(this);
 }
 
+Isolate::AllocationPhaseScope::AllocationPhaseScope(Isolate* v8_isolate,
+                                                    uint32_t phase)
+    : i_isolate_(reinterpret_cast<i::Isolate*>(v8_isolate)),
+      previous_phase_(i_isolate_->heap()->SetAllocationPhase(phase)) {}
+
+Isolate::AllocationPhaseScope::~AllocationPhaseScope() {
+  i_isolate_->heap()->SetAllocationPhase(previous_phase_);
+}
+
 i::Address* Isolate::GetDataFromSnapshotOnce(size_t index) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   auto list = i::Cast<i::FixedArray>(i_isolate->heap()->serialized_objects());
@@ -10128,6 +10543,27 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
+  heap_statistics->pooled_memory_size_ =
+      heap->memory_allocator()->pool()->CommittedBufferedMemory();
+  heap_statistics->idle_decommitted_memory_size_ =
+      heap->memory_reducer() ? heap->memory_reducer()->idle_decommitted_memory()
+                             : 0;
+
+  using WriteBarrierKind = i::SlowPathCounters::WriteBarrierKind;
+  using AllocationReason = i::SlowPathCounters::AllocationReason;
+  const i::SlowPathCounters* slow_path_counters = heap->slow_path_counters();
+  heap_statistics->generational_write_barrier_slow_paths_ =
+      slow_path_counters->write_barrier(WriteBarrierKind::kGenerational);
+  heap_statistics->marking_write_barrier_slow_paths_ =
+      slow_path_counters->write_barrier(WriteBarrierKind::kMarking);
+  heap_statistics->shared_write_barrier_slow_paths_ =
+      slow_path_counters->write_barrier(WriteBarrierKind::kShared);
+  heap_statistics->allocation_slow_paths_lab_exhausted_ =
+      slow_path_counters->allocation(AllocationReason::kLabExhausted);
+  heap_statistics->allocation_slow_paths_observer_step_ =
+      slow_path_counters->allocation(AllocationReason::kObserverStep);
+  heap_statistics->allocation_slow_paths_gc_needed_ =
+      slow_path_counters->allocation(AllocationReason::kGCNeeded);
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -10137,6 +10573,18 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+void Isolate::GetGCLatencyHistograms(
+    metrics::GarbageCollectionLatencyHistograms* histograms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->tracer()->latency_histograms().CopyTo(histograms);
+}
+
+void Isolate::GetCompileJobHistograms(
+    metrics::CompileJobHistograms* histograms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->compile_job_histograms()->CopyTo(histograms);
+}
+
 size_t Isolate::NumberOfHeapSpaces() {
   return i::LAST_SPACE - i::FIRST_SPACE + 1;
 }
@@ -10232,6 +10680,108 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetRuntimeCallStats(
+    std::vector<RuntimeCallCounterStatistics>* counters) {
+#ifdef V8_RUNTIME_CALL_STATS
+  if (!counters || !i::TracingFlags::is_runtime_stats_enabled()) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* main_stats =
+      i_isolate->counters()->runtime_call_stats();
+  i::RuntimeCallTimer* current_timer = main_stats->current_timer();
+  if (current_timer && current_timer->IsStarted()) current_timer->Snapshot();
+  auto stats = std::make_unique<i::RuntimeCallStats>(
+      i::RuntimeCallStats::kMainIsolateThread);
+  stats->Add(main_stats);
+  i_isolate->counters()->worker_thread_runtime_call_stats()->AddTo(
+      stats.get());
+
+  // In sampled mode, only every n-th outermost entry was timed.
+  int64_t time_scale = i::RuntimeCallStats::IsSampledMode()
+                           ? i::v8_flags.rcs_sampling_interval.value()
+                           : 1;
+  counters->clear();
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (counter->count() == 0) continue;
+    RuntimeCallCounterStatistics entry;
+    entry.name_ = counter->name();
+    entry.count_ = counter->count();
+    entry.time_in_microseconds_ =
+        counter->time().InMicroseconds() * time_scale;
+    counters->push_back(entry);
+  }
+  return true;
+#else
+  return false;
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
+bool Isolate::GetICStatistics(std::vector<ICSiteStatistics>* sites) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!sites || i_isolate->ic_site_stats() == nullptr) return false;
+
+  sites->clear();
+  for (i::ICSiteStats::Site& site : i_isolate->ic_site_stats()->GetSites()) {
+    ICSiteStatistics entry;
+    entry.type_ = std::move(site.type);
+    entry.function_name_ = std::move(site.function_name);
+    entry.script_id_ = site.script_id;
+    entry.source_position_ = site.position;
+    entry.is_megamorphic_ = site.state == i::InlineCacheState::MEGAMORPHIC ||
+                            site.state == i::InlineCacheState::GENERIC;
+    entry.miss_count_ = site.misses;
+    entry.transition_count_ = site.transitions;
+    sites->push_back(std::move(entry));
+  }
+  return true;
+}
+
+bool Isolate::GetDeoptStatistics(
+    std::vector<DeoptSiteStatistics>* deopts,
+    std::vector<OptimizationBailoutStatistics>* bailouts) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::DeoptStats* stats = i_isolate->deopt_stats();
+  if (!deopts || !bailouts || stats == nullptr) return false;
+
+  deopts->clear();
+  for (i::DeoptStats::Deopt& deopt : stats->GetDeopts()) {
+    DeoptSiteStatistics entry;
+    entry.function_name_ = std::move(deopt.function_name);
+    entry.script_id_ = deopt.script_id;
+    entry.source_position_ = deopt.position;
+    entry.kind_ = i::Deoptimizer::MessageFor(deopt.kind);
+    entry.reason_ = i::DeoptimizeReasonToString(deopt.reason);
+    entry.count_ = deopt.count;
+    deopts->push_back(std::move(entry));
+  }
+  bailouts->clear();
+  for (i::DeoptStats::Bailout& bailout : stats->GetBailouts()) {
+    OptimizationBailoutStatistics entry;
+    entry.function_name_ = std::move(bailout.function_name);
+    entry.script_id_ = bailout.script_id;
+    entry.source_position_ = bailout.position;
+    entry.tier_ = i::CodeKindToString(bailout.tier);
+    entry.reason_ = i::GetBailoutReason(bailout.reason);
+    entry.count_ = bailout.count;
+    bailouts->push_back(std::move(entry));
+  }
+  return true;
+}
+
+void Isolate::GetAllocationPhaseStatistics(
+    std::vector<AllocationPhaseStatistics>* phases) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  phases->clear();
+  for (const auto& [phase, allocated_bytes] :
+       i_isolate->heap()->AllocatedBytesPerAllocationPhase()) {
+    AllocationPhaseStatistics entry;
+    entry.phase_ = phase;
+    entry.allocated_bytes_ = allocated_bytes;
+    phases->push_back(entry);
+  }
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10413,6 +10963,9 @@ void Isolate::SetMetricsRecorder(
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->metrics_recorder()->SetEmbedderRecorder(i_isolate,
                                                      metrics_recorder);
+  i_isolate->metrics_recorder()->AddMainThreadEvent(
+      i_isolate->startup_timings()->isolate_created_event(),
+      metrics::Recorder::ContextId::Empty());
 }
 
 void Isolate::SetAddCrashKeyCallback(AddCrashKeyCallback callback) {
@@ -10499,6 +11052,11 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return i_isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetLoadHint(LoadHint hint) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetLoadHint(hint);
+}
+
 void Isolate::UpdateLoadStartTime() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->UpdateLoadStartTime();
@@ -11204,10 +11762,15 @@ static i::CpuProfile* ToInternal(const CpuProfile* profile) {
 
 void CpuProfile::Serialize(OutputStream* stream,
                            CpuProfile::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::CpuProfile::Serialize",
-                  "Unknown serialization format");
+  Utils::ApiCheck(format == kJSON || format == kPprof,
+                  "v8::CpuProfile::Serialize", "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
                   "Invalid stream chunk size");
+  if (format == kPprof) {
+    i::CpuProfilePprofSerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::CpuProfileJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11325,6 +11888,11 @@ CpuProfile* CpuProfiler::Stop(ProfilerId id) {
       reinterpret_cast<i::CpuProfiler*>(this)->StopProfiling(id));
 }
 
+CpuProfile* CpuProfiler::TakeSnapshot(ProfilerId id) {
+  return reinterpret_cast<CpuProfile*>(
+      reinterpret_cast<i::CpuProfiler*>(this)->TakeSnapshot(id));
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* v8_isolate) {
   reinterpret_cast<i::Isolate*>(v8_isolate)
       ->SetDetailedSourcePositionsForProfiling(true);
@@ -11509,10 +12077,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
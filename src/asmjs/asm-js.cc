@@ -4,12 +4,19 @@
 
 #include "src/asmjs/asm-js.h"
 
+#include <memory>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "src/asmjs/asm-names.h"
 #include "src/asmjs/asm-parser.h"
 #include "src/ast/ast.h"
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/vector.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/unoptimized-compilation-info.h"
@@ -178,6 +185,80 @@ void ReportInstantiationFailure(Handle<Script> script, int position,
          v8::Isolate::kMessageWarning);
 }
 
+// Caches the translations of asm.js modules for all isolates of the process,
+// keyed by the source of the module and its position in the script, which the
+// asm.js offset table depends on. Loading the same asm.js code again, e.g.
+// in a worker or after the script was evicted from the compilation cache, then
+// skips parsing and validation. The resulting Wasm module is compiled lazily
+// anyway, and the NativeModule cache of the WasmEngine can share its code.
+// The cache is bounded by --asm-wasm-translation-cache-size and doesn't evict
+// entries.
+class AsmJsTranslationCache {
+ public:
+  struct Key {
+    std::u16string source;
+    int start_position = 0;
+    bool operator==(const Key& other) const {
+      return start_position == other.start_position && source == other.source;
+    }
+  };
+  struct Translation {
+    std::vector<uint8_t> module_bytes;
+    std::vector<uint8_t> asm_offsets;
+    wasm::AsmJsParser::StdlibSet stdlib_uses;
+  };
+
+  std::shared_ptr<const Translation> Lookup(const Key& key) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return {};
+    return it->second;
+  }
+
+  void Put(Key key, std::shared_ptr<const Translation> translation) {
+    const size_t entry_size = key.source.size() * sizeof(char16_t) +
+                              translation->module_bytes.size() +
+                              translation->asm_offsets.size();
+    base::MutexGuard guard(&mutex_);
+    if (size_ + entry_size > v8_flags.asm_wasm_translation_cache_size * MB) {
+      return;
+    }
+    if (entries_.emplace(std::move(key), std::move(translation)).second) {
+      size_ += entry_size;
+    }
+  }
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(
+          base::hash_range(key.source.begin(), key.source.end()),
+          key.start_position);
+    }
+  };
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const Translation>, KeyHash>
+      entries_;
+  size_t size_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(AsmJsTranslationCache,
+                                GetAsmJsTranslationCache)
+
+// Reads the characters in [start, end) from {stream}.
+std::u16string ReadSource(Utf16CharacterStream* stream, int start, int end) {
+  std::u16string source;
+  source.reserve(end - start);
+  stream->Seek(start);
+  while (static_cast<int>(stream->pos()) < end) {
+    base::uc32 c = stream->Advance();
+    if (c == Utf16CharacterStream::kEndOfInput) break;
+    source.push_back(static_cast<char16_t>(c));
+  }
+  return source;
+}
+
 }  // namespace
 
 // The compilation of asm.js modules is split into two distinct steps:
@@ -240,7 +321,29 @@ UnoptimizedCompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
   if (stream->can_access_heap()) {
     allow_deref.emplace();
   }
-  stream->Seek(compilation_info()->literal()->start_position());
+  const int start_position = compilation_info()->literal()->start_position();
+  const int end_position = compilation_info()->literal()->end_position();
+  module_source_size_ = end_position - start_position;
+  module_ = compile_zone->New<wasm::ZoneBuffer>(compile_zone);
+  asm_offsets_ = compile_zone->New<wasm::ZoneBuffer>(compile_zone);
+
+  const bool use_cache = v8_flags.asm_wasm_translation_cache_size > 0;
+  AsmJsTranslationCache::Key cache_key;
+  if (use_cache) {
+    cache_key = {ReadSource(stream, start_position, end_position),
+                 start_position};
+    std::shared_ptr<const AsmJsTranslationCache::Translation> cached =
+        GetAsmJsTranslationCache()->Lookup(cache_key);
+    if (cached) {
+      module_->write(cached->module_bytes.data(), cached->module_bytes.size());
+      asm_offsets_->write(cached->asm_offsets.data(),
+                          cached->asm_offsets.size());
+      stdlib_uses_ = cached->stdlib_uses;
+      return SUCCEEDED;
+    }
+  }
+
+  stream->Seek(start_position);
   wasm::AsmJsParser parser(&translate_zone, stack_limit(), stream);
   if (!parser.Run()) {
     if (!v8_flags.suppress_asm_messages) {
@@ -249,14 +352,18 @@ UnoptimizedCompilationJob::Status AsmJsCompilationJob::ExecuteJobImpl() {
     }
     return FAILED;
   }
-  module_ = compile_zone->New<wasm::ZoneBuffer>(compile_zone);
   parser.module_builder()->WriteTo(module_);
-  asm_offsets_ = compile_zone->New<wasm::ZoneBuffer>(compile_zone);
   parser.module_builder()->WriteAsmJsOffsetTable(asm_offsets_);
   stdlib_uses_ = *parser.stdlib_uses();
 
-  module_source_size_ = compilation_info()->literal()->end_position() -
-                        compilation_info()->literal()->start_position();
+  if (use_cache) {
+    auto translation = std::make_shared<AsmJsTranslationCache::Translation>();
+    translation->module_bytes.assign(module_->begin(), module_->end());
+    translation->asm_offsets.assign(asm_offsets_->begin(), asm_offsets_->end());
+    translation->stdlib_uses = stdlib_uses_;
+    GetAsmJsTranslationCache()->Put(std::move(cache_key),
+                                    std::move(translation));
+  }
   return SUCCEEDED;
 }
 
@@ -848,6 +848,28 @@ CPU::CPU()
     has_fp16_ = HasListItem(features, "half");
     delete[] features;
   }
+
+  // The core is identified by the implementer and part numbers, e.g. for
+  // selecting the machine model of the instruction scheduler.
+  CPUInfo cpu_info;
+  char* implementer = cpu_info.ExtractField("CPU implementer");
+  if (implementer != nullptr) {
+    char* end;
+    implementer_ = strtol(implementer, &end, 0);
+    if (end == implementer) {
+      implementer_ = 0;
+    }
+    delete[] implementer;
+  }
+  char* part = cpu_info.ExtractField("CPU part");
+  if (part != nullptr) {
+    char* end;
+    part_ = strtol(part, &end, 0);
+    if (end == part) {
+      part_ = 0;
+    }
+    delete[] part;
+  }
 #elif V8_OS_DARWIN
 #if V8_OS_IOS
   int64_t feat_jscvt = 0;
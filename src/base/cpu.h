@@ -59,6 +59,10 @@ class V8_BASE_EXPORT CPU final {
   static const int kArmCortexA9 = 0xc09;
   static const int kArmCortexA12 = 0xc0c;
   static const int kArmCortexA15 = 0xc0f;
+  static const int kArmNeoverseN1 = 0xd0c;
+  static const int kArmNeoverseV1 = 0xd40;
+  static const int kArmNeoverseN2 = 0xd49;
+  static const int kArmNeoverseV2 = 0xd4f;
 
   // Denver-specific part code
   static const int kNvidiaDenverV10 = 0x002;
@@ -120,6 +120,15 @@ class Double {
     return (d64 & kSignMask) == 0 ? 1 : -1;
   }
 
+  // Returns true if the lower boundary of this is closer than the upper one,
+  // which is the case for powers of two: the predecessor of 1000e10 is 9999e9.
+  // The only exception is the smallest normal: the largest denormal is at the
+  // same distance as its successor.
+  bool LowerBoundaryIsCloser() const {
+    return (AsUint64() & kSignificandMask) == 0 &&
+           Exponent() != kDenormalExponent;
+  }
+
   // Precondition: the value encoded by this Double must be greater or equal
   // than +0.0.
   DiyFp UpperBoundary() const {
@@ -136,7 +145,7 @@ class Double {
     DiyFp v = this->AsDiyFp();
     DiyFp m_plus = DiyFp::Normalize(DiyFp((v.f() << 1) + 1, v.e() - 1));
     DiyFp m_minus;
-    if ((AsUint64() & kSignificandMask) == 0 && v.e() != kDenormalExponent) {
+    if (LowerBoundaryIsCloser()) {
       // The boundary is closer. Think of v = 1000e10 and v- = 9999e9.
       // Then the boundary (== (v - v-)/2) is not just at a distance of 1e9 but
       // at a distance of 1e8.
@@ -11,6 +11,7 @@
 #include "src/base/numbers/double.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/numbers/fixed-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
 
 namespace v8 {
 namespace base {
@@ -54,11 +55,13 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  if (mode == DTOA_SHORTEST) {
+    SchubfachDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
@@ -71,6 +74,22 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
   }
   if (fast_worked) return;
 
+  // A shortest representation of at most 15 digits is less than half a unit
+  // of its last digit away from v, so it is also the correctly rounded result
+  // for any precision from its length up to 15 digits.
+  if (mode == DTOA_PRECISION && requested_digits <= 15) {
+    // {buffer} may only have room for requested_digits digits.
+    char shortest[kSchubfachDtoaMaximalLength + 1];
+    int shortest_length;
+    SchubfachDtoa(v, Vector<char>(shortest, kSchubfachDtoaMaximalLength + 1),
+                  &shortest_length, point);
+    if (shortest_length <= requested_digits) {
+      for (int i = 0; i <= shortest_length; i++) buffer[i] = shortest[i];
+      *length = shortest_length;
+      return;
+    }
+  }
+
   // If the fast dtoa didn't succeed use the slower bignum version.
   BignumDtoaMode bignum_mode = DtoaToBignumDtoaMode(mode);
   BignumDtoa(v, bignum_mode, requested_digits, buffer, length, point);
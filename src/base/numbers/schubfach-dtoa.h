@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+#define V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// SchubfachDtoa will produce at most kSchubfachDtoaMaximalLength digits. This
+// does not include the terminating '\0' character.
+const int kSchubfachDtoaMaximalLength = 17;
+
+// Computes the shortest representation of v, using R. Giulietti's Schubfach
+// algorithm ("The Schubfach way to render doubles", 2020). Unlike FastDtoa it
+// never fails, so no bignum fallback is needed.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// There will be *length digits inside the buffer followed by a null
+// terminator. The result satisfies v == (double) (buffer * 10^(point-length)),
+// the digits in the buffer are the shortest representation possible and, of
+// those, the one closest to v. If there are two that are equally close, the one
+// with the even last digit is chosen. This matches the results of FastDtoa
+// (with the BignumDtoa fallback) in shortest mode.
+V8_BASE_EXPORT void SchubfachDtoa(double v, Vector<char> buffer, int* length,
+                                  int* point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
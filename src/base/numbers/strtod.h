@@ -14,6 +14,13 @@ namespace base {
 // contain a dot or a sign. It must not start with '0', and must not be empty.
 V8_BASE_EXPORT double Strtod(Vector<const char> buffer, int exponent);
 
+// Computes the double closest to significand * 10^exponent with the
+// Eisel-Lemire algorithm, which only needs one or two 64x64-bit
+// multiplications. Returns false in the rare cases where it cannot determine
+// the correctly rounded result; the caller then has to fall back to Strtod.
+V8_BASE_EXPORT bool EiselLemireStrtod(uint64_t significand, int exponent,
+                                      double* result);
+
 }  // namespace base
 }  // namespace v8
 
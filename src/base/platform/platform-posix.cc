@@ -635,6 +635,37 @@ bool OS::SealPages(void* address, size_t size) {
 #endif
 }
 
+// static
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+#else
+  return -1;
+#endif
+}
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int node) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(__NR_mbind)
+  // Values from <linux/mempolicy.h> which is not available everywhere.
+  constexpr int kMpolPreferred = 1;
+  constexpr unsigned kMpolMfMove = 1 << 1;
+  constexpr int kMaxNumaNodes = 64;
+  if (node < 0 || node >= kMaxNumaNodes) return false;
+  unsigned long node_mask = 1UL << node;
+  long ret = syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                     kMaxNumaNodes + 1, kMpolMfMove);
+  return ret == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
@@ -1275,6 +1306,27 @@ bool Thread::Start() {
 
 void Thread::Join() { pthread_join(data_->thread_, nullptr); }
 
+bool Thread::SetCpus(const std::vector<int>& cpus) {
+#if V8_OS_LINUX && !V8_OS_ANDROID
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  if (cpus.empty()) {
+    // The kernel intersects the mask with the CPUs the process may use.
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) CPU_SET(cpu, &set);
+  } else if (CPU_COUNT(&set) == 0) {
+    return false;
+  }
+  return pthread_setaffinity_np(data_->thread_, sizeof(set), &set) == 0;
+#else
+  // Darwin has no thread affinity; the QoS class set in ThreadEntry already
+  // decides between performance and efficiency cores there.
+  return false;
+#endif
+}
+
 static Thread::LocalStorageKey PthreadKeyToLocalKey(pthread_key_t pthread_key) {
 #if V8_OS_CYGWIN
   // We need to cast pthread_key_t to Thread::LocalStorageKey in two steps
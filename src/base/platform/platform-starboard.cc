@@ -375,6 +375,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   set_name(options.name());
 }
@@ -410,6 +411,8 @@ bool Thread::Start() {
 
 void Thread::Join() { SbThreadJoin(data_->thread_, nullptr); }
 
+bool Thread::SetCpus(const std::vector<int>& cpus) { return false; }
+
 Thread::LocalStorageKey Thread::CreateThreadLocalKey() {
   return SbThreadCreateLocalKey(nullptr);
 }
@@ -476,6 +479,14 @@ void OS::SignalCodeMovingGC() { SB_NOTIMPLEMENTED(); }
 
 void OS::AdjustSchedulingParams() {}
 
+// static
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
 std::optional<OS::MemoryRange> OS::GetFirstFreeMemoryRangeWithin(
     OS::Address boundary_start, OS::Address boundary_end, size_t minimum_size,
     size_t alignment) {
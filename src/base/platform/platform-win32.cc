@@ -1731,6 +1731,25 @@ static const HANDLE kNoThread = INVALID_HANDLE_VALUE;
 // convention.
 static unsigned int __stdcall ThreadEntry(void* arg) {
   Thread* thread = reinterpret_cast<Thread*>(arg);
+  switch (thread->priority()) {
+    case Thread::Priority::kBestEffort: {
+      SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+      // Opt into EcoQoS, which on hybrid CPUs prefers efficiency cores.
+      THREAD_POWER_THROTTLING_STATE state = {};
+      state.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+      state.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+      state.StateMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+      SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &state,
+                           sizeof(state));
+      break;
+    }
+    case Thread::Priority::kUserVisible:
+      SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+      break;
+    case Thread::Priority::kUserBlocking:
+    case Thread::Priority::kDefault:
+      break;
+  }
   thread->NotifyStartedAndRun();
   return 0;
 }
@@ -1748,7 +1767,9 @@ class Thread::PlatformData {
 // handle until it is started.
 
 Thread::Thread(const Options& options)
-    : stack_size_(options.stack_size()), start_semaphore_(nullptr) {
+    : stack_size_(options.stack_size()),
+      priority_(options.priority()),
+      start_semaphore_(nullptr) {
   data_ = new PlatformData(kNoThread);
   set_name(options.name());
 }
@@ -1784,6 +1805,24 @@ void Thread::Join() {
   }
 }
 
+bool Thread::SetCpus(const std::vector<int>& cpus) {
+  DWORD_PTR mask = 0;
+  if (cpus.empty()) {
+    DWORD_PTR system_mask;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &mask, &system_mask)) {
+      return false;
+    }
+  }
+  // Only CPUs of the thread's processor group can be addressed.
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < static_cast<int>(sizeof(mask) * 8)) {
+      mask |= static_cast<DWORD_PTR>(1) << cpu;
+    }
+  }
+  if (mask == 0) return false;
+  return SetThreadAffinityMask(data_->thread_, mask) != 0;
+}
+
 
 Thread::LocalStorageKey Thread::CreateThreadLocalKey() {
   DWORD result = TlsAlloc();
@@ -1812,6 +1851,14 @@ void Thread::SetThreadLocal(LocalStorageKey key, void* value) {
 
 void OS::AdjustSchedulingParams() {}
 
+// static
+int OS::GetCurrentNumaNode() { return -1; }
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
 std::optional<OS::MemoryRange> OS::GetFirstFreeMemoryRangeWithin(
     OS::Address boundary_start, OS::Address boundary_end, size_t minimum_size,
     size_t alignment) {
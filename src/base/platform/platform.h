@@ -358,6 +358,16 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Returns the NUMA node of the CPU the calling thread is running on, or -1 if
+  // the platform does not expose this information.
+  static int GetCurrentNumaNode();
+
+  // Sets the preferred NUMA node for the physical pages backing the given
+  // range. Already populated pages are migrated where possible. The range
+  // must be page-aligned. Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool BindMemoryToNumaNode(void* address,
+                                                         size_t size, int node);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -584,6 +594,11 @@ class V8_BASE_EXPORT Thread {
   // Wait until thread terminates.
   void Join();
 
+  // Restricts the started thread to run on the given CPUs. An empty |cpus|
+  // lifts the restriction again. Returns false if the OS does not support
+  // thread affinity or rejected the CPU set.
+  bool SetCpus(const std::vector<int>& cpus);
+
   inline const char* name() const {
     return name_;
   }
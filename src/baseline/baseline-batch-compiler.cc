@@ -5,15 +5,19 @@
 #include "src/baseline/baseline-batch-compiler.h"
 
 #include <algorithm>
+#include <limits>
 
+#include "include/v8-metrics.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
+#include "src/common/code-memory-access.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/counters.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -41,32 +45,58 @@ class BaselineCompilerTask {
   BaselineCompilerTask(BaselineCompilerTask&&) V8_NOEXCEPT = default;
 
   // Executed in the background thread.
-  void Compile(LocalIsolate* local_isolate) {
+  void Compile(LocalIsolate* local_isolate, Counters* counters,
+               base::TimeTicks enqueued_ticks) {
     RCS_SCOPE(local_isolate, RuntimeCallCounterId::kCompileBackgroundBaseline);
-    base::ScopedTimer timer(v8_flags.log_function_events ? &time_taken_
-                                                         : nullptr);
+    base::TimeTicks start_ticks = base::TimeTicks::Now();
+    queue_delay_ = start_ticks - enqueued_ticks;
+    base::ThreadTicks start_cpu_ticks;
+    if (base::ThreadTicks::IsSupported()) {
+      start_cpu_ticks = base::ThreadTicks::Now();
+    }
     BaselineCompiler compiler(local_isolate, shared_function_info_, bytecode_);
     compiler.GenerateCode();
     maybe_code_ =
         local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
+    if (!maybe_code_.is_null()) {
+      counters->sparkplug_compiled_functions()->Increment();
+    }
+    time_taken_ = base::TimeTicks::Now() - start_ticks;
+    if (!start_cpu_ticks.IsNull()) {
+      cpu_time_ = base::ThreadTicks::Now() - start_cpu_ticks;
+    }
   }
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
     shared_function_info_->set_is_sparkplug_compiling(false);
-    Handle<Code> code;
-    if (!maybe_code_.ToHandle(&code)) return;
-    if (v8_flags.print_code) {
-      Print(*code);
+    v8::metrics::CompileJob event;
+    event.tier = v8::metrics::CompileJob::Tier::kSparkplug;
+    event.concurrent = true;
+    event.bytecode_size_in_bytes = bytecode_->length();
+    event.queue_delay_in_us = queue_delay_.InMicroseconds();
+    event.wall_clock_duration_in_us = time_taken_.InMicroseconds();
+    if (base::ThreadTicks::IsSupported()) {
+      event.cpu_duration_in_us = cpu_time_.InMicroseconds();
     }
+    Handle<Code> code;
     // Don't install the code if the bytecode has been flushed or has
     // already some baseline code installed.
-    if (!CanCompileWithConcurrentBaseline(*shared_function_info_, isolate)) {
+    if (!maybe_code_.ToHandle(&code) ||
+        !CanCompileWithConcurrentBaseline(*shared_function_info_, isolate)) {
+      Compiler::RecordCompileJob(isolate, event);
       return;
     }
+    if (v8_flags.print_code) {
+      Print(*code);
+    }
+    event.success = true;
+    event.code_size_in_bytes = code->instruction_size();
+    Compiler::RecordCompileJob(isolate, event);
 
     shared_function_info_->set_baseline_code(*code, kReleaseStore);
     shared_function_info_->set_age(0);
+    isolate->counters()->sparkplug_installed_functions()->Increment();
     if (v8_flags.trace_baseline) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       std::stringstream ss;
@@ -90,7 +120,9 @@ class BaselineCompilerTask {
   Handle<SharedFunctionInfo> shared_function_info_;
   Handle<BytecodeArray> bytecode_;
   MaybeHandle<Code> maybe_code_;
+  base::TimeDelta queue_delay_;
   base::TimeDelta time_taken_;
+  base::TimeDelta cpu_time_;
 };
 
 class BaselineBatchCompilerJob {
@@ -114,6 +146,9 @@ class BaselineBatchCompilerJob {
       if (shared->is_sparkplug_compiling()) continue;
       tasks_.emplace_back(isolate, handles_.get(), shared);
     }
+    isolate->counters()->sparkplug_queued_functions()->Increment(
+        static_cast<int>(tasks_.size()));
+    enqueued_ticks_ = base::TimeTicks::Now();
     if (v8_flags.trace_baseline) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
       PrintF(scope.file(), "[Concurrent Sparkplug] compiling %zu functions\n",
@@ -122,26 +157,34 @@ class BaselineBatchCompilerJob {
   }
 
   // Executed in the background thread.
-  void Compile(LocalIsolate* local_isolate) {
+  void Compile(LocalIsolate* local_isolate, Counters* counters) {
     local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
     for (auto& task : tasks_) {
-      task.Compile(local_isolate);
+      task.Compile(local_isolate, counters, enqueued_ticks_);
     }
     // Get the handle back since we'd need them to install the code later.
     handles_ = local_isolate->heap()->DetachPersistentHandles();
   }
 
-  // Executed in the main thread.
-  void Install(Isolate* isolate) {
+  // Executed in the main thread. Installs at most {budget} functions and
+  // returns the number of functions that were processed.
+  size_t Install(Isolate* isolate, size_t budget) {
     HandleScope local_scope(isolate);
-    for (auto& task : tasks_) {
-      task.Install(isolate);
+    size_t count = std::min(budget, tasks_.size() - next_task_);
+    for (size_t i = 0; i < count; i++) {
+      tasks_[next_task_++].Install(isolate);
     }
+    return count;
   }
 
+  bool IsFullyInstalled() const { return next_task_ == tasks_.size(); }
+
  private:
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  base::TimeTicks enqueued_ticks_;
+  // The index of the next task to install on the main thread.
+  size_t next_task_ = 0;
 };
 
 class ConcurrentBaselineCompiler {
@@ -165,7 +208,7 @@ class ConcurrentBaselineCompiler {
         std::unique_ptr<BaselineBatchCompilerJob> job;
         if (!incoming_queue_->Dequeue(&job)) break;
         DCHECK_NOT_NULL(job);
-        job->Compile(&local_isolate);
+        job->Compile(&local_isolate, isolate_->counters());
         outgoing_queue_->Enqueue(std::move(job));
       }
       isolate_->stack_guard()->RequestInstallBaselineCode();
@@ -214,17 +257,33 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
+  // Installs the code of all finished batches, or as much of it as
+  // --concurrent-sparkplug-install-budget allows. The rest is installed on
+  // the next interrupt.
   void InstallBatch() {
-    while (!outgoing_queue_.IsEmpty()) {
-      std::unique_ptr<BaselineBatchCompilerJob> job;
-      outgoing_queue_.Dequeue(&job);
-      job->Install(isolate_);
+    size_t budget = v8_flags.concurrent_sparkplug_install_budget > 0
+                        ? v8_flags.concurrent_sparkplug_install_budget
+                        : std::numeric_limits<size_t>::max();
+    while (budget > 0) {
+      if (!partially_installed_job_) {
+        if (!outgoing_queue_.Dequeue(&partially_installed_job_)) break;
+      }
+      budget -= partially_installed_job_->Install(isolate_, budget);
+      if (partially_installed_job_->IsFullyInstalled()) {
+        partially_installed_job_.reset();
+      }
+    }
+    if (partially_installed_job_ || !outgoing_queue_.IsEmpty()) {
+      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
   }
 
  private:
   Isolate* isolate_;
   std::unique_ptr<JobHandle> job_handle_ = nullptr;
+  // A finished batch which ran out of install budget. Only accessed on the
+  // main thread.
+  std::unique_ptr<BaselineBatchCompilerJob> partially_installed_job_;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> incoming_queue_;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> outgoing_queue_;
 };
@@ -310,6 +369,10 @@ void BaselineBatchCompiler::EnsureQueueCapacity() {
 }
 
 void BaselineBatchCompiler::CompileBatch(DirectHandle<JSFunction> function) {
+  // Each compiled function allocates and initializes a code object. Batch the
+  // code writes of the whole batch.
+  RwxMemoryWriteBatchScope write_batch_scope(isolate_,
+                                             "Compiling a Sparkplug batch.");
   {
     IsCompiledScope is_compiled_scope(
         function->shared()->is_compiled_scope(isolate_));
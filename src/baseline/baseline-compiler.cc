@@ -890,6 +890,13 @@ void BaselineCompiler::VisitGetNamedProperty() {
                                         IndexAsTagged(2));   // slot
 }
 
+void BaselineCompiler::VisitStarGetNamedProperty() {
+  StoreRegister(0, kInterpreterAccumulatorRegister);
+  CallBuiltin<Builtin::kLoadICBaseline>(RegisterOperand(0),  // object
+                                        Constant<Name>(1),   // name
+                                        IndexAsTagged(2));   // slot
+}
+
 void BaselineCompiler::VisitGetNamedPropertyFromSuper() {
   __ LoadPrototype(
       LoadWithReceiverAndVectorDescriptor::LookupStartObjectRegister(),
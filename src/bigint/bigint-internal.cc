@@ -4,6 +4,11 @@
 
 #include "src/bigint/bigint-internal.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 namespace v8 {
 namespace bigint {
 
@@ -33,6 +38,119 @@ Processor* Processor::New(Platform* platform) {
 
 void Processor::Destroy() { delete static_cast<ProcessorImpl*>(this); }
 
+namespace {
+
+// Shared between the thread calling {RunInParallel} and its worker tasks.
+// Indices are handed out on demand, so workers that start after all indices
+// have been taken just return; the caller only waits for indices that some
+// thread is actively working on.
+class ParallelWorkState {
+ public:
+  ParallelWorkState(int count, const ProcessorImpl::ParallelWork* work,
+                    Platform* platform)
+      : count_(count), work_(work), platform_(platform) {}
+
+  void RunItems(ProcessorImpl* processor) {
+    int index;
+    while ((index = next_index_.fetch_add(1, std::memory_order_relaxed)) <
+           count_) {
+      if (!interrupted()) {
+        (*work_)(processor, index);
+        if (processor->should_terminate()) set_interrupted();
+      }
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (++done_ == count_) all_done_.notify_all();
+    }
+  }
+
+  // Returns when all indices are done. While waiting, the calling thread
+  // keeps checking for interrupt requests on behalf of the workers.
+  void WaitUntilDone(Platform* caller_platform) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (done_ < count_) {
+      if (all_done_.wait_for(lock, std::chrono::milliseconds(1)) ==
+              std::cv_status::timeout &&
+          caller_platform->InterruptRequested()) {
+        set_interrupted();
+      }
+    }
+  }
+
+  bool has_unclaimed_items() const {
+    return next_index_.load(std::memory_order_relaxed) < count_;
+  }
+  bool interrupted() const {
+    return interrupted_.load(std::memory_order_relaxed);
+  }
+  void set_interrupted() {
+    interrupted_.store(true, std::memory_order_relaxed);
+  }
+  Platform* platform() const { return platform_; }
+
+ private:
+  const int count_;
+  const ProcessorImpl::ParallelWork* work_;
+  // The platform of the processor that started the parallel operation, for
+  // posting tasks of nested parallel operations.
+  Platform* platform_;
+  std::atomic<int> next_index_{0};
+  std::atomic<bool> interrupted_{false};
+  std::mutex mutex_;
+  std::condition_variable all_done_;
+  int done_{0};
+};
+
+// The Platform of processors on worker threads. Interrupt requests are polled
+// by the thread that started the operation and forwarded through {state}.
+class WorkerPlatform : public Platform {
+ public:
+  explicit WorkerPlatform(std::shared_ptr<ParallelWorkState> state)
+      : state_(std::move(state)) {}
+
+  bool InterruptRequested() override { return state_->interrupted(); }
+  int NumberOfWorkerThreads() override {
+    return state_->platform()->NumberOfWorkerThreads();
+  }
+  void PostTask(std::unique_ptr<Task> task) override {
+    state_->platform()->PostTask(std::move(task));
+  }
+
+ private:
+  std::shared_ptr<ParallelWorkState> state_;
+};
+
+class ParallelWorkTask : public Platform::Task {
+ public:
+  explicit ParallelWorkTask(std::shared_ptr<ParallelWorkState> state)
+      : state_(std::move(state)) {}
+
+  void Run() override {
+    if (!state_->has_unclaimed_items()) return;
+    ProcessorImpl processor(new WorkerPlatform(state_));
+    state_->RunItems(&processor);
+  }
+
+ private:
+  std::shared_ptr<ParallelWorkState> state_;
+};
+
+}  // namespace
+
+void ProcessorImpl::RunInParallel(int count, const ParallelWork& work) {
+  int tasks = std::min(count, parallelism()) - 1;
+  if (tasks <= 0) {
+    for (int i = 0; i < count && !should_terminate(); i++) work(this, i);
+    return;
+  }
+  auto state = std::make_shared<ParallelWorkState>(count, &work, platform_);
+  for (int i = 0; i < tasks; i++) {
+    platform_->PostTask(std::make_unique<ParallelWorkTask>(state));
+  }
+  state->RunItems(this);
+  state->WaitUntilDone(platform_);
+  if (state->interrupted()) status_ = Status::kInterrupted;
+}
+
 void ProcessorImpl::Multiply(RWDigits Z, Digits X, Digits Y) {
   X.Normalize();
   Y.Normalize();
@@ -5,6 +5,7 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <functional>
 #include <memory>
 
 #include "src/bigint/bigint.h"
@@ -24,6 +25,12 @@ constexpr int kNewtonInversionThreshold = 50;
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
 
+// Operations on inputs of at least these lengths (in digits) split their work
+// across worker threads, if the Platform provides any.
+constexpr int kFftParallelThreshold = 12000;
+constexpr int kToomParallelThreshold = 12000;
+constexpr int kToStringParallelThreshold = 6000;
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -49,6 +56,8 @@ class ProcessorImpl : public Processor {
 
 #if V8_ADVANCED_BIGINT_ALGORITHMS
   void MultiplyToomCook(RWDigits Z, Digits X, Digits Y);
+  void MultiplyToomCookParallel(RWDigits Z, Digits X, Digits Y, int tasks);
+  void ToomCookChunks(RWDigits Z, Digits X, Digits Y);
   void Toom3Main(RWDigits Z, Digits X, Digits Y);
 
   void MultiplyFFT(RWDigits Z, Digits X, Digits Y);
@@ -75,6 +84,17 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  // The number of threads, including the current one, that can work on an
+  // operation at the same time.
+  int parallelism() { return platform_->NumberOfWorkerThreads() + 1; }
+
+  // Calls {work} for every index in [0, count), concurrently on the current
+  // thread and on worker threads, and returns when all calls have finished.
+  // Each call gets a ProcessorImpl to use for its computations; unless
+  // {should_terminate()}, all calls have completed.
+  using ParallelWork = std::function<void(ProcessorImpl* processor, int index)>;
+  void RunInParallel(int count, const ParallelWork& work);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace v8 {
@@ -201,6 +202,21 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  class Task {
+   public:
+    virtual ~Task() = default;
+    virtual void Run() = 0;
+  };
+
+  // If you want very large multiplications and conversions to strings to use
+  // multiple threads, implement a Platform subclass that overrides these
+  // methods. {PostTask} may be called from any thread, and should run {task}
+  // on a worker thread soon. The thread that started an operation always
+  // takes part in the work itself, so tasks that start late only reduce the
+  // speedup. {InterruptRequested} is only ever called on that thread.
+  virtual int NumberOfWorkerThreads() { return 0; }
+  virtual void PostTask(std::unique_ptr<Task> task) {}
 };
 
 // These are the operations that this library supports.
@@ -7,15 +7,99 @@
 #include "src/bigint/util.h"
 #include "src/bigint/vector-arithmetic.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define V8_BIGINT_BITWISE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define V8_BIGINT_BITWISE_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace bigint {
 
+namespace {
+
+// Binary digit operations, each with a scalar and a 128-bit vector form.
+// AndNot computes {a & ~b}.
+struct AndOp {
+  static digit_t Apply(digit_t a, digit_t b) { return a & b; }
+#if V8_BIGINT_BITWISE_SSE2
+  static __m128i Apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+#elif V8_BIGINT_BITWISE_NEON
+  static uint8x16_t Apply(uint8x16_t a, uint8x16_t b) {
+    return vandq_u8(a, b);
+  }
+#endif
+};
+
+struct OrOp {
+  static digit_t Apply(digit_t a, digit_t b) { return a | b; }
+#if V8_BIGINT_BITWISE_SSE2
+  static __m128i Apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+#elif V8_BIGINT_BITWISE_NEON
+  static uint8x16_t Apply(uint8x16_t a, uint8x16_t b) {
+    return vorrq_u8(a, b);
+  }
+#endif
+};
+
+struct XorOp {
+  static digit_t Apply(digit_t a, digit_t b) { return a ^ b; }
+#if V8_BIGINT_BITWISE_SSE2
+  static __m128i Apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+#elif V8_BIGINT_BITWISE_NEON
+  static uint8x16_t Apply(uint8x16_t a, uint8x16_t b) {
+    return veorq_u8(a, b);
+  }
+#endif
+};
+
+struct AndNotOp {
+  static digit_t Apply(digit_t a, digit_t b) { return a & ~b; }
+#if V8_BIGINT_BITWISE_SSE2
+  static __m128i Apply(__m128i a, __m128i b) { return _mm_andnot_si128(b, a); }
+#elif V8_BIGINT_BITWISE_NEON
+  static uint8x16_t Apply(uint8x16_t a, uint8x16_t b) {
+    return vbicq_u8(a, b);
+  }
+#endif
+};
+
+// Z[i] = Op(X[i], Y[i]) for i in [start, end). Digits arrays are only
+// guaranteed to be 4-byte aligned, so all vector accesses are unaligned.
+// Z may alias X or Y, as each vector is loaded before it is stored.
+template <class Op>
+void BitwiseLoop(RWDigits Z, Digits X, Digits Y, int start, int end) {
+  int i = start;
+#if V8_BIGINT_BITWISE_SSE2 || V8_BIGINT_BITWISE_NEON
+  constexpr int kStep = 16 / sizeof(digit_t);
+  const char* x = reinterpret_cast<const char*>(X.digits());
+  const char* y = reinterpret_cast<const char*>(Y.digits());
+  char* z = reinterpret_cast<char*>(Z.digits());
+  for (; i + kStep <= end; i += kStep) {
+    const size_t offset = i * sizeof(digit_t);
+#if V8_BIGINT_BITWISE_SSE2
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + offset));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + offset));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(z + offset), Op::Apply(a, b));
+#else
+    uint8x16_t a = vld1q_u8(reinterpret_cast<const uint8_t*>(x + offset));
+    uint8x16_t b = vld1q_u8(reinterpret_cast<const uint8_t*>(y + offset));
+    vst1q_u8(reinterpret_cast<uint8_t*>(z + offset), Op::Apply(a, b));
+#endif
+  }
+#endif
+  for (; i < end; i++) Z[i] = Op::Apply(X[i], Y[i]);
+}
+
+}  // namespace
+
 void BitwiseAnd_PosPos(RWDigits Z, Digits X, Digits Y) {
   int pairs = std::min(X.len(), Y.len());
   DCHECK(Z.len() >= pairs);
-  int i = 0;
-  for (; i < pairs; i++) Z[i] = X[i] & Y[i];
-  for (; i < Z.len(); i++) Z[i] = 0;
+  BitwiseLoop<AndOp>(Z, X, Y, 0, pairs);
+  for (int i = pairs; i < Z.len(); i++) Z[i] = 0;
 }
 
 void BitwiseAnd_NegNeg(RWDigits Z, Digits X, Digits Y) {
@@ -26,10 +110,13 @@ void BitwiseAnd_NegNeg(RWDigits Z, Digits X, Digits Y) {
   digit_t x_borrow = 1;
   digit_t y_borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) {
+  for (; i < pairs && (x_borrow | y_borrow) != 0; i++) {
     Z[i] = digit_sub(X[i], x_borrow, &x_borrow) |
            digit_sub(Y[i], y_borrow, &y_borrow);
   }
+  // Once both borrows are used up, the "-1"s are no-ops.
+  BitwiseLoop<OrOp>(Z, X, Y, i, pairs);
+  i = pairs;
   // (At least) one of the next two loops will perform zero iterations:
   for (; i < X.len(); i++) Z[i] = digit_sub(X[i], x_borrow, &x_borrow);
   for (; i < Y.len(); i++) Z[i] = digit_sub(Y[i], y_borrow, &y_borrow);
@@ -44,15 +131,19 @@ void BitwiseAnd_PosNeg(RWDigits Z, Digits X, Digits Y) {
   int pairs = std::min(X.len(), Y.len());
   digit_t borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) Z[i] = X[i] & ~digit_sub(Y[i], borrow, &borrow);
+  for (; i < pairs && borrow != 0; i++) {
+    Z[i] = X[i] & ~digit_sub(Y[i], borrow, &borrow);
+  }
+  BitwiseLoop<AndNotOp>(Z, X, Y, i, pairs);
+  i = pairs;
   for (; i < X.len(); i++) Z[i] = X[i];
   for (; i < Z.len(); i++) Z[i] = 0;
 }
 
 void BitwiseOr_PosPos(RWDigits Z, Digits X, Digits Y) {
   int pairs = std::min(X.len(), Y.len());
-  int i = 0;
-  for (; i < pairs; i++) Z[i] = X[i] | Y[i];
+  BitwiseLoop<OrOp>(Z, X, Y, 0, pairs);
+  int i = pairs;
   // (At least) one of the next two loops will perform zero iterations:
   for (; i < X.len(); i++) Z[i] = X[i];
   for (; i < Y.len(); i++) Z[i] = Y[i];
@@ -67,10 +158,13 @@ void BitwiseOr_NegNeg(RWDigits Z, Digits X, Digits Y) {
   digit_t x_borrow = 1;
   digit_t y_borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) {
+  for (; i < pairs && (x_borrow | y_borrow) != 0; i++) {
     Z[i] = digit_sub(X[i], x_borrow, &x_borrow) &
            digit_sub(Y[i], y_borrow, &y_borrow);
   }
+  // Once both borrows are used up, the "-1"s are no-ops.
+  BitwiseLoop<AndOp>(Z, X, Y, i, pairs);
+  i = pairs;
   // Any leftover borrows don't matter, the '&' would drop them anyway.
   for (; i < Z.len(); i++) Z[i] = 0;
   Add(Z, 1);
@@ -81,7 +175,11 @@ void BitwiseOr_PosNeg(RWDigits Z, Digits X, Digits Y) {
   int pairs = std::min(X.len(), Y.len());
   digit_t borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) Z[i] = digit_sub(Y[i], borrow, &borrow) & ~X[i];
+  for (; i < pairs && borrow != 0; i++) {
+    Z[i] = digit_sub(Y[i], borrow, &borrow) & ~X[i];
+  }
+  BitwiseLoop<AndNotOp>(Z, Y, X, i, pairs);
+  i = pairs;
   for (; i < Y.len(); i++) Z[i] = digit_sub(Y[i], borrow, &borrow);
   DCHECK(borrow == 0);
   for (; i < Z.len(); i++) Z[i] = 0;
@@ -95,8 +193,8 @@ void BitwiseXor_PosPos(RWDigits Z, Digits X, Digits Y) {
     pairs = X.len();
   }
   DCHECK(X.len() <= Y.len());
-  int i = 0;
-  for (; i < pairs; i++) Z[i] = X[i] ^ Y[i];
+  BitwiseLoop<XorOp>(Z, X, Y, 0, pairs);
+  int i = pairs;
   for (; i < Y.len(); i++) Z[i] = Y[i];
   for (; i < Z.len(); i++) Z[i] = 0;
 }
@@ -107,10 +205,13 @@ void BitwiseXor_NegNeg(RWDigits Z, Digits X, Digits Y) {
   digit_t x_borrow = 1;
   digit_t y_borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) {
+  for (; i < pairs && (x_borrow | y_borrow) != 0; i++) {
     Z[i] = digit_sub(X[i], x_borrow, &x_borrow) ^
            digit_sub(Y[i], y_borrow, &y_borrow);
   }
+  // Once both borrows are used up, the "-1"s are no-ops.
+  BitwiseLoop<XorOp>(Z, X, Y, i, pairs);
+  i = pairs;
   // (At least) one of the next two loops will perform zero iterations:
   for (; i < X.len(); i++) Z[i] = digit_sub(X[i], x_borrow, &x_borrow);
   for (; i < Y.len(); i++) Z[i] = digit_sub(Y[i], y_borrow, &y_borrow);
@@ -124,7 +225,11 @@ void BitwiseXor_PosNeg(RWDigits Z, Digits X, Digits Y) {
   int pairs = std::min(X.len(), Y.len());
   digit_t borrow = 1;
   int i = 0;
-  for (; i < pairs; i++) Z[i] = X[i] ^ digit_sub(Y[i], borrow, &borrow);
+  for (; i < pairs && borrow != 0; i++) {
+    Z[i] = X[i] ^ digit_sub(Y[i], borrow, &borrow);
+  }
+  BitwiseLoop<XorOp>(Z, X, Y, i, pairs);
+  i = pairs;
   // (At least) one of the next two loops will perform zero iterations:
   for (; i < X.len(); i++) Z[i] = X[i];
   for (; i < Y.len(); i++) Z[i] = digit_sub(Y[i], borrow, &borrow);
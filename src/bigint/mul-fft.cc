@@ -428,8 +428,10 @@ class FFTContainer {
  public:
   // {n} is the number of chunks, whose length is {K}+1.
   // {K} determines F_n = 2^(K * kDigitBits) + 1.
-  FFTContainer(int n, int K, ProcessorImpl* processor)
-      : n_(n), K_(K), length_(K + 1), processor_(processor) {
+  // With {tasks} > 1, the transformations and pointwise multiplications
+  // are split into that many parts, which run in parallel.
+  FFTContainer(int n, int K, ProcessorImpl* processor, int tasks = 1)
+      : n_(n), K_(K), length_(K + 1), tasks_(tasks), processor_(processor) {
     storage_ = new digit_t[length_ * n_];
     part_ = new digit_t*[n_];
     digit_t* ptr = storage_;
@@ -457,13 +459,19 @@ class FFTContainer {
   void FFT_ReturnShuffledThreadsafe(int start, int len, int omega,
                                     digit_t* temp);
   void FFT_Recurse(int start, int half, int omega, digit_t* temp);
+  void FFT_Parallel(int blocks, int len, int omega);
 
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
+  void BackwardFFT_Parallel(int omega);
+
+  void ForwardButterfly(int start, int len, int omega, int k, digit_t* temp);
+  void BackwardButterfly(int start, int len, int omega, int k, digit_t* temp);
+  void ButterflyLevel_Parallel(int blocks, int len, int omega, bool forward);
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -471,6 +479,7 @@ class FFTContainer {
   const int n_;       // Number of parts.
   const int K_;       // Always length_ - 1.
   const int length_;  // Length of each part, in digits.
+  const int tasks_;   // Number of parallel tasks to split work into.
   ProcessorImpl* processor_;
   digit_t* storage_;  // Combined storage of all parts.
   digit_t** part_;    // Pointers to each part.
@@ -520,6 +529,7 @@ void FFTContainer::Start_Default(Digits X, int chunk_size, int theta,
   for (; i < n_; i++) {
     memset(part_[i], 0, part_length_in_bytes);
   }
+  if (tasks_ > 1) return FFT_Parallel(1, n_, omega);
   FFT_ReturnShuffledThreadsafe(0, n_, omega, temp_);
 }
 
@@ -552,6 +562,7 @@ void FFTContainer::Start(Digits X, int chunk_size, int theta, int omega) {
     memset(part_[i], 0, part_length_in_bytes);
     memset(part_[i + nhalf], 0, part_length_in_bytes);
   }
+  if (tasks_ > 1) return FFT_Parallel(2, nhalf, 2 * omega);
   FFT_Recurse(0, nhalf, omega, temp_);
 }
 
@@ -563,17 +574,28 @@ void FFTContainer::FFT_ReturnShuffledThreadsafe(int start, int len, int omega,
                                                 digit_t* temp) {
   DCHECK((len & 1) == 0);  // {len} must be even.
   int half = len / 2;
-  SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
-          length_);
-  for (int k = 1; k < half; k++) {
-    SumDiff(part_[start + k], temp, part_[start + k], part_[start + half + k],
-            length_);
-    int w = omega * k;
-    ShiftModFn(part_[start + half + k], temp, w, K_);
+  for (int k = 0; k < half; k++) {
+    ForwardButterfly(start, len, omega, k, temp);
   }
   FFT_Recurse(start, half, omega, temp);
 }
 
+// One butterfly operation of the forward transformation, combining parts
+// {start + k} and {start + len/2 + k}.
+void FFTContainer::ForwardButterfly(int start, int len, int omega, int k,
+                                    digit_t* temp) {
+  int half = len / 2;
+  if (k == 0) {
+    SumDiff(part_[start], part_[start + half], part_[start],
+            part_[start + half], length_);
+    return;
+  }
+  SumDiff(part_[start + k], temp, part_[start + k], part_[start + half + k],
+          length_);
+  int w = omega * k;
+  ShiftModFn(part_[start + half + k], temp, w, K_);
+}
+
 // Recursive step of the above, factored out for additional callers.
 void FFTContainer::FFT_Recurse(int start, int half, int omega, digit_t* temp) {
   if (half > 1) {
@@ -599,13 +621,91 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
     BackwardFFT_Threadsafe(start, half, 2 * omega, temp);
     BackwardFFT_Threadsafe(start + half, half, 2 * omega, temp);
   }
-  SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
+  for (int k = 0; k < half; k++) {
+    BackwardButterfly(start, len, omega, k, temp);
+  }
+}
+
+// One butterfly operation of the backward transformation, combining parts
+// {start + k} and {start + len/2 + k}.
+void FFTContainer::BackwardButterfly(int start, int len, int omega, int k,
+                                     digit_t* temp) {
+  int half = len / 2;
+  if (k == 0) {
+    SumDiff(part_[start], part_[start + half], part_[start],
+            part_[start + half], length_);
+    return;
+  }
+  int w = omega * (len - k);
+  ShiftModFn(temp, part_[start + half + k], w, K_);
+  SumDiff(part_[start + k], part_[start + half + k], part_[start + k], temp,
           length_);
-  for (int k = 1; k < half; k++) {
-    int w = omega * (len - k);
-    ShiftModFn(temp, part_[start + half + k], w, K_);
-    SumDiff(part_[start + k], part_[start + half + k], part_[start + k], temp,
-            length_);
+}
+
+// Performs one level of butterflies on each of {blocks} consecutive blocks of
+// {len} parts, distributing the butterflies over {tasks_} parallel tasks.
+void FFTContainer::ButterflyLevel_Parallel(int blocks, int len, int omega,
+                                           bool forward) {
+  const int half = len / 2;
+  const int total = blocks * half;
+  const int items = std::min(tasks_, total);
+  processor_->RunInParallel(items, [=, this](ProcessorImpl*, int item) {
+    ScratchDigits temp(length_);
+    int begin = static_cast<int>(int64_t{total} * item / items);
+    int end = static_cast<int>(int64_t{total} * (item + 1) / items);
+    for (int i = begin; i < end; i++) {
+      int start = (i / half) * len;
+      int k = i % half;
+      if (forward) {
+        ForwardButterfly(start, len, omega, k, temp.digits());
+      } else {
+        BackwardButterfly(start, len, omega, k, temp.digits());
+      }
+    }
+  });
+}
+
+// Parallel version of the forward transformation of {blocks} consecutive and
+// independent blocks of {len} parts. As long as there are fewer blocks than
+// tasks, the butterflies of each level are distributed over the tasks; after
+// that, the blocks are transformed by one task each.
+void FFTContainer::FFT_Parallel(int blocks, int len, int omega) {
+  while (blocks < tasks_ && len >= 4) {
+    ButterflyLevel_Parallel(blocks, len, omega, true);
+    if (processor_->should_terminate()) return;
+    blocks *= 2;
+    len /= 2;
+    omega *= 2;
+  }
+  if (len < 2) return;
+  processor_->RunInParallel(blocks, [=, this](ProcessorImpl*, int block) {
+    ScratchDigits temp(length_);
+    FFT_ReturnShuffledThreadsafe(block * len, len, omega, temp.digits());
+  });
+}
+
+// Parallel version of {BackwardFFT} for the whole container: the blocks of
+// the lower levels are transformed by one task each, the butterflies of the
+// top levels are distributed over the tasks.
+void FFTContainer::BackwardFFT_Parallel(int omega) {
+  int blocks = 1;
+  int len = n_;
+  // Blocks must have at least 4 parts, see {BackwardFFT_Threadsafe}.
+  while (blocks < tasks_ && len >= 8) {
+    blocks *= 2;
+    len /= 2;
+    omega *= 2;
+  }
+  if (blocks == 1) return BackwardFFT(0, n_, omega);
+  processor_->RunInParallel(blocks, [=, this](ProcessorImpl*, int block) {
+    ScratchDigits temp(length_);
+    BackwardFFT_Threadsafe(block * len, len, omega, temp.digits());
+  });
+  while (blocks > 1 && !processor_->should_terminate()) {
+    blocks /= 2;
+    len *= 2;
+    omega /= 2;
+    ButterflyLevel_Parallel(blocks, len, omega, false);
   }
 }
 
@@ -721,8 +821,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +833,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -750,7 +850,20 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  if (tasks_ == 1) {
+    return DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+  }
+  // Each task gets a range of pairs of parts, because the first level of the
+  // backwards FFT combines the two parts of each pair.
+  const int pairs = n_ / 2;
+  const int items = std::min(tasks_, pairs);
+  processor_->RunInParallel(
+      items, [&other, pairs, items, this](ProcessorImpl* processor, int item) {
+        ScratchDigits temp(2 * length_);
+        int start = 2 * (pairs * item / items);
+        int end = 2 * (pairs * (item + 1) / items);
+        DoPointwiseMultiplication(other, start, end, temp.digits(), processor);
+      });
 }
 
 }  // namespace
@@ -768,20 +881,27 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   Parameters params;
   int m = GetParameters(X.len() + Y.len(), &params);
   int omega = params.r;  // really: 2^r
+  int tasks =
+      X.len() + Y.len() >= kFftParallelThreshold ? parallelism() : 1;
 
-  FFTContainer a(params.n, params.K, this);
+  FFTContainer a(params.n, params.K, this, tasks);
   a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
     a.PointwiseMultiply(a);
   } else {
-    FFTContainer b(params.n, params.K, this);
+    FFTContainer b(params.n, params.K, this, tasks);
     b.Start(Y, params.s, 0, omega);
     a.PointwiseMultiply(b);
   }
   if (should_terminate()) return;
 
-  a.BackwardFFT(0, params.n, omega);
+  if (tasks > 1) {
+    a.BackwardFFT_Parallel(omega);
+    if (should_terminate()) return;
+  } else {
+    a.BackwardFFT(0, params.n, omega);
+  }
   a.NormalizeAndRecombine(omega, m, Z, params.s);
 }
 
@@ -201,6 +201,17 @@ void ProcessorImpl::Toom3Main(RWDigits Z, Digits X, Digits Y) {
 }
 
 void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
+  DCHECK(X.len() >= Y.len());
+  int tasks = X.len() >= kToomParallelThreshold ? parallelism() : 1;
+  int full_chunks = X.len() / Y.len();
+  if (tasks > 1 && full_chunks > 1) {
+    return MultiplyToomCookParallel(Z, X, Y, std::min(tasks, full_chunks));
+  }
+  ToomCookChunks(Z, X, Y);
+}
+
+// Multiplies {Y} with consecutive {Y.len()}-sized chunks of {X}.
+void ProcessorImpl::ToomCookChunks(RWDigits Z, Digits X, Digits Y) {
   DCHECK(X.len() >= Y.len());
   int k = Y.len();
   // TODO(jkummerow): Would it be a measurable improvement to share the
@@ -219,5 +230,28 @@ void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
   }
 }
 
+// Splits {X} into {tasks} slices of whole chunks, multiplies them with {Y} in
+// parallel, and adds up the partial products.
+void ProcessorImpl::MultiplyToomCookParallel(RWDigits Z, Digits X, Digits Y,
+                                             int tasks) {
+  const int k = Y.len();
+  const int chunks = X.len() / k;
+  auto slice_start = [=](int task) { return chunks * task / tasks * k; };
+  std::vector<std::unique_ptr<ScratchDigits>> products(tasks);
+  RunInParallel(tasks, [&](ProcessorImpl* processor, int task) {
+    int start = slice_start(task);
+    int end = task == tasks - 1 ? X.len() : slice_start(task + 1);
+    Digits X_slice(X, start, end - start);
+    products[task] = std::make_unique<ScratchDigits>(X_slice.len() + k);
+    processor->ToomCookChunks(*products[task], X_slice, Y);
+  });
+  if (should_terminate()) return;
+  Z.Clear();
+  for (int task = 0; task < tasks; task++) {
+    // Can't overflow, the sum of all products is X * Y.
+    AddAndReturnOverflow(Z + slice_start(task), *products[task]);
+  }
+}
+
 }  // namespace bigint
 }  // namespace v8
@@ -530,14 +530,32 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 #endif
 
   // Step 5: Recurse.
+  if (chunk.len() >= kToStringParallelThreshold &&
+      processor_->parallelism() > 1) {
+    // The halves write to disjoint parts of the output, so they can be
+    // processed in parallel, each with a processor of its own.
+    char* end_of_left_part = out;
+    processor_->RunInParallel(2, [&](ProcessorImpl* processor, int half) {
+      ToStringFormatter formatter(*this);
+      formatter.processor_ = processor;
+      if (half == 0) {
+        USE(formatter.ProcessLevel(level->next_, right, out, false));
+      } else {
+        end_of_left_part =
+            formatter.ProcessLevel(level->next_, left,
+                                   out - level->char_count_, is_last_on_level);
+      }
+    });
+    return end_of_left_part;
+  }
   char* end_of_right_part = ProcessLevel(level->next_, right, out, false);
   if (processor_->should_terminate()) return out;
   // The recursive calls are required and hence designed to write exactly as
   // many characters as their level is responsible for.
   DCHECK(end_of_right_part == out - level->char_count_);
   USE(end_of_right_part);
-  // We intentionally don't use {end_of_right_part} here to be prepared for
-  // potential future multi-threaded execution.
+  // We intentionally don't use {end_of_right_part} here, so that the two
+  // halves can also be processed in parallel (see above).
   return ProcessLevel(level->next_, left, out - level->char_count_,
                       is_last_on_level);
 }
@@ -496,6 +496,27 @@ TF_BUILTIN(ExtractFastJSArray, ArrayBuiltinsAssembler) {
   Return(ExtractFastJSArray(context, array, begin, count));
 }
 
+void ArrayBuiltinsAssembler::MakeElementsCopyOnWriteForClone(
+    TNode<JSArray> array, HoleConversionMode convert_holes) {
+  Label done(this);
+  TNode<Int32T> elements_kind = LoadElementsKind(array);
+  if (convert_holes == HoleConversionMode::kConvertToUndefined) {
+    GotoIfNot(IsFastPackedElementsKind(elements_kind), &done);
+  }
+  // Double elements have no copy-on-write map.
+  GotoIfNot(IsFastSmiOrTaggedElementsKind(elements_kind), &done);
+  // Copying short arrays is cheap, and sharing their elements would only make
+  // the next write to {array} copy them anyway.
+  GotoIf(SmiLessThan(LoadFastJSArrayLength(array),
+                     SmiConstant(JSArray::kMinCopyOnWriteCloneLength)),
+         &done);
+  TNode<FixedArrayBase> elements = LoadElements(array);
+  GotoIfNot(IsFixedArrayMap(LoadMap(elements)), &done);
+  MakeFixedArrayCOW(CAST(elements));
+  Goto(&done);
+  BIND(&done);
+}
+
 TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
   auto context = Parameter<Context>(Descriptor::kContext);
   auto array = Parameter<JSArray>(Descriptor::kSource);
@@ -505,6 +526,7 @@ TF_BUILTIN(CloneFastJSArray, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  MakeElementsCopyOnWriteForClone(array, HoleConversionMode::kDontConvert);
   Return(CloneFastJSArray(context, array));
 }
 
@@ -524,6 +546,8 @@ TF_BUILTIN(CloneFastJSArrayFillingHoles, ArrayBuiltinsAssembler) {
                           LoadElementsKind(array))),
                       Word32BinaryNot(IsNoElementsProtectorCellInvalid())));
 
+  MakeElementsCopyOnWriteForClone(array,
+                                  HoleConversionMode::kConvertToUndefined);
   Return(CloneFastJSArray(context, array, std::nullopt,
                           HoleConversionMode::kConvertToUndefined));
 }
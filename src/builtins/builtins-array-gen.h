@@ -104,6 +104,13 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
       TNode<Object> new_target, TNode<Int32T> argc,
       TNode<HeapObject> maybe_allocation_site);
 
+  // Makes the elements of the fast smi or object {array} copy-on-write, so
+  // that CloneFastJSArray shares them with the clone instead of copying them.
+  // Writes to either array copy the elements first. Holey arrays are left
+  // alone if holes are converted, since the clone needs its own elements then.
+  void MakeElementsCopyOnWriteForClone(TNode<JSArray> array,
+                                       HoleConversionMode convert_holes);
+
  private:
   void VisitAllTypedArrayElements(TNode<JSArrayBuffer> array_buffer,
                                   const CallResultProcessor& processor,
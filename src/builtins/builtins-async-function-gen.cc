@@ -126,6 +126,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   Return(async_function_object);
 }
@@ -204,9 +210,47 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait() {
 
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise,
-        RootIndex::kAsyncFunctionAwaitResolveClosureSharedFun,
-        RootIndex::kAsyncFunctionAwaitRejectClosureSharedFun);
+
+  // The await closures only capture the {async_function_object}, so they are
+  // allocated once and reused by every await of this async function.
+  auto GetClosures = [&](TNode<NativeContext> native_context) {
+    TVARIABLE(JSFunction, var_on_resolve);
+    TVARIABLE(JSFunction, var_on_reject);
+    Label if_allocate(this, Label::kDeferred), done(this);
+    TNode<Object> cached_on_resolve =
+        LoadObjectField(async_function_object,
+                        JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+    GotoIf(IsUndefined(cached_on_resolve), &if_allocate);
+    var_on_resolve = CAST(cached_on_resolve);
+    var_on_reject = LoadObjectField<JSFunction>(
+        async_function_object,
+        JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+    Goto(&done);
+
+    BIND(&if_allocate);
+    {
+      TNode<Context> closure_context =
+          AllocateAwaitContext(native_context, async_function_object);
+      var_on_resolve = AllocateRootFunctionWithContext(
+          RootIndex::kAsyncFunctionAwaitResolveClosureSharedFun,
+          closure_context, native_context);
+      var_on_reject = AllocateRootFunctionWithContext(
+          RootIndex::kAsyncFunctionAwaitRejectClosureSharedFun,
+          closure_context, native_context);
+      StoreObjectField(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       var_on_resolve.value());
+      StoreObjectField(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       var_on_reject.value());
+      Goto(&done);
+    }
+
+    BIND(&done);
+    return std::make_pair(var_on_resolve.value(), var_on_reject.value());
+  };
+  AwaitWithClosures(context, async_function_object, value, outer_promise,
+                    GetClosures);
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
@@ -45,7 +45,70 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<Context> context, TNode<JSGeneratorObject> generator,
     TNode<Object> value, TNode<JSPromise> outer_promise,
     const CreateClosures& CreateClosures) {
+  return AwaitWithClosures(
+      context, generator, value, outer_promise,
+      [&](TNode<NativeContext> native_context) {
+        TNode<Context> closure_context =
+            AllocateAwaitContext(native_context, generator);
+        return CreateClosures(closure_context, native_context);
+      });
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitContext(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator) {
+  static const int kClosureContextSize =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  TNode<Context> closure_context =
+      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(closure_context, Context::SCOPE_INFO_INDEX,
+                                    empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+  return closure_context;
+}
+
+TNode<Object> AsyncBuiltinsAssembler::AwaitWithClosures(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<JSPromise> outer_promise,
+    const GetClosures& get_closures) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
+  const TNode<Uint32T> promise_hook_flags = PromiseHookFlags();
+
+  // A {value} that is not a JSReceiver cannot be a thenable, so the
+  // `PromiseResolve(%Promise%,value)` below would only create a promise that
+  // is already fulfilled with {value}, and the PerformPromiseThen on it would
+  // immediately enqueue the resolve closure. Unless promise hooks or the
+  // debugger need to see that promise, skip it and enqueue the reaction job
+  // directly.
+  TVARIABLE(Object, var_result);
+  Label if_receiver_or_instrumentation(this), if_primitive(this),
+      if_result(this);
+  GotoIf(NeedsAnyPromiseHooks(promise_hook_flags),
+         &if_receiver_or_instrumentation);
+  GotoIf(TaggedIsSmi(value), &if_primitive);
+  Branch(IsJSReceiver(CAST(value)), &if_receiver_or_instrumentation,
+         &if_primitive);
+
+  BIND(&if_primitive);
+  {
+    TNode<JSFunction> on_resolve = get_closures(native_context).first;
+    EnqueueFulfilledPromiseReactionJob(native_context, value, on_resolve);
+    var_result = UndefinedConstant();
+    Goto(&if_result);
+  }
+
+  BIND(&if_receiver_or_instrumentation);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
@@ -99,31 +162,8 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     value = var_value.value();
   }
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
-
-  // Allocate and initialize resolve and reject handlers
-  auto [on_resolve, on_reject] =
-      CreateClosures(closure_context, native_context);
+  // Get the resolve and reject handlers.
+  auto [on_resolve, on_reject] = get_closures(native_context);
 
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
@@ -131,16 +171,15 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
-             promiseHookFlags),
+             promise_hook_flags),
          &if_instrumentation);
 #ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
   // This call to NewJSPromise is to keep behaviour parity with what happens
   // in Runtime::kDebugAsyncFunctionSuspended below if native hooks are set.
   // It creates a throwaway promise that will trigger an init event and get
   // passed into Builtin::kPerformPromiseThen below.
-  GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
+  GotoIfNot(IsContextPromiseHookEnabled(promise_hook_flags),
             &if_instrumentation_done);
   var_throwaway = NewJSPromise(context, value);
 #endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
@@ -154,8 +193,12 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                           on_resolve, on_reject, var_throwaway.value());
+  Goto(&if_result);
+
+  BIND(&if_result);
+  return var_result.value();
 }
 
 TNode<JSFunction> AsyncBuiltinsAssembler::CreateUnwrapClosure(
@@ -33,6 +33,23 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                       TNode<JSPromise> outer_promise, RootIndex on_resolve_sfi,
                       RootIndex on_reject_sfi);
 
+  // Like Await, but `get_closures` provides the resolve and reject closures
+  // without being handed a fresh await context, so that callers can reuse
+  // closures across awaits.
+  using GetClosures =
+      std::function<std::pair<TNode<JSFunction>, TNode<JSFunction>>(
+          TNode<NativeContext>)>;
+  TNode<Object> AwaitWithClosures(TNode<Context> context,
+                                  TNode<JSGeneratorObject> generator,
+                                  TNode<Object> value,
+                                  TNode<JSPromise> outer_promise,
+                                  const GetClosures& get_closures);
+
+  // Allocate the context of the await closures, which holds the {generator}
+  // as its extension.
+  TNode<Context> AllocateAwaitContext(TNode<NativeContext> native_context,
+                                      TNode<JSGeneratorObject> generator);
+
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
   TNode<JSFunction> CreateUnwrapClosure(TNode<NativeContext> native_context,
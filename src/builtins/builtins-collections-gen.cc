@@ -1194,7 +1194,7 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same, if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1260,13 +1260,23 @@ TNode<Uint32T> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<Uint32T> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
   GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
+  // Strings with different hashes are not equal. This skips the comparison of
+  // the characters for the other keys in the bucket chain.
+  Label compare_strings(this);
+  const TNode<Uint32T> candidate_hash =
+      LoadNameHash(CAST(candidate_key), &compare_strings);
+  GotoIf(Word32NotEqual(key_hash, candidate_hash), if_not_same);
+  Goto(&compare_strings);
+
+  BIND(&compare_strings);
   BranchIfStringEqual(key_string, CAST(candidate_key), if_same, if_not_same);
 }
 
@@ -195,6 +195,11 @@ class WriteBarrierCodeStubAssembler : public CodeStubAssembler {
         Load(MachineType::Pointer(), slot_set,
              WordShl(bucket_index, kSystemPointerSizeLog2)));
     GotoIf(WordEqual(bucket, IntPtrConstant(0)), slow_path);
+    // Sparse buckets are updated in the runtime.
+    GotoIf(WordNotEqual(
+               WordAnd(bucket, IntPtrConstant(SlotSet::kSparseBucketTag)),
+               IntPtrConstant(0)),
+           slow_path);
     return bucket;
   }
 
@@ -822,6 +827,11 @@ class DeletePropertyBaseAssembler : public AccessorAssembler {
         GetNumberOfDeletedElements<NameDictionary>(properties);
     TNode<Smi> new_deleted = SmiAdd(num_deleted, SmiConstant(1));
     SetNumberOfDeletedElements<NameDictionary>(properties, new_deleted);
+    SetNameDictionaryFlags(
+        properties,
+        SmiAnd(GetNameDictionaryFlags(properties),
+               SmiConstant(
+                   static_cast<int>(~NameDictionary::ReadCountBits::kMask))));
 
     // Shrink the dictionary if necessary (see NameDictionary::Shrink).
     Label shrinking_done(this);
@@ -1020,6 +1030,10 @@ class SetOrCopyDataPropertiesAssembler : public CodeStubAssembler {
             },
             if_runtime);
       } else {
+        // Define the properties inline rather than calling CreateDataProperty
+        // for each one, which dominated the cost of spreading several objects
+        // into one literal, like {...a, ...b}.
+        TNode<BoolT> target_is_simple_receiver = IsSimpleObjectMap(target_map);
         ForEachEnumerableOwnProperty(
             context, source_map, CAST(source), kEnumerationOrder,
             [=, this](TNode<Name> key, LazyNode<Object> value) {
@@ -1040,8 +1054,9 @@ class SetOrCopyDataPropertiesAssembler : public CodeStubAssembler {
                     1, LoopUnrollingMode::kNo, IndexAdvanceMode::kPost);
               }
 
-              CallBuiltin(Builtin::kCreateDataProperty, context, target, key,
-                          value());
+              KeyedStoreGenericGenerator::CreateDataProperty(
+                  state(), context, CAST(target), target_is_simple_receiver,
+                  key, value());
               Goto(&skip);
               Bind(&skip);
             },
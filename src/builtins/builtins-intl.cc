@@ -1186,7 +1186,8 @@ BUILTIN(CollatorInternalCompare) {
   icu::Collator* icu_collator = collator->icu_collator()->raw();
   CHECK_NOT_NULL(icu_collator);
   return Smi::FromInt(
-      Intl::CompareStrings(isolate, *icu_collator, string_x, string_y));
+      Intl::CompareStrings(isolate, *icu_collator, string_x, string_y,
+                           collator->compare_strings_options()));
 }
 
 // ecma402 #sec-%segmentiteratorprototype%.next
@@ -36,9 +36,15 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
 
-  void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
+  void PrepareForContext(TNode<Context> native_context,
+                         TNode<IntPtrT> saved_entered_context_count,
+                         TVariable<Object>* var_batch_context, Label* bailout);
+  void EndMicrotaskBatch(TNode<IntPtrT> saved_entered_context_count,
+                         TVariable<Object>* var_batch_context);
   void RunSingleMicrotask(TNode<Context> current_context,
-                          TNode<Microtask> microtask);
+                          TNode<Microtask> microtask,
+                          TNode<IntPtrT> saved_entered_context_count,
+                          TVariable<Object>* var_batch_context);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
@@ -109,18 +115,41 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
       WordAnd(IntPtrAdd(start, index), IntPtrSub(capacity, IntPtrConstant(1))));
 }
 
+// Consecutive microtasks of the same native context form a batch, during
+// which the context stays entered. {var_batch_context} holds the native
+// context of the current batch, or undefined if none is entered.
 void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
-    TNode<Context> native_context, Label* bailout) {
+    TNode<Context> native_context, TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context, Label* bailout) {
   CSA_DCHECK(this, IsNativeContext(native_context));
 
   // Skip the microtask execution if the associated context is shutdown.
   GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
          bailout);
 
+  Label done(this);
+  GotoIf(TaggedEqual(var_batch_context->value(), native_context), &done);
+  EndMicrotaskBatch(saved_entered_context_count, var_batch_context);
   EnterContext(native_context);
+  *var_batch_context = native_context;
+  Goto(&done);
+
+  BIND(&done);
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::EndMicrotaskBatch(
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context) {
+  Label done(this);
+  GotoIf(IsUndefined(var_batch_context->value()), &done);
+  RewindEnteredContext(saved_entered_context_count);
+  *var_batch_context = UndefinedConstant();
+  Goto(&done);
+
+  BIND(&done);
+}
+
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 void MicrotaskQueueBuiltinsAssembler::SetupContinuationPreservedEmbedderData(
     TNode<Microtask> microtask) {
@@ -143,12 +172,13 @@ void MicrotaskQueueBuiltinsAssembler::ClearContinuationPreservedEmbedderData() {
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<Context> current_context, TNode<Microtask> microtask,
+    TNode<IntPtrT> saved_entered_context_count,
+    TVariable<Object>* var_batch_context) {
   CSA_DCHECK(this, TaggedIsNotSmi(microtask));
   CSA_DCHECK(this, Word32BinaryNot(IsExecutionTerminating()));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -177,7 +207,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, CallableTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, saved_entered_context_count,
+                      var_batch_context, &done);
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
@@ -188,7 +219,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
       ScopedExceptionHandler handler(this, &if_exception, &var_exception);
       Call(microtask_context, callable, UndefinedConstant());
     }
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     ClearContinuationPreservedEmbedderData();
@@ -205,6 +235,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
 #endif
+    // Callback tasks don't run in a context of their own, so leave the
+    // current batch.
+    EndMicrotaskBatch(saved_entered_context_count, var_batch_context);
 
     // If this turns out to become a bottleneck because of the calls
     // to C++ via CEntry, we can choose to speed them up using a
@@ -233,7 +266,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseResolveThenableJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, saved_entered_context_count,
+                      var_batch_context, &done);
 
     const TNode<Object> promise_to_resolve = LoadObjectField(
         microtask, PromiseResolveThenableJobTask::kPromiseToResolveOffset);
@@ -256,7 +290,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     RunAllPromiseHooks(PromiseHookType::kAfter, microtask_context,
                    CAST(promise_to_resolve));
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     ClearContinuationPreservedEmbedderData();
@@ -270,7 +303,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, saved_entered_context_count,
+                      var_batch_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -301,7 +335,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     ClearContinuationPreservedEmbedderData();
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -312,7 +345,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, PromiseReactionJobTask::kContextOffset);
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, saved_entered_context_count,
+                      var_batch_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, PromiseReactionJobTask::kArgumentOffset);
@@ -343,7 +377,6 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     ClearContinuationPreservedEmbedderData();
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
-    RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -356,7 +389,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     // Report unhandled exceptions from microtasks.
     CallRuntime(Runtime::kReportMessageFromMicrotask, GetCurrentContext(),
                 var_exception.value());
-    RewindEnteredContext(saved_entered_context_count);
+    EndMicrotaskBatch(saved_entered_context_count, var_batch_context);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -586,7 +619,12 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   auto microtask_queue =
       UncheckedParameter<RawPtrT>(Descriptor::kMicrotaskQueue);
 
-  Label loop(this), done(this);
+  // Entered contexts are kept across microtasks of the same native context,
+  // and only rewound when the context changes or the queue is drained.
+  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  TVARIABLE(Object, var_batch_context, UndefinedConstant());
+
+  Label loop(this, &var_batch_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -613,12 +651,15 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
+  RunSingleMicrotask(current_context, microtask, saved_entered_context_count,
+                     &var_batch_context);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
 
   BIND(&done);
   {
+    EndMicrotaskBatch(saved_entered_context_count, &var_batch_context);
+
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
@@ -10276,6 +10276,14 @@ void CodeStubAssembler::InsertEntry<NameDictionary>(
   // Finally, store the details.
   StoreDetailsByKeyIndex<NameDictionary>(dictionary, index,
                                          var_details.value());
+
+  // Adding a property restarts the read-mostly detection (see
+  // NameDictionary::ReadCountBits).
+  SetNameDictionaryFlags(
+      dictionary,
+      SmiAnd(GetNameDictionaryFlags(dictionary),
+             SmiConstant(
+                 static_cast<int>(~NameDictionary::ReadCountBits::kMask))));
 }
 
 template <>
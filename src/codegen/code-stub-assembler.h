@@ -2855,6 +2855,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
         ExternalReference::address_of_builtin_subclassing_flag());
   }
 
+  TNode<BoolT> HasJSFinalizationRegistryBatchingFlag() {
+    return LoadRuntimeFlag(
+        ExternalReference::address_of_js_finalization_registry_batching_flag());
+  }
+
   TNode<BoolT> HasSharedStringTableFlag() {
     return LoadRuntimeFlag(
         ExternalReference::address_of_shared_string_table_flag());
@@ -0,0 +1,76 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/compile-job-histograms.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+void CompileJobHistograms::AddJob(const v8::metrics::CompileJob& job) {
+  const size_t tier_index = static_cast<size_t>(job.tier);
+  DCHECK_LT(tier_index, kNumTiers);
+  Tier& tier = tiers_[tier_index];
+  tier.job_count++;
+  if (!job.success) tier.failed_job_count++;
+  tier.bytecode_size_in_bytes += job.bytecode_size_in_bytes;
+  tier.code_size_in_bytes += job.code_size_in_bytes;
+  if (job.cpu_duration_in_us >= 0) {
+    tier.cpu_duration_in_us += job.cpu_duration_in_us;
+  }
+  if (job.wall_clock_duration_in_us >= 0) {
+    AddSample(&tier.wall_clock_duration, job.wall_clock_duration_in_us);
+  }
+  if (job.queue_delay_in_us >= 0) {
+    AddSample(&tier.queue_delay, job.queue_delay_in_us);
+  }
+}
+
+// static
+void CompileJobHistograms::AddSample(Histogram* histogram,
+                                     int64_t duration_in_us) {
+  histogram->bucket_counts[GCLatencyHistograms::BucketIndex(duration_in_us)]++;
+  histogram->total_count++;
+  histogram->total_duration_in_us += duration_in_us;
+  histogram->max_duration_in_us =
+      std::max(histogram->max_duration_in_us, duration_in_us);
+}
+
+void CompileJobHistograms::CopyTo(
+    v8::metrics::CompileJobHistograms* result) const {
+  DCHECK_NOT_NULL(result);
+  result->bucket_lower_bounds_in_us.resize(kNumBuckets);
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    result->bucket_lower_bounds_in_us[i] =
+        GCLatencyHistograms::BucketLowerBound(i);
+  }
+  for (size_t i = 0; i < kNumTiers; ++i) {
+    const Tier& tier = tiers_[i];
+    v8::metrics::CompileJobHistograms::Tier& result_tier = result->tiers[i];
+    result_tier.job_count = tier.job_count;
+    result_tier.failed_job_count = tier.failed_job_count;
+    result_tier.bytecode_size_in_bytes = tier.bytecode_size_in_bytes;
+    result_tier.code_size_in_bytes = tier.code_size_in_bytes;
+    result_tier.cpu_duration_in_us = tier.cpu_duration_in_us;
+    CopyHistogram(tier.wall_clock_duration, &result_tier.wall_clock_duration);
+    CopyHistogram(tier.queue_delay, &result_tier.queue_delay);
+  }
+}
+
+// static
+void CompileJobHistograms::CopyHistogram(
+    const Histogram& histogram,
+    v8::metrics::CompileJobHistograms::Histogram* result) {
+  result->bucket_counts.assign(histogram.bucket_counts.begin(),
+                               histogram.bucket_counts.end());
+  result->total_count = histogram.total_count;
+  result->total_duration_in_us = histogram.total_duration_in_us;
+  result->max_duration_in_us = histogram.max_duration_in_us;
+}
+
+}  // namespace internal
+}  // namespace v8
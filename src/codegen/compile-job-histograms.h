@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_COMPILE_JOB_HISTOGRAMS_H_
+#define V8_CODEGEN_COMPILE_JOB_HISTOGRAMS_H_
+
+#include <array>
+#include <cstdint>
+
+#include "include/v8-metrics.h"
+#include "src/base/macros.h"
+#include "src/heap/gc-latency-histograms.h"
+
+namespace v8 {
+namespace internal {
+
+// Aggregates the compile jobs of an isolate per tier: job counts, code sizes,
+// CPU time, and histograms of the compile and queue delay durations. The
+// histograms reuse the log-linear buckets of GCLatencyHistograms.
+//
+// Only used from the main thread.
+class V8_EXPORT_PRIVATE CompileJobHistograms final {
+ public:
+  static constexpr size_t kNumTiers = v8::metrics::CompileJob::kNumTiers;
+  static constexpr size_t kNumBuckets = GCLatencyHistograms::kNumBuckets;
+
+  void AddJob(const v8::metrics::CompileJob& job);
+
+  void CopyTo(v8::metrics::CompileJobHistograms* result) const;
+
+ private:
+  struct Histogram {
+    std::array<uint32_t, kNumBuckets> bucket_counts{};
+    uint64_t total_count = 0;
+    int64_t total_duration_in_us = 0;
+    int64_t max_duration_in_us = 0;
+  };
+
+  struct Tier {
+    uint64_t job_count = 0;
+    uint64_t failed_job_count = 0;
+    uint64_t bytecode_size_in_bytes = 0;
+    uint64_t code_size_in_bytes = 0;
+    int64_t cpu_duration_in_us = 0;
+    Histogram wall_clock_duration;
+    Histogram queue_delay;
+  };
+
+  static void AddSample(Histogram* histogram, int64_t duration_in_us);
+  static void CopyHistogram(
+      const Histogram& histogram,
+      v8::metrics::CompileJobHistograms::Histogram* result);
+
+  std::array<Tier, kNumTiers> tiers_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_COMPILE_JOB_HISTOGRAMS_H_
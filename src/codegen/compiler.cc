@@ -17,8 +17,10 @@
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/compile-job-histograms.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/codegen/process-compilation-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/assert-scope.h"
@@ -29,6 +31,7 @@
 #include "src/compiler/turbofan.h"
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
+#include "src/deoptimizer/deopt-stats.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -40,6 +43,7 @@
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/heap/local-heap-inl.h"
@@ -48,6 +52,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -309,6 +314,17 @@ class CompilerTracer : public AllStatic {
 
 }  // namespace
 
+// static
+void Compiler::RecordCompileJob(Isolate* isolate,
+                                const v8::metrics::CompileJob& job) {
+  isolate->compile_job_histograms()->AddJob(job);
+  isolate->metrics_recorder()->AddMainThreadEvent(
+      job, isolate->context().is_null()
+               ? v8::metrics::Recorder::ContextId::Empty()
+               : isolate->GetOrRegisterRecorderContextId(
+                     isolate->native_context()));
+}
+
 // static
 void Compiler::LogFunctionCompilation(Isolate* isolate,
                                       LogEventListener::CodeTag code_type,
@@ -465,23 +481,56 @@ void LogUnoptimizedCompilation(Isolate* isolate,
 // ----------------------------------------------------------------------------
 // Implementation of OptimizedCompilationJob
 
+namespace {
+
+// Adds the thread CPU time spent in its scope to |cpu_time|, where thread CPU
+// time is supported.
+class V8_NODISCARD ScopedThreadCpuTimer {
+ public:
+  explicit ScopedThreadCpuTimer(base::TimeDelta* cpu_time)
+      : cpu_time_(cpu_time) {
+    if (base::ThreadTicks::IsSupported()) start_ = base::ThreadTicks::Now();
+  }
+  ~ScopedThreadCpuTimer() {
+    if (!start_.IsNull()) *cpu_time_ += base::ThreadTicks::Now() - start_;
+  }
+
+ private:
+  base::TimeDelta* const cpu_time_;
+  base::ThreadTicks start_;
+};
+
+}  // namespace
+
 CompilationJob::Status OptimizedCompilationJob::PrepareJob(Isolate* isolate) {
   DCHECK_EQ(ThreadId::Current(), isolate->thread_id());
   DisallowJavascriptExecution no_js(isolate);
 
   // Delegate to the underlying implementation.
   DCHECK_EQ(state(), State::kReadyToPrepare);
-  base::ScopedTimer t(&time_taken_to_prepare_);
-  return UpdateState(PrepareJobImpl(isolate), State::kReadyToExecute);
+  Status status;
+  {
+    base::ScopedTimer t(&time_taken_to_prepare_);
+    ScopedThreadCpuTimer cpu_timer(&cpu_time_);
+    status = PrepareJobImpl(isolate);
+  }
+  prepared_ticks_ = base::TimeTicks::Now();
+  return UpdateState(status, State::kReadyToExecute);
 }
 
 CompilationJob::Status OptimizedCompilationJob::ExecuteJob(
     RuntimeCallStats* stats, LocalIsolate* local_isolate) {
   DCHECK_IMPLIES(local_isolate && !local_isolate->is_main_thread(),
                  local_isolate->heap()->IsParked());
+  if (!prepared_ticks_.IsNull()) {
+    queue_delay_ = base::TimeTicks::Now() - prepared_ticks_;
+  }
+  executed_on_background_thread_ =
+      local_isolate != nullptr && !local_isolate->is_main_thread();
   // Delegate to the underlying implementation.
   DCHECK_EQ(state(), State::kReadyToExecute);
   base::ScopedTimer t(&time_taken_to_execute_);
+  ScopedThreadCpuTimer cpu_timer(&cpu_time_);
   return UpdateState(ExecuteJobImpl(stats, local_isolate),
                      State::kReadyToFinalize);
 }
@@ -493,9 +542,26 @@ CompilationJob::Status OptimizedCompilationJob::FinalizeJob(Isolate* isolate) {
   // Delegate to the underlying implementation.
   DCHECK_EQ(state(), State::kReadyToFinalize);
   base::ScopedTimer t(&time_taken_to_finalize_);
+  ScopedThreadCpuTimer cpu_timer(&cpu_time_);
   return UpdateState(FinalizeJobImpl(isolate), State::kSucceeded);
 }
 
+void OptimizedCompilationJob::InitializeCompileJobEvent(
+    v8::metrics::CompileJob* event) const {
+  event->concurrent = executed_on_background_thread_;
+  event->success = state() == State::kSucceeded;
+  if (executed_on_background_thread_) {
+    event->queue_delay_in_us = queue_delay_.InMicroseconds();
+  }
+  event->wall_clock_duration_in_us =
+      (time_taken_to_prepare_ + time_taken_to_execute_ +
+       time_taken_to_finalize_)
+          .InMicroseconds();
+  if (base::ThreadTicks::IsSupported()) {
+    event->cpu_duration_in_us = cpu_time_.InMicroseconds();
+  }
+}
+
 GlobalHandleVector<Map> OptimizedCompilationJob::CollectRetainedMaps(
     Isolate* isolate, DirectHandle<Code> code) {
   DCHECK(code->is_optimized_code());
@@ -537,6 +603,29 @@ CompilationJob::Status TurbofanCompilationJob::AbortOptimization(
   return UpdateState(FAILED, State::kFailed);
 }
 
+void TurbofanCompilationJob::RecordCompileJob(Isolate* isolate) const {
+  v8::metrics::CompileJob event;
+  event.tier = v8::metrics::CompileJob::Tier::kTurbofan;
+  event.osr = compilation_info()->is_osr();
+  InitializeCompileJobEvent(&event);
+  if (compilation_info()->has_bytecode_array()) {
+    event.bytecode_size_in_bytes =
+        compilation_info()->bytecode_array()->length();
+  }
+  if (event.success) {
+    event.code_size_in_bytes = compilation_info()->code()->instruction_size();
+  } else {
+    event.bailout_reason =
+        static_cast<int>(compilation_info()->bailout_reason());
+    if (DeoptStats* deopt_stats = isolate->deopt_stats()) {
+      deopt_stats->RecordBailout(*compilation_info()->shared_info(),
+                                 CodeKind::TURBOFAN,
+                                 compilation_info()->bailout_reason());
+    }
+  }
+  Compiler::RecordCompileJob(isolate, event);
+}
+
 void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
                                                     Isolate* isolate) const {
   DCHECK(compilation_info()->IsOptimizing());
@@ -734,6 +823,11 @@ void InstallUnoptimizedCode(UnoptimizedCompilationInfo* compilation_info,
         isolate, compilation_info->feedback_vector_spec());
     shared_info->set_feedback_metadata(*feedback_metadata, kReleaseStore);
 
+    if (v8_flags.adaptive_bytecode_flushing &&
+        shared_info->HasAgeAfterBytecodeFlush()) {
+      shared_info->UpdateBytecodeFlushReuseLevel();
+      isolate->heap()->AsHeap()->tracer()->NotifyRecompileAfterBytecodeFlush();
+    }
     shared_info->set_age(0);
     shared_info->set_bytecode_array(*compilation_info->bytecode_array());
   } else {
@@ -1075,6 +1169,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    job->RecordCompileJob(isolate);
     return false;
   }
 
@@ -1083,6 +1178,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    job->RecordCompileJob(isolate);
     return false;
   }
 
@@ -1090,11 +1186,13 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    job->RecordCompileJob(isolate);
     return false;
   }
 
   // Success!
   job->RecordCompilationStats(ConcurrencyMode::kSynchronous, isolate);
+  job->RecordCompileJob(isolate);
   DCHECK(!isolate->has_exception());
   OptimizedCodeCache::Insert(isolate, *compilation_info->closure(),
                              compilation_info->osr_offset(),
@@ -3027,10 +3125,10 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
   CompilerTracer::TraceStartBaselineCompile(isolate, shared);
   Handle<Code> code;
   base::TimeDelta time_taken;
+  base::TimeDelta cpu_time;
   {
-    base::ScopedTimer timer(
-        v8_flags.trace_baseline || v8_flags.log_function_events ? &time_taken
-                                                                : nullptr);
+    base::ScopedTimer timer(&time_taken);
+    ScopedThreadCpuTimer cpu_timer(&cpu_time);
     if (!GenerateBaselineCode(isolate, shared).ToHandle(&code)) {
       // TODO(leszeks): This can only fail because of an OOM. Do we want to
       // report these somehow, or silently ignore them?
@@ -3041,6 +3139,17 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
   }
   double time_taken_ms = time_taken.InMillisecondsF();
 
+  v8::metrics::CompileJob event;
+  event.tier = v8::metrics::CompileJob::Tier::kSparkplug;
+  event.success = true;
+  event.bytecode_size_in_bytes = shared->GetBytecodeArray(isolate)->length();
+  event.code_size_in_bytes = code->instruction_size();
+  event.wall_clock_duration_in_us = time_taken.InMicroseconds();
+  if (base::ThreadTicks::IsSupported()) {
+    event.cpu_duration_in_us = cpu_time.InMicroseconds();
+  }
+  RecordCompileJob(isolate, event);
+
   CompilerTracer::TraceFinishBaselineCompile(isolate, shared, time_taken_ms);
 
   if (IsScript(shared->script())) {
@@ -3876,6 +3985,18 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     is_compiled_scope = lookup_result.is_compiled_scope();
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
+    } else if (v8_flags.process_compilation_cache && !can_consume_code_cache) {
+      // Then check the code caches of scripts compiled by other isolates.
+      Handle<SharedFunctionInfo> result;
+      if (ProcessCompilationCache::Get()
+              ->Lookup(isolate, source, script_details, maybe_script)
+              .ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          maybe_result = result;
+          compilation_cache->PutScript(source, language_mode, result);
+        }
+      }
     } else if (can_consume_code_cache) {
       compile_timer.set_consuming_code_cache();
       // Then check cached code provided by embedder.
@@ -3965,6 +4086,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (v8_flags.process_compilation_cache) {
+        ProcessCompilationCache::Get()->Put(isolate, source, script_details,
+                                            result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -4219,6 +4344,10 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
                    "V8.StreamingFinalization.AddToCache");
       compilation_cache->PutScript(source, task->flags().outer_language_mode(),
                                    result);
+      if (v8_flags.process_compilation_cache) {
+        ProcessCompilationCache::Get()->Put(isolate, source, script_details,
+                                            result);
+      }
     }
   }
 
@@ -4355,6 +4484,7 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
       job->RetryOptimization(BailoutReason::kOptimizationDisabled);
     } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
       job->RecordCompilationStats(ConcurrencyMode::kConcurrent, isolate);
+      job->RecordCompileJob(isolate);
       job->RecordFunctionCompilation(LogEventListener::CodeTag::kFunction,
                                      isolate);
       if (V8_LIKELY(use_result)) {
@@ -4384,6 +4514,7 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
   CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                   job->prepare_in_ms(), job->execute_in_ms(),
                                   job->finalize_in_ms());
+  job->RecordCompileJob(isolate);
   if (V8_LIKELY(use_result)) {
     ResetTieringState(isolate, *function, osr_offset);
     if (!IsOSR(osr_offset)) {
@@ -4402,10 +4533,12 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
   if (function->ActiveTierIsTurbofan(isolate) && !job->is_osr()) {
     CompilerTracer::TraceAbortedMaglevCompile(
         isolate, function, BailoutReason::kHigherTierAvailable);
+    job->RecordCompileJob(isolate, BailoutReason::kHigherTierAvailable);
     return;
   }
 
   const CompilationJob::Status status = job->FinalizeJob(isolate);
+  job->RecordCompileJob(isolate, BailoutReason::kNoReason);
 
   // TODO(v8:7700): Use the result and check if job succeed
   // when all the bytecodes are implemented.
@@ -29,6 +29,10 @@
 
 namespace v8 {
 
+namespace metrics {
+struct CompileJob;
+}  // namespace metrics
+
 namespace tracing {
 class TracedValue;
 }  // namespace tracing
@@ -270,6 +274,11 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
                                      Handle<AbstractCode> abstract_code,
                                      CodeKind kind, double time_taken_ms);
 
+  // Adds a finished compile job to the isolate's compile job histograms and
+  // reports it to the embedder's metrics recorder.
+  static void RecordCompileJob(Isolate* isolate,
+                               const v8::metrics::CompileJob& job);
+
   static void InstallInterpreterTrampolineCopy(
       Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
       LogEventListener::CodeTag log_tag);
@@ -432,6 +441,9 @@ class OptimizedCompilationJob : public CompilationJob {
   }
 
  protected:
+  // Sets the concurrency and the durations of a compile job event.
+  void InitializeCompileJobEvent(v8::metrics::CompileJob* event) const;
+
   // Overridden by the actual implementation.
   virtual Status PrepareJobImpl(Isolate* isolate) = 0;
   virtual Status ExecuteJobImpl(RuntimeCallStats* stats,
@@ -449,6 +461,13 @@ class OptimizedCompilationJob : public CompilationJob {
   base::TimeDelta time_taken_to_prepare_;
   base::TimeDelta time_taken_to_execute_;
   base::TimeDelta time_taken_to_finalize_;
+  // The thread CPU time of all phases, where thread CPU time is supported.
+  base::TimeDelta cpu_time_;
+  // The time between the end of the prepare phase and the start of the
+  // execute phase, i.e. the time a concurrent job waited in the queue.
+  base::TimeDelta queue_delay_;
+  base::TimeTicks prepared_ticks_;
+  bool executed_on_background_thread_ = false;
 
   base::ElapsedTimer timer_;
 
@@ -477,6 +496,7 @@ class TurbofanCompilationJob : public OptimizedCompilationJob {
   Status AbortOptimization(BailoutReason reason);
 
   void RecordCompilationStats(ConcurrencyMode mode, Isolate* isolate) const;
+  void RecordCompileJob(Isolate* isolate) const;
   void RecordFunctionCompilation(LogEventListener::CodeTag code_type,
                                  Isolate* isolate) const;
 
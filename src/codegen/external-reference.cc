@@ -804,6 +804,11 @@ ExternalReference ExternalReference::address_of_builtin_subclassing_flag() {
   return ExternalReference(&v8_flags.builtin_subclassing);
 }
 
+ExternalReference
+ExternalReference::address_of_js_finalization_registry_batching_flag() {
+  return ExternalReference(&v8_flags.js_finalization_registry_batching);
+}
+
 ExternalReference ExternalReference::address_of_runtime_stats_flag() {
   return ExternalReference(&TracingFlags::runtime_stats);
 }
@@ -1194,6 +1199,8 @@ FUNCTION_REFERENCE(jsarray_array_join_concat_to_sequential_string,
                    JSArray::ArrayJoinConcatToSequentialString)
 
 FUNCTION_REFERENCE(gsab_byte_length, JSArrayBuffer::GsabByteLength)
+FUNCTION_REFERENCE(rab_gsab_typed_array_length,
+                   JSTypedArray::RabGsabTypedArrayLength)
 
 ExternalReference ExternalReference::search_string_raw_one_one() {
   return search_string_raw<const uint8_t, const uint8_t>();
@@ -103,6 +103,8 @@ enum class IsolateFieldId : uint8_t;
   V(address_of_fp16_neg_constant, "fp16_negate_constant")                      \
   V(address_of_float_abs_constant, "float_absolute_constant")                  \
   V(address_of_float_neg_constant, "float_negate_constant")                    \
+  V(address_of_js_finalization_registry_batching_flag,                         \
+    "v8_flags.js_finalization_registry_batching")                              \
   V(address_of_log10_offset_table, "log10_offset_table")                       \
   V(address_of_min_int, "LDoubleConstant::min_int")                            \
   V(address_of_mock_arraybuffer_allocator_flag,                                \
@@ -138,6 +140,7 @@ enum class IsolateFieldId : uint8_t;
   V(get_date_field_function, "JSDate::GetField")                               \
   V(get_or_create_hash_raw, "get_or_create_hash_raw")                          \
   V(gsab_byte_length, "GsabByteLength")                                        \
+  V(rab_gsab_typed_array_length, "JSTypedArray::RabGsabTypedArrayLength")      \
   V(ieee754_acos_function, "base::ieee754::acos")                              \
   V(ieee754_acosh_function, "base::ieee754::acosh")                            \
   V(ieee754_asin_function, "base::ieee754::asin")                              \
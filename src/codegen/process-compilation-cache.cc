@@ -0,0 +1,122 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/process-compilation-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessCompilationCache,
+                                GetProcessCompilationCache)
+}  // namespace
+
+// static
+ProcessCompilationCache* ProcessCompilationCache::Get() {
+  return GetProcessCompilationCache();
+}
+
+size_t ProcessCompilationCache::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(base::hash_range(key.source.begin(),
+                                             key.source.end()),
+                            key.is_one_byte, key.source_hash);
+}
+
+// static
+ProcessCompilationCache::Key ProcessCompilationCache::KeyFor(
+    Handle<String> source, const ScriptDetails& script_details) {
+  DCHECK(source->IsFlat());
+  DisallowGarbageCollection no_gc;
+  Key key;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  key.is_one_byte = content.IsOneByte();
+  if (key.is_one_byte) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.source.assign(reinterpret_cast<const char*>(chars.begin()),
+                      chars.length());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    key.source.assign(reinterpret_cast<const char*>(chars.begin()),
+                      chars.length() * sizeof(base::uc16));
+  }
+  key.source_hash =
+      SerializedCodeData::SourceHash(source, script_details.origin_options);
+  return key;
+}
+
+MaybeHandle<SharedFunctionInfo> ProcessCompilationCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details,
+    MaybeHandle<Script> maybe_cached_script) {
+  source = String::Flatten(isolate, source);
+  const Key key = KeyFor(source, script_details);
+  std::shared_ptr<Entry> entry;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return {};
+    entry = it->second;
+  }
+
+  AlignedCachedData cached_data(entry->data.data(),
+                                static_cast<int>(entry->data.size()));
+  MaybeHandle<SharedFunctionInfo> result = CodeSerializer::Deserialize(
+      isolate, &cached_data, source, script_details, maybe_cached_script);
+  if (cached_data.rejected()) {
+    // The entry was serialized with different flags, so it won't be accepted
+    // by any isolate with the current ones.
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second == entry) Evict(it);
+  }
+  return result;
+}
+
+void ProcessCompilationCache::Put(Isolate* isolate, Handle<String> source,
+                                  const ScriptDetails& script_details,
+                                  Handle<SharedFunctionInfo> toplevel) {
+  source = String::Flatten(isolate, source);
+  Key key = KeyFor(source, script_details);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.count(key) != 0) return;
+  }
+
+  // Serialize outside of the lock, so that other isolates are not blocked.
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(isolate, toplevel));
+  if (!cached_data) return;
+  const size_t max_size = v8_flags.process_compilation_cache_size * MB;
+  const size_t entry_size = key.source.size() + cached_data->length;
+  if (entry_size > max_size) return;
+  auto entry = std::make_shared<Entry>();
+  entry->data.assign(cached_data->data,
+                     cached_data->data + cached_data->length);
+
+  base::MutexGuard guard(&mutex_);
+  auto [it, inserted] = entries_.emplace(std::move(key), entry);
+  if (!inserted) return;
+  size_ += entry_size;
+  entry->order = insertion_order_.insert(insertion_order_.end(), &it->first);
+  while (size_ > max_size) {
+    Evict(entries_.find(*insertion_order_.front()));
+  }
+}
+
+void ProcessCompilationCache::Evict(EntryMap::iterator it) {
+  size_ -= it->first.source.size() + it->second->data.size();
+  insertion_order_.erase(it->second->order);
+  entries_.erase(it);
+}
+
+}  // namespace internal
+}  // namespace v8
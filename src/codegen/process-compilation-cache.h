@@ -0,0 +1,94 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_PROCESS_COMPILATION_CACHE_H_
+#define V8_CODEGEN_PROCESS_COMPILATION_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Script;
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// Caches the code caches of compiled scripts for all isolates of the process,
+// enabled by --process-compilation-cache. The per-isolate CompilationCache
+// only avoids recompiling a script within one isolate; with this, isolates
+// loading the same script deserialize the bytecode that another isolate
+// compiled instead of parsing and compiling it again.
+//
+// Entries are keyed by the source and its origin options, and hold the output
+// of CodeSerializer, which is context independent. The flag hash in the
+// serialized data rejects entries from incompatible configurations. The
+// cache is bounded by --process-compilation-cache-size and evicts the oldest
+// entries first.
+class ProcessCompilationCache final {
+ public:
+  static ProcessCompilationCache* Get();
+
+  // Deserializes the script cached for {source} into {isolate}, merging it
+  // with {maybe_cached_script} if given. Returns an empty handle on a miss.
+  MaybeHandle<SharedFunctionInfo> Lookup(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details,
+      MaybeHandle<Script> maybe_cached_script);
+
+  // Serializes {toplevel}, which was just compiled from {source}, unless a
+  // script with the same source is cached already.
+  void Put(Isolate* isolate, Handle<String> source,
+           const ScriptDetails& script_details,
+           Handle<SharedFunctionInfo> toplevel);
+
+ private:
+  struct Key {
+    // The raw characters of the source.
+    std::string source;
+    bool is_one_byte;
+    // SerializedCodeData::SourceHash, which covers the origin options.
+    uint32_t source_hash;
+    bool operator==(const Key& other) const {
+      return source_hash == other.source_hash &&
+             is_one_byte == other.is_one_byte && source == other.source;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+  struct Entry {
+    std::vector<uint8_t> data;
+    // The position of the key in {insertion_order_}.
+    std::list<const Key*>::iterator order;
+  };
+
+  // Entries are shared, so that isolates can deserialize an entry while
+  // another isolate evicts it.
+  using EntryMap = std::unordered_map<Key, std::shared_ptr<Entry>, KeyHash>;
+
+  static Key KeyFor(Handle<String> source, const ScriptDetails& script_details);
+
+  // Removes {it} from the cache. Requires {mutex_}.
+  void Evict(EntryMap::iterator it);
+
+  base::Mutex mutex_;
+  EntryMap entries_;
+  std::list<const Key*> insertion_order_;
+  // The size of the sources and code caches of all entries.
+  size_t size_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_PROCESS_COMPILATION_CACHE_H_
@@ -25,13 +25,21 @@ namespace internal {
 
 RwxMemoryWriteScope::RwxMemoryWriteScope(const char* comment) {
   if (!v8_flags.jitless) {
-    SetWritable();
+    if (nesting_level_++ == 0) {
+      SetWritable();
+    } else {
+      // Both entering and leaving the scope are saved.
+      saved_permission_switches_ += 2;
+    }
   }
 }
 
 RwxMemoryWriteScope::~RwxMemoryWriteScope() {
   if (!v8_flags.jitless) {
-    SetExecutable();
+    DCHECK_LT(0, nesting_level_);
+    if (--nesting_level_ == 0) {
+      SetExecutable();
+    }
   }
 }
 
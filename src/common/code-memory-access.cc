@@ -7,6 +7,8 @@
 #include <optional>
 
 #include "src/common/code-memory-access-inl.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
 #include "src/objects/instruction-stream-inl.h"
 #include "src/utils/allocation.h"
 
@@ -15,6 +17,9 @@ namespace internal {
 
 ThreadIsolation::TrustedData ThreadIsolation::trusted_data_;
 
+thread_local int RwxMemoryWriteScope::nesting_level_ = 0;
+thread_local size_t RwxMemoryWriteScope::saved_permission_switches_ = 0;
+
 #if V8_HAS_PKU_JIT_WRITE_PROTECT
 
 // static
@@ -42,6 +47,22 @@ RwxMemoryWriteScopeForTesting::RwxMemoryWriteScopeForTesting()
 
 RwxMemoryWriteScopeForTesting::~RwxMemoryWriteScopeForTesting() {}
 
+RwxMemoryWriteBatchScope::RwxMemoryWriteBatchScope(Isolate* isolate,
+                                                   const char* comment)
+    : isolate_(isolate),
+      saved_permission_switches_at_start_(
+          RwxMemoryWriteScope::saved_permission_switches()),
+      write_scope_(comment) {}
+
+RwxMemoryWriteBatchScope::~RwxMemoryWriteBatchScope() {
+  const size_t saved = RwxMemoryWriteScope::saved_permission_switches() -
+                       saved_permission_switches_at_start_;
+  Counters* counters = isolate_->counters();
+  counters->rwx_write_batch_scopes()->Increment();
+  counters->rwx_write_batch_saved_permission_switches()->Increment(
+      static_cast<int>(saved));
+}
+
 // static
 bool ThreadIsolation::Enabled() {
 #if V8_HEAP_USE_PKU_JIT_WRITE_PROTECT
@@ -34,6 +34,9 @@ namespace internal {
 //     used directly, but rather is the implementation of one of the above.
 // - RwxMemoryWriteScopeForTesting:
 //     Same, but for use in testing.
+// - RwxMemoryWriteBatchScope:
+//     Keeps executable memory writable for a phase that performs many code
+//     writes so that nested scopes don't need to switch permissions.
 
 class RwxMemoryWriteScopeForTesting;
 namespace wasm {
@@ -86,7 +89,8 @@ class CodeSpaceWriteScope;
 //
 // On other platforms the scope is a no-op and thus it's allowed to be used.
 //
-// The scope is reentrant and thread safe.
+// The scope is reentrant and thread safe. Permissions are only switched when
+// entering and leaving the outermost scope on the current thread.
 class V8_NODISCARD RwxMemoryWriteScope {
  public:
   // The comment argument is used only for ensuring that explanation about why
@@ -114,6 +118,12 @@ class V8_NODISCARD RwxMemoryWriteScope {
   static V8_EXPORT void SetDefaultPermissionsForSignalHandler();
 #endif  // V8_HAS_PKU_JIT_WRITE_PROTECT
 
+  // Returns the number of permission switches that were avoided on the current
+  // thread because a scope was entered while another one was already active.
+  static size_t saved_permission_switches() {
+    return saved_permission_switches_;
+  }
+
  private:
   friend class RwxMemoryWriteScopeForTesting;
   friend class wasm::CodeSpaceWriteScope;
@@ -123,6 +133,36 @@ class V8_NODISCARD RwxMemoryWriteScope {
   // scope classes that affect executable pages permissions.
   V8_INLINE static void SetWritable();
   V8_INLINE static void SetExecutable();
+
+  static thread_local int nesting_level_;
+  static thread_local size_t saved_permission_switches_;
+};
+
+// Keeps executable memory writable on the current thread for the duration of
+// the scope. All RwxMemoryWriteScopes (including those of WritableJitAllocation
+// and friends) opened within are nested and don't switch permissions. Meant
+// for phases that perform many small code writes, e.g. installing a batch of
+// compiled code or evacuating a code page. Generated code must not be executed
+// within the scope.
+//
+// The number of saved permission switches is reported to the isolate's
+// counters when the scope is left.
+class V8_NODISCARD RwxMemoryWriteBatchScope final {
+ public:
+  V8_EXPORT_PRIVATE RwxMemoryWriteBatchScope(Isolate* isolate,
+                                             const char* comment);
+  V8_EXPORT_PRIVATE ~RwxMemoryWriteBatchScope();
+
+  RwxMemoryWriteBatchScope(const RwxMemoryWriteBatchScope&) = delete;
+  RwxMemoryWriteBatchScope& operator=(const RwxMemoryWriteBatchScope&) =
+      delete;
+
+ private:
+  Isolate* const isolate_;
+  // Must be initialized before `write_scope_` so that the switch of the batch
+  // itself is not accounted as saved.
+  const size_t saved_permission_switches_at_start_;
+  RwxMemoryWriteScope write_scope_;
 };
 
 class WritableJitPage;
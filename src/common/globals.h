@@ -86,6 +86,12 @@ namespace internal {
 #define DEBUG_BOOL false
 #endif
 
+#ifdef ENABLE_HUGEPAGE
+#define ENABLE_HUGEPAGE_BOOL true
+#else
+#define ENABLE_HUGEPAGE_BOOL false
+#endif
+
 #ifdef V8_MAP_PACKING
 #define V8_MAP_PACKING_BOOL true
 #else
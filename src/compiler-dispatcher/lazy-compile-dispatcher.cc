@@ -70,9 +70,13 @@ LazyCompileDispatcher::LazyCompileDispatcher(Isolate* isolate,
       platform_(platform),
       max_stack_size_(max_stack_size),
       trace_compiler_dispatcher_(v8_flags.trace_compiler_dispatcher),
+      max_pending_source_size_(
+          static_cast<size_t>(v8_flags.lazy_compile_dispatcher_max_source_kb) *
+          KB),
       idle_task_manager_(new CancelableTaskManager()),
       idle_task_scheduled_(false),
       num_jobs_for_background_(0),
+      pending_source_size_(0),
       main_thread_blocking_on_job_(nullptr),
       block_for_testing_(false),
       semaphore_for_testing_(0) {
@@ -154,10 +158,29 @@ void LazyCompileDispatcher::Enqueue(
                "V8.LazyCompilerDispatcherEnqueue");
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
+  // Reserve the function's source size in the budget before creating the job,
+  // so that functions which don't fit stay lazy.
+  size_t source_size = static_cast<size_t>(shared_info->EndPosition() -
+                                           shared_info->StartPosition());
+  {
+    base::MutexGuard lock(&mutex_);
+    if (max_pending_source_size_ != 0 &&
+        pending_source_size_ + source_size > max_pending_source_size_) {
+      if (trace_compiler_dispatcher_) {
+        PrintF("LazyCompileDispatcher: over source budget, not enqueuing ");
+        ShortPrint(*shared_info);
+        PrintF("\n");
+      }
+      return;
+    }
+    pending_source_size_ += source_size;
+  }
+
   Job* job = new Job(std::make_unique<BackgroundCompileTask>(
       isolate_, shared_info, std::move(character_stream),
       worker_thread_runtime_call_stats_, background_compile_timer_,
       static_cast<int>(max_stack_size_)));
+  job->source_size = source_size;
 
   SetUncompiledDataJobPointer(isolate, shared_info,
                               reinterpret_cast<Address>(job));
@@ -370,6 +393,7 @@ void LazyCompileDispatcher::AbortAll() {
     jobs_to_dispose_.clear();
 
     DCHECK_EQ(all_jobs_.size(), 0);
+    DCHECK_EQ(pending_source_size_, 0);
     num_jobs_for_background_ = 0;
     VerifyBackgroundTaskCount(lock);
   }
@@ -557,6 +581,8 @@ void LazyCompileDispatcher::DeleteJob(Job* job, const base::MutexGuard&) {
 #ifdef DEBUG
   all_jobs_.erase(job);
 #endif
+  DCHECK_GE(pending_source_size_, job->source_size);
+  pending_source_size_ -= job->source_size;
   jobs_to_dispose_.push_back(job);
   if (jobs_to_dispose_.size() == 1) {
     num_jobs_for_background_++;
@@ -72,6 +72,11 @@ class Zone;
 // LazyCompileDispatcher::DoBackgroundWork advances one of the pending jobs,
 // and then spins of another idle task to potentially do the final step on the
 // main thread.
+//
+// The total source size of the functions which are enqueued but not finalized
+// yet is limited by v8_flags.lazy_compile_dispatcher_max_source_kb. Functions
+// which don't fit into this budget aren't enqueued, and are compiled lazily on
+// their first call instead.
 class V8_EXPORT_PRIVATE LazyCompileDispatcher {
  public:
   using JobId = uintptr_t;
@@ -82,6 +87,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   LazyCompileDispatcher& operator=(const LazyCompileDispatcher&) = delete;
   ~LazyCompileDispatcher();
 
+  // Enqueues a compile job for the given function, unless the source size
+  // budget of the dispatcher is exhausted.
   void Enqueue(LocalIsolate* isolate, Handle<SharedFunctionInfo> shared_info,
                std::unique_ptr<Utf16CharacterStream> character_stream);
 
@@ -107,6 +114,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, EnqueueOverSourceBudget);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -147,6 +155,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
 
     std::unique_ptr<BackgroundCompileTask> task;
     State state = State::kPending;
+    // The part of |pending_source_size_| accounted to this job.
+    size_t source_size = 0;
   };
 
   using SharedToJobMap = IdentityMap<Job*, FreeStoreAllocationPolicy>;
@@ -193,6 +203,9 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // thread.
   bool trace_compiler_dispatcher_;
 
+  // Maximum of |pending_source_size_|, or 0 if unbounded.
+  size_t max_pending_source_size_;
+
   std::unique_ptr<CancelableTaskManager> idle_task_manager_;
 
   // The following members can be accessed from any thread. Methods need to hold
@@ -212,6 +225,10 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // and those currently running.
   std::atomic<size_t> num_jobs_for_background_;
 
+  // The total source size of the functions of all jobs which were enqueued but
+  // not deleted yet.
+  size_t pending_source_size_;
+
 #ifdef DEBUG
   // The set of all allocated jobs, used for verification of the various queues
   // and counts.
@@ -7,6 +7,7 @@
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/common/code-memory-access.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate-inl.h"
 #include "src/handles/handles-inl.h"
@@ -178,6 +179,10 @@ void OptimizingCompileDispatcher::Stop() {
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  // Finalizing a job allocates and initializes code objects. Batch the code
+  // writes of all jobs in the output queue.
+  RwxMemoryWriteBatchScope write_batch_scope(
+      isolate_, "Installing optimized code of finished jobs.");
 
   for (;;) {
     std::unique_ptr<TurbofanCompilationJob> job;
@@ -8,6 +8,7 @@
 #include "src/handles/handles-inl.h"
 #include "src/objects/arguments.h"
 #include "src/objects/contexts.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/heap-number.h"
 #include "src/objects/js-collection.h"
 #include "src/objects/js-generator.h"
@@ -30,6 +31,19 @@ FieldAccess AccessBuilder::ForExternalIntPtr() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForExternalUint8Value() {
+  FieldAccess access = {kUntaggedBase,
+                        0,
+                        MaybeHandle<Name>(),
+                        OptionalMapRef(),
+                        TypeCache::Get()->kUint8,
+                        MachineType::Uint8(),
+                        kNoWriteBarrier,
+                        "ExternalUint8Value"};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForMap(WriteBarrierKind write_barrier) {
   FieldAccess access = {kTaggedBase,           HeapObject::kMapOffset,
@@ -395,6 +409,26 @@ FieldAccess AccessBuilder::ForJSAsyncFunctionObjectPromise() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitResolveClosure() {
+  FieldAccess access = {
+      kTaggedBase,         JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+      Handle<Name>(),      OptionalMapRef(),
+      Type::Any(),         MachineType::AnyTagged(),
+      kFullWriteBarrier,   "JSAsyncFunctionObjectAwaitResolveClosure"};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitRejectClosure() {
+  FieldAccess access = {
+      kTaggedBase,         JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+      Handle<Name>(),      OptionalMapRef(),
+      Type::Any(),         MachineType::AnyTagged(),
+      kFullWriteBarrier,   "JSAsyncFunctionObjectAwaitRejectClosure"};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSAsyncGeneratorObjectQueue() {
   FieldAccess access = {
@@ -463,6 +497,28 @@ FieldAccess AccessBuilder::ForJSArrayBufferByteLength() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSArrayBufferBackingStore() {
+  FieldAccess access = {
+      kTaggedBase,
+      JSArrayBuffer::kBackingStoreOffset,
+      MaybeHandle<Name>(),
+      OptionalMapRef(),
+#ifdef V8_ENABLE_SANDBOX
+      Type::SandboxedPointer(),
+      MachineType::SandboxedPointer(),
+#else
+      Type::ExternalPointer(),
+      MachineType::Pointer(),
+#endif
+      kNoWriteBarrier,
+      "JSArrayBufferBackingStore",
+      ConstFieldInfo::None(),
+      false,
+  };
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSArrayBufferViewBuffer() {
   FieldAccess access = {kTaggedBase,           JSArrayBufferView::kBufferOffset,
@@ -1452,6 +1508,19 @@ FieldAccess AccessBuilder::ForNameDictionaryFlagsIndex() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForCoverageInfoBlockCount(int slot_index) {
+  FieldAccess access = {kTaggedBase,
+                        CoverageInfo::BlockCountOffset(slot_index),
+                        Handle<Name>(),
+                        OptionalMapRef(),
+                        TypeCache::Get()->kInt32,
+                        MachineType::Int32(),
+                        kNoWriteBarrier,
+                        "CoverageInfoBlockCount"};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForFeedbackCellInterruptBudget() {
   FieldAccess access = {kTaggedBase,
@@ -28,6 +28,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to an IntPtr field identified by an external reference.
   static FieldAccess ForExternalIntPtr();
 
+  // Provides access to a Uint8 field identified by an external reference.
+  static FieldAccess ForExternalUint8Value();
+
   // ===========================================================================
   // Access to heap object fields and elements (based on tagged pointer).
 
@@ -142,6 +145,12 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSAsyncFunctionObject::promise() field.
   static FieldAccess ForJSAsyncFunctionObjectPromise();
 
+  // Provides access to JSAsyncFunctionObject::await_resolve_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitResolveClosure();
+
+  // Provides access to JSAsyncFunctionObject::await_reject_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitRejectClosure();
+
   // Provides access to JSAsyncGeneratorObject::queue() field.
   static FieldAccess ForJSAsyncGeneratorObjectQueue();
 
@@ -157,6 +166,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSArrayBuffer::byteLength() field.
   static FieldAccess ForJSArrayBufferByteLength();
 
+  // Provides access to JSArrayBuffer::backing_store() field.
+  static FieldAccess ForJSArrayBufferBackingStore();
+
   // Provides access to JSArrayBufferView::buffer() field.
   static FieldAccess ForJSArrayBufferViewBuffer();
 
@@ -382,6 +394,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to NameDictionary fields.
   static FieldAccess ForNameDictionaryFlagsIndex();
 
+  // Provides access to the block counter of a CoverageInfo slot.
+  static FieldAccess ForCoverageInfoBlockCount(int slot_index);
+
   // Provides access to FeedbackCell fields.
   static FieldAccess ForFeedbackCellInterruptBudget();
 #ifdef V8_ENABLE_LEAPTIERING
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/backend/block-timings.h"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <vector>
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+base::TimeDelta BlockTimings::TotalTime() const {
+  base::TimeDelta total;
+  for (base::TimeDelta timing : timings_) total += timing;
+  return total;
+}
+
+base::TimeDelta BlockTimings::EstimatedParallelTime(int thread_count) const {
+  DCHECK_LT(0, thread_count);
+  std::vector<base::TimeDelta> sorted(timings_.begin(), timings_.end());
+  std::sort(sorted.begin(), sorted.end(), std::greater<>());
+  // Greedily give the next longest block to the least loaded thread.
+  std::vector<base::TimeDelta> loads(thread_count);
+  for (base::TimeDelta timing : sorted) {
+    *std::min_element(loads.begin(), loads.end()) += timing;
+  }
+  return *std::max_element(loads.begin(), loads.end());
+}
+
+void BlockTimings::Print(std::ostream& os, const char* function_name,
+                         const char* phase_name, int thread_count) const {
+  const double total = TotalTime().InMillisecondsF();
+  const double parallel = EstimatedParallelTime(thread_count).InMillisecondsF();
+  const double longest =
+      timings_.empty()
+          ? 0
+          : std::max_element(timings_.begin(), timings_.end())
+                ->InMillisecondsF();
+  if (function_name == nullptr) function_name = "<unknown>";
+  os << std::fixed << std::setprecision(3) << "[block parallelism of "
+     << function_name << ", " << phase_name << ": " << total << " ms in "
+     << block_count() << " blocks, longest block " << longest << " ms, "
+     << parallel << " ms on " << thread_count << " threads (saves "
+     << (total - parallel) << " ms)]" << std::endl;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
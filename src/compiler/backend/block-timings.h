@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BACKEND_BLOCK_TIMINGS_H_
+#define V8_COMPILER_BACKEND_BLOCK_TIMINGS_H_
+
+#include <ostream>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Records how long a backend phase spends on each block of a function. Phases
+// like instruction selection and code generation do most of their work per
+// block, so this estimates how much faster they would be if the blocks were
+// distributed over several threads (see --trace-turbo-block-parallelism).
+class V8_EXPORT_PRIVATE BlockTimings final {
+ public:
+  explicit BlockTimings(Zone* zone) : timings_(zone) {}
+
+  void StartBlock() { timer_.Start(); }
+  void EndBlock() {
+    timings_.push_back(timer_.Elapsed());
+    timer_.Stop();
+  }
+
+  size_t block_count() const { return timings_.size(); }
+
+  // The sum of the times of all blocks.
+  base::TimeDelta TotalTime() const;
+  // The time it would take to process the blocks on {thread_count} threads,
+  // with the longest blocks scheduled first. This doesn't account for the
+  // work needed to stitch the results of the blocks together.
+  base::TimeDelta EstimatedParallelTime(int thread_count) const;
+
+  void Print(std::ostream& os, const char* function_name,
+             const char* phase_name, int thread_count) const;
+
+ private:
+  ZoneVector<base::TimeDelta> timings_;
+  base::ElapsedTimer timer_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BACKEND_BLOCK_TIMINGS_H_
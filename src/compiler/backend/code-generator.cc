@@ -11,6 +11,7 @@
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/backend/block-timings.h"
 #include "src/compiler/backend/code-generator-impl.h"
 #include "src/compiler/globals.h"
 #include "src/compiler/linkage.h"
@@ -296,6 +297,7 @@ void CodeGenerator::AssembleCode() {
   // Assemble instructions in assembly order.
   offsets_info_.blocks_start = masm()->pc_offset();
   for (const InstructionBlock* block : instructions()->ao_blocks()) {
+    if (V8_UNLIKELY(block_timings_)) block_timings_->StartBlock();
     // Align loop headers on vendor recommended boundaries.
     if (block->ShouldAlignLoopHeader()) {
       masm()->LoopHeaderAlign();
@@ -357,6 +359,7 @@ void CodeGenerator::AssembleCode() {
     }
     if (result_ != kSuccess) return;
     unwinding_info_writer_.EndInstructionBlock(block);
+    if (V8_UNLIKELY(block_timings_)) block_timings_->EndBlock();
   }
 
   // Assemble all out-of-line code.
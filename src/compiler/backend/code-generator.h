@@ -27,6 +27,7 @@
 namespace v8::internal::compiler {
 
 // Forward declarations.
+class BlockTimings;
 class DeoptimizationExit;
 class FrameAccessState;
 class Linkage;
@@ -90,6 +91,11 @@ class V8_EXPORT_PRIVATE CodeGenerator final : public GapResolver::Assembler {
   void AssembleCode();  // Does not need to run on main thread.
   MaybeHandle<Code> FinalizeCode();
 
+  // If set, AssembleCode records the time spent on each block.
+  void set_block_timings(BlockTimings* block_timings) {
+    block_timings_ = block_timings;
+  }
+
 #if V8_ENABLE_WEBASSEMBLY
   base::OwnedVector<uint8_t> GenerateWasmDeoptimizationData();
 #endif
@@ -398,6 +404,7 @@ class V8_EXPORT_PRIVATE CodeGenerator final : public GapResolver::Assembler {
   Label* const labels_;
   Label return_label_;
   RpoNumber current_block_;
+  BlockTimings* block_timings_ = nullptr;
   SourcePosition start_source_position_;
   SourcePosition current_source_position_;
   MacroAssembler masm_;
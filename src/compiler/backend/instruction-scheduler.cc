@@ -4,23 +4,122 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <optional>
 
+#include "src/base/cpu.h"
 #include "src/base/iterator.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/compiler/backend/instruction-codes.h"
+#include "src/execution/isolate.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Issues one instruction per cycle, using the latencies of the opcodes only.
+constexpr SchedulerMachineModel kGenericMachineModel = {
+    "generic", 1, {1, 1, 1, 1}, 0};
+
+// The models only describe the resources that matter most for the scheduler:
+// the number of ALU, divider, load and store ports, and the load-to-use
+// latency of L1 hits.
+#if V8_TARGET_ARCH_X64
+constexpr SchedulerMachineModel kMachineModels[] = {
+    kGenericMachineModel,
+    // Skylake to Golden Cove.
+    {"intel-core", 4, {4, 1, 2, 1}, 5},
+    // Zen and later.
+    {"amd-zen", 4, {4, 1, 3, 2}, 4},
+};
+#elif V8_TARGET_ARCH_ARM64
+constexpr SchedulerMachineModel kMachineModels[] = {
+    kGenericMachineModel,
+    {"neoverse-n1", 4, {3, 1, 2, 2}, 4},
+    {"neoverse-n2", 5, {4, 1, 3, 2}, 4},
+    {"neoverse-v1", 8, {4, 1, 3, 2}, 4},
+};
+#else
+constexpr SchedulerMachineModel kMachineModels[] = {kGenericMachineModel};
+#endif
+
+// Instructions with a longer latency than this, i.e. divisions, square roots
+// and the like, are assumed not to be pipelined.
+constexpr int kUnpipelinedLatency = 12;
+
+const SchedulerMachineModel* DetectHostMachineModel() {
+#if !defined(USE_SIMULATOR) && V8_TARGET_ARCH_X64
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 6) {
+    return InstructionScheduler::FindMachineModel("intel-core");
+  }
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+      cpu.family() + cpu.ext_family() >= 0x17) {
+    return InstructionScheduler::FindMachineModel("amd-zen");
+  }
+#elif !defined(USE_SIMULATOR) && V8_TARGET_ARCH_ARM64
+  base::CPU cpu;
+  if (cpu.implementer() == base::CPU::kArm) {
+    switch (cpu.part()) {
+      case base::CPU::kArmNeoverseN1:
+        return InstructionScheduler::FindMachineModel("neoverse-n1");
+      case base::CPU::kArmNeoverseN2:
+        return InstructionScheduler::FindMachineModel("neoverse-n2");
+      case base::CPU::kArmNeoverseV1:
+      case base::CPU::kArmNeoverseV2:
+        return InstructionScheduler::FindMachineModel("neoverse-v1");
+      default:
+        break;
+    }
+  }
+#endif
+  return &kGenericMachineModel;
+}
+
+const SchedulerMachineModel& SelectMachineModel(Isolate* isolate) {
+  // Keep the snapshot independent of the machine that builds it.
+  if (isolate != nullptr && isolate->serializer_enabled()) {
+    return kGenericMachineModel;
+  }
+  const char* name = v8_flags.turbo_instruction_scheduling_cpu;
+  if (strcmp(name, "auto") == 0) {
+    static const SchedulerMachineModel* host_model = DetectHostMachineModel();
+    return *host_model;
+  }
+  const SchedulerMachineModel* model =
+      InstructionScheduler::FindMachineModel(name);
+  if (model == nullptr) {
+    FATAL("Unknown --turbo-instruction-scheduling-cpu: %s", name);
+  }
+  return *model;
+}
+
+}  // namespace
+
+// static
+const SchedulerMachineModel* InstructionScheduler::FindMachineModel(
+    const char* name) {
+  for (const SchedulerMachineModel& model : kMachineModels) {
+    if (strcmp(model.name, name) == 0) return &model;
+  }
+  return nullptr;
+}
+
 void InstructionScheduler::SchedulingQueueBase::AddNode(
     ScheduleGraphNode* node) {
   // We keep the ready list sorted by total latency so that we can quickly find
-  // the next best candidate to schedule.
+  // the next best candidate to schedule. In loops, loads go before the other
+  // nodes with the same total latency.
+  bool prefer_node = scheduler_->prefer_loads_ && node->is_load();
   auto it = nodes_.begin();
   while ((it != nodes_.end()) &&
-         ((*it)->total_latency() >= node->total_latency())) {
+         ((*it)->total_latency() > node->total_latency() ||
+          ((*it)->total_latency() == node->total_latency() &&
+           !(prefer_node && !(*it)->is_load())))) {
     ++it;
   }
   nodes_.insert(it, node);
@@ -31,8 +130,10 @@ InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
   auto candidate = nodes_.end();
   for (auto iterator = nodes_.begin(); iterator != nodes_.end(); ++iterator) {
-    // We only consider instructions that have all their operands ready.
-    if (cycle >= (*iterator)->start_cycle()) {
+    // We only consider instructions that have all their operands ready, and
+    // for which a port is available.
+    if (cycle >= (*iterator)->start_cycle() &&
+        scheduler_->HasFreePort(*iterator)) {
       candidate = iterator;
       break;
     }
@@ -59,12 +160,14 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
   return result;
 }
 
-InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
-                                                           Instruction* instr)
+InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(
+    Zone* zone, Instruction* instr, int latency,
+    SchedulerMachineModel::PortKind port_kind)
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
-      latency_(GetInstructionLatency(instr)),
+      latency_(latency),
+      port_kind_(port_kind),
       total_latency_(-1),
       start_cycle_(-1) {}
 
@@ -83,7 +186,8 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
       last_deopt_or_trap_(nullptr),
-      operands_map_(zone) {
+      operands_map_(zone),
+      machine_model_(SelectMachineModel(sequence->isolate())) {
   if (v8_flags.turbo_stress_instruction_scheduling) {
     random_number_generator_ =
         std::optional<base::RandomNumberGenerator>(v8_flags.random_seed);
@@ -97,9 +201,38 @@ void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK_NULL(last_live_in_reg_marker_);
   DCHECK_NULL(last_deopt_or_trap_);
   DCHECK(operands_map_.empty());
+  const InstructionBlock* block = sequence()->InstructionBlockAt(rpo);
+  prefer_loads_ = block->IsLoopHeader() || block->loop_header().IsValid();
   sequence()->StartBlock(rpo);
 }
 
+InstructionScheduler::ScheduleGraphNode* InstructionScheduler::NewNode(
+    Instruction* instr) {
+  int latency = GetInstructionLatency(instr);
+  SchedulerMachineModel::PortKind port_kind = SchedulerMachineModel::kAluPort;
+  int flags = GetInstructionFlags(instr);
+  if (flags & kIsLoadOperation) {
+    port_kind = SchedulerMachineModel::kLoadPort;
+    latency = std::max(latency, machine_model_.load_latency);
+  } else if (flags & kHasSideEffect) {
+    port_kind = SchedulerMachineModel::kStorePort;
+  } else if (latency > kUnpipelinedLatency) {
+    port_kind = SchedulerMachineModel::kDividerPort;
+  }
+  return zone()->New<ScheduleGraphNode>(zone(), instr, latency, port_kind);
+}
+
+void InstructionScheduler::StartCycle() {
+  issued_in_cycle_ = 0;
+  std::fill(std::begin(port_usage_), std::end(port_usage_), 0);
+}
+
+bool InstructionScheduler::IssueInstruction(const ScheduleGraphNode* node) {
+  issued_in_cycle_++;
+  port_usage_[node->port_kind()]++;
+  return issued_in_cycle_ < machine_model_.issue_width;
+}
+
 void InstructionScheduler::EndBlock(RpoNumber rpo) {
   if (v8_flags.turbo_stress_instruction_scheduling) {
     Schedule<StressSchedulerQueue>();
@@ -110,7 +243,7 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::AddTerminator(Instruction* instr) {
-  ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
+  ScheduleGraphNode* new_node = NewNode(instr);
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
   for (ScheduleGraphNode* node : graph_) {
@@ -130,7 +263,7 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
     return;
   }
 
-  ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
+  ScheduleGraphNode* new_node = NewNode(instr);
 
   // We should not have branches in the middle of a block.
   DCHECK_NE(instr->flags_mode(), kFlags_branch);
@@ -226,6 +359,7 @@ void InstructionScheduler::Schedule() {
 
   // Go through the ready list and schedule the instructions.
   int cycle = 0;
+  StartCycle();
   while (!ready_list.IsEmpty()) {
     ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
 
@@ -241,9 +375,13 @@ void InstructionScheduler::Schedule() {
           ready_list.AddNode(successor);
         }
       }
+
+      // Try to start more instructions in the same cycle.
+      if (IssueInstruction(candidate)) continue;
     }
 
     cycle++;
+    StartCycle();
   }
 
   // Reset own state.
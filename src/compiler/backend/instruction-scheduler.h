@@ -32,6 +32,29 @@ enum ArchOpcodeFlags {
                    // across such an instruction.
 };
 
+// A coarse model of the core that the scheduler targets. It determines how many
+// instructions can start in the same cycle, depending on the execution ports
+// they need, and the load-to-use latency of L1 hits. The model is selected
+// from the host CPU, or with --turbo-instruction-scheduling-cpu.
+struct SchedulerMachineModel {
+  enum PortKind {
+    kAluPort,
+    kDividerPort,
+    kLoadPort,
+    kStorePort,
+    kPortKindCount
+  };
+
+  const char* name;
+  // The number of instructions that can start in the same cycle.
+  int issue_width;
+  // The number of instructions of each port kind that can start in the same
+  // cycle.
+  int ports[kPortKindCount];
+  // The latency of loads, or 0 to only use the latencies of the opcodes.
+  int load_latency;
+};
+
 class InstructionScheduler final : public ZoneObject {
  public:
   V8_EXPORT_PRIVATE InstructionScheduler(Zone* zone,
@@ -45,12 +68,20 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Returns the machine model with the given name, or nullptr if there is no
+  // such model for the target architecture.
+  V8_EXPORT_PRIVATE static const SchedulerMachineModel* FindMachineModel(
+      const char* name);
+
+  const SchedulerMachineModel& machine_model() const { return machine_model_; }
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode : public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency,
+                      SchedulerMachineModel::PortKind port_kind);
 
     // Mark the instruction represented by 'node' as a dependency of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -71,6 +102,10 @@ class InstructionScheduler final : public ZoneObject {
     Instruction* instruction() { return instr_; }
     ZoneDeque<ScheduleGraphNode*>& successors() { return successors_; }
     int latency() const { return latency_; }
+    SchedulerMachineModel::PortKind port_kind() const { return port_kind_; }
+    bool is_load() const {
+      return port_kind_ == SchedulerMachineModel::kLoadPort;
+    }
 
     int total_latency() const { return total_latency_; }
     void set_total_latency(int latency) { total_latency_ = latency; }
@@ -89,6 +124,9 @@ class InstructionScheduler final : public ZoneObject {
     // instruction to complete).
     int latency_;
 
+    // The kind of execution port that the instruction needs.
+    SchedulerMachineModel::PortKind port_kind_;
+
     // The sum of all the latencies on the path from this node to the end of
     // the graph (i.e. a node with no successor).
     int total_latency_;
@@ -120,7 +158,8 @@ class InstructionScheduler final : public ZoneObject {
 
   // A scheduling queue which prioritize nodes on the critical path (we look
   // for the instruction with the highest latency on the path to reach the end
-  // of the graph).
+  // of the graph). Only instructions for which the machine model still has a
+  // free port in the current cycle are candidates.
   class CriticalPathFirstQueue : public SchedulingQueueBase {
    public:
     explicit CriticalPathFirstQueue(InstructionScheduler* scheduler)
@@ -209,6 +248,19 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  ScheduleGraphNode* NewNode(Instruction* instr);
+
+  // Keep track of the instructions that started in the current cycle of
+  // Schedule().
+  void StartCycle();
+  bool HasFreePort(const ScheduleGraphNode* node) const {
+    return port_usage_[node->port_kind()] <
+           machine_model_.ports[node->port_kind()];
+  }
+  // Records that {node} starts in the current cycle, and returns whether
+  // other instructions can still start in the same cycle.
+  bool IssueInstruction(const ScheduleGraphNode* node);
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   base::RandomNumberGenerator* random_number_generator() {
@@ -245,6 +297,16 @@ class InstructionScheduler final : public ZoneObject {
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
   std::optional<base::RandomNumberGenerator> random_number_generator_;
+
+  const SchedulerMachineModel& machine_model_;
+
+  // Whether the current block is part of a loop, in which case loads go first
+  // among the instructions on equally long paths, so that their latency is
+  // hidden by independent instructions.
+  bool prefer_loads_ = false;
+
+  int issued_in_cycle_ = 0;
+  int port_usage_[SchedulerMachineModel::kPortKindCount] = {};
 };
 
 }  // namespace compiler
@@ -12,6 +12,7 @@
 #include "src/codegen/machine-type.h"
 #include "src/codegen/tick-counter.h"
 #include "src/common/globals.h"
+#include "src/compiler/backend/block-timings.h"
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction.h"
 #include "src/compiler/common-operator.h"
@@ -146,7 +147,9 @@ InstructionSelectorT<Adapter>::SelectInstructions() {
 
   // Visit each basic block in post order.
   for (auto i = blocks.rbegin(); i != blocks.rend(); ++i) {
+    if (V8_UNLIKELY(block_timings_)) block_timings_->StartBlock();
     VisitBlock(*i);
+    if (V8_UNLIKELY(block_timings_)) block_timings_->EndBlock();
     if (instruction_selection_failed())
       return BailoutReason::kCodeGenerationFailed;
   }
@@ -4520,6 +4523,10 @@ void InstructionSelectorT<TurbofanAdapter>::VisitNode(Node* node) {
       return MarkAsSimd256(node), VisitF32x8Sqrt(node);
     case IrOpcode::kF64x4Sqrt:
       return MarkAsSimd256(node), VisitF64x4Sqrt(node);
+    case IrOpcode::kF64x4Abs:
+      return MarkAsSimd256(node), VisitF64x4Abs(node);
+    case IrOpcode::kF64x4Neg:
+      return MarkAsSimd256(node), VisitF64x4Neg(node);
     case IrOpcode::kI32x8Abs:
       return MarkAsSimd256(node), VisitI32x8Abs(node);
     case IrOpcode::kI32x8Neg:
@@ -6095,6 +6102,10 @@ std::optional<BailoutReason> InstructionSelector::SelectInstructions() {
   DISPATCH_TO_IMPL(SelectInstructions())
 }
 
+void InstructionSelector::set_block_timings(BlockTimings* block_timings) {
+  DISPATCH_TO_IMPL(set_block_timings(block_timings))
+}
+
 bool InstructionSelector::IsSupported(CpuFeature feature) const {
   DISPATCH_TO_IMPL(IsSupported(feature))
 }
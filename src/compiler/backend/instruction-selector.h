@@ -38,6 +38,7 @@ namespace compiler {
 
 // Forward declarations.
 class BasicBlock;
+class BlockTimings;
 template <typename Adapter>
 struct CallBufferT;  // TODO(bmeurer): Remove this.
 template <typename Adapter>
@@ -114,6 +115,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
 
   std::optional<BailoutReason> SelectInstructions();
 
+  // If set, SelectInstructions records the time spent on each block.
+  void set_block_timings(BlockTimings* block_timings);
+
   bool IsSupported(CpuFeature feature) const;
 
   // Returns the features supported on the target platform.
@@ -495,6 +499,10 @@ class InstructionSelectorT final : public Adapter {
   // Visit code for the entire graph with the included schedule.
   std::optional<BailoutReason> SelectInstructions();
 
+  void set_block_timings(BlockTimings* block_timings) {
+    block_timings_ = block_timings;
+  }
+
   void StartBlock(RpoNumber rpo);
   void EndBlock(RpoNumber rpo);
   void AddInstruction(Instruction* instr);
@@ -1270,6 +1278,7 @@ class InstructionSelectorT final : public Adapter {
   bool instruction_selection_failed_;
   ZoneVector<std::pair<int, int>> instr_origins_;
   InstructionSelector::EnableTraceTurboJson trace_turbo_;
+  BlockTimings* block_timings_ = nullptr;
   TickCounter* const tick_counter_;
   // The broker is only used for unparking the LocalHeap for diagnostic printing
   // for failed StaticAsserts.
@@ -1196,7 +1196,8 @@ RegisterAllocationData::RegisterAllocationData(
       spill_state_(code->InstructionBlockCount(), ZoneVector<LiveRange*>(zone),
                    zone),
       tick_counter_(tick_counter),
-      slot_for_const_range_(zone) {
+      slot_for_const_range_(zone),
+      is_fast_mode_(ShouldUseFastMode(code)) {
   if (kFPAliasing == AliasingKind::kCombine) {
     fixed_float_live_ranges_.resize(
         kNumberOfFixedRangesPerRegister * this->config()->num_float_registers(),
@@ -1237,6 +1238,14 @@ RegisterAllocationData::RegisterAllocationData(
   this->frame()->SetAllocatedDoubleRegisters(assigned_double_registers_);
 }
 
+// static
+bool RegisterAllocationData::ShouldUseFastMode(
+    const InstructionSequence* code) {
+  int threshold = v8_flags.turbo_fast_register_allocation_threshold;
+  return threshold > 0 &&
+         code->instructions().size() >= static_cast<size_t>(threshold);
+}
+
 MoveOperands* RegisterAllocationData::AddGapMove(
     int index, Instruction::GapPosition position,
     const InstructionOperand& from, const InstructionOperand& to) {
@@ -3732,6 +3741,17 @@ void LinearScanAllocator::AllocateRegisters() {
                 current_block->rpo_number().ToInt());
           no_change_required =
               pick_state_from(current_block->predecessors()[0], to_be_live);
+        } else if (data()->is_fast_mode()) {
+          // Don't try to find the best state for the merge, but simply take
+          // the state of the first predecessor that was already allocated.
+          RpoNumber chosen_predecessor = current_block->predecessors()[0];
+          for (RpoNumber pred : current_block->predecessors()) {
+            if (ConsiderBlockForControlFlow(current_block, pred)) {
+              chosen_predecessor = pred;
+              break;
+            }
+          }
+          no_change_required = pick_state_from(chosen_predecessor, to_be_live);
         } else if (current_block->PredecessorCount() == 2) {
           TRACE("Two predecessors for B%d\n",
                 current_block->rpo_number().ToInt());
@@ -3781,8 +3801,12 @@ void LinearScanAllocator::AllocateRegisters() {
     // Now we can erase current, as we are sure to process it.
     unhandled_live_ranges().erase(unhandled_live_ranges().begin());
 
-    if (current->IsTopLevel() && TryReuseSpillForPhi(current->TopLevel()))
+    // Reusing the spill slot of the inputs relies on the live range bundles,
+    // which are not built in fast mode.
+    if (current->IsTopLevel() && !data()->is_fast_mode() &&
+        TryReuseSpillForPhi(current->TopLevel())) {
       continue;
+    }
 
     ForwardStateTo(position);
 
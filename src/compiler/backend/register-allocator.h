@@ -286,6 +286,14 @@ class RegisterAllocationData final : public ZoneObject {
   const char* debug_name() const { return debug_name_; }
   const RegisterConfiguration* config() const { return config_; }
 
+  // In fast mode, which is used for very large functions, the allocator
+  // trades code quality for compile time: live ranges are not bundled, the
+  // state at control flow merges is taken from a single predecessor, and
+  // phis don't reuse the spill slots of their inputs. The pipeline also skips
+  // move optimization.
+  static bool ShouldUseFastMode(const InstructionSequence* code);
+  bool is_fast_mode() const { return is_fast_mode_; }
+
   MachineRepresentation RepresentationFor(int virtual_register);
 
   TopLevelLiveRange* GetLiveRangeFor(int index);
@@ -366,6 +374,7 @@ class RegisterAllocationData final : public ZoneObject {
   ZoneVector<ZoneVector<LiveRange*>> spill_state_;
   TickCounter* const tick_counter_;
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*> slot_for_const_range_;
+  const bool is_fast_mode_;
 };
 
 // Representation of the non-empty interval [start,end[.
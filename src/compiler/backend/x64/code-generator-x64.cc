@@ -2796,7 +2796,20 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
           }
           case kL64: {
             // F64x4Abs
-            UNIMPLEMENTED();
+            YMMRegister dst = i.OutputSimd256Register();
+            YMMRegister src = i.InputSimd256Register(0);
+            CpuFeatureScope avx_scope(masm(), AVX2);
+            if (dst == src) {
+              __ vpcmpeqd(kScratchSimd256Reg, kScratchSimd256Reg,
+                          kScratchSimd256Reg);
+              __ vpsrlq(kScratchSimd256Reg, kScratchSimd256Reg, uint8_t{1});
+              __ vpand(dst, dst, kScratchSimd256Reg);
+            } else {
+              __ vpcmpeqd(dst, dst, dst);
+              __ vpsrlq(dst, dst, uint8_t{1});
+              __ vpand(dst, dst, src);
+            }
+            break;
           }
           default:
             UNREACHABLE();
@@ -2859,7 +2872,20 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
           }
           case kL64: {
             // F64x4Neg
-            UNIMPLEMENTED();
+            YMMRegister dst = i.OutputSimd256Register();
+            YMMRegister src = i.InputSimd256Register(0);
+            CpuFeatureScope avx_scope(masm(), AVX2);
+            if (dst == src) {
+              __ vpcmpeqd(kScratchSimd256Reg, kScratchSimd256Reg,
+                          kScratchSimd256Reg);
+              __ vpsllq(kScratchSimd256Reg, kScratchSimd256Reg, uint8_t{63});
+              __ vpxor(dst, dst, kScratchSimd256Reg);
+            } else {
+              __ vpcmpeqd(dst, dst, dst);
+              __ vpsllq(dst, dst, uint8_t{63});
+              __ vpxor(dst, dst, src);
+            }
+            break;
           }
           default:
             UNREACHABLE();
@@ -5057,7 +5083,7 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
           case kL64: {
             // I64x4Ne
             __ vpcmpeqq(dst, dst, i.InputSimd256Register(1));
-            __ vpcmpeqq(kScratchSimd256Reg, kScratchSimd256Reg,
+            __ vpcmpeqd(kScratchSimd256Reg, kScratchSimd256Reg,
                         kScratchSimd256Reg);
             __ vpxor(dst, dst, kScratchSimd256Reg);
             break;
@@ -5197,7 +5223,7 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
             // I64x4GeS
             __ vpcmpgtq(dst, i.InputSimd256Register(1),
                         i.InputSimd256Register(0));
-            __ vpcmpeqq(kScratchSimd256Reg, kScratchSimd256Reg,
+            __ vpcmpeqd(kScratchSimd256Reg, kScratchSimd256Reg,
                         kScratchSimd256Reg);
             __ vpxor(dst, dst, kScratchSimd256Reg);
             break;
@@ -10,6 +10,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/codegen/tick-counter.h"
 #include "src/common/assert-scope.h"
+#include "src/compiler/access-builder.h"
 #include "src/compiler/bytecode-analysis.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
@@ -22,6 +23,7 @@
 #include "src/compiler/operator-properties.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/state-values-utils.h"
+#include "src/debug/debug.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags-and-tokens.h"
 #include "src/interpreter/bytecode-register.h"
@@ -318,6 +320,7 @@ class BytecodeGraphBuilder {
   // Helpers for building the implicit FunctionEntry and IterationBody
   // StackChecks.
   void BuildFunctionEntryStackCheck();
+  void BuildBreakpointEntryCheck();
   void BuildIterationBodyStackCheck();
   void BuildOSREntryStackCheck();
 
@@ -471,6 +474,7 @@ class BytecodeGraphBuilder {
   int currently_peeled_loop_offset_;
 
   const bool skip_first_stack_and_tierup_check_;
+  bool breakpoint_entry_check_built_ = false;
 
   // Merge environments are snapshots of the environment at points where the
   // control flow merges. This models a forward data flow propagation of all
@@ -1356,6 +1360,23 @@ void BytecodeGraphBuilder::BuildFunctionEntryStackCheck() {
   }
 }
 
+void BytecodeGraphBuilder::BuildBreakpointEntryCheck() {
+  // Deoptimize before the first bytecode if the function has been prepared
+  // for debugging since this code was compiled.
+  breakpoint_entry_check_built_ = true;
+  PrepareEagerCheckpoint();
+  Address check_address =
+      broker()->isolate()->debug()->BreakpointEntryCheckAddress(
+          *shared_info().object());
+  Node* is_set = NewNode(
+      simplified()->LoadField(AccessBuilder::ForExternalUint8Value()),
+      jsgraph()->ExternalConstant(
+          ExternalReference::FromRawAddress(check_address)));
+  Node* is_not_set =
+      NewNode(simplified()->NumberEqual(), is_set, jsgraph()->ZeroConstant());
+  NewNode(simplified()->CheckIf(DeoptimizeReason::kBreakpointSet), is_not_set);
+}
+
 void BytecodeGraphBuilder::BuildIterationBodyStackCheck() {
   Node* node =
       NewNode(javascript()->StackCheck(StackCheckKind::kJSIterationBody));
@@ -1461,6 +1482,10 @@ void BytecodeGraphBuilder::VisitSingleBytecode() {
 
   if (environment() != nullptr) {
     BuildLoopHeaderEnvironment(current_offset);
+    if (V8_UNLIKELY(v8_flags.breakpoint_entry_checks) &&
+        !breakpoint_entry_check_built_) {
+      BuildBreakpointEntryCheck();
+    }
 
     switch (bytecode_iterator().current_bytecode()) {
 #define BYTECODE_CASE(name, ...)       \
@@ -2029,6 +2054,11 @@ void BytecodeGraphBuilder::VisitGetNamedProperty() {
   environment()->BindAccumulator(node, Environment::kAttachFrameState);
 }
 
+void BytecodeGraphBuilder::VisitStarGetNamedProperty() {
+  VisitStar();
+  VisitGetNamedProperty();
+}
+
 void BytecodeGraphBuilder::VisitGetNamedPropertyFromSuper() {
   PrepareEagerCheckpoint();
   Node* receiver =
@@ -3719,9 +3749,29 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 
 void BytecodeGraphBuilder::VisitIncBlockCounter() {
+  int slot_index = bytecode_iterator().GetIndexOperand(0);
+  if (v8_flags.inline_block_coverage_counters) {
+    // Bump the counter in place, which avoids the builtin call and the C call
+    // it makes to look up the coverage info. The coverage info is embedded in
+    // the code; switching coverage modes deoptimizes all functions first.
+    if (OptionalHeapObjectRef coverage_info =
+            shared_info().coverage_info(broker())) {
+      FieldAccess access =
+          AccessBuilder::ForCoverageInfoBlockCount(slot_index);
+      Node* object = jsgraph()->ConstantNoHole(*coverage_info, broker());
+      Node* count = jsgraph()->OneConstant();
+      if (!v8_flags.block_coverage_first_execution_only) {
+        count = NewNode(simplified()->NumberAdd(),
+                        NewNode(simplified()->LoadField(access), object),
+                        count);
+      }
+      NewNode(simplified()->StoreField(access), object, count);
+      return;
+    }
+  }
+
   Node* closure = GetFunctionClosure();
-  Node* coverage_array_slot =
-      jsgraph()->ConstantNoHole(bytecode_iterator().GetIndexOperand(0));
+  Node* coverage_array_slot = jsgraph()->ConstantNoHole(slot_index);
 
   // Lowered by js-intrinsic-lowering to call Builtin::kIncBlockCounter.
   const Operator* op =
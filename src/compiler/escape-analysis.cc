@@ -868,7 +868,11 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         if (Node* receiver = it.node()) {
           current->SetEscaped(receiver);
         }
-        current->SetEscaped(frame_state.function());
+        // Virtual closures are materialized when the stack trace is computed,
+        // which deoptimizes the function.
+        if (!v8_flags.turbo_escape_analysis_closures) {
+          current->SetEscaped(frame_state.function());
+        }
       }
       break;
     }
@@ -87,6 +87,11 @@ OverloadsResolutionResult ResolveOverloads(
         DCHECK_LT(index_of_func_with_js_array_arg, 0);
         index_of_func_with_js_array_arg = static_cast<int>(i);
       } else if (sequence_type == CTypeInfo::SequenceType::kIsTypedArray) {
+        // Overloads on a generic ArrayBufferView are not supported, see the
+        // comment on FastApiArrayBufferView.
+        if (type_info.GetType() == CTypeInfo::Type::kVoid) {
+          return OverloadsResolutionResult::Invalid();
+        }
         DCHECK_LT(index_of_func_with_typed_array_arg, 0);
         index_of_func_with_typed_array_arg = static_cast<int>(i);
         element_type = type_info.GetType();
@@ -1734,6 +1734,21 @@ bool SharedFunctionInfoRef::HasBreakInfo(JSHeapBroker* broker) const {
   }
 }
 
+OptionalHeapObjectRef SharedFunctionInfoRef::coverage_info(
+    JSHeapBroker* broker) const {
+  if (broker->IsMainThread()) {
+    if (!object()->HasCoverageInfo(broker->isolate())) return {};
+    return TryMakeRef<HeapObject>(
+        broker, object()->GetCoverageInfo(broker->isolate()));
+  }
+  LocalIsolate* local_isolate = broker->local_isolate();
+  SharedMutexGuardIfOffThread<LocalIsolate, base::kShared> mutex_guard(
+      local_isolate->shared_function_info_access(), local_isolate);
+  Isolate* isolate = local_isolate->GetMainThreadIsolateUnsafe();
+  if (!object()->HasCoverageInfo(isolate)) return {};
+  return TryMakeRef<HeapObject>(broker, object()->GetCoverageInfo(isolate));
+}
+
 SharedFunctionInfo::Inlineability SharedFunctionInfoRef::GetInlineability(
     JSHeapBroker* broker) const {
   return broker->IsMainThread()
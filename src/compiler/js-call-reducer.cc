@@ -3392,7 +3392,7 @@ Reduction JSCallReducer::ReduceReflectGet(Node* node) {
   JSCallNode n(node);
   CallParameters const& p = n.Parameters();
   int arity = p.arity_without_implicit_args();
-  if (arity != 2) return NoChange();
+  if (arity != 2 && arity != 3) return NoChange();
   Node* target = n.Argument(0);
   Node* key = n.Argument(1);
   Node* context = n.context();
@@ -3417,11 +3417,13 @@ Reduction JSCallReducer::ReduceReflectGet(Node* node) {
         frame_state, efalse, if_false);
   }
 
-  // Otherwise just use the existing GetPropertyStub.
+  // Otherwise just use the existing GetPropertyStub, or the
+  // GetPropertyWithReceiver stub when a receiver is passed, like in the get
+  // traps of proxy handlers.
   Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
   Node* etrue = effect;
   Node* vtrue;
-  {
+  if (arity == 2) {
     Callable callable = Builtins::CallableFor(isolate(), Builtin::kGetProperty);
     auto call_descriptor = Linkage::GetStubCallDescriptor(
         graph()->zone(), callable.descriptor(),
@@ -3431,6 +3433,20 @@ Reduction JSCallReducer::ReduceReflectGet(Node* node) {
     vtrue = etrue = if_true =
         graph()->NewNode(common()->Call(call_descriptor), stub_code, target,
                          key, context, frame_state, etrue, if_true);
+  } else {
+    Node* receiver = n.Argument(2);
+    Callable callable =
+        Builtins::CallableFor(isolate(), Builtin::kGetPropertyWithReceiver);
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(),
+        CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+    Node* stub_code = jsgraph()->HeapConstantNoHole(callable.code());
+    Node* on_non_existent = jsgraph()->SmiConstant(
+        static_cast<int>(OnNonExistent::kReturnUndefined));
+    vtrue = etrue = if_true = graph()->NewNode(
+        common()->Call(call_descriptor), stub_code, target, key, receiver,
+        on_non_existent, context, frame_state, etrue, if_true);
   }
 
   // Rewire potential exception edges.
@@ -1145,6 +1145,8 @@
   V(F64x4Max)                      \
   V(F64x4Add)                      \
   V(F64x4Sqrt)                     \
+  V(F64x4Abs)                      \
+  V(F64x4Neg)                      \
   V(F32x8Add)                      \
   V(I64x4Add)                      \
   V(I32x8Add)                      \
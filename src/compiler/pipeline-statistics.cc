@@ -7,6 +7,8 @@
 #include <memory>
 
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/backend/instruction.h"
+#include "src/compiler/frame.h"
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/zone-stats.h"
 #include "src/objects/shared-function-info.h"
@@ -94,6 +96,12 @@ void PipelineStatisticsBase::EndPhaseKind(
   compilation_stats_->RecordPhaseKindStats(phase_kind_name_, *diff);
 }
 
+void PipelineStatisticsBase::RecordRegisterAllocationStats(
+    bool fast_mode,
+    const CompilationStatistics::RegisterAllocationStats& stats) {
+  compilation_stats_->RecordRegisterAllocationStats(fast_mode, stats);
+}
+
 void PipelineStatisticsBase::BeginPhase(const char* phase_name) {
   DCHECK(InPhaseKind());
   phase_name_ = phase_name;
@@ -151,6 +159,26 @@ void TurbofanPipelineStatistics::EndPhase() {
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
+void TurbofanPipelineStatistics::RecordRegisterAllocationStats(
+    bool fast_mode, const InstructionSequence* code, const Frame* frame) {
+  CompilationStatistics::RegisterAllocationStats stats;
+  stats.function_count_ = 1;
+  stats.instruction_count_ = code->instructions().size();
+  for (const Instruction* instr : code->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; i++) {
+      const ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (const MoveOperands* move : *moves) {
+        if (!move->IsRedundant()) stats.gap_move_count_++;
+      }
+    }
+  }
+  stats.spill_slot_count_ = frame->GetSpillSlotCount();
+  Base::RecordRegisterAllocationStats(fast_mode, stats);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
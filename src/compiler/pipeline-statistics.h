@@ -19,6 +19,8 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+class Frame;
+class InstructionSequence;
 class PhaseScope;
 
 class PipelineStatisticsBase {
@@ -33,6 +35,9 @@ class PipelineStatisticsBase {
 
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind(CompilationStatistics::BasicStats* diff);
+  void RecordRegisterAllocationStats(
+      bool fast_mode,
+      const CompilationStatistics::RegisterAllocationStats& stats);
 
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
@@ -57,7 +62,9 @@ class PipelineStatisticsBase {
 
   bool InPhaseKind() { return !!phase_kind_stats_.scope_; }
 
-  friend class PhaseScope;
+  friend class Frame;
+class InstructionSequence;
+class PhaseScope;
   bool InPhase() { return !!phase_stats_.scope_; }
   void BeginPhase(const char* name);
   void EndPhase(CompilationStatistics::BasicStats* diff);
@@ -110,6 +117,11 @@ class TurbofanPipelineStatistics : public PipelineStatisticsBase,
   void EndPhaseKind();
   void BeginPhase(const char* name);
   void EndPhase();
+
+  // Records the gap moves and spill slots of the allocated {code}.
+  void RecordRegisterAllocationStats(bool fast_mode,
+                                     const InstructionSequence* code,
+                                     const Frame* frame);
 };
 
 class V8_NODISCARD PhaseScope {
@@ -3994,7 +3994,10 @@ bool PipelineImpl::AllocateRegisters(CallDescriptor* call_descriptor,
   TFPipelineData* data = this->data_;
   DCHECK_NOT_NULL(data->sequence());
 
-  data->BeginPhaseKind("V8.TFRegisterAllocation");
+  data->BeginPhaseKind(
+      RegisterAllocationData::ShouldUseFastMode(data->sequence())
+          ? "V8.TFFastRegisterAllocation"
+          : "V8.TFRegisterAllocation");
 
   bool run_verifier = v8_flags.turbo_verify_allocation;
 
@@ -4213,7 +4216,10 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
-  Run<BuildBundlesPhase>();
+  bool fast_mode = data->register_allocation_data()->is_fast_mode();
+  if (!fast_mode) {
+    Run<BuildBundlesPhase>();
+  }
 
   TraceSequence(info(), data, "before register allocation");
   if (verifier != nullptr) {
@@ -4256,10 +4262,15 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   Run<PopulateReferenceMapsPhase>();
 
-  if (v8_flags.turbo_move_optimization) {
+  if (v8_flags.turbo_move_optimization && !fast_mode) {
     Run<OptimizeMovesPhase>();
   }
 
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordRegisterAllocationStats(
+        fast_mode, data->sequence(), data->frame());
+  }
+
   TraceSequence(info(), data, "after register allocation");
 
   if (verifier != nullptr) {
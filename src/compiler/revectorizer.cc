@@ -94,6 +94,8 @@ namespace {
   V(I32x4Neg, I32x8Neg)                     \
   V(I16x8Neg, I16x16Neg)                    \
   V(I8x16Neg, I8x32Neg)                     \
+  V(F64x2Abs, F64x4Abs)                     \
+  V(F64x2Neg, F64x4Neg)                     \
   V(F64x2Sqrt, F64x4Sqrt)                   \
   V(F32x4Sqrt, F32x8Sqrt)                   \
   V(F64x2Min, F64x4Min)                     \
@@ -1993,12 +1993,10 @@ class RepresentationSelector {
         CHECK_EQ(type.GetType(), CTypeInfo::Type::kVoid);
         return UseInfo::AnyTagged();
       }
-      case CTypeInfo::SequenceType::kIsTypedArray: {
+      case CTypeInfo::SequenceType::kIsTypedArray:
+      case CTypeInfo::SequenceType::kIsArrayBuffer: {
         return UseInfo::AnyTagged();
       }
-      default: {
-        UNREACHABLE();  // TODO(mslekova): Implement array buffers.
-      }
     }
   }
 
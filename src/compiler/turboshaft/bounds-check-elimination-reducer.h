@@ -0,0 +1,191 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/utils.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// BoundsCheckElimination removes the bounds checks of JS element accesses
+// (`DeoptimizeIfNot(Uint32LessThan(index, length))`, as emitted for
+// CheckedUint32Bounds and CheckedUint64Bounds) whose index is a loop induction
+// variable that is known to be in range. This typically happens for loops like
+//
+//     for (let i = 0; i < a.length; i++) sum += a[i];
+//
+// where the loop header has `Branch(Int32LessThan(i, length))` and the bounds
+// check compares the same {i} against the same {length}. The signed check of
+// the loop header only implies the unsigned bounds check if {i} is
+// non-negative, which we prove with a simple range analysis of {i}: it starts
+// at a non-negative constant and is only ever incremented by 1 after the loop
+// header checked {i < length}, so that it cannot wrap around.
+//
+// The analysis only looks at the input graph, so it has to run before loop
+// unrolling changes the shape of the induction variables.
+template <class Next>
+class BoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(BoundsCheckElimination)
+
+  V<None> REDUCE_INPUT_GRAPH(DeoptimizeIf)(V<None> ig_index,
+                                           const DeoptimizeIfOp& deopt) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphDeoptimizeIf(ig_index, deopt);
+    }
+    if (!v8_flags.turboshaft_bounds_check_elimination || !deopt.negated ||
+        deopt.parameters->reason() != DeoptimizeReason::kOutOfBounds) {
+      goto no_change;
+    }
+    if (!IsRedundantBoundsCheck(deopt.condition())) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    if (V8_UNLIKELY(v8_flags.trace_turbo_reduction)) {
+      PrintF(
+          "[bounds-check-elimination] Removed bounds check #%u (condition "
+          "#%u) implied by its loop header\n",
+          ig_index.id(), deopt.condition().id());
+    }
+    return {};
+  }
+
+ private:
+  bool IsRedundantBoundsCheck(V<Word32> condition) {
+    const ComparisonOp* check =
+        __ input_graph().Get(condition).template TryCast<ComparisonOp>();
+    if (!check || check->kind != ComparisonOp::Kind::kUnsignedLessThan) {
+      return false;
+    }
+
+    OpIndex index = StripWord32Extension(check->left());
+    const PhiOp* phi = __ input_graph().Get(index).template TryCast<PhiOp>();
+    if (!phi || phi->input_count != 2) return false;
+    const Block* header =
+        &__ input_graph().Get(__ input_graph().BlockIndexOf(index));
+    if (!header->IsLoop()) return false;
+
+    // The loop header has to exit the loop unless {index < limit}.
+    const BranchOp* branch =
+        header->LastOperation(__ input_graph()).template TryCast<BranchOp>();
+    if (!branch) return false;
+    const ComparisonOp* guard = __ input_graph()
+                                    .Get(branch->condition())
+                                    .template TryCast<ComparisonOp>();
+    if (!guard || guard->kind != ComparisonOp::Kind::kSignedLessThan) {
+      return false;
+    }
+    if (StripWord32Extension(guard->left()) != index ||
+        StripWord32Extension(guard->right()) !=
+            StripWord32Extension(check->right())) {
+      return false;
+    }
+    if (!__ current_input_block()->IsDominatedBy(branch->if_true)) {
+      return false;
+    }
+
+    // With {0 <= index} and {index < limit}, {index <u limit} holds regardless
+    // of whether {index} and {limit} were zero- or sign-extended.
+    return IsNonNegativeInductionVariable(index, *phi, *guard,
+                                          branch->if_true);
+  }
+
+  // Returns true if the loop phi {phi} starts at a non-negative constant and
+  // is incremented without ever wrapping around, knowing that the loop is only
+  // executed while {guard} holds, which is the case in {in_range}.
+  bool IsNonNegativeInductionVariable(OpIndex phi_index, const PhiOp& phi,
+                                      const ComparisonOp& guard,
+                                      const Block* in_range) {
+    if (phi.rep != RegisterRepresentation::Word32() &&
+        phi.rep != RegisterRepresentation::Word64()) {
+      return false;
+    }
+    int64_t initial_value;
+    if (!MatchSignedConstant(phi.input(0), phi.rep, &initial_value) ||
+        initial_value < 0) {
+      return false;
+    }
+
+    // {index + 1} doesn't wrap around if it is only computed once {index <
+    // limit} has been checked in the representation of {index}.
+    if (guard.rep != phi.rep || guard.left() != phi_index) return false;
+    OpIndex backedge = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+    OpIndex left, right;
+    if (const WordBinopOp* add =
+            __ input_graph().Get(backedge).template TryCast<WordBinopOp>()) {
+      if (add->kind != WordBinopOp::Kind::kAdd) return false;
+      left = add->left();
+      right = add->right();
+    } else if (const ProjectionOp* projection =
+                   __ input_graph()
+                       .Get(backedge)
+                       .template TryCast<ProjectionOp>()) {
+      const OverflowCheckedBinopOp* add =
+          __ input_graph()
+              .Get(projection->input())
+              .template TryCast<OverflowCheckedBinopOp>();
+      if (projection->index != OverflowCheckedBinopOp::kValueIndex || !add ||
+          add->kind != OverflowCheckedBinopOp::Kind::kSignedAdd) {
+        return false;
+      }
+      left = add->left();
+      right = add->right();
+    } else {
+      return false;
+    }
+    int64_t step;
+    if (left != phi_index || !MatchSignedConstant(right, phi.rep, &step) ||
+        step != 1) {
+      return false;
+    }
+    const Block* increment_block =
+        &__ input_graph().Get(__ input_graph().BlockIndexOf(backedge));
+    return increment_block->IsDominatedBy(in_range);
+  }
+
+  bool MatchSignedConstant(OpIndex index, RegisterRepresentation rep,
+                           int64_t* value) {
+    const ConstantOp* constant =
+        __ input_graph().Get(index).template TryCast<ConstantOp>();
+    if (!constant) return false;
+    if (rep == RegisterRepresentation::Word32() &&
+        constant->kind == ConstantOp::Kind::kWord32) {
+      *value = static_cast<int32_t>(constant->signed_integral());
+      return true;
+    }
+    if (rep == RegisterRepresentation::Word64() &&
+        constant->kind == ConstantOp::Kind::kWord64) {
+      *value = constant->signed_integral();
+      return true;
+    }
+    return false;
+  }
+
+  // Typed array accesses compare word64 indices and lengths, which are often
+  // extended from word32 values.
+  OpIndex StripWord32Extension(OpIndex index) {
+    if (const ChangeOp* change =
+            __ input_graph().Get(index).template TryCast<ChangeOp>()) {
+      if ((change->kind == ChangeOp::Kind::kZeroExtend ||
+           change->kind == ChangeOp::Kind::kSignExtend) &&
+          change->from == RegisterRepresentation::Word32()) {
+        return change->input();
+      }
+    }
+    return index;
+  }
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
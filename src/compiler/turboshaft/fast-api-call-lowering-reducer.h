@@ -67,10 +67,15 @@ class FastApiCallLoweringReducer : public Next {
     // lead to unconditionally jumping to {handle_error}. If this happens, then
     // we don't emit the call.
     if (V8_LIKELY(!__ generating_unreachable_operations())) {
+      // Handles are returned as raw pointers and dereferenced below.
+      const bool returns_handle =
+          c_signature->ReturnInfo().GetType() == CTypeInfo::Type::kV8Value;
       MachineSignature::Builder builder(
           __ graph_zone(), 1,
           c_arg_count + (c_signature->HasOptions() ? 1 : 0));
-      builder.AddReturn(MachineType::TypeForCType(c_signature->ReturnInfo()));
+      builder.AddReturn(returns_handle ? MachineType::Pointer()
+                                       : MachineType::TypeForCType(
+                                             c_signature->ReturnInfo()));
       for (int i = 0; i < c_arg_count; ++i) {
         CTypeInfo type = c_signature->ArgumentInfo(i);
         MachineType machine_type =
@@ -111,8 +116,14 @@ class FastApiCallLoweringReducer : public Next {
           Linkage::GetSimplifiedCDescriptor(__ graph_zone(), builder.Build(),
                                             CallDescriptor::kNeedsFrameState),
           CanThrow::kNo, LazyDeoptOnThrow::kNo, __ graph_zone());
+      HandleScopeState handle_scope;
+      if (returns_handle) handle_scope = EnterHandleScope();
       OpIndex c_call_result = WrapFastCall(call_descriptor, callee, frame_state,
                                            context, base::VectorOf(args));
+      if (returns_handle) {
+        c_call_result = LeaveHandleScope(handle_scope,
+                                         V<WordPtr>::Cast(c_call_result));
+      }
 
       Label<> trigger_exception(this);
 
@@ -335,13 +346,23 @@ class FastApiCallLoweringReducer : public Next {
         // Check that the value is a HeapObject.
         GOTO_IF(__ ObjectIsSmi(argument), handle_error);
 
+        if (arg_type.GetType() == CTypeInfo::Type::kVoid) {
+          return AdaptFastCallArrayBufferViewArgument(argument, arg_type,
+                                                      handle_error);
+        }
         return AdaptFastCallTypedArrayArgument(
             argument,
             fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
             handle_error);
       }
-      default: {
-        UNREACHABLE();
+      case CTypeInfo::SequenceType::kIsArrayBuffer: {
+        CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kVoid);
+
+        // Check that the value is a HeapObject.
+        GOTO_IF(__ ObjectIsSmi(argument), handle_error);
+
+        return AdaptFastCallArrayBufferArgument(argument, arg_type,
+                                                handle_error);
       }
     }
   }
@@ -484,6 +505,180 @@ class FastApiCallLoweringReducer : public Next {
     return stack_slot;
   }
 
+  // Jumps to {bailout} if {buffer} can't be passed as a plain data span, i.e.
+  // if it was detached, can be resized, or is shared while the signature
+  // doesn't allow that.
+  void CheckFastCallArrayBuffer(V<HeapObject> buffer, CTypeInfo arg_type,
+                                Label<>& bailout) {
+    V<Word32> buffer_bitfield = __ template LoadField<Word32>(
+        buffer, AccessBuilder::ForJSArrayBufferBitField());
+    uint32_t bailout_mask = JSArrayBuffer::WasDetachedBit::kMask |
+                            JSArrayBuffer::IsResizableByJsBit::kMask;
+    if (!(static_cast<uint8_t>(arg_type.GetFlags()) &
+          static_cast<uint8_t>(CTypeInfo::Flags::kAllowSharedBit))) {
+      bailout_mask |= JSArrayBuffer::IsSharedBit::kMask;
+    }
+    GOTO_IF(UNLIKELY(__ Word32BitwiseAnd(buffer_bitfield, bailout_mask)),
+            bailout);
+  }
+
+  OpIndex StoreFastCallBufferSpan(V<WordPtr> data_ptr,
+                                  V<WordPtr> length_in_bytes) {
+    constexpr int kAlign = alignof(FastApiArrayBufferView);
+    constexpr int kSize = sizeof(FastApiArrayBufferView);
+    static_assert(kAlign == alignof(FastApiArrayBuffer) &&
+                      kSize == sizeof(FastApiArrayBuffer),
+                  "FastApiArrayBufferView and FastApiArrayBuffer are expected "
+                  "to have the same layout.");
+    static_assert(
+        offsetof(FastApiArrayBufferView, data) == 0 &&
+            offsetof(FastApiArrayBufferView, byte_length) == sizeof(uintptr_t),
+        "The layout of FastApiArrayBufferView doesn't match the stores "
+        "below.");
+    OpIndex stack_slot = __ StackSlot(kSize, kAlign);
+    __ StoreOffHeap(stack_slot, data_ptr, MemoryRepresentation::UintPtr());
+    __ StoreOffHeap(stack_slot, length_in_bytes,
+                    MemoryRepresentation::UintPtr(), sizeof(uintptr_t));
+    return stack_slot;
+  }
+
+  OpIndex AdaptFastCallArrayBufferViewArgument(V<HeapObject> argument,
+                                               CTypeInfo arg_type,
+                                               Label<>& bailout) {
+    Label<> if_view(this);
+    Label<WordPtr> done(this);
+
+    V<Map> map = __ LoadMapField(argument);
+    V<Word32> instance_type = __ LoadInstanceTypeField(map);
+    V<Word32> is_typed_array =
+        __ Word32Equal(instance_type, JS_TYPED_ARRAY_TYPE);
+    GOTO_IF(LIKELY(is_typed_array), if_view);
+    GOTO_IF_NOT(__ Word32Equal(instance_type, JS_DATA_VIEW_TYPE), bailout);
+    GOTO(if_view);
+
+    BIND(if_view);
+    // Views that track the length of their buffer, or that can go out of
+    // bounds, are rejected by the check on the buffer. Hence the byte length
+    // stored in the view is up to date.
+    V<HeapObject> buffer = __ template LoadField<HeapObject>(
+        argument, AccessBuilder::ForJSArrayBufferViewBuffer());
+    CheckFastCallArrayBuffer(buffer, arg_type, bailout);
+    V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
+        argument, AccessBuilder::ForJSArrayBufferViewByteLength());
+
+    IF (LIKELY(is_typed_array)) {
+      OpIndex external_pointer = __ LoadField(
+          argument, AccessBuilder::ForJSTypedArrayExternalPointer());
+      if constexpr (JSTypedArray::kMaxSizeInHeap == 0) {
+        GOTO(done, external_pointer);
+      } else {
+        V<Object> base_pointer = __ template LoadField<Object>(
+            argument, AccessBuilder::ForJSTypedArrayBasePointer());
+        V<WordPtr> base = __ BitcastTaggedToWordPtr(base_pointer);
+        if (COMPRESS_POINTERS_BOOL) {
+          // See AdaptFastCallTypedArrayArgument.
+          base = __ ChangeUint32ToUintPtr(__ TruncateWordPtrToWord32(base));
+        }
+        GOTO(done, __ WordPtrAdd(base, external_pointer));
+      }
+    } ELSE {
+      GOTO(done, __ LoadField(argument,
+                              AccessBuilder::ForJSDataViewDataPointer()));
+    }
+
+    BIND(done, data_ptr);
+    return StoreFastCallBufferSpan(data_ptr, length_in_bytes);
+  }
+
+  OpIndex AdaptFastCallArrayBufferArgument(V<HeapObject> argument,
+                                           CTypeInfo arg_type,
+                                           Label<>& bailout) {
+    V<Map> map = __ LoadMapField(argument);
+    V<Word32> instance_type = __ LoadInstanceTypeField(map);
+    GOTO_IF_NOT(LIKELY(__ Word32Equal(instance_type, JS_ARRAY_BUFFER_TYPE)),
+                bailout);
+    CheckFastCallArrayBuffer(argument, arg_type, bailout);
+
+    V<WordPtr> data_ptr = __ template LoadField<WordPtr>(
+        argument, AccessBuilder::ForJSArrayBufferBackingStore());
+    V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
+        argument, AccessBuilder::ForJSArrayBufferByteLength());
+    return StoreFastCallBufferSpan(data_ptr, length_in_bytes);
+  }
+
+  struct HandleScopeState {
+    V<WordPtr> next;
+    V<WordPtr> limit;
+    V<Word32> level;
+  };
+
+  // Fast calls that return a handle get their own handle scope, like regular
+  // API callbacks get one in CallApiCallback, so that the handles they create
+  // don't pile up in the embedder's outer scope.
+  HandleScopeState EnterHandleScope() {
+    OpIndex level_address = __ ExternalConstant(
+        ExternalReference::handle_scope_level_address(isolate_));
+    HandleScopeState state;
+    state.next = __ LoadOffHeap(
+        __ ExternalConstant(
+            ExternalReference::handle_scope_next_address(isolate_)),
+        MemoryRepresentation::UintPtr());
+    state.limit = __ LoadOffHeap(
+        __ ExternalConstant(
+            ExternalReference::handle_scope_limit_address(isolate_)),
+        MemoryRepresentation::UintPtr());
+    state.level = __ LoadOffHeap(level_address, MemoryRepresentation::Int32());
+    __ StoreOffHeap(level_address, __ Word32Add(state.level, 1),
+                    MemoryRepresentation::Int32());
+    return state;
+  }
+
+  // Dereferences the {handle} returned by the fast call and closes the scope
+  // opened by EnterHandleScope. An empty handle results in undefined.
+  V<Object> LeaveHandleScope(const HandleScopeState& state,
+                             V<WordPtr> handle) {
+    Label<Object> load_done(this);
+    GOTO_IF(UNLIKELY(__ WordPtrEqual(handle, 0)), load_done,
+            __ HeapConstant(factory_->undefined_value()));
+#ifdef V8_ENABLE_DIRECT_HANDLE
+    GOTO(load_done, __ BitcastWordPtrToTagged(handle));
+#else
+    GOTO(load_done,
+         __ LoadOffHeap(handle, MemoryRepresentation::AnyUncompressedTagged()));
+#endif  // V8_ENABLE_DIRECT_HANDLE
+    BIND(load_done, result);
+
+    OpIndex limit_address = __ ExternalConstant(
+        ExternalReference::handle_scope_limit_address(isolate_));
+    __ StoreOffHeap(
+        __ ExternalConstant(
+            ExternalReference::handle_scope_next_address(isolate_)),
+        state.next, MemoryRepresentation::UintPtr());
+    __ StoreOffHeap(
+        __ ExternalConstant(
+            ExternalReference::handle_scope_level_address(isolate_)),
+        state.level, MemoryRepresentation::Int32());
+
+    // Free the handle blocks that were allocated by the callback.
+    IF_NOT (LIKELY(__ WordPtrEqual(
+                __ LoadOffHeap(limit_address, MemoryRepresentation::UintPtr()),
+                state.limit))) {
+      __ StoreOffHeap(limit_address, state.limit,
+                      MemoryRepresentation::UintPtr());
+      MachineSignature::Builder builder(__ graph_zone(), 0, 1);
+      builder.AddParam(MachineType::Pointer());
+      auto call_descriptor =
+          Linkage::GetSimplifiedCDescriptor(__ graph_zone(), builder.Build());
+      __ Call(__ ExternalConstant(
+                  ExternalReference::delete_handle_scope_extensions()),
+              {__ ExternalConstant(ExternalReference::isolate_address())},
+              TSCallDescriptor::Create(call_descriptor, CanThrow::kNo,
+                                       LazyDeoptOnThrow::kNo,
+                                       __ graph_zone()));
+    }
+    return result;
+  }
+
   V<Object> ConvertReturnValue(const CFunctionInfo* c_signature,
                                OpIndex result) {
     switch (c_signature->ReturnInfo().GetType()) {
@@ -544,8 +739,10 @@ class FastApiCallLoweringReducer : public Next {
             result, CheckForMinusZeroMode::kCheckForMinusZero);
       case CTypeInfo::Type::kPointer:
         return BuildAllocateJSExternalObject(result);
-      case CTypeInfo::Type::kSeqOneByteString:
       case CTypeInfo::Type::kV8Value:
+        // Already dereferenced by LeaveHandleScope.
+        return V<Object>::Cast(result);
+      case CTypeInfo::Type::kSeqOneByteString:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
         UNREACHABLE();
@@ -17,6 +17,7 @@
 #include "src/base/small-vector.h"
 #include "src/base/vector.h"
 #include "src/codegen/source-position.h"
+#include "src/compiler/graph-zone-traits.h"
 #include "src/compiler/turboshaft/operations.h"
 #include "src/compiler/turboshaft/sidetable.h"
 #include "src/compiler/turboshaft/types.h"
@@ -195,6 +196,13 @@ class DominatorForwardTreeNode;
 template <class Derived>
 class RandomAccessStackDominatorNode;
 
+// Blocks are only ever allocated in the graph zone (see
+// Graph::AllocateNewBlocks), so the links between blocks are compressed when
+// graph zones are compressed. This shrinks blocks of large graphs
+// considerably.
+template <class T>
+using ZoneBlockPtr = GraphZoneTraits::Ptr<T>;
+
 template <class Derived>
 class DominatorForwardTreeNode {
   // A class storing a forward representation of the dominator tree, since the
@@ -225,8 +233,8 @@ class DominatorForwardTreeNode {
 #ifdef DEBUG
   friend class RandomAccessStackDominatorNode<Derived>;
 #endif
-  Derived* neighboring_child_ = nullptr;
-  Derived* last_child_ = nullptr;
+  ZoneBlockPtr<Derived> neighboring_child_{nullptr};
+  ZoneBlockPtr<Derived> last_child_{nullptr};
 };
 
 template <class Derived>
@@ -266,8 +274,8 @@ class RandomAccessStackDominatorNode
   int jmp_len_ = 0;
 
   int len_ = 0;
-  Derived* nxt_ = nullptr;
-  Derived* jmp_ = nullptr;
+  ZoneBlockPtr<Derived> nxt_{nullptr};
+  ZoneBlockPtr<Derived> jmp_{nullptr};
 };
 
 // A simple iterator to walk over the predecessors of a block. Note that the
@@ -516,7 +524,7 @@ class Block : public RandomAccessStackDominatorNode<Block> {
   void AddPredecessor(Block* predecessor) {
     DCHECK(!IsBound() ||
            (Predecessors().size() == 1 && kind_ == Kind::kLoopHeader));
-    DCHECK_EQ(predecessor->neighboring_predecessor_, nullptr);
+    DCHECK_NULL(predecessor->NeighboringPredecessor());
     predecessor->neighboring_predecessor_ = last_predecessor_;
     last_predecessor_ = predecessor;
     predecessor_count_++;
@@ -527,10 +535,10 @@ class Block : public RandomAccessStackDominatorNode<Block> {
   OpIndex begin_ = OpIndex::Invalid();
   OpIndex end_ = OpIndex::Invalid();
   BlockIndex index_ = BlockIndex::Invalid();
-  Block* last_predecessor_ = nullptr;
-  Block* neighboring_predecessor_ = nullptr;
+  ZoneBlockPtr<Block> last_predecessor_{nullptr};
+  ZoneBlockPtr<Block> neighboring_predecessor_{nullptr};
   uint32_t predecessor_count_ = 0;
-  const Block* origin_ = nullptr;
+  ZoneBlockPtr<const Block> origin_{nullptr};
   // The {custom_data_} field can be used by algorithms to temporarily store
   // block-specific data. This field is not preserved when constructing a new
   // output graph and algorithms cannot rely on this field being properly reset
@@ -576,6 +584,9 @@ class Graph {
         block_type_refinement_(graph_zone),
 #endif
         stack_checks_to_remove_(graph_zone) {
+    // Blocks use compressed pointers to refer to each other, see
+    // ZoneBlockPtr.
+    CHECK_IMPLIES(kCompressGraphZone, graph_zone->supports_compression());
   }
 
   // Reset the graph to recycle its memory.
@@ -1280,8 +1291,8 @@ inline uint32_t Block::ComputeDominator() {
     }
     SetDominator(dominator);
   }
-  DCHECK_NE(jmp_, nullptr);
-  DCHECK_IMPLIES(nxt_ == nullptr, LastPredecessor() == nullptr);
+  DCHECK_NOT_NULL(static_cast<Block*>(jmp_));
+  DCHECK_IMPLIES(GetDominator() == nullptr, LastPredecessor() == nullptr);
   DCHECK_IMPLIES(len_ == 0, LastPredecessor() == nullptr);
   return Depth();
 }
@@ -1298,8 +1309,8 @@ template <class Derived>
 inline void RandomAccessStackDominatorNode<Derived>::SetDominator(
     Derived* dominator) {
   DCHECK_NOT_NULL(dominator);
-  DCHECK_NULL(static_cast<Block*>(this)->neighboring_child_);
-  DCHECK_NULL(static_cast<Block*>(this)->last_child_);
+  DCHECK_NULL(static_cast<Block*>(this)->NeighboringChild());
+  DCHECK_NULL(static_cast<Block*>(this)->LastChild());
   // Determining the jmp pointer
   Derived* t = dominator->jmp_;
   if (dominator->len_ - t->len_ == t->len_ - t->jmp_len_) {
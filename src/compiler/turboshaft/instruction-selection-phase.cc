@@ -8,6 +8,7 @@
 
 #include "src/builtins/profile-data-reader.h"
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/backend/block-timings.h"
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction-selector.h"
 #include "src/compiler/graph-visualizer.h"
@@ -17,6 +18,7 @@
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/sidetable.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/utils/ostreams.h"
 
 namespace v8::internal::compiler::turboshaft {
 
@@ -356,9 +358,21 @@ std::optional<BailoutReason> InstructionSelectionPhase::Run(
       data->info()->trace_turbo_json()
           ? InstructionSelector::kEnableTraceTurboJson
           : InstructionSelector::kDisableTraceTurboJson);
+  std::optional<BlockTimings> block_timings;
+  if (V8_UNLIKELY(v8_flags.trace_turbo_block_parallelism) &&
+      graph.block_count() >=
+          static_cast<size_t>(v8_flags.turbo_block_parallelism_min_blocks)) {
+    block_timings.emplace(temp_zone);
+    selector.set_block_timings(&block_timings.value());
+  }
   if (std::optional<BailoutReason> bailout = selector.SelectInstructions()) {
     return bailout;
   }
+  if (V8_UNLIKELY(block_timings.has_value())) {
+    StdoutStream os;
+    block_timings->Print(os, data->debug_name(), "instruction selection",
+                         v8_flags.turbo_block_parallelism_threads);
+  }
   TraceSequence(data->info(), data->sequence(), data->broker(), code_tracer,
                 "after instruction selection");
   return std::nullopt;
@@ -39,8 +39,9 @@ LoopFinder::LoopInfo LoopFinder::VisitLoop(const Block* header) {
     const Block* curr = queue_.back();
     queue_.pop_back();
     if (curr == header) continue;
-    if (loop_headers_[curr->index()] != nullptr) {
-      const Block* curr_parent = loop_headers_[curr->index()];
+    if (BlockIndex curr_parent_index = loop_headers_[curr->index()];
+        curr_parent_index.valid()) {
+      const Block* curr_parent = &input_graph_->Get(curr_parent_index);
       if (curr_parent == header) {
         // If {curr}'s parent is already marked as being {header}, then we've
         // already visited {curr}.
@@ -56,7 +57,7 @@ LoopFinder::LoopInfo LoopFinder::VisitLoop(const Block* header) {
     }
     info.block_count++;
     info.op_count += curr->OpCountUpperBound();
-    loop_headers_[curr->index()] = header;
+    loop_headers_[curr->index()] = header->index();
     const Block* pred_start = curr->LastPredecessor();
     if (curr->IsLoop()) {
       // Skipping the backedge of inner loops since we don't want to visit inner
@@ -59,7 +59,8 @@ class V8_EXPORT_PRIVATE LoopFinder {
   LoopFinder(Zone* phase_zone, const Graph* input_graph)
       : phase_zone_(phase_zone),
         input_graph_(input_graph),
-        loop_headers_(input_graph->block_count(), nullptr, phase_zone),
+        loop_headers_(input_graph->block_count(), BlockIndex::Invalid(),
+                      phase_zone),
         loop_header_info_(phase_zone),
         queue_(phase_zone) {
     Run();
@@ -69,7 +70,8 @@ class V8_EXPORT_PRIVATE LoopFinder {
     return loop_header_info_;
   }
   const Block* GetLoopHeader(const Block* block) const {
-    return loop_headers_[block->index()];
+    BlockIndex header = loop_headers_[block->index()];
+    return header.valid() ? &input_graph_->Get(header) : nullptr;
   }
   LoopInfo GetLoopInfo(const Block* block) const {
     DCHECK(block->IsLoop());
@@ -99,8 +101,10 @@ class V8_EXPORT_PRIVATE LoopFinder {
   // {loop_headers_} will map:
   //   B3 -> B2
   //   B2 -> B1
-  //   B1 -> nullptr (if B1 is an outermost loop)
-  FixedBlockSidetable<const Block*> loop_headers_;
+  //   B1 -> invalid (if B1 is an outermost loop)
+  // Headers are stored as indices rather than pointers to halve the size of
+  // the table.
+  FixedBlockSidetable<BlockIndex> loop_headers_;
 
   // Map from Loop headers to the LoopInfo for their loops. Only Loop blocks
   // have entries in this map.
@@ -0,0 +1,197 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/uniform-reducer-adapter.h"
+#include "src/compiler/turboshaft/utils.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// LoopInvariantCodeMotion hoists operations whose inputs are all defined
+// outside of an innermost loop into the loop's pre-header. When the forward
+// edge to a loop header is visited, the invariant operations of the loop are
+// emitted right before that Goto (using InlineOp), and they are then skipped
+// when the loop itself is visited.
+//
+// Since hoisting executes an operation even if the loop would not have reached
+// it, and once rather than on every iteration, only the following operations
+// are hoisted:
+//  - pure operations (no effects at all, or non-trapping WordBinops) from any
+//    block of the loop;
+//  - operations from the loop header that can at most read memory and depend
+//    on checks, if no check of the header precedes them (the loop's stack
+//    check doesn't count, since it doesn't guard any value). If they read
+//    mutable memory, the loop must not write any memory.
+// Operations that can deopt, allocate or create identity are never hoisted:
+// the frame states of checks typically refer to loop phis anyways, and
+// allocations would change the semantics of the loop.
+template <class Next>
+class LoopInvariantCodeMotionReducer
+    : public UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next> {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopInvariantCodeMotion)
+
+  using Adapter = UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next>;
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    const Block* dst = gto.destination;
+    if (!v8_flags.turboshaft_loop_invariant_code_motion || !dst->IsLoop() ||
+        gto.is_backedge) {
+      goto no_change;
+    }
+    LoopFinder::LoopInfo info = loop_finder_.GetLoopInfo(dst);
+    if (info.has_inner_loops) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    HoistInvariantOperations(dst);
+    __ SetCurrentOrigin(ig_idx);
+    goto no_change;
+  }
+
+  template <typename Op, typename Continuation>
+  OpIndex ReduceInputGraphOperation(OpIndex ig_index, const Op& op) {
+    if (hoisted_[ig_index]) {
+      // The operation has already been emitted in the loop's pre-header, and
+      // its mapping points to the hoisted copy.
+      return OpIndex::Invalid();
+    }
+    return Continuation{this}.ReduceInputGraph(ig_index, op);
+  }
+
+ private:
+  void HoistInvariantOperations(const Block* header) {
+    ZoneSet<const Block*, LoopFinder::BlockCmp> loop_body =
+        loop_finder_.GetLoopBody(header);
+
+    bool loop_can_write = false;
+    for (const Block* block : loop_body) {
+      for (const Operation& op : __ input_graph().operations(*block)) {
+        if (op.Effects().can_write()) {
+          loop_can_write = true;
+          break;
+        }
+      }
+      if (loop_can_write) break;
+    }
+
+    ZoneVector<std::pair<OpIndex, const Block*>> candidates(__ phase_zone());
+    for (const Block* block : loop_body) {
+      // The effects produced by the operations of the header that remain in
+      // the loop, and that the next operations of the header cannot be
+      // reordered with.
+      OpEffects header_barrier;
+      for (OpIndex index : __ input_graph().OperationIndices(*block)) {
+        const Operation& op = __ input_graph().Get(index);
+        bool is_invariant = IsInvariant(op, loop_body);
+        if (is_invariant) {
+          if (block == header) {
+            is_invariant = IsHoistableFromHeader(op, header_barrier,
+                                                 loop_can_write);
+          } else {
+            is_invariant = IsPure(op);
+          }
+        }
+        if (is_invariant) {
+          hoisted_[index] = true;
+          candidates.emplace_back(index, block);
+        } else if (block == header && !IsLoopStackCheck(op)) {
+          header_barrier = header_barrier | op.Effects();
+        }
+      }
+    }
+    if (candidates.empty()) return;
+
+    Block* pre_header = __ current_block();
+    const Block* origin = pre_header->OriginForBlockEnd();
+    for (auto [index, block] : candidates) {
+      // InlineOp goes through ReduceInputGraphOperation, which would skip
+      // the operation if it was already marked as hoisted.
+      hoisted_[index] = false;
+      bool emitted = __ InlineOp(index, block);
+      DCHECK(emitted);
+      USE(emitted);
+      hoisted_[index] = true;
+    }
+    // InlineOp sets the origin of the current block to the input block of the
+    // inlined operation, which would confuse the phi inputs of the loop header.
+    DCHECK_EQ(__ current_block(), pre_header);
+    pre_header->SetOrigin(origin);
+  }
+
+  bool IsInvariant(const Operation& op,
+                   const ZoneSet<const Block*, LoopFinder::BlockCmp>& body) {
+    if (op.Is<PhiOp>() || op.Is<FrameStateOp>() || !CanBeUsedAsInput(op) ||
+        ShouldSkipOperation(op)) {
+      return false;
+    }
+    for (OpIndex input : op.inputs()) {
+      if (hoisted_[input]) continue;
+      const Block* input_block =
+          &__ input_graph().Get(__ input_graph().BlockIndexOf(input));
+      if (body.find(input_block) != body.end()) return false;
+    }
+    return true;
+  }
+
+  static bool IsPure(const Operation& op) {
+    if (op.Effects().IsSubsetOf(OpEffects())) return true;
+    // WordBinops depend on checks because of divisions by zero.
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      switch (binop->kind) {
+        case WordBinopOp::Kind::kSignedDiv:
+        case WordBinopOp::Kind::kUnsignedDiv:
+        case WordBinopOp::Kind::kSignedMod:
+        case WordBinopOp::Kind::kUnsignedMod:
+          return false;
+        default:
+          return true;
+      }
+    }
+    return false;
+  }
+
+  static bool IsHoistableFromHeader(const Operation& op,
+                                    OpEffects header_barrier,
+                                    bool loop_can_write) {
+    if (IsPure(op)) return true;
+    OpEffects effects = op.Effects();
+    if (!effects.IsSubsetOf(OpEffects()
+                                .CanReadMemory()
+                                .CanDependOnChecks()
+                                .CanReadImmutableMemory())) {
+      return false;
+    }
+    if (effects.can_read_mutable_memory() && loop_can_write) return false;
+    return !CannotSwapOperations(header_barrier, effects);
+  }
+
+  static bool IsLoopStackCheck(const Operation& op) {
+    const JSStackCheckOp* stack_check = op.TryCast<JSStackCheckOp>();
+    return stack_check && stack_check->kind == JSStackCheckOp::Kind::kLoop;
+  }
+
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+  FixedOpIndexSidetable<bool> hoisted_{__ input_graph().op_id_count(), false,
+                                       __ phase_zone(), &__ input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
@@ -0,0 +1,25 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-vectorization-phase.h"
+
+#include "src/codegen/cpu-features.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/required-optimization-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/compiler/turboshaft/variable-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void LoopVectorizationPhase::Run(PipelineData* data, Zone* temp_zone) {
+  // The vector loops use the Simd128 operations of Wasm, and compare indices
+  // and addresses as word64.
+  if (!Is64() || !CpuFeatures::SupportsWasmSimd128()) return;
+  CopyingPhase<LoopVectorizationReducer, MachineOptimizationReducer,
+               ValueNumberingReducer>::Run(data, temp_zone);
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,914 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+
+#include <optional>
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/utils.h"
+#include "src/zone/zone-containers.h"
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// LoopVectorization emits a Simd128 version of simple counted loops over typed
+// arrays, such as
+//
+//     for (let i = 0; i < n; i++) c[i] = a[i] * b[i] + k;
+//     for (let i = 0; i < n; i++) sum = (sum + a[i]) | 0;
+//
+// It runs after MachineLowering, when typed array elements are accessed with
+// raw Loads and Stores and when the BoundsCheckEliminationReducer removed the
+// bounds checks of the induction variable. The recognized loops consist of a
+// header ending with `Branch(i < n)` and of a single body block:
+//  - {i} is a word32 phi that is incremented by 1 in the body;
+//  - the body loads and stores float64 or (u)int32 elements at index {i}, and
+//    combines them with lane-wise arithmetic and with values that don't change
+//    during the loop (which are recomputed at their original position);
+//  - integer reductions (add, and, or, xor) are accumulated lane-wise. Float
+//    reductions are never vectorized, since reassociating them would change
+//    their result.
+// Loops containing anything else (checks, calls, phis that aren't reductions,
+// ...) are not vectorized.
+//
+// When the forward edge of such a loop is visited, a vector loop processing
+// {lanes} elements per iteration is emitted before it, guarded by a runtime
+// check that the stored ranges don't overlap with the other accessed ranges.
+// The original loop then runs as the scalar epilogue, starting from the state
+// that the vector loop reached.
+template <class Next>
+class LoopVectorizationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopVectorization)
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    const Block* header = gto.destination;
+    if (!header->IsLoop() || gto.is_backedge) goto no_change;
+    std::optional<VectorizableLoop> loop = AnalyzeLoop(header);
+    if (!loop.has_value()) goto no_change;
+    if (!ShouldSkipOptimizationStep()) {
+      EmitVectorLoop(*loop);
+      __ SetCurrentOrigin(ig_idx);
+    }
+    ResetLoop(*loop);
+    goto no_change;
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_index, const PhiOp& phi) {
+    if (forward_inputs_[ig_index].valid() && __ current_block()->IsLoop()) {
+      // The scalar loop continues from the state reached by the vector loop.
+      return __ PendingLoopPhi(forward_inputs_[ig_index], phi.rep);
+    }
+    return Next::ReduceInputGraphPhi(ig_index, phi);
+  }
+
+ private:
+  // Loops with more operations are unlikely to be simple enough anyways.
+  static constexpr size_t kMaxLoopOperationCount = 200;
+
+  enum class LoopOpKind : uint8_t {
+    kOutside,    // Not part of the loop being analyzed.
+    kSkipped,    // Unused, and thus not emitted by the copying phase.
+    kUniform,    // Same value in every iteration (but recomputed in each).
+    kInduction,  // The induction variable or one of its extensions.
+    kIncrement,  // The increment of the induction variable.
+    kGuard,      // The condition of the loop header.
+    kVector,     // Vector loads, stores and lane-wise operations.
+    kReduction,  // Loop phi of a reduction.
+    kReductionUpdate,
+    kFrameState,  // Frame state that refers to loop phis.
+    kStackCheck,
+    kControl,
+  };
+
+  enum class VectorShape : uint8_t { kNone, kFloat64x2, kWord32x4 };
+
+  struct Reduction {
+    OpIndex phi;
+    OpIndex update;
+    WordBinopOp::Kind kind;
+  };
+
+  struct VectorizableLoop {
+    explicit VectorizableLoop(Zone* zone)
+        : ops(zone), reductions(zone), accesses(zone) {}
+
+    const Block* header = nullptr;
+    const Block* body = nullptr;
+    OpIndex induction;
+    OpIndex increment;
+    const ComparisonOp* guard = nullptr;
+    VectorShape shape = VectorShape::kNone;
+    bool has_stores = false;
+    bool has_raw_uniform_loads = false;
+    // All non-skipped operations of the loop, in order.
+    ZoneVector<OpIndex> ops;
+    ZoneVector<Reduction> reductions;
+    // The vector loads and stores of the loop.
+    ZoneVector<OpIndex> accesses;
+
+    int lanes() const { return shape == VectorShape::kFloat64x2 ? 2 : 4; }
+  };
+
+  // Maps the inputs of cloned operations to their current copy: operations
+  // of the loop are looked up in {values_}, and other operations in the
+  // regular mapping of the copying phase.
+  class CloneMapper {
+   public:
+    explicit CloneMapper(LoopVectorizationReducer* reducer)
+        : reducer_(reducer) {}
+
+    OpIndex Map(OpIndex index) { return reducer_->MapValue(index); }
+    OptionalOpIndex Map(OptionalOpIndex index) {
+      if (!index.valid()) return OptionalOpIndex::Nullopt();
+      return Map(index.value());
+    }
+    template <size_t N>
+    base::SmallVector<OpIndex, N> Map(base::Vector<const OpIndex> indices) {
+      base::SmallVector<OpIndex, N> result;
+      for (OpIndex index : indices) result.push_back(Map(index));
+      return result;
+    }
+
+   private:
+    LoopVectorizationReducer* reducer_;
+  };
+
+  // ---------------------------------------------------------------------------
+  // Analysis.
+
+  std::optional<VectorizableLoop> AnalyzeLoop(const Block* header) {
+    LoopFinder::LoopInfo info = loop_finder_.GetLoopInfo(header);
+    if (info.has_inner_loops || info.block_count != 2 ||
+        info.op_count > kMaxLoopOperationCount) {
+      return std::nullopt;
+    }
+
+    VectorizableLoop loop(__ phase_zone());
+    loop.header = header;
+    const BranchOp* branch =
+        header->LastOperation(__ input_graph()).template TryCast<BranchOp>();
+    if (!branch) return std::nullopt;
+    loop.body = branch->if_true;
+    if (loop.body == header || loop.body->PredecessorCount() != 1 ||
+        loop.body->LastPredecessor() != header) {
+      return std::nullopt;
+    }
+    const GotoOp* backedge = loop.body->LastOperation(__ input_graph())
+                                 .template TryCast<GotoOp>();
+    if (!backedge || backedge->destination != header) return std::nullopt;
+
+    if (!MatchInductionVariable(branch->condition(), &loop)) {
+      return std::nullopt;
+    }
+    if (!ClassifyLoop(&loop)) {
+      ResetLoop(loop);
+      return std::nullopt;
+    }
+    return loop;
+  }
+
+  // Matches `i < n` in the representation of {i}, or `ext(i) < n` in word64,
+  // where {i} is a word32 loop phi incremented by 1.
+  bool MatchInductionVariable(V<Word32> condition, VectorizableLoop* loop) {
+    const ComparisonOp* guard =
+        __ input_graph().Get(condition).template TryCast<ComparisonOp>();
+    if (!guard || guard->kind != ComparisonOp::Kind::kSignedLessThan) {
+      return false;
+    }
+    OpIndex induction = guard->left();
+    if (guard->rep == RegisterRepresentation::Word64()) {
+      const ChangeOp* change =
+          __ input_graph().Get(induction).template TryCast<ChangeOp>();
+      if (!IsWord32Extension(change)) return false;
+      induction = change->input();
+    } else if (guard->rep != RegisterRepresentation::Word32()) {
+      return false;
+    }
+    const PhiOp* phi =
+        __ input_graph().Get(induction).template TryCast<PhiOp>();
+    if (!phi || phi->input_count != 2 ||
+        phi->rep != RegisterRepresentation::Word32() ||
+        __ input_graph().BlockIndexOf(induction) != loop->header->index()) {
+      return false;
+    }
+    OpIndex increment = phi->input(PhiOp::kLoopPhiBackEdgeIndex);
+    const WordBinopOp* add =
+        __ input_graph().Get(increment).template TryCast<WordBinopOp>();
+    if (!add || add->kind != WordBinopOp::Kind::kAdd ||
+        add->rep != WordRepresentation::Word32() ||
+        add->left() != induction || !IsWord32Constant(add->right(), 1) ||
+        __ input_graph().BlockIndexOf(increment) != loop->body->index()) {
+      return false;
+    }
+    loop->induction = induction;
+    loop->increment = increment;
+    loop->guard = guard;
+    return true;
+  }
+
+  bool ClassifyLoop(VectorizableLoop* loop) {
+    for (const Block* block : {loop->header, loop->body}) {
+      for (OpIndex index : __ input_graph().OperationIndices(*block)) {
+        const Operation& op = __ input_graph().Get(index);
+        if (ShouldSkipOperation(op)) {
+          kinds_[index] = LoopOpKind::kSkipped;
+          continue;
+        }
+        loop->ops.push_back(index);
+        LoopOpKind kind = Classify(index, op, block, loop);
+        if (kind == LoopOpKind::kOutside) return false;
+        kinds_[index] = kind;
+      }
+    }
+
+    if (loop->accesses.empty()) return false;
+    if (!IsUniform(loop->guard->right())) return false;
+    // Without stores, raw loads of invariant addresses are fine. Otherwise,
+    // they could alias with the stores of the loop.
+    if (loop->has_stores && loop->has_raw_uniform_loads) return false;
+    if (!loop->reductions.empty() && loop->shape != VectorShape::kWord32x4) {
+      return false;
+    }
+    for (const Reduction& reduction : loop->reductions) {
+      if (kinds_[reduction.update] != LoopOpKind::kReductionUpdate) {
+        return false;
+      }
+    }
+
+    for (OpIndex index : loop->ops) {
+      const Operation& op = __ input_graph().Get(index);
+      for (OpIndex input : op.inputs()) {
+        if (!IsValidUse(input, index, op, *loop)) return false;
+      }
+    }
+    return true;
+  }
+
+  // Returns kOutside if {op} prevents the vectorization of the loop.
+  LoopOpKind Classify(OpIndex index, const Operation& op, const Block* block,
+                      VectorizableLoop* loop) {
+    bool in_header = block == loop->header;
+    if (index == loop->induction) return LoopOpKind::kInduction;
+    if (index == loop->increment) return LoopOpKind::kIncrement;
+    if (op.Is<BranchOp>() || op.Is<GotoOp>()) {
+      return &block->LastOperation(__ input_graph()) == &op
+                 ? LoopOpKind::kControl
+                 : LoopOpKind::kOutside;
+    }
+    if (&op == loop->guard) return LoopOpKind::kGuard;
+
+    if (const PhiOp* phi = op.TryCast<PhiOp>()) {
+      return ClassifyReduction(index, *phi, loop);
+    }
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      if (kinds_[change->input()] == LoopOpKind::kInduction &&
+          change->to == RegisterRepresentation::Word64() &&
+          IsWord32Extension(change)) {
+        return LoopOpKind::kInduction;
+      }
+    }
+    if (const FrameStateOp* frame_state = op.TryCast<FrameStateOp>()) {
+      return ClassifyFrameState(*frame_state, *loop);
+    }
+    if (const JSStackCheckOp* stack_check = op.TryCast<JSStackCheckOp>()) {
+      if (stack_check->kind != JSStackCheckOp::Kind::kLoop ||
+          !IsUniform(stack_check->native_context()) ||
+          !stack_check->frame_state().valid()) {
+        return LoopOpKind::kOutside;
+      }
+      LoopOpKind frame_state_kind =
+          kinds_[stack_check->frame_state().value()];
+      return IsUniform(stack_check->frame_state().value()) ||
+                     frame_state_kind == LoopOpKind::kFrameState
+                 ? LoopOpKind::kStackCheck
+                 : LoopOpKind::kOutside;
+    }
+    if (const LoadOp* load = op.TryCast<LoadOp>()) {
+      if (load->kind.with_trap_handler || load->kind.is_atomic) {
+        return LoopOpKind::kOutside;
+      }
+      if (AllInputsUniform(op)) {
+        if (!load->kind.tagged_base) loop->has_raw_uniform_loads = true;
+        return LoopOpKind::kUniform;
+      }
+      if (in_header || !IsVectorAccess(load->base(), load->index(),
+                                       load->kind, load->loaded_rep,
+                                       load->element_size_log2, loop)) {
+        return LoopOpKind::kOutside;
+      }
+      loop->accesses.push_back(index);
+      return LoopOpKind::kVector;
+    }
+    if (const StoreOp* store = op.TryCast<StoreOp>()) {
+      if (in_header ||
+          store->write_barrier != WriteBarrierKind::kNoWriteBarrier ||
+          kinds_[store->value()] != LoopOpKind::kVector ||
+          !IsVectorAccess(store->base(), store->index(), store->kind,
+                          store->stored_rep, store->element_size_log2, loop)) {
+        return LoopOpKind::kOutside;
+      }
+      loop->has_stores = true;
+      loop->accesses.push_back(index);
+      return LoopOpKind::kVector;
+    }
+    if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+      if (AllInputsUniform(op)) return LoopOpKind::kUniform;
+      if (in_header || binop->rep != FloatRepresentation::Float64() ||
+          !GetFloat64x2Kind(binop->kind).has_value() ||
+          !HasVectorOperands(op, VectorShape::kFloat64x2, loop)) {
+        return LoopOpKind::kOutside;
+      }
+      return LoopOpKind::kVector;
+    }
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      if (AllInputsUniform(op)) return LoopOpKind::kUniform;
+      if (in_header || binop->rep != WordRepresentation::Word32() ||
+          !GetWord32x4Kind(binop->kind).has_value()) {
+        return LoopOpKind::kOutside;
+      }
+      for (const Reduction& reduction : loop->reductions) {
+        if (reduction.update != index) continue;
+        OpIndex other =
+            binop->left() == reduction.phi ? binop->right() : binop->left();
+        if (kinds_[other] != LoopOpKind::kVector) return LoopOpKind::kOutside;
+        return LoopOpKind::kReductionUpdate;
+      }
+      return HasVectorOperands(op, VectorShape::kWord32x4, loop)
+                 ? LoopOpKind::kVector
+                 : LoopOpKind::kOutside;
+    }
+    if (op.Is<ConstantOp>() || op.Is<ChangeOp>() || op.Is<TaggedBitcastOp>() ||
+        op.Is<ShiftOp>() || op.Is<ComparisonOp>() || op.Is<RetainOp>()) {
+      return AllInputsUniform(op) ? LoopOpKind::kUniform
+                                  : LoopOpKind::kOutside;
+    }
+    return LoopOpKind::kOutside;
+  }
+
+  LoopOpKind ClassifyReduction(OpIndex index, const PhiOp& phi,
+                               VectorizableLoop* loop) {
+    if (phi.input_count != 2 || phi.rep != RegisterRepresentation::Word32()) {
+      return LoopOpKind::kOutside;
+    }
+    OpIndex update = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+    const WordBinopOp* binop =
+        __ input_graph().Get(update).template TryCast<WordBinopOp>();
+    if (!binop || binop->rep != WordRepresentation::Word32() ||
+        (binop->left() != index && binop->right() != index) ||
+        binop->left() == binop->right() ||
+        __ input_graph().BlockIndexOf(update) != loop->body->index()) {
+      return LoopOpKind::kOutside;
+    }
+    switch (binop->kind) {
+      case WordBinopOp::Kind::kAdd:
+      case WordBinopOp::Kind::kBitwiseAnd:
+      case WordBinopOp::Kind::kBitwiseOr:
+      case WordBinopOp::Kind::kBitwiseXor:
+        loop->reductions.push_back({index, update, binop->kind});
+        return LoopOpKind::kReduction;
+      default:
+        return LoopOpKind::kOutside;
+    }
+  }
+
+  // Frame states can refer to the induction variable and to reductions,
+  // whose scalar values are known at the beginning of each vector iteration.
+  LoopOpKind ClassifyFrameState(const FrameStateOp& frame_state,
+                                const VectorizableLoop& loop) {
+    if (AllInputsUniform(frame_state)) return LoopOpKind::kUniform;
+    for (OpIndex input : frame_state.inputs()) {
+      if (IsUniform(input) || input == loop.induction) continue;
+      switch (kinds_[input]) {
+        case LoopOpKind::kReduction:
+        case LoopOpKind::kFrameState:
+          continue;
+        default:
+          return LoopOpKind::kOutside;
+      }
+    }
+    return LoopOpKind::kFrameState;
+  }
+
+  bool IsVectorAccess(OpIndex base, OptionalOpIndex index, LoadOp::Kind kind,
+                      MemoryRepresentation rep, uint8_t element_size_log2,
+                      VectorizableLoop* loop) {
+    if (kind.tagged_base || !index.valid() || !IsUniform(base) ||
+        kinds_[index.value()] != LoopOpKind::kInduction ||
+        element_size_log2 != rep.SizeInBytesLog2()) {
+      return false;
+    }
+    VectorShape shape;
+    if (rep == MemoryRepresentation::Float64()) {
+      shape = VectorShape::kFloat64x2;
+    } else if (rep == MemoryRepresentation::Int32() ||
+               rep == MemoryRepresentation::Uint32()) {
+      shape = VectorShape::kWord32x4;
+    } else {
+      return false;
+    }
+    return MatchesShape(loop, shape);
+  }
+
+  bool MatchesShape(VectorizableLoop* loop, VectorShape shape) {
+    if (shape == VectorShape::kNone) return true;
+    if (loop->shape == VectorShape::kNone) loop->shape = shape;
+    return loop->shape == shape;
+  }
+
+  bool HasVectorOperands(const Operation& op, VectorShape shape,
+                         VectorizableLoop* loop) {
+    for (OpIndex input : op.inputs()) {
+      if (!IsUniform(input) && kinds_[input] != LoopOpKind::kVector) {
+        return false;
+      }
+    }
+    return MatchesShape(loop, shape);
+  }
+
+  // Checks that the use of {input} by {user} can be vectorized.
+  bool IsValidUse(OpIndex input, OpIndex user_index, const Operation& user,
+                  const VectorizableLoop& loop) {
+    LoopOpKind user_kind = kinds_[user_index];
+    switch (kinds_[input]) {
+      case LoopOpKind::kOutside:
+      case LoopOpKind::kUniform:
+        return true;
+      case LoopOpKind::kSkipped:
+      case LoopOpKind::kControl:
+      case LoopOpKind::kStackCheck:
+        UNREACHABLE();
+      case LoopOpKind::kInduction:
+        if (user_kind == LoopOpKind::kInduction ||
+            user_kind == LoopOpKind::kIncrement ||
+            user_kind == LoopOpKind::kGuard) {
+          return true;
+        }
+        if (user_kind == LoopOpKind::kFrameState) {
+          return input == loop.induction;
+        }
+        // Vector accesses only use the induction variable as index.
+        if (const LoadOp* load = user.TryCast<LoadOp>()) {
+          return load->base() != input;
+        }
+        if (const StoreOp* store = user.TryCast<StoreOp>()) {
+          return store->base() != input && store->value() != input;
+        }
+        return false;
+      case LoopOpKind::kIncrement:
+        return user_index == loop.induction;
+      case LoopOpKind::kGuard:
+        return user_kind == LoopOpKind::kControl;
+      case LoopOpKind::kVector:
+        if (const StoreOp* store = user.TryCast<StoreOp>()) {
+          return store->value() == input && store->base() != input;
+        }
+        return user_kind == LoopOpKind::kVector ||
+               user_kind == LoopOpKind::kReductionUpdate;
+      case LoopOpKind::kReduction:
+        if (user_kind == LoopOpKind::kFrameState) return true;
+        for (const Reduction& reduction : loop.reductions) {
+          if (reduction.phi == input) return reduction.update == user_index;
+        }
+        UNREACHABLE();
+      case LoopOpKind::kReductionUpdate:
+        for (const Reduction& reduction : loop.reductions) {
+          if (reduction.update == input) return reduction.phi == user_index;
+        }
+        return false;
+      case LoopOpKind::kFrameState:
+        return user_kind == LoopOpKind::kFrameState ||
+               user_kind == LoopOpKind::kStackCheck;
+    }
+  }
+
+  bool IsUniform(OpIndex index) {
+    LoopOpKind kind = kinds_[index];
+    return kind == LoopOpKind::kOutside || kind == LoopOpKind::kUniform;
+  }
+
+  bool AllInputsUniform(const Operation& op) {
+    for (OpIndex input : op.inputs()) {
+      if (!IsUniform(input)) return false;
+    }
+    return true;
+  }
+
+  static bool IsWord32Extension(const ChangeOp* change) {
+    return change &&
+           (change->kind == ChangeOp::Kind::kZeroExtend ||
+            change->kind == ChangeOp::Kind::kSignExtend) &&
+           change->from == RegisterRepresentation::Word32();
+  }
+
+  bool IsWord32Constant(OpIndex index, int32_t value) {
+    const ConstantOp* constant =
+        __ input_graph().Get(index).template TryCast<ConstantOp>();
+    return constant && constant->kind == ConstantOp::Kind::kWord32 &&
+           static_cast<int32_t>(constant->word32()) == value;
+  }
+
+  static std::optional<Simd128BinopOp::Kind> GetFloat64x2Kind(
+      FloatBinopOp::Kind kind) {
+    switch (kind) {
+      case FloatBinopOp::Kind::kAdd:
+        return Simd128BinopOp::Kind::kF64x2Add;
+      case FloatBinopOp::Kind::kSub:
+        return Simd128BinopOp::Kind::kF64x2Sub;
+      case FloatBinopOp::Kind::kMul:
+        return Simd128BinopOp::Kind::kF64x2Mul;
+      case FloatBinopOp::Kind::kDiv:
+        return Simd128BinopOp::Kind::kF64x2Div;
+      default:
+        return std::nullopt;
+    }
+  }
+
+  static std::optional<Simd128BinopOp::Kind> GetWord32x4Kind(
+      WordBinopOp::Kind kind) {
+    switch (kind) {
+      case WordBinopOp::Kind::kAdd:
+        return Simd128BinopOp::Kind::kI32x4Add;
+      case WordBinopOp::Kind::kSub:
+        return Simd128BinopOp::Kind::kI32x4Sub;
+      case WordBinopOp::Kind::kMul:
+        return Simd128BinopOp::Kind::kI32x4Mul;
+      case WordBinopOp::Kind::kBitwiseAnd:
+        return Simd128BinopOp::Kind::kS128And;
+      case WordBinopOp::Kind::kBitwiseOr:
+        return Simd128BinopOp::Kind::kS128Or;
+      case WordBinopOp::Kind::kBitwiseXor:
+        return Simd128BinopOp::Kind::kS128Xor;
+      default:
+        return std::nullopt;
+    }
+  }
+
+  void ResetLoop(const VectorizableLoop& loop) {
+    for (const Block* block : {loop.header, loop.body}) {
+      for (OpIndex index : __ input_graph().OperationIndices(*block)) {
+        kinds_[index] = LoopOpKind::kOutside;
+        values_[index] = OpIndex::Invalid();
+      }
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Emission.
+
+  void EmitVectorLoop(const VectorizableLoop& loop) {
+    const Block* header = loop.header;
+    const Block* body = loop.body;
+    const PhiOp& induction =
+        __ input_graph().Get(loop.induction).template Cast<PhiOp>();
+    current_loop_ = &loop;
+    Variable index = __ NewVariable(RegisterRepresentation::Word32());
+    __ SetVariable(index, __ MapToNewGraph(induction.input(0)));
+    base::SmallVector<Variable, 4> results;
+    for (const Reduction& reduction : loop.reductions) {
+      const PhiOp& phi =
+          __ input_graph().Get(reduction.phi).template Cast<PhiOp>();
+      results.push_back(__ NewVariable(RegisterRepresentation::Word32()));
+      __ SetVariable(results.back(), __ MapToNewGraph(phi.input(0)));
+    }
+
+    // The header is executed at least once, so that its invariant operations
+    // can be computed before the loop.
+    CloneUniformOperations(loop, header);
+    values_[loop.induction] = __ GetVariable(index);
+    IF (HasRemainingVectorIterations(loop)) {
+      // If the loop runs at least {lanes} iterations, its body is executed as
+      // well.
+      CloneUniformOperations(loop, body);
+      IF (LIKELY(AccessesDontOverlap(loop))) {
+        base::SmallVector<Variable, 4> accumulators;
+        for (const Reduction& reduction : loop.reductions) {
+          accumulators.push_back(
+              __ NewVariable(RegisterRepresentation::Simd128()));
+          __ SetVariable(accumulators.back(),
+                         ReductionIdentity(reduction.kind));
+        }
+        current_accumulators_ = &accumulators;
+        current_results_ = &results;
+
+        WHILE(EmitVectorHeader(loop, index)) {
+          EmitVectorBody(loop);
+          __ SetVariable(index,
+                         __ Word32Add(V<Word32>::Cast(__ GetVariable(index)),
+                                      loop.lanes()));
+        }
+
+        for (size_t i = 0; i < loop.reductions.size(); ++i) {
+          __ SetVariable(results[i], CombineLanes(i));
+        }
+        // Like ScopedVariables, explicitly invalidate the variables to avoid
+        // the creation of unnecessary phis.
+        for (Variable accumulator : accumulators) {
+          __ SetVariable(accumulator, OpIndex::Invalid());
+        }
+        current_accumulators_ = nullptr;
+        current_results_ = nullptr;
+      }
+    }
+    current_loop_ = nullptr;
+
+    forward_inputs_[loop.induction] = __ GetVariable(index);
+    __ SetVariable(index, OpIndex::Invalid());
+    for (size_t i = 0; i < loop.reductions.size(); ++i) {
+      forward_inputs_[loop.reductions[i].phi] = __ GetVariable(results[i]);
+      __ SetVariable(results[i], OpIndex::Invalid());
+    }
+    if (V8_UNLIKELY(v8_flags.trace_turbo_reduction)) {
+      PrintF("[loop-vectorization] Vectorized loop B%u with %d lanes\n",
+             header->index().id(), loop.lanes());
+    }
+  }
+
+  // Whether the scalar loop would still run at least {lanes} iterations from
+  // the current value of the induction variable. Word64 guards compare an
+  // extension of the induction variable, which we keep within [0, kMaxInt] so
+  // that sign- and zero-extension agree and that it doesn't wrap around.
+  V<Word32> HasRemainingVectorIterations(const VectorizableLoop& loop) {
+    V<Word32> index = V<Word32>::Cast(values_[loop.induction]);
+    OpIndex right = MapValue(loop.guard->right());
+    V<Word64> limit = loop.guard->rep == RegisterRepresentation::Word32()
+                          ? __ ChangeInt32ToInt64(V<Word32>::Cast(right))
+                          : V<Word64>::Cast(right);
+    V<Word32> in_range = __ Int64LessThanOrEqual(
+        __ Word64Add(__ ChangeInt32ToInt64(index), loop.lanes()), limit);
+    if (loop.guard->rep == RegisterRepresentation::Word32()) return in_range;
+    return __ Word32BitwiseAnd(
+        in_range, __ Uint32LessThanOrEqual(index, kMaxInt - loop.lanes()));
+  }
+
+  // Checks that the range of elements [i, n) that is stored to by each store
+  // doesn't overlap with the range accessed by the other memory accesses.
+  // Accesses to the same base and offset access the same elements in every
+  // iteration, which is fine.
+  V<Word32> AccessesDontOverlap(const VectorizableLoop& loop) {
+    V<Word32> result = __ Word32Constant(1);
+    V<WordPtr> start =
+        __ ChangeInt32ToIntPtr(V<Word32>::Cast(values_[loop.induction]));
+    OpIndex right = MapValue(loop.guard->right());
+    V<WordPtr> end = loop.guard->rep == RegisterRepresentation::Word32()
+                         ? __ ChangeInt32ToIntPtr(V<Word32>::Cast(right))
+                         : V<WordPtr>::Cast(right);
+    for (OpIndex store_index : loop.accesses) {
+      const StoreOp* store =
+          __ input_graph().Get(store_index).template TryCast<StoreOp>();
+      if (!store) continue;
+      for (OpIndex other_index : loop.accesses) {
+        if (other_index == store_index) continue;
+        const Operation& other = __ input_graph().Get(other_index);
+        OpIndex other_base;
+        int32_t other_offset;
+        if (const LoadOp* load = other.TryCast<LoadOp>()) {
+          other_base = load->base();
+          other_offset = load->offset;
+        } else {
+          // Only check each pair of stores once.
+          if (other_index < store_index) continue;
+          const StoreOp& other_store = other.Cast<StoreOp>();
+          other_base = other_store.base();
+          other_offset = other_store.offset;
+        }
+        if (other_base == store->base() && other_offset == store->offset) {
+          continue;
+        }
+        // All accesses have the same element size.
+        uint8_t shift = store->element_size_log2;
+        V<WordPtr> store_start = ElementAddress(store->base(), store->offset,
+                                                start, shift);
+        V<WordPtr> store_end =
+            ElementAddress(store->base(), store->offset, end, shift);
+        V<WordPtr> other_start =
+            ElementAddress(other_base, other_offset, start, shift);
+        V<WordPtr> other_end =
+            ElementAddress(other_base, other_offset, end, shift);
+        V<Word32> disjoint = __ Word32BitwiseOr(
+            __ UintPtrLessThanOrEqual(store_end, other_start),
+            __ UintPtrLessThanOrEqual(other_end, store_start));
+        result = __ Word32BitwiseAnd(result, disjoint);
+      }
+    }
+    return result;
+  }
+
+  V<WordPtr> ElementAddress(OpIndex base, int32_t offset, V<WordPtr> index,
+                            uint8_t element_size_log2) {
+    return __ WordPtrAdd(
+        __ WordPtrAdd(V<WordPtr>::Cast(MapValue(base)), offset),
+        __ WordPtrShiftLeft(index, element_size_log2));
+  }
+
+  // Emits the operations of the header in the vector loop, and returns the
+  // condition of the vector loop.
+  V<Word32> EmitVectorHeader(const VectorizableLoop& loop, Variable index) {
+    values_[loop.induction] = __ GetVariable(index);
+    for (OpIndex op_index : __ input_graph().OperationIndices(*loop.header)) {
+      if (op_index == loop.induction) continue;
+      EmitOperation(op_index, loop);
+    }
+    return HasRemainingVectorIterations(loop);
+  }
+
+  void EmitVectorBody(const VectorizableLoop& loop) {
+    for (OpIndex op_index : __ input_graph().OperationIndices(*loop.body)) {
+      EmitOperation(op_index, loop);
+    }
+  }
+
+  void EmitOperation(OpIndex op_index, const VectorizableLoop& loop) {
+    const Operation& op = __ input_graph().Get(op_index);
+    switch (kinds_[op_index]) {
+      case LoopOpKind::kOutside:
+        UNREACHABLE();
+      case LoopOpKind::kSkipped:
+      case LoopOpKind::kIncrement:
+      case LoopOpKind::kGuard:
+      case LoopOpKind::kControl:
+      case LoopOpKind::kReduction:
+        return;
+      case LoopOpKind::kUniform:
+      case LoopOpKind::kInduction:
+      case LoopOpKind::kFrameState:
+      case LoopOpKind::kStackCheck:
+        values_[op_index] = Clone(op);
+        return;
+      case LoopOpKind::kVector:
+        values_[op_index] = EmitVectorOperation(op, loop);
+        return;
+      case LoopOpKind::kReductionUpdate:
+        for (size_t i = 0; i < loop.reductions.size(); ++i) {
+          const Reduction& reduction = loop.reductions[i];
+          if (reduction.update != op_index) continue;
+          const WordBinopOp& binop = op.Cast<WordBinopOp>();
+          OpIndex other =
+              binop.left() == reduction.phi ? binop.right() : binop.left();
+          Variable accumulator = (*current_accumulators_)[i];
+          __ SetVariable(
+              accumulator,
+              __ Simd128Binop(V<Simd128>::Cast(__ GetVariable(accumulator)),
+                              V<Simd128>::Cast(values_[other]),
+                              *GetWord32x4Kind(reduction.kind)));
+          return;
+        }
+        UNREACHABLE();
+    }
+  }
+
+  OpIndex EmitVectorOperation(const Operation& op,
+                              const VectorizableLoop& loop) {
+    if (const LoadOp* load = op.TryCast<LoadOp>()) {
+      return __ Load(MapValue(load->base()), MapValue(load->index().value()),
+                     load->kind, MemoryRepresentation::Simd128(),
+                     RegisterRepresentation::Simd128(), load->offset,
+                     load->element_size_log2);
+    }
+    if (const StoreOp* store = op.TryCast<StoreOp>()) {
+      __ Store(MapValue(store->base()), MapValue(store->index().value()),
+               values_[store->value()], store->kind,
+               MemoryRepresentation::Simd128(), store->write_barrier,
+               store->offset, store->element_size_log2);
+      return OpIndex::Invalid();
+    }
+    if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+      return __ Simd128Binop(VectorOperand(binop->left(), loop),
+                             VectorOperand(binop->right(), loop),
+                             *GetFloat64x2Kind(binop->kind));
+    }
+    const WordBinopOp& binop = op.Cast<WordBinopOp>();
+    return __ Simd128Binop(VectorOperand(binop.left(), loop),
+                           VectorOperand(binop.right(), loop),
+                           *GetWord32x4Kind(binop.kind));
+  }
+
+  V<Simd128> VectorOperand(OpIndex input, const VectorizableLoop& loop) {
+    if (kinds_[input] == LoopOpKind::kVector) {
+      return V<Simd128>::Cast(values_[input]);
+    }
+    return __ Simd128Splat(V<Any>::Cast(MapValue(input)),
+                           loop.shape == VectorShape::kFloat64x2
+                               ? Simd128SplatOp::Kind::kF64x2
+                               : Simd128SplatOp::Kind::kI32x4);
+  }
+
+  void CloneUniformOperations(const VectorizableLoop& loop,
+                              const Block* block) {
+    for (OpIndex op_index : __ input_graph().OperationIndices(*block)) {
+      const Operation& op = __ input_graph().Get(op_index);
+      if (kinds_[op_index] != LoopOpKind::kUniform || op.Is<FrameStateOp>() ||
+          op.Is<RetainOp>()) {
+        continue;
+      }
+      values_[op_index] = Clone(op);
+    }
+  }
+
+  OpIndex Clone(const Operation& op) {
+    CloneMapper mapper(this);
+    switch (op.opcode) {
+#define CLONE(Name)                                                         \
+  case Opcode::k##Name:                                                     \
+    return op.Cast<Name##Op>().Explode(                                     \
+        [this](auto... args) -> OpIndex { return __ Reduce##Name(args...); }, \
+        mapper);
+      CLONE(Constant)
+      CLONE(Load)
+      CLONE(Change)
+      CLONE(TaggedBitcast)
+      CLONE(WordBinop)
+      CLONE(FloatBinop)
+      CLONE(Shift)
+      CLONE(Comparison)
+      CLONE(Retain)
+      CLONE(FrameState)
+      CLONE(JSStackCheck)
+#undef CLONE
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  OpIndex MapValue(OpIndex index) {
+    switch (kinds_[index]) {
+      case LoopOpKind::kOutside:
+        return __ MapToNewGraph(index);
+      case LoopOpKind::kReduction:
+        // Only used by frame states, at the beginning of a vector iteration.
+        DCHECK_NOT_NULL(current_accumulators_);
+        for (size_t i = 0; i < current_loop_->reductions.size(); ++i) {
+          if (current_loop_->reductions[i].phi == index) {
+            return CombineLanes(i);
+          }
+        }
+        UNREACHABLE();
+      default:
+        DCHECK(values_[index].valid());
+        return values_[index];
+    }
+  }
+
+  V<Simd128> ReductionIdentity(WordBinopOp::Kind kind) {
+    uint8_t value[kSimd128Size];
+    memset(value, kind == WordBinopOp::Kind::kBitwiseAnd ? 0xff : 0,
+           kSimd128Size);
+    return __ Simd128Constant(value);
+  }
+
+  // Combines the initial value of the {i}th reduction with all lanes of its
+  // accumulator.
+  V<Word32> CombineLanes(size_t i) {
+    const Reduction& reduction = current_loop_->reductions[i];
+    V<Word32> result = V<Word32>::Cast(__ GetVariable((*current_results_)[i]));
+    V<Simd128> accumulator =
+        V<Simd128>::Cast(__ GetVariable((*current_accumulators_)[i]));
+    for (uint8_t lane = 0; lane < 4; ++lane) {
+      V<Word32> value = V<Word32>::Cast(__ Simd128ExtractLane(
+          accumulator, Simd128ExtractLaneOp::Kind::kI32x4, lane));
+      result = V<Word32>::Cast(__ WordBinop(result, value, reduction.kind,
+                                            WordRepresentation::Word32()));
+    }
+    return result;
+  }
+
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+  // Classification of the operations of the loop being vectorized.
+  FixedOpIndexSidetable<LoopOpKind> kinds_{__ input_graph().op_id_count(),
+                                           LoopOpKind::kOutside,
+                                           __ phase_zone(), &__ input_graph()};
+  // The current copies of the operations of the loop being vectorized.
+  FixedOpIndexSidetable<OpIndex> values_{__ input_graph().op_id_count(),
+                                         OpIndex::Invalid(), __ phase_zone(),
+                                         &__ input_graph()};
+  // The values of the loop phis when entering the scalar loop.
+  FixedOpIndexSidetable<OpIndex> forward_inputs_{
+      __ input_graph().op_id_count(), OpIndex::Invalid(), __ phase_zone(),
+      &__ input_graph()};
+  const VectorizableLoop* current_loop_ = nullptr;
+  base::SmallVector<Variable, 4>* current_accumulators_ = nullptr;
+  base::SmallVector<Variable, 4>* current_results_ = nullptr;
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/machine-lowering-phase.h"
 
+#include "src/compiler/turboshaft/bounds-check-elimination-reducer.h"
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/dataview-lowering-reducer.h"
 #include "src/compiler/turboshaft/fast-api-call-lowering-reducer.h"
@@ -22,9 +23,12 @@ void MachineLoweringPhase::Run(PipelineData* data, Zone* temp_zone) {
   // and it would be better to not tie the Maglev graph builder to
   // SimplifiedLowering just yet, so I'm hijacking MachineLoweringPhase to run
   // JSGenericLoweringReducer without requiring a whole phase just for that.
-  CopyingPhase<JSGenericLoweringReducer, DataViewLoweringReducer,
-               MachineLoweringReducer, FastApiCallLoweringReducer,
-               SelectLoweringReducer,
+  //
+  // BoundsCheckEliminationReducer analyzes the induction variables of the
+  // loops, so it has to run before loop unrolling.
+  CopyingPhase<BoundsCheckEliminationReducer, JSGenericLoweringReducer,
+               DataViewLoweringReducer, MachineLoweringReducer,
+               FastApiCallLoweringReducer, SelectLoweringReducer,
                MachineOptimizationReducer>::Run(data, temp_zone);
 }
 
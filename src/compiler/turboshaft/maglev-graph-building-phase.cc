@@ -2365,6 +2365,17 @@ class GraphBuilder {
     SetMap(node, Map(node->input()));
     return maglev::ProcessResult::kContinue;
   }
+  maglev::ProcessResult Process(maglev::CheckBreakpointEntry* node,
+                                const maglev::ProcessingState& state) {
+    GET_FRAME_STATE_MAYBE_ABORT(frame_state, node->eager_deopt_info());
+    V<Word32> is_set = __ Load(
+        __ ExternalConstant(
+            ExternalReference::FromRawAddress(node->check_address())),
+        LoadOp::Kind::RawAligned(), MemoryRepresentation::Uint8());
+    __ DeoptimizeIf(is_set, frame_state, DeoptimizeReason::kBreakpointSet,
+                    node->eager_deopt_info()->feedback_to_update());
+    return maglev::ProcessResult::kContinue;
+  }
   maglev::ProcessResult Process(maglev::CheckNotHole* node,
                                 const maglev::ProcessingState& state) {
     GET_FRAME_STATE_MAYBE_ABORT(frame_state, node->eager_deopt_info());
@@ -2827,6 +2838,18 @@ class GraphBuilder {
              /*maybe_initializing_or_transitioning*/ true);
     return maglev::ProcessResult::kContinue;
   }
+  maglev::ProcessResult Process(maglev::IncrementBlockCount* node,
+                                const maglev::ProcessingState& state) {
+    V<HeapObject> coverage_info = Map(node->coverage_info_input());
+    FieldAccess access =
+        AccessBuilder::ForCoverageInfoBlockCount(node->slot_index());
+    V<Word32> count = __ Word32Constant(1);
+    if (!node->first_execution_only()) {
+      count = __ Word32Add(__ LoadField<Word32>(coverage_info, access), count);
+    }
+    __ StoreField(coverage_info, access, count);
+    return maglev::ProcessResult::kContinue;
+  }
   maglev::ProcessResult Process(maglev::StoreFloat64* node,
                                 const maglev::ProcessingState& state) {
     __ Store(Map(node->object_input()), Map(node->value_input()),
@@ -2888,6 +2911,22 @@ class GraphBuilder {
     SetMap(node, length);
     return maglev::ProcessResult::kContinue;
   }
+  maglev::ProcessResult Process(maglev::LoadRabGsabTypedArrayLength* node,
+                                const maglev::ProcessingState& state) {
+    MachineSignature::Builder builder(__ graph_zone(), 1, 1);
+    builder.AddReturn(MachineType::UintPtr());
+    builder.AddParam(MachineType::TaggedPointer());
+    OpIndex callee =
+        __ ExternalConstant(ExternalReference::rab_gsab_typed_array_length());
+    SetMap(node,
+           V<WordPtr>::Cast(__ Call(
+               callee, {Map(node->receiver_input())},
+               TSCallDescriptor::Create(Linkage::GetSimplifiedCDescriptor(
+                                            __ graph_zone(), builder.Build()),
+                                        CanThrow::kNo, LazyDeoptOnThrow::kNo,
+                                        __ graph_zone()))));
+    return maglev::ProcessResult::kContinue;
+  }
   maglev::ProcessResult Process(maglev::CheckTypedArrayBounds* node,
                                 const maglev::ProcessingState& state) {
     GET_FRAME_STATE_MAYBE_ABORT(frame_state, node->eager_deopt_info());
@@ -6319,9 +6319,8 @@ struct FastApiCallOp : OperationT<FastApiCallOp> {
         }
       case CTypeInfo::SequenceType::kIsSequence:
       case CTypeInfo::SequenceType::kIsTypedArray:
-        return MaybeRegisterRepresentation::Tagged();
       case CTypeInfo::SequenceType::kIsArrayBuffer:
-        UNREACHABLE();
+        return MaybeRegisterRepresentation::Tagged();
     }
   }
 
@@ -8336,6 +8335,8 @@ struct Simd256LoadTransformOp
   V(F32x8Abs)                            \
   V(F32x8Neg)                            \
   V(F32x8Sqrt)                           \
+  V(F64x4Abs)                            \
+  V(F64x4Neg)                            \
   V(F64x4Sqrt)                           \
   V(I32x8UConvertF32x8)                  \
   V(I32x8SConvertF32x8)                  \
@@ -7,6 +7,7 @@
 #include "src/compiler/js-heap-broker.h"
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/late-escape-analysis-reducer.h"
+#include "src/compiler/turboshaft/loop-invariant-code-motion-reducer.h"
 #include "src/compiler/turboshaft/machine-optimization-reducer.h"
 #include "src/compiler/turboshaft/memory-optimization-reducer.h"
 #include "src/compiler/turboshaft/phase.h"
@@ -24,6 +25,7 @@ void OptimizePhase::Run(PipelineData* data, Zone* temp_zone) {
   UnparkedScopeIfNeeded scope(data->broker(),
                               v8_flags.turboshaft_trace_reduction);
   turboshaft::CopyingPhase<turboshaft::StructuralOptimizationReducer,
+                           turboshaft::LoopInvariantCodeMotionReducer,
                            turboshaft::LateEscapeAnalysisReducer,
                            turboshaft::PretenuringPropagationReducer,
                            turboshaft::MemoryOptimizationReducer,
@@ -136,6 +136,11 @@ struct BuiltinComponent {
 
 struct GraphComponent : public ComponentWithZone<kGraphZoneName> {
   using ComponentWithZone::ComponentWithZone;
+  // Graph zones support compression, so that blocks can use compressed
+  // pointers (see ZoneBlockPtr).
+  explicit GraphComponent(ZoneStats* zone_stats)
+      : ComponentWithZone(ZoneWithName<kGraphZoneName>(
+            zone_stats, kGraphZoneName, kCompressGraphZone)) {}
 
   Pointer<Graph> graph = nullptr;
   Pointer<SourcePositionTable> source_positions = nullptr;
@@ -32,6 +32,10 @@
 #include "src/compiler/turboshaft/type-assertions-phase.h"
 #include "src/compiler/turboshaft/typed-optimizations-phase.h"
 
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/compiler/turboshaft/loop-vectorization-phase.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 namespace v8::internal::compiler::turboshaft {
 
 inline constexpr char kTempZoneName[] = "temp-zone";
@@ -170,6 +174,14 @@ class Pipeline {
 
     Run<turboshaft::MachineLoweringPhase>();
 
+#if V8_ENABLE_WEBASSEMBLY
+    // Loop vectorization relies on the bounds checks that MachineLowering
+    // eliminated, and on the shape of the loops before peeling and unrolling.
+    if (v8_flags.turboshaft_loop_vectorization) {
+      Run<turboshaft::LoopVectorizationPhase>();
+    }
+#endif  // V8_ENABLE_WEBASSEMBLY
+
     // TODO(dmercadier): find a way to merge LoopPeeling and LoopUnrolling. It's
     // not currently possible for 2 reasons. First, LoopPeeling reduces the
     // number of iteration of a loop, thus invalidating LoopUnrolling's
@@ -321,7 +333,9 @@ class Pipeline {
   }
 
   bool AllocateRegisters(CallDescriptor* call_descriptor) {
-    BeginPhaseKind("V8.TFRegisterAllocation");
+    BeginPhaseKind(RegisterAllocationData::ShouldUseFastMode(data()->sequence())
+                       ? "V8.TFFastRegisterAllocation"
+                       : "V8.TFRegisterAllocation");
 
     bool run_verifier = v8_flags.turbo_verify_allocation;
 
@@ -408,7 +422,10 @@ class Pipeline {
     Run<MeetRegisterConstraintsPhase>();
     Run<ResolvePhisPhase>();
     Run<BuildLiveRangesPhase>();
-    Run<BuildLiveRangeBundlesPhase>();
+    bool fast_mode = data_->register_allocation_data()->is_fast_mode();
+    if (!fast_mode) {
+      Run<BuildLiveRangeBundlesPhase>();
+    }
 
     TraceSequence("before register allocation");
     if (verifier != nullptr) {
@@ -451,10 +468,15 @@ class Pipeline {
 
     Run<PopulateReferenceMapsPhase>();
 
-    if (v8_flags.turbo_move_optimization) {
+    if (v8_flags.turbo_move_optimization && !fast_mode) {
       Run<OptimizeMovesPhase>();
     }
 
+    if (data_->pipeline_statistics() != nullptr) {
+      data_->pipeline_statistics()->RecordRegisterAllocationStats(
+          fast_mode, data_->sequence(), data_->frame());
+    }
+
     TraceSequence("after register allocation");
 
     if (verifier != nullptr) {
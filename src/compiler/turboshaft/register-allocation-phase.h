@@ -5,6 +5,9 @@
 #ifndef V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 #define V8_COMPILER_TURBOSHAFT_REGISTER_ALLOCATION_PHASE_H_
 
+#include <optional>
+
+#include "src/compiler/backend/block-timings.h"
 #include "src/compiler/backend/frame-elider.h"
 #include "src/compiler/backend/jump-threading.h"
 #include "src/compiler/backend/move-optimizer.h"
@@ -13,6 +16,7 @@
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/utils/ostreams.h"
 
 namespace v8::internal::compiler::turboshaft {
 
@@ -198,7 +202,20 @@ struct AssembleCodePhase {
   void Run(PipelineData* data, Zone* temp_zone) {
     CodeGenerator* code_generator = data->code_generator();
     DCHECK_NOT_NULL(code_generator);
+    std::optional<BlockTimings> block_timings;
+    if (V8_UNLIKELY(v8_flags.trace_turbo_block_parallelism) &&
+        data->sequence()->InstructionBlockCount() >=
+            v8_flags.turbo_block_parallelism_min_blocks) {
+      block_timings.emplace(temp_zone);
+      code_generator->set_block_timings(&block_timings.value());
+    }
     code_generator->AssembleCode();
+    if (V8_UNLIKELY(block_timings.has_value())) {
+      code_generator->set_block_timings(nullptr);
+      StdoutStream os;
+      block_timings->Print(os, data->debug_name(), "code generation",
+                           v8_flags.turbo_block_parallelism_threads);
+    }
   }
 };
 
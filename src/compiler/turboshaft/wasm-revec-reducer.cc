@@ -4,7 +4,9 @@
 
 #include "src/compiler/turboshaft/wasm-revec-reducer.h"
 
+#include <map>
 #include <optional>
+#include <string>
 
 #include "src/base/logging.h"
 #include "src/compiler/turboshaft/opmasks.h"
@@ -413,6 +415,12 @@ ShufflePackNode* SLPTree::X64TryMatch256Shuffle(const NodeGroup& node_group,
 
 void SLPTree::DeleteTree() { node_to_packnode_.clear(); }
 
+void SLPTree::RecordUnsupportedOp(OpIndex node) {
+  if (v8_flags.trace_wasm_revectorize_coverage) {
+    unsupported_ops_.push_back(node);
+  }
+}
+
 bool CannotSwapProtectedLoads(OpEffects first, OpEffects second) {
   EffectDimensions produces = first.produces;
   // The control flow effects produces by Loads are due to trap handler. We can
@@ -704,6 +712,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
         default: {
           TRACE("Unsupported Simd128Unary: %s\n",
                 GetSimdOpcodeName(op0).c_str());
+          RecordUnsupportedOp(node0);
           return nullptr;
         }
       }
@@ -743,6 +752,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
         default: {
           TRACE("Unsupported Simd128Binop: %s\n",
                 GetSimdOpcodeName(op0).c_str());
+          RecordUnsupportedOp(node0);
           return nullptr;
         }
       }
@@ -771,6 +781,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
           default: {
             TRACE("Unsupported Simd128ShiftOp: %s\n",
                   GetSimdOpcodeName(op0).c_str());
+            RecordUnsupportedOp(node0);
             return nullptr;
           }
         }
@@ -791,6 +802,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
         default: {
           TRACE("Unsupported Simd128Ternary: %s\n",
                 GetSimdOpcodeName(op0).c_str());
+          RecordUnsupportedOp(node0);
           return nullptr;
         }
       }
@@ -869,6 +881,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
         }
 
         TRACE("Unsupported Simd128Shuffle\n");
+        RecordUnsupportedOp(node0);
         return nullptr;
 
       } else {
@@ -881,6 +894,7 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
     default:
       TRACE("Default branch #%d:%s\n", node0.id(),
             GetSimdOpcodeName(op0).c_str());
+      RecordUnsupportedOp(node0);
       break;
   }
   return nullptr;
@@ -998,6 +1012,7 @@ void WasmRevecAnalyzer::Run() {
       store_seeds_.begin(), store_seeds_.end(), phase_zone_);
   all_seeds.insert(all_seeds.end(), reduce_seeds_.begin(), reduce_seeds_.end());
 
+  size_t num_trees = 0;
   for (auto pair : all_seeds) {
     NodeGroup roots(pair.first, pair.second);
 
@@ -1012,9 +1027,14 @@ void WasmRevecAnalyzer::Run() {
 
     if (CanMergeSLPTrees()) {
       revectorizable_node_.merge(slp_tree_->GetNodeMapping());
+      num_trees++;
     }
   }
 
+  if (V8_UNLIKELY(v8_flags.trace_wasm_revectorize_coverage)) {
+    PrintCoverage(all_seeds.size(), num_trees);
+  }
+
   // Early exist when no revectorizable node found.
   if (revectorizable_node_.empty()) return;
 
@@ -1028,6 +1048,19 @@ void WasmRevecAnalyzer::Run() {
   }
 }
 
+void WasmRevecAnalyzer::PrintCoverage(size_t num_seeds, size_t num_trees) {
+  // Count the operations which stopped a tree from being built, by name.
+  std::map<std::string, int> unsupported;
+  for (OpIndex node : slp_tree_->unsupported_ops()) {
+    unsupported[GetSimdOpcodeName(graph_.Get(node))]++;
+  }
+  PrintF("Revec coverage: %zu seeds, %zu trees, %zu packed nodes\n", num_seeds,
+         num_trees, revectorizable_node_.size());
+  for (const auto& [name, count] : unsupported) {
+    PrintF("  failed to pack %s: %d\n", name.c_str(), count);
+  }
+}
+
 bool WasmRevecAnalyzer::DecideVectorize() {
   TRACE("Enter %s\n", __func__);
   int save = 0, cost = 0;
@@ -43,6 +43,8 @@ namespace v8::internal::compiler::turboshaft {
   V(I32x4Neg, I32x8Neg)                                    \
   V(F32x4Abs, F32x8Abs)                                    \
   V(F32x4Neg, F32x8Neg)                                    \
+  V(F64x2Abs, F64x4Abs)                                    \
+  V(F64x2Neg, F64x4Neg)                                    \
   V(F32x4Sqrt, F32x8Sqrt)                                  \
   V(F64x2Sqrt, F64x4Sqrt)                                  \
   V(I32x4UConvertF32x4, I32x8UConvertF32x8)                \
@@ -378,7 +380,8 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
       : graph_(graph),
         phase_zone_(zone),
         root_(nullptr),
-        node_to_packnode_(zone) {}
+        node_to_packnode_(zone),
+        unsupported_ops_(zone) {}
 
   PackNode* BuildTree(const NodeGroup& roots);
   void DeleteTree();
@@ -390,6 +393,13 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
 
   void Print(const char* info);
 
+  // The first node of each group which couldn't be packed because the
+  // operation has no Simd256 equivalent, recorded for
+  // --trace-wasm-revectorize-coverage.
+  const ZoneVector<OpIndex>& unsupported_ops() const {
+    return unsupported_ops_;
+  }
+
  private:
   // This is the recursive part of BuildTree.
   PackNode* BuildTreeRec(const NodeGroup& node_group, unsigned depth);
@@ -430,6 +440,8 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
                                          const uint8_t* shuffle1);
 #endif  // V8_TARGET_ARCH_X64
 
+  void RecordUnsupportedOp(OpIndex node);
+
   bool IsSideEffectFree(OpIndex first, OpIndex second);
   bool CanBePacked(const NodeGroup& node_group);
   bool IsEqual(const OpIndex node0, const OpIndex node1);
@@ -442,6 +454,7 @@ class SLPTree : public NON_EXPORTED_BASE(ZoneObject) {
   PackNode* root_;
   // Maps a specific node to PackNode.
   ZoneUnorderedMap<OpIndex, PackNode*> node_to_packnode_;
+  ZoneVector<OpIndex> unsupported_ops_;
   static constexpr size_t RecursionMaxDepth = 1000;
 };
 
@@ -497,6 +510,7 @@ class WasmRevecAnalyzer {
   bool IsSupportedReduceSeed(const Operation& op);
   void ProcessBlock(const Block& block);
   bool DecideVectorize();
+  void PrintCoverage(size_t num_seeds, size_t num_trees);
 
   PipelineData* data_;
   Graph& graph_;
@@ -8751,6 +8751,17 @@ wasm::WasmCompilationResult CompileWasmCapiCallWrapper(
 }
 
 bool IsFastCallSupportedSignature(const v8::CFunctionInfo* sig) {
+  // Returning handles and passing buffers are only supported when calling
+  // from JavaScript.
+  if (sig->ReturnInfo().GetType() == CTypeInfo::Type::kV8Value) return false;
+  for (unsigned int i = 0; i < sig->ArgumentCount(); ++i) {
+    const CTypeInfo& arg = sig->ArgumentInfo(i);
+    if (arg.GetSequenceType() == CTypeInfo::SequenceType::kIsArrayBuffer ||
+        (arg.GetSequenceType() == CTypeInfo::SequenceType::kIsTypedArray &&
+         arg.GetType() == CTypeInfo::Type::kVoid)) {
+      return false;
+    }
+  }
   return fast_api_call::CanOptimizeFastSignature(sig);
 }
 
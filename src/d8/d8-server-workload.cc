@@ -0,0 +1,230 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-exception.h"
+#include "include/v8-external.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-primitive.h"
+#include "include/v8-promise.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/d8/d8.h"
+
+namespace v8 {
+
+namespace {
+
+// The atomic pauses of these GCs are reported. Other GC types, e.g.
+// incremental marking steps, are not bracketed by the prologue and epilogue.
+constexpr GCType kPauseGCTypes = static_cast<GCType>(
+    kGCTypeScavenge | kGCTypeMinorMarkSweep | kGCTypeMarkSweepCompact);
+
+// How long to wait for outstanding requests after the last one was issued.
+constexpr base::TimeDelta kDrainTimeout = base::TimeDelta::FromSeconds(30);
+
+// Returns the |percentile| of |sorted_ms|, using the nearest-rank method.
+double Percentile(const std::vector<double>& sorted_ms, double percentile) {
+  if (sorted_ms.empty()) return 0;
+  size_t rank = static_cast<size_t>(percentile / 100 * sorted_ms.size());
+  return sorted_ms[std::min(rank, sorted_ms.size() - 1)];
+}
+
+void PrintDistribution(const char* name, std::vector<double> values_ms) {
+  std::sort(values_ms.begin(), values_ms.end());
+  printf("ServerWorkload-%s-P50: %.3f ms\n", name, Percentile(values_ms, 50));
+  printf("ServerWorkload-%s-P90: %.3f ms\n", name, Percentile(values_ms, 90));
+  printf("ServerWorkload-%s-P99: %.3f ms\n", name, Percentile(values_ms, 99));
+  printf("ServerWorkload-%s-P99.9: %.3f ms\n", name,
+         Percentile(values_ms, 99.9));
+  printf("ServerWorkload-%s-Max: %.3f ms\n", name,
+         values_ms.empty() ? 0 : values_ms.back());
+}
+
+// Calls the handler at a fixed rate, independent of how long earlier requests
+// take, so that pauses show up as queueing delay in the latencies of later
+// requests, as they would on a server.
+class ServerWorkload {
+ public:
+  explicit ServerWorkload(Isolate* isolate) : isolate_(isolate) {
+    isolate_->AddGCPrologueCallback(OnGCPrologue, this, kPauseGCTypes);
+    isolate_->AddGCEpilogueCallback(OnGCEpilogue, this, kPauseGCTypes);
+  }
+
+  ~ServerWorkload() {
+    isolate_->RemoveGCPrologueCallback(OnGCPrologue, this);
+    isolate_->RemoveGCEpilogueCallback(OnGCEpilogue, this);
+  }
+
+  ServerWorkload(const ServerWorkload&) = delete;
+  ServerWorkload& operator=(const ServerWorkload&) = delete;
+
+  bool Run(const Global<Context>& context, Local<Function> handler) {
+    const int request_count = Shell::options.server_workload_requests;
+    const base::TimeDelta interval = base::TimeDelta::FromMicroseconds(
+        base::Time::kMicrosecondsPerSecond /
+        std::max(1, static_cast<int>(Shell::options.server_workload_rps)));
+    // Requests are referenced by address from their completion callbacks.
+    requests_.resize(request_count);
+    for (Request& request : requests_) request.workload = this;
+
+    const base::TimeTicks start = base::TimeTicks::Now();
+    for (int i = 0; i < request_count; i++) {
+      Request& request = requests_[i];
+      request.scheduled = start + interval * i;
+      if (!RunMessageLoopUntil(request.scheduled)) return false;
+      if (!IssueRequest(context, handler, &request)) return false;
+    }
+    const base::TimeTicks deadline = base::TimeTicks::Now() + kDrainTimeout;
+    while (completed_ < request_count) {
+      if (base::TimeTicks::Now() >= deadline) {
+        fprintf(stderr, "ServerWorkload: %d request(s) did not complete\n",
+                request_count - completed_);
+        return false;
+      }
+      if (!RunMessageLoopUntil(base::TimeTicks::Now() +
+                               base::TimeDelta::FromMilliseconds(1))) {
+        return false;
+      }
+    }
+    PrintResults(base::TimeTicks::Now() - start);
+    return true;
+  }
+
+ private:
+  struct Request {
+    ServerWorkload* workload = nullptr;
+    base::TimeTicks scheduled;
+    base::TimeDelta latency;
+    bool completed = false;
+    bool failed = false;
+  };
+
+  static void OnGCPrologue(Isolate*, GCType, GCCallbackFlags, void* data) {
+    static_cast<ServerWorkload*>(data)->gc_start_ = base::TimeTicks::Now();
+  }
+
+  static void OnGCEpilogue(Isolate*, GCType, GCCallbackFlags, void* data) {
+    ServerWorkload* workload = static_cast<ServerWorkload*>(data);
+    workload->gc_pauses_ms_.push_back(
+        (base::TimeTicks::Now() - workload->gc_start_).InMillisecondsF());
+  }
+
+  static void OnFulfilled(const FunctionCallbackInfo<Value>& info) {
+    OnSettled(info, false);
+  }
+
+  static void OnRejected(const FunctionCallbackInfo<Value>& info) {
+    OnSettled(info, true);
+  }
+
+  static void OnSettled(const FunctionCallbackInfo<Value>& info, bool failed) {
+    Request* request =
+        static_cast<Request*>(info.Data().As<External>()->Value());
+    request->workload->Complete(request, failed);
+  }
+
+  void Complete(Request* request, bool failed) {
+    DCHECK(!request->completed);
+    // Latency is measured from the scheduled time, so that time a request
+    // spent waiting for the main thread counts against it.
+    request->latency = base::TimeTicks::Now() - request->scheduled;
+    request->completed = true;
+    request->failed = failed;
+    completed_++;
+  }
+
+  // Runs tasks, including timers that have expired, until |until|.
+  bool RunMessageLoopUntil(base::TimeTicks until) {
+    while (true) {
+      if (!Shell::EmptyMessageQueues(isolate_)) return false;
+      base::TimeDelta remaining = until - base::TimeTicks::Now();
+      if (remaining <= base::TimeDelta()) return true;
+      base::OS::Sleep(
+          std::min(remaining, base::TimeDelta::FromMicroseconds(100)));
+    }
+  }
+
+  bool IssueRequest(const Global<Context>& global_context,
+                    Local<Function> handler, Request* request) {
+    HandleScope handle_scope(isolate_);
+    Local<Context> context = global_context.Get(isolate_);
+    // We cannot use a Context::Scope here, as the handler may run nested
+    // message loops, see RunMainIsolate.
+    context->Enter();
+    TryCatch try_catch(isolate_);
+    try_catch.SetVerbose(true);
+    Local<Value> argument = Integer::New(
+        isolate_, static_cast<int>(request - requests_.data()));
+    Local<Value> result;
+    bool ok = handler->Call(context, Undefined(isolate_), 1, &argument)
+                  .ToLocal(&result);
+    if (ok && result->IsPromise()) {
+      Local<External> data = External::New(isolate_, request);
+      Local<Function> on_fulfilled, on_rejected;
+      ok = Function::New(context, OnFulfilled, data).ToLocal(&on_fulfilled) &&
+           Function::New(context, OnRejected, data).ToLocal(&on_rejected) &&
+           !result.As<Promise>()
+                ->Then(context, on_fulfilled, on_rejected)
+                .IsEmpty();
+      if (!ok) Complete(request, true);
+    } else {
+      Complete(request, !ok);
+    }
+    context->Exit();
+    return !isolate_->IsExecutionTerminating();
+  }
+
+  void PrintResults(base::TimeDelta duration) {
+    std::vector<double> latencies_ms;
+    int failed = 0;
+    for (const Request& request : requests_) {
+      latencies_ms.push_back(request.latency.InMillisecondsF());
+      if (request.failed) failed++;
+    }
+    double total_gc_ms = 0;
+    for (double pause_ms : gc_pauses_ms_) total_gc_ms += pause_ms;
+
+    printf("ServerWorkload-Requests: %zu\n", requests_.size());
+    printf("ServerWorkload-Failed: %d\n", failed);
+    printf("ServerWorkload-Throughput: %.1f requests/s\n",
+           requests_.size() / duration.InSecondsF());
+    PrintDistribution("Latency", std::move(latencies_ms));
+    printf("ServerWorkload-GCPauses: %zu\n", gc_pauses_ms_.size());
+    printf("ServerWorkload-GCPauseTotal: %.3f ms\n", total_gc_ms);
+    PrintDistribution("GCPause", gc_pauses_ms_);
+  }
+
+  Isolate* const isolate_;
+  std::vector<Request> requests_;
+  int completed_ = 0;
+  base::TimeTicks gc_start_;
+  std::vector<double> gc_pauses_ms_;
+};
+
+}  // namespace
+
+bool Shell::RunServerWorkload(Isolate* isolate,
+                              const Global<Context>& context) {
+  HandleScope handle_scope(isolate);
+  Local<Context> local_context = context.Get(isolate);
+  Local<Value> handler;
+  if (!local_context->Global()
+           ->Get(local_context,
+                 String::NewFromUtf8Literal(isolate, "handleRequest"))
+           .ToLocal(&handler) ||
+      !handler->IsFunction()) {
+    fprintf(stderr,
+            "--server-workload requires a global function handleRequest\n");
+    return false;
+  }
+  ServerWorkload workload(isolate);
+  return workload.Run(context, handler.As<Function>());
+}
+
+}  // namespace v8
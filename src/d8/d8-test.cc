@@ -100,6 +100,137 @@ class FastCApiObject {
     CHECK_SELF_OR_THROW_SLOW();
     self->slow_call_count_++;
   }
+
+  static uint32_t SumBytes(const void* data, size_t byte_length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < byte_length; ++i) sum += bytes[i];
+    return sum;
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType SumViewBytesFastCallbackPatch(AnyCType receiver,
+                                                AnyCType view,
+                                                AnyCType options) {
+    AnyCType ret;
+    ret.uint32_value =
+        SumViewBytesFastCallback(receiver.object_value,
+                                 *view.array_buffer_view_value,
+                                 *options.options_value);
+    return ret;
+  }
+
+  static AnyCType SumBufferBytesFastCallbackPatch(AnyCType receiver,
+                                                  AnyCType buffer,
+                                                  AnyCType options) {
+    AnyCType ret;
+    ret.uint32_value = SumBufferBytesFastCallback(receiver.object_value,
+                                                  *buffer.array_buffer_value,
+                                                  *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static uint32_t SumViewBytesFastCallback(Local<Object> receiver,
+                                           const FastApiArrayBufferView& view,
+                                           FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_THROW_FAST_OPTIONS(0);
+    self->fast_call_count_++;
+
+    return SumBytes(view.data, view.byte_length);
+  }
+
+  static uint32_t SumBufferBytesFastCallback(Local<Object> receiver,
+                                             const FastApiArrayBuffer& buffer,
+                                             FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_THROW_FAST_OPTIONS(0);
+    self->fast_call_count_++;
+
+    return SumBytes(buffer.data, buffer.byte_length);
+  }
+
+  static void SumBytesSlowCallback(const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW_SLOW();
+    self->slow_call_count_++;
+
+    if (info.Length() < 1) {
+      info.GetIsolate()->ThrowError("Expected one argument.");
+      return;
+    }
+    uint32_t sum;
+    if (info[0]->IsArrayBufferView()) {
+      Local<ArrayBufferView> view = info[0].As<ArrayBufferView>();
+      sum = SumBytes(
+          static_cast<uint8_t*>(view->Buffer()->Data()) + view->ByteOffset(),
+          view->ByteLength());
+    } else if (info[0]->IsArrayBuffer()) {
+      Local<ArrayBuffer> buffer = info[0].As<ArrayBuffer>();
+      sum = SumBytes(buffer->Data(), buffer->ByteLength());
+    } else {
+      info.GetIsolate()->ThrowError(
+          "Expected an ArrayBufferView or an ArrayBuffer.");
+      return;
+    }
+    info.GetReturnValue().Set(sum);
+  }
+
+  static Local<Object> CreatePoint(Isolate* isolate, int32_t x, int32_t y) {
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Object> point = Object::New(isolate);
+    point
+        ->Set(context, String::NewFromUtf8Literal(isolate, "x"),
+              Integer::New(isolate, x))
+        .Check();
+    point
+        ->Set(context, String::NewFromUtf8Literal(isolate, "y"),
+              Integer::New(isolate, y))
+        .Check();
+    return point;
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType CreatePointFastCallbackPatch(AnyCType receiver, AnyCType x,
+                                               AnyCType y, AnyCType options) {
+    AnyCType ret;
+    ret.object_value =
+        CreatePointFastCallback(receiver.object_value, x.int32_value,
+                                y.int32_value, *options.options_value)
+            .As<Object>();
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static Local<Value> CreatePointFastCallback(Local<Object> receiver,
+                                              int32_t x, int32_t y,
+                                              FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_THROW_FAST_OPTIONS(Local<Value>());
+    self->fast_call_count_++;
+
+    // V8 provides the handle scope for the returned value.
+    return CreatePoint(options.isolate, x, y);
+  }
+
+  static void CreatePointSlowCallback(const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    Isolate* isolate = info.GetIsolate();
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW_SLOW();
+    self->slow_call_count_++;
+
+    Local<Context> context = isolate->GetCurrentContext();
+    int32_t x = 0;
+    int32_t y = 0;
+    if (!info[0]->Int32Value(context).To(&x) ||
+        !info[1]->Int32Value(context).To(&y)) {
+      return;
+    }
+    info.GetReturnValue().Set(CreatePoint(isolate, x, y));
+  }
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAllFastCallbackPatch(AnyCType receiver,
                                           AnyCType arg_i32, AnyCType arg_u32,
@@ -1450,6 +1581,36 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
                               ConstructorBehavior::kThrow,
                               SideEffectType::kHasSideEffect, &copy_str_func));
 
+    CFunction sum_view_bytes_c_func = CFunction::Make(
+        FastCApiObject::SumViewBytesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::SumViewBytesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_view_bytes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumBytesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasNoSideEffect, &sum_view_bytes_c_func));
+
+    CFunction sum_buffer_bytes_c_func = CFunction::Make(
+        FastCApiObject::SumBufferBytesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::SumBufferBytesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_buffer_bytes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumBytesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasNoSideEffect, &sum_buffer_bytes_c_func));
+
+    CFunction create_point_c_func = CFunction::Make(
+        FastCApiObject::CreatePointFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::CreatePointFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "create_point",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::CreatePointSlowCallback, Local<Value>(),
+            signature, 2, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &create_point_c_func));
+
     CFunction add_all_c_func =
         CFunction::Make(FastCApiObject::AddAllFastCallback V8_IF_USE_SIMULATOR(
             FastCApiObject::AddAllFastCallbackPatch));
@@ -2847,8 +2847,19 @@ void Shell::SetTimeout(const v8::FunctionCallbackInfo<v8::Value>& info) {
   if (info.Length() == 0 || !info[0]->IsFunction()) return;
   Local<Function> callback = info[0].As<Function>();
   Local<Context> context = isolate->GetCurrentContext();
-  g_platform->GetForegroundTaskRunner(isolate)->PostTask(
-      std::make_unique<SetTimeoutTask>(isolate, context, callback));
+  std::shared_ptr<TaskRunner> task_runner =
+      g_platform->GetForegroundTaskRunner(isolate);
+  auto task = std::make_unique<SetTimeoutTask>(isolate, context, callback);
+  // The delay is ignored by default, which keeps tests fast and
+  // deterministic. Server workloads use timers to simulate I/O latency.
+  double delay_ms = 0;
+  if (options.server_workload && info.Length() > 1 &&
+      info[1]->NumberValue(context).To(&delay_ms) && delay_ms > 0) {
+    task_runner->PostDelayedTask(
+        std::move(task), delay_ms / base::Time::kMillisecondsPerSecond);
+    return;
+  }
+  task_runner->PostTask(std::move(task));
 }
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
@@ -5423,6 +5434,8 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.enable_os_system = true;
     } else if (FlagMatches("--no-apply-priority", &argv[i])) {
       options.apply_priority = false;
+    } else if (FlagMatches("--adaptive-job-concurrency", &argv[i])) {
+      options.adaptive_job_concurrency = true;
     } else if (FlagMatches("--quiet-load", &argv[i])) {
       options.quiet_load = true;
     } else if (FlagWithArgMatches("--thread-pool-size", &flag_value, argc, argv,
@@ -5480,6 +5493,14 @@ bool Shell::SetOptions(int argc, char* argv[]) {
 #endif  // V8_ENABLE_WEBASSEMBLY
     } else if (FlagMatches("--expose-fast-api", &argv[i])) {
       options.expose_fast_api = true;
+    } else if (FlagMatches("--server-workload", &argv[i])) {
+      options.server_workload = true;
+    } else if (FlagWithArgMatches("--server-workload-requests", &flag_value,
+                                  argc, argv, &i)) {
+      options.server_workload_requests = atoi(flag_value);
+    } else if (FlagWithArgMatches("--server-workload-rps", &flag_value, argc,
+                                  argv, &i)) {
+      options.server_workload_rps = atoi(flag_value);
     } else {
 #ifdef V8_TARGET_OS_WIN
       PreProcessUnicodeFilenameArg(argv, i);
@@ -5663,6 +5684,10 @@ bool Shell::RunMainIsolate(v8::Isolate* isolate, bool keep_context_alive) {
     if (!options.isolate_sources[0].Execute(isolate)) success = false;
     global_context.Get(isolate)->Exit();
   }
+  if (success && options.server_workload &&
+      !RunServerWorkload(isolate, global_context)) {
+    success = false;
+  }
   if (!FinishExecuting(isolate, global_context)) success = false;
   WriteLcovData(isolate, options.lcov_file);
   return success;
@@ -6206,7 +6231,10 @@ int Shell::Main(int argc, char* argv[]) {
         options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
         in_process_stack_dumping, std::move(tracing),
         options.apply_priority ? v8::platform::PriorityMode::kApply
-                               : v8::platform::PriorityMode::kDontApply);
+                               : v8::platform::PriorityMode::kDontApply,
+        options.adaptive_job_concurrency
+            ? v8::platform::JobConcurrencyMode::kAdaptive
+            : v8::platform::JobConcurrencyMode::kFixed);
   }
   g_default_platform = g_platform.get();
   if (i::v8_flags.predictable) {
@@ -492,6 +492,8 @@ class ShellOptions {
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<bool> apply_priority = {"apply-priority", true};
+  DisallowReassignment<bool> adaptive_job_concurrency = {
+      "adaptive-job-concurrency", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
@@ -512,6 +514,12 @@ class ShellOptions {
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> expose_fast_api = {"expose-fast-api", false};
+  // Calls the global handleRequest() function at a fixed rate after the main
+  // script ran, and reports latency and GC pause statistics.
+  DisallowReassignment<bool> server_workload = {"server-workload", false};
+  DisallowReassignment<int> server_workload_requests = {
+      "server-workload-requests", 1000};
+  DisallowReassignment<int> server_workload_rps = {"server-workload-rps", 100};
   DisallowReassignment<size_t> max_serializer_memory = {"max-serializer-memory",
                                                         1 * i::MB};
 };
@@ -551,6 +559,8 @@ class Shell : public i::AllStatic {
   static bool EmptyMessageQueues(Isolate* isolate);
   static bool CompleteMessageLoop(Isolate* isolate);
   static bool FinishExecuting(Isolate* isolate, const Global<Context>& context);
+  static bool RunServerWorkload(Isolate* isolate,
+                                const Global<Context>& context);
 
   static bool HandleUnhandledPromiseRejections(Isolate* isolate);
 
@@ -1813,6 +1813,13 @@ void Debug::PrepareFunctionForDebugExecution(
     // Deopt everything in case the function is inlined anywhere.
     Deoptimizer::DeoptimizeAll(isolate_);
     DiscardAllBaselineCode();
+  } else if (v8_flags.breakpoint_entry_checks) {
+    // Optimized code containing the function deoptimizes itself the next time
+    // it enters the function. Only code that is currently running the function
+    // has to be deoptimized now.
+    if (shared->HasBaselineCode()) DiscardBaselineCode(*shared);
+    SetBreakpointEntryCheck(*shared, true);
+    Deoptimizer::DeoptimizeActiveCodeWithFunction(isolate_, shared);
   } else {
     DeoptimizeFunction(shared);
   }
@@ -2436,6 +2443,24 @@ bool Debug::HasBreakInfo(Tagged<SharedFunctionInfo> sfi) {
   return false;
 }
 
+Address Debug::BreakpointEntryCheckAddress(Tagged<SharedFunctionInfo> sfi) {
+  DCHECK(v8_flags.breakpoint_entry_checks);
+  base::MutexGuard guard(&breakpoint_entry_checks_mutex_);
+  std::unique_ptr<uint8_t>& check = breakpoint_entry_checks_[sfi->unique_id()];
+  if (!check) check = std::make_unique<uint8_t>(0);
+  return reinterpret_cast<Address>(check.get());
+}
+
+void Debug::SetBreakpointEntryCheck(Tagged<SharedFunctionInfo> sfi,
+                                    bool value) {
+  if (!v8_flags.breakpoint_entry_checks) return;
+  base::MutexGuard guard(&breakpoint_entry_checks_mutex_);
+  auto it = breakpoint_entry_checks_.find(sfi->unique_id());
+  // Without a check, no optimized code contains the function.
+  if (it == breakpoint_entry_checks_.end()) return;
+  *it->second = value ? 1 : 0;
+}
+
 bool Debug::BreakAtEntry(Tagged<SharedFunctionInfo> sfi) {
   if (std::optional<Tagged<DebugInfo>> debug_info = TryGetDebugInfo(sfi)) {
     return debug_info.value()->BreakAtEntry();
@@ -282,6 +282,14 @@ class V8_EXPORT_PRIVATE Debug {
   bool HasBreakInfo(Tagged<SharedFunctionInfo> sfi);
   bool BreakAtEntry(Tagged<SharedFunctionInfo> sfi);
 
+  // With --breakpoint-entry-checks, Maglev and Turbofan code loads an off-heap
+  // byte on entry to every function it contains, including inlined ones, and
+  // deoptimizes if it is set. Returns the address of that byte for the given
+  // function, allocating it on first use. Can be called from background
+  // compile threads.
+  Address BreakpointEntryCheckAddress(Tagged<SharedFunctionInfo> sfi);
+  void SetBreakpointEntryCheck(Tagged<SharedFunctionInfo> sfi, bool value);
+
   // Break point handling.
   enum BreakPointKind { kRegular, kInstrumentation };
   bool SetBreakpoint(Handle<SharedFunctionInfo> shared,
@@ -615,6 +623,13 @@ class V8_EXPORT_PRIVATE Debug {
   // List of active debug info objects.
   DebugInfoCollection debug_infos_;
 
+  // Bytes checked by optimized code on function entry, keyed by
+  // SharedFunctionInfo::unique_id. They are never freed, since code embeds
+  // their addresses.
+  base::Mutex breakpoint_entry_checks_mutex_;
+  std::unordered_map<uint32_t, std::unique_ptr<uint8_t>>
+      breakpoint_entry_checks_;
+
   // Used for side effect check to mark temporary objects.
   class TemporaryObjectsTracker;
   std::unique_ptr<TemporaryObjectsTracker> temporary_objects_;
@@ -0,0 +1,228 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-history.h"
+
+#include <algorithm>
+
+#include "src/diagnostics/code-tracer.h"
+#include "src/execution/frames-inl.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/hash-table-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Each entry of the history of a function is a pair of Smis: the bytecode
+// offset and the reason of a deopt. The most recent deopt comes first.
+constexpr int kEntrySize = 2;
+constexpr int kBytecodeOffsetIndex = 0;
+constexpr int kReasonIndex = 1;
+
+// Deopts which happen when an object doesn't have the map, type or elements
+// that the feedback of a property access predicted.
+bool IsPropertyAccessDeopt(DeoptimizeReason reason) {
+  switch (reason) {
+    case DeoptimizeReason::kHole:
+    case DeoptimizeReason::kOutOfBounds:
+    case DeoptimizeReason::kSmi:
+    case DeoptimizeReason::kWrongInstanceType:
+    case DeoptimizeReason::kWrongMap:
+    case DeoptimizeReason::kWrongName:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Deopts which happen when the inputs or the result of an operation don't have
+// the type that its feedback predicted.
+bool IsOperationDeopt(DeoptimizeReason reason) {
+  switch (reason) {
+    case DeoptimizeReason::kBigIntTooBig:
+    case DeoptimizeReason::kDivisionByZero:
+    case DeoptimizeReason::kLostPrecision:
+    case DeoptimizeReason::kLostPrecisionOrNaN:
+    case DeoptimizeReason::kMinusZero:
+    case DeoptimizeReason::kNaN:
+    case DeoptimizeReason::kNotABigInt:
+    case DeoptimizeReason::kNotABigInt64:
+    case DeoptimizeReason::kNotAHeapNumber:
+    case DeoptimizeReason::kNotANumber:
+    case DeoptimizeReason::kNotANumberOrBoolean:
+    case DeoptimizeReason::kNotANumberOrOddball:
+    case DeoptimizeReason::kNotASmi:
+    case DeoptimizeReason::kNotAString:
+    case DeoptimizeReason::kNotAStringOrStringWrapper:
+    case DeoptimizeReason::kNotASymbol:
+    case DeoptimizeReason::kNotInt32:
+    case DeoptimizeReason::kNotUint32:
+    case DeoptimizeReason::kOverflow:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns the feedback slot of the bytecode at the current offset of {it}, or
+// an invalid slot if the bytecode has no feedback that can be generalized.
+FeedbackSlot GetFeedbackSlot(const interpreter::BytecodeArrayIterator& it) {
+  using interpreter::Bytecode;
+  switch (it.current_bytecode()) {
+    case Bytecode::kInc:
+    case Bytecode::kDec:
+    case Bytecode::kNegate:
+    case Bytecode::kBitwiseNot:
+      return it.GetSlotOperand(0);
+    case Bytecode::kGetKeyedProperty:
+    case Bytecode::kAdd:
+    case Bytecode::kSub:
+    case Bytecode::kMul:
+    case Bytecode::kDiv:
+    case Bytecode::kMod:
+    case Bytecode::kExp:
+    case Bytecode::kBitwiseOr:
+    case Bytecode::kBitwiseXor:
+    case Bytecode::kBitwiseAnd:
+    case Bytecode::kShiftLeft:
+    case Bytecode::kShiftRight:
+    case Bytecode::kShiftRightLogical:
+    case Bytecode::kAddSmi:
+    case Bytecode::kSubSmi:
+    case Bytecode::kMulSmi:
+    case Bytecode::kDivSmi:
+    case Bytecode::kModSmi:
+    case Bytecode::kExpSmi:
+    case Bytecode::kBitwiseOrSmi:
+    case Bytecode::kBitwiseXorSmi:
+    case Bytecode::kBitwiseAndSmi:
+    case Bytecode::kShiftLeftSmi:
+    case Bytecode::kShiftRightSmi:
+    case Bytecode::kShiftRightLogicalSmi:
+    case Bytecode::kTestEqual:
+    case Bytecode::kTestEqualStrict:
+    case Bytecode::kTestLessThan:
+    case Bytecode::kTestGreaterThan:
+    case Bytecode::kTestLessThanOrEqual:
+    case Bytecode::kTestGreaterThanOrEqual:
+      return it.GetSlotOperand(1);
+    case Bytecode::kGetNamedProperty:
+    case Bytecode::kStarGetNamedProperty:
+    case Bytecode::kSetNamedProperty:
+    case Bytecode::kDefineNamedOwnProperty:
+    case Bytecode::kSetKeyedProperty:
+      return it.GetSlotOperand(2);
+    case Bytecode::kDefineKeyedOwnProperty:
+      return it.GetSlotOperand(3);
+    default:
+      return FeedbackSlot::Invalid();
+  }
+}
+
+// Generalizes the feedback of {nexus} if it is what a deopt for {reason}
+// speculated on. Returns true if the feedback was changed.
+bool GeneralizeFeedback(FeedbackNexus& nexus, DeoptimizeReason reason) {
+  FeedbackSlotKind kind = nexus.kind();
+  if (IsLoadICKind(kind) || IsSetNamedICKind(kind) ||
+      IsDefineNamedOwnICKind(kind)) {
+    return IsPropertyAccessDeopt(reason) && nexus.ConfigureMegamorphic();
+  }
+  if (IsKeyedLoadICKind(kind) || IsKeyedStoreICKind(kind) ||
+      IsDefineKeyedOwnICKind(kind)) {
+    return IsPropertyAccessDeopt(reason) &&
+           nexus.ConfigureMegamorphic(IcCheckType::kElement);
+  }
+  if (kind == FeedbackSlotKind::kBinaryOp ||
+      kind == FeedbackSlotKind::kCompareOp) {
+    if (!IsOperationDeopt(reason)) return false;
+    nexus.ConfigureGenericOperation();
+    return true;
+  }
+  return false;
+}
+
+bool GeneralizeFeedbackOfFrame(Isolate* isolate, UnoptimizedFrame* frame,
+                               DeoptimizeReason reason) {
+  Tagged<JSFunction> function = frame->function();
+  if (!function->has_feedback_vector()) return false;
+  Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+  interpreter::BytecodeArrayIterator it(
+      handle(frame->GetBytecodeArray(), isolate), frame->GetBytecodeOffset());
+  FeedbackSlot slot = GetFeedbackSlot(it);
+  if (slot.IsInvalid()) return false;
+  FeedbackNexus nexus(isolate, vector, slot);
+  return GeneralizeFeedback(nexus, reason);
+}
+
+}  // namespace
+
+// static
+bool DeoptHistory::RecordDeopt(Isolate* isolate, UnoptimizedFrame* frame,
+                               DeoptimizeReason reason) {
+  // Only remember deopts that can be avoided by generalizing feedback.
+  if (!IsPropertyAccessDeopt(reason) && !IsOperationDeopt(reason)) {
+    return false;
+  }
+
+  Handle<SharedFunctionInfo> shared(frame->function()->shared(), isolate);
+  const int bytecode_offset = frame->GetBytecodeOffset();
+
+  Handle<EphemeronHashTable> table;
+  if (IsEphemeronHashTable(isolate->heap()->deopt_history_table())) {
+    table = handle(
+        Cast<EphemeronHashTable>(isolate->heap()->deopt_history_table()),
+        isolate);
+  } else {
+    CHECK(IsUndefined(isolate->heap()->deopt_history_table()));
+    constexpr int kInitialCapacity = 8;
+    table = EphemeronHashTable::New(isolate, kInitialCapacity);
+  }
+
+  Handle<FixedArray> entries;
+  Tagged<Object> maybe_entries = table->Lookup(shared);
+  int length = 0;
+  if (IsFixedArray(maybe_entries)) {
+    entries = handle(Cast<FixedArray>(maybe_entries), isolate);
+    length = entries->length();
+  }
+
+  for (int i = 0; i < length; i += kEntrySize) {
+    if (Smi::ToInt(entries->get(i + kBytecodeOffsetIndex)) ==
+            bytecode_offset &&
+        Smi::ToInt(entries->get(i + kReasonIndex)) ==
+            static_cast<int>(reason)) {
+      bool generalized = GeneralizeFeedbackOfFrame(isolate, frame, reason);
+      if (v8_flags.trace_deopt_loops) {
+        CodeTracer::Scope scope(isolate->GetCodeTracer());
+        PrintF(scope.file(), "[deopt loop in ");
+        ShortPrint(*shared, scope.file());
+        PrintF(scope.file(), " at bytecode offset %d, reason: %s, %s]\n",
+               bytecode_offset, DeoptimizeReasonToString(reason),
+               generalized ? "generalized feedback"
+                           : "no feedback to generalize");
+      }
+      return generalized;
+    }
+  }
+
+  // Remember this deopt, and drop the oldest one if the history is full.
+  DirectHandle<FixedArray> new_entries = isolate->factory()->NewFixedArray(
+      std::min(length + kEntrySize, kMaxEntries * kEntrySize));
+  new_entries->set(kBytecodeOffsetIndex, Smi::FromInt(bytecode_offset));
+  new_entries->set(kReasonIndex, Smi::FromInt(static_cast<int>(reason)));
+  for (int i = kEntrySize; i < new_entries->length(); i++) {
+    new_entries->set(i, entries->get(i - kEntrySize));
+  }
+  table = EphemeronHashTable::Put(table, shared, new_entries);
+  isolate->heap()->SetDeoptHistoryTable(*table);
+  return false;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+#define V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+
+#include "src/deoptimizer/deoptimize-reason.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class UnoptimizedFrame;
+
+// Remembers the last few eager deopts of each function, keyed by the bytecode
+// offset and the reason of the deopt. The history lives in an ephemeron table
+// on the heap, so it doesn't keep the functions alive.
+//
+// A deopt that matches a remembered one means that the function was optimized
+// again with the same speculation that failed before. In this case the
+// feedback of the bytecode that deopted is generalized, so that the next
+// optimization of the function, with either Maglev or Turbofan, doesn't
+// speculate on it again.
+class DeoptHistory final {
+ public:
+  // Records a deopt of the bytecode that {frame} is about to (re-)execute.
+  // Returns true if this was a repeated deopt and the feedback of its
+  // bytecode was generalized.
+  static bool RecordDeopt(Isolate* isolate, UnoptimizedFrame* frame,
+                          DeoptimizeReason reason);
+
+  // The number of deopts remembered per function.
+  static constexpr int kMaxEntries = 4;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_HISTORY_H_
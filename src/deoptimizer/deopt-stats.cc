@@ -0,0 +1,121 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-stats.h"
+
+#include "src/base/functional.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/deoptimization-data-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+int ScriptId(Tagged<SharedFunctionInfo> shared) {
+  Tagged<Object> script = shared->script();
+  return IsScript(script) ? Cast<Script>(script)->id() : -1;
+}
+
+}  // namespace
+
+size_t DeoptStats::KeyHash::operator()(const Key& key) const {
+  return base::hash_combine(key.script_id, key.position, key.kind,
+                            key.reason);
+}
+
+void DeoptStats::RecordDeopt(Tagged<Code> code, SourcePosition position,
+                             DeoptimizeKind kind, DeoptimizeReason reason) {
+  DisallowGarbageCollection no_gc;
+  MaybeDecay();
+  // Attribute the deopt to the innermost function, so that deopts in inlined
+  // functions show up at the position in their own source.
+  Tagged<DeoptimizationData> deopt_data =
+      Cast<DeoptimizationData>(code->deoptimization_data());
+  Tagged<SharedFunctionInfo> shared =
+      deopt_data->GetInlinedFunction(DeoptimizationData::kNotInlinedIndex);
+  if (position.isInlined()) {
+    InliningPosition inlining =
+        deopt_data->InliningPositions()->get(position.InliningId());
+    shared = deopt_data->GetInlinedFunction(inlining.inlined_function_id);
+  }
+  const int script_offset =
+      position.IsKnown() ? position.ScriptOffset() : kNoSourcePosition;
+  Key key{ScriptId(shared), script_offset, static_cast<int>(kind),
+          static_cast<int>(reason)};
+  auto it = deopts_.find(key);
+  if (it == deopts_.end()) {
+    // Positions that keep deopting make it in once the next decay drops the
+    // ones that stopped.
+    if (deopts_.size() >= kMaxEntries) return;
+    Deopt deopt;
+    deopt.function_name = shared->DebugNameCStr().get();
+    deopt.script_id = key.script_id;
+    deopt.position = script_offset;
+    deopt.kind = kind;
+    deopt.reason = reason;
+    deopt.count = 0;
+    it = deopts_.emplace(key, std::move(deopt)).first;
+  }
+  it->second.count++;
+}
+
+void DeoptStats::RecordBailout(Tagged<SharedFunctionInfo> shared,
+                               CodeKind tier, BailoutReason reason) {
+  MaybeDecay();
+  Key key{ScriptId(shared), shared->StartPosition(), static_cast<int>(tier),
+          static_cast<int>(reason)};
+  auto it = bailouts_.find(key);
+  if (it == bailouts_.end()) {
+    if (bailouts_.size() >= kMaxEntries) return;
+    Bailout bailout;
+    bailout.function_name = shared->DebugNameCStr().get();
+    bailout.script_id = key.script_id;
+    bailout.position = key.position;
+    bailout.tier = tier;
+    bailout.reason = reason;
+    bailout.count = 0;
+    it = bailouts_.emplace(key, std::move(bailout)).first;
+  }
+  it->second.count++;
+}
+
+std::vector<DeoptStats::Deopt> DeoptStats::GetDeopts() const {
+  std::vector<Deopt> result;
+  result.reserve(deopts_.size());
+  for (const auto& [key, deopt] : deopts_) result.push_back(deopt);
+  return result;
+}
+
+std::vector<DeoptStats::Bailout> DeoptStats::GetBailouts() const {
+  std::vector<Bailout> result;
+  result.reserve(bailouts_.size());
+  for (const auto& [key, bailout] : bailouts_) result.push_back(bailout);
+  return result;
+}
+
+// static
+template <typename Entry>
+void DeoptStats::Decay(std::unordered_map<Key, Entry, KeyHash>* entries) {
+  for (auto it = entries->begin(); it != entries->end();) {
+    it->second.count /= 2;
+    if (it->second.count == 0) {
+      it = entries->erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void DeoptStats::MaybeDecay() {
+  if (--records_until_decay_ > 0) return;
+  records_until_decay_ = kDecayInterval;
+  Decay(&deopts_);
+  Decay(&bailouts_);
+}
+
+}  // namespace internal
+}  // namespace v8
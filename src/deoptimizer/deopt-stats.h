@@ -0,0 +1,96 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_STATS_H_
+#define V8_DEOPTIMIZER_DEOPT_STATS_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/codegen/bailout-reason.h"
+#include "src/codegen/source-position.h"
+#include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/objects/code-kind.h"
+
+namespace v8 {
+namespace internal {
+
+class Code;
+class SharedFunctionInfo;
+template <typename T>
+class Tagged;
+
+// Aggregates the deopts of an isolate per source position and reason, and the
+// optimization bailouts per function and reason, enabled by --deopt-stats.
+// Unlike --trace-deopt, it keeps a bounded summary: all counts are halved
+// periodically, and entries whose counts decay to zero are dropped.
+class DeoptStats final {
+ public:
+  struct Deopt {
+    std::string function_name;
+    int script_id;
+    // The position of the deopt in the innermost (inlined) function, or
+    // kNoSourcePosition.
+    int position;
+    DeoptimizeKind kind;
+    DeoptimizeReason reason;
+    uint64_t count;
+  };
+
+  struct Bailout {
+    std::string function_name;
+    int script_id;
+    // The start position of the function.
+    int position;
+    CodeKind tier;
+    BailoutReason reason;
+    uint64_t count;
+  };
+
+  // Records a deopt of {code} at {position}, as found by
+  // Deoptimizer::GetDeoptInfo.
+  void RecordDeopt(Tagged<Code> code, SourcePosition position,
+                   DeoptimizeKind kind, DeoptimizeReason reason);
+  // Records a failed optimization of {shared} for {tier}.
+  void RecordBailout(Tagged<SharedFunctionInfo> shared, CodeKind tier,
+                     BailoutReason reason);
+
+  std::vector<Deopt> GetDeopts() const;
+  std::vector<Bailout> GetBailouts() const;
+
+ private:
+  struct Key {
+    int script_id;
+    int position;
+    // The kind and reason of a deopt, or the tier and reason of a bailout.
+    int kind;
+    int reason;
+    bool operator==(const Key& other) const {
+      return script_id == other.script_id && position == other.position &&
+             kind == other.kind && reason == other.reason;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static constexpr size_t kMaxEntries = 1024;
+  // All counts are halved after this many deopts and bailouts.
+  static constexpr uint64_t kDecayInterval = 4 * 1024;
+
+  void MaybeDecay();
+  template <typename Entry>
+  static void Decay(std::unordered_map<Key, Entry, KeyHash>* entries);
+
+  std::unordered_map<Key, Deopt, KeyHash> deopts_;
+  std::unordered_map<Key, Bailout, KeyHash> bailouts_;
+  uint64_t records_until_decay_ = kDecayInterval;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_STATS_H_
@@ -509,6 +509,52 @@ void Deoptimizer::DeoptimizeAllOptimizedCodeWithFunction(
   }
 }
 
+namespace {
+
+class ActiveCodeWithFunctionMarker : public ThreadVisitor {
+ public:
+  explicit ActiveCodeWithFunctionMarker(Tagged<SharedFunctionInfo> function)
+      : function_(function) {}
+
+  void VisitThread(Isolate* isolate, ThreadLocalTop* top) override {
+    for (StackFrameIterator it(isolate, top); !it.done(); it.Advance()) {
+      if (!it.frame()->is_optimized()) continue;
+      Tagged<Code> code = it.frame()->LookupCode();
+      if (CodeKindCanDeoptimize(code->kind()) && code->Inlines(function_)) {
+        code->set_marked_for_deoptimization(true);
+        any_marked_ = true;
+      }
+    }
+  }
+
+  bool any_marked() const { return any_marked_; }
+
+ private:
+  Tagged<SharedFunctionInfo> function_;
+  bool any_marked_ = false;
+  DISALLOW_GARBAGE_COLLECTION(no_gc_)
+};
+
+}  // namespace
+
+void Deoptimizer::DeoptimizeActiveCodeWithFunction(
+    Isolate* isolate, DirectHandle<SharedFunctionInfo> function) {
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kDeoptimizeCode);
+  TimerEventScope<TimerEventDeoptimizeCode> timer(isolate);
+  TRACE_EVENT0("v8", "V8.DeoptimizeActiveCodeWithFunction");
+
+  bool any_marked;
+  {
+    ActiveCodeWithFunctionMarker marker(*function);
+    marker.VisitThread(isolate, isolate->thread_local_top());
+    isolate->thread_manager()->IterateArchivedThreads(&marker);
+    any_marked = marker.any_marked();
+  }
+  if (any_marked) {
+    DeoptimizeMarkedCode(isolate);
+  }
+}
+
 void Deoptimizer::ComputeOutputFrames(Deoptimizer* deoptimizer) {
   deoptimizer->DoComputeOutputFrames();
 }
@@ -113,6 +113,13 @@ class Deoptimizer : public Malloced {
   static void DeoptimizeAllOptimizedCodeWithFunction(
       Isolate* isolate, DirectHandle<SharedFunctionInfo> function);
 
+  // Deoptimizes the optimized code of all frames on the stack that implement
+  // the given function (whether directly or inlined). Unlike
+  // DeoptimizeAllOptimizedCodeWithFunction, code that is not running is left
+  // alone.
+  static void DeoptimizeActiveCodeWithFunction(
+      Isolate* isolate, DirectHandle<SharedFunctionInfo> function);
+
   // Check the given address against a list of allowed addresses, to prevent a
   // potential attacker from using the frame creation process in the
   // deoptimizer, in particular the signing process, to gain control over the
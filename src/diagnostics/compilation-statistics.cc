@@ -4,6 +4,7 @@
 
 #include "src/diagnostics/compilation-statistics.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <ostream>
 #include <vector>
@@ -48,6 +49,24 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.count_++;
 }
 
+void CompilationStatistics::RecordRegisterAllocationStats(
+    bool fast_mode, const RegisterAllocationStats& stats) {
+  base::MutexGuard guard(&record_mutex_);
+  if (fast_mode) {
+    fast_register_allocation_stats_.Accumulate(stats);
+  } else {
+    register_allocation_stats_.Accumulate(stats);
+  }
+}
+
+void CompilationStatistics::RegisterAllocationStats::Accumulate(
+    const RegisterAllocationStats& stats) {
+  function_count_ += stats.function_count_;
+  instruction_count_ += stats.instruction_count_;
+  gap_move_count_ += stats.gap_move_count_;
+  spill_slot_count_ += stats.spill_slot_count_;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -147,6 +166,37 @@ static void WritePhaseKindBreak(std::ostream& os) {
         "-----------------------------------------------------------\n";
 }
 
+static void WriteRegisterAllocationLine(
+    std::ostream& os, bool machine_format, const char* name,
+    const char* compiler,
+    const CompilationStatistics::RegisterAllocationStats& stats) {
+  if (stats.function_count_ == 0) return;
+  const size_t kBufferSize = 192;
+  char buffer[kBufferSize];
+
+  // Gap moves and spill slots per 1000 instructions.
+  double moves_per_instruction = 1000.0 * stats.gap_move_count_ /
+                                 std::max<size_t>(stats.instruction_count_, 1);
+  double slots_per_instruction = 1000.0 * stats.spill_slot_count_ /
+                                 std::max<size_t>(stats.instruction_count_, 1);
+  if (machine_format) {
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "\"%s_%s_functions\"=%zu\n\"%s_%s_instructions\"=%zu\n"
+                       "\"%s_%s_gap_moves\"=%zu\n\"%s_%s_spill_slots\"=%zu\n",
+                       compiler, name, stats.function_count_, compiler, name,
+                       stats.instruction_count_, compiler, name,
+                       stats.gap_move_count_, compiler, name,
+                       stats.spill_slot_count_);
+  } else {
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "%34s %10zu %12zu %10zu (%6.1f) %10zu (%6.1f)\n", name,
+                       stats.function_count_, stats.instruction_count_,
+                       stats.gap_move_count_, moves_per_instruction,
+                       stats.spill_slot_count_, slots_per_instruction);
+  }
+  os << buffer;
+}
+
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   // phase_kind_map_ and phase_map_ don't get mutated, so store a bunch of
   // pointers into them.
@@ -186,6 +236,20 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
     os << '\n';
   }
 
+  if (s.register_allocation_stats_.function_count_ != 0 ||
+      s.fast_register_allocation_stats_.function_count_ != 0) {
+    if (!ps.machine_output) {
+      WriteFullLine(os);
+      os << std::setw(34) << "Register allocation"
+         << "  Functions Instructions  Gap moves (/1000)  Spill slots (/1000)\n";
+    }
+    WriteRegisterAllocationLine(os, ps.machine_output, "regalloc",
+                                ps.compiler, s.register_allocation_stats_);
+    WriteRegisterAllocationLine(os, ps.machine_output, "fast_regalloc",
+                                ps.compiler,
+                                s.fast_register_allocation_stats_);
+  }
+
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", ps.compiler, s.total_stats_,
             s.total_stats_);
@@ -53,6 +53,20 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Measures the code quality of register allocation, separately for the
+  // regular and the fast mode.
+  struct RegisterAllocationStats {
+    void Accumulate(const RegisterAllocationStats& stats);
+
+    size_t function_count_ = 0;
+    size_t instruction_count_ = 0;
+    size_t gap_move_count_ = 0;
+    size_t spill_slot_count_ = 0;
+  };
+
+  void RecordRegisterAllocationStats(bool fast_mode,
+                                     const RegisterAllocationStats& stats);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -84,6 +98,8 @@ class CompilationStatistics final : public Malloced {
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  RegisterAllocationStats register_allocation_stats_;
+  RegisterAllocationStats fast_register_allocation_stats_;
   base::Mutex record_mutex_;
 };
 
@@ -2113,6 +2113,7 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
   CHECK(IsSmi(TaggedField<Object>::load(*this, kMaxRegisterCountOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kCaptureCountOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kTicksUntilTierUpOffset)));
+  CHECK(IsSmi(TaggedField<Object>::load(*this, kTierUpWorkOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kBacktrackLimitOffset)));
 
   switch (type_tag()) {
@@ -2152,6 +2153,7 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
       } else {
         CHECK_EQ(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
       }
+      CHECK_GE(tier_up_work(), 0);
       CHECK_GE(backtrack_limit(), 0);
 
       break;
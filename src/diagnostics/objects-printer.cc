@@ -903,6 +903,7 @@ void IrRegExpData::IrRegExpDataPrint(std::ostream& os) {
   os << "\n - max_register_count: " << max_register_count();
   os << "\n - capture_count: " << max_register_count();
   os << "\n - ticks_until_tier_up: " << max_register_count();
+  os << "\n - tier_up_work: " << tier_up_work();
   os << "\n - backtrack_limit: " << max_register_count();
   os << "\n";
 }
@@ -3021,6 +3022,8 @@ void JSCollator::JSCollatorPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSCollator");
   os << "\n - icu collator: " << Brief(icu_collator());
   os << "\n - bound compare: " << Brief(bound_compare());
+  os << "\n - compare strings options: "
+     << static_cast<int>(compare_strings_options());
   JSObjectPrintBody(os, *this);
 }
 
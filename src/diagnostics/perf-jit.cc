@@ -38,11 +38,14 @@
 #include <unistd.h>
 
 #include <memory>
+#include <unordered_map>
 
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
+#include "src/diagnostics/perf-output-writer.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -61,6 +64,18 @@ base::LazyRecursiveMutex& GetFileMutex() {
   return file_mutex;
 }
 
+struct LoadedCode {
+  uint64_t code_id;
+  uint32_t code_size;
+};
+
+// Code that can still be moved by compaction, by instruction start. Protected
+// by GetFileMutex().
+std::unordered_map<Address, LoadedCode>& GetMovableCode() {
+  static base::LeakyObject<std::unordered_map<Address, LoadedCode>> code;
+  return *code.get();
+}
+
 struct PerfJitHeader {
   uint32_t magic_;
   uint32_t version_;
@@ -98,6 +113,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -132,6 +157,7 @@ uint64_t LinuxPerfJitLogger::reference_count_ = 0;
 void* LinuxPerfJitLogger::marker_address_ = nullptr;
 uint64_t LinuxPerfJitLogger::code_index_ = 0;
 FILE* LinuxPerfJitLogger::perf_output_handle_ = nullptr;
+PerfOutputWriter* LinuxPerfJitLogger::perf_output_writer_ = nullptr;
 
 void LinuxPerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -160,10 +186,16 @@ void LinuxPerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  if (v8_flags.perf_prof_buffered) {
+    perf_output_writer_ = new PerfOutputWriter(perf_output_handle_);
+  }
 }
 
 void LinuxPerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
+  delete perf_output_writer_;
+  perf_output_writer_ = nullptr;
+  GetMovableCode().clear();
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -258,6 +290,11 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (v8_flags.perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
 
+  if (v8_flags.compact_code_space && code->has_instruction_stream()) {
+    GetMovableCode()[code->instruction_start()] = {
+        code_index_, static_cast<uint32_t>(code->instruction_size())};
+  }
+
   WriteJitCodeLoadEntry(code_pointer, code->instruction_size(), code_name,
                         length);
 }
@@ -276,6 +313,35 @@ void LinuxPerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+void LinuxPerfJitLogger::CodeMoveEvent(Tagged<InstructionStream> from,
+                                       Tagged<InstructionStream> to) {
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Code that was not logged (e.g. because of
+  // --perf-basic-prof-only-functions) doesn't need a move record.
+  std::unordered_map<Address, LoadedCode>& movable_code = GetMovableCode();
+  auto it = movable_code.find(from->instruction_start());
+  if (it == movable_code.end()) return;
+  LoadedCode loaded_code = it->second;
+  movable_code.erase(it);
+  movable_code[to->instruction_start()] = loaded_code;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to->instruction_start();
+  code_move.old_code_address_ = from->instruction_start();
+  code_move.new_code_address_ = to->instruction_start();
+  code_move.code_size_ = loaded_code.code_size;
+  code_move.code_id_ = loaded_code.code_id;
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
                                                uint32_t code_size,
                                                const char* name,
@@ -534,6 +600,10 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Tagged<Code> code) {
 }
 
 void LinuxPerfJitLogger::LogWriteBytes(const char* bytes, int size) {
+  if (perf_output_writer_ != nullptr) {
+    perf_output_writer_->Write(bytes, size);
+    return;
+  }
   size_t rv = fwrite(bytes, 1, size, perf_output_handle_);
   DCHECK(static_cast<size_t>(size) == rv);
   USE(rv);
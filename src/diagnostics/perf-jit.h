@@ -38,6 +38,8 @@
 namespace v8 {
 namespace internal {
 
+class PerfOutputWriter;
+
 // Linux perf tool logging support.
 class LinuxPerfJitLogger : public CodeEventLogger {
  public:
@@ -45,9 +47,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   ~LinuxPerfJitLogger() override;
 
   void CodeMoveEvent(Tagged<InstructionStream> from,
-                     Tagged<InstructionStream> to) override {
-    UNREACHABLE();  // Unsupported.
-  }
+                     Tagged<InstructionStream> to) override;
   void BytecodeMoveEvent(Tagged<BytecodeArray> from,
                          Tagged<BytecodeArray> to) override {}
   void CodeDisableOptEvent(Handle<AbstractCode> code,
@@ -133,6 +133,8 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   // Per-process singleton file. We assume that there is one main isolate;
   // to determine when it goes away, we keep reference count.
   static FILE* perf_output_handle_;
+  // Writes the file from a background thread with --perf-prof-buffered.
+  static PerfOutputWriter* perf_output_writer_;
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/diagnostics/perf-output-writer.h"
+
+#include "src/base/platform/platform.h"
+
+namespace v8 {
+namespace internal {
+
+class PerfOutputWriter::WriterThread final : public base::Thread {
+ public:
+  explicit WriterThread(PerfOutputWriter* writer)
+      : base::Thread(Options("V8 perf output writer")), writer_(writer) {}
+
+  void Run() override { writer_->Run(); }
+
+ private:
+  PerfOutputWriter* const writer_;
+};
+
+PerfOutputWriter::PerfOutputWriter(FILE* file)
+    : file_(file), thread_(std::make_unique<WriterThread>(this)) {
+  CHECK(thread_->Start());
+}
+
+PerfOutputWriter::~PerfOutputWriter() {
+  {
+    base::MutexGuard guard(&mutex_);
+    stopping_ = true;
+    wake_up_.NotifyOne();
+  }
+  thread_->Join();
+  DCHECK(pending_.empty());
+}
+
+void PerfOutputWriter::Write(const char* bytes, size_t size) {
+  base::MutexGuard guard(&mutex_);
+  size_t old_size = pending_.size();
+  pending_.insert(pending_.end(), bytes, bytes + size);
+  if (old_size < kWakeUpThreshold && pending_.size() >= kWakeUpThreshold) {
+    wake_up_.NotifyOne();
+  }
+}
+
+void PerfOutputWriter::Run() {
+  std::vector<char> writing;
+  base::MutexGuard guard(&mutex_);
+  while (true) {
+    if (!stopping_ && pending_.size() < kWakeUpThreshold) {
+      wake_up_.WaitFor(&mutex_, kWriteInterval);
+    }
+    bool stop = stopping_;
+    if (!pending_.empty()) {
+      writing.swap(pending_);
+      // Loggers keep adding records while this thread writes.
+      mutex_.Unlock();
+      size_t written = fwrite(writing.data(), 1, writing.size(), file_);
+      DCHECK_EQ(writing.size(), written);
+      USE(written);
+      fflush(file_);
+      writing.clear();
+      mutex_.Lock();
+    }
+    if (stop && pending_.empty()) return;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DIAGNOSTICS_PERF_OUTPUT_WRITER_H_
+#define V8_DIAGNOSTICS_PERF_OUTPUT_WRITER_H_
+
+#include <stdio.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace internal {
+
+// Writes the perf map and jitdump files from a background thread, so that
+// threads that log code creation only copy their records into a buffer instead
+// of doing file I/O. Records are written in the order they were added.
+class PerfOutputWriter final {
+ public:
+  // The writer doesn't take ownership of |file|, which must stay open until
+  // the writer is destroyed.
+  explicit PerfOutputWriter(FILE* file);
+  // Writes out all pending records and stops the background thread.
+  ~PerfOutputWriter();
+  PerfOutputWriter(const PerfOutputWriter&) = delete;
+  PerfOutputWriter& operator=(const PerfOutputWriter&) = delete;
+
+  void Write(const char* bytes, size_t size);
+
+ private:
+  class WriterThread;
+
+  // The background thread wakes up early once this many bytes are pending.
+  static constexpr size_t kWakeUpThreshold = 256 * 1024;
+  // Otherwise, pending records are written at least this often.
+  static constexpr base::TimeDelta kWriteInterval =
+      base::TimeDelta::FromMilliseconds(100);
+
+  void Run();
+
+  FILE* const file_;
+  base::Mutex mutex_;
+  base::ConditionVariable wake_up_;
+  // Protected by mutex_.
+  std::vector<char> pending_;
+  bool stopping_ = false;
+  std::unique_ptr<WriterThread> thread_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DIAGNOSTICS_PERF_OUTPUT_WRITER_H_
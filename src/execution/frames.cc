@@ -3013,9 +3013,11 @@ void OptimizedFrame::Summarize(std::vector<FrameSummary>* frames) const {
   }
 
   // Prepare iteration over translation. We must not materialize values here
-  // because we do not deoptimize the function.
+  // unless we also deoptimize the function, since the identity of the
+  // materialized objects has to be preserved.
   TranslatedState translated(this);
   translated.Prepare(fp());
+  bool should_deoptimize = false;
 
   // We create the summary in reverse order because the frames
   // in the deoptimization translation are ordered bottom-to-top.
@@ -3031,8 +3033,15 @@ void OptimizedFrame::Summarize(std::vector<FrameSummary>* frames) const {
       // at the first position, and the receiver is next.
       TranslatedFrame::iterator translated_values = it->begin();
 
-      // Get the correct function in the optimized frame.
-      CHECK(!translated_values->IsMaterializedObject());
+      // Get the correct function in the optimized frame. Escape analysis can
+      // virtualize the closures of inlined functions (see
+      // --turbo-escape-analysis-closures), in which case the function is
+      // materialized and stored along with the other materialized objects of
+      // the frame below.
+      if (translated_values->IsMaterializedObject()) {
+        DCHECK(v8_flags.turbo_escape_analysis_closures);
+        should_deoptimize = true;
+      }
       DirectHandle<JSFunction> function =
           Cast<JSFunction>(translated_values->GetValue());
       translated_values++;
@@ -3087,6 +3096,11 @@ void OptimizedFrame::Summarize(std::vector<FrameSummary>* frames) const {
 #endif  // V8_ENABLE_WEBASSEMBLY
     }
   }
+
+  if (should_deoptimize) {
+    translated.StoreMaterializedValuesAndDeopt(
+        const_cast<OptimizedFrame*>(this));
+  }
 }
 
 int OptimizedFrame::LookupExceptionHandlerInTable(
@@ -28,12 +28,72 @@ using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 // asynchronously) on any address.
 class FutexWaitList {
  public:
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  // The waiters are distributed over shards by the address they wait on, so
+  // that waits and notifies on unrelated addresses don't contend for a single
+  // mutex.
+  class Shard {
+   public:
+    Shard() = default;
+    Shard(const Shard&) = delete;
+    Shard& operator=(const Shard&) = delete;
+
+    // Must be called before loading the value to wait on, and be followed by
+    // either AddNode() or RetractWaiter(). See {num_waiters_}.
+    void AnnounceWaiter() { num_waiters_.fetch_add(1); }
+    void RetractWaiter() { num_waiters_.fetch_sub(1); }
+    bool HasWaiters() const { return num_waiters_.load() != 0; }
+
+    void AddNode(FutexWaitListNode* node);
+    void RemoveNode(FutexWaitListNode* node);
+
+    void DeleteNodesForIsolate(Isolate* isolate);
+
+    // For checking the internal consistency of the shard.
+    void Verify() const;
+
+    base::Mutex* mutex() { return &mutex_; }
+
+   private:
+    friend class FutexEmulation;
+
+    // `mutex` protects the composition of the fields below (i.e. no elements
+    // may be added or removed without holding this mutex), as well as the
+    // `waiting_` field for each individual list node that is currently part
+    // of the list. It must be the mutex used together with the `cond_`
+    // condition variable of such nodes.
+    base::Mutex mutex_;
+
+    // The number of nodes in {location_lists_}, plus the number of waiters
+    // which announced themselves but haven't been added yet. Waiters announce
+    // themselves while holding {mutex_} before they load the value they wait
+    // on, and notifies load this counter without holding {mutex_} after the
+    // value was stored. Since all of these accesses are sequentially
+    // consistent, a notify which sees no waiters is ordered before any wait
+    // that could have been woken by it, and that wait sees the new value.
+    std::atomic<size_t> num_waiters_{0};
+
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    // As long as the map does not grow beyond 16 entries, there is no dynamic
+    // allocation and deallocation happening in wait or wake, which reduces the
+    // time spend in the critical section.
+    base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists_;
+  };
+
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
-  void AddNode(FutexWaitListNode* node);
-  void RemoveNode(FutexWaitListNode* node);
+  Shard* ShardFor(void* wait_location) {
+    // Waits on neighbouring elements of an Int32Array use different shards.
+    uintptr_t address = reinterpret_cast<uintptr_t>(wait_location);
+    return &shards_[(address >> 2) % kNumShards];
+  }
 
   static void* ToWaitLocation(Tagged<JSArrayBuffer> array_buffer, size_t addr) {
     DCHECK_LT(addr, array_buffer->GetByteLength());
@@ -59,60 +119,30 @@ class FutexWaitList {
     return next;
   }
 
-  static void DeleteNodesForIsolate(Isolate* isolate, FutexWaitListNode** head,
-                                    FutexWaitListNode** tail) {
-    // For updating head & tail once we've iterated all nodes.
-    FutexWaitListNode* new_head = nullptr;
-    FutexWaitListNode* new_tail = nullptr;
-    for (FutexWaitListNode* node = *head; node;) {
-      if (node->IsAsync() &&
-          node->async_state_->isolate_for_async_waiters == isolate) {
-        node->async_state_->timeout_task_id =
-            CancelableTaskManager::kInvalidTaskId;
-        node = DeleteAsyncWaiterNode(node);
-      } else {
-        if (new_head == nullptr) {
-          new_head = node;
-        }
-        new_tail = node;
-        node = node->next_;
-      }
-    }
-    *head = new_head;
-    *tail = new_tail;
-  }
-
   // For checking the internal consistency of the FutexWaitList.
   void Verify() const;
+  // Checks that the nodes on the list starting with |head| are linked
+  // consistently and end with |tail|.
+  static void VerifyList(FutexWaitListNode* head, FutexWaitListNode* tail);
   // Returns true if |node| is on the linked list starting with |head|.
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
-  base::Mutex* mutex() { return &mutex_; }
+  base::Mutex* promises_mutex() { return &promises_mutex_; }
 
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
+  static constexpr size_t kNumShards = 64;
 
-  // `mutex` protects the composition of the fields below (i.e. no elements may
-  // be added or removed without holding this mutex), as well as the `waiting_`
-  // and `interrupted_` fields for each individual list node that is currently
-  // part of the list. It must be the mutex used together with the `cond_`
-  // condition variable of such nodes.
-  base::Mutex mutex_;
+  Shard shards_[kNumShards];
 
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  // As long as the map does not grow beyond 16 entries, there is no dynamic
-  // allocation and deallocation happening in wait or wake, which reduces the
-  // time spend in the critical section.
-  base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists_;
+  // `promises_mutex_` protects `isolate_promises_to_resolve_` and the nodes on
+  // its lists. When both are needed, it is acquired after a shard's mutex.
+  base::Mutex promises_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
-  // be resolved.
+  // be resolved. All Promises of an Isolate are resolved by a single task, no
+  // matter how many notifies woke them.
   base::SmallMap<std::map<Isolate*, HeadAndTail>> isolate_promises_to_resolve_;
 };
 
@@ -138,17 +168,20 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-
-  // if not waiting, this will not have any effect.
-  cond_.NotifyOne();
-  interrupted_ = true;
+  // Set the interrupted_ flag before looking up the mutex of the shard the
+  // node waits in. A wait which sets {wait_mutex_} afterwards tests the flag
+  // while holding that mutex, before it waits on the condition variable. If
+  // the node is waiting, we lock the mutex before notifying, which ensures
+  // that the waiter is either blocked on the condition variable or will see
+  // the flag.
+  interrupted_.store(true);
+  while (base::Mutex* mutex = wait_mutex_.load()) {
+    NoGarbageCollectionMutexGuard lock_guard(mutex);
+    // The node might have moved on to another wait in the meantime.
+    if (wait_mutex_.load() != mutex) continue;
+    cond_.NotifyOne();
+    break;
+  }
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -183,17 +216,19 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
   FutexWaitList* wait_list = GetWaitList();
-  wait_list->mutex()->AssertHeld();
+  FutexWaitList::Shard* shard = wait_list->ShardFor(node->wait_location_);
+  shard->mutex()->AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_state_->timeout_time = base::TimeTicks();
 
-  wait_list->RemoveNode(node);
+  shard->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->promises_mutex());
   auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->async_state_->isolate_for_async_waiters);
   if (it == isolate_map.end()) {
@@ -212,9 +247,11 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   }
 }
 
-void FutexWaitList::AddNode(FutexWaitListNode* node) {
+void FutexWaitList::Shard::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
+  // The waiter has been counted by AnnounceWaiter().
+  DCHECK_LT(0, num_waiters_.load());
   auto [it, inserted] =
       location_lists_.insert({node->wait_location_, HeadAndTail{node, node}});
   if (!inserted) {
@@ -226,7 +263,7 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
   Verify();
 }
 
-void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
+void FutexWaitList::Shard::RemoveNode(FutexWaitListNode* node) {
   if (!node->prev_ && !node->next_) {
     // If the node was the last one on its list, delete the whole list.
     size_t erased = location_lists_.erase(node->wait_location_);
@@ -259,20 +296,47 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
       node->next_ = nullptr;
     }
   }
+  num_waiters_.fetch_sub(1);
 
   Verify();
 }
 
-void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  FutexWaitList* wait_list = GetWaitList();
-  {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-    stopped_ = true;
+void FutexWaitList::Shard::DeleteNodesForIsolate(Isolate* isolate) {
+  auto it = location_lists_.begin();
+  while (it != location_lists_.end()) {
+    // For updating head & tail once we've iterated all nodes.
+    FutexWaitListNode* new_head = nullptr;
+    FutexWaitListNode* new_tail = nullptr;
+    for (FutexWaitListNode* node = it->second.head; node;) {
+      if (node->IsAsync() &&
+          node->async_state_->isolate_for_async_waiters == isolate) {
+        node->async_state_->timeout_task_id =
+            CancelableTaskManager::kInvalidTaskId;
+        node = DeleteAsyncWaiterNode(node);
+        num_waiters_.fetch_sub(1);
+      } else {
+        if (new_head == nullptr) {
+          new_head = node;
+        }
+        new_tail = node;
+        node = node->next_;
+      }
+    }
+    if (new_head == nullptr) {
+      it = location_lists_.erase(it);
+    } else {
+      it->second = HeadAndTail{new_head, new_tail};
+      ++it;
+    }
   }
+
+  Verify();
+}
+
+void AtomicsWaitWakeHandle::Wake() {
+  // NotifyWake() sets the interrupted_ flag of the waiting node after this, so
+  // the waiter sees stopped_ once it handled the interrupt.
+  stopped_.store(true);
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
@@ -405,9 +469,9 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
   DirectHandle<Object> result;
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
-  FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node = isolate->futex_wait_list_node();
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
+  FutexWaitList::Shard* shard = GetWaitList()->ShardFor(wait_location);
 
   base::TimeTicks timeout_time;
   if (use_timeout) {
@@ -420,8 +484,9 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
   // Keep the code in the loop as minimal as possible, because this is all in
   // the critical section.
   do {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(shard->mutex());
 
+    shard->AnnounceWaiter();
     std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
@@ -432,6 +497,7 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
     }
 #endif
     if (loaded_value != value) {
+      shard->RetractWaiter();
       result =
           direct_handle(Smi::FromInt(WaitReturnValue::kNotEqualValue), isolate);
       callback_result = AtomicsWaitEvent::kNotEqual;
@@ -440,7 +506,10 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
 
     node->wait_location_ = wait_location;
     node->waiting_ = true;
-    wait_list->AddNode(node);
+    shard->AddNode(node);
+    // From now on, NotifyWake() synchronizes with this wait using the mutex
+    // of the shard.
+    node->wait_mutex_.store(shard->mutex());
 
     while (true) {
       if (V8_UNLIKELY(node->interrupted_)) {
@@ -458,9 +527,9 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
         //    interrupted_ will be set to 1. This will be checked below.
         // 2) After interrupted has been checked here, but before mutex is
         //    acquired: interrupted is checked in a loop, with mutex locked.
-        //    Because the wakeup signal also acquires mutex, we know it will not
-        //    be able to notify until mutex is released below, when waiting on
-        //    the condition variable.
+        //    Because the wakeup signal also acquires mutex after setting
+        //    interrupted, we know it will not be able to notify until mutex is
+        //    released below, when waiting on the condition variable.
         // 3) After the mutex is released in the call to WaitFor(): this
         //    notification will wake up the condition variable. node->waiting()
         //    will be false, so we'll loop and then check interrupts.
@@ -505,17 +574,18 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(wait_list->mutex(), time_until_timeout);
+            node->cond_.WaitFor(shard->mutex(), time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(wait_list->mutex());
+        node->cond_.Wait(shard->mutex());
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
     node->waiting_ = false;
-    wait_list->RemoveNode(node);
+    node->wait_mutex_.store(nullptr);
+    shard->RemoveNode(node);
   } while (false);
   DCHECK(!node->waiting_);
 
@@ -570,12 +640,13 @@ Tagged<Object> FutexEmulation::WaitAsync(
   // Get a weak pointer to the backing store, to be stored in the async state of
   // the node.
   std::weak_ptr<BackingStore> backing_store{array_buffer->GetBackingStore()};
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList::Shard* shard = GetWaitList()->ShardFor(wait_location);
   {
     // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(shard->mutex());
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
+    shard->AnnounceWaiter();
     std::atomic<T>* p = static_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
@@ -586,8 +657,10 @@ Tagged<Object> FutexEmulation::WaitAsync(
     }
 #endif
     if (loaded_value != value) {
+      shard->RetractWaiter();
       result_kind = ResultKind::kNotEqual;
     } else if (use_timeout && rel_timeout_ns == 0) {
+      shard->RetractWaiter();
       result_kind = ResultKind::kTimedOut;
     } else {
       result_kind = ResultKind::kAsync;
@@ -606,7 +679,7 @@ Tagged<Object> FutexEmulation::WaitAsync(
             std::move(task), rel_timeout.InSecondsF());
       }
 
-      wait_list->AddNode(node);
+      shard->AddNode(node);
     }
 
     // Leaving the block collapses the following steps:
@@ -686,10 +759,13 @@ int FutexEmulation::Wake(Tagged<JSArrayBuffer> array_buffer, size_t addr,
 
 int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
   int num_waiters_woken = 0;
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexWaitList::Shard* shard = GetWaitList()->ShardFor(wait_location);
+  // Notifying a location without waiters is common, e.g. when releasing an
+  // uncontended lock, and doesn't need the mutex; see Shard::num_waiters_.
+  if (!shard->HasWaiters()) return num_waiters_woken;
+  NoGarbageCollectionMutexGuard lock_guard(shard->mutex());
 
-  auto& location_lists = wait_list->location_lists_;
+  auto& location_lists = shard->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) return num_waiters_woken;
 
@@ -768,7 +844,7 @@ int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
 
     FutexWaitListNode* next_node = node->next_;
     if (delete_this_node) {
-      wait_list->RemoveNode(node);
+      shard->RemoveNode(node);
       delete node;
     }
     node = next_node;
@@ -780,8 +856,8 @@ int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding the
-  // FutexEmulationGlobalState::mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of
+  // the FutexWaitList's mutexes.
 
   Isolate* isolate = node->async_state_->isolate_for_async_waiters;
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
@@ -857,7 +933,7 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(wait_list->promises_mutex());
 
     auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
@@ -870,7 +946,8 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   // The list of nodes starting from "node" are no longer on any list, so it's
   // ok to iterate them without holding the mutex. We also need to not hold the
   // mutex while calling CleanupAsyncWaiterPromise, since it may allocate
-  // memory.
+  // memory. The list holds all waiters of the Isolate that were notified since
+  // the task was posted, no matter which shards they were waiting in.
   HandleScope handle_scope(isolate);
   while (node) {
     DCHECK(node->IsAsync());
@@ -891,10 +968,10 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate.
   DCHECK(node->IsAsync());
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList::Shard* shard = GetWaitList()->ShardFor(node->wait_location_);
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(shard->mutex());
 
     node->async_state_->timeout_task_id = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -902,7 +979,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
       // resolved. Ignore the timeout.
       return;
     }
-    wait_list->RemoveNode(node);
+    shard->RemoveNode(node);
   }
 
   // "node" has been taken out of the lists, so it's ok to access it without
@@ -916,42 +993,29 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = wait_list->location_lists_;
-    auto it = location_lists.begin();
-    while (it != location_lists.end()) {
-      FutexWaitListNode*& head = it->second.head;
-      FutexWaitListNode*& tail = it->second.tail;
-      FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
-      // head and tail are either both nullptr or both non-nullptr.
-      DCHECK_EQ(head == nullptr, tail == nullptr);
-      if (head == nullptr) {
-        it = location_lists.erase(it);
-      } else {
-        ++it;
-      }
-    }
+  for (FutexWaitList::Shard& shard : wait_list->shards_) {
+    if (!shard.HasWaiters()) continue;
+    NoGarbageCollectionMutexGuard lock_guard(shard.mutex());
+    shard.DeleteNodesForIsolate(isolate);
   }
 
-  {
-    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
-    auto it = isolate_map.find(isolate);
-    if (it != isolate_map.end()) {
-      for (FutexWaitListNode* node = it->second.head; node;) {
-        DCHECK(node->IsAsync());
-        DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
-        node->async_state_->timeout_task_id =
-            CancelableTaskManager::kInvalidTaskId;
-        node = FutexWaitList::DeleteAsyncWaiterNode(node);
-      }
-      isolate_map.erase(it);
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->promises_mutex());
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+  auto it = isolate_map.find(isolate);
+  if (it != isolate_map.end()) {
+    for (FutexWaitListNode* node = it->second.head; node;) {
+      DCHECK(node->IsAsync());
+      DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
+      node->async_state_->timeout_task_id =
+          CancelableTaskManager::kInvalidTaskId;
+      node = FutexWaitList::DeleteAsyncWaiterNode(node);
     }
+    isolate_map.erase(it);
   }
 
   wait_list->Verify();
@@ -960,11 +1024,11 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
 int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
                                          size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexWaitList::Shard* shard = GetWaitList()->ShardFor(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(shard->mutex());
 
   int num_waiters = 0;
-  auto& location_lists = wait_list->location_lists_;
+  auto& location_lists = shard->location_lists_;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) return num_waiters;
 
@@ -985,7 +1049,7 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     Tagged<JSArrayBuffer> array_buffer, size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(array_buffer, addr);
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  NoGarbageCollectionMutexGuard lock_guard(wait_list->promises_mutex());
 
   int num_waiters = 0;
   auto& isolate_map = wait_list->isolate_promises_to_resolve_;
@@ -1004,10 +1068,34 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   return num_waiters;
 }
 
+void FutexWaitList::Shard::Verify() const {
+#ifdef DEBUG
+  for (const auto& [addr, head_and_tail] : location_lists_) {
+    auto [head, tail] = head_and_tail;
+    VerifyList(head, tail);
+  }
+#endif  // DEBUG
+}
+
 void FutexWaitList::Verify() const {
 #ifdef DEBUG
-  auto VerifyNode = [](FutexWaitListNode* node, FutexWaitListNode* head,
-                       FutexWaitListNode* tail) {
+  // The shards are verified whenever their lists change, while holding their
+  // mutex.
+  for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
+    auto [head, tail] = head_and_tail;
+    VerifyList(head, tail);
+    for (FutexWaitListNode* node = head; node; node = node->next_) {
+      DCHECK(node->IsAsync());
+      DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
+    }
+  }
+#endif  // DEBUG
+}
+
+void FutexWaitList::VerifyList(FutexWaitListNode* head,
+                               FutexWaitListNode* tail) {
+#ifdef DEBUG
+  for (FutexWaitListNode* node = head; node; node = node->next_) {
     if (node->next_ != nullptr) {
       DCHECK_NE(node, tail);
       DCHECK_EQ(node, node->next_->prev_);
@@ -1020,24 +1108,6 @@ void FutexWaitList::Verify() const {
     } else {
       DCHECK_EQ(node, head);
     }
-
-    DCHECK(NodeIsOnList(node, head));
-  };
-
-  for (const auto& [addr, head_and_tail] : location_lists_) {
-    auto [head, tail] = head_and_tail;
-    for (FutexWaitListNode* node = head; node; node = node->next_) {
-      VerifyNode(node, head, tail);
-    }
-  }
-
-  for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
-    auto [head, tail] = head_and_tail;
-    for (FutexWaitListNode* node = head; node; node = node->next_) {
-      DCHECK(node->IsAsync());
-      VerifyNode(node, head, tail);
-      DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
-    }
   }
 #endif  // DEBUG
 }
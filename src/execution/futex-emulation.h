@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "include/v8-persistent-handle.h"
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -44,11 +46,11 @@ class AtomicsWaitWakeHandle {
   explicit AtomicsWaitWakeHandle(Isolate* isolate) : isolate_(isolate) {}
 
   void Wake();
-  inline bool has_stopped() const { return stopped_; }
+  inline bool has_stopped() const { return stopped_.load(); }
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -124,7 +126,9 @@ class FutexWaitListNode {
   };
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulationGlobalState::mutex.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList shard for
+  // wait_location_, or by the FutexWaitList's promises mutex once the Promise
+  // of the node is to be resolved.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -136,11 +140,15 @@ class FutexWaitListNode {
   // this node is alive.
   void* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulationGlobalState::mutex
-  // if this node is currently contained in FutexEmulationGlobalState::wait_list
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the FutexWaitList shard for
+  // wait_location_ while this node is contained in the shard.
   bool waiting_ = false;
-  bool interrupted_ = false;
+  // Set by NotifyWake() without holding a mutex; see there.
+  std::atomic<bool> interrupted_{false};
+
+  // The mutex of the FutexWaitList shard a sync wait is currently waiting in,
+  // or nullptr. NotifyWake() locks it before notifying cond_.
+  std::atomic<base::Mutex*> wait_mutex_{nullptr};
 
   // State used for an async wait; nullptr on sync waits.
   const std::unique_ptr<AsyncState> async_state_;
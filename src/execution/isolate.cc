@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -35,6 +36,7 @@
 #include "src/builtins/constants-table-builder.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/compile-job-histograms.h"
 #include "src/codegen/flush-instruction-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -44,6 +46,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-stats.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
@@ -67,6 +70,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -121,6 +125,7 @@
 #include "src/tasks/cancelable-task.h"
 
 #if defined(V8_USE_PERFETTO)
+#include "src/tracing/heap-graph-data-source.h"
 #include "src/tracing/perfetto-logger.h"
 #endif  // defined(V8_USE_PERFETTO)
 
@@ -831,19 +836,24 @@ int GetGeneratorBytecodeOffset(
 
 class CallSiteBuilder {
  public:
+  // With {raw_frames}, the frames are recorded in the raw stack trace format
+  // described in ErrorUtils instead of as CallSiteInfos.
   CallSiteBuilder(Isolate* isolate, FrameSkipMode mode, int limit,
-                  Handle<Object> caller)
+                  Handle<Object> caller, bool raw_frames = false)
       : isolate_(isolate),
         mode_(mode),
         limit_(limit),
         caller_(caller),
-        skip_next_frame_(mode != SKIP_NONE) {
+        skip_next_frame_(mode != SKIP_NONE),
+        raw_frames_(raw_frames) {
     DCHECK_IMPLIES(mode_ == SKIP_UNTIL_SEEN, IsJSFunction(*caller_));
     // Modern web applications are usually built with multiple layers of
     // framework and library code, and stack depth tends to be more than
     // a dozen frames, so we over-allocate a bit here to avoid growing
     // the elements array in the common case.
-    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
+    int capacity = std::min(64, limit);
+    if (raw_frames_) capacity = 1 + capacity * ErrorUtils::kRawFrameSize;
+    elements_ = isolate->factory()->NewFixedArray(capacity);
   }
 
   bool Visit(FrameSummary const& summary) {
@@ -996,6 +1006,12 @@ class CallSiteBuilder {
   bool Full() { return index_ >= limit_; }
 
   Handle<FixedArray> Build() {
+    if (raw_frames_) {
+      if (index_ == 0) return isolate_->factory()->empty_fixed_array();
+      elements_->set(0, Smi::FromInt(index_));
+      return FixedArray::RightTrimOrEmpty(
+          isolate_, elements_, 1 + index_ * ErrorUtils::kRawFrameSize);
+    }
     return FixedArray::RightTrimOrEmpty(isolate_, elements_, index_);
   }
 
@@ -1068,6 +1084,22 @@ class CallSiteBuilder {
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
+    if (raw_frames_) {
+      DCHECK_EQ(0, parameters->length());
+      int base = 1 + index_++ * ErrorUtils::kRawFrameSize;
+      elements_ = FixedArray::SetAndGrow(
+          isolate_, elements_, base + ErrorUtils::kRawFrameSize - 1,
+          handle(Smi::zero(), isolate_));
+      elements_->set(base + ErrorUtils::kRawFrameReceiverOrInstanceIndex,
+                     *receiver_or_instance);
+      elements_->set(base + ErrorUtils::kRawFrameFunctionIndex, *function);
+      elements_->set(base + ErrorUtils::kRawFrameCodeIndex, *code);
+      elements_->set(base + ErrorUtils::kRawFrameOffsetIndex,
+                     Smi::FromInt(offset));
+      elements_->set(base + ErrorUtils::kRawFrameFlagsIndex,
+                     Smi::FromInt(flags));
+      return;
+    }
     auto info = isolate_->factory()->NewCallSiteInfo(
         Cast<JSAny>(receiver_or_instance), function, code, offset, flags,
         parameters);
@@ -1080,6 +1112,7 @@ class CallSiteBuilder {
   const int limit_;
   const Handle<Object> caller_;
   bool skip_next_frame_;
+  const bool raw_frames_;
   bool encountered_strict_function_ = false;
   Handle<FixedArray> elements_;
 };
@@ -1338,7 +1371,8 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
 
 Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
                                            FrameSkipMode mode,
-                                           Handle<Object> caller) {
+                                           Handle<Object> caller,
+                                           bool raw_frames = false) {
   TRACE_EVENT_BEGIN1(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"), __func__,
                      "maxFrameCount", limit);
 
@@ -1346,7 +1380,7 @@ Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
   wasm::WasmCodeRefScope code_ref_scope;
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-  CallSiteBuilder builder(isolate, mode, limit, caller);
+  CallSiteBuilder builder(isolate, mode, limit, caller, raw_frames);
   VisitStack(isolate, &builder);
 
   // If --async-stack-traces are enabled and the "current microtask" is a
@@ -1391,8 +1425,12 @@ MaybeHandle<JSObject> Isolate::CaptureAndSetErrorStack(
         limit = stack_trace_for_uncaught_exceptions_frame_limit_;
       }
     }
+    // Errors are frequently created without their stack ever being looked
+    // at, so only record the frames here (see ErrorUtils::IsRawStackTrace).
+    bool raw_frames = v8_flags.lazy_call_site_infos &&
+                      !v8_flags.detailed_error_stack_trace;
     call_site_infos_or_formatted_stack =
-        CaptureSimpleStackTrace(this, limit, mode, caller);
+        CaptureSimpleStackTrace(this, limit, mode, caller, raw_frames);
   }
   Handle<Object> error_stack = call_site_infos_or_formatted_stack;
 
@@ -3241,23 +3279,32 @@ bool CallsCatchMethod(Isolate* isolate, Handle<BytecodeArray> bytecode_array,
       }
     }
 
-    // Next instruction should be a Star (store accumulator to register)
-    if (iterator.done() || !Bytecodes::IsAnyStar(iterator.current_bytecode())) {
-      return false;
-    }
-    // The register it stores to will be assumed to be our promise
-    int promise_register = iterator.GetStarTargetRegister().index();
+    int promise_register;
+    // With --ignition-superinstructions, the Star and the GetNamedProperty
+    // below are fused into a single StarGetNamedProperty.
+    if (!iterator.done() &&
+        iterator.current_bytecode() == Bytecode::kStarGetNamedProperty) {
+      promise_register = iterator.GetRegisterOperand(0).index();
+    } else {
+      // Next instruction should be a Star (store accumulator to register)
+      if (iterator.done() ||
+          !Bytecodes::IsAnyStar(iterator.current_bytecode())) {
+        return false;
+      }
+      // The register it stores to will be assumed to be our promise
+      promise_register = iterator.GetStarTargetRegister().index();
 
-    // TODO(crbug/40283993): Should we loop over non-matching instructions here
-    // to allow code like
-    // `const promise = foo(); console.log(...); promise.catch(...);`?
+      // TODO(crbug/40283993): Should we loop over non-matching instructions
+      // here to allow code like
+      // `const promise = foo(); console.log(...); promise.catch(...);`?
 
-    iterator.Advance();
-    // We should be on a GetNamedProperty instruction.
-    if (iterator.done() ||
-        iterator.current_bytecode() != Bytecode::kGetNamedProperty ||
-        iterator.GetRegisterOperand(0).index() != promise_register) {
-      return false;
+      iterator.Advance();
+      // We should be on a GetNamedProperty instruction.
+      if (iterator.done() ||
+          iterator.current_bytecode() != Bytecode::kGetNamedProperty ||
+          iterator.GetRegisterOperand(0).index() != promise_register) {
+        return false;
+      }
     }
     PromiseMethod method = GetPromiseMethod(isolate, iterator);
     if (method == kInvalid) {
@@ -3909,7 +3956,10 @@ class TracingAccountingAllocator : public AccountingAllocator {
     }
     out << "\"allocated\": " << total_segment_bytes_allocated << ", "
         << "\"used\": " << total_zone_allocation_size << ", "
-        << "\"freed\": " << total_zone_freed_size << "}";
+        << "\"freed\": " << total_zone_freed_size << ", "
+        << "\"pooled\": " << GetPooledMemory() << ", "
+        << "\"pool_hits\": " << GetSegmentPoolHits() << ", "
+        << "\"pool_misses\": " << GetSegmentPoolMisses() << "}";
   }
 
   Isolate* const isolate_;
@@ -4053,7 +4103,11 @@ Isolate::Isolate(IsolateGroup* isolate_group)
   InitializeLoggingAndCounters();
   debug_ = new Debug(this);
 
-  InitializeDefaultEmbeddedBlob();
+  {
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kEmbeddedBuiltinsSetup);
+    InitializeDefaultEmbeddedBlob();
+  }
 
 #if V8_ENABLE_WEBASSEMBLY
   // If we are in production V8 and not in mksnapshot we have to pass the
@@ -4133,6 +4187,13 @@ void Isolate::CheckIsolateLayout() {
   CHECK_EQ(
       static_cast<int>(OFFSET_OF(Isolate, isolate_data_.handle_scope_data_)),
       Internals::kIsolateHandleScopeDataOffset);
+  static_assert(Internals::kHandleScopeDataSize == sizeof(HandleScopeData));
+  static_assert(Internals::kHandleScopeDataNextOffset ==
+                offsetof(HandleScopeData, next));
+  static_assert(Internals::kHandleScopeDataLimitOffset ==
+                offsetof(HandleScopeData, limit));
+  static_assert(Internals::kHandleScopeDataLevelOffset ==
+                offsetof(HandleScopeData, level));
   CHECK_EQ(static_cast<int>(OFFSET_OF(Isolate, isolate_data_.embedder_data_)),
            Internals::kIsolateEmbedderDataOffset);
 #ifdef V8_COMPRESS_POINTERS
@@ -4229,6 +4290,7 @@ void Isolate::Deinit() {
 
 #if defined(V8_USE_PERFETTO)
   PerfettoLogger::UnregisterIsolate(this);
+  HeapGraphDataSource::UnregisterIsolate(this);
 #endif  // defined(V8_USE_PERFETTO)
 
   // All client isolates should already be detached when the shared heap isolate
@@ -4505,12 +4567,21 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete transition_lookup_cache_;
+  transition_lookup_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
   store_stub_cache_ = nullptr;
   delete define_own_stub_cache_;
   define_own_stub_cache_ = nullptr;
+  delete ic_site_stats_;
+  ic_site_stats_ = nullptr;
+  delete deopt_stats_;
+  deopt_stats_ = nullptr;
+  delete compile_job_histograms_;
+  compile_job_histograms_ = nullptr;
 
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
@@ -5140,7 +5211,28 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int NumberOfWorkerThreads() override {
+    if (!v8_flags.parallel_bigint) return 0;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  }
+
+  void PostTask(std::unique_ptr<bigint::Platform::Task> task) override {
+    // The main thread waits for the result.
+    V8::GetCurrentPlatform()->CallBlockingTaskOnWorkerThread(
+        std::make_unique<BigIntTask>(std::move(task)));
+  }
+
  private:
+  class BigIntTask : public v8::Task {
+   public:
+    explicit BigIntTask(std::unique_ptr<bigint::Platform::Task> task)
+        : task_(std::move(task)) {}
+    void Run() override { task_->Run(); }
+
+   private:
+    std::unique_ptr<bigint::Platform::Task> task_;
+  };
+
   Isolate* isolate_;
 };
 }  // namespace
@@ -5312,7 +5404,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   InitializeCodeRanges();
 
   compilation_cache_ = new CompilationCache(this);
-  descriptor_lookup_cache_ = new DescriptorLookupCache();
+  descriptor_lookup_cache_ =
+      new DescriptorLookupCache(v8_flags.descriptor_lookup_cache_size);
+  transition_lookup_cache_ = new TransitionLookupCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
@@ -5320,6 +5414,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   load_stub_cache_ = new StubCache(this);
   store_stub_cache_ = new StubCache(this);
   define_own_stub_cache_ = new StubCache(this);
+  if (v8_flags.ic_site_stats) ic_site_stats_ = new ICSiteStats();
+  if (v8_flags.deopt_stats) deopt_stats_ = new DeoptStats();
+  compile_job_histograms_ = new CompileJobHistograms();
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
   date_cache_ = new DateCache();
@@ -5404,13 +5501,19 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     // Must be done before deserializing RO space, since RO space may contain
     // builtin Code objects which point into the (potentially remapped)
     // embedded blob.
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kEmbeddedBuiltinsSetup);
     MaybeRemapEmbeddedBuiltinsIntoCodeRange();
   }
   {
     // Must be done before deserializing RO space since the deserialization
     // process refers to these data structures.
-    isolate_data_.external_reference_table()->InitIsolateIndependent(
-        isolate_group()->external_ref_table());
+    {
+      StartupTimings::Scope startup_timings_scope(
+          this, StartupTimings::Phase::kExternalReferenceTableSetup);
+      isolate_data_.external_reference_table()->InitIsolateIndependent(
+          isolate_group()->external_ref_table());
+    }
 #ifdef V8_COMPRESS_POINTERS
     external_pointer_table().Initialize();
     external_pointer_table().InitializeSpace(
@@ -5430,7 +5533,11 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     trusted_pointer_table().InitializeSpace(heap()->trusted_pointer_space());
 #endif  // V8_ENABLE_SANDBOX
   }
-  ReadOnlyHeap::SetUp(this, read_only_snapshot_data, can_rehash);
+  {
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kReadOnlySpaceSetup);
+    ReadOnlyHeap::SetUp(this, read_only_snapshot_data, can_rehash);
+  }
   heap_.SetUpSpaces(isolate_data_.new_allocation_info_,
                     isolate_data_.old_allocation_info_);
 
@@ -5482,7 +5589,11 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   }
 #endif  // V8_EXTERNAL_CODE_SPACE
 
-  isolate_data_.external_reference_table()->Init(this);
+  {
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kExternalReferenceTableSetup);
+    isolate_data_.external_reference_table()->Init(this);
+  }
 
 #ifdef V8_COMPRESS_POINTERS
   if (owns_shareable_data()) {
@@ -5552,6 +5663,8 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     delete builtins_constants_table_builder_;
     builtins_constants_table_builder_ = nullptr;
 
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kEmbeddedBuiltinsSetup);
     CreateAndSetEmbeddedBlob();
   } else {
     setup_delegate_->SetupBuiltins(this, false);
@@ -5574,6 +5687,8 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   if (!create_heap_objects) {
     // If we are deserializing, read the state into the now-empty heap.
+    StartupTimings::Scope startup_timings_scope(
+        this, StartupTimings::Phase::kStartupDeserialization);
     SharedHeapDeserializer shared_heap_deserializer(
         this, shared_heap_snapshot_data, can_rehash);
     shared_heap_deserializer.DeserializeIntoIsolate();
@@ -5691,6 +5806,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
 #if defined(V8_USE_PERFETTO)
   PerfettoLogger::RegisterIsolate(this);
+  HeapGraphDataSource::RegisterIsolate(this);
 #endif  // defined(V8_USE_PERFETTO)
 
   initialized_ = true;
@@ -7042,6 +7158,35 @@ void Isolate::clear_cached_icu_objects() {
   for (int i = 0; i < kICUObjectCacheTypeCount; i++) {
     clear_cached_icu_object(static_cast<ICUObjectCacheType>(i));
   }
+  clear_cached_icu_formatters();
+}
+
+std::shared_ptr<icu::UMemory> Isolate::get_cached_icu_formatter(
+    ICUFormatterCacheType cache_type, const std::string& key) {
+  for (auto it = icu_formatter_cache_.begin(); it != icu_formatter_cache_.end();
+       ++it) {
+    if (it->type != cache_type || it->key != key) continue;
+    // Move the entry to the front, so that the least recently used entry is
+    // always the last one.
+    std::rotate(icu_formatter_cache_.begin(), it, it + 1);
+    counters()->intl_formatter_cache_hits()->Increment();
+    return icu_formatter_cache_.front().obj;
+  }
+  counters()->intl_formatter_cache_misses()->Increment();
+  return nullptr;
+}
+
+void Isolate::set_icu_formatter_in_cache(ICUFormatterCacheType cache_type,
+                                         std::string key,
+                                         std::shared_ptr<icu::UMemory> obj) {
+  const size_t capacity = v8_flags.intl_formatter_cache_size;
+  if (capacity == 0) return;
+  if (icu_formatter_cache_.size() >= capacity) {
+    icu_formatter_cache_.erase(icu_formatter_cache_.begin() + (capacity - 1),
+                               icu_formatter_cache_.end());
+  }
+  icu_formatter_cache_.insert(icu_formatter_cache_.begin(),
+                              {cache_type, std::move(key), std::move(obj)});
 }
 
 #endif  // V8_INTL_SUPPORT
@@ -38,6 +38,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/read-only-heap.h"
 #include "src/init/isolate-group.h"
+#include "src/init/startup-timings.h"
 #include "src/objects/code.h"
 #include "src/objects/contexts.h"
 #include "src/objects/debug-objects.h"
@@ -119,8 +120,10 @@ class CodeTracer;
 class CommonFrame;
 class CompilationCache;
 class CompilationStatistics;
+class CompileJobHistograms;
 class Counters;
 class Debug;
+class DeoptStats;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
@@ -130,6 +133,7 @@ class GlobalSafepoint;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
+class ICSiteStats;
 class InnerPointerToCodeCache;
 class LazyCompileDispatcher;
 class LocalIsolate;
@@ -156,6 +160,7 @@ class ThreadState;
 class ThreadVisitor;  // Defined in v8threads.h
 class TieringManager;
 class TracingCpuProfilerImpl;
+class TransitionLookupCache;
 class UnicodeCache;
 struct ManagedPtrDestructor;
 
@@ -480,10 +485,12 @@ V8_EXPORT_PRIVATE void FreeCurrentEmbeddedBlob();
 
 #ifdef DEBUG
 
-#define ISOLATE_INIT_DEBUG_ARRAY_LIST(V)               \
-  V(CommentStatistic, paged_space_comments_statistics, \
-    CommentStatistic::kMaxComments + 1)                \
-  V(int, code_kind_statistics, kCodeKindCount)
+#define ISOLATE_INIT_DEBUG_ARRAY_LIST(V)                 \
+  V(CommentStatistic, paged_space_comments_statistics,   \
+    CommentStatistic::kMaxComments + 1)                  \
+  V(int, code_kind_statistics, kCodeKindCount)           \
+  V(int, deoptimization_data_statistics, kCodeKindCount) \
+  V(int, deoptimization_data_saved_statistics, kCodeKindCount)
 #else
 
 #define ISOLATE_INIT_DEBUG_ARRAY_LIST(V)
@@ -1289,6 +1296,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StubCache* load_stub_cache() const { return load_stub_cache_; }
   StubCache* store_stub_cache() const { return store_stub_cache_; }
   StubCache* define_own_stub_cache() const { return define_own_stub_cache_; }
+  ICSiteStats* ic_site_stats() const { return ic_site_stats_; }
+  DeoptStats* deopt_stats() const { return deopt_stats_; }
+  CompileJobHistograms* compile_job_histograms() const {
+    return compile_job_histograms_;
+  }
+  StartupTimings* startup_timings() { return &startup_timings_; }
   Deoptimizer* GetAndClearCurrentDeoptimizer() {
     Deoptimizer* result = current_deoptimizer_;
     CHECK_NOT_NULL(result);
@@ -1353,6 +1366,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  TransitionLookupCache* transition_lookup_cache() const {
+    return transition_lookup_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() {
     return &isolate_data_.handle_scope_data_;
   }
@@ -1588,6 +1605,25 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void clear_cached_icu_objects();
 
+  // ICU formatters created by the Intl constructors are kept in a small LRU
+  // cache, keyed by the resolved ICU locale and a canonical string of the
+  // resolved options, so that constructing the same formatter again only
+  // costs the option processing. Cached formatters are shared, and must not
+  // be modified after they were added to the cache.
+  enum class ICUFormatterCacheType {
+    kCollator,
+    kNumberFormat,
+    kPluralRules,
+    kSimpleDateFormat
+  };
+
+  std::shared_ptr<icu::UMemory> get_cached_icu_formatter(
+      ICUFormatterCacheType cache_type, const std::string& key);
+  void set_icu_formatter_in_cache(ICUFormatterCacheType cache_type,
+                                  std::string key,
+                                  std::shared_ptr<icu::UMemory> obj);
+  void clear_cached_icu_formatters() { icu_formatter_cache_.clear(); }
+
 #endif  // V8_INTL_SUPPORT
 
   enum class KnownPrototype { kNone, kObject, kArray, kString };
@@ -2249,6 +2285,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::list<std::unique_ptr<detail::WaiterQueueNode>>&
   async_waiter_queue_nodes();
 
+  // Counts how the Atomics.Mutex locks taken on this isolate's thread were
+  // acquired when they were contended.
+  struct JSAtomicsMutexStats {
+    // Lock attempts that missed the uncontended fast path.
+    size_t contended = 0;
+    // Locks acquired by spinning, without parking.
+    size_t spun = 0;
+    // Times the thread parked, waiting for the lock to be released.
+    size_t parked = 0;
+    // Locks handed to the thread by the unlocking thread after parking.
+    size_t handed_off = 0;
+  };
+  JSAtomicsMutexStats& js_atomics_mutex_stats() {
+    return js_atomics_mutex_stats_;
+  }
+
   void ReportExceptionFunctionCallback(
       DirectHandle<JSReceiver> receiver,
       DirectHandle<FunctionTemplateInfo> function,
@@ -2422,6 +2474,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StubCache* load_stub_cache_ = nullptr;
   StubCache* store_stub_cache_ = nullptr;
   StubCache* define_own_stub_cache_ = nullptr;
+  ICSiteStats* ic_site_stats_ = nullptr;
+  DeoptStats* deopt_stats_ = nullptr;
+  CompileJobHistograms* compile_job_histograms_ = nullptr;
+  StartupTimings startup_timings_;
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
@@ -2430,6 +2486,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  TransitionLookupCache* transition_lookup_cache_ = nullptr;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
@@ -2497,6 +2554,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   };
 
   ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+
+  struct ICUFormatterCacheEntry {
+    ICUFormatterCacheType type;
+    std::string key;
+    std::shared_ptr<icu::UMemory> obj;
+  };
+
+  // Ordered from the most to the least recently used entry.
+  std::vector<ICUFormatterCacheEntry> icu_formatter_cache_;
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2720,6 +2786,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // List to manage the lifetime of the WaiterQueueNodes used to track async
   // waiters for JSSynchronizationPrimitives.
   std::list<std::unique_ptr<detail::WaiterQueueNode>> async_waiter_queue_nodes_;
+  JSAtomicsMutexStats js_atomics_mutex_stats_;
 
   // Used to track and safepoint all client isolates attached to this shared
   // isolate.
@@ -1125,6 +1125,44 @@ bool ErrorUtils::HasErrorStackSymbolOwnProperty(Isolate* isolate,
   return JSReceiver::HasOwnProperty(isolate, object, name).FromMaybe(false);
 }
 
+// static
+bool ErrorUtils::IsRawStackTrace(Tagged<Object> stack_trace) {
+  // Materialized stack traces only hold CallSiteInfos, whereas raw ones start
+  // with the frame count.
+  if (!IsFixedArray(stack_trace)) return false;
+  Tagged<FixedArray> array = Cast<FixedArray>(stack_trace);
+  return array->length() > 0 && IsSmi(array->get(0));
+}
+
+// static
+Handle<FixedArray> ErrorUtils::MaterializeCallSiteInfos(
+    Isolate* isolate, DirectHandle<FixedArray> raw_stack_trace) {
+  DCHECK(IsRawStackTrace(*raw_stack_trace));
+  int frame_count = Smi::ToInt(raw_stack_trace->get(0));
+  DCHECK_EQ(raw_stack_trace->length(), 1 + frame_count * kRawFrameSize);
+  Handle<FixedArray> call_site_infos =
+      isolate->factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    int base = 1 + i * kRawFrameSize;
+    DirectHandle<CallSiteInfo> info = isolate->factory()->NewCallSiteInfo(
+        direct_handle(
+            Cast<JSAny>(
+                raw_stack_trace->get(base + kRawFrameReceiverOrInstanceIndex)),
+            isolate),
+        direct_handle(Cast<UnionOf<Smi, JSFunction>>(
+                          raw_stack_trace->get(base + kRawFrameFunctionIndex)),
+                      isolate),
+        direct_handle(
+            Cast<HeapObject>(raw_stack_trace->get(base + kRawFrameCodeIndex)),
+            isolate),
+        Smi::ToInt(raw_stack_trace->get(base + kRawFrameOffsetIndex)),
+        Smi::ToInt(raw_stack_trace->get(base + kRawFrameFlagsIndex)),
+        isolate->factory()->empty_fixed_array());
+    call_site_infos->set(i, *info);
+  }
+  return call_site_infos;
+}
+
 // static
 ErrorUtils::StackPropertyLookupResult ErrorUtils::GetErrorStackProperty(
     Isolate* isolate, Handle<JSReceiver> maybe_error_object) {
@@ -1136,7 +1174,25 @@ ErrorUtils::StackPropertyLookupResult ErrorUtils::GetErrorStackProperty(
   if (!it.IsFound()) {
     return {MaybeHandle<JSObject>{}, isolate->factory()->undefined_value()};
   }
-  return {it.GetHolder<JSObject>(), result};
+  Handle<JSObject> holder = it.GetHolder<JSObject>();
+
+  if (IsErrorStackData(*result)) {
+    auto error_stack_data = Cast<ErrorStackData>(result);
+    Tagged<Object> stack = error_stack_data->call_site_infos_or_formatted_stack();
+    if (IsRawStackTrace(stack)) {
+      DirectHandle<FixedArray> call_site_infos = MaterializeCallSiteInfos(
+          isolate, handle(Cast<FixedArray>(stack), isolate));
+      error_stack_data->set_call_site_infos(*call_site_infos);
+    }
+  } else if (IsRawStackTrace(*result)) {
+    result = MaterializeCallSiteInfos(isolate, Cast<FixedArray>(result));
+    Object::SetProperty(isolate, holder,
+                        isolate->factory()->error_stack_symbol(), result,
+                        StoreOrigin::kMaybeKeyed,
+                        Just(ShouldThrow::kThrowOnError))
+        .Check();
+  }
+  return {holder, result};
 }
 
 // static
@@ -126,6 +126,24 @@ class ErrorUtils : public AllStatic {
   static bool HasErrorStackSymbolOwnProperty(Isolate* isolate,
                                              Handle<JSObject> object);
 
+  // Error stacks may be captured as raw frames, which are only turned into
+  // CallSiteInfo objects when the |error_stack_symbol| property is first
+  // looked up (see GetErrorStackProperty). Errors that are only used for
+  // control flow thus never allocate their CallSiteInfos.
+  //
+  // A raw stack trace is a FixedArray holding the number of frames as a Smi,
+  // followed by kRawFrameSize elements per frame.
+  static constexpr int kRawFrameReceiverOrInstanceIndex = 0;
+  static constexpr int kRawFrameFunctionIndex = 1;
+  static constexpr int kRawFrameCodeIndex = 2;
+  static constexpr int kRawFrameOffsetIndex = 3;
+  static constexpr int kRawFrameFlagsIndex = 4;
+  static constexpr int kRawFrameSize = 5;
+
+  static bool IsRawStackTrace(Tagged<Object> stack_trace);
+  static Handle<FixedArray> MaterializeCallSiteInfos(
+      Isolate* isolate, DirectHandle<FixedArray> raw_stack_trace);
+
   struct StackPropertyLookupResult {
     // The holder of the |error_stack_symbol| or empty handle.
     MaybeHandle<JSObject> error_stack_symbol_holder;
@@ -133,6 +151,7 @@ class ErrorUtils : public AllStatic {
     Handle<Object> error_stack;
   };
   // Gets |error_stack_symbol| property value by looking up the prototype chain.
+  // Raw stack traces are materialized into CallSiteInfos on the way.
   static StackPropertyLookupResult GetErrorStackProperty(
       Isolate* isolate, Handle<JSReceiver> maybe_error_object);
 
@@ -12,6 +12,7 @@
 #include "src/base/logging.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/microtask-inl.h"
 #include "src/objects/visitors.h"
 #include "src/roots/roots-inl.h"
@@ -166,6 +167,10 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
 
   intptr_t base_count = finished_microtask_count_;
   HandleScope handle_scope(isolate);
+  const bool report_metrics =
+      isolate->metrics_recorder()->HasEmbedderRecorder();
+  base::TimeTicks start_time;
+  if (report_metrics) start_time = base::TimeTicks::Now();
   MaybeHandle<Object> maybe_result;
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
@@ -209,6 +214,17 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
   }
 
   DCHECK_EQ(0, size());
+  if (report_metrics) {
+    v8::metrics::MicrotasksRun event;
+    event.microtask_count = processed_microtask_count;
+    event.wall_clock_duration_in_us =
+        (base::TimeTicks::Now() - start_time).InMicroseconds();
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->context().is_null()
+                   ? v8::metrics::Recorder::ContextId::Empty()
+                   : isolate->GetOrRegisterRecorderContextId(
+                         isolate->native_context()));
+  }
   OnCompleted(isolate);
 
   return processed_microtask_count;
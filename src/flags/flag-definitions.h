@@ -369,6 +369,12 @@ DEFINE_NEG_NEG_IMPLICATION(harmony_shipping, js_shipping)
 DEFINE_BOOL(builtin_subclassing, true,
             "subclassing support in built-in methods")
 
+// Non-standard: `new FinalizationRegistry(callback, {batched: true})` calls
+// the cleanup callback once with an array of the held values of all cleared
+// cells, instead of once per held value.
+DEFINE_BOOL(js_finalization_registry_batching, false,
+            "allow batched FinalizationRegistry cleanup callbacks")
+
 // If the following flag is set to `true`, the SharedArrayBuffer constructor is
 // enabled per context depending on the callback set via
 // `SetSharedArrayBufferConstructorEnabledCallback`. If no callback is set, the
@@ -378,6 +384,9 @@ DEFINE_BOOL(enable_sharedarraybuffer_per_context, false,
 
 #ifdef V8_INTL_SUPPORT
 DEFINE_BOOL(icu_timezone_data, true, "get information about timezones from ICU")
+DEFINE_UINT(intl_formatter_cache_size, 32,
+            "number of ICU formatters created by Intl constructors that are "
+            "kept for reuse (0 disables the cache)")
 #endif
 
 #ifdef V8_ENABLE_DOUBLE_CONST_STORE_CHECK
@@ -576,6 +585,9 @@ DEFINE_UINT(
     "max number of threads that concurrent Maglev can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_maglev_high_priority_threads, false,
             "use high priority compiler threads for concurrent Maglev")
+DEFINE_INT(concurrent_maglev_batch_bytecode_size, 4 * KB,
+           "the total bytecode size of the functions that a concurrent Maglev "
+           "task compiles before it requests their installation")
 
 DEFINE_INT(
     max_maglev_inline_depth, 1,
@@ -592,6 +604,13 @@ DEFINE_INT(max_maglev_inlined_bytecode_size_small, 27,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
              "minimum frequency for inlining")
+DEFINE_BOOL(maglev_polymorphic_inlining, false,
+            "inline calls whose target is one of a few known functions in "
+            "maglev")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_polymorphic_inlining)
+DEFINE_INT(max_maglev_polymorphic_inlining_targets, 4,
+           "maximum number of targets of a call that Maglev inlines "
+           "polymorphically")
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inline_depth, 1)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inlined_bytecode_size, 100)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
@@ -794,6 +813,9 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(parse_pretenuring, true,
+            "pretenure JSON.parse and deserialized payloads of call sites "
+            "whose payloads survive garbage collections")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -820,6 +842,16 @@ DEFINE_BOOL(trace_pretenuring_statistics, false,
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
+DEFINE_BOOL(inline_block_coverage_counters, true,
+            "increment block coverage counters inline in Maglev and "
+            "Turbofan code instead of calling the IncBlockCounter builtin, "
+            "which costs a C call to look up the coverage info per block")
+DEFINE_BOOL(block_coverage_first_execution_only, false,
+            "only record whether a block executed in optimized code, which "
+            "turns each inline counter update into a single store (counts "
+            "saturate at 1, as in binary coverage mode)")
+DEFINE_IMPLICATION(block_coverage_first_execution_only,
+                   inline_block_coverage_counters)
 DEFINE_BOOL(trace_protector_invalidation, false,
             "trace protector cell invalidations")
 DEFINE_BOOL(decommit_pooled_pages, false,
@@ -871,6 +903,10 @@ DEFINE_FLOAT(
 DEFINE_BOOL(always_osr_from_maglev, false,
             "whether we try to OSR to Turbofan from any Maglev")
 DEFINE_VALUE_IMPLICATION(always_osr_from_maglev, osr_from_maglev, true)
+DEFINE_BOOL(osr_from_maglev_hot_loops, false,
+            "whether we try to OSR to Turbofan from Maglev code of functions "
+            "which already had long-running loops in a lower tier")
+DEFINE_WEAK_IMPLICATION(future, osr_from_maglev_hot_loops)
 
 // Tiering: Turbofan.
 DEFINE_INT(invocation_count_for_turbofan, 3000,
@@ -919,6 +955,8 @@ DEFINE_BOOL(stress_ic, false, "exercise interesting paths in ICs more often")
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse common bytecode sequences into superinstructions")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
@@ -998,6 +1036,9 @@ DEFINE_UINT(
     "max number of threads that concurrent Sparkplug can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
+DEFINE_UINT(concurrent_sparkplug_install_budget, 0,
+            "max number of functions that concurrent Sparkplug installs per "
+            "interrupt on the main thread (0 for unbounded)")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
@@ -1039,6 +1080,16 @@ DEFINE_SIZE_T(
     max_shared_heap_size, 0,
     "max size of the shared heap (in Mbytes); "
     "other heap size flags (e.g. max_shared_heap_size) take precedence")
+DEFINE_BOOL(shared_space_adaptive_lab, true,
+            "size linear allocation areas in the shared space based on the "
+            "allocating isolate's shared allocation volume")
+DEFINE_BOOL(js_atomics_mutex_adaptive_spinning, true,
+            "adapt how long a contended Atomics.Mutex is spun on before "
+            "parking to how long spinning recently took to acquire it")
+DEFINE_INT(js_atomics_mutex_handoff_threshold_ms, -1,
+           "hand an Atomics.Mutex directly to a waiter that has been parked "
+           "for at least this many milliseconds when it is unlocked, to "
+           "prevent starvation (-1 to disable)")
 
 // Flags for concurrent recompilation.
 DEFINE_BOOL(concurrent_recompilation, true,
@@ -1217,6 +1268,14 @@ DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
+DEFINE_BOOL(trace_turbo_block_parallelism, false,
+            "trace how much time instruction selection and code generation "
+            "would save by processing blocks on several threads")
+DEFINE_INT(turbo_block_parallelism_threads, 4,
+           "number of threads assumed by --trace-turbo-block-parallelism")
+DEFINE_INT(turbo_block_parallelism_min_blocks, 1000,
+           "minimum number of blocks of the functions traced by "
+           "--trace-turbo-block-parallelism")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
 DEFINE_INT(max_inlined_bytecode_size, 460,
@@ -1309,15 +1368,25 @@ DEFINE_STRING(
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_INT(turbo_fast_register_allocation_threshold, 100000,
+           "use the fast register allocation mode for functions with at least "
+           "this many instructions (0 to disable)")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_BOOL(turbo_escape_analysis_closures, false,
+            "allow escape analysis to virtualize the closures and function "
+            "contexts of inlined functions")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_STRING(turbo_instruction_scheduling_cpu, "auto",
+              "the core that the instruction scheduler targets (auto, "
+              "generic, intel-core, amd-zen, neoverse-n1, neoverse-n2 or "
+              "neoverse-v1)")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -1391,6 +1460,14 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_loop_invariant_code_motion, true,
+            "enable Turboshaft's loop-invariant code motion")
+DEFINE_BOOL(turboshaft_bounds_check_elimination, true,
+            "enable Turboshaft's elimination of bounds checks on loop "
+            "induction variables")
+DEFINE_EXPERIMENTAL_FEATURE(turboshaft_loop_vectorization,
+                            "vectorize simple loops over typed arrays with "
+                            "Simd128 operations in Turboshaft")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1472,6 +1549,11 @@ DEFINE_BOOL_READONLY(turboshaft_trace_intermediate_reductions, false,
 DEFINE_BOOL(profile_guided_optimization, true, "profile guided optimization")
 DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
+DEFINE_BOOL(profile_guided_optimization_in_code_cache, false,
+            "keep the early optimization decisions of profile guided "
+            "optimization in the code cache")
+DEFINE_IMPLICATION(profile_guided_optimization_in_code_cache,
+                   profile_guided_optimization)
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
 DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
@@ -1494,6 +1576,9 @@ DEFINE_BOOL(wasm_generic_wrapper, true,
 DEFINE_BOOL(wasm_to_js_generic_wrapper, true,
             "allow use of the generic wasm-to-js wrapper instead of "
             "per-signature wrappers")
+DEFINE_BOOL(wasm_to_js_reuse_tiered_wrappers, true,
+            "skip the generic wasm-to-js wrapper for imports whose "
+            "per-signature wrapper was already compiled by a tier-up")
 DEFINE_BOOL(expose_wasm, true, "expose wasm interface to JavaScript")
 // Do not expose wasm in jitless mode.
 //
@@ -1529,6 +1614,10 @@ DEFINE_BOOL(trace_wasm_offheap_memory, false,
             "API is used")
 DEFINE_DEBUG_BOOL(trace_wasm_serialization, false,
                   "trace serialization/deserialization")
+DEFINE_BOOL(wasm_partial_deserialization, false,
+            "accept truncated serialized wasm modules, and compile the "
+            "functions whose code is missing lazily")
+DEFINE_WEAK_IMPLICATION(future, wasm_partial_deserialization)
 DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
@@ -1596,6 +1685,10 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_INT(liftoff_loop_register_locals, 0,
+           "maximum number of locals which Liftoff keeps in registers when "
+           "entering a loop instead of spilling them")
+DEFINE_WEAK_VALUE_IMPLICATION(future, liftoff_loop_register_locals, 4)
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1649,6 +1742,9 @@ DEFINE_BOOL(trace_asm_scanner, false,
             "print tokens encountered by asm.js scanner")
 DEFINE_BOOL(trace_asm_parser, false, "verbose logging of asm.js parse failures")
 DEFINE_BOOL(stress_validate_asm, false, "try to validate everything as asm.js")
+DEFINE_SIZE_T(asm_wasm_translation_cache_size, 16,
+              "maximum size (in MB) of the process-wide cache of asm.js "
+              "modules translated to Wasm (0 disables the cache)")
 
 DEFINE_DEBUG_BOOL(dump_wasm_module, false, "dump wasm module bytes")
 DEFINE_STRING(dump_wasm_module_path, nullptr,
@@ -1759,6 +1855,10 @@ DEFINE_EXPERIMENTAL_FEATURE(
     wasm_lazy_validation,
     "enable lazy validation for lazily compiled wasm functions")
 DEFINE_WEAK_IMPLICATION(wasm_lazy_validation, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_async_streaming_validation, false,
+            "don't wait for the background validation of function bodies at "
+            "the end of a stream, but finish streaming compilation when "
+            "validation is done")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -1771,6 +1871,9 @@ DEFINE_BOOL(stress_wasm_memory_moving, false,
             "always move non-shared bounds-checked Wasm memory on grow")
 DEFINE_BOOL(flush_liftoff_code, false,
             "enable flushing liftoff code on memory pressure signal")
+DEFINE_BOOL(wasm_hot_code_region, false,
+            "place tiered-up code in contiguous regions which are aligned to "
+            "huge pages, separate from Liftoff code")
 
 DEFINE_SIZE_T(wasm_max_module_size, wasm::kV8MaxWasmModuleSize,
               "maximum allowed size of wasm modules")
@@ -1805,6 +1908,9 @@ DEFINE_EXPERIMENTAL_FEATURE(
     experimental_wasm_revectorize,
     "enable 128 to 256 bit revectorization for Webassembly SIMD")
 DEFINE_BOOL(trace_wasm_revectorize, false, "trace wasm revectorize")
+DEFINE_BOOL(trace_wasm_revectorize_coverage, false,
+            "print how many SIMD operations were revectorized, and which "
+            "operations could not be packed")
 #endif  // V8_ENABLE_WASM_SIMD256_REVEC
 
 #if V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
@@ -1899,6 +2005,9 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
 // Set minimum semi space growth factor
 DEFINE_MIN_VALUE_IMPLICATION(semi_space_growth_factor, 2)
+DEFINE_BOOL(new_space_sizing_per_allocation_phase, true,
+            "size new space based on previous activations of embedder-defined "
+            "allocation phases")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1945,6 +2054,9 @@ DEFINE_BOOL(trace_gc_freelists_verbose, false,
             "prints details of freelists of each page before and after "
             "each major garbage collection")
 DEFINE_IMPLICATION(trace_gc_freelists_verbose, trace_gc_freelists)
+DEFINE_UINT(write_barrier_slow_path_sampling_interval, 64,
+            "add write barrier slow path entries to the heap statistics once "
+            "per this many entries on a thread")
 DEFINE_BOOL(trace_gc_heap_layout, false,
             "print layout of pages in heap before and after gc")
 DEFINE_BOOL(trace_gc_heap_layout_ignore_minor_gc, true,
@@ -1980,7 +2092,20 @@ DEFINE_INT(incremental_marking_soft_trigger, 0,
 DEFINE_INT(incremental_marking_hard_trigger, 0,
            "threshold for starting incremental marking immediately in percent "
            "of available space: limit - size")
+DEFINE_INT(incremental_marking_mmu_window, 0,
+           "window in ms over which incremental marking steps keep the mutator "
+           "utilization at --incremental-marking-target-mmu (0 = disabled)")
+DEFINE_FLOAT(incremental_marking_target_mmu, 0.7,
+             "minimum mutator utilization in (0, 1) that incremental marking "
+             "steps target within --incremental-marking-mmu-window")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_FLOAT(gc_pause_budget_in_ms_per_second, 0.0,
+             "GC time in ms per second of wall time that the heap growing "
+             "heuristics aim for (0 means no budget); overrides "
+             "ResourceConstraints::gc_pause_budget_in_ms_per_second")
+DEFINE_BOOL(numa_aware_page_placement, false,
+            "prefer the NUMA node of the isolate's main thread for the "
+            "physical memory of new and old space pages")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(minor_gc_task, true, "schedule scavenge tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
@@ -2009,6 +2134,8 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "release dead array buffers in batches on a background job")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
@@ -2016,6 +2143,12 @@ DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_BOOL(gc_work_stealing, false,
+            "let idle parallel marking and scavenging threads steal half of "
+            "the private work of busy threads")
+DEFINE_INT(gc_work_stealing_attempts, 16,
+           "number of times an idle parallel GC thread retries to steal work "
+           "before giving up")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
                            concurrent_array_buffer_sweeping)
@@ -2024,6 +2157,9 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_BOOL(parallel_external_pointer_table_sweeping, true,
+            "use parallel threads to sweep large external pointer table "
+            "spaces in the atomic pause")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -2047,6 +2183,9 @@ DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
     TracingFlags::zone_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_SIZE_T(zone_segment_pool_size, 2 * MB,
+              "maximum size of the zone segments that are kept for reuse "
+              "after their zone dies (0 disables the pool)")
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
@@ -2083,6 +2222,15 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(memory_reducer_gc_count, 2,
            "Maximum number of memory reducer GCs scheduled")
+DEFINE_INT(memory_reducer_idle_decommit_interval_ms, 1000,
+           "interval at which the memory reducer releases pooled pages while "
+           "the embedder hints that the isolate is idle")
+DEFINE_INT(memory_reducer_idle_decommit_pages, 4,
+           "maximum number of pooled pages released per interval while the "
+           "isolate is idle")
+DEFINE_INT(memory_reducer_max_precommit_pages, 64,
+           "maximum number of pages recommitted when the embedder hints that "
+           "load is expected")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
@@ -2114,6 +2262,9 @@ DEFINE_IMPLICATION(stress_compaction, gc_global)
 DEFINE_VALUE_IMPLICATION(stress_compaction, max_semi_space_size, (size_t)1)
 DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
+DEFINE_INT(baseline_code_old_age, 3,
+           "number of gcs before we flush baseline code while keeping the "
+           "bytecode (0 flushes baseline code only together with bytecode)")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_INT(bytecode_old_age, 6, "number of gcs before we flush code")
@@ -2121,8 +2272,16 @@ DEFINE_BOOL(flush_code_based_on_time, false,
             "Use time-base code flushing instead of age.")
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
+DEFINE_BOOL(adaptive_bytecode_flushing, false,
+            "Increase the bytecode_old_age of functions which are recompiled "
+            "soon after their bytecode was flushed.")
+DEFINE_NEG_IMPLICATION(flush_code_based_on_time, adaptive_bytecode_flushing)
+DEFINE_NEG_IMPLICATION(flush_code_based_on_tab_visibility,
+                       adaptive_bytecode_flushing)
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
+DEFINE_BOOL(flush_script_line_ends, true,
+            "drop the cached line ends of scripts in memory-reducing GCs")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
@@ -2192,6 +2351,9 @@ DEFINE_WEAK_IMPLICATION(concurrent_marking, cppheap_concurrent_marking)
 DEFINE_BOOL(cppheap_optimize_sweep_for_mutator, true,
             "optimize sweeping for mutator time (i.e. spend less time in "
             "synchronous sweeping and idle time)")
+DEFINE_BOOL(cppheap_compact_fragmented_spaces, true,
+            "compact fragmented compactable CppHeap spaces also in garbage "
+            "collections that are not memory reducing")
 
 DEFINE_BOOL(memory_balancer, false,
             "use membalancer, "
@@ -2376,6 +2538,14 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_BOOL(deopt_loop_detection, false,
+            "generalize the feedback at sites which repeatedly deoptimize "
+            "for the same reason")
+DEFINE_WEAK_IMPLICATION(future, deopt_loop_detection)
+DEFINE_BOOL(trace_deopt_loops, false, "trace detected deoptimization loops")
+DEFINE_BOOL(deopt_stats, false,
+            "summarize deoptimizations per source position and optimization "
+            "bailouts per function for v8::Isolate::GetDeoptStatistics")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -2397,12 +2567,28 @@ DEFINE_BOOL(external_reference_stats, false,
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
 
+// process-compilation-cache.cc
+DEFINE_BOOL(process_compilation_cache, false,
+            "share the code caches of compiled scripts between the isolates "
+            "of the process")
+DEFINE_SIZE_T(process_compilation_cache_size, 64,
+              "max size of the process-wide compilation cache (in Mbytes)")
+
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
+// lookup-cache.cc
+DEFINE_UINT(descriptor_lookup_cache_size, 256,
+            "number of entries in the per-isolate descriptor lookup cache "
+            "(rounded up to a power of two)")
+
 // lazy-compile-dispatcher.cc
 DEFINE_BOOL(lazy_compile_dispatcher, false, "enable compiler dispatcher")
 DEFINE_UINT(lazy_compile_dispatcher_max_threads, 0,
             "max threads for compiler dispatcher (0 for unbounded)")
+DEFINE_UINT(lazy_compile_dispatcher_max_source_kb, 16 * 1024,
+            "max total source size in KB of the functions enqueued on the "
+            "compiler dispatcher and not finalized yet; functions beyond it "
+            "are compiled on their first call (0 for unbounded)")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 DEFINE_BOOL(
@@ -2417,11 +2603,26 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_BOOL(cpu_profiler_per_thread_timer, false,
+            "on Linux, have the kernel deliver CPU profiler sampling signals "
+            "from a perf_event task clock of the profiled thread instead of "
+            "sending them from the profiler thread. Samples are then only "
+            "taken while the profiled thread is running.")
+DEFINE_BOOL(cpu_profiler_leaf_only_samples, false,
+            "only record the topmost JS frame in CPU profiler samples and "
+            "resolve its inlined functions from the code entries later, "
+            "instead of walking the whole stack in the signal handler")
 
 // debugger
 DEFINE_BOOL(
     trace_side_effect_free_debug_evaluate, false,
     "print debug messages for side-effect-free debug-evaluate for testing")
+DEFINE_BOOL(breakpoint_entry_checks, false,
+            "check an off-heap flag on entry to every function in Maglev and "
+            "Turbofan code, so that setting a break point only deoptimizes "
+            "running code and code that enters the function later, instead of "
+            "all code containing the function. Costs a load and a branch per "
+            "(inlined) function entry")
 DEFINE_BOOL(hard_abort, true, "abort by crashing")
 DEFINE_NEG_IMPLICATION(fuzzing, hard_abort)
 DEFINE_NEG_IMPLICATION(hole_fuzzing, hard_abort)
@@ -2486,10 +2687,22 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_BOOL(ic_site_stats, false,
+            "summarize inline cache misses per access site for "
+            "v8::Isolate::GetICStatistics")
+DEFINE_GENERIC_IMPLICATION(
+    ic_site_stats,
+    TracingFlags::ic_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SITE_STATS))
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_BOOL(stub_cache_adaptive_sizing, false,
+            "resize the megamorphic stub caches based on their miss rate")
+DEFINE_FLOAT(stub_cache_grow_miss_rate, 0.1,
+             "miss rate between two GCs above which a stub cache grows")
+DEFINE_BOOL(trace_stub_cache_sizing, false, "trace stub cache resizing")
 DEFINE_BOOL(
     clone_object_sidestep_transitions, true,
     "support sidestep transitions for dependency tracking object clone maps")
@@ -2502,6 +2715,10 @@ DEFINE_INT(fast_properties_soft_limit, 12,
 DEFINE_INT(max_fast_properties, 128,
            "limits the number of mutable properties that can be added to an "
            "object before transitioning to dictionary mode")
+DEFINE_BOOL(read_mostly_dictionary_to_fast, false,
+            "migrate dictionary-mode objects back to fast properties after "
+            "many loads without properties being added or deleted")
+DEFINE_WEAK_IMPLICATION(future, read_mostly_dictionary_to_fast)
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -2564,6 +2781,9 @@ DEFINE_BOOL(sim_abort_on_bad_auth, true,
 // isolate.cc
 DEFINE_BOOL(async_stack_traces, true,
             "include async stack traces in Error.stack")
+DEFINE_BOOL(lazy_call_site_infos, true,
+            "capture Error.stack frames compactly and only create the "
+            "CallSiteInfo objects when the stack is first accessed")
 DEFINE_BOOL(stack_trace_on_illegal, false,
             "print stack trace when an illegal exception is thrown")
 DEFINE_BOOL(abort_on_uncaught_exception, false,
@@ -2596,6 +2816,9 @@ DEFINE_BOOL(experimental_flush_embedded_blob_icache, true,
             "Used in an experiment to evaluate icache flushing on certain CPUs")
 DEFINE_BOOL(allow_allocation_in_fast_api_call, true,
             "Allow allocations in fast API calls.")
+DEFINE_BOOL(parallel_bigint, false,
+            "use worker threads for multiplication, division and conversion "
+            "to string of very large BigInts")
 
 // Flags for short builtin calls feature
 #if V8_SHORT_BUILTIN_CALLS
@@ -2641,6 +2864,22 @@ DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
 
+DEFINE_UINT(rcs_sampling_interval, 0,
+            "count runtime calls without tracing, but only measure the time "
+            "of every n-th outermost runtime call (0 means disabled)")
+DEFINE_GENERIC_IMPLICATION(
+    rcs_sampling_interval,
+    TracingFlags::runtime_stats.fetch_or(
+        v8_flags.runtime_call_stats
+            ? 0
+            : v8::tracing::TracingCategoryObserver::
+                  ENABLED_BY_SAMPLED_COUNTERS))
+
+// runtime-typedarray.cc
+DEFINE_BOOL(parallel_typed_array_sort, false,
+            "use background threads to sort large typed arrays which are not "
+            "backed by a SharedArrayBuffer")
+
 // snapshot-common.cc
 DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
@@ -2648,10 +2887,28 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(trace_startup, false,
+            "Print the time spent in the phases of isolate and context "
+            "creation.")
+#ifdef V8_SNAPSHOT_COMPRESSION
+DEFINE_BOOL(compress_code_cache, false,
+            "Compress code caches with the snapshot compression codec.")
+#else
+DEFINE_BOOL_READONLY(compress_code_cache, false,
+                     "Compress code caches with the snapshot compression "
+                     "codec.")
+#endif  // V8_SNAPSHOT_COMPRESSION
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_INT(snapshot_cold_bytecode_age, 0,
+           "when creating a snapshot which keeps function code, discard the "
+           "bytecode of functions with at least this bytecode age, so that "
+           "they are compiled lazily on first call (0 keeps all bytecode)")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_simd_skip, true,
+            "use vector instructions to skip ahead to possible match starts in "
+            "regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
 #ifdef V8_TARGET_BIG_ENDIAN
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL false
@@ -2665,6 +2922,9 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_work, 1000,
+           "set the amount of work (backtracks and characters scanned) the "
+           "regexp interpreter has to do before tiering-up to the compiler")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -2689,6 +2949,9 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_skip_ahead, true,
+            "let the experimental regexp engine skip input positions at "
+            "which no match can start")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -2780,6 +3043,10 @@ DEFINE_BOOL_READONLY(
 DEFINE_NEG_IMPLICATION(sandbox_fuzzing, sandbox_testing)
 DEFINE_NEG_IMPLICATION(sandbox_testing, sandbox_fuzzing)
 
+DEFINE_BOOL(js_dispatch_table_thread_local_batches, true,
+            "when the JSDispatchTable has to grow, give each allocating "
+            "thread a segment of its own to allocate entries from")
+
 #if defined(V8_OS_AIX) && defined(COMPONENT_BUILD)
 // FreezeFlags relies on mprotect() method, which does not work by default on
 // shared mem: https://www.ibm.com/docs/en/aix/7.2?topic=m-mprotect-subroutine
@@ -3021,6 +3288,8 @@ DEFINE_BOOL(detailed_line_info, false,
 
 DEFINE_BOOL(perfetto_code_logger, false,
             "Enable the Perfetto code data source.")
+DEFINE_BOOL(perfetto_heap_graph, false,
+            "Enable the Perfetto heap graph data source.")
 
 #if defined(ANDROID)
 // Phones and tablets have processors that are much slower than desktop
@@ -3081,7 +3350,13 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
+// The jitdump file records code moves, so code space compaction can be
+// re-enabled explicitly.
+DEFINE_WEAK_NEG_IMPLICATION(perf_prof, compact_code_space)
+DEFINE_PERF_PROF_BOOL(
+    perf_prof_buffered,
+    "Write the --perf-basic-prof and --perf-prof files from a background "
+    "thread instead of on the thread that creates the code.")
 
 // --perf-prof-unwinding-info is available only on selected architectures.
 #if V8_TARGET_ARCH_ARM || V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64 || \
@@ -3217,6 +3492,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_typed_array_sort)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -3232,8 +3508,11 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
+DEFINE_NEG_IMPLICATION(single_threaded_gc,
+                       parallel_external_pointer_table_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_freeing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
 
@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/allocation-phase-tracker.h"
+
+#include <cmath>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+void AllocationPhaseTracker::SetPhase(uint32_t phase,
+                                      size_t new_space_allocation_counter) {
+  if (phase == current_phase_) return;
+  if (pending_allocated_bytes_ > 0) {
+    phases_[current_phase_].total_allocated_bytes += pending_allocated_bytes_;
+    pending_allocated_bytes_ = 0;
+  }
+  if (current_phase_ != kDefaultPhase) {
+    // The counter may go backwards slightly as it is only precise during GC.
+    const size_t allocated =
+        new_space_allocation_counter > activation_start_allocation_counter_
+            ? new_space_allocation_counter -
+                  activation_start_allocation_counter_
+            : 0;
+    PhaseStats& stats = phases_[current_phase_];
+    stats.allocated_bytes_per_activation =
+        Average(stats.allocated_bytes_per_activation,
+                static_cast<double>(allocated));
+  }
+  current_phase_ = phase;
+  activation_start_allocation_counter_ = new_space_allocation_counter;
+}
+
+std::vector<std::pair<uint32_t, size_t>>
+AllocationPhaseTracker::AllocatedBytesPerPhase() const {
+  std::vector<std::pair<uint32_t, size_t>> result;
+  bool found_current_phase = false;
+  for (const auto& [phase, stats] : phases_) {
+    size_t allocated = stats.total_allocated_bytes;
+    if (phase == current_phase_) {
+      allocated += pending_allocated_bytes_;
+      found_current_phase = true;
+    }
+    if (allocated > 0) result.emplace_back(phase, allocated);
+  }
+  if (!found_current_phase && pending_allocated_bytes_ > 0) {
+    result.emplace_back(current_phase_, pending_allocated_bytes_);
+  }
+  return result;
+}
+
+void AllocationPhaseTracker::NotifyGarbageCollection(double survival_rate) {
+  if (current_phase_ == kDefaultPhase) return;
+  DCHECK_LE(0.0, survival_rate);
+  PhaseStats& stats = phases_[current_phase_];
+  stats.survival_rate = Average(stats.survival_rate, survival_rate);
+}
+
+const AllocationPhaseTracker::PhaseStats*
+AllocationPhaseTracker::CurrentPhaseStats() const {
+  if (current_phase_ == kDefaultPhase) return nullptr;
+  auto it = phases_.find(current_phase_);
+  return it == phases_.end() ? nullptr : &it->second;
+}
+
+std::optional<size_t> AllocationPhaseTracker::ExpectedAllocationForCurrentPhase()
+    const {
+  const PhaseStats* stats = CurrentPhaseStats();
+  if (!stats || !stats->allocated_bytes_per_activation) return {};
+  return static_cast<size_t>(std::ceil(*stats->allocated_bytes_per_activation));
+}
+
+std::optional<double> AllocationPhaseTracker::SurvivalRateForCurrentPhase()
+    const {
+  const PhaseStats* stats = CurrentPhaseStats();
+  if (!stats) return {};
+  return stats->survival_rate;
+}
+
+}  // namespace internal
+}  // namespace v8
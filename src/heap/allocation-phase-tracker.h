@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ALLOCATION_PHASE_TRACKER_H_
+#define V8_HEAP_ALLOCATION_PHASE_TRACKER_H_
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Tracks young generation allocation and survival for embedder-defined
+// allocation phases (see v8::Isolate::AllocationPhaseScope). An activation of a
+// phase spans from switching to the phase until switching away from it. The
+// statistics of previous activations are used to size new space ahead of
+// phases that are known to allocate heavily. The tracker also counts the bytes
+// allocated in all spaces during each phase for the embedder.
+//
+// Only used from the main thread.
+class V8_EXPORT_PRIVATE AllocationPhaseTracker final {
+ public:
+  // Phase of all allocations that are not tagged by the embedder. No
+  // predictions are made for the default phase.
+  static constexpr uint32_t kDefaultPhase = 0;
+
+  // Switches to `phase`, ending the activation of the current phase.
+  // `new_space_allocation_counter` is the monotonically increasing number of
+  // bytes allocated in new space so far.
+  void SetPhase(uint32_t phase, size_t new_space_allocation_counter);
+
+  uint32_t current_phase() const { return current_phase_; }
+
+  // Accounts `bytes` allocated on the main thread to the current phase. Bytes
+  // are accounted in bulk when a LAB is retired or extended, and for each
+  // large object.
+  void AddAllocatedBytes(size_t bytes) { pending_allocated_bytes_ += bytes; }
+
+  // Returns the bytes accounted to each phase, including the default phase,
+  // that allocated at least one byte.
+  std::vector<std::pair<uint32_t, size_t>> AllocatedBytesPerPhase() const;
+
+  // Records the young generation survival rate (in percent) of a garbage
+  // collection during the current phase.
+  void NotifyGarbageCollection(double survival_rate);
+
+  // Returns the number of new space bytes a single activation of the current
+  // phase is expected to allocate. Returns nullopt for the default phase and for
+  // phases without completed activations.
+  std::optional<size_t> ExpectedAllocationForCurrentPhase() const;
+
+  // Returns the expected young generation survival rate (in percent) of the
+  // current phase or nullopt if no garbage collection happened during the
+  // phase so far.
+  std::optional<double> SurvivalRateForCurrentPhase() const;
+
+ private:
+  // Weight of the most recent sample in the running averages.
+  static constexpr double kSampleWeight = 0.3;
+
+  struct PhaseStats {
+    std::optional<double> allocated_bytes_per_activation;
+    std::optional<double> survival_rate;
+    size_t total_allocated_bytes = 0;
+  };
+
+  static double Average(std::optional<double> average, double sample) {
+    return average ? kSampleWeight * sample + (1 - kSampleWeight) * *average
+                   : sample;
+  }
+
+  const PhaseStats* CurrentPhaseStats() const;
+
+  uint32_t current_phase_ = kDefaultPhase;
+  size_t activation_start_allocation_counter_ = 0;
+  // Bytes allocated since switching to the current phase.
+  size_t pending_allocated_bytes_ = 0;
+  std::unordered_map<uint32_t, PhaseStats> phases_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ALLOCATION_PHASE_TRACKER_H_
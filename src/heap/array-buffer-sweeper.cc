@@ -13,6 +13,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
 
 namespace v8 {
@@ -97,7 +98,11 @@ class ArrayBufferSweeper::SweepingState final {
   void MergeTo(ArrayBufferSweeper* sweeper) {
     sweeper->young_.Append(new_young_);
     sweeper->old_.Append(new_old_);
+    // External memory is accounted once per sweep, even if the dead extensions
+    // are only released later on.
     sweeper->DecrementExternalMemoryCounters(freed_bytes_);
+    sweeper->ScheduleFreeing(dead_extensions_);
+    dead_extensions_ = nullptr;
   }
 
   void StartBackgroundSweeping() { job_handle_->NotifyConcurrencyIncrease(); }
@@ -113,6 +118,8 @@ class ArrayBufferSweeper::SweepingState final {
   ArrayBufferList new_young_{ArrayBufferList::Age::kYoung};
   ArrayBufferList new_old_{ArrayBufferList::Age::kOld};
   size_t freed_bytes_{0};
+  // Dead extensions linked through their next pointers.
+  ArrayBufferExtension* dead_extensions_ = nullptr;
   std::unique_ptr<JobHandle> job_handle_;
 };
 
@@ -149,6 +156,7 @@ class ArrayBufferSweeper::SweepingState::SweepingJob final : public JobTask {
   bool SweepYoung(JobDelegate* delegate);
   bool SweepFull(JobDelegate* delegate);
   bool SweepListFull(JobDelegate* delegate, ArrayBufferList& list);
+  void Release(ArrayBufferExtension* extension);
 
   Heap* const heap_;
   SweepingState& state_;
@@ -198,6 +206,52 @@ void ArrayBufferSweeper::SweepingState::SweepingJob::Run(
   Sweep(delegate);
 }
 
+class ArrayBufferSweeper::FreeingJob final : public JobTask {
+ public:
+  explicit FreeingJob(ArrayBufferSweeper* sweeper) : sweeper_(sweeper) {}
+
+  ~FreeingJob() override = default;
+
+  FreeingJob(const FreeingJob&) = delete;
+  FreeingJob& operator=(const FreeingJob&) = delete;
+
+  void Run(JobDelegate* delegate) final;
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return sweeper_->freeing_batches_count_.load(std::memory_order_relaxed) > 0
+               ? 1
+               : 0;
+  }
+
+ private:
+  ArrayBufferSweeper* const sweeper_;
+};
+
+void ArrayBufferSweeper::FreeingJob::Run(JobDelegate* delegate) {
+  static constexpr size_t kYieldCheckInterval = 256;
+  static_assert(base::bits::IsPowerOfTwo(kYieldCheckInterval),
+                "kYieldCheckInterval must be power of 2");
+
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+               "ArrayBufferSweeper::FreeingJob");
+  // Backing store memory of all extensions released here is handed to the
+  // embedder's allocator in batches.
+  BackingStore::BatchedFreeScope batched_free_scope;
+  size_t released_extensions = 0;
+  while (ArrayBufferExtension* current = sweeper_->TakeFreeingBatch()) {
+    while (current) {
+      if ((released_extensions++ & (kYieldCheckInterval - 1)) == 0 &&
+          delegate->ShouldYield()) {
+        sweeper_->ReturnFreeingBatch(current);
+        return;
+      }
+      ArrayBufferExtension* next = current->next();
+      delete current;
+      current = next;
+    }
+  }
+}
+
 ArrayBufferSweeper::SweepingState::SweepingState(
     Heap* heap, ArrayBufferList young, ArrayBufferList old,
     ArrayBufferSweeper::SweepingType type,
@@ -213,6 +267,7 @@ ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
+  EnsureFreeingFinished();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
 }
@@ -380,6 +435,75 @@ void ArrayBufferSweeper::FinalizeAndDelete(ArrayBufferExtension* extension) {
   delete extension;
 }
 
+void ArrayBufferSweeper::ScheduleFreeing(
+    ArrayBufferExtension* dead_extensions) {
+  if (!dead_extensions) return;
+  if (!v8_flags.concurrent_array_buffer_freeing || heap_->IsTearingDown() ||
+      heap_->ShouldReduceMemory() || !heap_->ShouldUseBackgroundThreads()) {
+    BackingStore::BatchedFreeScope batched_free_scope;
+    while (dead_extensions) {
+      ArrayBufferExtension* next = dead_extensions->next();
+      delete dead_extensions;
+      dead_extensions = next;
+    }
+    return;
+  }
+  base::MutexGuard guard(&freeing_mutex_);
+  freeing_batches_.push_back(dead_extensions);
+  freeing_batches_count_.fetch_add(1, std::memory_order_relaxed);
+  if (freeing_job_running_) {
+    freeing_job_handle_->NotifyConcurrencyIncrease();
+    return;
+  }
+  // The previous job (if any) has already observed that there's no work left
+  // and is about to finish.
+  if (freeing_job_handle_) freeing_job_handle_->Join();
+  freeing_job_running_ = true;
+  freeing_job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible, std::make_unique<FreeingJob>(this));
+}
+
+ArrayBufferExtension* ArrayBufferSweeper::TakeFreeingBatch() {
+  base::MutexGuard guard(&freeing_mutex_);
+  if (freeing_batches_.empty()) {
+    freeing_job_running_ = false;
+    return nullptr;
+  }
+  ArrayBufferExtension* dead_extensions = freeing_batches_.back();
+  freeing_batches_.pop_back();
+  freeing_batches_count_.fetch_sub(1, std::memory_order_relaxed);
+  return dead_extensions;
+}
+
+void ArrayBufferSweeper::ReturnFreeingBatch(
+    ArrayBufferExtension* dead_extensions) {
+  DCHECK_NOT_NULL(dead_extensions);
+  base::MutexGuard guard(&freeing_mutex_);
+  DCHECK(freeing_job_running_);
+  freeing_batches_.push_back(dead_extensions);
+  freeing_batches_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ArrayBufferSweeper::EnsureFreeingFinished() {
+  if (!freeing_job_handle_) return;
+  freeing_job_handle_->Join();
+  freeing_job_handle_.reset();
+  DCHECK(freeing_batches_.empty());
+}
+
+void ArrayBufferSweeper::SweepingState::SweepingJob::Release(
+    ArrayBufferExtension* extension) {
+  if (!v8_flags.concurrent_array_buffer_freeing) {
+    FinalizeAndDelete(extension);
+    return;
+  }
+#ifdef V8_COMPRESS_POINTERS
+  extension->ZapExternalPointerTableEntry();
+#endif  // V8_COMPRESS_POINTERS
+  extension->set_next(state_.dead_extensions_);
+  state_.dead_extensions_ = extension;
+}
+
 void ArrayBufferSweeper::SweepingState::SweepingJob::Sweep(
     JobDelegate* delegate) {
   CHECK(!state_.IsDone());
@@ -427,7 +551,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepListFull(
 
     const size_t bytes = current->accounting_length();
     if (!current->IsMarked()) {
-      FinalizeAndDelete(current);
+      Release(current);
       if (bytes) freed_bytes += bytes;
     } else {
       current->Unmark();
@@ -466,7 +590,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
 
     const size_t bytes = current->accounting_length();
     if (!current->IsYoungMarked()) {
-      FinalizeAndDelete(current);
+      Release(current);
       if (bytes) freed_bytes += bytes;
     } else {
       if ((treat_all_young_as_promoted_ == TreatAllYoungAsPromoted::kYes) ||
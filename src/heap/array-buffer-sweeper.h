@@ -5,7 +5,9 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 #define V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
@@ -48,7 +50,9 @@ struct ArrayBufferList final {
 };
 
 // The ArrayBufferSweeper iterates and deletes ArrayBufferExtensions
-// concurrently to the application.
+// concurrently to the application. Dead extensions (and thus their backing
+// stores) are released in batches by a separate freeing job, so that slow
+// backing store deleters don't delay finishing sweeping.
 class ArrayBufferSweeper final {
  public:
   enum class SweepingType { kYoung, kFull };
@@ -81,6 +85,7 @@ class ArrayBufferSweeper final {
 
  private:
   class SweepingState;
+  class FreeingJob;
 
   // Finishes sweeping if it is already done.
   void FinishIfDone();
@@ -100,10 +105,26 @@ class ArrayBufferSweeper final {
 
   static void FinalizeAndDelete(ArrayBufferExtension* extension);
 
+  // Releases a list of dead extensions (linked through their next pointers),
+  // either on the freeing job or synchronously.
+  void ScheduleFreeing(ArrayBufferExtension* dead_extensions);
+  // Returns the next list of dead extensions to be released by the freeing
+  // job or nullptr if there's none left.
+  ArrayBufferExtension* TakeFreeingBatch();
+  // Returns a partially released list to be picked up later.
+  void ReturnFreeingBatch(ArrayBufferExtension* dead_extensions);
+  void EnsureFreeingFinished();
+
   Heap* const heap_;
   std::unique_ptr<SweepingState> state_;
   ArrayBufferList young_{ArrayBufferList::Age::kYoung};
   ArrayBufferList old_{ArrayBufferList::Age::kOld};
+
+  base::Mutex freeing_mutex_;
+  std::vector<ArrayBufferExtension*> freeing_batches_;
+  std::atomic<size_t> freeing_batches_count_{0};
+  bool freeing_job_running_ = false;
+  std::unique_ptr<JobHandle> freeing_job_handle_;
 };
 
 }  // namespace internal
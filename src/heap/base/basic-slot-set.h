@@ -6,6 +6,7 @@
 #define V8_HEAP_BASE_BASIC_SLOT_SET_H_
 
 #include <cstddef>
+#include <limits>
 #include <memory>
 
 #include "src/base/atomic-utils.h"
@@ -21,7 +22,10 @@ enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
 // page.
 // The data structure assumes that the slots are pointer size aligned and
 // splits the valid slot offset range into buckets.
-// Each bucket is a bitmap with a bit corresponding to a single slot offset.
+// Each bucket is either a bitmap with a bit corresponding to a single slot
+// offset or, while it only holds a few slots, a small array of slot offsets
+// (see SparseBucket). Sparse buckets are tagged in the buckets array and turn
+// into bitmaps once they fill up.
 template <size_t SlotGranularity>
 class BasicSlotSet {
   static constexpr auto kSystemPointerSize = sizeof(void*);
@@ -42,26 +46,28 @@ class BasicSlotSet {
   BasicSlotSet() = delete;
 
   static BasicSlotSet* Allocate(size_t buckets) {
-    //  BasicSlotSet* slot_set --+
-    //                           |
-    //                           v
-    //         +-----------------+-------------------------+
-    //         | initial buckets |     buckets array       |
-    //         +-----------------+-------------------------+
-    //            pointer-sized    pointer-sized * buckets
-    //
+    //                                    BasicSlotSet* slot_set --+
+    //                                                             |
+    //                                                             v
+    //         +-----------------+-----------------+-------------------------+
+    //         | retired sparse  | initial buckets |     buckets array       |
+    //         |     buckets     |                 |                         |
+    //         +-----------------+-----------------+-------------------------+
+    //            pointer-sized     pointer-sized    pointer-sized * buckets
+    //                              (DEBUG only)
     //
     // The BasicSlotSet pointer points to the beginning of the buckets array for
     // faster access in the write barrier. The number of buckets is needed for
     // calculating the size of this data structure.
     size_t buckets_size = buckets * sizeof(Bucket*);
-    size_t size = kInitialBucketsSize + buckets_size;
+    size_t size = kHeaderSize + buckets_size;
     void* allocation = v8::base::AlignedAlloc(size, kSystemPointerSize);
     CHECK(allocation);
     BasicSlotSet* slot_set = reinterpret_cast<BasicSlotSet*>(
-        reinterpret_cast<uint8_t*>(allocation) + kInitialBucketsSize);
+        reinterpret_cast<uint8_t*>(allocation) + kHeaderSize);
     DCHECK(
         IsAligned(reinterpret_cast<uintptr_t>(slot_set), kSystemPointerSize));
+    *slot_set->retired_sparse_buckets() = nullptr;
 #ifdef DEBUG
     *slot_set->initial_buckets() = buckets;
 #endif
@@ -77,6 +83,7 @@ class BasicSlotSet {
     for (size_t i = 0; i < buckets; i++) {
       slot_set->ReleaseBucket(i);
     }
+    slot_set->FreeRetiredSparseBuckets();
 
 #ifdef DEBUG
     size_t initial_buckets = *slot_set->initial_buckets();
@@ -86,8 +93,19 @@ class BasicSlotSet {
     }
 #endif
 
-    v8::base::AlignedFree(reinterpret_cast<uint8_t*>(slot_set) -
-                          kInitialBucketsSize);
+    v8::base::AlignedFree(reinterpret_cast<uint8_t*>(slot_set) - kHeaderSize);
+  }
+
+  // Frees sparse buckets that were replaced by bitmaps while other threads may
+  // still have accessed them. Requires exclusive access to the slot set.
+  void FreeRetiredSparseBuckets() {
+    SparseBucket* current = *retired_sparse_buckets();
+    while (current) {
+      SparseBucket* next = current->next_retired();
+      delete current;
+      current = next;
+    }
+    *retired_sparse_buckets() = nullptr;
   }
 
   constexpr static size_t BucketsForSize(size_t size) {
@@ -116,11 +134,20 @@ class BasicSlotSet {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket* bucket = LoadBucket<access_mode>(bucket_index);
     if (bucket == nullptr) {
-      bucket = new Bucket;
-      if (!SwapInNewBucket<access_mode>(bucket_index, bucket)) {
-        delete bucket;
-        bucket = LoadBucket<access_mode>(bucket_index);
+      // New buckets start out sparse.
+      SparseBucket* sparse_bucket = new SparseBucket;
+      if (!SwapInNewBucket<access_mode>(bucket_index,
+                                        TagSparseBucket(sparse_bucket))) {
+        delete sparse_bucket;
       }
+      bucket = LoadBucket<access_mode>(bucket_index);
+    }
+    while (IsSparseBucket(bucket)) {
+      if (ToSparseBucket(bucket)->template Insert<access_mode>(
+              SlotInBucket(slot_offset))) {
+        return;
+      }
+      bucket = ConvertToDenseBucket<access_mode>(bucket_index, bucket);
     }
     // Check that monotonicity is preserved, i.e., once a bucket is set we do
     // not free it concurrently.
@@ -140,6 +167,9 @@ class BasicSlotSet {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket* bucket = LoadBucket(bucket_index);
     if (bucket == nullptr) return false;
+    if (IsSparseBucket(bucket)) {
+      return ToSparseBucket(bucket)->Contains(SlotInBucket(slot_offset));
+    }
     return (bucket->LoadCell(cell_index) & (1u << bit_index)) != 0;
   }
 
@@ -150,6 +180,10 @@ class BasicSlotSet {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket* bucket = LoadBucket(bucket_index);
     if (bucket != nullptr) {
+      if (IsSparseBucket(bucket)) {
+        ToSparseBucket(bucket)->Remove(SlotInBucket(slot_offset));
+        return;
+      }
       uint32_t cell = bucket->LoadCell(cell_index);
       uint32_t bit_mask = 1u << bit_index;
       if (cell & bit_mask) {
@@ -176,13 +210,27 @@ class BasicSlotSet {
     if (start_bucket == end_bucket && start_cell == end_cell) {
       bucket = LoadBucket(start_bucket);
       if (bucket != nullptr) {
-        bucket->ClearCellBits(start_cell, ~(start_mask | end_mask));
+        if (IsSparseBucket(bucket)) {
+          ToSparseBucket(bucket)->RemoveRange(SlotInBucket(start_offset),
+                                              SlotInBucket(end_offset));
+        } else {
+          bucket->ClearCellBits(start_cell, ~(start_mask | end_mask));
+        }
       }
       return;
     }
     size_t current_bucket = start_bucket;
     int current_cell = start_cell;
     bucket = LoadBucket(current_bucket);
+    if (bucket != nullptr && IsSparseBucket(bucket)) {
+      ToSparseBucket(bucket)->RemoveRange(
+          SlotInBucket(start_offset),
+          start_bucket == end_bucket ? SlotInBucket(end_offset)
+                                     : kBitsPerBucket);
+      if (start_bucket == end_bucket) return;
+      // The rest of the sparse bucket is cleared already.
+      bucket = nullptr;
+    }
     if (bucket != nullptr) {
       bucket->ClearCellBits(current_cell, ~start_mask);
     }
@@ -205,7 +253,11 @@ class BasicSlotSet {
         DCHECK(mode == KEEP_EMPTY_BUCKETS);
         bucket = LoadBucket(current_bucket);
         if (bucket != nullptr) {
-          ClearBucket(bucket, 0, kCellsPerBucket);
+          if (IsSparseBucket(bucket)) {
+            ToSparseBucket(bucket)->RemoveRange(0, kBitsPerBucket);
+          } else {
+            ClearBucket(bucket, 0, kCellsPerBucket);
+          }
         }
       }
       current_bucket++;
@@ -216,6 +268,11 @@ class BasicSlotSet {
     bucket = LoadBucket(current_bucket);
     DCHECK(current_cell <= end_cell);
     if (bucket == nullptr) return;
+    if (IsSparseBucket(bucket)) {
+      DCHECK_EQ(0, current_cell);
+      ToSparseBucket(bucket)->RemoveRange(0, SlotInBucket(end_offset));
+      return;
+    }
     while (current_cell < end_cell) {
       bucket->StoreCell(current_cell, 0);
       current_cell++;
@@ -226,14 +283,7 @@ class BasicSlotSet {
   }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
-  bool Lookup(size_t slot_offset) {
-    size_t bucket_index;
-    int cell_index, bit_index;
-    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket* bucket = LoadBucket(bucket_index);
-    if (bucket == nullptr) return false;
-    return (bucket->LoadCell(cell_index) & (1u << bit_index)) != 0;
-  }
+  bool Lookup(size_t slot_offset) { return Contains(slot_offset); }
 
   // Iterate over all slots in the set and for each slot invoke the callback.
   // If the callback returns REMOVE_SLOT then the slot is removed from the set.
@@ -271,6 +321,8 @@ class BasicSlotSet {
   static constexpr int kBitsPerBucket = kCellsPerBucket * kBitsPerCell;
   static constexpr int kBitsPerBucketLog2 =
       kCellsPerBucketLog2 + kBitsPerCellLog2;
+  // Tag of sparse buckets in the buckets array.
+  static constexpr uintptr_t kSparseBucketTag = 1;
 
   class Bucket final {
     uint32_t cells_[kCellsPerBucket];
@@ -328,6 +380,163 @@ class BasicSlotSet {
     }
   };
 
+  // Compact bucket for up to kCapacity slots, storing the slot indices within
+  // the bucket in insertion order. Entries are only appended and removed
+  // entries are overwritten with kRemovedEntry instead of being compacted, so
+  // that concurrent inserters of the same slot always observe each other and
+  // never record duplicates.
+  class SparseBucket final {
+   public:
+    static constexpr int kCapacity = 8;
+
+    // Returns false if there's no room left for the slot, in which case the
+    // bucket needs to be converted into a bitmap.
+    template <AccessMode access_mode>
+    bool Insert(size_t slot_in_bucket) {
+      const uint32_t entry = ToEntry(slot_in_bucket);
+      for (int i = 0; i < kCapacity; i++) {
+        uint32_t current = LoadEntry<access_mode>(i);
+        if (current == kEmptyEntry) {
+          if constexpr (access_mode == AccessMode::ATOMIC) {
+            current = v8::base::AsAtomic32::Release_CompareAndSwap(
+                &entries_[i], kEmptyEntry, entry);
+            if (current == kEmptyEntry) return true;
+          } else {
+            entries_[i] = entry;
+            return true;
+          }
+        }
+        if (current == entry) return true;
+      }
+      if constexpr (access_mode == AccessMode::NON_ATOMIC) {
+        // Without concurrent inserters removed entries can be reused.
+        for (int i = 0; i < kCapacity; i++) {
+          if (entries_[i] == kRemovedEntry) {
+            entries_[i] = entry;
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    bool Contains(size_t slot_in_bucket) const {
+      const uint32_t entry = ToEntry(slot_in_bucket);
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry(i);
+        if (current == kEmptyEntry) return false;
+        if (current == entry) return true;
+      }
+      return false;
+    }
+
+    void Remove(size_t slot_in_bucket) {
+      const uint32_t entry = ToEntry(slot_in_bucket);
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry(i);
+        if (current == kEmptyEntry) return;
+        if (current == entry) {
+          RemoveEntry<AccessMode::ATOMIC>(i, current);
+          return;
+        }
+      }
+    }
+
+    // Removes all slots in [start_slot, end_slot).
+    void RemoveRange(size_t start_slot, size_t end_slot) {
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry(i);
+        if (current == kEmptyEntry) return;
+        if (current == kRemovedEntry) continue;
+        const size_t slot = ToSlot(current);
+        if (start_slot <= slot && slot < end_slot) {
+          RemoveEntry<AccessMode::ATOMIC>(i, current);
+        }
+      }
+    }
+
+    bool IsEmpty() const {
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry(i);
+        if (current == kEmptyEntry) return true;
+        if (current != kRemovedEntry) return false;
+      }
+      return true;
+    }
+
+    // Invokes the callback for each slot index and removes the slot if the
+    // callback returns REMOVE_SLOT. Returns the number of remaining slots.
+    template <AccessMode access_mode = AccessMode::ATOMIC, typename Callback>
+    size_t Iterate(Callback callback) {
+      size_t count = 0;
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry<access_mode>(i);
+        if (current == kEmptyEntry) break;
+        if (current == kRemovedEntry) continue;
+        if (callback(ToSlot(current)) == KEEP_SLOT) {
+          ++count;
+        } else {
+          RemoveEntry<access_mode>(i, current);
+        }
+      }
+      return count;
+    }
+
+    // Sets the bits of all slots in the (not yet published) bitmap bucket.
+    void CopyTo(Bucket* bucket) const {
+      for (int i = 0; i < kCapacity; i++) {
+        const uint32_t current = LoadEntry(i);
+        if (current == kEmptyEntry) return;
+        if (current == kRemovedEntry) continue;
+        const size_t slot = ToSlot(current);
+        bucket->template SetCellBits<AccessMode::NON_ATOMIC>(
+            static_cast<int>(slot >> kBitsPerCellLog2),
+            1u << (slot & (kBitsPerCell - 1)));
+      }
+    }
+
+    SparseBucket* next_retired() const { return next_retired_; }
+    void set_next_retired(SparseBucket* next) { next_retired_ = next; }
+
+   private:
+    // Entries store the slot index + 1 such that zero-initialized entries are
+    // empty.
+    static constexpr uint32_t kEmptyEntry = 0;
+    static constexpr uint32_t kRemovedEntry =
+        std::numeric_limits<uint32_t>::max();
+
+    static uint32_t ToEntry(size_t slot_in_bucket) {
+      DCHECK_LT(slot_in_bucket, static_cast<size_t>(kBitsPerBucket));
+      return static_cast<uint32_t>(slot_in_bucket) + 1;
+    }
+    static size_t ToSlot(uint32_t entry) {
+      DCHECK_NE(kEmptyEntry, entry);
+      DCHECK_NE(kRemovedEntry, entry);
+      return entry - 1;
+    }
+
+    template <AccessMode access_mode = AccessMode::ATOMIC>
+    uint32_t LoadEntry(int index) const {
+      DCHECK_LT(index, kCapacity);
+      if constexpr (access_mode == AccessMode::ATOMIC)
+        return v8::base::AsAtomic32::Acquire_Load(&entries_[index]);
+      return entries_[index];
+    }
+
+    template <AccessMode access_mode>
+    void RemoveEntry(int index, uint32_t entry) {
+      if constexpr (access_mode == AccessMode::ATOMIC) {
+        v8::base::AsAtomic32::Release_CompareAndSwap(&entries_[index], entry,
+                                                     kRemovedEntry);
+      } else {
+        entries_[index] = kRemovedEntry;
+      }
+    }
+
+    uint32_t entries_[kCapacity] = {};
+    SparseBucket* next_retired_ = nullptr;
+  };
+
  protected:
   template <AccessMode access_mode = AccessMode::ATOMIC, typename Callback,
             typename EmptyBucketCallback>
@@ -337,7 +546,20 @@ class BasicSlotSet {
     for (size_t bucket_index = start_bucket; bucket_index < end_bucket;
          bucket_index++) {
       Bucket* bucket = LoadBucket<access_mode>(bucket_index);
-      if (bucket != nullptr) {
+      if (bucket != nullptr && IsSparseBucket(bucket)) {
+        const Address bucket_start =
+            chunk_start + OffsetForBucket(bucket_index);
+        const size_t in_bucket_count =
+            ToSparseBucket(bucket)->template Iterate<access_mode>(
+                [bucket_start, &callback](size_t slot_in_bucket) {
+                  return callback(bucket_start +
+                                  slot_in_bucket * SlotGranularity);
+                });
+        if (in_bucket_count == 0) {
+          empty_bucket_callback(bucket_index);
+        }
+        new_count += in_bucket_count;
+      } else if (bucket != nullptr) {
         size_t in_bucket_count = 0;
         size_t cell_offset = bucket_index << kBitsPerBucketLog2;
         for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
@@ -368,13 +590,44 @@ class BasicSlotSet {
         new_count += in_bucket_count;
       }
     }
+    if constexpr (access_mode == AccessMode::NON_ATOMIC) {
+      FreeRetiredSparseBuckets();
+    }
     return new_count;
   }
 
+  static bool IsEmptyBucket(Bucket* bucket) {
+    DCHECK_NOT_NULL(bucket);
+    if (IsSparseBucket(bucket)) return ToSparseBucket(bucket)->IsEmpty();
+    return bucket->IsEmpty();
+  }
+
+  // Invokes the callback for each slot index within the bucket.
+  template <typename Callback>
+  static void ForEachSlotInBucket(Bucket* bucket, Callback callback) {
+    DCHECK_NOT_NULL(bucket);
+    if (IsSparseBucket(bucket)) {
+      ToSparseBucket(bucket)->template Iterate<AccessMode::NON_ATOMIC>(
+          [&callback](size_t slot_in_bucket) {
+            callback(slot_in_bucket);
+            return KEEP_SLOT;
+          });
+      return;
+    }
+    for (int i = 0; i < kCellsPerBucket; i++) {
+      uint32_t cell = bucket->template LoadCell<AccessMode::NON_ATOMIC>(i);
+      while (cell) {
+        int bit_offset = v8::base::bits::CountTrailingZeros(cell);
+        callback((static_cast<size_t>(i) << kBitsPerCellLog2) + bit_offset);
+        cell ^= 1u << bit_offset;
+      }
+    }
+  }
+
   bool FreeBucketIfEmpty(size_t bucket_index) {
     Bucket* bucket = LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
     if (bucket != nullptr) {
-      if (bucket->IsEmpty()) {
+      if (IsEmptyBucket(bucket)) {
         ReleaseBucket<AccessMode::NON_ATOMIC>(bucket_index);
       } else {
         return false;
@@ -398,7 +651,64 @@ class BasicSlotSet {
   void ReleaseBucket(size_t bucket_index) {
     Bucket* bucket = LoadBucket<access_mode>(bucket_index);
     StoreBucket<access_mode>(bucket_index, nullptr);
-    delete bucket;
+    if (IsSparseBucket(bucket)) {
+      delete ToSparseBucket(bucket);
+    } else {
+      delete bucket;
+    }
+  }
+
+  // Replaces the full sparse bucket `bucket` with an equivalent bitmap bucket
+  // and returns the bucket now installed at `bucket_index`. With concurrent
+  // access, the sparse bucket is only retired as other threads may still be
+  // using it.
+  template <AccessMode access_mode>
+  Bucket* ConvertToDenseBucket(size_t bucket_index, Bucket* bucket) {
+    DCHECK(IsSparseBucket(bucket));
+    SparseBucket* sparse_bucket = ToSparseBucket(bucket);
+    Bucket* dense_bucket = new Bucket;
+    sparse_bucket->CopyTo(dense_bucket);
+    if constexpr (access_mode == AccessMode::ATOMIC) {
+      if (v8::base::AsAtomicPointer::Release_CompareAndSwap(
+              this->bucket(bucket_index), bucket, dense_bucket) != bucket) {
+        // Another thread replaced the bucket in the meantime.
+        delete dense_bucket;
+        return LoadBucket<access_mode>(bucket_index);
+      }
+      SparseBucket** retired = retired_sparse_buckets();
+      SparseBucket* head = v8::base::AsAtomicPointer::Relaxed_Load(retired);
+      SparseBucket* old_head;
+      do {
+        sparse_bucket->set_next_retired(head);
+        old_head = head;
+        head = v8::base::AsAtomicPointer::Release_CompareAndSwap(
+            retired, old_head, sparse_bucket);
+      } while (head != old_head);
+    } else {
+      StoreBucket<access_mode>(bucket_index, dense_bucket);
+      delete sparse_bucket;
+    }
+    return dense_bucket;
+  }
+
+  static bool IsSparseBucket(Bucket* bucket) {
+    return (reinterpret_cast<uintptr_t>(bucket) & kSparseBucketTag) != 0;
+  }
+  static SparseBucket* ToSparseBucket(Bucket* bucket) {
+    DCHECK(IsSparseBucket(bucket));
+    return reinterpret_cast<SparseBucket*>(reinterpret_cast<uintptr_t>(bucket) &
+                                           ~kSparseBucketTag);
+  }
+  static Bucket* TagSparseBucket(SparseBucket* sparse_bucket) {
+    DCHECK_EQ(0, reinterpret_cast<uintptr_t>(sparse_bucket) & kSparseBucketTag);
+    return reinterpret_cast<Bucket*>(reinterpret_cast<uintptr_t>(sparse_bucket) |
+                                     kSparseBucketTag);
+  }
+
+  // Converts the slot offset into the slot index within its bucket.
+  static size_t SlotInBucket(size_t slot_offset) {
+    DCHECK(IsAligned(slot_offset, SlotGranularity));
+    return (slot_offset / SlotGranularity) & (kBitsPerBucket - 1);
   }
 
   template <AccessMode access_mode = AccessMode::ATOMIC>
@@ -460,6 +770,11 @@ class BasicSlotSet {
 #else
   static const int kInitialBucketsSize = 0;
 #endif
+  SparseBucket** retired_sparse_buckets() {
+    return reinterpret_cast<SparseBucket**>(reinterpret_cast<uint8_t*>(this) -
+                                            kHeaderSize);
+  }
+  static const int kHeaderSize = sizeof(SparseBucket*) + kInitialBucketsSize;
 };
 
 }  // namespace base
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <memory>
 
+#include "src/base/logging.h"
 #include "src/base/platform/time.h"
 
 namespace heap::base {
@@ -136,4 +137,55 @@ void IncrementalMarkingSchedule::SetElapsedTimeForTesting(
   elapsed_time_override_.emplace(elapsed_time);
 }
 
+void IncrementalMarkingSchedule::SetMinimumMutatorUtilization(
+    v8::base::TimeDelta window, double target_utilization) {
+  DCHECK(!window.IsZero());
+  DCHECK_LT(0.0, target_utilization);
+  DCHECK_GT(1.0, target_utilization);
+  mmu_window_ = window;
+  mmu_target_ = target_utilization;
+  recent_steps_.clear();
+}
+
+void IncrementalMarkingSchedule::NotifyMutatorThreadStep(
+    v8::base::TimeTicks start, v8::base::TimeDelta duration) {
+  if (!HasMinimumMutatorUtilization()) return;
+  const v8::base::TimeTicks end = start + duration;
+  const v8::base::TimeTicks window_start = end - mmu_window_;
+  // Drop steps that ended before the current window.
+  recent_steps_.erase(
+      std::remove_if(recent_steps_.begin(), recent_steps_.end(),
+                     [window_start](const MutatorThreadStep& step) {
+                       return step.end <= window_start;
+                     }),
+      recent_steps_.end());
+  recent_steps_.push_back({start, end});
+  // The window ending at the end of a step is where the utilization drops
+  // the most; mutator utilization only recovers afterwards.
+  v8::base::TimeDelta paused;
+  for (const auto& step : recent_steps_) {
+    paused += step.end - std::max(step.start, window_start);
+  }
+  const double utilization =
+      1.0 - std::min(1.0, paused.InMillisecondsF() /
+                              mmu_window_.InMillisecondsF());
+  min_observed_mutator_utilization_ =
+      std::min(min_observed_mutator_utilization_, utilization);
+}
+
+v8::base::TimeDelta
+IncrementalMarkingSchedule::GetMaxStepDurationForMutatorUtilization(
+    v8::base::TimeTicks now) const {
+  if (!HasMinimumMutatorUtilization()) return v8::base::TimeDelta::Max();
+  const v8::base::TimeTicks window_start = now - mmu_window_;
+  v8::base::TimeDelta paused;
+  for (const auto& step : recent_steps_) {
+    if (step.end <= window_start) continue;
+    paused += std::min(step.end, now) - std::max(step.start, window_start);
+  }
+  const v8::base::TimeDelta budget = v8::base::TimeDelta::FromMillisecondsD(
+      mmu_window_.InMillisecondsF() * (1.0 - mmu_target_));
+  return paused >= budget ? v8::base::TimeDelta() : budget - paused;
+}
+
 }  // namespace heap::base
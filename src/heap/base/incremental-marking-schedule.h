@@ -8,6 +8,7 @@
 #include <atomic>
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "src/base/platform/time.h"
 
@@ -22,6 +23,11 @@ namespace heap::base {
 //   -> UpdateMutatorThreadMarkedBytes(mutator_marked_bytes)
 //   -> AddConcurrentlyMarkedBytes(concurrently_marked_bytes_delta)
 //   -> MarkSynchronously(GetNextIncrementalStepDuration(estimated_live_size))
+//
+// Optionally, the schedule can be configured with a minimum mutator
+// utilization (MMU) via `SetMinimumMutatorUtilization()`. In this case
+// synchronous steps should be reported via `NotifyMutatorThreadStep()` and
+// bounded by `GetMaxStepDurationForMutatorUtilization()`.
 class V8_EXPORT_PRIVATE IncrementalMarkingSchedule final {
  public:
   struct StepInfo final {
@@ -114,7 +120,39 @@ class V8_EXPORT_PRIVATE IncrementalMarkingSchedule final {
   // `GetNextIncrementalStepDuration()`.
   void SetElapsedTimeForTesting(v8::base::TimeDelta);
 
+  // Configures the schedule to keep the mutator utilization in any `window` of
+  // wall time at or above `target_utilization` (in (0, 1)). E.g., a window of
+  // 10ms and a target of 0.7 leaves at most 3ms for synchronous steps in every
+  // 10ms.
+  void SetMinimumMutatorUtilization(v8::base::TimeDelta window,
+                                    double target_utilization);
+
+  bool HasMinimumMutatorUtilization() const { return !mmu_window_.IsZero(); }
+
+  // Records a synchronous marking step on the mutator thread that started at
+  // `start` and took `duration`. Only needed when a minimum mutator
+  // utilization is configured.
+  void NotifyMutatorThreadStep(v8::base::TimeTicks start,
+                               v8::base::TimeDelta duration);
+
+  // Returns the step duration that is left in the window that ends at `now`
+  // without violating the configured minimum mutator utilization. Returns
+  // `TimeDelta::Max()` if no minimum mutator utilization is configured.
+  v8::base::TimeDelta GetMaxStepDurationForMutatorUtilization(
+      v8::base::TimeTicks now) const;
+
+  // Returns the lowest mutator utilization observed in any window ending at the
+  // end of a reported step, or 1.0 if no step has been reported so far.
+  double GetMinimumObservedMutatorUtilization() const {
+    return min_observed_mutator_utilization_;
+  }
+
  private:
+  struct MutatorThreadStep final {
+    v8::base::TimeTicks start;
+    v8::base::TimeTicks end;
+  };
+
   static constexpr double kEphemeronPairsFlushingRatioIncrements = 0.25;
 
   IncrementalMarkingSchedule(size_t min_marked_bytes_per_step,
@@ -131,6 +169,11 @@ class V8_EXPORT_PRIVATE IncrementalMarkingSchedule final {
   const size_t min_marked_bytes_per_step_;
   const bool predictable_schedule_ = false;
   std::optional<v8::base::TimeDelta> elapsed_time_override_;
+  v8::base::TimeDelta mmu_window_;
+  double mmu_target_ = 0.0;
+  // Steps overlapping the most recent window, ordered by start time.
+  std::vector<MutatorThreadStep> recent_steps_;
+  double min_observed_mutator_utilization_ = 1.0;
 };
 
 }  // namespace heap::base
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_BASE_WORKLIST_H_
 #define V8_HEAP_BASE_WORKLIST_H_
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <utility>
 
@@ -28,6 +30,12 @@ class V8_EXPORT_PRIVATE SegmentBase {
   bool IsFull() const { return index_ == capacity_; }
   void Clear() { index_ = 0; }
 
+ protected:
+  void set_size(size_t size) {
+    DCHECK_LE(size, capacity_);
+    index_ = static_cast<uint16_t>(size);
+  }
+
  protected:
   const uint16_t capacity_;
   uint16_t index_ = 0;
@@ -83,6 +91,13 @@ class Worklist final {
   // Removes all segments from the worklist.
   void Clear();
 
+  // Returns true if some local view in work stealing mode ran out of work and
+  // is waiting for a busy local view to donate parts of its private segments.
+  // May be read concurrently for an approximation.
+  bool HasStealRequests() const {
+    return steal_requests_.load(std::memory_order_relaxed) > 0;
+  }
+
   // Invokes `callback` on each item. Callback is of type `bool(EntryType&)` and
   // should return true if the entry should be kept and false if the entry
   // should be removed.
@@ -97,9 +112,26 @@ class Worklist final {
   void Push(Segment* segment);
   bool Pop(Segment** segment);
 
+  void AddStealRequest() {
+    steal_requests_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Removes a single steal request if there is any. Returns false if some
+  // other thread already consumed all requests.
+  bool TryRemoveStealRequest() {
+    size_t requests = steal_requests_.load(std::memory_order_relaxed);
+    while (requests > 0) {
+      if (steal_requests_.compare_exchange_weak(requests, requests - 1,
+                                                std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   mutable v8::base::Mutex lock_;
   Segment* top_ = nullptr;
   std::atomic<size_t> size_{0};
+  std::atomic<size_t> steal_requests_{0};
 };
 
 template <typename EntryType, uint16_t MinSegmentSize>
@@ -234,6 +266,11 @@ class Worklist<EntryType, MinSegmentSize>::Segment final
   V8_INLINE void Push(EntryType entry);
   V8_INLINE void Pop(EntryType* entry);
 
+  // Moves the oldest half of the entries into `other`, which must be empty.
+  // The oldest entries are the ones that are popped last by the owner of the
+  // segment and thus are the best candidates for being taken by other threads.
+  void MoveHalfTo(Segment* other);
+
   template <typename Callback>
   void Update(Callback callback);
   template <typename Callback>
@@ -275,6 +312,21 @@ void Worklist<EntryType, MinSegmentSize>::Segment::Pop(EntryType* e) {
   *e = entry(--index_);
 }
 
+template <typename EntryType, uint16_t MinSegmentSize>
+void Worklist<EntryType, MinSegmentSize>::Segment::MoveHalfTo(Segment* other) {
+  DCHECK(other->IsEmpty());
+  const size_t size = Size();
+  const size_t moved = std::min(size / 2, other->Capacity());
+  for (size_t i = 0; i < moved; i++) {
+    other->entry(i) = entry(i);
+  }
+  other->set_size(moved);
+  for (size_t i = moved; i < size; i++) {
+    entry(i - moved) = entry(i);
+  }
+  set_size(size - moved);
+}
+
 template <typename EntryType, uint16_t MinSegmentSize>
 template <typename Callback>
 void Worklist<EntryType, MinSegmentSize>::Segment::Update(Callback callback) {
@@ -302,14 +354,27 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
  public:
   using ItemType = EntryType;
 
-  explicit Local(Worklist<EntryType, MinSegmentSize>& worklist);
+  // Local views in work stealing mode register a steal request with the
+  // global worklist when they run out of work. Other local views in work
+  // stealing mode that still have private work react to such requests by
+  // donating half of their private push segment to the global worklist, where
+  // it can be picked up by the idle view.
+  enum class WorkStealing { kDisabled, kEnabled };
+
+  explicit Local(Worklist<EntryType, MinSegmentSize>& worklist,
+                 WorkStealing work_stealing = WorkStealing::kDisabled);
   ~Local();
 
   // Moving needs to specify whether the `worklist_` pointer is preserved or
   // not.
-  Local(Local&& other) V8_NOEXCEPT : worklist_(other.worklist_) {
+  Local(Local&& other) V8_NOEXCEPT : worklist_(other.worklist_),
+                                     work_stealing_(other.work_stealing_) {
     std::swap(push_segment_, other.push_segment_);
     std::swap(pop_segment_, other.pop_segment_);
+    std::swap(has_steal_request_, other.has_steal_request_);
+    std::swap(steals_, other.steals_);
+    std::swap(donations_, other.donations_);
+    std::swap(idle_events_, other.idle_events_);
   }
   Local& operator=(Local&&) V8_NOEXCEPT = delete;
 
@@ -332,10 +397,29 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
 
   void Clear();
 
+  bool IsWorkStealingEnabled() const {
+    return work_stealing_ == WorkStealing::kEnabled;
+  }
+  // Number of segments that this view took from the global worklist after it
+  // ran out of work.
+  size_t steals() const { return steals_; }
+  // Number of partial segments that this view donated in response to steal
+  // requests.
+  size_t donations() const { return donations_; }
+  // Number of times this view ran out of local and global work.
+  size_t idle_events() const { return idle_events_; }
+
  private:
+  // Minimum number of entries in the push segment for it to be split in
+  // response to a steal request.
+  static constexpr size_t kMinDonationSize = 2;
+
   void PublishPushSegment();
   void PublishPopSegment();
   bool StealPopSegment();
+  void DonateHalfOfPushSegment();
+  void RequestSteal();
+  void WithdrawStealRequest();
 
   Segment* NewSegment() const {
     // Bottleneck for filtering in crash dumps.
@@ -367,19 +451,26 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
   }
 
   Worklist<EntryType, MinSegmentSize>& worklist_;
+  const WorkStealing work_stealing_;
   internal::SegmentBase* push_segment_ = nullptr;
   internal::SegmentBase* pop_segment_ = nullptr;
+  bool has_steal_request_ = false;
+  size_t steals_ = 0;
+  size_t donations_ = 0;
+  size_t idle_events_ = 0;
 };
 
 template <typename EntryType, uint16_t MinSegmentSize>
 Worklist<EntryType, MinSegmentSize>::Local::Local(
-    Worklist<EntryType, MinSegmentSize>& worklist)
+    Worklist<EntryType, MinSegmentSize>& worklist, WorkStealing work_stealing)
     : worklist_(worklist),
+      work_stealing_(work_stealing),
       push_segment_(internal::SegmentBase::GetSentinelSegmentAddress()),
       pop_segment_(internal::SegmentBase::GetSentinelSegmentAddress()) {}
 
 template <typename EntryType, uint16_t MinSegmentSize>
 Worklist<EntryType, MinSegmentSize>::Local::~Local() {
+  WithdrawStealRequest();
   CHECK_IMPLIES(push_segment_, push_segment_->IsEmpty());
   CHECK_IMPLIES(pop_segment_, pop_segment_->IsEmpty());
   DeleteSegment(push_segment_);
@@ -391,6 +482,10 @@ void Worklist<EntryType, MinSegmentSize>::Local::Push(EntryType entry) {
   if (V8_UNLIKELY(push_segment_->IsFull())) {
     PublishPushSegment();
     push_segment_ = NewSegment();
+  } else if (V8_UNLIKELY(IsWorkStealingEnabled() &&
+                         worklist_.HasStealRequests() &&
+                         push_segment_->Size() >= kMinDonationSize)) {
+    DonateHalfOfPushSegment();
   }
   push_segment()->Push(entry);
 }
@@ -401,6 +496,7 @@ bool Worklist<EntryType, MinSegmentSize>::Local::Pop(EntryType* entry) {
     if (!push_segment_->IsEmpty()) {
       std::swap(push_segment_, pop_segment_);
     } else if (!StealPopSegment()) {
+      if (IsWorkStealingEnabled()) RequestSteal();
       return false;
     }
   }
@@ -425,6 +521,7 @@ bool Worklist<EntryType, MinSegmentSize>::Local::IsGlobalEmpty() const {
 
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::Publish() {
+  WithdrawStealRequest();
   if (!push_segment_->IsEmpty()) {
     PublishPushSegment();
     push_segment_ = internal::SegmentBase::GetSentinelSegmentAddress();
@@ -460,11 +557,42 @@ bool Worklist<EntryType, MinSegmentSize>::Local::StealPopSegment() {
   if (worklist_.Pop(&new_segment)) {
     DeleteSegment(pop_segment_);
     pop_segment_ = new_segment;
+    if (has_steal_request_) {
+      steals_++;
+      WithdrawStealRequest();
+    }
     return true;
   }
   return false;
 }
 
+template <typename EntryType, uint16_t MinSegmentSize>
+void Worklist<EntryType, MinSegmentSize>::Local::DonateHalfOfPushSegment() {
+  // Only donate if the request was not already served by some other view.
+  if (!worklist_.IsEmpty() || !worklist_.TryRemoveStealRequest()) return;
+  Segment* donated = NewSegment();
+  push_segment()->MoveHalfTo(donated);
+  worklist_.Push(donated);
+  donations_++;
+}
+
+template <typename EntryType, uint16_t MinSegmentSize>
+void Worklist<EntryType, MinSegmentSize>::Local::RequestSteal() {
+  // Re-register if a withdrawing view removed this view's request.
+  if (has_steal_request_ && worklist_.HasStealRequests()) return;
+  if (!has_steal_request_) idle_events_++;
+  has_steal_request_ = true;
+  worklist_.AddStealRequest();
+}
+
+template <typename EntryType, uint16_t MinSegmentSize>
+void Worklist<EntryType, MinSegmentSize>::Local::WithdrawStealRequest() {
+  if (!has_steal_request_) return;
+  has_steal_request_ = false;
+  // The request may have already been consumed by a donating view.
+  worklist_.TryRemoveStealRequest();
+}
+
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::Clear() {
   push_segment_->Clear();
@@ -387,20 +387,28 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
 
   const size_t kAllocatePageSize = page_allocator()->AllocatePageSize();
   const size_t kCommitPageSize = page_allocator()->CommitPageSize();
-  size_t allocate_code_size =
-      RoundUp(embedded_blob_code_size, kAllocatePageSize);
+#if ENABLE_HUGEPAGE
+  // Place the copy in whole huge pages so that it can be backed by transparent
+  // huge pages just like the rest of the code range.
+  const size_t kBlobAlignment = std::max<size_t>(kAllocatePageSize,
+                                                 kHugePageSize);
+#else
+  const size_t kBlobAlignment = kAllocatePageSize;
+#endif
+  size_t allocate_code_size = RoundUp(embedded_blob_code_size, kBlobAlignment);
 
   // Allocate the re-embedded code blob in such a way that it will be reachable
   // by PC-relative addressing from biggest possible region.
   const size_t max_pc_relative_code_range = kMaxPCRelativeCodeRangeInMB * MB;
-  size_t hint_offset =
+  size_t hint_offset = RoundDown(
       std::min(max_pc_relative_code_range, code_region.size()) -
-      allocate_code_size;
+          allocate_code_size,
+      kBlobAlignment);
   void* hint = reinterpret_cast<void*>(code_region.begin() + hint_offset);
 
   embedded_blob_code_copy =
       reinterpret_cast<uint8_t*>(page_allocator()->AllocatePages(
-          hint, allocate_code_size, kAllocatePageSize,
+          hint, allocate_code_size, kBlobAlignment,
           PageAllocator::kNoAccessWillJitLater));
 
   if (!embedded_blob_code_copy) {
@@ -428,7 +436,9 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   }
 
   size_t code_size = RoundUp(embedded_blob_code_size, kCommitPageSize);
-  if constexpr (base::OS::IsRemapPageSupported()) {
+  // Remapped builtins are file-backed and thus cannot use transparent huge
+  // pages. Prefer the anonymous copy when huge pages are enabled.
+  if constexpr (base::OS::IsRemapPageSupported() && !ENABLE_HUGEPAGE_BOOL) {
     // By default, the embedded builtins are not remapped, but copied. This
     // costs memory, since builtins become private dirty anonymous memory,
     // rather than shared, clean, file-backed memory for the embedded version.
@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/paged-spaces-inl.h"  // For PagedSpaceObjectIterator.
+#include "src/objects/deoptimization-data-inl.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -47,6 +48,8 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(Tagged<HeapObject> object,
     isolate->code_kind_statistics()[static_cast<int>(code_kind)] +=
         abstract_code->Size(cage_base);
     CodeStatistics::CollectCodeCommentStatistics(abstract_code, isolate);
+    CodeStatistics::CollectDeoptimizationDataStatistics(abstract_code,
+                                                        isolate);
 #endif
   }
 }
@@ -100,6 +103,22 @@ void CodeStatistics::ReportCodeStatistics(Isolate* isolate) {
   }
   PrintF("\n");
 
+  // Report deoptimization data statistics
+  int* deoptimization_data_statistics =
+      isolate->deoptimization_data_statistics();
+  int* deoptimization_data_saved_statistics =
+      isolate->deoptimization_data_saved_statistics();
+  PrintF("   Deoptimization data histograms (size/saved by sharing): \n");
+  for (int i = 0; i < kCodeKindCount; i++) {
+    if (deoptimization_data_statistics[i] > 0) {
+      PrintF("     %-20s: %10d/%10d bytes\n",
+             CodeKindToString(static_cast<CodeKind>(i)),
+             deoptimization_data_statistics[i],
+             deoptimization_data_saved_statistics[i]);
+    }
+  }
+  PrintF("\n");
+
   // Report code and metadata statistics
   if (isolate->code_and_metadata_size() > 0) {
     PrintF("Code size including metadata    : %10d bytes\n",
@@ -133,6 +152,16 @@ void CodeStatistics::ResetCodeStatistics(Isolate* isolate) {
     code_kind_statistics[i] = 0;
   }
 
+  // Clear deoptimization data statistics
+  int* deoptimization_data_statistics =
+      isolate->deoptimization_data_statistics();
+  int* deoptimization_data_saved_statistics =
+      isolate->deoptimization_data_saved_statistics();
+  for (int i = 0; i < kCodeKindCount; i++) {
+    deoptimization_data_statistics[i] = 0;
+    deoptimization_data_saved_statistics[i] = 0;
+  }
+
   // Clear code comment statistics
   CommentStatistic* comments_statistics =
       isolate->paged_space_comments_statistics();
@@ -226,6 +255,33 @@ void CodeStatistics::CollectCodeCommentStatistics(Tagged<AbstractCode> obj,
   delta += static_cast<int>(code->instruction_size() - prev_pc_offset);
   EnterComment(isolate, "NoComment", delta);
 }
+
+// Collects the size of the deoptimization data of optimized code, and how much
+// the frame translations save by sharing instructions with the previous
+// translation (MATCH_PREVIOUS_TRANSLATION) or by compression.
+void CodeStatistics::CollectDeoptimizationDataStatistics(
+    Tagged<AbstractCode> obj, Isolate* isolate) {
+  PtrComprCageBase cage_base{isolate};
+  if (!IsCode(obj, cage_base)) return;
+
+  Tagged<Code> code = Cast<Code>(obj);
+  if (!code->uses_deoptimization_data() ||
+      !code->has_deoptimization_data_or_interpreter_data()) {
+    return;
+  }
+  Tagged<DeoptimizationData> deopt_data =
+      Cast<DeoptimizationData>(code->deoptimization_data());
+  if (deopt_data->length() == 0) return;
+
+  Tagged<DeoptimizationFrameTranslation> translation =
+      deopt_data->FrameTranslation();
+  int size = deopt_data->Size() + translation->Size() +
+             deopt_data->LiteralArray()->Size();
+  int saved = translation->UnsharedSizeInBytes() - translation->length();
+  int kind = static_cast<int>(code->kind());
+  isolate->deoptimization_data_statistics()[kind] += size;
+  isolate->deoptimization_data_saved_statistics()[kind] += saved;
+}
 #endif
 
 }  // namespace internal
@@ -30,7 +30,8 @@ class CodeStatistics {
   static void ResetCodeAndMetadataStatistics(Isolate* isolate);
 
 #ifdef DEBUG
-  // Report statistics about code kind, code+metadata and code comments.
+  // Report statistics about code kind, deoptimization data, code+metadata and
+  // code comments.
   static void ReportCodeStatistics(Isolate* isolate);
 #endif
 
@@ -43,6 +44,8 @@ class CodeStatistics {
                                        CodeCommentsIterator* it);
   static void CollectCodeCommentStatistics(Tagged<AbstractCode> obj,
                                            Isolate* isolate);
+  static void CollectDeoptimizationDataStatistics(Tagged<AbstractCode> obj,
+                                                  Isolate* isolate);
   static void EnterComment(Isolate* isolate, const char* comment, int delta);
   static void ResetCodeStatistics(Isolate* isolate);
 #endif
@@ -11,6 +11,7 @@
 
 #include "include/v8config.h"
 #include "src/base/logging.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -130,6 +131,29 @@ class ConcurrentMarkingVisitor final
   friend class MarkingVisitorBase<ConcurrentMarkingVisitor>;
 };
 
+namespace {
+
+// In work stealing mode a failed Pop() registers a steal request with the
+// shared worklist. Spin for a bit to give busy markers the chance to donate
+// parts of their private work before the task gives up.
+bool PopOrStealWork(MarkingWorklists::Local& local_marking_worklists,
+                    JobDelegate* delegate, Tagged<HeapObject>* object) {
+  static constexpr int kSpinsPerAttempt = 64;
+  if (local_marking_worklists.Pop(object)) return true;
+  if (!v8_flags.gc_work_stealing) return false;
+  for (int attempt = 0; attempt < v8_flags.gc_work_stealing_attempts;
+       ++attempt) {
+    if (delegate->ShouldYield()) return false;
+    for (int i = 0; i < kSpinsPerAttempt; ++i) {
+      YIELD_PROCESSOR;
+    }
+    if (local_marking_worklists.Pop(object)) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 struct ConcurrentMarking::TaskState {
   size_t marked_bytes = 0;
   MemoryChunkDataMap memory_chunk_data;
@@ -269,9 +293,12 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
   TaskState* task_state = task_state_[task_id].get();
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap());
   MarkingWorklists::Local local_marking_worklists(
-      marking_worklists_, cpp_heap
-                              ? cpp_heap->CreateCppMarkingState()
-                              : MarkingWorklists::Local::kNoCppMarkingState);
+      marking_worklists_,
+      cpp_heap ? cpp_heap->CreateCppMarkingState()
+               : MarkingWorklists::Local::kNoCppMarkingState,
+      v8_flags.gc_work_stealing
+          ? MarkingWorklist::Local::WorkStealing::kEnabled
+          : MarkingWorklist::Local::WorkStealing::kDisabled);
   WeakObjects::Local local_weak_objects(weak_objects_);
   ConcurrentMarkingVisitor visitor(
       &local_marking_worklists, &local_weak_objects, heap_, mark_compact_epoch,
@@ -311,7 +338,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       while (current_marked_bytes < kBytesUntilInterruptCheck &&
              objects_processed < kObjectsUntilInterruptCheck) {
         Tagged<HeapObject> object;
-        if (!local_marking_worklists.Pop(&object)) {
+        if (!PopOrStealWork(local_marking_worklists, delegate, &object)) {
           done = true;
           break;
         }
@@ -384,6 +411,11 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
     local_weak_objects.Publish();
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
     total_marked_bytes_ += marked_bytes;
+    if (v8_flags.gc_work_stealing) {
+      heap_->tracer()->AddWorkStealingStats(
+          local_marking_worklists.steals(),
+          local_marking_worklists.idle_events());
+    }
 
     if (another_ephemeron_iteration) {
       set_another_ephemeron_iteration(true);
@@ -391,8 +423,11 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
   }
   if (v8_flags.trace_concurrent_marking) {
     heap_->isolate()->PrintWithTimestamp(
-        "Major task %d concurrently marked %dKB in %.2fms\n", task_id,
-        static_cast<int>(marked_bytes / KB), time_ms);
+        "Major task %d concurrently marked %dKB in %.2fms (steals=%zu, "
+        "idle=%zu)\n",
+        task_id, static_cast<int>(marked_bytes / KB), time_ms,
+        local_marking_worklists.steals(),
+        local_marking_worklists.idle_events());
   }
 
   DCHECK(task_state->local_pretenuring_feedback.empty());
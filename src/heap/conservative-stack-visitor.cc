@@ -8,6 +8,7 @@
 #include "src/heap/marking-inl.h"
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/memory-chunk.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/objects/visitors.h"
 
 #ifdef V8_COMPRESS_POINTERS
@@ -89,9 +90,22 @@ Address ConservativeStackVisitor::FindBasePtr(
     if (chunk->IsFromPage()) return kNullAddress;
   }
 
-  // Try to find the address of a previous valid object on this page.
-  Address base_ptr =
-      MarkingBitmap::FindPreviousValidObject(page, maybe_inner_ptr);
+  // Try to find the address of a previous valid object on this page, using the
+  // object start bitmap if the page maintains one.
+  Address base_ptr = kNullAddress;
+  if (const ObjectStartBitmap* object_start_bitmap =
+          page->object_start_bitmap();
+      object_start_bitmap && page->SweepingDone()) {
+    const size_t offset = object_start_bitmap->FindPreviousObjectStart(
+        chunk->Offset(maybe_inner_ptr));
+    if (offset != ObjectStartBitmap::kNotFound) {
+      base_ptr = chunk->address() + offset;
+      DCHECK_LE(page->area_start(), base_ptr);
+    }
+  }
+  if (base_ptr == kNullAddress) {
+    base_ptr = MarkingBitmap::FindPreviousValidObject(page, maybe_inner_ptr);
+  }
   // Iterate through the objects in the page forwards, until we find the object
   // containing maybe_inner_ptr.
   DCHECK_LE(base_ptr, maybe_inner_ptr);
@@ -747,10 +747,16 @@ void CppHeap::InitializeMarking(CollectionType collection_type,
                  (MarkingType::kAtomic == marking_config.marking_type) ||
                      force_incremental_marking_for_testing_);
   if (ShouldReduceMemory(current_gc_flags_)) {
-    // Only enable compaction when in a memory reduction garbage collection as
-    // it may significantly increase the final garbage collection pause.
-    compactor_.InitializeIfShouldCompact(marking_config.marking_type,
-                                         marking_config.stack_state);
+    compactor_.InitializeIfShouldCompact(
+        marking_config.marking_type, marking_config.stack_state,
+        cppgc::internal::Compactor::Trigger::kMemoryReducing);
+  } else if (v8_flags.cppheap_compact_fragmented_spaces) {
+    // Outside of memory reducing garbage collections only fragmented spaces are
+    // compacted. The evacuation budget of the compactor bounds the increase of
+    // the final garbage collection pause.
+    compactor_.InitializeIfShouldCompact(
+        marking_config.marking_type, marking_config.stack_state,
+        cppgc::internal::Compactor::Trigger::kFragmentation);
   }
   marker_ = std::make_unique<UnifiedHeapMarker>(
       isolate_ ? isolate()->heap() : nullptr, AsBase(), platform_.get(),
@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <unordered_map>
@@ -28,6 +29,12 @@ namespace {
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 
+// A space is considered fragmented if it holds at least
+// kFragmentedSpaceFreeListSizeThreshold bytes on its free list and its live
+// ratio is below kFragmentedSpaceMaxLiveRatio.
+static constexpr size_t kFragmentedSpaceFreeListSizeThreshold = 128 * kKB;
+static constexpr double kFragmentedSpaceMaxLiveRatio = 0.5;
+
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
 // relocate() will adjust the slots to point to the new location of the
@@ -39,8 +46,10 @@ class MovableReferences final {
   using MovableReference = CompactionWorklists::MovableReference;
 
  public:
-  explicit MovableReferences(HeapBase& heap)
-      : heap_(heap), heap_has_move_listeners_(heap.HasMoveListeners()) {}
+  MovableReferences(HeapBase& heap, const Compactor& compactor)
+      : heap_(heap),
+        compactor_(compactor),
+        heap_has_move_listeners_(heap.HasMoveListeners()) {}
 
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(MovableReference*);
@@ -56,7 +65,13 @@ class MovableReferences final {
   void UpdateCallbacks();
 
  private:
+  bool IsCompacted(const BasePage* page) const {
+    return !page->is_large() &&
+           compactor_.WasCompacted(NormalPageSpace::From(page->space()));
+  }
+
   HeapBase& heap_;
+  const Compactor& compactor_;
 
   // Map from movable reference (value) to its slot. Upon moving an object its
   // slot pointing to it requires updating. Movable reference should currently
@@ -105,8 +120,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
 
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
-  // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on spaces that are not compacted in this GC.
+  if (!IsCompacted(value_page)) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -127,7 +142,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!IsCompacted(slot_page))) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -453,6 +468,31 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
                          });
 }
 
+bool IsFragmented(const NormalPageSpace& space) {
+  DCHECK(space.is_compactable());
+  if (!space.size()) return false;
+  const size_t free_list_size = space.free_list().Size();
+  const size_t capacity = space.size() * NormalPage::PayloadSize();
+  DCHECK_LE(free_list_size, capacity);
+  return free_list_size >= kFragmentedSpaceFreeListSizeThreshold &&
+         capacity - free_list_size < kFragmentedSpaceMaxLiveRatio * capacity;
+}
+
+// Returns the bytes marked on the pages of `space` in the current GC.
+size_t MarkedBytes(const NormalPageSpace& space) {
+  size_t marked_bytes = 0;
+  for (const BasePage* page : space) {
+    marked_bytes += page->marked_bytes();
+  }
+  return marked_bytes;
+}
+
+struct CompactionCandidate {
+  NormalPageSpace* space;
+  size_t live_bytes;
+  double live_ratio;
+};
+
 }  // namespace
 
 Compactor::Compactor(RawHeap& heap) : heap_(heap) {
@@ -478,14 +518,68 @@ bool Compactor::ShouldCompact(GCConfig::MarkingType marking_type,
     return true;
   }
 
+  if (trigger_ == Trigger::kFragmentation) {
+    return std::any_of(
+        compactable_spaces_.cbegin(), compactable_spaces_.cend(),
+        [](const NormalPageSpace* space) { return IsFragmented(*space); });
+  }
+
   size_t free_list_size = UpdateHeapResidency(compactable_spaces_);
 
   return free_list_size > kFreeListSizeThreshold;
 }
 
+size_t Compactor::SelectSpacesToCompact() {
+  spaces_to_compact_.clear();
+  if (enable_for_next_gc_for_testing_) {
+    spaces_to_compact_ = compactable_spaces_;
+    return compactable_spaces_.size();
+  }
+
+  // Live bytes are precise at this point as marking has finished.
+  std::vector<CompactionCandidate> candidates;
+  for (NormalPageSpace* space : compactable_spaces_) {
+    if (!space->size()) continue;
+    const size_t live_bytes = MarkedBytes(*space);
+    const double live_ratio =
+        static_cast<double>(live_bytes) /
+        static_cast<double>(space->size() * NormalPage::PayloadSize());
+    if (trigger_ == Trigger::kFragmentation &&
+        live_ratio >= kFragmentedSpaceMaxLiveRatio) {
+      continue;
+    }
+    candidates.push_back({space, live_bytes, live_ratio});
+  }
+  // Compact the most fragmented spaces first. The most fragmented space is
+  // always compacted, even if its live bytes exceed the budget on their own, as
+  // it would otherwise never be compacted.
+  std::sort(candidates.begin(), candidates.end(),
+            [](const CompactionCandidate& a, const CompactionCandidate& b) {
+              return a.live_ratio < b.live_ratio;
+            });
+  size_t evacuated_bytes = 0;
+  for (const CompactionCandidate& candidate : candidates) {
+    if (!spaces_to_compact_.empty() &&
+        evacuated_bytes + candidate.live_bytes > evacuation_budget_) {
+      continue;
+    }
+    evacuated_bytes += candidate.live_bytes;
+    spaces_to_compact_.push_back(candidate.space);
+  }
+  return candidates.size();
+}
+
+bool Compactor::WasCompacted(const NormalPageSpace& space) const {
+  return std::find(spaces_to_compact_.cbegin(), spaces_to_compact_.cend(),
+                   &space) != spaces_to_compact_.cend();
+}
+
 void Compactor::InitializeIfShouldCompact(GCConfig::MarkingType marking_type,
-                                          StackState stack_state) {
+                                          StackState stack_state,
+                                          Trigger trigger) {
   DCHECK(!is_enabled_);
+  spaces_to_compact_.clear();
+  trigger_ = trigger;
 
   if (!ShouldCompact(marking_type, stack_state)) return;
 
@@ -513,7 +607,9 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
-  MovableReferences movable_references(*heap_.heap());
+  const size_t candidate_spaces = SelectSpacesToCompact();
+
+  MovableReferences movable_references(*heap_.heap(), *this);
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
       *compaction_worklists_->movable_slots_worklist());
@@ -525,12 +621,22 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
+  size_t evacuated_bytes = 0;
+  for (NormalPageSpace* space : spaces_to_compact_) {
+    evacuated_bytes += MarkedBytes(*space);
     CompactSpace(
         space, movable_references,
         young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
   }
 
+  if (!spaces_to_compact_.empty()) {
+    statistics_.compacting_gcs++;
+    statistics_.candidate_spaces = candidate_spaces;
+    statistics_.compacted_spaces = spaces_to_compact_.size();
+    statistics_.evacuated_bytes = evacuated_bytes;
+    statistics_.evacuation_budget_bytes = evacuation_budget_;
+  }
+
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
   return CompactableSpaceHandling::kIgnore;
@@ -5,8 +5,12 @@
 #ifndef V8_HEAP_CPPGC_COMPACTOR_H_
 #define V8_HEAP_CPPGC_COMPACTOR_H_
 
+#include <vector>
+
+#include "include/cppgc/heap-statistics.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/garbage-collector.h"
+#include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/raw-heap.h"
 
 namespace cppgc {
@@ -14,38 +18,75 @@ namespace internal {
 
 class NormalPageSpace;
 
+// Compacts compactable spaces in the atomic pause of a major GC. Only spaces
+// whose objects are referenced through registered movable references can be
+// compacted, i.e. spaces of custom spaces that support compaction.
+//
+// Memory reducing GCs compact spaces whenever enough memory is held by free
+// lists. Other GCs compact only fragmented spaces, i.e. spaces with a low live
+// ratio. In both cases, spaces are compacted in order of increasing live ratio
+// until the evacuation budget is spent, which bounds the additional pause
+// time. Spaces that are not compacted are swept as usual and are reconsidered
+// in subsequent GCs.
 class V8_EXPORT_PRIVATE Compactor final {
   using CompactableSpaceHandling = SweepingConfig::CompactableSpaceHandling;
 
  public:
+  enum class Trigger { kMemoryReducing, kFragmentation };
+
+  // Default limit for the live bytes evacuated by a single GC.
+  static constexpr size_t kDefaultEvacuationBudget = 8 * kMB;
+
   explicit Compactor(RawHeap&);
   ~Compactor() { DCHECK(!is_enabled_); }
 
   Compactor(const Compactor&) = delete;
   Compactor& operator=(const Compactor&) = delete;
 
-  void InitializeIfShouldCompact(GCConfig::MarkingType, StackState);
+  void InitializeIfShouldCompact(GCConfig::MarkingType, StackState, Trigger);
   void CancelIfShouldNotCompact(GCConfig::MarkingType, StackState);
   // Returns whether spaces need to be processed by the Sweeper after
-  // compaction.
+  // compaction. Compactable spaces that were not compacted always need to be
+  // swept, see `WasCompacted()`.
   CompactableSpaceHandling CompactSpacesIfEnabled();
 
+  // Returns whether `space` was compacted by the last call to
+  // `CompactSpacesIfEnabled()`.
+  bool WasCompacted(const NormalPageSpace& space) const;
+
+  // Returns the decisions taken by the most recent compacting GC.
+  const HeapStatistics::CompactionStatistics& statistics() const {
+    return statistics_;
+  }
+
   CompactionWorklists* compaction_worklists() {
     return compaction_worklists_.get();
   }
 
   void EnableForNextGCForTesting();
   bool IsEnabledForTesting() const { return is_enabled_; }
+  void SetEvacuationBudgetForTesting(size_t budget) {
+    evacuation_budget_ = budget;
+  }
 
  private:
   bool ShouldCompact(GCConfig::MarkingType, StackState) const;
+  // Selects the spaces compacted by the current GC and returns the number of
+  // spaces that were eligible for compaction.
+  size_t SelectSpacesToCompact();
 
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
   std::vector<NormalPageSpace*> compactable_spaces_;
+  // Subset of `compactable_spaces_` compacted by the current or last GC.
+  std::vector<NormalPageSpace*> spaces_to_compact_;
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
+  HeapStatistics::CompactionStatistics statistics_;
+  size_t evacuation_budget_ = kDefaultEvacuationBudget;
+  Trigger trigger_ = Trigger::kMemoryReducing;
+
   bool is_enabled_ = false;
   bool is_cancelled_ = false;
   bool enable_for_next_gc_for_testing_ = false;
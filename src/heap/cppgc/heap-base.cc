@@ -311,7 +311,8 @@ HeapStatistics HeapBase::CollectStatistics(
             pooled_memory,
             HeapStatistics::DetailLevel::kBrief,
             {},
-            {}};
+            {},
+            compactor_.statistics()};
   }
 
   sweeper_.FinishIfRunning();
@@ -120,6 +120,7 @@ HeapStatistics HeapStatisticsCollector::CollectDetailedStatistics(
   stats.committed_size_bytes += pooled_memory;
   stats.resident_size_bytes += pooled_memory;
   stats.pooled_memory_size_bytes = pooled_memory;
+  stats.compaction_stats = heap->compactor().statistics();
 
   return stats;
 }
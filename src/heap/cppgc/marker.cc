@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "include/cppgc/heap-consistency.h"
 #include "include/cppgc/platform.h"
@@ -378,6 +379,45 @@ class WeakCallbackJobTask final : public cppgc::JobTask {
   LivenessBroker& broker_;
 };
 
+// Processes weak container callbacks in parallel. Each weak container
+// registers its callback only once per cycle and the callback only processes
+// the container's own backing store, so callbacks of different containers can
+// run concurrently. The worklist segments are the chunks of work claimed by
+// the individual workers.
+class WeakContainerCallbackJobTask final : public cppgc::JobTask {
+ public:
+  WeakContainerCallbackJobTask(
+      MarkerBase* marker,
+      MarkingWorklists::WeakCallbackWorklist* callback_worklist,
+      LivenessBroker& broker)
+      : marker_(marker),
+        callback_worklist_(callback_worklist),
+        broker_(broker) {}
+
+  void Run(JobDelegate* delegate) override {
+    // The joining thread is already accounted for by the atomic pause scopes.
+    std::optional<StatsCollector::EnabledConcurrentScope> stats_scope;
+    if (!delegate->IsJoiningThread()) {
+      stats_scope.emplace(marker_->heap().stats_collector(),
+                          StatsCollector::kConcurrentWeakContainerCallback);
+    }
+    MarkingWorklists::WeakCallbackWorklist::Local local(*callback_worklist_);
+    MarkingWorklists::WeakCallbackItem item;
+    while (local.Pop(&item)) {
+      item.callback(broker_, item.parameter);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return callback_worklist_->Size() + worker_count;
+  }
+
+ private:
+  MarkerBase* marker_;
+  MarkingWorklists::WeakCallbackWorklist* callback_worklist_;
+  LivenessBroker& broker_;
+};
+
 class WeakPersistentJobTask final : public cppgc::JobTask {
  public:
   WeakPersistentJobTask(MarkerBase* marker,
@@ -426,8 +466,10 @@ void MarkerBase::ProcessWeakness() {
   LivenessBroker broker = LivenessBrokerFactory::Create();
   std::unique_ptr<cppgc::JobHandle> weak_callback_job_handle{nullptr};
   std::unique_ptr<cppgc::JobHandle> weak_persistent_job_handle{nullptr};
-  if (heap().marking_support() ==
-      cppgc::Heap::MarkingType::kIncrementalAndConcurrent) {
+  const bool process_in_parallel =
+      heap().marking_support() ==
+      cppgc::Heap::MarkingType::kIncrementalAndConcurrent;
+  if (process_in_parallel) {
     weak_callback_job_handle = platform_->PostJob(
         cppgc::TaskPriority::kUserBlocking,
         std::make_unique<WeakCallbackJobTask>(
@@ -443,11 +485,25 @@ void MarkerBase::ProcessWeakness() {
     StatsCollector::EnabledScope stats_scope(
         heap().stats_collector(),
         StatsCollector::kWeakContainerCallbacksProcessing);
-    MarkingWorklists::WeakCallbackItem item;
     MarkingWorklists::WeakCallbackWorklist::Local& collections_local =
         mutator_marking_state_.weak_container_callback_worklist();
-    while (collections_local.Pop(&item)) {
-      item.callback(broker, item.parameter);
+    std::unique_ptr<cppgc::JobHandle> weak_container_job_handle{nullptr};
+    if (process_in_parallel) {
+      // Publish local callbacks so that all workers can claim them.
+      collections_local.Publish();
+      weak_container_job_handle = platform_->PostJob(
+          cppgc::TaskPriority::kUserBlocking,
+          std::make_unique<WeakContainerCallbackJobTask>(
+              this, marking_worklists_.weak_container_callback_worklist(),
+              broker));
+    }
+    if (weak_container_job_handle) {
+      weak_container_job_handle->Join();
+    } else {
+      MarkingWorklists::WeakCallbackItem item;
+      while (collections_local.Pop(&item)) {
+        item.callback(broker, item.parameter);
+      }
     }
   }
 
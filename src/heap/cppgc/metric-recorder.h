@@ -35,6 +35,11 @@ class MetricRecorder {
       int64_t after_bytes = -1;
       int64_t freed_bytes = -1;
     };
+    // Old-to-new remembered set visited by minor GCs. Not set for major GCs.
+    struct RememberedSet {
+      int64_t slots = -1;
+      int64_t source_objects = -1;
+    };
 
     Type type = Type::kMajor;
     Phases total;
@@ -43,6 +48,7 @@ class MetricRecorder {
     IncrementalPhases main_thread_incremental;
     Sizes objects;
     Sizes memory;
+    RememberedSet remembered_set;
     double collection_rate_in_percent;
     double efficiency_in_bytes_per_us;
     double main_thread_efficiency_in_bytes_per_us;
@@ -38,6 +38,13 @@ class StatsCollector;
 class PageBackend;
 class GarbageCollector;
 
+// Allocates objects from the linear allocation buffers and free lists owned by
+// the spaces of a heap.
+//
+// The allocator supports a single mutator at a time. Embedders may allocate
+// from multiple threads only if they serialize all accesses to the heap, as the
+// linear allocation buffers, free lists, the incremental marker, write
+// barriers, and conservative stack scanning on GC assume a single mutator.
 class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
  public:
   static constexpr size_t kSmallestSpaceSize = 32;
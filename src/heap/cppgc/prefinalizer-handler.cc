@@ -5,8 +5,11 @@
 #include "src/heap/cppgc/prefinalizer-handler.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <optional>
 
+#include "include/cppgc/platform.h"
 #include "src/base/platform/platform.h"
 #include "src/heap/cppgc/heap-page.h"
 #include "src/heap/cppgc/heap.h"
@@ -17,10 +20,16 @@ namespace cppgc {
 namespace internal {
 
 PrefinalizerRegistration::PrefinalizerRegistration(void* object,
-                                                   Callback callback) {
+                                                   Callback callback)
+    : PrefinalizerRegistration(object, callback, Kind::kMutatorThread) {}
+
+PrefinalizerRegistration::PrefinalizerRegistration(void* object,
+                                                   Callback callback,
+                                                   Kind kind) {
   auto* page = BasePage::FromPayload(object);
   DCHECK(!page->space().is_compactable());
-  page->heap().prefinalizer_handler()->RegisterPrefinalizer({object, callback});
+  page->heap().prefinalizer_handler()->RegisterPrefinalizer({object, callback},
+                                                            kind);
 }
 
 bool PreFinalizer::operator==(const PreFinalizer& other) const {
@@ -37,8 +46,19 @@ PreFinalizerHandler::PreFinalizerHandler(HeapBase& heap)
 {
 }
 
-void PreFinalizerHandler::RegisterPrefinalizer(PreFinalizer pre_finalizer) {
+void PreFinalizerHandler::RegisterPrefinalizer(PreFinalizer pre_finalizer,
+                                               PreFinalizer::Kind kind) {
   DCHECK(CurrentThreadIsCreationThread());
+  if (kind == PreFinalizer::Kind::kConcurrent) {
+    // Concurrent prefinalizers must not allocate, so they cannot register new
+    // prefinalizers while being invoked.
+    DCHECK(!is_invoking_);
+    DCHECK_EQ(concurrent_pre_finalizers_.end(),
+              std::find(concurrent_pre_finalizers_.begin(),
+                        concurrent_pre_finalizers_.end(), pre_finalizer));
+    concurrent_pre_finalizers_.push_back(pre_finalizer);
+    return;
+  }
   DCHECK_EQ(ordered_pre_finalizers_.end(),
             std::find(ordered_pre_finalizers_.begin(),
                       ordered_pre_finalizers_.end(), pre_finalizer));
@@ -62,6 +82,7 @@ void PreFinalizerHandler::InvokePreFinalizers() {
   // This also ensures that a CHECK() hits in case prefinalizers allocate in the
   // configuration that prohibits this.
   heap_.object_allocator().ResetLinearAllocationBuffers();
+  InvokeConcurrentPreFinalizers(liveness_broker);
   // Prefinalizers can allocate other objects with prefinalizers, which will
   // modify ordered_pre_finalizers_ and break iterators.
   std::vector<PreFinalizer> new_ordered_pre_finalizers;
@@ -88,6 +109,96 @@ void PreFinalizerHandler::InvokePreFinalizers() {
   ordered_pre_finalizers_.shrink_to_fit();
 }
 
+namespace {
+
+class ConcurrentPreFinalizerJobTask final : public cppgc::JobTask {
+ public:
+  // Number of prefinalizers claimed by a worker at once.
+  static constexpr size_t kChunkSize = 128;
+
+  ConcurrentPreFinalizerJobTask(StatsCollector* stats_collector,
+                                const std::vector<PreFinalizer>& pre_finalizers,
+                                std::vector<uint8_t>& invoked,
+                                const LivenessBroker& liveness_broker)
+      : stats_collector_(stats_collector),
+        pre_finalizers_(pre_finalizers),
+        invoked_(invoked),
+        liveness_broker_(liveness_broker) {
+    DCHECK_EQ(pre_finalizers_.size(), invoked_.size());
+  }
+
+  void Run(JobDelegate* delegate) override {
+    // The joining thread is already accounted for by the atomic pause scopes.
+    std::optional<StatsCollector::EnabledConcurrentScope> stats_scope;
+    if (!delegate->IsJoiningThread()) {
+      stats_scope.emplace(stats_collector_,
+                          StatsCollector::kConcurrentSweepInvokePreFinalizers);
+    }
+    const size_t size = pre_finalizers_.size();
+    for (size_t start = next_.fetch_add(kChunkSize, std::memory_order_relaxed);
+         start < size;
+         start = next_.fetch_add(kChunkSize, std::memory_order_relaxed)) {
+      const size_t end = std::min(start + kChunkSize, size);
+      for (size_t i = start; i < end; ++i) {
+        const PreFinalizer& pf = pre_finalizers_[i];
+        invoked_[i] = (pf.callback)(liveness_broker_, pf.object);
+      }
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next = next_.load(std::memory_order_relaxed);
+    const size_t size = pre_finalizers_.size();
+    if (next >= size) return 0;
+    return (size - next + kChunkSize - 1) / kChunkSize;
+  }
+
+ private:
+  StatsCollector* const stats_collector_;
+  const std::vector<PreFinalizer>& pre_finalizers_;
+  // Each entry is written by the worker that claimed its chunk and read after
+  // joining the job.
+  std::vector<uint8_t>& invoked_;
+  const LivenessBroker& liveness_broker_;
+  std::atomic<size_t> next_{0};
+};
+
+}  // namespace
+
+void PreFinalizerHandler::InvokeConcurrentPreFinalizers(
+    const LivenessBroker& liveness_broker) {
+  if (concurrent_pre_finalizers_.empty()) return;
+
+  std::vector<uint8_t> invoked(concurrent_pre_finalizers_.size(), 0);
+  std::unique_ptr<cppgc::JobHandle> job_handle;
+  if (heap_.sweeping_support() ==
+      cppgc::Heap::SweepingType::kIncrementalAndConcurrent) {
+    job_handle = heap_.platform()->PostJob(
+        cppgc::TaskPriority::kUserBlocking,
+        std::make_unique<ConcurrentPreFinalizerJobTask>(
+            heap_.stats_collector(), concurrent_pre_finalizers_, invoked,
+            liveness_broker));
+  }
+  if (job_handle) {
+    job_handle->Join();
+  } else {
+    for (size_t i = 0; i < concurrent_pre_finalizers_.size(); ++i) {
+      const PreFinalizer& pf = concurrent_pre_finalizers_[i];
+      invoked[i] = (pf.callback)(liveness_broker, pf.object);
+    }
+  }
+
+  size_t kept = 0;
+  for (size_t i = 0; i < concurrent_pre_finalizers_.size(); ++i) {
+    if (!invoked[i]) {
+      concurrent_pre_finalizers_[kept++] = concurrent_pre_finalizers_[i];
+    }
+  }
+  concurrent_pre_finalizers_.resize(kept);
+  concurrent_pre_finalizers_.shrink_to_fit();
+}
+
 bool PreFinalizerHandler::CurrentThreadIsCreationThread() {
 #ifdef DEBUG
   return creation_thread_id_ == v8::base::OS::GetCurrentThreadId();
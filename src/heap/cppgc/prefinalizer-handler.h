@@ -17,6 +17,7 @@ class HeapBase;
 
 struct PreFinalizer final {
   using Callback = PrefinalizerRegistration::Callback;
+  using Kind = PrefinalizerRegistration::Kind;
 
   void* object;
   Callback callback;
@@ -28,8 +29,11 @@ class PreFinalizerHandler final {
  public:
   explicit PreFinalizerHandler(HeapBase& heap);
 
-  void RegisterPrefinalizer(PreFinalizer pre_finalizer);
+  void RegisterPrefinalizer(PreFinalizer pre_finalizer,
+                            PreFinalizer::Kind kind);
 
+  // Invokes concurrent prefinalizers in parallel, followed by mutator thread
+  // prefinalizers in reverse order of registration.
   void InvokePreFinalizers();
 
   bool IsInvokingPreFinalizers() const { return is_invoking_; }
@@ -43,12 +47,17 @@ class PreFinalizerHandler final {
   // Checks that the current thread is the thread that created the heap.
   bool CurrentThreadIsCreationThread();
 
+  void InvokeConcurrentPreFinalizers(const LivenessBroker&);
+
   // Pre-finalizers are called in the reverse order in which they are
   // registered by the constructors (including constructors of Mixin
   // objects) for an object, by processing the ordered_pre_finalizers_
   // back-to-front.
   std::vector<PreFinalizer> ordered_pre_finalizers_;
   std::vector<PreFinalizer>* current_ordered_pre_finalizers_;
+  // Prefinalizers registered via CPPGC_USING_CONCURRENT_PRE_FINALIZER. They are
+  // not ordered.
+  std::vector<PreFinalizer> concurrent_pre_finalizers_;
 
   HeapBase& heap_;
   bool is_invoking_ = false;
@@ -16,6 +16,7 @@
 #include "src/heap/cppgc/heap-page.h"
 #include "src/heap/cppgc/heap-visitor.h"
 #include "src/heap/cppgc/marking-state.h"
+#include "src/heap/cppgc/stats-collector.h"
 
 namespace cppgc {
 namespace internal {
@@ -202,8 +203,9 @@ class SlotRemover : HeapVisitor<SlotRemover> {
   HeapBase& heap_;
 };
 
-// Visit remembered set that was recorded in the generational barrier.
-void VisitRememberedSlots(
+// Visit remembered set that was recorded in the generational barrier. Returns
+// the number of visited slots.
+size_t VisitRememberedSlots(
     HeapBase& heap, MutatorMarkingState& mutator_marking_state,
     const std::set<void*>& remembered_uncompressed_slots,
     const std::set<void*>& remembered_slots_for_verification) {
@@ -222,14 +224,15 @@ void VisitRememberedSlots(
     ++objects_visited;
   }
   DCHECK_EQ(remembered_slots_for_verification.size(), objects_visited);
-  USE(objects_visited);
+  return objects_visited;
 }
 
 // Visits source objects that were recorded in the generational barrier for
-// slots.
-void VisitRememberedSourceObjects(
+// slots. Returns the number of visited objects.
+size_t VisitRememberedSourceObjects(
     const std::set<HeapObjectHeader*>& remembered_source_objects,
     Visitor& visitor) {
+  size_t objects_visited = 0;
   for (HeapObjectHeader* source_hoh : remembered_source_objects) {
     DCHECK(source_hoh);
     // The age checking in the generational barrier is imprecise, since a card
@@ -242,7 +245,9 @@ void VisitRememberedSourceObjects(
 
     // Process eagerly to avoid reaccounting.
     trace_callback(&visitor, source_hoh->ObjectStart());
+    ++objects_visited;
   }
+  return objects_visited;
 }
 
 // Revisit in-construction objects from previous GCs. We must do it to make
@@ -335,9 +340,12 @@ void OldToNewRememberedSet::Visit(
     Visitor& visitor, ConservativeTracingVisitor& conservative_visitor,
     MutatorMarkingState& marking_state) {
   DCHECK(heap_.generational_gc_supported());
-  VisitRememberedSlots(heap_, marking_state, remembered_uncompressed_slots_,
-                       remembered_slots_for_verification_);
-  VisitRememberedSourceObjects(remembered_source_objects_, visitor);
+  const size_t slots =
+      VisitRememberedSlots(heap_, marking_state, remembered_uncompressed_slots_,
+                           remembered_slots_for_verification_);
+  const size_t source_objects =
+      VisitRememberedSourceObjects(remembered_source_objects_, visitor);
+  heap_.stats_collector()->NotifyRememberedSetVisited(slots, source_objects);
   RevisitInConstructionObjects(remembered_in_construction_objects_.previous,
                                visitor, conservative_visitor);
 }
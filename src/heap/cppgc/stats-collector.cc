@@ -125,6 +125,14 @@ void StatsCollector::NotifyMarkingStarted(CollectionType collection_type,
   gc_state_ = GarbageCollectionState::kMarking;
 }
 
+void StatsCollector::NotifyRememberedSetVisited(size_t slots,
+                                                size_t source_objects) {
+  DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
+  DCHECK_EQ(CollectionType::kMinor, current_.collection_type);
+  current_.remembered_slots += slots;
+  current_.remembered_source_objects += source_objects;
+}
+
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
@@ -186,11 +194,17 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
     int64_t concurrent_mark_us, int64_t concurrent_sweep_us,
     int64_t objects_before_bytes, int64_t objects_after_bytes,
     int64_t objects_freed_bytes, int64_t memory_before_bytes,
-    int64_t memory_after_bytes, int64_t memory_freed_bytes) {
+    int64_t memory_after_bytes, int64_t memory_freed_bytes,
+    int64_t remembered_slots, int64_t remembered_source_objects) {
   MetricRecorder::GCCycle event;
   event.type = (type == CollectionType::kMajor)
                    ? MetricRecorder::GCCycle::Type::kMajor
                    : MetricRecorder::GCCycle::Type::kMinor;
+  // Remembered set:
+  if (type == CollectionType::kMinor) {
+    event.remembered_set.slots = remembered_slots;
+    event.remembered_set.source_objects = remembered_source_objects;
+  }
   // MainThread.Incremental:
   event.main_thread_incremental.mark_duration_us =
       marking_type != StatsCollector::MarkingType::kAtomic ? incremental_mark_us
@@ -288,7 +302,8 @@ void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
         previous_.memory_size_before_sweep_bytes /* memory_before */,
         previous_.memory_size_before_sweep_bytes -
             memory_freed_bytes_since_end_of_marking_ /* memory_after */,
-        memory_freed_bytes_since_end_of_marking_ /* memory_freed */);
+        memory_freed_bytes_since_end_of_marking_ /* memory_freed */,
+        previous_.remembered_slots, previous_.remembered_source_objects);
     metric_recorder_->AddMainThreadEvent(event);
   }
 }
@@ -70,7 +70,10 @@ namespace internal {
   V(ConcurrentWeakCallback)                          \
   V(ConcurrentWeakPersistent)
 
-#define CPPGC_FOR_ALL_CONCURRENT_SCOPES(V) V(ConcurrentMarkProcessEphemerons)
+#define CPPGC_FOR_ALL_CONCURRENT_SCOPES(V) \
+  V(ConcurrentMarkProcessEphemerons)       \
+  V(ConcurrentSweepInvokePreFinalizers)    \
+  V(ConcurrentWeakContainerCallback)
 
 // Sink for various time and memory statistics.
 class V8_EXPORT_PRIVATE StatsCollector final {
@@ -122,6 +125,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t marked_bytes = 0;
     size_t object_size_before_sweep_bytes = -1;
     size_t memory_size_before_sweep_bytes = -1;
+    // Old-to-new remembered set entries visited by a minor GC.
+    size_t remembered_slots = 0;
+    size_t remembered_source_objects = 0;
   };
 
  private:
@@ -288,6 +294,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Indicates that marking of the current garbage collection cycle is
   // completed.
   void NotifyMarkingCompleted(size_t marked_bytes);
+  // Records the size of the old-to-new remembered set that was visited by the
+  // current minor garbage collection cycle.
+  void NotifyRememberedSetVisited(size_t slots, size_t source_objects);
   // Indicates the end of a garbage collection cycle. This means that sweeping
   // is finished at this point.
   void NotifySweepingCompleted(SweepingType);
@@ -14,6 +14,7 @@
 #include "include/cppgc/platform.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
+#include "src/heap/cppgc/compactor.h"
 #include "src/heap/cppgc/free-list.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -844,7 +845,7 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
 };
 
 // This visitor:
-// - clears free lists for all spaces;
+// - clears free lists for all spaces that were not compacted;
 // - moves all Heap pages to local Sweeper's state (SpaceStates).
 // - ASAN: Poisons all unmarked object payloads.
 class PrepareForSweepVisitor final
@@ -854,10 +855,12 @@ class PrepareForSweepVisitor final
 
  public:
   PrepareForSweepVisitor(SpaceStates* space_states, SweepingState* empty_pages,
-                         CompactableSpaceHandling compactable_space_handling)
+                         CompactableSpaceHandling compactable_space_handling,
+                         const Compactor& compactor)
       : space_states_(space_states),
         empty_pages_(empty_pages),
-        compactable_space_handling_(compactable_space_handling) {}
+        compactable_space_handling_(compactable_space_handling),
+        compactor_(compactor) {}
 
   void Run(RawHeap& raw_heap) {
     *space_states_ = SpaceStates(raw_heap.size());
@@ -867,7 +870,7 @@ class PrepareForSweepVisitor final
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_compactable() && compactor_.WasCompacted(space))
       return true;
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
@@ -905,6 +908,7 @@ class PrepareForSweepVisitor final
   SpaceStates* const space_states_;
   SweepingState* const empty_pages_;
   CompactableSpaceHandling compactable_space_handling_;
+  const Compactor& compactor_;
 };
 
 }  // namespace
@@ -942,7 +946,8 @@ class Sweeper::SweeperImpl final {
       heap_.heap()->stats_collector()->ResetDiscardedMemory();
     }
     PrepareForSweepVisitor(&space_states_, &empty_pages_,
-                           config.compactable_space_handling)
+                           config.compactable_space_handling,
+                           heap_.heap()->compactor())
         .Run(heap_);
 
     if (config.sweeping_type >= SweepingConfig::SweepingType::kIncremental) {
@@ -4141,6 +4141,7 @@ Handle<RegExpData> Factory::NewIrRegExpData(DirectHandle<String> source,
                                 ? v8_flags.regexp_tier_up_ticks
                                 : JSRegExp::kUninitializedValue;
   instance->set_ticks_until_tier_up(ticks_until_tier_up);
+  instance->set_tier_up_work(0);
   instance->set_backtrack_limit(backtrack_limit);
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
@@ -4175,6 +4176,7 @@ Handle<RegExpData> Factory::NewExperimentalRegExpData(
   instance->set_max_register_count(JSRegExp::kUninitializedValue);
   instance->set_capture_count(capture_count);
   instance->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
+  instance->set_tier_up_work(0);
   instance->set_backtrack_limit(JSRegExp::kUninitializedValue);
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
@@ -4517,6 +4519,7 @@ Handle<JSAtomicsMutex> Factory::NewJSAtomicsMutex() {
       Cast<JSAtomicsMutex>(NewJSObjectFromMap(map, AllocationType::kSharedOld));
   mutex->set_state(JSAtomicsMutex::kUnlockedUncontended);
   mutex->set_owner_thread_id(ThreadId::Invalid().ToInteger());
+  mutex->set_spin_estimate(0);
   mutex->SetNullWaiterQueueHead();
   return mutex;
 }
@@ -85,8 +85,20 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // and should be requeued.
   //
   // TODO(syg): Implement better scheduling for finalizers.
+#ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+  // Like microtasks, cleanup callbacks run with the continuation preserved
+  // embedder data of the code that created the FinalizationRegistry.
+  DirectHandle<Object> saved_continuation_preserved_embedder_data(
+      isolate->isolate_data()->continuation_preserved_embedder_data(), isolate);
+  isolate->isolate_data()->set_continuation_preserved_embedder_data(
+      finalization_registry->continuation_preserved_embedder_data());
+#endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
   InvokeFinalizationRegistryCleanupFromTask(native_context,
                                             finalization_registry, callback);
+#ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
+  isolate->isolate_data()->set_continuation_preserved_embedder_data(
+      *saved_continuation_preserved_embedder_data);
+#endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
   if (finalization_registry->NeedsCleanup() &&
       !finalization_registry->scheduled_for_cleanup()) {
     auto nop = [](Tagged<HeapObject>, ObjectSlot, Tagged<Object>) {};
@@ -0,0 +1,78 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-latency-histograms.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+size_t GCLatencyHistograms::BucketIndex(int64_t value_in_us) {
+  if (value_in_us < static_cast<int64_t>(kSubBuckets)) {
+    return static_cast<size_t>(std::max<int64_t>(value_in_us, 0));
+  }
+  const uint64_t value = static_cast<uint64_t>(value_in_us);
+  if (value >= (uint64_t{1} << kMaxValueBits)) return kNumBuckets - 1;
+  const int msb = 63 - base::bits::CountLeadingZeros64(value);
+  const int shift = msb - kSubBucketBits;
+  const size_t index = (shift + 1) * kSubBuckets +
+                       ((value >> shift) & (kSubBuckets - 1));
+  DCHECK_LT(index, kNumBuckets);
+  return index;
+}
+
+// static
+int64_t GCLatencyHistograms::BucketLowerBound(size_t index) {
+  DCHECK_LT(index, kNumBuckets);
+  if (index < kSubBuckets) return static_cast<int64_t>(index);
+  return static_cast<int64_t>(kSubBuckets + index % kSubBuckets)
+         << (index / kSubBuckets - 1);
+}
+
+void GCLatencyHistograms::AddSample(Phase phase, Thread thread,
+                                    base::TimeDelta duration) {
+  const size_t phase_index = static_cast<size_t>(phase);
+  DCHECK_LT(phase_index, kNumPhases);
+  const int64_t duration_in_us = duration.InMicroseconds();
+  Histogram& histogram = thread == Thread::kMainThread
+                             ? main_thread_[phase_index]
+                             : background_[phase_index];
+  histogram.bucket_counts[BucketIndex(duration_in_us)]++;
+  histogram.total_count++;
+  histogram.total_duration_in_us += duration_in_us;
+  histogram.max_duration_in_us =
+      std::max(histogram.max_duration_in_us, duration_in_us);
+}
+
+void GCLatencyHistograms::CopyTo(
+    v8::metrics::GarbageCollectionLatencyHistograms* result) const {
+  DCHECK_NOT_NULL(result);
+  result->bucket_lower_bounds_in_us.resize(kNumBuckets);
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    result->bucket_lower_bounds_in_us[i] = BucketLowerBound(i);
+  }
+  for (size_t phase = 0; phase < kNumPhases; ++phase) {
+    CopyHistogram(main_thread_[phase], &result->main_thread[phase]);
+    CopyHistogram(background_[phase], &result->background[phase]);
+  }
+}
+
+// static
+void GCLatencyHistograms::CopyHistogram(
+    const Histogram& histogram,
+    v8::metrics::GarbageCollectionLatencyHistograms::Histogram* result) {
+  result->bucket_counts.assign(histogram.bucket_counts.begin(),
+                               histogram.bucket_counts.end());
+  result->total_count = histogram.total_count;
+  result->total_duration_in_us = histogram.total_duration_in_us;
+  result->max_duration_in_us = histogram.max_duration_in_us;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_GC_LATENCY_HISTOGRAMS_H_
+#define V8_HEAP_GC_LATENCY_HISTOGRAMS_H_
+
+#include <array>
+#include <cstdint>
+
+#include "include/v8-metrics.h"
+#include "src/base/macros.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace internal {
+
+// Latency histograms of the phases of full garbage collection cycles, split
+// into main thread and background durations. Durations are recorded in
+// microseconds into log-linear (HDR-style) buckets: values below kSubBuckets
+// get a bucket each, larger values are split into kSubBuckets linear buckets
+// per power of two. This bounds the relative error of a bucket to
+// 1 / kSubBuckets while using a fixed amount of memory.
+//
+// Only used from the main thread.
+class V8_EXPORT_PRIVATE GCLatencyHistograms final {
+ public:
+  using Phase = v8::metrics::GarbageCollectionLatencyHistograms::Phase;
+  enum class Thread : uint8_t { kMainThread, kBackground };
+
+  static constexpr size_t kNumPhases =
+      v8::metrics::GarbageCollectionLatencyHistograms::kNumPhases;
+  static constexpr int kSubBucketBits = 3;
+  static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+  // Durations of 2^kMaxValueBits us (~134s) and above are recorded in the last
+  // bucket.
+  static constexpr int kMaxValueBits = 27;
+  static constexpr size_t kNumBuckets =
+      (kMaxValueBits - kSubBucketBits + 1) * kSubBuckets;
+
+  static size_t BucketIndex(int64_t value_in_us);
+  static int64_t BucketLowerBound(size_t index);
+
+  void AddSample(Phase phase, Thread thread, base::TimeDelta duration);
+
+  void CopyTo(v8::metrics::GarbageCollectionLatencyHistograms* result) const;
+
+ private:
+  struct Histogram {
+    std::array<uint32_t, kNumBuckets> bucket_counts{};
+    uint64_t total_count = 0;
+    int64_t total_duration_in_us = 0;
+    int64_t max_duration_in_us = 0;
+  };
+
+  static void CopyHistogram(
+      const Histogram& histogram,
+      v8::metrics::GarbageCollectionLatencyHistograms::Histogram* result);
+
+  std::array<Histogram, kNumPhases> main_thread_;
+  std::array<Histogram, kNumPhases> background_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_GC_LATENCY_HISTOGRAMS_H_
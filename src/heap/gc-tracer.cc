@@ -263,6 +263,11 @@ void GCTracer::StartCycle(GarbageCollector collector,
 
   previous_ = current_;
   current_ = Event(type, Event::State::MARKING, gc_reason, collector_reason);
+  if (collector == GarbageCollector::MARK_COMPACTOR) {
+    current_.recompiled_after_bytecode_flush_count =
+        recompiled_after_bytecode_flush_count_.exchange(
+            0, std::memory_order_relaxed);
+  }
 
   switch (marking) {
     case MarkingType::kAtomic:
@@ -474,6 +479,7 @@ void GCTracer::StopCycle(GarbageCollector collector) {
       young_gc_while_full_gc_ = false;
     }
   } else {
+    RecordLatencyHistograms();
     ReportFullCycleToRecorder();
 
     heap_->isolate()->counters()->mark_compact_reason()->AddSample(
@@ -487,6 +493,33 @@ void GCTracer::StopCycle(GarbageCollector collector) {
   }
 }
 
+void GCTracer::RecordLatencyHistograms() {
+  using Phase = GCLatencyHistograms::Phase;
+  using Thread = GCLatencyHistograms::Thread;
+  latency_histograms_.AddSample(Phase::kRootMarking, Thread::kMainThread,
+                                current_.scopes[Scope::MC_MARK_ROOTS]);
+  latency_histograms_.AddSample(Phase::kWeakProcessing, Thread::kMainThread,
+                                current_.scopes[Scope::MC_CLEAR]);
+  latency_histograms_.AddSample(Phase::kEvacuation, Thread::kMainThread,
+                                current_.scopes[Scope::MC_EVACUATE_COPY]);
+  latency_histograms_.AddSample(
+      Phase::kRememberedSetUpdate, Thread::kMainThread,
+      current_.scopes[Scope::MC_EVACUATE_UPDATE_POINTERS]);
+  latency_histograms_.AddSample(
+      Phase::kSweeping, Thread::kMainThread,
+      current_.scopes[Scope::MC_SWEEP] +
+          current_.incremental_scopes[Scope::MC_INCREMENTAL_SWEEPING].duration);
+  // Root marking and weak processing only happen on the main thread.
+  latency_histograms_.AddSample(
+      Phase::kEvacuation, Thread::kBackground,
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY]);
+  latency_histograms_.AddSample(
+      Phase::kRememberedSetUpdate, Thread::kBackground,
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS]);
+  latency_histograms_.AddSample(Phase::kSweeping, Thread::kBackground,
+                                current_.scopes[Scope::MC_BACKGROUND_SWEEPING]);
+}
+
 void GCTracer::StopFullCycleIfNeeded() {
   if (current_.state != Event::State::SWEEPING) return;
   if (!notified_full_sweeping_completed_) return;
@@ -651,6 +684,29 @@ void GCTracer::SampleConcurrencyEsimate(size_t concurrency) {
   current_.concurrency_estimate = concurrency;
 }
 
+void GCTracer::AddWorkStealingStats(size_t steals, size_t idle_events) {
+  base::MutexGuard guard(&background_scopes_mutex_);
+  background_work_stealing_steals_ += steals;
+  background_work_stealing_idle_events_ += idle_events;
+}
+
+void GCTracer::NotifyBytecodeFlushed(size_t bytes) {
+  DCHECK(!Event::IsYoungGenerationEvent(current_.type));
+  current_.flushed_bytecode_count++;
+  current_.flushed_bytecode_bytes += bytes;
+}
+
+void GCTracer::NotifyBaselineCodeFlushed(size_t bytes) {
+  DCHECK(!Event::IsYoungGenerationEvent(current_.type));
+  current_.flushed_baseline_code_count++;
+  current_.flushed_baseline_code_bytes += bytes;
+}
+
+void GCTracer::NotifyRecompileAfterBytecodeFlush() {
+  recompiled_after_bytecode_flush_count_.fetch_add(1,
+                                                   std::memory_order_relaxed);
+}
+
 void GCTracer::NotifyMarkingStart() {
   const auto marking_start = base::TimeTicks::Now();
 
@@ -710,6 +766,10 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   ReportIncrementalMarkingStepToRecorder(duration);
 }
 
+void GCTracer::RecordIncrementalMarkingMutatorUtilization(double utilization) {
+  current_.incremental_marking_mutator_utilization = utilization;
+}
+
 void GCTracer::AddIncrementalSweepingStep(double duration) {
   ReportIncrementalSweepingStepToRecorder(duration);
 }
@@ -845,7 +905,9 @@ void GCTracer::PrintNVP() const {
           "promotion_rate=%.1f%% "
           "new_space_survive_rate_=%.1f%% "
           "new_space_allocation_throughput=%.1f "
-          "pool_chunks=%zu\n",
+          "pool_chunks=%zu "
+          "work_stealing.steals=%zu "
+          "work_stealing.idle=%zu\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
           young_gc_while_full_gc_,
@@ -880,7 +942,8 @@ void GCTracer::PrintNVP() const {
           AverageSurvivalRatio(), heap_->promotion_rate_,
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
-          heap_->memory_allocator()->pool()->NumberOfCommittedChunks());
+          heap_->memory_allocator()->pool()->NumberOfCommittedChunks(),
+          current_.work_stealing_steals, current_.work_stealing_idle_events);
       break;
     case Event::Type::MINOR_MARK_SWEEPER:
     case Event::Type::INCREMENTAL_MINOR_MARK_SWEEPER:
@@ -1001,6 +1064,7 @@ void GCTracer::PrintNVP() const {
           "clear.weak_references_non_trivial=%.1f "
           "clear.weak_references_filter_non_trivial=%.1f "
           "clear.js_weak_references=%.1f "
+          "clear.js_weak_references_filter=%.1f "
           "clear.join_filter_job=%.1f"
           "clear.join_job=%.1f "
           "weakness_handling=%.1f "
@@ -1071,7 +1135,15 @@ void GCTracer::PrintNVP() const {
           "new_space_survive_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "pool_chunks=%zu "
-          "compaction_speed=%.f\n",
+          "compaction_speed=%.f "
+          "work_stealing.steals=%zu "
+          "work_stealing.idle=%zu "
+          "flushed_bytecode=%zu "
+          "flushed_bytecode_bytes=%zu "
+          "flushed_baseline_code=%zu "
+          "flushed_baseline_code_bytes=%zu "
+          "recompiled_after_bytecode_flush=%zu "
+          "incremental_marking_mmu=%.3f\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
           current_scope(Scope::TIME_TO_SAFEPOINT),
@@ -1095,6 +1167,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MC_CLEAR_WEAK_REFERENCES_NON_TRIVIAL),
           current_scope(Scope::MC_CLEAR_WEAK_REFERENCES_FILTER_NON_TRIVIAL),
           current_scope(Scope::MC_CLEAR_JS_WEAK_REFERENCES),
+          current_scope(Scope::MC_CLEAR_JS_WEAK_REFERENCES_FILTER),
           current_scope(Scope::MC_CLEAR_WEAK_REFERENCES_JOIN_FILTER_JOB),
           current_scope(Scope::MC_CLEAR_JOIN_JOB),
           current_scope(Scope::MC_WEAKNESS_HANDLING),
@@ -1159,7 +1232,13 @@ void GCTracer::PrintNVP() const {
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->pool()->NumberOfCommittedChunks(),
-          CompactionSpeedInBytesPerMillisecond());
+          CompactionSpeedInBytesPerMillisecond(),
+          current_.work_stealing_steals, current_.work_stealing_idle_events,
+          current_.flushed_bytecode_count, current_.flushed_bytecode_bytes,
+          current_.flushed_baseline_code_count,
+          current_.flushed_baseline_code_bytes,
+          current_.recompiled_after_bytecode_flush_count,
+          current_.incremental_marking_mutator_utilization);
       break;
     case Event::Type::START:
       break;
@@ -1382,6 +1461,10 @@ void GCTracer::FetchBackgroundCounters() {
     current_.scopes[i] += background_scopes_[i];
     background_scopes_[i] = base::TimeDelta();
   }
+  current_.work_stealing_steals += background_work_stealing_steals_;
+  current_.work_stealing_idle_events += background_work_stealing_idle_events_;
+  background_work_stealing_steals_ = 0;
+  background_work_stealing_idle_events_ = 0;
 }
 
 namespace {
@@ -1533,6 +1616,22 @@ void FlushBatchedEvents(
 
 }  // namespace
 
+void GCTracer::ReportAllocationLimitsToRecorder(
+    double target_mutator_utilization, double growing_factor) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+  v8::metrics::GarbageCollectionLimits event;
+  event.target_mutator_utilization = target_mutator_utilization;
+  event.growing_factor = growing_factor;
+  event.old_generation_allocation_limit_in_bytes =
+      heap_->old_generation_allocation_limit();
+  event.global_allocation_limit_in_bytes = heap_->global_allocation_limit();
+  event.young_generation_capacity_in_bytes = heap_->NewSpaceTargetCapacity();
+  recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+}
+
 void GCTracer::ReportFullCycleToRecorder() {
   DCHECK(!Event::IsYoungGenerationEvent(current_.type));
   DCHECK_EQ(Event::State::NOT_RUNNING, current_.state);
@@ -1604,6 +1703,8 @@ void GCTracer::ReportFullCycleToRecorder() {
     }
   }
 
+  heap_->slow_path_counters()->ReportFullCycle(&event.slow_paths);
+
   // Unified heap statistics:
   const base::TimeDelta atomic_pause_duration =
       current_.scopes[Scope::MARK_COMPACTOR];
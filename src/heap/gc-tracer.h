@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <atomic>
 #include <optional>
 
 #include "include/v8-metrics.h"
@@ -13,6 +14,7 @@
 #include "src/base/ring-buffer.h"
 #include "src/common/globals.h"
 #include "src/heap/base/bytes.h"
+#include "src/heap/gc-latency-histograms.h"
 #include "src/init/heap-symbols.h"
 #include "src/logging/counters.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
@@ -226,6 +228,27 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Approximate number of threads that contributed in garbage collection.
     size_t concurrency_estimate = 1;
 
+    // Work stealing statistics accumulated over all parallel GC threads, see
+    // --gc-work-stealing.
+    size_t work_stealing_steals = 0;
+    size_t work_stealing_idle_events = 0;
+
+    // Number and size of the BytecodeArrays flushed by a full GC.
+    size_t flushed_bytecode_count = 0;
+    size_t flushed_bytecode_bytes = 0;
+
+    // Number and size of the baseline code objects flushed by a full GC.
+    size_t flushed_baseline_code_count = 0;
+    size_t flushed_baseline_code_bytes = 0;
+
+    // Number of functions compiled again after their bytecode was flushed
+    // since the previous full GC, see --adaptive-bytecode-flushing.
+    size_t recompiled_after_bytecode_flush_count = 0;
+
+    // Lowest mutator utilization observed during incremental marking, see
+    // --incremental-marking-mmu-window. 1.0 if not configured.
+    double incremental_marking_mutator_utilization = 1.0;
+
     // Duration (in ms) of incremental marking steps for
     // INCREMENTAL_MARK_COMPACTOR.
     base::TimeDelta incremental_marking_duration;
@@ -339,8 +362,29 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void SampleConcurrencyEsimate(size_t concurrency);
 
+  // Reports the outcome of recomputing the allocation limits after a full GC
+  // to the embedder's metrics recorder.
+  void ReportAllocationLimitsToRecorder(double target_mutator_utilization,
+                                        double growing_factor);
+
+  // Accumulates the work stealing statistics of a single parallel GC thread.
+  // May be called from background threads.
+  void AddWorkStealingStats(size_t steals, size_t idle_events);
+
+  // Records the size of a BytecodeArray flushed by the current full GC.
+  void NotifyBytecodeFlushed(size_t bytes);
+
+  // Records the size of baseline code flushed by the current full GC.
+  void NotifyBaselineCodeFlushed(size_t bytes);
+
+  // Records that a function had to be compiled again after its bytecode was
+  // flushed, see --adaptive-bytecode-flushing. May be called from background
+  // threads.
+  void NotifyRecompileAfterBytecodeFlush();
+
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
+  void RecordIncrementalMarkingMutatorUtilization(double utilization);
 
   // Log an incremental marking step.
   void AddIncrementalSweepingStep(double duration);
@@ -459,6 +503,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   GarbageCollector GetCurrentCollector() const;
 
+  const GCLatencyHistograms& latency_histograms() const {
+    return latency_histograms_;
+  }
+
  private:
   using BytesAndDurationBuffer = ::heap::base::BytesAndDurationBuffer;
 
@@ -502,6 +550,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundCounters();
 
   void ReportFullCycleToRecorder();
+  // Adds the phase durations of the current full cycle to
+  // `latency_histograms_`.
+  void RecordLatencyHistograms();
   void ReportIncrementalMarkingStepToRecorder(double v8_duration);
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
   void ReportYoungCycleToRecorder();
@@ -571,6 +622,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   BytesAndDurationBuffer recorded_minor_gc_atomic_pause_;
   base::RingBuffer<double> recorded_survival_ratios_;
 
+  GCLatencyHistograms latency_histograms_;
+
   // A full GC cycle stops only when both v8 and cppgc (if available) GCs have
   // finished sweeping.
   bool notified_full_sweeping_completed_ = false;
@@ -597,6 +650,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   mutable base::Mutex background_scopes_mutex_;
   base::TimeDelta background_scopes_[Scope::NUMBER_OF_SCOPES];
+  size_t background_work_stealing_steals_ = 0;
+  size_t background_work_stealing_idle_events_ = 0;
+
+  std::atomic<size_t> recompiled_after_bytecode_flush_count_{0};
 
   FRIEND_TEST(GCTracerTest, AllocationThroughput);
   FRIEND_TEST(GCTracerTest, BackgroundScavengerScope);
@@ -611,6 +668,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
+  FRIEND_TEST(GCTracerTest, LatencyHistograms);
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
@@ -333,6 +333,23 @@ void HeapAllocator::ResumeAllocationObservers() {
   code_space_allocator_->ResumeAllocationObservers();
 }
 
+void HeapAllocator::AdvanceAllocationObservers() {
+  if (new_space_allocator_) {
+    new_space_allocator_->AdvanceAllocationObservers();
+  }
+  old_space_allocator_->AdvanceAllocationObservers();
+  trusted_space_allocator_->AdvanceAllocationObservers();
+  code_space_allocator_->AdvanceAllocationObservers();
+
+  if (shared_space_allocator_) {
+    shared_space_allocator_->AdvanceAllocationObservers();
+  }
+
+  if (shared_trusted_space_allocator_) {
+    shared_trusted_space_allocator_->AdvanceAllocationObservers();
+  }
+}
+
 #ifdef DEBUG
 
 void HeapAllocator::IncrementObjectCounters() {
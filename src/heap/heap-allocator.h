@@ -112,6 +112,9 @@ class V8_EXPORT_PRIVATE HeapAllocator final {
 
   void PauseAllocationObservers();
   void ResumeAllocationObservers();
+  // Accounts the bytes allocated in the current LABs so far, as if the LABs
+  // were retired.
+  void AdvanceAllocationObservers();
 
   void PublishPendingAllocations();
 
@@ -4,6 +4,8 @@
 
 #include "src/heap/heap-controller.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate-inl.h"
 #include "src/heap/spaces.h"
 #include "src/tracing/trace-event.h"
@@ -16,18 +18,40 @@ double MemoryController<Trait>::GrowingFactor(Heap* heap, size_t max_heap_size,
                                               double gc_speed,
                                               double mutator_speed) {
   const double max_factor = MaxGrowingFactor(max_heap_size);
-  const double factor =
-      DynamicGrowingFactor(gc_speed, mutator_speed, max_factor);
+  const double target_mutator_utilization = TargetMutatorUtilization(heap);
+  const double factor = DynamicGrowingFactor(gc_speed, mutator_speed,
+                                             max_factor,
+                                             target_mutator_utilization);
   if (v8_flags.trace_gc_verbose) {
     Isolate::FromHeap(heap)->PrintWithTimestamp(
         "[%s] factor %.1f based on mu=%.3f, speed_ratio=%.f "
         "(gc=%.f, mutator=%.f)\n",
-        Trait::kName, factor, Trait::kTargetMutatorUtilization,
+        Trait::kName, factor, target_mutator_utilization,
         gc_speed / mutator_speed, gc_speed, mutator_speed);
   }
   return factor;
 }
 
+template <typename Trait>
+double MemoryController<Trait>::TargetMutatorUtilization(Heap* heap) {
+  const double budget = heap->gc_pause_budget_in_ms_per_second();
+  if (budget <= 0) return Trait::kTargetMutatorUtilization;
+  return TargetMutatorUtilizationFromPauseBudget(budget);
+}
+
+// A budget of B ms of GC time per second of wall time corresponds to a
+// mutator utilization of 1 - B / 1000. The result is clamped to keep the
+// growing factor computation well-defined for extreme budgets.
+template <typename Trait>
+double MemoryController<Trait>::TargetMutatorUtilizationFromPauseBudget(
+    double pause_budget_in_ms_per_second) {
+  constexpr double kMinTargetMutatorUtilization = 0.5;
+  constexpr double kMaxTargetMutatorUtilization = 0.999;
+  const double mu = 1.0 - pause_budget_in_ms_per_second / 1000.0;
+  return std::clamp(mu, kMinTargetMutatorUtilization,
+                    kMaxTargetMutatorUtilization);
+}
+
 template <typename Trait>
 double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
   constexpr double kMinSmallFactor = 1.3;
@@ -92,18 +116,20 @@ double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
 //   F * (R * (1 - MU) - MU) / (R * (1 - MU)) = 1
 //   F = R * (1 - MU) / (R * (1 - MU) - MU)
 template <typename Trait>
-double MemoryController<Trait>::DynamicGrowingFactor(double gc_speed,
-                                                     double mutator_speed,
-                                                     double max_factor) {
+double MemoryController<Trait>::DynamicGrowingFactor(
+    double gc_speed, double mutator_speed, double max_factor,
+    double target_mutator_utilization) {
   DCHECK_LE(Trait::kMinGrowingFactor, max_factor);
   DCHECK_GE(Trait::kMaxGrowingFactor, max_factor);
+  DCHECK_LT(0, target_mutator_utilization);
+  DCHECK_GT(1, target_mutator_utilization);
   if (gc_speed == 0 || mutator_speed == 0) return max_factor;
 
   const double speed_ratio = gc_speed / mutator_speed;
 
-  const double a = speed_ratio * (1 - Trait::kTargetMutatorUtilization);
-  const double b = speed_ratio * (1 - Trait::kTargetMutatorUtilization) -
-                   Trait::kTargetMutatorUtilization;
+  const double a = speed_ratio * (1 - target_mutator_utilization);
+  const double b =
+      speed_ratio * (1 - target_mutator_utilization) - target_mutator_utilization;
 
   // The factor is a / b, but we need to check for small b first.
   double factor = (a < b * max_factor) ? a / b : max_factor;
@@ -41,6 +41,10 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   static double GrowingFactor(Heap* heap, size_t max_heap_size, double gc_speed,
                               double mutator_speed);
 
+  // Returns the mutator utilization the controller aims for. If a GC pause
+  // budget is configured, the target is derived from it.
+  static double TargetMutatorUtilization(Heap* heap);
+
   static size_t CalculateAllocationLimit(Heap* heap, size_t current_size,
                                          size_t min_size, size_t max_size,
                                          size_t new_space_capacity,
@@ -49,10 +53,14 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
 
  private:
   static double MaxGrowingFactor(size_t max_heap_size);
-  static double DynamicGrowingFactor(double gc_speed, double mutator_speed,
-                                     double max_factor);
+  static double DynamicGrowingFactor(
+      double gc_speed, double mutator_speed, double max_factor,
+      double target_mutator_utilization = Trait::kTargetMutatorUtilization);
+  static double TargetMutatorUtilizationFromPauseBudget(
+      double pause_budget_in_ms_per_second);
 
   FRIEND_TEST(MemoryControllerTest, HeapGrowingFactor);
+  FRIEND_TEST(MemoryControllerTest, HeapGrowingFactorWithPauseBudget);
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
@@ -179,6 +179,16 @@ void Heap::SetFunctionsMarkedForManualOptimization(Tagged<Object> hash_table) {
       hash_table.ptr();
 }
 
+void Heap::SetDeoptHistoryTable(Tagged<Object> hash_table) {
+  DCHECK(IsEphemeronHashTable(hash_table) || IsUndefined(hash_table, isolate()));
+  roots_table()[RootIndex::kDeoptHistoryTable] = hash_table.ptr();
+}
+
+void Heap::SetDictionaryToFastMapCache(Tagged<Object> cache) {
+  DCHECK(IsWeakFixedArray(cache) || IsUndefined(cache, isolate()));
+  roots_table()[RootIndex::kDictionaryToFastMapCache] = cache.ptr();
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 void Heap::SetWasmCanonicalRtts(Tagged<WeakArrayList> value) {
   set_wasm_canonical_rtts(value);
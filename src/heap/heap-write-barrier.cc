@@ -9,6 +9,7 @@
 #include "src/heap/memory-chunk-layout.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/remembered-set.h"
+#include "src/heap/slow-path-counters.h"
 #include "src/objects/code-inl.h"
 #include "src/objects/descriptor-array.h"
 #include "src/objects/js-objects.h"
@@ -21,6 +22,11 @@ namespace internal {
 
 namespace {
 thread_local MarkingBarrier* current_marking_barrier = nullptr;
+
+void RecordMarkingSlowPath(MarkingBarrier* marking_barrier) {
+  SlowPathCounters::RecordWriteBarrier(
+      marking_barrier->heap(), SlowPathCounters::WriteBarrierKind::kMarking);
+}
 }  // namespace
 
 bool HeapObjectInYoungGenerationSticky(MemoryChunk* chunk,
@@ -57,12 +63,14 @@ MarkingBarrier* WriteBarrier::SetForThread(MarkingBarrier* marking_barrier) {
 void WriteBarrier::MarkingSlow(Tagged<HeapObject> host, HeapObjectSlot slot,
                                Tagged<HeapObject> value) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(host, slot, value);
 }
 
 // static
 void WriteBarrier::MarkingSlowFromGlobalHandle(Tagged<HeapObject> value) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(value);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->WriteWithoutHost(value);
 }
 
@@ -77,6 +85,7 @@ void WriteBarrier::MarkingSlow(Tagged<InstructionStream> host,
                                RelocInfo* reloc_info,
                                Tagged<HeapObject> value) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(host, reloc_info, value);
 }
 
@@ -84,6 +93,8 @@ void WriteBarrier::SharedSlow(Tagged<InstructionStream> host,
                               RelocInfo* reloc_info, Tagged<HeapObject> value) {
   MarkCompactCollector::RecordRelocSlotInfo info =
       MarkCompactCollector::ProcessRelocInfo(host, reloc_info, value);
+  SlowPathCounters::RecordWriteBarrier(
+      info.page_metadata->heap(), SlowPathCounters::WriteBarrierKind::kShared);
 
   base::MutexGuard write_scope(info.page_metadata->mutex());
   RememberedSet<OLD_TO_SHARED>::InsertTyped(info.page_metadata, info.slot_type,
@@ -96,6 +107,9 @@ void WriteBarrier::Shared(Tagged<TrustedObject> host, ProtectedPointerSlot slot,
   if (!MemoryChunk::FromHeapObject(host)->InWritableSharedSpace()) {
     MutablePageMetadata* host_chunk_metadata =
         MutablePageMetadata::FromHeapObject(host);
+    SlowPathCounters::RecordWriteBarrier(
+        host_chunk_metadata->heap(),
+        SlowPathCounters::WriteBarrierKind::kShared);
     RememberedSet<TRUSTED_TO_SHARED_TRUSTED>::Insert<AccessMode::NON_ATOMIC>(
         host_chunk_metadata, host_chunk_metadata->Offset(slot.address()));
   }
@@ -104,18 +118,21 @@ void WriteBarrier::Shared(Tagged<TrustedObject> host, ProtectedPointerSlot slot,
 void WriteBarrier::MarkingSlow(Tagged<JSArrayBuffer> host,
                                ArrayBufferExtension* extension) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(host, extension);
 }
 
 void WriteBarrier::MarkingSlow(Tagged<DescriptorArray> descriptor_array,
                                int number_of_own_descriptors) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(descriptor_array);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(descriptor_array, number_of_own_descriptors);
 }
 
 void WriteBarrier::MarkingSlow(Tagged<HeapObject> host,
                                IndirectPointerSlot slot) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(host, slot);
 }
 
@@ -123,6 +140,7 @@ void WriteBarrier::MarkingSlow(Tagged<TrustedObject> host,
                                ProtectedPointerSlot slot,
                                Tagged<TrustedObject> value) {
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   marking_barrier->Write(host, slot, value);
 }
 
@@ -137,6 +155,7 @@ void WriteBarrier::MarkingSlow(Tagged<HeapObject> host,
   static_assert(!JSDispatchTable::kSupportsCompaction);
 
   MarkingBarrier* marking_barrier = CurrentMarkingBarrier(host);
+  RecordMarkingSlowPath(marking_barrier);
   if (GetProcessWideJSDispatchTable()->HasCode(handle)) {
     Tagged<Code> value = GetProcessWideJSDispatchTable()->GetCode(handle);
     marking_barrier->MarkValue(host, value);
@@ -96,6 +96,7 @@
 #include "src/init/bootstrapper.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
@@ -106,6 +107,7 @@
 #include "src/objects/instance-type.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/objects.h"
+#include "src/objects/script-inl.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
@@ -1107,6 +1109,31 @@ size_t Heap::NewSpaceAllocationCounter() {
   return counter;
 }
 
+void Heap::SetLoadHint(v8::LoadHint hint) {
+  load_hint_ = hint;
+  if (memory_reducer_) memory_reducer_->NotifyLoadHint(hint);
+}
+
+uint32_t Heap::SetAllocationPhase(uint32_t phase) {
+  const uint32_t previous_phase = allocation_phase_tracker_.current_phase();
+  if (phase == previous_phase) return previous_phase;
+  // Account what the current LABs allocated so far to the previous phase.
+  allocator()->AdvanceAllocationObservers();
+  // Outside of GC the counter also includes the unused part of the current
+  // LAB, which is negligible for the phase statistics.
+  const size_t counter =
+      new_space_allocation_counter_ +
+      (new_space_ ? new_space_->AllocatedSinceLastGC() : 0);
+  allocation_phase_tracker_.SetPhase(phase, counter);
+  return previous_phase;
+}
+
+std::vector<std::pair<uint32_t, size_t>>
+Heap::AllocatedBytesPerAllocationPhase() {
+  allocator()->AdvanceAllocationObservers();
+  return allocation_phase_tracker_.AllocatedBytesPerPhase();
+}
+
 size_t Heap::SizeOfObjects() {
   size_t total = 0;
 
@@ -1263,7 +1290,7 @@ void Heap::GarbageCollectionEpilogueInSafepoint(GarbageCollector collector) {
     if (ShouldReduceMemory()) {
       memory_allocator_->pool()->ReleasePooledChunks();
 #if V8_ENABLE_WEBASSEMBLY
-      isolate_->stack_pool().ReleaseFinishedStacks();
+      isolate_->stack_pool().ReleaseFinishedStacks(isolate_);
 #endif
     }
   }
@@ -1488,6 +1515,7 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
   isolate()->ClearSerializerData();
   isolate()->compilation_cache()->Clear();
+  FlushScriptLineEnds();
 
   const GCFlags gc_flags =
       GCFlag::kReduceMemoryFootprint |
@@ -2222,6 +2250,7 @@ void Heap::UpdateSurvivalStatistics(int start_new_space_size) {
 
   double survival_rate = promotion_ratio_ + new_space_surviving_rate_;
   tracer()->AddSurvivalRatio(survival_rate);
+  allocation_phase_tracker_.NotifyGarbageCollection(survival_rate);
 }
 
 namespace {
@@ -2339,6 +2368,7 @@ void Heap::PerformGarbageCollection(GarbageCollector collector,
   }
 
   pretenuring_handler_.ProcessPretenuringFeedback(new_space_capacity_before_gc);
+  pretenuring_handler_.ProcessParseFeedback();
 
   UpdateSurvivalStatistics(static_cast<int>(start_young_generation_size));
   ShrinkOldGenerationAllocationLimitIfNotConfigured();
@@ -2569,7 +2599,8 @@ Heap::LimitsCompuatationResult Heap::ComputeNewAllocationLimits(Heap* heap) {
           heap->max_global_memory_size_, new_space_capacity,
           global_growing_factor, mode);
 
-  return {new_old_generation_allocation_limit, new_global_allocation_limit};
+  return {new_old_generation_allocation_limit, new_global_allocation_limit,
+          v8_growing_factor};
 }
 
 void Heap::RecomputeLimits(GarbageCollector collector, base::TimeTicks time) {
@@ -2601,6 +2632,10 @@ void Heap::RecomputeLimits(GarbageCollector collector, base::TimeTicks time) {
     CheckIneffectiveMarkCompact(
         OldGenerationConsumedBytes(),
         tracer()->AverageMarkCompactMutatorUtilization());
+
+    tracer()->ReportAllocationLimitsToRecorder(
+        MemoryController<V8HeapTrait>::TargetMutatorUtilization(this),
+        new_limits.v8_growing_factor);
   } else {
     DCHECK(HasLowYoungGenerationAllocationRate() &&
            old_generation_allocation_limit_configured());
@@ -2729,8 +2764,10 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  JsonObjectMapCache::Clear(json_object_map_cache());
 
   FlushNumberStringCache();
 }
@@ -3231,6 +3268,20 @@ void Heap::FlushNumberStringCache() {
   }
 }
 
+void Heap::FlushScriptLineEnds() {
+  // Line ends take a Smi per source line and are kept alive as long as the
+  // script is, even though they are usually only needed for a few stack
+  // traces. Keep them if positions are needed eagerly, e.g. for profiling.
+  if (!v8_flags.flush_script_line_ends) return;
+  if (isolate()->NeedsSourcePositions()) return;
+  Script::Iterator it(isolate());
+  for (Tagged<Script> script = it.Next(); !script.is_null();
+       script = it.Next()) {
+    if (!script->CanHaveLineEnds() || !script->has_line_ends()) continue;
+    script->set_line_ends(Smi::zero(), SKIP_WRITE_BARRIER);
+  }
+}
+
 namespace {
 
 void CreateFillerObjectAtImpl(const WritableFreeSpace& free_space, Heap* heap,
@@ -3883,11 +3934,16 @@ void Heap::ActivateMemoryReducerIfNeededOnMainThread() {
 }
 
 Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
-  if (ShouldReduceMemory()) {
+  if (ShouldReduceMemory() || load_hint_ == v8::LoadHint::kIdle) {
     return (v8_flags.predictable) ? ResizeNewSpaceMode::kNone
                                   : ResizeNewSpaceMode::kShrink;
   }
 
+  if (const auto mode = ShouldResizeNewSpaceForAllocationPhase()) {
+    if (*mode == ResizeNewSpaceMode::kGrow) survived_since_last_expansion_ = 0;
+    return *mode;
+  }
+
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
@@ -3905,6 +3961,33 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
 }
 
+std::optional<Heap::ResizeNewSpaceMode>
+Heap::ShouldResizeNewSpaceForAllocationPhase() const {
+  if (!v8_flags.new_space_sizing_per_allocation_phase || v8_flags.predictable) {
+    return {};
+  }
+  const std::optional<size_t> expected_allocation =
+      allocation_phase_tracker_.ExpectedAllocationForCurrentPhase();
+  if (!expected_allocation) return {};
+  const size_t capacity = new_space_->TotalCapacity();
+  if (*expected_allocation > capacity) {
+    // Growing only pays off when most of the phase's allocations die young.
+    // Otherwise they are promoted regardless of the new space size.
+    static constexpr double kMaxSurvivalRateForGrowing = 50.0;
+    const std::optional<double> survival_rate =
+        allocation_phase_tracker_.SurvivalRateForCurrentPhase();
+    if (capacity >= new_space_->MaximumCapacity() ||
+        survival_rate.value_or(0.0) > kMaxSurvivalRateForGrowing) {
+      return ResizeNewSpaceMode::kNone;
+    }
+    return ResizeNewSpaceMode::kGrow;
+  }
+  if (*expected_allocation < capacity / 2) {
+    return ResizeNewSpaceMode::kShrink;
+  }
+  return ResizeNewSpaceMode::kNone;
+}
+
 void Heap::ExpandNewSpaceSize() {
   // Grow the size of new space if there is room to grow, and enough data
   // has survived scavenge since the last expansion.
@@ -4179,6 +4262,7 @@ void Heap::CollectGarbageOnMemoryPressure() {
   const double kMaxMemoryPressurePauseMs = 100;
 
   double start = MonotonicallyIncreasingTimeInMs();
+  FlushScriptLineEnds();
   CollectAllGarbage(GCFlag::kReduceMemoryFootprint,
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
@@ -4214,6 +4298,11 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
+  if (level != MemoryPressureLevel::kNone) {
+    // Zone segments that are kept for reuse are freed right away, as the pool
+    // may be used from any thread.
+    isolate()->allocator()->TrimSegmentPool();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -5056,6 +5145,11 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints,
     initial_semispace_size_ = max_semi_space_size_;
   }
 
+  gc_pause_budget_in_ms_per_second_ =
+      v8_flags.gc_pause_budget_in_ms_per_second > 0
+          ? v8_flags.gc_pause_budget_in_ms_per_second
+          : constraints.gc_pause_budget_in_ms_per_second();
+
   // Initialize initial_old_space_size_.
   {
     initial_old_generation_size_ = kMaxInitialOldGenerationSize;
@@ -6434,6 +6528,8 @@ int Heap::InsertIntoRememberedSetFromCode(MutablePageMetadata* chunk,
   // This is called during runtime by a builtin, therefore it is run in the main
   // thread.
   DCHECK_NULL(LocalHeap::Current());
+  SlowPathCounters::RecordWriteBarrier(
+      chunk->heap(), SlowPathCounters::WriteBarrierKind::kGenerational);
   RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot_offset);
   return 0;
 }
@@ -7183,6 +7279,8 @@ void Heap::CombinedGenerationalAndSharedEphemeronBarrierSlow(
   if (HeapObjectInYoungGeneration(value)) {
     MutablePageMetadata* table_chunk =
         MutablePageMetadata::FromHeapObject(table);
+    SlowPathCounters::RecordWriteBarrier(
+        table_chunk->heap(), SlowPathCounters::WriteBarrierKind::kGenerational);
     table_chunk->heap()->RecordEphemeronKeyWrite(table, slot);
 
   } else {
@@ -7196,6 +7294,8 @@ void Heap::GenerationalBarrierSlow(Tagged<HeapObject> object, Address slot,
                                    Tagged<HeapObject> value) {
   MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
   MutablePageMetadata* metadata = MutablePageMetadata::cast(chunk->Metadata());
+  SlowPathCounters::RecordWriteBarrier(
+      metadata->heap(), SlowPathCounters::WriteBarrierKind::kGenerational);
   if (LocalHeap::Current() == nullptr) {
     RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
         metadata, chunk->Offset(slot));
@@ -7208,8 +7308,11 @@ void Heap::GenerationalBarrierSlow(Tagged<HeapObject> object, Address slot,
 void Heap::SharedHeapBarrierSlow(Tagged<HeapObject> object, Address slot) {
   MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
   DCHECK(!chunk->InWritableSharedSpace());
+  MutablePageMetadata* metadata = MutablePageMetadata::cast(chunk->Metadata());
+  SlowPathCounters::RecordWriteBarrier(
+      metadata->heap(), SlowPathCounters::WriteBarrierKind::kShared);
   RememberedSet<OLD_TO_SHARED>::Insert<AccessMode::ATOMIC>(
-      MutablePageMetadata::cast(chunk->Metadata()), chunk->Offset(slot));
+      metadata, chunk->Offset(slot));
 }
 
 void Heap::RecordEphemeronKeyWrite(Tagged<EphemeronHashTable> table,
@@ -7372,6 +7475,9 @@ void Heap::GenerationalBarrierForCodeSlow(Tagged<InstructionStream> host,
   DCHECK(InYoungGeneration(value));
   const MarkCompactCollector::RecordRelocSlotInfo info =
       MarkCompactCollector::ProcessRelocInfo(host, rinfo, value);
+  SlowPathCounters::RecordWriteBarrier(
+      info.page_metadata->heap(),
+      SlowPathCounters::WriteBarrierKind::kGenerational);
 
   base::MutexGuard write_scope(info.page_metadata->mutex());
   RememberedSet<OLD_TO_NEW>::InsertTyped(info.page_metadata, info.slot_type,
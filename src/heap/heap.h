@@ -29,12 +29,14 @@
 #include "src/common/code-memory-access.h"
 #include "src/common/globals.h"
 #include "src/heap/allocation-observer.h"
+#include "src/heap/allocation-phase-tracker.h"
 #include "src/heap/allocation-result.h"
 #include "src/heap/gc-callbacks.h"
 #include "src/heap/heap-allocator.h"
 #include "src/heap/marking-state.h"
 #include "src/heap/minor-gc-job.h"
 #include "src/heap/pretenuring-handler.h"
+#include "src/heap/slow-path-counters.h"
 #include "src/heap/sweeper.h"
 #include "src/init/heap-symbols.h"
 #include "src/objects/allocation-site.h"
@@ -592,6 +594,10 @@ class Heap final {
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // See v8::Isolate::SetLoadHint().
+  V8_EXPORT_PRIVATE void SetLoadHint(v8::LoadHint hint);
+  v8::LoadHint load_hint() const { return load_hint_; }
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -886,6 +892,8 @@ class Heap final {
   V8_INLINE void SetMessageListeners(Tagged<ArrayList> value);
   V8_INLINE void SetFunctionsMarkedForManualOptimization(
       Tagged<Object> bytecode);
+  V8_INLINE void SetDeoptHistoryTable(Tagged<Object> hash_table);
+  V8_INLINE void SetDictionaryToFastMapCache(Tagged<Object> cache);
 
 #if V8_ENABLE_WEBASSEMBLY
   V8_INLINE void SetWasmCanonicalRtts(Tagged<WeakArrayList> value);
@@ -1352,6 +1360,27 @@ class Heap final {
 
   V8_EXPORT_PRIVATE size_t NewSpaceAllocationCounter();
 
+  // Switches the embedder-defined allocation phase of the main thread and
+  // returns the previous phase. See v8::Isolate::AllocationPhaseScope.
+  V8_EXPORT_PRIVATE uint32_t SetAllocationPhase(uint32_t phase);
+
+  const AllocationPhaseTracker& allocation_phase_tracker() const {
+    return allocation_phase_tracker_;
+  }
+
+  // Accounts bytes allocated on the main thread to the current allocation
+  // phase.
+  void AddAllocatedBytesForAllocationPhase(size_t bytes) {
+    allocation_phase_tracker_.AddAllocatedBytes(bytes);
+  }
+
+  // Returns the bytes allocated on the main thread during each allocation
+  // phase, including the current LABs.
+  V8_EXPORT_PRIVATE std::vector<std::pair<uint32_t, size_t>>
+  AllocatedBytesPerAllocationPhase();
+
+  SlowPathCounters* slow_path_counters() { return &slow_path_counters_; }
+
   // This should be used only for testing.
   void set_new_space_allocation_counter(size_t new_value) {
     new_space_allocation_counter_ = new_value;
@@ -1806,6 +1835,9 @@ class Heap final {
 
   // Flush the number to string cache.
   void FlushNumberStringCache();
+  // Drops the lazily computed line ends of all scripts. They are recomputed
+  // from the source on the next position lookup.
+  void FlushScriptLineEnds();
 
   void ActivateMemoryReducerIfNeededOnMainThread();
 
@@ -1819,6 +1851,10 @@ class Heap final {
 
   enum class ResizeNewSpaceMode { kShrink, kGrow, kNone };
   ResizeNewSpaceMode ShouldResizeNewSpace();
+  // Returns the resize mode predicted from previous activations of the current
+  // allocation phase or nullopt if there is no prediction.
+  std::optional<ResizeNewSpaceMode> ShouldResizeNewSpaceForAllocationPhase()
+      const;
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
@@ -1952,6 +1988,12 @@ class Heap final {
 
   size_t min_old_generation_size() const { return min_old_generation_size_; }
 
+  // GC time per second of wall time that the heap growing heuristics aim for,
+  // or 0 if no budget was configured.
+  double gc_pause_budget_in_ms_per_second() const {
+    return gc_pause_budget_in_ms_per_second_;
+  }
+
   // Sets max_old_generation_size_ and computes the new global heap limit from
   // it.
   void SetOldGenerationAndGlobalMaximumSize(size_t max_old_generation_size);
@@ -1990,6 +2032,7 @@ class Heap final {
   struct LimitsCompuatationResult {
     size_t old_generation_allocation_limit;
     size_t global_allocation_limit;
+    double v8_growing_factor;
   };
   static LimitsCompuatationResult ComputeNewAllocationLimits(Heap* heap);
 
@@ -2108,6 +2151,8 @@ class Heap final {
   size_t initial_max_old_generation_size_threshold_ = 0;
   size_t initial_old_generation_size_ = 0;
 
+  double gc_pause_budget_in_ms_per_second_ = 0.0;
+
   // Before the first full GC the old generation allocation limit is considered
   // to be *not* configured (unless initial limits were provided by the
   // embedder). In this mode V8 starts with a very large old generation
@@ -2130,6 +2175,10 @@ class Heap final {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  AllocationPhaseTracker allocation_phase_tracker_;
+
+  SlowPathCounters slow_path_counters_;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -2138,6 +2187,9 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Stores the load hint set by SetLoadHint.
+  v8::LoadHint load_hint_ = v8::LoadHint::kDefault;
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
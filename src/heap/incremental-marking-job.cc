@@ -52,7 +52,8 @@ IncrementalMarkingJob::IncrementalMarkingJob(Heap* heap)
   CHECK(v8_flags.incremental_marking_task);
 }
 
-void IncrementalMarkingJob::ScheduleTask(TaskPriority priority) {
+void IncrementalMarkingJob::ScheduleTask(TaskPriority priority,
+                                         v8::base::TimeDelta delay) {
   base::MutexGuard guard(&mutex_);
 
   if (pending_task_ || heap_->IsTearingDown()) {
@@ -66,20 +67,30 @@ void IncrementalMarkingJob::ScheduleTask(TaskPriority priority) {
               (priority != TaskPriority::kUserBlocking)
           ? user_visible_task_runner_.get()
           : user_blocking_task_runner_.get();
+  const bool is_delayed = !delay.IsZero();
   const bool non_nestable_tasks_enabled =
-      task_runner->NonNestableTasksEnabled();
+      is_delayed ? task_runner->NonNestableDelayedTasksEnabled()
+                 : task_runner->NonNestableTasksEnabled();
   auto task = std::make_unique<Task>(heap_->isolate(), this,
                                      non_nestable_tasks_enabled
                                          ? StackState::kNoHeapPointers
                                          : StackState::kMayContainHeapPointers);
-  if (non_nestable_tasks_enabled) {
+  if (is_delayed) {
+    if (non_nestable_tasks_enabled) {
+      task_runner->PostNonNestableDelayedTask(std::move(task),
+                                              delay.InSecondsF());
+    } else {
+      task_runner->PostDelayedTask(std::move(task), delay.InSecondsF());
+    }
+  } else if (non_nestable_tasks_enabled) {
     task_runner->PostNonNestableTask(std::move(task));
   } else {
     task_runner->PostTask(std::move(task));
   }
 
   pending_task_ = true;
-  scheduled_time_ = v8::base::TimeTicks::Now();
+  // Time to task is only recorded after the initial delay.
+  scheduled_time_ = v8::base::TimeTicks::Now() + delay;
   if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
     heap_->isolate()->PrintWithTimestamp(
         "[IncrementalMarking] Job: Schedule\n");
@@ -138,7 +149,8 @@ void IncrementalMarkingJob::Task::RunInternal() {
         isolate()->PrintWithTimestamp(
             "[IncrementalMarking] Using regular task based on flags\n");
       }
-      job_->ScheduleTask();
+      job_->ScheduleTask(TaskPriority::kUserBlocking,
+                         incremental_marking->GetNextTaskDelay());
     }
   }
 }
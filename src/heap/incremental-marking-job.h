@@ -26,9 +26,10 @@ class IncrementalMarkingJob final {
   IncrementalMarkingJob(const IncrementalMarkingJob&) = delete;
   IncrementalMarkingJob& operator=(const IncrementalMarkingJob&) = delete;
 
-  // Schedules a task with the given `priority`. Safe to be called from any
-  // thread.
-  void ScheduleTask(TaskPriority priority = TaskPriority::kUserBlocking);
+  // Schedules a task with the given `priority`. The task is posted as delayed
+  // task if `delay` is non-zero. Safe to be called from any thread.
+  void ScheduleTask(TaskPriority priority = TaskPriority::kUserBlocking,
+                    v8::base::TimeDelta delay = v8::base::TimeDelta());
 
   // Returns a weighted average of time to task. For delayed tasks the time to
   // task is only recorded after the initial delay. In case a task is currently
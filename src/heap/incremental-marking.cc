@@ -215,6 +215,12 @@ void IncrementalMarking::Start(GarbageCollector garbage_collector,
             : ::heap::base::IncrementalMarkingSchedule::
                   CreateWithDefaultMinimumMarkedBytesPerStep(
                       v8_flags.predictable);
+    if (v8_flags.incremental_marking_mmu_window > 0 && !v8_flags.predictable) {
+      schedule_->SetMinimumMutatorUtilization(
+          v8::base::TimeDelta::FromMilliseconds(
+              v8_flags.incremental_marking_mmu_window),
+          v8_flags.incremental_marking_target_mmu);
+    }
     schedule_->NotifyIncrementalMarkingStart();
   } else {
     // Allocation observers are not currently used by MinorMS because we don't
@@ -642,6 +648,10 @@ bool IncrementalMarking::Stop() {
     }
   }
   background_live_bytes_.clear();
+  if (schedule_ && schedule_->HasMinimumMutatorUtilization()) {
+    heap_->tracer()->RecordIncrementalMarkingMutatorUtilization(
+        schedule_->GetMinimumObservedMutatorUtilization());
+  }
   schedule_.reset();
 
   return true;
@@ -808,6 +818,33 @@ bool IncrementalMarking::IsAheadOfSchedule() const {
   return true;
 }
 
+v8::base::TimeDelta IncrementalMarking::GetNextTaskDelay() const {
+  if (!IsMajorMarking() || !schedule_->HasMinimumMutatorUtilization()) {
+    return v8::base::TimeDelta();
+  }
+  if (!schedule_
+           ->GetMaxStepDurationForMutatorUtilization(
+               v8::base::TimeTicks::Now())
+           .IsZero()) {
+    return v8::base::TimeDelta();
+  }
+  // The budget is regained as older steps leave the window. Wait for roughly
+  // one task step worth of budget.
+  return kMaxStepSizeOnTask;
+}
+
+v8::base::TimeDelta IncrementalMarking::ApplyMutatorUtilizationBudget(
+    v8::base::TimeDelta max_duration, StepOrigin step_origin) const {
+  if (!schedule_->HasMinimumMutatorUtilization()) return max_duration;
+  if (step_origin == StepOrigin::kV8 &&
+      schedule_->GetCurrentStepInfo().is_behind_expectation()) {
+    return max_duration;
+  }
+  return std::min(max_duration,
+                  schedule_->GetMaxStepDurationForMutatorUtilization(
+                      v8::base::TimeTicks::Now()));
+}
+
 void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK_EQ(heap_->gc_state(), Heap::NOT_IN_GC);
   DCHECK(v8_flags.incremental_marking);
@@ -857,6 +894,18 @@ void IncrementalMarking::FetchBytesMarkedConcurrently() {
 void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
                               size_t max_bytes_to_process,
                               StepOrigin step_origin) {
+  DCHECK(IsMajorMarking());
+  max_duration = ApplyMutatorUtilizationBudget(max_duration, step_origin);
+  if (max_duration.IsZero()) {
+    if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
+      isolate()->PrintWithTimestamp(
+          "[IncrementalMarking] Step: origin: %s skipped, mutator utilization "
+          "budget exhausted\n",
+          ToString(step_origin));
+    }
+    return;
+  }
+
   NestedTimedHistogramScope incremental_marking_scope(
       isolate()->counters()->gc_incremental_marking());
   TRACE_EVENT1("v8", "V8.GCIncrementalMarking", "epoch",
@@ -865,7 +914,6 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
       heap_->tracer(), GCTracer::Scope::MC_INCREMENTAL, ThreadKind::kMain,
       current_trace_id_.value(),
       TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
-  DCHECK(IsMajorMarking());
   const auto start = v8::base::TimeTicks::Now();
 
   std::optional<SafepointScope> safepoint_scope;
@@ -933,6 +981,7 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
 
   heap_->tracer()->AddIncrementalMarkingStep(v8_time.InMillisecondsF(),
                                              v8_bytes_processed);
+  schedule_->NotifyMutatorThreadStep(start, v8::base::TimeTicks::Now() - start);
 
   if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
     isolate()->PrintWithTimestamp(
@@ -119,6 +119,12 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   bool IsAheadOfSchedule() const;
 
+  // Returns the delay after which the next incremental marking task should run.
+  // The delay is non-zero only when a minimum mutator utilization is
+  // configured via --incremental-marking-mmu-window and the current window has
+  // no budget left for another step.
+  v8::base::TimeDelta GetNextTaskDelay() const;
+
   bool IsCompacting() { return IsMajorMarking() && is_compacting_; }
 
   Heap* heap() const { return heap_; }
@@ -183,6 +189,12 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   v8::base::TimeDelta EmbedderStep(v8::base::TimeDelta expected_duration);
   void Step(v8::base::TimeDelta max_duration, size_t max_bytes_to_process,
             StepOrigin step_origin);
+  // Bounds `max_duration` by the minimum mutator utilization budget if
+  // configured. Allocation-driven steps that fall behind the marking schedule
+  // are not bounded as otherwise allocation would outpace marking and force
+  // non-incremental finalization.
+  v8::base::TimeDelta ApplyMutatorUtilizationBudget(
+      v8::base::TimeDelta max_duration, StepOrigin step_origin) const;
 
   size_t OldGenerationSizeOfObjects() const;
 
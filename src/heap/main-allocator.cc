@@ -20,6 +20,7 @@
 #include "src/heap/page-metadata-inl.h"
 #include "src/heap/paged-spaces.h"
 #include "src/heap/spaces.h"
+#include "src/logging/counters.h"
 
 namespace v8 {
 namespace internal {
@@ -122,10 +123,12 @@ void MainAllocator::ResumeAllocationObservers() { DCHECK(!IsLabValid()); }
 void MainAllocator::AdvanceAllocationObservers() {
   if (SupportsAllocationObserver() && allocation_info().top() &&
       allocation_info().start() != allocation_info().top()) {
+    const size_t allocated =
+        allocation_info().top() - allocation_info().start();
     if (isolate_heap()->IsAllocationObserverActive()) {
-      allocation_counter().AdvanceAllocationObservers(
-          allocation_info().top() - allocation_info().start());
+      allocation_counter().AdvanceAllocationObservers(allocated);
     }
+    isolate_heap()->AddAllocatedBytesForAllocationPhase(allocated);
     MarkLabStartInitialized();
   }
 }
@@ -145,7 +148,7 @@ void MainAllocator::MarkLabStartInitialized() {
 // be used for the accounting. It can be different from aligned_size_in_bytes in
 // PagedSpace::AllocateRawAligned, where we have to overallocate in order to be
 // able to align the allocation afterwards.
-void MainAllocator::InvokeAllocationObservers(Address soon_object,
+bool MainAllocator::InvokeAllocationObservers(Address soon_object,
                                               size_t size_in_bytes,
                                               size_t aligned_size_in_bytes,
                                               size_t allocation_size) {
@@ -156,9 +159,10 @@ void MainAllocator::InvokeAllocationObservers(Address soon_object,
 
   if (!SupportsAllocationObserver() ||
       !isolate_heap()->IsAllocationObserverActive()) {
-    return;
+    return false;
   }
 
+  bool stepped = false;
   if (allocation_size >= allocation_counter().NextBytes()) {
     // Only the first object in a LAB should reach the next step.
     DCHECK_EQ(soon_object, allocation_info().start() + aligned_size_in_bytes -
@@ -186,10 +190,12 @@ void MainAllocator::InvokeAllocationObservers(Address soon_object,
     DCHECK_EQ(saved_allocation_info.start(), allocation_info().start());
     DCHECK_EQ(saved_allocation_info.top(), allocation_info().top());
     DCHECK_EQ(saved_allocation_info.limit(), allocation_info().limit());
+    stepped = true;
   }
 
   DCHECK_LT(allocation_info().limit() - allocation_info().start(),
             allocation_counter().NextBytes());
+  return stepped;
 }
 
 AllocationResult MainAllocator::AllocateRawSlow(int size_in_bytes,
@@ -210,14 +216,17 @@ AllocationResult MainAllocator::AllocateRawSlow(int size_in_bytes,
 AllocationResult MainAllocator::AllocateRawSlowUnaligned(
     int size_in_bytes, AllocationOrigin origin) {
   if (!EnsureAllocation(size_in_bytes, kTaggedAligned, origin)) {
+    RecordSlowPath(SlowPathCounters::AllocationReason::kGCNeeded);
     return AllocationResult::Failure();
   }
 
   AllocationResult result = AllocateFastUnaligned(size_in_bytes, origin);
   DCHECK(!result.IsFailure());
 
-  InvokeAllocationObservers(result.ToAddress(), size_in_bytes, size_in_bytes,
-                            size_in_bytes);
+  const bool stepped = InvokeAllocationObservers(
+      result.ToAddress(), size_in_bytes, size_in_bytes, size_in_bytes);
+  RecordSlowPath(stepped ? SlowPathCounters::AllocationReason::kObserverStep
+                         : SlowPathCounters::AllocationReason::kLabExhausted);
 
   return result;
 }
@@ -225,6 +234,7 @@ AllocationResult MainAllocator::AllocateRawSlowUnaligned(
 AllocationResult MainAllocator::AllocateRawSlowAligned(
     int size_in_bytes, AllocationAlignment alignment, AllocationOrigin origin) {
   if (!EnsureAllocation(size_in_bytes, alignment, origin)) {
+    RecordSlowPath(SlowPathCounters::AllocationReason::kGCNeeded);
     return AllocationResult::Failure();
   }
 
@@ -236,12 +246,21 @@ AllocationResult MainAllocator::AllocateRawSlowAligned(
   DCHECK_GE(max_aligned_size, aligned_size_in_bytes);
   DCHECK(!result.IsFailure());
 
-  InvokeAllocationObservers(result.ToAddress(), size_in_bytes,
-                            aligned_size_in_bytes, max_aligned_size);
+  const bool stepped =
+      InvokeAllocationObservers(result.ToAddress(), size_in_bytes,
+                                aligned_size_in_bytes, max_aligned_size);
+  RecordSlowPath(stepped ? SlowPathCounters::AllocationReason::kObserverStep
+                         : SlowPathCounters::AllocationReason::kLabExhausted);
 
   return result;
 }
 
+void MainAllocator::RecordSlowPath(SlowPathCounters::AllocationReason reason) {
+  // Allocations of the garbage collector itself are not counted.
+  if (in_gc()) return;
+  isolate_heap()->slow_path_counters()->RecordAllocation(reason);
+}
+
 void MainAllocator::MakeLinearAllocationAreaIterable() {
   if (!IsLabValid()) return;
 
@@ -794,9 +813,18 @@ void PagedSpaceAllocatorPolicy::SetLinearAllocationArea(Address top,
   }
 }
 
+bool PagedSpaceAllocatorPolicy::UsesAdaptiveLabSize() const {
+  return v8_flags.shared_space_adaptive_lab &&
+         allocator_->identity() == SHARED_SPACE && !allocator_->in_gc();
+}
+
 bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
     size_t size_in_bytes, AllocationOrigin origin) {
-  PagedSpace::ConcurrentAllocationMutex guard(space_);
+  const bool adaptive_lab_size = UsesAdaptiveLabSize();
+  Counters* const counters =
+      adaptive_lab_size ? isolate_heap()->isolate()->counters() : nullptr;
+  PagedSpace::ConcurrentAllocationMutex guard(
+      space_, counters ? counters->shared_space_lab_lock_waits() : nullptr);
   DCHECK(IsAligned(size_in_bytes, kTaggedSize));
   DCHECK_LE(allocator_->top(), allocator_->limit());
 #ifdef DEBUG
@@ -810,11 +838,22 @@ bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
             size_in_bytes);
 
   size_t new_node_size = 0;
-  Tagged<FreeSpace> new_node =
-      space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  Tagged<FreeSpace> new_node;
+  if (adaptive_lab_size && lab_size_ > size_in_bytes) {
+    new_node = space_->free_list_->Allocate(lab_size_, &new_node_size, origin);
+  }
+  if (new_node.is_null()) {
+    new_node =
+        space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  }
   if (new_node.is_null()) return false;
   DCHECK_GE(new_node_size, size_in_bytes);
 
+  if (adaptive_lab_size) {
+    counters->shared_space_lab_refills()->Increment();
+    lab_size_ = std::min(2 * lab_size_, kMaxAdaptiveLabSize);
+  }
+
   // The old-space-step might have finished sweeping and restarted marking.
   // Verify that it did not turn the page of the new node into an evacuation
   // candidate.
@@ -848,6 +887,8 @@ bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
   }
   SetLinearAllocationArea(start, limit, end);
   space_->AddRangeToActiveSystemPages(page, start, limit);
+  if (allocator_->identity() != NEW_SPACE) page->RecordObjectStart(start);
+  if (adaptive_lab_size) current_lab_size_ = limit - start;
 
   return true;
 }
@@ -879,6 +920,15 @@ bool PagedSpaceAllocatorPolicy::TryExtendLAB(int size_in_bytes) {
 void PagedSpaceAllocatorPolicy::FreeLinearAllocationArea() {
   if (!allocator_->IsLabValid()) return;
 
+  if (UsesAdaptiveLabSize()) {
+    // The LAB is given up before it is exhausted, e.g. for a GC. Shrink
+    // subsequent LABs if most of this one went unused.
+    const size_t unused = allocator_->limit() - allocator_->top();
+    if (unused > current_lab_size_ / 2) {
+      lab_size_ = std::max(lab_size_ / 2, kMinAdaptiveLabSize);
+    }
+  }
+
   base::MutexGuard guard(space_->mutex());
   FreeLinearAllocationAreaUnsynchronized();
 }
@@ -912,6 +962,9 @@ void PagedSpaceAllocatorPolicy::FreeLinearAllocationAreaUnsynchronized() {
   DCHECK_IMPLIES(current_limit - current_top >= 2 * kTaggedSize,
                  space_heap()->marking_state()->IsUnmarked(
                      HeapObject::FromAddress(current_top)));
+  if (current_top != current_max_limit && allocator_->identity() != NEW_SPACE) {
+    PageMetadata::FromAddress(current_top)->RecordObjectStart(current_top);
+  }
   space_->Free(current_top, current_max_limit - current_top);
 }
 
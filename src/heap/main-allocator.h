@@ -12,6 +12,7 @@
 #include "src/heap/allocation-result.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/linear-allocation-area.h"
+#include "src/heap/slow-path-counters.h"
 #include "src/tasks/cancelable-task.h"
 
 namespace v8 {
@@ -93,7 +94,20 @@ class PagedSpaceAllocatorPolicy final : public AllocatorPolicy {
 
   void FreeLinearAllocationAreaUnsynchronized();
 
+  // Allocations into the shared space outside of GC refill their LAB with at
+  // least `lab_size_` bytes to reduce contention on the shared space lock. The
+  // size doubles on every refill and is halved when the LAB is given up with
+  // more than half of it unused, so it follows how much the isolate allocates
+  // into the shared space between safepoints.
+  static constexpr size_t kMinAdaptiveLabSize = 4 * KB;
+  static constexpr size_t kMaxAdaptiveLabSize = 64 * KB;
+
+  bool UsesAdaptiveLabSize() const;
+
   PagedSpaceBase* const space_;
+  size_t lab_size_ = kMinAdaptiveLabSize;
+  // Size of the current LAB if `UsesAdaptiveLabSize()`.
+  size_t current_lab_size_ = 0;
 
   friend class PagedNewSpaceAllocatorPolicy;
 };
@@ -221,7 +235,8 @@ class MainAllocator {
   void ResumeAllocationObservers();
 
   V8_EXPORT_PRIVATE void AdvanceAllocationObservers();
-  V8_EXPORT_PRIVATE void InvokeAllocationObservers(Address soon_object,
+  // Returns whether the observers were stepped.
+  V8_EXPORT_PRIVATE bool InvokeAllocationObservers(Address soon_object,
                                                    size_t size_in_bytes,
                                                    size_t aligned_size_in_bytes,
                                                    size_t allocation_size);
@@ -301,6 +316,9 @@ class MainAllocator {
   bool EnsureAllocation(int size_in_bytes, AllocationAlignment alignment,
                         AllocationOrigin origin);
 
+  // Counts an entry into the allocation slow path, see SlowPathCounters.
+  void RecordSlowPath(SlowPathCounters::AllocationReason reason);
+
   void MarkLabStartInitialized();
 
   bool IsBlackAllocationEnabled() const;
@@ -389,7 +389,10 @@ void MarkCompactCollector::StartMarking() {
   local_marking_worklists_ = std::make_unique<MarkingWorklists::Local>(
       &marking_worklists_,
       cpp_heap ? cpp_heap->CreateCppMarkingStateForMutatorThread()
-               : MarkingWorklists::Local::kNoCppMarkingState);
+               : MarkingWorklists::Local::kNoCppMarkingState,
+      v8_flags.gc_work_stealing
+          ? MarkingWorklist::Local::WorkStealing::kEnabled
+          : MarkingWorklist::Local::WorkStealing::kDisabled);
   local_weak_objects_ = std::make_unique<WeakObjects::Local>(weak_objects());
   marking_visitor_ = std::make_unique<MainMarkingVisitor>(
       local_marking_worklists_.get(), local_weak_objects_.get(), heap_, epoch(),
@@ -2844,6 +2847,30 @@ class MarkCompactCollector::FilterNonTrivialWeakRefJobItem final
   const uint64_t trace_id_;
 };
 
+class MarkCompactCollector::FilterJSWeakRefsJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit FilterJSWeakRefsJobItem(MarkCompactCollector* collector)
+      : collector_(collector) {}
+
+  void Run(JobDelegate* delegate) final {
+    Heap* heap = collector_->heap();
+
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(heap->isolate());
+
+    TRACE_GC1(heap->tracer(),
+              GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES_FILTER,
+              delegate->IsJoiningThread() ? ThreadKind::kMain
+                                          : ThreadKind::kBackground);
+    collector_->FilterJSWeakRefs();
+  }
+
+ private:
+  MarkCompactCollector* collector_;
+};
+
 void MarkCompactCollector::ClearNonLiveReferences() {
   TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR);
 
@@ -2988,6 +3015,20 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     job->Add(std::move(job_item));
     TRACE_GC_NOTE_WITH_FLOW("FilterNonTrivialWeakRefJob started", trace_id,
                             TRACE_EVENT_FLAG_FLOW_OUT);
+    // JSWeakRefs and WeakCells are filtered in the same job. Embedders may
+    // register millions of finalizers, so the worklists are drained by
+    // several items in parallel.
+    static constexpr size_t kJSWeakRefSegmentsPerItem = 16;
+    local_weak_objects()->js_weak_refs_local.Publish();
+    local_weak_objects()->weak_cells_local.Publish();
+    const size_t segments =
+        weak_objects_.js_weak_refs.Size() + weak_objects_.weak_cells.Size();
+    const size_t num_items = std::min<size_t>(
+        1 + segments / kJSWeakRefSegmentsPerItem,
+        V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+    for (size_t i = 0; i < num_items; i++) {
+      job->Add(std::make_unique<FilterJSWeakRefsJobItem>(this));
+    }
     filter_non_trivial_weakrefs_job_handle =
         V8::GetCurrentPlatform()->CreateJob(TaskPriority::kUserBlocking,
                                             std::move(job));
@@ -3268,6 +3309,8 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
 
   shared_info->set_uncompiled_data(uncompiled_data);
   DCHECK(!shared_info->is_compiled());
+
+  heap_->tracer()->NotifyBytecodeFlushed(compiled_data_size);
 }
 
 void MarkCompactCollector::ProcessOldCodeCandidates() {
@@ -3363,12 +3406,15 @@ bool MarkCompactCollector::ProcessOldBaselineSFI(
     // the Code has to be live and will have been marked via
     // the owning JSFunction.
     DCHECK(non_atomic_marking_state_->IsMarked(baseline_code));
-  } else if (is_bytecode_live || bytecode_already_decompiled) {
-    // Reset the function_data field to the BytecodeArray, InterpreterData,
-    // or UncompiledData found on the baseline code. We can skip this step
-    // if the BytecodeArray is not live and not already decompiled, because
-    // FlushBytecodeFromSFI below will set the function_data field.
-    flushing_candidate->FlushBaselineCode();
+  } else {
+    heap_->tracer()->NotifyBaselineCodeFlushed(baseline_istream->Size());
+    if (is_bytecode_live || bytecode_already_decompiled) {
+      // Reset the function_data field to the BytecodeArray, InterpreterData,
+      // or UncompiledData found on the baseline code. We can skip this step
+      // if the BytecodeArray is not live and not already decompiled, because
+      // FlushBytecodeFromSFI below will set the function_data field.
+      flushing_candidate->FlushBaselineCode();
+    }
   }
 
   if (!is_bytecode_live) {
@@ -3383,6 +3429,12 @@ void MarkCompactCollector::FlushSFI(Tagged<SharedFunctionInfo> sfi,
   // from functions that don't have baseline data.
   DCHECK(v8_flags.flush_baseline_code || !sfi->HasBaselineCode());
 
+  if (v8_flags.adaptive_bytecode_flushing) {
+    // Remember the flush so that a later compilation can tell how long the
+    // bytecode wasn't needed.
+    sfi->SetAgeAfterBytecodeFlush();
+  }
+
   if (bytecode_already_decompiled) {
     sfi->DiscardCompiledMetadata(
         heap_->isolate(),
@@ -3802,23 +3854,63 @@ void MarkCompactCollector::ClearNonTrivialWeakReferences() {
   }
 }
 
-void MarkCompactCollector::ClearJSWeakRefs() {
-  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES);
+void MarkCompactCollector::FilterJSWeakRefs() {
+  // Each item uses its own local views of the worklists, so that the items can
+  // run in parallel.
+  WeakObjects::WeakObjectWorklist<Tagged<JSWeakRef>>::Local js_weak_refs(
+      weak_objects_.js_weak_refs);
+  WeakObjects::WeakObjectWorklist<Tagged<WeakCell>>::Local weak_cells(
+      weak_objects_.weak_cells);
+  WeakObjects::WeakObjectWorklist<Tagged<WeakCell>>::Local weak_cells_unmarked(
+      weak_objects_.weak_cells_unmarked);
+  auto is_dead = [this](Tagged<HeapObject> object) {
+    return !InReadOnlySpace(object) &&
+           !non_atomic_marking_state_->IsMarked(object);
+  };
+
   Tagged<JSWeakRef> weak_ref;
-  Isolate* const isolate = heap_->isolate();
-  while (local_weak_objects()->js_weak_refs_local.Pop(&weak_ref)) {
+  while (js_weak_refs.Pop(&weak_ref)) {
     Tagged<HeapObject> target = Cast<HeapObject>(weak_ref->target());
-    if (!InReadOnlySpace(target) &&
-        !non_atomic_marking_state_->IsMarked(target)) {
-      weak_ref->set_target(ReadOnlyRoots(isolate).undefined_value());
+    if (is_dead(target)) {
+      // JSWeakRefs are independent of each other, so they are cleared right
+      // away. Undefined is in read-only space and needs no write barrier.
+      weak_ref->set_target(ReadOnlyRoots(heap_).undefined_value(),
+                           SKIP_WRITE_BARRIER);
     } else {
       // The value of the JSWeakRef is alive.
       ObjectSlot slot = weak_ref->RawField(JSWeakRef::kTargetOffset);
       RecordSlot(weak_ref, slot, target);
     }
   }
+
   Tagged<WeakCell> weak_cell;
-  while (local_weak_objects()->weak_cells_local.Pop(&weak_cell)) {
+  while (weak_cells.Pop(&weak_cell)) {
+    Tagged<HeapObject> target = Cast<HeapObject>(weak_cell->target());
+    Tagged<HeapObject> unregister_token = weak_cell->unregister_token();
+    if (is_dead(target) || is_dead(unregister_token)) {
+      // Clearing the WeakCell modifies its JSFinalizationRegistry, which may
+      // be shared with WeakCells processed by other items. Defer it to
+      // ClearJSWeakRefs on the main thread.
+      weak_cells_unmarked.Push(weak_cell);
+      continue;
+    }
+    // The target and the unregister token of the WeakCell are alive.
+    ObjectSlot target_slot = weak_cell->RawField(WeakCell::kTargetOffset);
+    RecordSlot(weak_cell, target_slot, target);
+    ObjectSlot token_slot =
+        weak_cell->RawField(WeakCell::kUnregisterTokenOffset);
+    RecordSlot(weak_cell, token_slot, unregister_token);
+  }
+  weak_cells_unmarked.Publish();
+}
+
+void MarkCompactCollector::ClearJSWeakRefs() {
+  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES);
+  Isolate* const isolate = heap_->isolate();
+  DCHECK(local_weak_objects()->js_weak_refs_local.IsLocalAndGlobalEmpty());
+  DCHECK(local_weak_objects()->weak_cells_local.IsLocalAndGlobalEmpty());
+  Tagged<WeakCell> weak_cell;
+  while (local_weak_objects()->weak_cells_unmarked_local.Pop(&weak_cell)) {
     auto gc_notify_updated_slot = [](Tagged<HeapObject> object, ObjectSlot slot,
                                      Tagged<Object> target) {
       if (IsHeapObject(target)) {
@@ -4408,6 +4500,14 @@ void Evacuator::EvacuatePage(MutablePageMetadata* page) {
   bool success = false;
   {
     TimedScope timed_scope(&evacuation_time);
+    // Migrating an InstructionStream writes to both the source and the target
+    // code page. Keep code memory writable for the whole page instead of
+    // switching permissions for each object.
+    std::optional<RwxMemoryWriteBatchScope> write_batch_scope;
+    if (page->Chunk()->executable()) {
+      write_batch_scope.emplace(heap_->isolate(),
+                                "Evacuation of an executable page.");
+    }
     success = RawEvacuatePage(page);
   }
   ReportCompactionProgress(evacuation_time, saved_live_bytes);
@@ -345,8 +345,16 @@ class MarkCompactCollector final {
   // transition.
   void ClearNonTrivialWeakReferences();
 
-  // Goes through the list of encountered JSWeakRefs and WeakCells and clears
-  // those with dead values.
+  // Goes through the lists of encountered JSWeakRefs and WeakCells. Clears
+  // the JSWeakRefs with dead targets and records the slots of the live ones,
+  // and filters out the WeakCells whose target and unregister token are both
+  // alive. This is performed in a parallel job, with several items draining
+  // the shared worklists.
+  void FilterJSWeakRefs();
+  class FilterJSWeakRefsJobItem;
+
+  // Goes through the list of WeakCells with a dead target or unregister token
+  // and clears them, which updates their JSFinalizationRegistries.
   void ClearJSWeakRefs();
 
   // Starts sweeping of spaces by contributing on the main thread and setting
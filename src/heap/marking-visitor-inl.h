@@ -368,11 +368,22 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitSharedFunctionInfo(
   // We found a BytecodeArray that can be flushed. Increment the age of the SFI.
   if (can_flush_bytecode && !should_keep_ages_unchanged_) {
     MakeOlder(shared_info);
-  }
-
-  if (!can_flush_bytecode || !ShouldFlushCode(shared_info)) {
-    // If the SharedFunctionInfo doesn't have old bytecode visit the function
-    // data strongly.
+  } else if (V8_UNLIKELY(v8_flags.adaptive_bytecode_flushing) &&
+             !should_keep_ages_unchanged_ &&
+             shared_info->HasAgeAfterBytecodeFlush()) {
+    // Count the GCs since the bytecode of the SFI was flushed.
+    shared_info->MakeAgeAfterBytecodeFlushOlder();
+  }
+
+  const bool should_flush_code =
+      can_flush_bytecode && ShouldFlushCode(shared_info);
+  const bool should_flush_baseline_code_only =
+      can_flush_bytecode && !should_flush_code &&
+      IsOldBaselineCode(shared_info);
+
+  if (!should_flush_code && !should_flush_baseline_code_only) {
+    // If the SharedFunctionInfo doesn't have old bytecode or baseline code
+    // visit the function data strongly.
 #ifdef V8_ENABLE_SANDBOX
     VisitIndirectPointer(shared_info,
                          shared_info->RawIndirectPointerField(
@@ -387,9 +398,11 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitSharedFunctionInfo(
     VisitPointer(shared_info,
                  shared_info->RawField(
                      SharedFunctionInfo::kUntrustedFunctionDataOffset));
-  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_)) {
-    // If bytecode flushing is disabled but baseline code flushing is enabled
-    // then we have to visit the bytecode but not the baseline code.
+  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_) ||
+             should_flush_baseline_code_only) {
+    // If bytecode flushing is disabled but baseline code flushing is enabled,
+    // or only the baseline code is old, then we have to visit the bytecode but
+    // not the baseline code.
     DCHECK(IsBaselineCodeFlushingEnabled(code_flush_mode_));
     Tagged<Code> baseline_code = shared_info->baseline_code(kAcquireLoad);
     // Visit the bytecode hanging off baseline code.
@@ -450,8 +463,25 @@ bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     return isolate_in_background_ ||
            V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
   } else {
-    return sfi->age() >= v8_flags.bytecode_old_age;
+    return sfi->age() >= sfi->BytecodeOldAge();
+  }
+}
+
+// Baseline code can be flushed on its own before the bytecode is old, see
+// --baseline-code-old-age. The function then runs in Ignition again until
+// it's hot enough to be batch compiled with Sparkplug once more. This is only
+// supported for age based code flushing.
+template <typename ConcreteVisitor>
+bool MarkingVisitorBase<ConcreteVisitor>::IsOldBaselineCode(
+    Tagged<SharedFunctionInfo> sfi) const {
+  if (!IsBaselineCodeFlushingEnabled(code_flush_mode_)) return false;
+  if (v8_flags.baseline_code_old_age == 0 ||
+      v8_flags.flush_code_based_on_time ||
+      v8_flags.flush_code_based_on_tab_visibility) {
+    return false;
   }
+  if (!IsCode(sfi->GetTrustedData(heap_->isolate()))) return false;
+  return sfi->age() >= v8_flags.baseline_code_old_age;
 }
 
 template <typename ConcreteVisitor>
@@ -480,10 +510,11 @@ void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
     // No need to increment age.
   } else {
     uint16_t age = sfi->age();
-    if (age < v8_flags.bytecode_old_age) {
+    const uint16_t old_age = sfi->BytecodeOldAge();
+    if (age < old_age) {
       sfi->CompareExchangeAge(age, age + 1);
     }
-    DCHECK_LE(sfi->age(), v8_flags.bytecode_old_age);
+    DCHECK_LE(sfi->age(), old_age);
   }
 }
 
@@ -515,7 +546,8 @@ bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushBaselineCode(
   if (code->kind() != CodeKind::BASELINE) return false;
 
   Tagged<SharedFunctionInfo> shared = Cast<SharedFunctionInfo>(maybe_shared);
-  return HasBytecodeArrayForFlushing(shared) && ShouldFlushCode(shared);
+  return HasBytecodeArrayForFlushing(shared) &&
+         (ShouldFlushCode(shared) || IsOldBaselineCode(shared));
 }
 
 // ===========================================================================
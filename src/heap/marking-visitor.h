@@ -204,6 +204,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
 
   bool HasBytecodeArrayForFlushing(Tagged<SharedFunctionInfo> sfi) const;
   bool IsOld(Tagged<SharedFunctionInfo> sfi) const;
+  bool IsOldBaselineCode(Tagged<SharedFunctionInfo> sfi) const;
   void MakeOlder(Tagged<SharedFunctionInfo> sfi) const;
 
   MarkingWorklists::Local* const local_marking_worklists_;
@@ -83,9 +83,10 @@ constexpr std::nullptr_t MarkingWorklists::Local::kNoCppMarkingState;
 
 MarkingWorklists::Local::Local(
     MarkingWorklists* global,
-    std::unique_ptr<CppMarkingState> cpp_marking_state)
+    std::unique_ptr<CppMarkingState> cpp_marking_state,
+    MarkingWorklist::Local::WorkStealing work_stealing)
     : active_(&shared_),
-      shared_(*global->shared()),
+      shared_(*global->shared(), work_stealing),
       on_hold_(*global->on_hold()),
       active_context_(kSharedContext),
       is_per_context_mode_(!global->context_worklists().empty()),
@@ -142,9 +142,13 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
   static constexpr Address kOtherContext = MarkingWorklists::kOtherContext;
   static constexpr std::nullptr_t kNoCppMarkingState = nullptr;
 
+  // Work stealing only applies to the shared worklist which is used for most
+  // objects.
   explicit Local(
       MarkingWorklists* global,
-      std::unique_ptr<CppMarkingState> cpp_marking_state = kNoCppMarkingState);
+      std::unique_ptr<CppMarkingState> cpp_marking_state = kNoCppMarkingState,
+      MarkingWorklist::Local::WorkStealing work_stealing =
+          MarkingWorklist::Local::WorkStealing::kDisabled);
 
   // Local worklists implicitly check for emptiness on destruction.
   ~Local() = default;
@@ -182,6 +186,10 @@ class V8_EXPORT_PRIVATE MarkingWorklists::Local final {
 
   Address SwitchToSharedForTesting();
 
+  // Work stealing statistics of the shared worklist.
+  size_t steals() const { return shared_.steals(); }
+  size_t idle_events() const { return shared_.idle_events(); }
+
  private:
   inline void SwitchToContextImpl(Address context,
                                   MarkingWorklist::Local* worklist);
@@ -4,10 +4,12 @@
 
 #include "src/heap/memory-allocator.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <optional>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -64,6 +66,11 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
   DCHECK_NOT_NULL(data_page_allocator_);
   DCHECK_NOT_NULL(code_page_allocator_);
   DCHECK_NOT_NULL(trusted_page_allocator_);
+  if (v8_flags.numa_aware_page_placement) {
+    // The allocator is created on the isolate's main thread.
+    numa_node_.store(base::OS::GetCurrentNumaNode(),
+                     std::memory_order_relaxed);
+  }
 }
 
 void MemoryAllocator::TearDown() {
@@ -96,6 +103,21 @@ void MemoryAllocator::Pool::ReleasePooledChunks() {
   }
 }
 
+size_t MemoryAllocator::Pool::ReleasePooledChunks(size_t max_chunks) {
+  std::vector<MutablePageMetadata*> released;
+  {
+    base::MutexGuard guard(&mutex_);
+    const size_t count = std::min(max_chunks, pooled_chunks_.size());
+    released.assign(pooled_chunks_.end() - count, pooled_chunks_.end());
+    pooled_chunks_.resize(pooled_chunks_.size() - count);
+  }
+  for (auto* chunk_metadata : released) {
+    DCHECK_NOT_NULL(chunk_metadata);
+    DeleteMemoryChunk(chunk_metadata);
+  }
+  return released.size();
+}
+
 size_t MemoryAllocator::Pool::NumberOfCommittedChunks() const {
   base::MutexGuard guard(&mutex_);
   return pooled_chunks_.size();
@@ -105,6 +127,33 @@ size_t MemoryAllocator::Pool::CommittedBufferedMemory() const {
   return NumberOfCommittedChunks() * PageMetadata::kPageSize;
 }
 
+size_t MemoryAllocator::PrecommitPooledPages(Space* space, size_t count) {
+  DCHECK_NE(CODE_SPACE, space->identity());
+  DCHECK_NE(TRUSTED_SPACE, space->identity());
+  size_t added = 0;
+  for (size_t pooled = pool()->NumberOfCommittedChunks(); pooled < count;
+       ++pooled) {
+    PageMetadata* page =
+        AllocatePage(AllocationMode::kRegular, space, NOT_EXECUTABLE);
+    if (page == nullptr) break;
+    Free(FreeMode::kPool, page);
+    ++added;
+  }
+  return added;
+}
+
+void MemoryAllocator::MaybeBindToNumaNode(AllocationSpace space,
+                                          Address start, size_t size) {
+  const int node = numa_node_.load(std::memory_order_relaxed);
+  if (V8_LIKELY(node < 0)) return;
+  if (space != NEW_SPACE && space != OLD_SPACE) return;
+  if (!base::OS::BindMemoryToNumaNode(reinterpret_cast<void*>(start), size,
+                                      node)) {
+    // Binding is best effort. Stop trying if the OS does not support it.
+    numa_node_.store(-1, std::memory_order_relaxed);
+  }
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation,
                                    Executability executable) {
   Address base = reservation->address();
@@ -419,6 +468,10 @@ PageMetadata* MemoryAllocator::AllocatePage(
 
   if (!chunk_info) return nullptr;
 
+  MaybeBindToNumaNode(space->identity(),
+                      reinterpret_cast<Address>(chunk_info->chunk),
+                      chunk_info->size);
+
   PageMetadata* metadata;
   if (chunk_info->optional_metadata) {
     metadata = new (chunk_info->optional_metadata) PageMetadata(
@@ -548,7 +601,7 @@ void MemoryAllocator::InitializeOncePerProcess() {
 
 base::AddressRegion MemoryAllocator::ComputeDiscardMemoryArea(Address addr,
                                                               size_t size) {
-  size_t page_size = GetCommitPageSize();
+  size_t page_size = GetDiscardPageSize();
   if (size < page_size + FreeSpace::kSize) {
     return base::AddressRegion(0, 0);
   }
@@ -53,14 +53,16 @@ class MemoryAllocator {
     Pool& operator=(const Pool&) = delete;
 
     void Add(MutablePageMetadata* chunk) {
-      // This method is called only on the main thread and only during the
-      // atomic pause so a lock is not needed.
+      // This method is called only on the main thread. Outside of the atomic
+      // pause (see MemoryAllocator::PrecommitPooledPages()) background threads
+      // may take pooled chunks concurrently.
       DCHECK_NOT_NULL(chunk);
       DCHECK_EQ(chunk->size(), PageMetadata::kPageSize);
       DCHECK(!chunk->Chunk()->IsLargePage());
       DCHECK(!chunk->Chunk()->IsTrusted());
       DCHECK_NE(chunk->Chunk()->executable(), EXECUTABLE);
       chunk->ReleaseAllAllocatedMemory();
+      base::MutexGuard guard(&mutex_);
       pooled_chunks_.push_back(chunk);
     }
 
@@ -74,6 +76,10 @@ class MemoryAllocator {
 
     void ReleasePooledChunks();
 
+    // Releases at most `max_chunks` pooled chunks and returns the number of
+    // chunks that were released.
+    size_t ReleasePooledChunks(size_t max_chunks);
+
     size_t NumberOfCommittedChunks() const;
     size_t CommittedBufferedMemory() const;
 
@@ -119,6 +125,17 @@ class MemoryAllocator {
     return commit_page_size_bits_;
   }
 
+  // Granularity in which unused memory inside of pages is returned to the OS.
+  // With huge pages enabled this is the huge page size, so that partially used
+  // huge pages are never split by discarding parts of them.
+  static size_t GetDiscardPageSize() {
+#if ENABLE_HUGEPAGE
+    return kHugePageSize;
+#else
+    return GetCommitPageSize();
+#endif
+  }
+
   // Computes the memory area of discardable memory within a given memory area
   // [addr, addr+size) and returns the result as base::AddressRegion. If the
   // memory is not discardable base::AddressRegion is an empty region.
@@ -235,6 +252,11 @@ class MemoryAllocator {
 
   Pool* pool() { return &pool_; }
 
+  // Allocates regular pages for `space` and moves them into the pool until it
+  // holds `count` chunks, so that the memory is committed ahead of demand.
+  // Returns the number of chunks that were added to the pool.
+  size_t PrecommitPooledPages(Space* space, size_t count);
+
   void UnregisterReadOnlyPage(ReadOnlyPageMetadata* page);
 
   Address HandleAllocationFailure(Executability executable);
@@ -291,6 +313,10 @@ class MemoryAllocator {
                                 Executability executable, void* hint,
                                 VirtualMemory* controller);
 
+  // Binds the physical memory of regular new and old space pages to the NUMA
+  // node of the isolate's main thread if --numa-aware-page-placement is set.
+  void MaybeBindToNumaNode(AllocationSpace space, Address start, size_t size);
+
   // Commit memory region owned by given reservation object.  Returns true if
   // it succeeded and false otherwise.
   bool CommitMemory(VirtualMemory* reservation, Executability executable);
@@ -414,6 +440,10 @@ class MemoryAllocator {
   // Maximum space size in bytes.
   size_t capacity_;
 
+  // NUMA node that new and old space pages are bound to or -1 if pages are
+  // placed by the OS, see --numa-aware-page-placement.
+  std::atomic<int> numa_node_{-1};
+
   // Allocated space size in bytes.
   std::atomic<size_t> size_ = 0;
   // Allocated executable space size in bytes.
@@ -19,6 +19,7 @@ namespace internal {
 class MarkingBitmap;
 class FreeListCategory;
 class Heap;
+class ObjectStartBitmap;
 class TypedSlotsSet;
 class SlotSet;
 class MemoryChunkMetadata;
@@ -87,6 +88,7 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
     FIELD(FreeListCategory**, Categories),
     FIELD(PossiblyEmptyBuckets, PossiblyEmptyBuckets),
     FIELD(ActiveSystemPages*, ActiveSystemPages),
+    FIELD(ObjectStartBitmap*, ObjectStartBitmap),
     FIELD(size_t, AllocatedLabSize),
     FIELD(size_t, AgeInNewSpace),
     FIELD(MarkingBitmap, MarkingBitmap),
@@ -8,6 +8,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 
@@ -67,6 +68,70 @@ void MemoryReducer::TimerTask::RunInternal() {
 }
 
 
+MemoryReducer::DecommitTask::DecommitTask(MemoryReducer* memory_reducer)
+    : CancelableTask(memory_reducer->heap()->isolate()),
+      memory_reducer_(memory_reducer) {}
+
+void MemoryReducer::DecommitTask::RunInternal() {
+  memory_reducer_->decommit_task_pending_ = false;
+  if (memory_reducer_->load_hint_ != LoadHint::kIdle) return;
+  memory_reducer_->ReleasePooledPagesStep();
+  // Keep running while idle as scavenges may shrink new space and pool more
+  // pages.
+  memory_reducer_->ScheduleDecommitTask();
+}
+
+void MemoryReducer::NotifyLoadHint(LoadHint hint) {
+  if (hint == load_hint_) return;
+  load_hint_ = hint;
+  switch (hint) {
+    case LoadHint::kIdle:
+      pages_released_while_idle_ = 0;
+      ScheduleDecommitTask();
+      break;
+    case LoadHint::kLoadExpected: {
+      const size_t pages =
+          std::min(pages_released_while_idle_,
+                   static_cast<size_t>(
+                       v8_flags.memory_reducer_max_precommit_pages));
+      pages_released_while_idle_ = 0;
+      if (pages == 0) break;
+      const size_t precommitted =
+          heap()->memory_allocator()->PrecommitPooledPages(heap()->old_space(),
+                                                           pages);
+      if (v8_flags.trace_memory_reducer) {
+        heap()->isolate()->PrintWithTimestamp(
+            "Memory reducer: precommitted %zu pages\n", precommitted);
+      }
+      break;
+    }
+    case LoadHint::kDefault:
+      break;
+  }
+}
+
+size_t MemoryReducer::ReleasePooledPagesStep() {
+  const size_t released =
+      heap()->memory_allocator()->pool()->ReleasePooledChunks(
+          static_cast<size_t>(v8_flags.memory_reducer_idle_decommit_pages));
+  pages_released_while_idle_ += released;
+  idle_decommitted_memory_ += released * PageMetadata::kPageSize;
+  if (released > 0 && v8_flags.trace_memory_reducer) {
+    heap()->isolate()->PrintWithTimestamp(
+        "Memory reducer: released %zu pooled pages while idle\n", released);
+  }
+  return released;
+}
+
+void MemoryReducer::ScheduleDecommitTask() {
+  if (decommit_task_pending_ || heap()->IsTearingDown()) return;
+  DCHECK_LT(0, v8_flags.memory_reducer_idle_decommit_interval_ms);
+  decommit_task_pending_ = true;
+  taskrunner_->PostDelayedTask(
+      std::make_unique<MemoryReducer::DecommitTask>(this),
+      v8_flags.memory_reducer_idle_decommit_interval_ms / 1000.0);
+}
+
 void MemoryReducer::NotifyTimer(const Event& event) {
   if (state_.id() != kWait) return;
   DCHECK_EQ(kTimer, event.type);
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MEMORY_REDUCER_H_
 #define V8_HEAP_MEMORY_REDUCER_H_
 
+#include "include/v8-isolate.h"
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
@@ -160,6 +161,14 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // Callbacks.
   void NotifyMarkCompact(size_t committed_memory_before);
   void NotifyPossibleGarbage();
+  // Called when the embedder changes the load hint (see
+  // v8::Isolate::SetLoadHint()). While the isolate is idle, pooled pages are
+  // released gradually. When load is expected, as many pages as were released
+  // during the idle period are recommitted into the pool.
+  void NotifyLoadHint(LoadHint hint);
+  // Releases up to --memory-reducer-idle-decommit-pages pooled pages. Returns
+  // the number of released pages.
+  size_t ReleasePooledPagesStep();
   // The step function that computes the next state from the current state and
   // the incoming event.
   static State Step(const State& state, const Event& event);
@@ -180,6 +189,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
 
   bool ShouldGrowHeapSlowly() { return state_.id() == kDone; }
 
+  // Total number of bytes released by ReleasePooledPagesStep() so far.
+  size_t idle_decommitted_memory() const { return idle_decommitted_memory_; }
+
   static int MaxNumberOfGCs();
 
  private:
@@ -195,7 +207,20 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     MemoryReducer* memory_reducer_;
   };
 
+  class DecommitTask : public v8::internal::CancelableTask {
+   public:
+    explicit DecommitTask(MemoryReducer* memory_reducer);
+    DecommitTask(const DecommitTask&) = delete;
+    DecommitTask& operator=(const DecommitTask&) = delete;
+
+   private:
+    // v8::internal::CancelableTask overrides.
+    void RunInternal() override;
+    MemoryReducer* memory_reducer_;
+  };
+
   void NotifyTimer(const Event& event);
+  void ScheduleDecommitTask();
 
   static bool WatchdogGC(const State& state, const Event& event);
 
@@ -205,6 +230,11 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   unsigned int js_calls_counter_;
   double js_calls_sample_time_ms_;
   int start_delay_ms_ = false;
+  LoadHint load_hint_ = LoadHint::kDefault;
+  bool decommit_task_pending_ = false;
+  // Pages released during the current idle period.
+  size_t pages_released_while_idle_ = 0;
+  size_t idle_decommitted_memory_ = 0;
 
   // Used in cctest.
   friend class heap::HeapTester;
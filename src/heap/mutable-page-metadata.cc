@@ -14,6 +14,7 @@
 #include "src/heap/memory-chunk-layout.h"
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/mutable-page-metadata-inl.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/heap/spaces.h"
 #include "src/objects/heap-object.h"
 
@@ -134,6 +135,11 @@ void MutablePageMetadata::ReleaseAllocatedMemoryNeededForWritableChunk() {
     active_system_pages_ = nullptr;
   }
 
+  if (object_start_bitmap_ != nullptr) {
+    delete object_start_bitmap_;
+    object_start_bitmap_ = nullptr;
+  }
+
   possibly_empty_buckets_.Release();
   ReleaseSlotSet(OLD_TO_NEW);
   ReleaseSlotSet(OLD_TO_NEW_BACKGROUND);
@@ -169,6 +175,28 @@ SlotSet* MutablePageMetadata::AllocateSlotSet(RememberedSetType type) {
   return new_slot_set;
 }
 
+ObjectStartBitmap* MutablePageMetadata::GetOrCreateObjectStartBitmap() {
+  DCHECK(v8_flags.conservative_stack_scanning);
+  DCHECK(!Chunk()->IsLargePage());
+  ObjectStartBitmap* bitmap = object_start_bitmap();
+  if (bitmap) return bitmap;
+  ObjectStartBitmap* new_bitmap = new ObjectStartBitmap();
+  bitmap = base::AsAtomicPointer::AcquireRelease_CompareAndSwap(
+      &object_start_bitmap_, nullptr, new_bitmap);
+  if (bitmap) {
+    delete new_bitmap;
+    return bitmap;
+  }
+  return new_bitmap;
+}
+
+void MutablePageMetadata::RecordObjectStart(Address address) {
+  if (!v8_flags.conservative_stack_scanning) return;
+  DCHECK(!Chunk()->IsLargePage());
+  DCHECK_NE(NEW_SPACE, owner_identity());
+  GetOrCreateObjectStartBitmap()->Set(Chunk()->Offset(address));
+}
+
 void MutablePageMetadata::ReleaseSlotSet(RememberedSetType type) {
   SlotSet* slot_set = slot_set_[type];
   if (slot_set) {
@@ -265,6 +293,9 @@ void MutablePageMetadata::ValidateOffsets(MutablePageMetadata* chunk) {
   DCHECK_EQ(reinterpret_cast<Address>(&chunk->active_system_pages_) -
                 chunk->MetadataAddress(),
             MemoryChunkLayout::kActiveSystemPagesOffset);
+  DCHECK_EQ(reinterpret_cast<Address>(&chunk->object_start_bitmap_) -
+                chunk->MetadataAddress(),
+            MemoryChunkLayout::kObjectStartBitmapOffset);
   DCHECK_EQ(reinterpret_cast<Address>(&chunk->allocated_lab_size_) -
                 chunk->MetadataAddress(),
             MemoryChunkLayout::kAllocatedLabSizeOffset);
@@ -21,6 +21,7 @@ namespace v8 {
 namespace internal {
 
 class FreeListCategory;
+class ObjectStartBitmap;
 class Space;
 
 // MutablePageMetadata represents a memory region owned by a specific space.
@@ -139,6 +140,16 @@ class MutablePageMetadata : public MemoryChunkMetadata {
   // Not safe to be called concurrently.
   void ReleaseTypedSlotSet(RememberedSetType type);
 
+  // The object start bitmap is only maintained for regular pages outside of
+  // the young generation with conservative stack scanning.
+  ObjectStartBitmap* object_start_bitmap() const {
+    return base::AsAtomicPointer::Acquire_Load(&object_start_bitmap_);
+  }
+  ObjectStartBitmap* GetOrCreateObjectStartBitmap();
+  // Records an object start in the object start bitmap if the page maintains
+  // one.
+  void RecordObjectStart(Address address);
+
   template <RememberedSetType type>
   SlotSet* ExtractSlotSet() {
     SlotSet* slot_set = slot_set_[type];
@@ -323,6 +334,8 @@ class MutablePageMetadata : public MemoryChunkMetadata {
 
   ActiveSystemPages* active_system_pages_;
 
+  ObjectStartBitmap* object_start_bitmap_ = nullptr;
+
   // Counts overall allocated LAB size on the page since the last GC. Used
   // only for new space pages.
   size_t allocated_lab_size_ = 0;
@@ -0,0 +1,96 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_OBJECT_START_BITMAP_H_
+#define V8_HEAP_OBJECT_START_BITMAP_H_
+
+#include <algorithm>
+
+#include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
+#include "src/common/globals.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+// A bitmap with a bit for each tagged word of a regular page, marking
+// addresses that are known to be object starts. Used for finding the object
+// containing an inner pointer without iterating the page from its start, e.g.
+// for conservative stack scanning.
+//
+// Not every object start is recorded: The sweeper records all live objects and
+// free ranges of a page, while the allocator only records the start and end of
+// linear allocation areas. Objects that were allocated in between are found by
+// iterating forward from the closest recorded start, which is always an object
+// start as long as the page is iterable.
+//
+// Bits are only set concurrently with other writers to the same page (e.g.
+// allocators of different threads). Clearing and lookups require exclusive
+// access to the page.
+class ObjectStartBitmap final : public Malloced {
+ public:
+  ObjectStartBitmap() { Clear(); }
+
+  ObjectStartBitmap(const ObjectStartBitmap&) = delete;
+  ObjectStartBitmap& operator=(const ObjectStartBitmap&) = delete;
+
+  // Records an object start at `offset` from the start of the memory chunk.
+  void Set(size_t offset) {
+    size_t cell_index, bit_index;
+    OffsetToIndices(offset, &cell_index, &bit_index);
+    const uintptr_t mask = static_cast<uintptr_t>(1) << bit_index;
+    base::AsAtomicWord::SetBits(&cells_[cell_index], mask, mask);
+  }
+
+  bool Contains(size_t offset) const {
+    size_t cell_index, bit_index;
+    OffsetToIndices(offset, &cell_index, &bit_index);
+    return (cells_[cell_index] >> bit_index) & 1;
+  }
+
+  void Clear() { std::fill_n(cells_, kCells, 0); }
+
+  // Returns the offset of the closest recorded object start at or before
+  // `offset`, or `kNotFound` if there is none. `offset` doesn't need to be
+  // aligned.
+  size_t FindPreviousObjectStart(size_t offset) const {
+    size_t cell_index, bit_index;
+    OffsetToIndices(RoundDown(offset, kTaggedSize), &cell_index, &bit_index);
+    // Keep bits up to and including `bit_index`. The shift wraps to zero for
+    // the last bit of a cell, which keeps all bits.
+    uintptr_t cell = cells_[cell_index] &
+                     ((static_cast<uintptr_t>(2) << bit_index) - 1);
+    while (cell == 0) {
+      if (cell_index == 0) return kNotFound;
+      cell = cells_[--cell_index];
+    }
+    const size_t last_bit =
+        kBitsPerCell - 1 - base::bits::CountLeadingZeros(cell);
+    return (cell_index * kBitsPerCell + last_bit) << kTaggedSizeLog2;
+  }
+
+  static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+ private:
+  static constexpr size_t kBitsPerCell = kBitsPerSystemPointer;
+  static constexpr size_t kCells =
+      (size_t{1} << kPageSizeBits) / kTaggedSize / kBitsPerCell;
+
+  static void OffsetToIndices(size_t offset, size_t* cell_index,
+                              size_t* bit_index) {
+    DCHECK(IsAligned(offset, kTaggedSize));
+    const size_t index = offset >> kTaggedSizeLog2;
+    *cell_index = index / kBitsPerCell;
+    *bit_index = index % kBitsPerCell;
+    DCHECK_LT(*cell_index, kCells);
+  }
+
+  uintptr_t cells_[kCells];
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_OBJECT_START_BITMAP_H_
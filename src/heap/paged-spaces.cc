@@ -29,6 +29,7 @@
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces.h"
 #include "src/heap/sweeper.h"
+#include "src/logging/counters.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/string.h"
 #include "src/utils/utils.h"
@@ -62,6 +63,12 @@ bool PagedSpaceObjectIterator::AdvanceToNextPage() {
 // ----------------------------------------------------------------------------
 // PagedSpaceBase implementation
 
+// static
+void PagedSpaceBase::ConcurrentAllocationMutex::IncrementLockWaits(
+    StatsCounter* lock_waits) {
+  lock_waits->Increment();
+}
+
 PagedSpaceBase::PagedSpaceBase(Heap* heap, AllocationSpace space,
                                Executability executable,
                                std::unique_ptr<FreeList> free_list,
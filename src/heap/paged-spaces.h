@@ -34,6 +34,7 @@ class HeapObject;
 class Isolate;
 class ObjectVisitor;
 class PagedSpaceBase;
+class StatsCounter;
 class Sweeper;
 
 class HeapObjectRange final {
@@ -337,15 +338,34 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
   template <bool during_sweep>
   V8_INLINE size_t FreeInternal(Address start, size_t size_in_bytes);
 
-  class ConcurrentAllocationMutex {
+  class V8_NODISCARD ConcurrentAllocationMutex {
    public:
-    explicit ConcurrentAllocationMutex(const PagedSpaceBase* space) {
-      if (space->SupportsConcurrentAllocation()) {
-        guard_.emplace(&space->space_mutex_);
+    // If `lock_waits` is provided, it is incremented whenever the lock could
+    // not be acquired right away.
+    explicit ConcurrentAllocationMutex(const PagedSpaceBase* space,
+                                       StatsCounter* lock_waits = nullptr)
+        : mutex_(space->SupportsConcurrentAllocation() ? &space->space_mutex_
+                                                       : nullptr) {
+      if (!mutex_) return;
+      if (lock_waits) {
+        if (mutex_->TryLock()) return;
+        IncrementLockWaits(lock_waits);
       }
+      mutex_->Lock();
     }
 
-    std::optional<base::MutexGuard> guard_;
+    ~ConcurrentAllocationMutex() {
+      if (mutex_) mutex_->Unlock();
+    }
+
+    ConcurrentAllocationMutex(const ConcurrentAllocationMutex&) = delete;
+    ConcurrentAllocationMutex& operator=(const ConcurrentAllocationMutex&) =
+        delete;
+
+   private:
+    static void IncrementLockWaits(StatsCounter* lock_waits);
+
+    base::Mutex* const mutex_;
   };
 
   bool SupportsConcurrentAllocation() const {
@@ -4,11 +4,16 @@
 
 #include "src/heap/pretenuring-handler.h"
 
+#include <algorithm>
+
+#include "src/base/functional.h"
 #include "src/common/globals.h"
+#include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/gc-tracer-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/new-spaces.h"
 #include "src/objects/allocation-site-inl.h"
 
@@ -289,7 +294,123 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
   allocation_sites_to_pretenure_->Push(site);
 }
 
-void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
+void PretenuringHandler::reset() {
+  allocation_sites_to_pretenure_.reset();
+  for (const PendingParse& pending : pending_parses_) {
+    if (pending.location) GlobalHandles::Destroy(pending.location);
+  }
+  pending_parses_.clear();
+  parse_site_feedback_.clear();
+}
+
+namespace {
+
+// Sites need this many samples before their payloads are pretenured. Samples
+// are averaged over a window of kMaxParseSamples parses.
+static constexpr uint32_t kMinParseSamples = 4;
+static constexpr uint32_t kMaxParseSamples = 16;
+static constexpr double kParsePretenureRatio = 0.85;
+// Every n-th payload of a pretenured site is allocated in the young generation
+// to keep its survival rate up to date.
+static constexpr uint32_t kParseProbeInterval = 8;
+static constexpr size_t kMaxPendingParses = 16;
+static constexpr size_t kMaxParseSites = 1024;
+
+}  // namespace
+
+AllocationType PretenuringHandler::AllocationTypeForParseSite(uint64_t site) {
+  auto it = parse_site_feedback_.find(site);
+  if (it == parse_site_feedback_.end()) return AllocationType::kYoung;
+  ParseSiteFeedback& feedback = it->second;
+  if (feedback.samples < kMinParseSamples ||
+      feedback.survival_rate < kParsePretenureRatio) {
+    return AllocationType::kYoung;
+  }
+  if (++feedback.pretenured_parses % kParseProbeInterval == 0) {
+    return AllocationType::kYoung;
+  }
+  return AllocationType::kOld;
+}
+
+void PretenuringHandler::TrackParseSurvival(uint64_t site,
+                                            DirectHandle<HeapObject> payload) {
+  DCHECK(Heap::InYoungGeneration(*payload));
+  if (pending_parses_.size() >= kMaxPendingParses) return;
+  PendingParse& pending = pending_parses_.emplace_back(
+      PendingParse{site, heap_->isolate()->global_handles()->Create(*payload)
+                             .location()});
+  GlobalHandles::MakeWeak(&pending.location);
+}
+
+void PretenuringHandler::NotifyPretenuredParse(size_t bytes) {
+  pretenured_parse_bytes_ += bytes;
+  heap_->isolate()->counters()->parse_pretenured_bytes()->Increment(
+      static_cast<int>(std::min<size_t>(bytes, kMaxInt)));
+}
+
+void PretenuringHandler::ProcessParseFeedback() {
+  if (pending_parses_.empty()) return;
+  if (parse_site_feedback_.size() >= kMaxParseSites) {
+    parse_site_feedback_.clear();
+  }
+  for (const PendingParse& pending : pending_parses_) {
+    const bool survived = pending.location != nullptr;
+    if (survived) GlobalHandles::Destroy(pending.location);
+    ParseSiteFeedback& feedback = parse_site_feedback_[pending.site];
+    feedback.samples = std::min(feedback.samples + 1, kMaxParseSamples);
+    feedback.survival_rate +=
+        ((survived ? 1.0 : 0.0) - feedback.survival_rate) / feedback.samples;
+  }
+  pending_parses_.clear();
+}
+
+ParsePretenuringScope::ParsePretenuringScope(Isolate* isolate, Kind kind,
+                                             size_t payload_size)
+    : heap_(isolate->heap()),
+      tracked_(v8_flags.parse_pretenuring &&
+               payload_size >= PretenuringHandler::kMinParsePayloadSize) {
+  if (!tracked_) return;
+  site_ = CurrentSite(isolate, kind);
+  allocation_ = heap_->pretenuring_handler()->AllocationTypeForParseSite(site_);
+  if (allocation_ == AllocationType::kOld) {
+    old_generation_size_at_start_ = heap_->OldGenerationSizeOfObjects();
+  }
+}
+
+void ParsePretenuringScope::SetResult(DirectHandle<Object> result) {
+  if (!tracked_) return;
+  PretenuringHandler* handler = heap_->pretenuring_handler();
+  if (allocation_ == AllocationType::kOld) {
+    // Approximates the payload size, it may be off by the remainder of linear
+    // allocation areas or objects freed by a GC during the parse.
+    const size_t old_generation_size = heap_->OldGenerationSizeOfObjects();
+    if (old_generation_size > old_generation_size_at_start_) {
+      handler->NotifyPretenuredParse(old_generation_size -
+                                     old_generation_size_at_start_);
+    }
+    return;
+  }
+  if (!IsHeapObject(*result)) return;
+  DirectHandle<HeapObject> payload = Cast<HeapObject>(result);
+  // Payloads that were promoted by a GC during the parse already survived.
+  if (!Heap::InYoungGeneration(*payload)) return;
+  handler->TrackParseSurvival(site_, payload);
+}
+
+// static
+uint64_t ParsePretenuringScope::CurrentSite(Isolate* isolate, Kind kind) {
+  size_t hash = static_cast<size_t>(kind);
+  JavaScriptStackFrameIterator it(isolate);
+  if (!it.done()) {
+    Tagged<SharedFunctionInfo> shared = it.frame()->function()->shared();
+    Tagged<Object> script = shared->script();
+    return base::Hasher(hash)
+        .Add(IsScript(script) ? Cast<Script>(script)->id() : -1)
+        .Add(shared->StartPosition())
+        .hash();
+  }
+  return hash;
+}
 
 }  // namespace internal
 }  // namespace v8
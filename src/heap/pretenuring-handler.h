@@ -5,8 +5,12 @@
 #ifndef V8_HEAP_PRETENURING_HANDLER_H_
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
+#include <list>
 #include <memory>
+#include <unordered_map>
 
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
 #include "src/objects/allocation-site.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/map.h"
@@ -17,6 +21,7 @@ namespace internal {
 template <typename T>
 class GlobalHandleVector;
 class Heap;
+class Isolate;
 
 class PretenuringHandler final {
  public:
@@ -77,7 +82,42 @@ class PretenuringHandler final {
 
   V8_EXPORT_PRIVATE static int GetMinMementoCountForTesting();
 
+  // ===========================================================================
+  // Pretenuring of parsed payloads. ===========================================
+  // ===========================================================================
+
+  // JSON.parse and the ValueDeserializer don't create allocation mementos.
+  // Instead, the survival of whole payloads is tracked per parse site, see
+  // ParsePretenuringScope. Smaller payloads are not tracked.
+  static constexpr size_t kMinParsePayloadSize = 32 * KB;
+
+  // Returns where the payload of a parse at `site` should be allocated.
+  AllocationType AllocationTypeForParseSite(uint64_t site);
+
+  // Records whether the young `payload` survives the next GC.
+  void TrackParseSurvival(uint64_t site, DirectHandle<HeapObject> payload);
+
+  void NotifyPretenuredParse(size_t bytes);
+
+  // Digests the survival of tracked payloads. Invoked after each GC.
+  void ProcessParseFeedback();
+
+  size_t pretenured_parse_bytes() const { return pretenured_parse_bytes_; }
+
  private:
+  struct ParseSiteFeedback {
+    double survival_rate = 0.0;
+    uint32_t samples = 0;
+    uint32_t pretenured_parses = 0;
+  };
+
+  struct PendingParse {
+    uint64_t site;
+    // Weak global handle to the payload, cleared by the GC if the payload
+    // died.
+    Address* location;
+  };
+
   Heap* const heap_;
 
   // The feedback storage is used to store allocation sites (keys) and how often
@@ -89,6 +129,41 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  std::unordered_map<uint64_t, ParseSiteFeedback> parse_site_feedback_;
+  // A list as the GC clears the handle locations in place.
+  std::list<PendingParse> pending_parses_;
+  size_t pretenured_parse_bytes_ = 0;
+};
+
+// Collects pretenuring feedback for a single parse of a payload without
+// allocation mementos. Parse sites are identified by the kind of parse and the
+// innermost JavaScript function on the stack. Payloads of sites whose payloads
+// usually survive a GC are allocated in old space directly, which saves the
+// young generation GC from copying them.
+class V8_NODISCARD ParsePretenuringScope final {
+ public:
+  enum class Kind : uint8_t { kJsonParse, kDeserialize };
+
+  ParsePretenuringScope(Isolate* isolate, Kind kind, size_t payload_size);
+
+  ParsePretenuringScope(const ParsePretenuringScope&) = delete;
+  ParsePretenuringScope& operator=(const ParsePretenuringScope&) = delete;
+
+  // The allocation type to use for the objects of the payload.
+  AllocationType allocation() const { return allocation_; }
+
+  // Reports the root of the parsed payload. Must be called at most once.
+  void SetResult(DirectHandle<Object> result);
+
+ private:
+  static uint64_t CurrentSite(Isolate* isolate, Kind kind);
+
+  Heap* const heap_;
+  const bool tracked_;
+  uint64_t site_ = 0;
+  AllocationType allocation_ = AllocationType::kYoung;
+  size_t old_generation_size_at_start_ = 0;
 };
 
 }  // namespace internal
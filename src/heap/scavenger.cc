@@ -7,6 +7,7 @@
 #include <atomic>
 #include <optional>
 
+#include "src/base/platform/yield-processor.h"
 #include "src/common/globals.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
@@ -684,7 +685,10 @@ Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
       heap_(heap),
       empty_chunks_local_(*empty_chunks),
       promotion_list_local_(promotion_list),
-      copied_list_local_(*copied_list),
+      copied_list_local_(*copied_list,
+                         v8_flags.gc_work_stealing
+                             ? CopiedList::Local::WorkStealing::kEnabled
+                             : CopiedList::Local::WorkStealing::kDisabled),
       ephemeron_table_list_local_(*ephemeron_table_list),
       pretenuring_handler_(heap_->pretenuring_handler()),
       local_pretenuring_feedback_(PretenuringHandler::kInitialFeedbackCapacity),
@@ -842,7 +846,26 @@ void Scavenger::Process(JobDelegate* delegate) {
         }
       }
     }
-  } while (!done);
+  } while (!done || (delegate && WaitForWorkToSteal(delegate)));
+}
+
+bool Scavenger::WaitForWorkToSteal(JobDelegate* delegate) {
+  static constexpr int kSpinsPerAttempt = 64;
+  if (!copied_list_local_.IsWorkStealingEnabled()) return false;
+  // The failed Pop() registered a steal request. Give busy scavengers the
+  // chance to donate parts of their private work before giving up.
+  for (int attempt = 0; attempt < v8_flags.gc_work_stealing_attempts;
+       ++attempt) {
+    if (delegate->ShouldYield()) return false;
+    for (int i = 0; i < kSpinsPerAttempt; ++i) {
+      YIELD_PROCESSOR;
+    }
+    if (!copied_list_local_.IsGlobalEmpty() ||
+        !promotion_list_local_.IsGlobalPoolEmpty()) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void ScavengerCollector::ProcessWeakReferences(
@@ -907,6 +930,10 @@ void ScavengerCollector::ClearOldEphemerons() {
 }
 
 void Scavenger::Finalize() {
+  if (copied_list_local_.IsWorkStealingEnabled()) {
+    heap()->tracer()->AddWorkStealingStats(copied_list_local_.steals(),
+                                           copied_list_local_.idle_events());
+  }
   pretenuring_handler_->MergeAllocationSitePretenuringFeedback(
       local_pretenuring_feedback_);
   heap()->IncrementNewSpaceSurvivingObjectSize(copied_size_);
@@ -123,6 +123,10 @@ class Scavenger {
 
   inline void PageMemoryFence(Tagged<MaybeObject> object);
 
+  // Spins until some other scavenger donated work in response to a steal
+  // request. Returns false if no work showed up, see --gc-work-stealing.
+  bool WaitForWorkToSteal(JobDelegate* delegate);
+
   void AddPageToSweeperIfNecessary(MutablePageMetadata* page);
 
   // Potentially scavenges an object referenced from |slot| if it is
@@ -16,6 +16,7 @@
 #include "src/init/heap-symbols.h"
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/objects/arguments.h"
 #include "src/objects/call-site-info.h"
 #include "src/objects/cell-inl.h"
@@ -1325,6 +1326,10 @@ void Heap::CreateInitialMutableObjects() {
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
+  // Allocate cache for the maps of objects created by JSON.parse.
+  set_json_object_map_cache(*factory->NewFixedArray(JsonObjectMapCache::kSize,
+                                                    AllocationType::kOld));
+
   // Allocate FeedbackCell for builtins.
   DirectHandle<FeedbackCell> many_closures_cell =
       factory->NewManyClosuresCell();
@@ -1336,6 +1341,8 @@ void Heap::CreateInitialMutableObjects() {
   set_functions_marked_for_manual_optimization(roots.undefined_value());
   set_shared_wasm_memories(roots.empty_weak_array_list());
   set_locals_block_list_cache(roots.undefined_value());
+  set_deopt_history_table(roots.undefined_value());
+  set_dictionary_to_fast_map_cache(roots.undefined_value());
 #ifdef V8_ENABLE_WEBASSEMBLY
   set_active_continuation(roots.undefined_value());
   set_active_suspender(roots.undefined_value());
@@ -1393,8 +1400,9 @@ void Heap::CreateInitialMutableObjects() {
   // Initialize builtins constants table.
   set_builtins_constants_table(roots.empty_fixed_array());
 
-  // Initialize descriptor cache.
+  // Initialize descriptor and transition caches.
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
 
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
@@ -186,7 +186,7 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
       Bucket* bucket = LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
       if (bucket) {
         if (possibly_empty_buckets->Contains(bucket_index)) {
-          if (bucket->IsEmpty()) {
+          if (IsEmptyBucket(bucket)) {
             ReleaseBucket<AccessMode::NON_ATOMIC>(bucket_index);
           } else {
             empty = false;
@@ -202,6 +202,7 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
     }
 
     possibly_empty_buckets->Release();
+    FreeRetiredSparseBuckets();
 
     return empty;
   }
@@ -215,14 +216,21 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
       if (bucket == nullptr) {
         other->StoreBucket<AccessMode::NON_ATOMIC>(bucket_index, nullptr);
         StoreBucket<AccessMode::NON_ATOMIC>(bucket_index, other_bucket);
-      } else {
+      } else if (!IsSparseBucket(bucket) && !IsSparseBucket(other_bucket)) {
         for (int cell_index = 0; cell_index < kCellsPerBucket; cell_index++) {
           bucket->SetCellBits<AccessMode::NON_ATOMIC>(
               cell_index,
               other_bucket->LoadCell<AccessMode::NON_ATOMIC>(cell_index));
         }
+      } else {
+        const size_t bucket_offset = OffsetForBucket(bucket_index);
+        ForEachSlotInBucket(other_bucket, [this,
+                                           bucket_offset](size_t slot) {
+          Insert<AccessMode::NON_ATOMIC>(bucket_offset + slot * kTaggedSize);
+        });
       }
     }
+    FreeRetiredSparseBuckets();
   }
 };
 
@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/slow-path-counters.h"
+
+#include <algorithm>
+
+#include "src/flags/flags.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+// Entries of the current thread that were not yet added to a heap's counters.
+thread_local std::array<uint32_t, SlowPathCounters::kNumWriteBarrierKinds>
+    write_barrier_tallies{};
+}  // namespace
+
+// static
+void SlowPathCounters::RecordWriteBarrier(Heap* heap, WriteBarrierKind kind) {
+  const size_t index = static_cast<size_t>(kind);
+  const uint32_t interval =
+      std::max(1u, v8_flags.write_barrier_slow_path_sampling_interval.value());
+  if (++write_barrier_tallies[index] < interval) return;
+  write_barrier_tallies[index] = 0;
+  heap->slow_path_counters()->write_barrier_[index].fetch_add(
+      interval, std::memory_order_relaxed);
+}
+
+void SlowPathCounters::ReportFullCycle(
+    v8::metrics::GarbageCollectionSlowPaths* event) {
+  auto write_barrier_delta = [this](WriteBarrierKind kind) {
+    const size_t index = static_cast<size_t>(kind);
+    const size_t count = write_barrier(kind);
+    const size_t delta = count - reported_write_barrier_[index];
+    reported_write_barrier_[index] = count;
+    return static_cast<int64_t>(delta);
+  };
+  auto allocation_delta = [this](AllocationReason reason) {
+    const size_t index = static_cast<size_t>(reason);
+    const size_t count = allocation(reason);
+    const size_t delta = count - reported_allocation_[index];
+    reported_allocation_[index] = count;
+    return static_cast<int64_t>(delta);
+  };
+  event->generational_write_barrier =
+      write_barrier_delta(WriteBarrierKind::kGenerational);
+  event->marking_write_barrier =
+      write_barrier_delta(WriteBarrierKind::kMarking);
+  event->shared_write_barrier = write_barrier_delta(WriteBarrierKind::kShared);
+  event->allocation_lab_exhausted =
+      allocation_delta(AllocationReason::kLabExhausted);
+  event->allocation_observer_step =
+      allocation_delta(AllocationReason::kObserverStep);
+  event->allocation_gc_needed = allocation_delta(AllocationReason::kGCNeeded);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_SLOW_PATH_COUNTERS_H_
+#define V8_HEAP_SLOW_PATH_COUNTERS_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "include/v8-metrics.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Counts how often the write barrier and the allocation functions of a heap
+// take their slow paths. Counters are updated by all threads of the heap and
+// read with HeapStatistics and the GarbageCollectionFullCycle metrics event.
+class V8_EXPORT_PRIVATE SlowPathCounters final {
+ public:
+  enum class WriteBarrierKind : uint8_t {
+    // Recorded an old-to-new slot.
+    kGenerational,
+    // Marked a value while marking is on.
+    kMarking,
+    // Recorded a slot pointing into the shared heap.
+    kShared,
+  };
+  static constexpr size_t kNumWriteBarrierKinds =
+      static_cast<size_t>(WriteBarrierKind::kShared) + 1;
+
+  enum class AllocationReason : uint8_t {
+    // The LAB was refilled.
+    kLabExhausted,
+    // The LAB was refilled and allocation observers were stepped.
+    kObserverStep,
+    // The LAB could not be refilled, so the caller has to collect garbage.
+    kGCNeeded,
+  };
+  static constexpr size_t kNumAllocationReasons =
+      static_cast<size_t>(AllocationReason::kGCNeeded) + 1;
+
+  // Records a write barrier slow path entry. The write barrier is too hot to
+  // update shared counters on each entry, so entries are tallied per thread
+  // and added to the counters of `heap` once every
+  // --write-barrier-slow-path-sampling-interval entries. Counts thus lag by
+  // less than the interval per thread.
+  static void RecordWriteBarrier(Heap* heap, WriteBarrierKind kind);
+
+  // Records an allocation slow path entry. LAB refills are rare enough to be
+  // counted exactly.
+  void RecordAllocation(AllocationReason reason) {
+    allocation_[static_cast<size_t>(reason)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  size_t write_barrier(WriteBarrierKind kind) const {
+    return write_barrier_[static_cast<size_t>(kind)].load(
+        std::memory_order_relaxed);
+  }
+
+  size_t allocation(AllocationReason reason) const {
+    return allocation_[static_cast<size_t>(reason)].load(
+        std::memory_order_relaxed);
+  }
+
+  // Fills `event` with the entries since the previous call. Only called on the
+  // main thread.
+  void ReportFullCycle(v8::metrics::GarbageCollectionSlowPaths* event);
+
+ private:
+  std::array<std::atomic<size_t>, kNumWriteBarrierKinds> write_barrier_{};
+  std::array<std::atomic<size_t>, kNumAllocationReasons> allocation_{};
+  std::array<size_t, kNumWriteBarrierKinds> reported_write_barrier_{};
+  std::array<size_t, kNumAllocationReasons> reported_allocation_{};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_SLOW_PATH_COUNTERS_H_
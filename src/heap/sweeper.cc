@@ -29,6 +29,7 @@
 #include "src/heap/memory-chunk-layout.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/new-spaces.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/heap/page-metadata-inl.h"
 #include "src/heap/paged-spaces.h"
 #include "src/heap/pretenuring-handler-inl.h"
@@ -58,6 +59,7 @@ class Sweeper::ConcurrentMajorSweeper final {
       if (page == nullptr) return true;
       local_sweeper_.ParallelSweepPage(page, identity,
                                        SweepingMode::kLazyOrConcurrent);
+      delegate->NotifyProgress(1);
     }
     TRACE_GC_NOTE("Sweeper::ConcurrentMajorSweeper Preempted");
     return false;
@@ -86,6 +88,7 @@ class Sweeper::ConcurrentMinorSweeper final {
       if (page == nullptr) return true;
       local_sweeper_.ParallelSweepPage(page, kNewSpace,
                                        SweepingMode::kLazyOrConcurrent);
+      delegate->NotifyProgress(1);
     }
     TRACE_GC_NOTE("Sweeper::ConcurrentMinorSweeper Preempted");
     return false;
@@ -1051,6 +1054,14 @@ void Sweeper::RawSweep(PageMetadata* p,
   // The free ranges map is used for filtering typed slots.
   TypedSlotSet::FreeRangesMap free_ranges_map;
 
+  // The object start bitmap is rebuilt from the live objects and free ranges.
+  ObjectStartBitmap* object_start_bitmap = nullptr;
+  if (v8_flags.conservative_stack_scanning &&
+      space->identity() != NEW_SPACE) {
+    object_start_bitmap = p->GetOrCreateObjectStartBitmap();
+    object_start_bitmap->Clear();
+  }
+
   // Iterate over the page using the live objects and free the memory before
   // the given live object.
   Address free_start = p->area_start();
@@ -1064,6 +1075,12 @@ void Sweeper::RawSweep(PageMetadata* p,
       CleanupRememberedSetEntriesForFreedMemory(
           free_start, free_end, p, record_free_ranges, &free_ranges_map,
           sweeping_mode);
+      if (object_start_bitmap) {
+        object_start_bitmap->Set(p->Chunk()->Offset(free_start));
+      }
+    }
+    if (object_start_bitmap) {
+      object_start_bitmap->Set(p->Chunk()->Offset(free_end));
     }
     live_bytes += size;
     free_start = free_end + size;
@@ -1084,6 +1101,9 @@ void Sweeper::RawSweep(PageMetadata* p,
     CleanupRememberedSetEntriesForFreedMemory(free_start, free_end, p,
                                               record_free_ranges,
                                               &free_ranges_map, sweeping_mode);
+    if (object_start_bitmap) {
+      object_start_bitmap->Set(p->Chunk()->Offset(free_start));
+    }
   }
 
   // Phase 3: Post process the page.
@@ -182,6 +182,12 @@ void WeakObjects::UpdateWeakCells(
   DCHECK(!ContainsYoungObjects(weak_cells));
 }
 
+// static
+void WeakObjects::UpdateWeakCellsUnmarked(
+    WeakObjectWorklist<Tagged<WeakCell>>& weak_cells_unmarked) {
+  DCHECK(!ContainsYoungObjects(weak_cells_unmarked));
+}
+
 // static
 void WeakObjects::UpdateCodeFlushingCandidates(
     WeakObjectWorklist<Tagged<SharedFunctionInfo>>& code_flushing_candidates) {
@@ -76,6 +76,9 @@ class TransitionArray;
   F(HeapObjectAndCode, weak_objects_in_code, WeakObjectsInCode)               \
   F(Tagged<JSWeakRef>, js_weak_refs, JSWeakRefs)                              \
   F(Tagged<WeakCell>, weak_cells, WeakCells)                                  \
+  /* WeakCells whose target or unregister token is dead, filtered out of      \
+     weak_cells in parallel before clearing. */                               \
+  F(Tagged<WeakCell>, weak_cells_unmarked, WeakCellsUnmarked)                 \
   F(Tagged<SharedFunctionInfo>, code_flushing_candidates,                     \
     CodeFlushingCandidates)                                                   \
   F(Tagged<JSFunction>, baseline_flushing_candidates,                         \
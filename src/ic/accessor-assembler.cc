@@ -867,6 +867,7 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
       TVARIABLE(Object, var_value);
       LoadPropertyFromDictionary<PropertyDictionary>(
           properties, var_name_index.value(), &var_details, &var_value);
+      CountDictionaryPropertyLoad(p->context(), CAST(holder), properties);
       TNode<Object> value = CallGetterIfAccessor(
           var_value.value(), CAST(holder), var_details.value(), p->context(),
           p->receiver(), p->name(), miss);
@@ -1654,6 +1655,37 @@ void AccessorAssembler::UpdateMayHaveInterestingProperty(
   BIND(&done);
 }
 
+void AccessorAssembler::CountDictionaryPropertyLoad(
+    TNode<Context> context, TNode<HeapObject> holder,
+    TNode<PropertyDictionary> dict) {
+  Comment("CountDictionaryPropertyLoad");
+  Label done(this);
+
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    // TODO(pthier): Add flags to swiss dictionaries.
+    Goto(&done);
+  } else {
+    Label migrate(this, Label::kDeferred);
+    TNode<Int32T> flags = SmiToInt32(GetNameDictionaryFlags(dict));
+    TNode<Uint32T> count = DecodeWord32<NameDictionary::ReadCountBits>(flags);
+    GotoIf(Word32Equal(count,
+                       Uint32Constant(NameDictionary::ReadCountBits::kMax)),
+           &done);
+    TNode<Uint32T> new_count = Uint32Add(count, Uint32Constant(1));
+    TNode<Uint32T> new_flags = Unsigned(
+        UpdateWord32<NameDictionary::ReadCountBits>(flags, new_count));
+    SetNameDictionaryFlags(dict, SmiFromUint32(new_flags));
+    Branch(Word32Equal(new_count,
+                       Uint32Constant(NameDictionary::ReadCountBits::kMax)),
+           &migrate, &done);
+
+    BIND(&migrate);
+    CallRuntime(Runtime::kTryMigrateReadMostlyToFast, context, holder);
+    Goto(&done);
+  }
+  BIND(&done);
+}
+
 void AccessorAssembler::CheckFieldType(TNode<DescriptorArray> descriptors,
                                        TNode<IntPtrT> name_index,
                                        TNode<Word32T> representation,
@@ -2942,6 +2974,8 @@ void AccessorAssembler::GenericPropertyLoad(
     {
       LoadPropertyFromDictionary<PropertyDictionary>(
           properties, var_name_index.value(), &var_details, &var_value);
+      CountDictionaryPropertyLoad(p->context(), lookup_start_object,
+                                  properties);
       Goto(&if_found_on_lookup_start_object);
     }
   }
@@ -3051,7 +3085,7 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
+  uint32_t mask = ((1 << StubCache::kMaxPrimaryTableBits) - 1)
                   << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -3069,7 +3103,7 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
+  int32_t mask = ((1 << StubCache::kMaxSecondaryTableBits) - 1)
                  << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -3081,14 +3115,19 @@ void AccessorAssembler::TryProbeStubCacheTable(
     TNode<Object> name, TNode<Map> map, Label* if_handler,
     TVariable<MaybeObject>* var_handler, Label* if_miss) {
   StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  // The tables can be resized, so mask the offset down to the current table
+  // size.
+  TNode<Uint32T> mask = Load<Uint32T>(ExternalConstant(
+      ExternalReference::Create(stub_cache->mask_reference(table))));
+  entry_offset = Signed(WordAnd(entry_offset, ChangeUint32ToWord(mask)));
   // The {table_offset} holds the entry offset times four (due to masking
   // and shifting optimizations).
   const int kMultiplier =
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  TNode<RawPtrT> key_base = Load<RawPtrT>(ExternalConstant(
+      ExternalReference::Create(stub_cache->table_reference(table))));
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
@@ -3108,6 +3147,11 @@ void AccessorAssembler::TryProbeStubCacheTable(
                      IntPtrConstant(offsetof(StubCache::Entry, value)))));
 
   // We found the handler.
+  TNode<ExternalReference> hit_count_address = ExternalConstant(
+      ExternalReference::Create(stub_cache->hit_count_reference()));
+  StoreNoWriteBarrier(
+      MachineType::PointerRepresentation(), hit_count_address,
+      IntPtrAdd(Load<IntPtrT>(hit_count_address), IntPtrConstant(1)));
   *var_handler = handler;
   Goto(if_handler);
 }
@@ -308,6 +308,13 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   void UpdateMayHaveInterestingProperty(TNode<PropertyDictionary> dict,
                                         TNode<Name> name);
 
+  // Counts a load of an own property of the dictionary-mode |holder|, and
+  // asks the runtime to migrate it to fast properties once it turns out to be
+  // read-mostly.
+  void CountDictionaryPropertyLoad(TNode<Context> context,
+                                   TNode<HeapObject> holder,
+                                   TNode<PropertyDictionary> dict);
+
   void JumpIfDataProperty(TNode<Uint32T> details, Label* writable,
                           Label* readonly);
 
@@ -4,6 +4,7 @@
 
 #include "src/ic/ic-stats.h"
 
+#include "src/base/functional.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
@@ -39,6 +40,13 @@ void ICStats::Reset() {
     ic_info.Reset();
   }
   pos_ = 0;
+  stub_cache_hits_ = 0;
+  stub_cache_misses_ = 0;
+}
+
+void ICStats::AddStubCacheStats(uint64_t hits, uint64_t misses) {
+  stub_cache_hits_ += hits;
+  stub_cache_misses_ += misses;
 }
 
 void ICStats::Dump() {
@@ -48,6 +56,9 @@ void ICStats::Dump() {
     ic_infos_[i].AppendToTracedValue(value.get());
   }
   value->EndArray();
+  // Counts can exceed the range of an int, like addresses in ICInfo.
+  value->SetString("stubCacheHits", std::to_string(stub_cache_hits_));
+  value->SetString("stubCacheMisses", std::to_string(stub_cache_misses_));
 
   TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.ic_stats"), "V8.ICStats",
                        TRACE_EVENT_SCOPE_THREAD, "ic-stats", std::move(value));
@@ -143,5 +154,60 @@ void ICInfo::AppendToTracedValue(v8::tracing::TracedValue* value) const {
   value->EndDictionary();
 }
 
+size_t ICSiteStats::SiteKeyHash::operator()(const SiteKey& key) const {
+  return base::hash_combine(reinterpret_cast<uintptr_t>(key.type), key.keyed,
+                            key.script_id, key.position);
+}
+
+void ICSiteStats::RecordMiss(const char* type, bool keyed,
+                             Tagged<SharedFunctionInfo> shared, int position,
+                             InlineCacheState old_state,
+                             InlineCacheState new_state) {
+  if (--misses_until_decay_ == 0) Decay();
+  Tagged<Object> script = shared->script();
+  int script_id = IsScript(script) ? Cast<Script>(script)->id() : -1;
+  SiteKey key{type, keyed, script_id, position};
+  auto it = sites_.find(key);
+  if (it == sites_.end()) {
+    // Sites that keep missing make it in once the next decay drops the sites
+    // that stopped missing.
+    if (sites_.size() >= kMaxSites) return;
+    Site site;
+    site.type = keyed ? "Keyed" : "";
+    site.type += type;
+    site.function_name = shared->DebugNameCStr().get();
+    site.script_id = script_id;
+    site.position = position;
+    site.misses = 0;
+    site.transitions = 0;
+    it = sites_.emplace(key, std::move(site)).first;
+  }
+  Site& site = it->second;
+  site.state = new_state;
+  site.misses++;
+  if (old_state != new_state) site.transitions++;
+}
+
+std::vector<ICSiteStats::Site> ICSiteStats::GetSites() const {
+  std::vector<Site> result;
+  result.reserve(sites_.size());
+  for (const auto& [key, site] : sites_) result.push_back(site);
+  return result;
+}
+
+void ICSiteStats::Decay() {
+  misses_until_decay_ = kDecayInterval;
+  for (auto it = sites_.begin(); it != sites_.end();) {
+    Site& site = it->second;
+    site.misses /= 2;
+    site.transitions /= 2;
+    if (site.misses == 0) {
+      it = sites_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -13,6 +13,7 @@
 #include "include/v8-internal.h"  // For Address.
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
+#include "src/common/globals.h"
 #include "src/sandbox/isolate.h"
 
 namespace v8 {
@@ -25,6 +26,7 @@ namespace internal {
 
 class JSFunction;
 class Script;
+class SharedFunctionInfo;
 template <typename T>
 class Tagged;
 
@@ -63,6 +65,9 @@ class ICStats {
     DCHECK(pos_ >= 0 && pos_ < MAX_IC_INFO);
     return ic_infos_[pos_];
   }
+  // Accumulates the hits and misses of a megamorphic stub cache, which are
+  // included in the next dump.
+  void AddStubCacheStats(uint64_t hits, uint64_t misses);
   const char* GetOrCacheScriptName(Tagged<Script> script);
   const char* GetOrCacheFunctionName(IsolateForSandbox isolate,
                                      Tagged<JSFunction> function);
@@ -77,6 +82,54 @@ class ICStats {
   // Keys are JSFunction pointers; uses raw Address to keep includes light.
   std::unordered_map<Address, std::unique_ptr<char[]>> function_name_map_;
   int pos_;
+  uint64_t stub_cache_hits_ = 0;
+  uint64_t stub_cache_misses_ = 0;
+};
+
+// Aggregates the misses and state transitions of the inline caches of an
+// isolate per access site, enabled by --ic-site-stats. Unlike ICStats, it
+// keeps a bounded summary instead of a trace of every miss: all counts are
+// halved periodically, and sites whose counts decay to zero are dropped.
+class ICSiteStats final {
+ public:
+  struct Site {
+    std::string type;
+    std::string function_name;
+    int script_id;
+    int position;
+    InlineCacheState state;
+    uint64_t misses;
+    uint64_t transitions;
+  };
+
+  void RecordMiss(const char* type, bool keyed,
+                  Tagged<SharedFunctionInfo> shared, int position,
+                  InlineCacheState old_state, InlineCacheState new_state);
+  std::vector<Site> GetSites() const;
+
+ private:
+  struct SiteKey {
+    const char* type;
+    bool keyed;
+    int script_id;
+    int position;
+    bool operator==(const SiteKey& other) const {
+      return type == other.type && keyed == other.keyed &&
+             script_id == other.script_id && position == other.position;
+    }
+  };
+  struct SiteKeyHash {
+    size_t operator()(const SiteKey& key) const;
+  };
+
+  static constexpr size_t kMaxSites = 1024;
+  // All counts are halved after this many misses.
+  static constexpr uint64_t kDecayInterval = 64 * 1024;
+
+  void Decay();
+
+  std::unordered_map<SiteKey, Site, SiteKeyHash> sites_;
+  uint64_t misses_until_decay_ = kDecayInterval;
 };
 
 }  // namespace internal
@@ -112,6 +112,25 @@ const char* GetModifier(KeyedAccessStoreMode mode) {
   UNREACHABLE();
 }
 
+// Returns the code the frame executes and the frame's offset into it.
+Tagged<AbstractCode> GetCodeAndOffset(Isolate* isolate, JavaScriptFrame* frame,
+                                      int* code_offset) {
+  Tagged<JSFunction> function = frame->function();
+  if (function->ActiveTierIsIgnition(isolate)) {
+    *code_offset = InterpretedFrame::GetBytecodeOffset(frame->fp());
+    return function->abstract_code(isolate);
+  }
+  if (function->ActiveTierIsBaseline(isolate)) {
+    // TODO(pthier): AbstractCode should fully support Baseline code.
+    BaselineFrame* baseline_frame = BaselineFrame::cast(frame);
+    *code_offset = baseline_frame->GetBytecodeOffset();
+    return Cast<AbstractCode>(baseline_frame->GetBytecodeArray());
+  }
+  *code_offset =
+      static_cast<int>(frame->pc() - function->instruction_start(isolate));
+  return function->abstract_code(isolate);
+}
+
 }  // namespace
 
 void IC::TraceIC(const char* type, DirectHandle<Object> name) {
@@ -141,6 +160,11 @@ void IC::TraceIC(const char* type, DirectHandle<Object> name, State old_state,
 
   bool keyed_prefix = is_keyed() && !IsStoreInArrayLiteralIC();
 
+  if (TracingFlags::ic_stats.load(std::memory_order_relaxed) &
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SITE_STATS) {
+    RecordSiteMiss(type, keyed_prefix, old_state, new_state);
+  }
+
   if (!(TracingFlags::ic_stats.load(std::memory_order_relaxed) &
         v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     LOG(isolate(), ICEvent(type, keyed_prefix, map, name,
@@ -162,18 +186,7 @@ void IC::TraceIC(const char* type, DirectHandle<Object> name, State old_state,
   ic_info.type += type;
 
   int code_offset = 0;
-  Tagged<AbstractCode> code = function->abstract_code(isolate_);
-  if (function->ActiveTierIsIgnition(isolate())) {
-    code_offset = InterpretedFrame::GetBytecodeOffset(frame->fp());
-  } else if (function->ActiveTierIsBaseline(isolate())) {
-    // TODO(pthier): AbstractCode should fully support Baseline code.
-    BaselineFrame* baseline_frame = BaselineFrame::cast(frame);
-    code_offset = baseline_frame->GetBytecodeOffset();
-    code = Cast<AbstractCode>(baseline_frame->GetBytecodeArray());
-  } else {
-    code_offset =
-        static_cast<int>(frame->pc() - function->instruction_start(isolate()));
-  }
+  Tagged<AbstractCode> code = GetCodeAndOffset(isolate(), frame, &code_offset);
   JavaScriptFrame::CollectFunctionAndOffsetForICStats(isolate(), function, code,
                                                       code_offset);
 
@@ -197,6 +210,22 @@ void IC::TraceIC(const char* type, DirectHandle<Object> name, State old_state,
   ICStats::instance()->End();
 }
 
+void IC::RecordSiteMiss(const char* type, bool keyed, State old_state,
+                        State new_state) {
+  ICSiteStats* site_stats = isolate()->ic_site_stats();
+  if (site_stats == nullptr) return;
+  JavaScriptStackFrameIterator it(isolate());
+  if (it.done()) return;
+  JavaScriptFrame* frame = it.frame();
+
+  DisallowGarbageCollection no_gc;
+  int code_offset = 0;
+  Tagged<AbstractCode> code = GetCodeAndOffset(isolate(), frame, &code_offset);
+  site_stats->RecordMiss(type, keyed, frame->function()->shared(),
+                         code->SourcePosition(isolate(), code_offset),
+                         old_state, new_state);
+}
+
 IC::IC(Isolate* isolate, Handle<FeedbackVector> vector, FeedbackSlot slot,
        FeedbackSlotKind kind)
     : isolate_(isolate),
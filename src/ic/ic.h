@@ -97,6 +97,8 @@ class IC {
   void TraceIC(const char* type, DirectHandle<Object> name);
   void TraceIC(const char* type, DirectHandle<Object> name, State old_state,
                State new_state);
+  void RecordSiteMiss(const char* type, bool keyed, State old_state,
+                      State new_state);
 
   MaybeHandle<Object> TypeError(MessageTemplate, Handle<Object> object,
                                 Handle<Object> key);
@@ -263,6 +263,17 @@ void KeyedStoreGenericGenerator::CreateDataProperty(
   assembler.StoreProperty(context, receiver, key, value, LanguageMode::kStrict);
 }
 
+// static
+void KeyedStoreGenericGenerator::CreateDataProperty(
+    compiler::CodeAssemblerState* state, TNode<Context> context,
+    TNode<JSObject> receiver, TNode<BoolT> is_simple_receiver, TNode<Name> name,
+    TNode<Object> value) {
+  KeyedStoreGenericAssembler assembler(state,
+                                       StoreMode::kDefineKeyedOwnInLiteral);
+  assembler.StoreProperty(context, receiver, is_simple_receiver, name, value,
+                          LanguageMode::kStrict);
+}
+
 void KeyedStoreGenericAssembler::BranchIfPrototypesMayHaveReadOnlyElements(
     TNode<Map> receiver_map, Label* maybe_read_only_elements,
     Label* only_fast_writable_elements) {
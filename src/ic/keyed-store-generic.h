@@ -37,6 +37,15 @@ class KeyedStoreGenericGenerator {
                                  TNode<Context> context,
                                  TNode<JSObject> receiver, TNode<Object> key,
                                  TNode<Object> value);
+
+  // Building block for fast path of object spread, which defines the
+  // properties instead of setting them. Like the SetProperty building block
+  // above, this doesn't return.
+  static void CreateDataProperty(compiler::CodeAssemblerState* state,
+                                 TNode<Context> context,
+                                 TNode<JSObject> receiver,
+                                 TNode<BoolT> is_simple_receiver,
+                                 TNode<Name> name, TNode<Object> value);
 };
 
 class DefineKeyedOwnGenericGenerator {
@@ -4,20 +4,37 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
+#include "src/ic/ic-stats.h"
 #include "src/logging/counters.h"
+#include "src/logging/tracing-flags.h"
 #include "src/objects/tagged-value-inl.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Resizing is only considered after this many probes since the last clear.
+constexpr uintptr_t kMinProbesForResizing = 1000;
+
+}  // namespace
+
 StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
+  ResizeTables(kPrimaryTableBits, kSecondaryTableBits);
+}
+
+StubCache::~StubCache() {
+  delete[] primary_;
+  delete[] secondary_;
 }
 
 void StubCache::Initialize() {
@@ -26,6 +43,20 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::ResizeTables(int primary_table_bits,
+                             int secondary_table_bits) {
+  DCHECK_LE(primary_table_bits, kMaxPrimaryTableBits);
+  DCHECK_LE(secondary_table_bits, kMaxSecondaryTableBits);
+  delete[] primary_;
+  delete[] secondary_;
+  primary_table_bits_ = primary_table_bits;
+  secondary_table_bits_ = secondary_table_bits;
+  primary_ = new Entry[1 << primary_table_bits];
+  secondary_ = new Entry[1 << secondary_table_bits];
+  primary_mask_ = ((1 << primary_table_bits) - 1) << kCacheIndexShift;
+  secondary_mask_ = ((1 << secondary_table_bits) - 1) << kCacheIndexShift;
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -40,7 +71,7 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & (((1 << kMaxPrimaryTableBits) - 1) << kCacheIndexShift);
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -52,7 +83,7 @@ int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & (((1 << kMaxSecondaryTableBits) - 1) << kCacheIndexShift);
 }
 
 int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
@@ -86,7 +117,7 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_, primary_mask_, primary_offset);
   Tagged<MaybeObject> old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -101,7 +132,7 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
     Tagged<Name> old_name =
         Cast<Name>(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = entry(secondary_, secondary_mask_, secondary_offset);
     *secondary = *primary;
   }
 
@@ -109,18 +140,19 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  miss_count_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
 Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   DCHECK(CommonStubCacheChecks(this, name, map, Tagged<MaybeObject>()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_, primary_mask_, primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, map);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = entry(secondary_, secondary_mask_, secondary_offset);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -128,14 +160,50 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
 }
 
 void StubCache::Clear() {
+  if (TracingFlags::is_ic_stats_enabled()) {
+    ICStats::instance()->AddStubCacheStats(hit_count_, miss_count_);
+  }
+  const uintptr_t probe_count = hit_count_ + miss_count_;
+  if (v8_flags.stub_cache_adaptive_sizing &&
+      probe_count >= kMinProbesForResizing) {
+    const double miss_rate = static_cast<double>(miss_count_) / probe_count;
+    int primary_table_bits = primary_table_bits_;
+    int secondary_table_bits = secondary_table_bits_;
+    if (miss_rate > v8_flags.stub_cache_grow_miss_rate) {
+      // Entries evict each other, give them twice as much room.
+      primary_table_bits = std::min(primary_table_bits + 1,
+                                    static_cast<int>(kMaxPrimaryTableBits));
+      secondary_table_bits = std::min(secondary_table_bits + 1,
+                                      static_cast<int>(kMaxSecondaryTableBits));
+    } else if (miss_rate < v8_flags.stub_cache_grow_miss_rate / 8) {
+      // The megamorphic accesses fit well, give some memory back.
+      primary_table_bits = std::max(primary_table_bits - 1,
+                                    static_cast<int>(kPrimaryTableBits));
+      secondary_table_bits = std::max(secondary_table_bits - 1,
+                                      static_cast<int>(kSecondaryTableBits));
+    }
+    if (primary_table_bits != primary_table_bits_ ||
+        secondary_table_bits != secondary_table_bits_) {
+      if (v8_flags.trace_stub_cache_sizing) {
+        PrintIsolate(isolate(),
+                     "stub cache resized to %d/%d entries, miss rate %.3f\n",
+                     1 << primary_table_bits, 1 << secondary_table_bits,
+                     miss_rate);
+      }
+      ResizeTables(primary_table_bits, secondary_table_bits);
+    }
+  }
+  hit_count_ = 0;
+  miss_count_ = 0;
+
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < table_size(kPrimary); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < table_size(kSecondary); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
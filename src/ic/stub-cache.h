@@ -46,24 +46,38 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Tagged<Name> name, Tagged<Map> map, Tagged<MaybeObject> handler);
   Tagged<MaybeObject> Get(Tagged<Name> name, Tagged<Map> map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). With
+  // --stub-cache-adaptive-sizing, this also resizes the tables based on the
+  // miss rate since the last clear.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
+  // The tables can be resized, so generated code loads the current table and
+  // its mask through these references.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  // Counts the probes of generated code which found a handler.
+  SCTableReference hit_count_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&hit_count_));
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -76,6 +90,20 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int table_size(StubCache::Table table) const {
+    switch (table) {
+      case StubCache::kPrimary:
+        return 1 << primary_table_bits_;
+      case StubCache::kSecondary:
+        return 1 << secondary_table_bits_;
+    }
+    UNREACHABLE();
+  }
+
+  // Hits and misses since the last Clear().
+  uintptr_t hit_count() const { return hit_count_; }
+  uintptr_t miss_count() const { return miss_count_; }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,16 +113,24 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // Initial table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
+  // Largest table sizes with --stub-cache-adaptive-sizing. The offsets
+  // computed by the hash functions cover these sizes, and are masked down to
+  // the current table sizes on access.
+  static const int kMaxPrimaryTableBits = 14;
+  static const int kMaxSecondaryTableBits = 12;
+
   static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
   static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -107,32 +143,44 @@ class V8_EXPORT_PRIVATE StubCache {
   // entries are overwritten.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into the largest
+  // table that is scaled by 1 << kCacheIndexShift.
   static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into the largest
+  // table that is scaled by 1 << kCacheIndexShift.
   static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
 
+  // Reallocates the tables with the given sizes. All entries are lost.
+  void ResizeTables(int primary_table_bits, int secondary_table_bits);
+
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
-  // ends in Name::HashBits::kShift 0s.  Then we multiply it so it is a multiple
-  // of sizeof(Entry).  This makes it easier to avoid making mistakes
-  // in the hashed offset computations.
-  static Entry* entry(Entry* table, int offset) {
+  // ends in Name::HashBits::kShift 0s.  Then we mask it down to the table size
+  // and multiply it so it is a multiple of sizeof(Entry).  This makes it
+  // easier to avoid making mistakes in the hashed offset computations.
+  static Entry* entry(Entry* table, uint32_t mask, int offset) {
     // The size of {Entry} must be a multiple of 1 << kCacheIndexShift.
     static_assert((sizeof(*table) >> kCacheIndexShift) << kCacheIndexShift ==
                   sizeof(*table));
     const int multiplier = sizeof(*table) >> kCacheIndexShift;
     return reinterpret_cast<Entry*>(reinterpret_cast<Address>(table) +
-                                    offset * multiplier);
+                                    (offset & mask) * multiplier);
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  // The table sizes minus one, scaled by 1 << kCacheIndexShift.
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  int primary_table_bits_ = 0;
+  int secondary_table_bits_ = 0;
+  // Incremented by generated code.
+  uintptr_t hit_count_ = 0;
+  // Incremented by Set(), which the runtime calls after a miss.
+  uintptr_t miss_count_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
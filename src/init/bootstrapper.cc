@@ -31,6 +31,7 @@
 #include "src/extensions/vtunedomain-support-extension.h"
 #endif  // ENABLE_VTUNE_TRACEMARK
 #include "src/heap/heap-inl.h"
+#include "src/init/startup-timings.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/numbers/math-random.h"
@@ -352,6 +353,7 @@ Handle<NativeContext> Bootstrapper::CreateEnvironment(
     DeserializeEmbedderFieldsCallback embedder_fields_deserializer,
     v8::MicrotaskQueue* microtask_queue) {
   HandleScope scope(isolate_);
+  StartupTimings::ContextCreationScope startup_timings_scope(isolate_);
   Handle<NativeContext> env;
   {
     Genesis genesis(isolate_, maybe_global_proxy, global_proxy_template,
@@ -359,11 +361,13 @@ Handle<NativeContext> Bootstrapper::CreateEnvironment(
                     microtask_queue);
     env = genesis.result();
     if (env.is_null() || !InstallExtensions(env, extensions)) {
+      startup_timings_scope.Finish({});
       return {};
     }
   }
   LogAllMaps();
   isolate_->heap()->NotifyBootstrapComplete();
+  startup_timings_scope.Finish(env);
   return scope.CloseAndEscape(env);
 }
 
@@ -5501,8 +5505,11 @@ void Genesis::InitializeGlobal_harmony_iterator_helpers() {
   JSObject::ForceSetPrototype(isolate(), iterator_helper_prototype,
                               iterator_prototype);
   InstallToStringTag(isolate(), iterator_helper_prototype, "Iterator Helper");
-  SimpleInstallFunction(isolate(), iterator_helper_prototype, "next",
-                        Builtin::kIteratorHelperPrototypeNext, 0, kAdapt);
+  DirectHandle<JSFunction> iterator_helper_prototype_next =
+      SimpleInstallFunction(isolate(), iterator_helper_prototype, "next",
+                            Builtin::kIteratorHelperPrototypeNext, 0, kAdapt);
+  native_context()->set_iterator_helper_prototype_next(
+      *iterator_helper_prototype_next);
   SimpleInstallFunction(isolate(), iterator_helper_prototype, "return",
                         Builtin::kIteratorHelperPrototypeReturn, 0, kAdapt);
   SimpleInstallFunction(isolate(), iterator_prototype, "reduce",
@@ -653,6 +653,7 @@
   F(MC_CLEAR_FLUSHED_JS_FUNCTIONS)               \
   F(MC_CLEAR_JOIN_JOB)                           \
   F(MC_CLEAR_JS_WEAK_REFERENCES)                 \
+  F(MC_CLEAR_JS_WEAK_REFERENCES_FILTER)          \
   F(MC_CLEAR_MAPS)                               \
   F(MC_CLEAR_SLOTS_BUFFER)                       \
   F(MC_CLEAR_STRING_TABLE)                       \
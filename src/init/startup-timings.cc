@@ -0,0 +1,103 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/init/startup-timings.h"
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/logging/metrics.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+StartupTimings::Scope::Scope(Isolate* isolate, Phase phase)
+    : timings_(isolate->startup_timings()),
+      phase_(phase),
+      start_(base::TimeTicks::Now()) {}
+
+StartupTimings::Scope::~Scope() {
+  timings_->Add(phase_, base::TimeTicks::Now() - start_);
+}
+
+StartupTimings::ContextCreationScope::ContextCreationScope(Isolate* isolate)
+    : isolate_(isolate),
+      durations_before_(isolate->startup_timings()->durations_),
+      context_deserializations_before_(
+          isolate->startup_timings()->context_deserializations_),
+      start_(base::TimeTicks::Now()) {}
+
+void StartupTimings::ContextCreationScope::Finish(
+    Handle<NativeContext> context) {
+  const StartupTimings* timings = isolate_->startup_timings();
+  auto delta = [&](Phase phase) {
+    const size_t index = static_cast<size_t>(phase);
+    return timings->durations_[index] - durations_before_[index];
+  };
+  const base::TimeDelta total = base::TimeTicks::Now() - start_;
+
+  v8::metrics::ContextCreated event;
+  event.success = !context.is_null();
+  event.from_snapshot =
+      timings->context_deserializations_ != context_deserializations_before_;
+  event.snapshot_decompression_in_us =
+      delta(Phase::kSnapshotDecompression).InMicroseconds();
+  event.deserialization_in_us =
+      delta(Phase::kContextDeserialization).InMicroseconds();
+  event.embedder_callbacks_in_us =
+      delta(Phase::kEmbedderCallbacks).InMicroseconds();
+  event.total_wall_clock_duration_in_us = total.InMicroseconds();
+
+  if (V8_UNLIKELY(v8_flags.trace_startup)) {
+    PrintF(
+        "[Context creation%s took %0.3f ms: snapshot decompression %0.3f ms, "
+        "deserialization %0.3f ms, embedder callbacks %0.3f ms]\n",
+        event.from_snapshot ? " from snapshot" : "", total.InMillisecondsF(),
+        delta(Phase::kSnapshotDecompression).InMillisecondsF(),
+        delta(Phase::kContextDeserialization).InMillisecondsF(),
+        delta(Phase::kEmbedderCallbacks).InMillisecondsF());
+  }
+
+  isolate_->metrics_recorder()->AddMainThreadEvent(
+      event, context.is_null()
+                 ? v8::metrics::Recorder::ContextId::Empty()
+                 : isolate_->GetOrRegisterRecorderContextId(context));
+}
+
+void StartupTimings::Add(Phase phase, base::TimeDelta duration) {
+  durations_[static_cast<size_t>(phase)] += duration;
+  if (phase == Phase::kContextDeserialization) context_deserializations_++;
+}
+
+void StartupTimings::IsolateCreated(base::TimeDelta total) {
+  isolate_created_event_.snapshot_decompression_in_us =
+      Get(Phase::kSnapshotDecompression).InMicroseconds();
+  isolate_created_event_.read_only_space_setup_in_us =
+      Get(Phase::kReadOnlySpaceSetup).InMicroseconds();
+  isolate_created_event_.startup_deserialization_in_us =
+      Get(Phase::kStartupDeserialization).InMicroseconds();
+  isolate_created_event_.embedded_builtins_setup_in_us =
+      Get(Phase::kEmbeddedBuiltinsSetup).InMicroseconds();
+  isolate_created_event_.external_reference_table_setup_in_us =
+      Get(Phase::kExternalReferenceTableSetup).InMicroseconds();
+  isolate_created_event_.total_wall_clock_duration_in_us =
+      total.InMicroseconds();
+
+  if (V8_UNLIKELY(v8_flags.trace_startup)) {
+    PrintF(
+        "[Isolate creation took %0.3f ms: snapshot decompression %0.3f ms, "
+        "read-only space setup %0.3f ms, startup deserialization %0.3f ms, "
+        "embedded builtins setup %0.3f ms, external reference table setup "
+        "%0.3f ms]\n",
+        total.InMillisecondsF(),
+        Get(Phase::kSnapshotDecompression).InMillisecondsF(),
+        Get(Phase::kReadOnlySpaceSetup).InMillisecondsF(),
+        Get(Phase::kStartupDeserialization).InMillisecondsF(),
+        Get(Phase::kEmbeddedBuiltinsSetup).InMillisecondsF(),
+        Get(Phase::kExternalReferenceTableSetup).InMillisecondsF());
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,95 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INIT_STARTUP_TIMINGS_H_
+#define V8_INIT_STARTUP_TIMINGS_H_
+
+#include <array>
+#include <cstdint>
+
+#include "include/v8-metrics.h"
+#include "src/base/macros.h"
+#include "src/base/platform/time.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class NativeContext;
+
+// Accumulates the time an isolate spends in the phases of its own creation
+// and of the creation of its contexts. Isolate creation is reported as a
+// v8::metrics::IsolateCreated event when the embedder sets a recorder, each
+// context creation as a v8::metrics::ContextCreated event, and both are
+// printed with --trace-startup.
+//
+// Only used from the main thread.
+class V8_EXPORT_PRIVATE StartupTimings final {
+ public:
+  enum class Phase : uint8_t {
+    // Isolate creation.
+    kSnapshotDecompression,
+    kReadOnlySpaceSetup,
+    kStartupDeserialization,
+    kEmbeddedBuiltinsSetup,
+    kExternalReferenceTableSetup,
+    // Context creation. Embedder callbacks run during, and are included in,
+    // context deserialization.
+    kContextDeserialization,
+    kEmbedderCallbacks,
+  };
+  static constexpr size_t kNumPhases =
+      static_cast<size_t>(Phase::kEmbedderCallbacks) + 1;
+
+  // Adds the time until the end of the scope to a phase.
+  class V8_NODISCARD Scope final {
+   public:
+    Scope(Isolate* isolate, Phase phase);
+    ~Scope();
+
+   private:
+    StartupTimings* const timings_;
+    const Phase phase_;
+    const base::TimeTicks start_;
+  };
+
+  // Measures the creation of a context, see Bootstrapper::CreateEnvironment.
+  class V8_NODISCARD ContextCreationScope final {
+   public:
+    explicit ContextCreationScope(Isolate* isolate);
+
+    // Reports the creation of |context|, which is null if it failed.
+    void Finish(Handle<NativeContext> context);
+
+   private:
+    Isolate* const isolate_;
+    const std::array<base::TimeDelta, kNumPhases> durations_before_;
+    const uint32_t context_deserializations_before_;
+    const base::TimeTicks start_;
+  };
+
+  void Add(Phase phase, base::TimeDelta duration);
+  base::TimeDelta Get(Phase phase) const {
+    return durations_[static_cast<size_t>(phase)];
+  }
+
+  // Called once Isolate::New() initialized the isolate, |total| after it
+  // started.
+  void IsolateCreated(base::TimeDelta total);
+
+  const v8::metrics::IsolateCreated& isolate_created_event() const {
+    return isolate_created_event_;
+  }
+
+ private:
+  std::array<base::TimeDelta, kNumPhases> durations_{};
+  uint32_t context_deserializations_ = 0;
+  v8::metrics::IsolateCreated isolate_created_event_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INIT_STARTUP_TIMINGS_H_
@@ -32,6 +32,7 @@
 #include "src/snapshot/snapshot.h"
 #if defined(V8_USE_PERFETTO)
 #include "src/tracing/code-data-source.h"
+#include "src/tracing/heap-graph-data-source.h"
 #endif  // defined(V8_USE_PERFETTO)
 #include "src/tracing/tracing-category-observer.h"
 
@@ -225,6 +226,9 @@ void V8::Initialize() {
     if (v8_flags.perfetto_code_logger) {
       v8::internal::CodeDataSource::Register();
     }
+    if (v8_flags.perfetto_heap_graph) {
+      v8::internal::HeapGraphDataSource::Register();
+    }
   }
 #endif
   IsolateGroup::InitializeOncePerProcess();
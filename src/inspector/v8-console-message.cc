@@ -65,7 +65,6 @@ String16 consoleAPITypeValue(ConsoleAPIType type) {
 
 const char kGlobalConsoleMessageHandleLabel[] = "DevTools console";
 const unsigned maxConsoleMessageCount = 1000;
-const int maxConsoleMessageV8Size = 10 * 1024 * 1024;
 const unsigned maxArrayItemsLimit = 10000;
 const unsigned maxStackDepthLimit = 32;
 
@@ -579,7 +578,9 @@ void V8ConsoleMessageStorage::addMessage(
     m_estimatedSize -= m_messages.front()->estimatedSize();
     m_messages.pop_front();
   }
-  while (m_estimatedSize + message->estimatedSize() > maxConsoleMessageV8Size &&
+  int maxSize =
+      inspector->client()->maxConsoleMessageStorageSize(contextGroupId);
+  while (m_estimatedSize + message->estimatedSize() > maxSize &&
          !m_messages.empty()) {
     m_estimatedSize -= m_messages.front()->estimatedSize();
     m_messages.pop_front();
@@ -135,8 +135,10 @@ class ConsoleHelper {
 
       default:
         // All other APIs get a full stack trace only when the debugger is
-        // attached, otherwise record only the top frame.
-        stackTrace = m_inspector->debugger()->captureStackTrace(false);
+        // attached, otherwise record only the top frame. The embedder may
+        // ask for full stack traces on only a sample of the messages.
+        stackTrace =
+            m_inspector->debugger()->captureStackTraceForConsoleMessage();
         break;
     }
     std::unique_ptr<V8ConsoleMessage> message =
@@ -1296,6 +1296,23 @@ std::unique_ptr<V8StackTraceImpl> V8Debugger::captureStackTrace(
   return V8StackTraceImpl::capture(this, stackSize);
 }
 
+std::unique_ptr<V8StackTraceImpl>
+V8Debugger::captureStackTraceForConsoleMessage() {
+  int contextGroupId = currentContextGroupId();
+  if (!contextGroupId) return nullptr;
+  int interval =
+      m_inspector->client()->consoleStackTraceSamplingInterval(contextGroupId);
+  if (interval > 1) {
+    unsigned index = m_consoleMessagesSinceFullStackTrace++;
+    if (m_consoleMessagesSinceFullStackTrace >=
+        static_cast<unsigned>(interval)) {
+      m_consoleMessagesSinceFullStackTrace = 0;
+    }
+    if (index != 0) return V8StackTraceImpl::capture(this, 1);
+  }
+  return captureStackTrace(false);
+}
+
 int V8Debugger::currentContextGroupId() {
   if (!m_isolate->InContext()) return 0;
   v8::HandleScope handleScope(m_isolate);
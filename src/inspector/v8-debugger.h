@@ -111,6 +111,9 @@ class V8Debugger : public v8::debug::DebugDelegate,
 
   std::unique_ptr<V8StackTraceImpl> createStackTrace(v8::Local<v8::StackTrace>);
   std::unique_ptr<V8StackTraceImpl> captureStackTrace(bool fullStack);
+  // Like captureStackTrace(false), but captures only the top frame for
+  // messages skipped by the client's consoleStackTraceSamplingInterval().
+  std::unique_ptr<V8StackTraceImpl> captureStackTraceForConsoleMessage();
 
   v8::MaybeLocal<v8::Array> internalProperties(v8::Local<v8::Context>,
                                                v8::Local<v8::Value>);
@@ -281,6 +284,7 @@ class V8Debugger : public v8::debug::DebugDelegate,
   size_t m_maxAsyncCallStacks;
   int m_maxAsyncCallStackDepth;
   int m_maxCallStackSizeToCapture;
+  unsigned m_consoleMessagesSinceFullStackTrace = 0;
 
   std::vector<void*> m_currentTasks;
   std::vector<std::shared_ptr<AsyncStackTrace>> m_currentAsyncParent;
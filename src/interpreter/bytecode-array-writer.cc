@@ -31,8 +31,10 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_(Bytecode::kIllegal),
       last_bytecode_offset_(0),
       last_bytecode_had_source_info_(false),
+      last_star_register_operand_(0),
       elide_noneffectful_bytecodes_(
           v8_flags.ignition_elide_noneffectful_bytecodes),
+      fuse_superinstructions_(v8_flags.ignition_superinstructions),
       exit_seen_in_block_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
@@ -110,7 +112,15 @@ void BytecodeArrayWriter::Write(BytecodeNode* node) {
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  MaybeFuseWithLastBytecode(node);
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
+  if (Bytecodes::IsAnyStar(node->bytecode())) {
+    last_star_register_operand_ =
+        Bytecodes::IsShortStar(node->bytecode())
+            ? static_cast<uint32_t>(
+                  Register::FromShortStar(node->bytecode()).ToOperand())
+            : node->operand(0);
+  }
 
   UpdateSourcePositionTable(node);
   EmitBytecode(node);
@@ -247,14 +257,34 @@ void BytecodeArrayWriter::UpdateExitSeenInBlock(Bytecode bytecode) {
   }
 }
 
+void BytecodeArrayWriter::MaybeFuseWithLastBytecode(BytecodeNode* node) {
+  if (!fuse_superinstructions_) return;
+
+  // A Star to a register which is immediately used as the receiver of a
+  // GetNamedProperty (e.g. in a property chain like a.b.c) is fused with it
+  // into a single StarGetNamedProperty. The register is written before the load, so
+  // the accumulator stays the only output of the fused bytecode. Keep the
+  // bytecodes separate if the Star has its own source position.
+  if (node->bytecode() == Bytecode::kGetNamedProperty &&
+      Bytecodes::IsAnyStar(last_bytecode_) && !last_bytecode_had_source_info_ &&
+      node->operand(0) == last_star_register_operand_) {
+    DCHECK_GT(bytecodes()->size(), last_bytecode_offset_);
+    bytecodes()->resize(last_bytecode_offset_);
+    // Don't let the elision below look at the fused Star.
+    InvalidateLastBytecode();
+    *node = BytecodeNode::StarGetNamedProperty(
+        node->source_info(), node->operand(0), node->operand(1),
+        node->operand(2));
+  }
+}
+
 void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
                                                  bool has_source_info) {
-  if (!elide_noneffectful_bytecodes_) return;
-
   // If the last bytecode loaded the accumulator without any external effect,
   // and the next bytecode clobbers this load without reading the accumulator,
   // then the previous bytecode can be elided as it has no effect.
-  if (Bytecodes::IsAccumulatorLoadWithoutEffects(last_bytecode_) &&
+  if (elide_noneffectful_bytecodes_ &&
+      Bytecodes::IsAccumulatorLoadWithoutEffects(last_bytecode_) &&
       Bytecodes::GetImplicitRegisterUse(next_bytecode) ==
           ImplicitRegisterUse::kWriteAccumulator &&
       (!last_bytecode_had_source_info_ || !has_source_info)) {
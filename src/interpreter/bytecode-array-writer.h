@@ -103,6 +103,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
 
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
+  void MaybeFuseWithLastBytecode(BytecodeNode* node);
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
   void InvalidateLastBytecode();
 
@@ -124,7 +125,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   Bytecode last_bytecode_;
   size_t last_bytecode_offset_;
   bool last_bytecode_had_source_info_;
+  uint32_t last_star_register_operand_;
   bool elide_noneffectful_bytecodes_;
+  bool fuse_superinstructions_;
 
   bool exit_seen_in_block_;
 
@@ -136,6 +136,8 @@ namespace interpreter {
   /* Property loads (LoadIC) operations */                                     \
   V(GetNamedProperty, ImplicitRegisterUse::kWriteAccumulator,                  \
     OperandType::kReg, OperandType::kIdx, OperandType::kIdx)                   \
+  V(StarGetNamedProperty, ImplicitRegisterUse::kReadWriteAccumulator,          \
+    OperandType::kRegOut, OperandType::kIdx, OperandType::kIdx)                \
   V(GetNamedPropertyFromSuper, ImplicitRegisterUse::kReadWriteAccumulator,     \
     OperandType::kReg, OperandType::kIdx, OperandType::kIdx)                   \
   V(GetKeyedProperty, ImplicitRegisterUse::kReadWriteAccumulator,              \
@@ -540,39 +540,60 @@ IGNITION_HANDLER(StaLookupSlot, InterpreterAssembler) {
   }
 }
 
-// GetNamedProperty <object> <name_index> <slot>
-//
-// Calls the LoadIC at FeedBackVector slot <slot> for <object> and the name at
-// constant pool entry <name_index>.
-IGNITION_HANDLER(GetNamedProperty, InterpreterAssembler) {
-  TNode<HeapObject> feedback_vector = LoadFeedbackVector();
+class InterpreterGetNamedPropertyAssembler : public InterpreterAssembler {
+ public:
+  InterpreterGetNamedPropertyAssembler(CodeAssemblerState* state,
+                                       Bytecode bytecode,
+                                       OperandScale operand_scale)
+      : InterpreterAssembler(state, bytecode, operand_scale) {}
 
-  // Load receiver.
-  TNode<Object> recv = LoadRegisterAtOperandIndex(0);
+  void GetNamedProperty(TNode<Object> recv) {
+    TNode<HeapObject> feedback_vector = LoadFeedbackVector();
 
-  // Load the name and context lazily.
-  LazyNode<TaggedIndex> lazy_slot = [=, this] {
-    return BytecodeOperandIdxTaggedIndex(2);
-  };
-  LazyNode<Name> lazy_name = [=, this] {
-    return CAST(LoadConstantPoolEntryAtOperandIndex(1));
-  };
-  LazyNode<Context> lazy_context = [=, this] { return GetContext(); };
+    // Load the name and context lazily.
+    LazyNode<TaggedIndex> lazy_slot = [=, this] {
+      return BytecodeOperandIdxTaggedIndex(2);
+    };
+    LazyNode<Name> lazy_name = [=, this] {
+      return CAST(LoadConstantPoolEntryAtOperandIndex(1));
+    };
+    LazyNode<Context> lazy_context = [=, this] { return GetContext(); };
 
-  Label done(this);
-  TVARIABLE(Object, var_result);
-  ExitPoint exit_point(this, &done, &var_result);
+    Label done(this);
+    TVARIABLE(Object, var_result);
+    ExitPoint exit_point(this, &done, &var_result);
 
-  AccessorAssembler::LazyLoadICParameters params(lazy_context, recv, lazy_name,
-                                                 lazy_slot, feedback_vector);
-  AccessorAssembler accessor_asm(state());
-  accessor_asm.LoadIC_BytecodeHandler(&params, &exit_point);
+    AccessorAssembler::LazyLoadICParameters params(
+        lazy_context, recv, lazy_name, lazy_slot, feedback_vector);
+    AccessorAssembler accessor_asm(state());
+    accessor_asm.LoadIC_BytecodeHandler(&params, &exit_point);
 
-  BIND(&done);
-  {
-    SetAccumulator(var_result.value());
-    Dispatch();
+    BIND(&done);
+    {
+      SetAccumulator(var_result.value());
+      Dispatch();
+    }
   }
+};
+
+// GetNamedProperty <object> <name_index> <slot>
+//
+// Calls the LoadIC at FeedBackVector slot <slot> for <object> and the name at
+// constant pool entry <name_index>.
+IGNITION_HANDLER(GetNamedProperty, InterpreterGetNamedPropertyAssembler) {
+  TNode<Object> recv = LoadRegisterAtOperandIndex(0);
+  GetNamedProperty(recv);
+}
+
+// StarGetNamedProperty <dst> <name_index> <slot>
+//
+// Stores the value of the accumulator in register <dst>, and then calls the
+// LoadIC at FeedBackVector slot <slot> for it and the name at constant pool
+// entry <name_index>.
+IGNITION_HANDLER(StarGetNamedProperty, InterpreterGetNamedPropertyAssembler) {
+  TNode<Object> recv = GetAccumulator();
+  StoreRegisterAtOperandIndex(recv, 0);
+  GetNamedProperty(recv);
 }
 
 // GetNamedPropertyFromSuper <receiver> <name_index> <slot>
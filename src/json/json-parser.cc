@@ -6,6 +6,8 @@
 
 #include <optional>
 
+#include "src/base/functional.h"
+#include "src/base/numbers/strtod.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/common/assert-scope.h"
@@ -14,6 +16,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -28,6 +31,14 @@
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(_M_X64))
+#define JSON_SCAN_SSE2
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#define JSON_SCAN_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -128,6 +139,225 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Vectorized helpers for the scanner. They skip whole blocks of characters
+// that the scanner can't stop at, and leave the block with the stop to the
+// scalar code.
+#if defined(JSON_SCAN_SSE2) || defined(JSON_SCAN_NEON)
+constexpr int kJsonScanBlockSize = 16;
+
+// Skips blocks which contain no '"', '\\' or control characters. For two-byte
+// input, sets bits above the Latin1 range in {bits} if any skipped character
+// is outside of it.
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end,
+                                     base::uc32* bits) {
+  constexpr int kBlockLength = kJsonScanBlockSize / sizeof(Char);
+#ifdef JSON_SCAN_SSE2
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1F);
+    while (end - cursor >= kBlockLength) {
+      __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i stops = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                       _mm_cmpeq_epi8(chars, backslash)),
+          _mm_cmpeq_epi8(_mm_min_epu8(chars, max_control), chars));
+      if (_mm_movemask_epi8(stops) != 0) break;
+      cursor += kBlockLength;
+    }
+  } else {
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i non_control = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i all_chars = zero;
+    while (end - cursor >= kBlockLength) {
+      __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i stops = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                       _mm_cmpeq_epi16(chars, backslash)),
+          _mm_cmpeq_epi16(_mm_and_si128(chars, non_control), zero));
+      if (_mm_movemask_epi8(stops) != 0) break;
+      all_chars = _mm_or_si128(all_chars, chars);
+      cursor += kBlockLength;
+    }
+    __m128i high_bytes = _mm_srli_epi16(all_chars, 8);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bytes, zero)) != 0xFFFF) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+#else
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t min_non_control = vdupq_n_u8(0x20);
+    while (end - cursor >= kBlockLength) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t stops =
+          vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                   vcltq_u8(chars, min_non_control));
+      if (vmaxvq_u8(stops) != 0) break;
+      cursor += kBlockLength;
+    }
+  } else {
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t min_non_control = vdupq_n_u16(0x20);
+    uint16x8_t all_chars = vdupq_n_u16(0);
+    while (end - cursor >= kBlockLength) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t stops = vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+          vcltq_u16(chars, min_non_control));
+      if (vmaxvq_u16(stops) != 0) break;
+      all_chars = vorrq_u16(all_chars, chars);
+      cursor += kBlockLength;
+    }
+    if (vmaxvq_u16(all_chars) > unibrow::Latin1::kMaxChar) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+#endif
+  return cursor;
+}
+
+// Skips blocks which only contain whitespace.
+template <typename Char>
+const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  constexpr int kBlockLength = kJsonScanBlockSize / sizeof(Char);
+#ifdef JSON_SCAN_SSE2
+  const bool one_byte = sizeof(Char) == 1;
+  const __m128i space = one_byte ? _mm_set1_epi8(' ') : _mm_set1_epi16(' ');
+  const __m128i tab = one_byte ? _mm_set1_epi8('\t') : _mm_set1_epi16('\t');
+  const __m128i lf = one_byte ? _mm_set1_epi8('\n') : _mm_set1_epi16('\n');
+  const __m128i cr = one_byte ? _mm_set1_epi8('\r') : _mm_set1_epi16('\r');
+  while (end - cursor >= kBlockLength) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i whitespace;
+    if constexpr (sizeof(Char) == 1) {
+      whitespace = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, space),
+                       _mm_cmpeq_epi8(chars, tab)),
+          _mm_or_si128(_mm_cmpeq_epi8(chars, lf), _mm_cmpeq_epi8(chars, cr)));
+    } else {
+      whitespace = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, space),
+                       _mm_cmpeq_epi16(chars, tab)),
+          _mm_or_si128(_mm_cmpeq_epi16(chars, lf), _mm_cmpeq_epi16(chars, cr)));
+    }
+    if (_mm_movemask_epi8(whitespace) != 0xFFFF) break;
+    cursor += kBlockLength;
+  }
+#else
+  if constexpr (sizeof(Char) == 1) {
+    while (end - cursor >= kBlockLength) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t whitespace =
+          vorrq_u8(vorrq_u8(vceqq_u8(chars, vdupq_n_u8(' ')),
+                            vceqq_u8(chars, vdupq_n_u8('\t'))),
+                   vorrq_u8(vceqq_u8(chars, vdupq_n_u8('\n')),
+                            vceqq_u8(chars, vdupq_n_u8('\r'))));
+      if (vminvq_u8(whitespace) == 0) break;
+      cursor += kBlockLength;
+    }
+  } else {
+    while (end - cursor >= kBlockLength) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t whitespace =
+          vorrq_u16(vorrq_u16(vceqq_u16(chars, vdupq_n_u16(' ')),
+                              vceqq_u16(chars, vdupq_n_u16('\t'))),
+                    vorrq_u16(vceqq_u16(chars, vdupq_n_u16('\n')),
+                              vceqq_u16(chars, vdupq_n_u16('\r'))));
+      if (vminvq_u16(whitespace) == 0) break;
+      cursor += kBlockLength;
+    }
+  }
+#endif
+  return cursor;
+}
+#else
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end,
+                                     base::uc32* bits) {
+  return cursor;
+}
+
+template <typename Char>
+const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  return cursor;
+}
+#endif  // defined(JSON_SCAN_SSE2) || defined(JSON_SCAN_NEON)
+
+// Converts an already validated JSON number with at most 19 significant digits
+// with the Eisel-Lemire algorithm, without going through the generic
+// StringToDouble. Returns false if the number has more digits or is too close
+// to a halfway point, in which case the caller falls back to StringToDouble.
+template <typename Char>
+bool TryFastJsonNumberToDouble(base::Vector<const Char> chars,
+                               double* result) {
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  bool negative = false;
+  if (*cursor == '-') {
+    negative = true;
+    cursor++;
+  }
+  constexpr int kMaxSignificantDigits = 19;
+  uint64_t significand = 0;
+  int digits = 0;
+  int exponent = 0;
+  while (cursor < end && IsDecimalDigit(*cursor)) {
+    if (significand != 0 || *cursor != '0') {
+      if (++digits > kMaxSignificantDigits) return false;
+      significand = significand * 10 + (*cursor - '0');
+    }
+    cursor++;
+  }
+  if (cursor < end && *cursor == '.') {
+    cursor++;
+    while (cursor < end && IsDecimalDigit(*cursor)) {
+      if (significand != 0 || *cursor != '0') {
+        if (++digits > kMaxSignificantDigits) return false;
+        significand = significand * 10 + (*cursor - '0');
+      }
+      exponent--;
+      cursor++;
+    }
+  }
+  if (cursor < end) {
+    DCHECK_EQ('e', AsciiAlphaToLower(*cursor));
+    cursor++;
+    bool negative_exponent = false;
+    if (*cursor == '-' || *cursor == '+') {
+      negative_exponent = *cursor == '-';
+      cursor++;
+    }
+    // Larger exponents overflow or underflow regardless of the significand,
+    // so the value only has to stay out of the table range.
+    constexpr int kMaxExponentValue = 100000;
+    int exponent_value = 0;
+    while (cursor < end) {
+      DCHECK(IsDecimalDigit(*cursor));
+      if (exponent_value < kMaxExponentValue) {
+        exponent_value = exponent_value * 10 + (*cursor - '0');
+      }
+      cursor++;
+    }
+    exponent += negative_exponent ? -exponent_value : exponent_value;
+  }
+  DCHECK_EQ(cursor, end);
+  if (significand == 0) {
+    *result = negative ? -0.0 : 0.0;
+    return true;
+  }
+  if (!base::EiselLemireStrtod(significand, exponent, result)) return false;
+  if (negative) *result = -*result;
+  return true;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -529,6 +759,10 @@ JsonParser<Char>::~JsonParser() {
 template <typename Char>
 MaybeHandle<Object> JsonParser<Char>::ParseJson(DirectHandle<Object> reviver) {
   Handle<Object> result;
+  ParsePretenuringScope pretenuring_scope(
+      isolate_, ParsePretenuringScope::Kind::kJsonParse,
+      static_cast<size_t>(end_ - cursor_) * sizeof(Char));
+  allocation_ = pretenuring_scope.allocation();
   // Only record the val node when reviver is callable.
   bool reviver_is_callable = IsCallable(*reviver);
   bool should_track_json_source = reviver_is_callable;
@@ -546,6 +780,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJson(DirectHandle<Object> reviver) {
   if (isolate_->has_exception()) {
     return MaybeHandle<Object>();
   }
+  pretenuring_scope.SetResult(result);
   return result;
 }
 
@@ -564,6 +799,14 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  // Runs of whitespace, e.g. indentation, start with two whitespace
+  // characters. Skip them a block at a time.
+  if (end_ - cursor_ >= 2 &&
+      GetTokenForCharacter(cursor_[0]) == JsonToken::WHITESPACE &&
+      GetTokenForCharacter(cursor_[1]) == JsonToken::WHITESPACE) {
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -637,10 +880,11 @@ class FoldedMutableHeapNumberAllocation {
   // padding fillers between heap numbers.
   static_assert(!USE_ALLOCATION_ALIGNMENT_BOOL);
 
-  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count) {
+  FoldedMutableHeapNumberAllocation(Isolate* isolate, int count,
+                                    AllocationType allocation) {
     if (count == 0) return;
     int size = count * sizeof(HeapNumber);
-    raw_bytes_ = isolate->factory()->NewByteArray(size);
+    raw_bytes_ = isolate->factory()->NewByteArray(size, allocation);
   }
 
   Handle<ByteArray> raw_bytes() const { return raw_bytes_; }
@@ -741,11 +985,13 @@ class JSDataObjectBuilder {
   JSDataObjectBuilder(Isolate* isolate, ElementsKind elements_kind,
                       int expected_named_properties,
                       Handle<Map> expected_final_map,
-                      HeapNumberMode heap_number_mode)
+                      HeapNumberMode heap_number_mode,
+                      AllocationType allocation = AllocationType::kYoung)
       : isolate_(isolate),
         elements_kind_(elements_kind),
         expected_property_count_(expected_named_properties),
         heap_number_mode_(heap_number_mode),
+        allocation_(allocation),
         expected_final_map_(expected_final_map) {
     if (!TryInitializeMapFromExpectedFinalMap()) {
       InitializeMapFromZero();
@@ -902,7 +1148,7 @@ class JSDataObjectBuilder {
       DCHECK_EQ(current_property_index_, 0);
 
       Handle<JSObject> object = isolate_->factory()->NewSlowJSObjectFromMap(
-          map_, expected_property_count_);
+          map_, expected_property_count_, allocation_);
       object->set_elements(*elements);
       object_ = object;
       return;
@@ -920,12 +1166,13 @@ class JSDataObjectBuilder {
     // object -- this ensures that there is no allocation between the object
     // allocation and its initial fields being initialised, where the verifier
     // would see invalid double field state.
-    FoldedMutableHeapNumberAllocation hn_allocation(isolate_,
-                                                    extra_heap_numbers_needed_);
+    FoldedMutableHeapNumberAllocation hn_allocation(
+        isolate_, extra_heap_numbers_needed_, allocation_);
 
     // Allocate the object then immediately start a no_gc scope -- again, this
     // is so the verifier doesn't see invalid double field state.
-    Handle<JSObject> object = isolate_->factory()->NewJSObjectFromMap(map_);
+    Handle<JSObject> object =
+        isolate_->factory()->NewJSObjectFromMap(map_, allocation_);
     DisallowGarbageCollection no_gc;
     Tagged<JSObject> raw_object = *object;
 
@@ -1193,6 +1440,7 @@ class JSDataObjectBuilder {
   ElementsKind elements_kind_;
   int expected_property_count_;
   HeapNumberMode heap_number_mode_;
+  AllocationType allocation_;
 
   Handle<Map> map_;
   int current_property_index_ = 0;
@@ -1281,18 +1529,73 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* end_;
 };
 
+// static
+Handle<Map> JsonObjectMapCache::Lookup(Isolate* isolate, uint32_t keys_hash) {
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> cache = isolate->heap()->json_object_map_cache();
+  int index = (keys_hash % kEntries) * kEntrySize;
+  Tagged<Smi> hash = Smi::FromInt(static_cast<int>(keys_hash & Smi::kMaxValue));
+  if (cache->get(index + kKeysHashOffset) != hash ||
+      cache->get(index + kNativeContextOffset) !=
+          isolate->raw_native_context()) {
+    return Handle<Map>();
+  }
+  return handle(Cast<Map>(cache->get(index + kMapOffset)), isolate);
+}
+
+// static
+void JsonObjectMapCache::Update(Isolate* isolate, uint32_t keys_hash,
+                                Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> cache = isolate->heap()->json_object_map_cache();
+  int index = (keys_hash % kEntries) * kEntrySize;
+  cache->set(index + kKeysHashOffset,
+             Smi::FromInt(static_cast<int>(keys_hash & Smi::kMaxValue)));
+  cache->set(index + kNativeContextOffset, isolate->raw_native_context());
+  cache->set(index + kMapOffset, map);
+}
+
+// static
+void JsonObjectMapCache::Clear(Tagged<FixedArray> cache) {
+  for (int i = 0; i < kSize; i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
+template <typename Char>
+uint32_t JsonParser<Char>::HashObjectKeys(size_t start) {
+  DisallowGarbageCollection no_gc;
+  base::Hasher hasher;
+  for (size_t i = start; i < property_stack_.size(); i++) {
+    const JsonString& key = property_stack_[i].string;
+    if (key.is_index()) continue;
+    hasher.Add(key.length());
+    hasher.Add(key.length() > 0 ? chars_[key.start()] : 0);
+  }
+  return static_cast<uint32_t>(hasher.hash());
+}
+
 template <typename Char>
 Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
                                                    Handle<Map> feedback) {
-  if (!feedback.is_null() && feedback->is_deprecated()) {
-    feedback = Map::Update(isolate_, feedback);
-  }
   size_t start = cont.index;
   DCHECK_LE(start, property_stack_.size());
   int length = static_cast<int>(property_stack_.size() - start);
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  // Without feedback from a sibling object, try the map of an object with the
+  // same keys from an earlier parse.
+  const bool use_map_cache = feedback.is_null() && named_length > 0;
+  uint32_t keys_hash = 0;
+  if (use_map_cache) {
+    keys_hash = HashObjectKeys(start);
+    feedback = JsonObjectMapCache::Lookup(isolate_, keys_hash);
+  }
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1315,7 +1618,7 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       elements = elms;
     } else {
       Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+          factory()->NewFixedArrayWithHoles(cont.max_index + 1, allocation_);
       DisallowGarbageCollection no_gc;
       Tagged<FixedArray> raw_elements = *elms;
       WriteBarrierMode mode = raw_elements->GetWriteBarrierMode(no_gc);
@@ -1335,12 +1638,20 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
 
   JSDataObjectBuilder js_data_object_builder(
       isolate_, elements_kind, named_length, feedback,
-      JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned);
+      JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned, allocation_);
 
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
 
-  return js_data_object_builder.BuildFromIterator(it, elements);
+  Handle<JSObject> object =
+      js_data_object_builder.BuildFromIterator(it, elements);
+  if (use_map_cache) {
+    Tagged<Map> map = object->map();
+    if (!map->is_dictionary_map() && !map->IsDetached(isolate_)) {
+      JsonObjectMapCache::Update(isolate_, keys_hash, map);
+    }
+  }
+  return object;
 }
 
 template <typename Char>
@@ -1360,7 +1671,9 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array = factory()->NewJSArray(
+      kind, length, length,
+      ArrayStorageAllocationMode::DONT_INITIALIZE_ARRAY_ELEMENTS, allocation_);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowGarbageCollection no_gc;
     Tagged<FixedDoubleArray> elements =
@@ -1477,7 +1790,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonObject(Handle<Map> feedback) {
 
   Consume(JsonToken::LBRACE);
   if (Check(JsonToken::RBRACE)) {
-    return factory()->NewJSObject(object_constructor_);
+    return factory()->NewJSObject(object_constructor_, allocation_);
   }
 
   JsonContinuation cont(isolate_, JsonContinuation::kObjectProperty,
@@ -1514,7 +1827,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonArray() {
 
   Consume(JsonToken::LBRACK);
   if (Check(JsonToken::RBRACK)) {
-    return factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+    return factory()->NewJSArray(0, PACKED_SMI_ELEMENTS, allocation_);
   }
 
   HandleScope handle_scope(isolate_);
@@ -1635,7 +1948,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
           Consume(JsonToken::LBRACE);
           if (Check(JsonToken::RBRACE)) {
             // TODO(verwaest): Directly use the map instead.
-            value = factory()->NewJSObject(object_constructor_);
+            value = factory()->NewJSObject(object_constructor_, allocation_);
             if constexpr (should_track_json_source) {
               val_node = ObjectTwoHashTable::New(isolate_, 0);
             }
@@ -1665,7 +1978,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
         case JsonToken::LBRACK:
           Consume(JsonToken::LBRACK);
           if (Check(JsonToken::RBRACK)) {
-            value = factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+            value = factory()->NewJSArray(0, PACKED_SMI_ELEMENTS, allocation_);
             if constexpr (should_track_json_source) {
               val_node = factory()->NewFixedArray(0);
             }
@@ -1964,13 +2277,18 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
     }
 
     base::Vector<const Char> chars(start, cursor_ - start);
-    number = StringToDouble(chars,
-                            NO_CONVERSION_FLAG,  // Hex, octal or trailing junk.
-                            std::numeric_limits<double>::quiet_NaN());
+    if (!TryFastJsonNumberToDouble(chars, &number)) {
+      // No hex, octal or trailing junk.
+      number = StringToDouble(chars, NO_CONVERSION_FLAG,
+                              std::numeric_limits<double>::quiet_NaN());
+    }
 
     DCHECK(!std::isnan(number));
   }
 
+  if (allocation_ == AllocationType::kOld) {
+    return factory()->NewNumber<AllocationType::kOld>(number);
+  }
   return factory()->NewNumber(number);
 }
 
@@ -2031,12 +2349,16 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), allocation_)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), allocation_)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
@@ -2113,6 +2435,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -150,6 +150,26 @@ enum class JsonToken : uint8_t {
   EOS
 };
 
+// Caches the final maps of parsed objects by a hash of their keys, so that an
+// object with the same keys as one from an earlier parse starts out on the
+// final map. The keys are still verified against the map's descriptors. The
+// cache is cleared on every mark-compact GC.
+class JsonObjectMapCache final : public AllStatic {
+ public:
+  static Handle<Map> Lookup(Isolate* isolate, uint32_t keys_hash);
+  static void Update(Isolate* isolate, uint32_t keys_hash, Tagged<Map> map);
+  static void Clear(Tagged<FixedArray> cache);
+
+  static constexpr int kEntries = 64;
+  static constexpr int kEntrySize = 3;
+  static constexpr int kSize = kEntries * kEntrySize;
+
+ private:
+  static constexpr int kKeysHashOffset = 0;
+  static constexpr int kNativeContextOffset = 1;
+  static constexpr int kMapOffset = 2;
+};
+
 // A simple json parser.
 template <typename Char>
 class JsonParser final {
@@ -335,6 +355,9 @@ class JsonParser final {
 
   Handle<JSObject> BuildJsonObject(const JsonContinuation& cont,
                                    Handle<Map> feedback);
+  // Hashes the lengths and first characters of the named keys of the object
+  // whose properties start at {start} on the property stack.
+  uint32_t HashObjectKeys(size_t start);
   Handle<Object> BuildJsonArray(size_t start);
 
   static const int kMaxContextCharacters = 10;
@@ -400,6 +423,9 @@ class JsonParser final {
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
   Handle<JSFunction> object_constructor_;
+  // Where to allocate the objects of the parsed value, based on pretenuring
+  // feedback of the parse site.
+  AllocationType allocation_ = AllocationType::kYoung;
   const Handle<String> original_source_;
   Handle<String> source_;
   // The parsed value's source to be passed to the reviver, if the reviver is
@@ -0,0 +1,157 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+class OneByteJsonSource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteJsonSource(std::vector<uint8_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(chars_.data());
+  }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<uint8_t> chars_;
+};
+
+class TwoByteJsonSource final : public v8::String::ExternalStringResource {
+ public:
+  explicit TwoByteJsonSource(std::vector<uint16_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const uint16_t* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<uint16_t> chars_;
+};
+
+template <typename Resource, typename Char>
+MaybeHandle<String> NewExternalJsonSource(Isolate* isolate,
+                                          std::vector<Char> chars) {
+  Resource* resource = new Resource(std::move(chars));
+  MaybeHandle<String> result;
+  if constexpr (sizeof(Char) == 1) {
+    result = isolate->factory()->NewExternalStringFromOneByte(resource);
+  } else {
+    result = isolate->factory()->NewExternalStringFromTwoByte(resource);
+  }
+  // Otherwise the string owns the resource from now on.
+  if (result.is_null()) delete resource;
+  return result;
+}
+
+}  // namespace
+
+void JsonStreamingParser::Feed(const uint8_t* data, size_t length) {
+  const uint8_t* cursor = data;
+  const uint8_t* end = data + length;
+  while (cursor < end) {
+    if (state_ == unibrow::Utf8::State::kAccept &&
+        *cursor <= unibrow::Utf8::kMaxOneByteChar) {
+      // Copy runs of ASCII characters at once.
+      const uint8_t* ascii_end = std::find_if(cursor, end, [](uint8_t c) {
+        return c > unibrow::Utf8::kMaxOneByteChar;
+      });
+      if (is_one_byte_) {
+        one_byte_chars_.insert(one_byte_chars_.end(), cursor, ascii_end);
+      } else {
+        two_byte_chars_.insert(two_byte_chars_.end(), cursor, ascii_end);
+      }
+      cursor = ascii_end;
+      continue;
+    }
+    unibrow::uchar c =
+        unibrow::Utf8::ValueOfIncremental(&cursor, &state_, &incomplete_char_);
+    if (c != unibrow::Utf8::kIncomplete) AddCharacter(c);
+  }
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish(Isolate* isolate) {
+  unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&state_);
+  if (c != unibrow::Utf8::kBufferEmpty) AddCharacter(c);
+
+  MaybeHandle<String> maybe_source;
+  if (is_one_byte_) {
+    if (one_byte_chars_.size() < kMinExternalLength) {
+      maybe_source = isolate->factory()->NewStringFromOneByte(
+          base::Vector<const uint8_t>(one_byte_chars_.data(),
+                                      one_byte_chars_.size()));
+    } else {
+      maybe_source = NewExternalJsonSource<OneByteJsonSource>(
+          isolate, std::move(one_byte_chars_));
+    }
+  } else {
+    if (two_byte_chars_.size() < kMinExternalLength) {
+      maybe_source = isolate->factory()->NewStringFromTwoByte(
+          base::Vector<const base::uc16>(two_byte_chars_.data(),
+                                         two_byte_chars_.size()));
+    } else {
+      maybe_source = NewExternalJsonSource<TwoByteJsonSource>(
+          isolate, std::move(two_byte_chars_));
+    }
+  }
+  const bool is_one_byte = is_one_byte_;
+  Reset();
+
+  Handle<String> source;
+  if (!maybe_source.ToHandle(&source)) return MaybeHandle<Object>();
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return is_one_byte
+             ? JsonParser<uint8_t>::Parse(isolate, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
+void JsonStreamingParser::AddCharacter(unibrow::uchar c) {
+  if (is_one_byte_) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      one_byte_chars_.push_back(static_cast<uint8_t>(c));
+      return;
+    }
+    ConvertToTwoByte();
+  }
+  if (c > unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    two_byte_chars_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    two_byte_chars_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  } else {
+    two_byte_chars_.push_back(static_cast<uint16_t>(c));
+  }
+}
+
+void JsonStreamingParser::ConvertToTwoByte() {
+  DCHECK(is_one_byte_);
+  DCHECK(two_byte_chars_.empty());
+  two_byte_chars_.assign(one_byte_chars_.begin(), one_byte_chars_.end());
+  std::vector<uint8_t>().swap(one_byte_chars_);
+  is_one_byte_ = false;
+}
+
+void JsonStreamingParser::Reset() {
+  state_ = unibrow::Utf8::State::kAccept;
+  incomplete_char_ = 0;
+  is_one_byte_ = true;
+  std::vector<uint8_t>().swap(one_byte_chars_);
+  std::vector<uint16_t>().swap(two_byte_chars_);
+}
+
+}  // namespace internal
+}  // namespace v8
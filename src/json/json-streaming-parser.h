@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "src/handles/maybe-handles.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Object;
+
+// Backs v8::JSON::StreamingParser. The UTF-8 chunks are decoded as they are
+// fed, into Latin1 characters until the first character outside of Latin1
+// shows up and into UTF-16 code units from then on. Finish() hands the decoded
+// characters to the JsonParser, as an external string for longer texts so
+// that they aren't copied again.
+class JsonStreamingParser final {
+ public:
+  void Feed(const uint8_t* data, size_t length);
+  MaybeHandle<Object> Finish(Isolate* isolate);
+
+ private:
+  // Texts shorter than this are copied into a sequential string.
+  static constexpr size_t kMinExternalLength = 1024;
+
+  void AddCharacter(unibrow::uchar c);
+  void ConvertToTwoByte();
+  void Reset();
+
+  unibrow::Utf8::State state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char_ = 0;
+  bool is_one_byte_ = true;
+  std::vector<uint8_t> one_byte_chars_;
+  std::vector<uint16_t> two_byte_chars_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
@@ -4,26 +4,129 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
+
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-raw-json-inl.h"
+#include "src/objects/keys.h"
 #include "src/objects/lookup.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/oddball-inl.h"
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
+#include "src/objects/swiss-name-dictionary-inl.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(_M_X64))
+#define JSON_ESCAPE_SSE2
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#define JSON_ESCAPE_NEON
+#include <arm_neon.h>
+#endif
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+#if defined(JSON_ESCAPE_SSE2) || defined(JSON_ESCAPE_NEON)
+constexpr int kJsonEscapeBlockSize = 16;
+
+// Returns a pointer to the first block of {kJsonEscapeBlockSize} bytes in
+// [cursor, end) which may contain a character that has to be escaped, i.e. a
+// control character, '"', '\\' or (for two-byte strings) a surrogate. The
+// characters of the last partial block are not checked.
+template <typename Char>
+const Char* SkipCharactersNotToEscape(const Char* cursor, const Char* end) {
+  constexpr int kBlockLength = kJsonEscapeBlockSize / sizeof(Char);
+#ifdef JSON_ESCAPE_SSE2
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1F);
+    while (end - cursor >= kBlockLength) {
+      __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i escapes = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                       _mm_cmpeq_epi8(chars, backslash)),
+          _mm_cmpeq_epi8(_mm_min_epu8(chars, max_control), chars));
+      if (_mm_movemask_epi8(escapes) != 0) break;
+      cursor += kBlockLength;
+    }
+  } else {
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i non_control = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+    const __m128i surrogate_mask = _mm_set1_epi16(static_cast<int16_t>(0xF800));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(0xD800));
+    const __m128i zero = _mm_setzero_si128();
+    while (end - cursor >= kBlockLength) {
+      __m128i chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i escapes = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                       _mm_cmpeq_epi16(chars, backslash)),
+          _mm_or_si128(
+              _mm_cmpeq_epi16(_mm_and_si128(chars, non_control), zero),
+              _mm_cmpeq_epi16(_mm_and_si128(chars, surrogate_mask),
+                              surrogate)));
+      if (_mm_movemask_epi8(escapes) != 0) break;
+      cursor += kBlockLength;
+    }
+  }
+#else
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t min_non_control = vdupq_n_u8(0x20);
+    while (end - cursor >= kBlockLength) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t escapes =
+          vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                   vcltq_u8(chars, min_non_control));
+      if (vmaxvq_u8(escapes) != 0) break;
+      cursor += kBlockLength;
+    }
+  } else {
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t min_non_control = vdupq_n_u16(0x20);
+    const uint16x8_t surrogate_mask = vdupq_n_u16(0xF800);
+    const uint16x8_t surrogate = vdupq_n_u16(0xD800);
+    while (end - cursor >= kBlockLength) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t escapes = vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+          vorrq_u16(vcltq_u16(chars, min_non_control),
+                    vceqq_u16(vandq_u16(chars, surrogate_mask), surrogate)));
+      if (vmaxvq_u16(escapes) != 0) break;
+      cursor += kBlockLength;
+    }
+  }
+#endif  // JSON_ESCAPE_SSE2
+  return cursor;
+}
+#else
+template <typename Char>
+const Char* SkipCharactersNotToEscape(const Char* cursor, const Char* end) {
+  return cursor;
+}
+#endif  // defined(JSON_ESCAPE_SSE2) || defined(JSON_ESCAPE_NEON)
+
+}  // namespace
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -38,9 +141,19 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT bool StringifyToUtf8(Handle<Object> object,
+                                             Handle<Object> replacer,
+                                             Handle<Object> gap,
+                                             v8::JSON::Utf8Sink* sink);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
+  // Serializes {object} into the current part. Returns UNCHANGED, SUCCESS or
+  // EXCEPTION.
+  Result StringifyToPart(Handle<Object> object, Handle<Object> replacer,
+                         Handle<Object> gap);
+
   bool InitializeReplacer(Handle<Object> replacer);
   bool InitializeGap(Handle<Object> gap);
 
@@ -95,6 +208,22 @@ class JsonStringifier {
     }
   }
 
+  // Appends {length} characters which don't need escaping, extending the
+  // current part as often as needed.
+  template <typename SrcChar, typename DestChar>
+  void AppendChars(const SrcChar* chars, int length) {
+    DCHECK_EQ(encoding_ == String::ONE_BYTE_ENCODING, sizeof(DestChar) == 1);
+    while (length > 0) {
+      int chunk = std::min(length, part_length_ - current_index_);
+      CopyChars(reinterpret_cast<DestChar*>(part_ptr_) + current_index_, chars,
+                chunk);
+      current_index_ += chunk;
+      chars += chunk;
+      length -= chunk;
+      if (current_index_ == part_length_) Extend();
+    }
+  }
+
   template <int N>
   V8_INLINE void AppendCStringLiteral(const char (&literal)[N]) {
     // Note that the literal contains the zero char.
@@ -212,6 +341,7 @@ class JsonStringifier {
 
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
+  Result SerializeJSObjectWithDictionaryProperties(Handle<JSObject> object);
   template <ElementsKind kind>
   V8_INLINE Result SerializeFixedArrayWithInterruptCheck(
       DirectHandle<JSArray> array, uint32_t length, uint32_t* slow_path_index);
@@ -254,6 +384,12 @@ class JsonStringifier {
       cursor_ += length;
     }
 
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, size_t length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
+
    private:
     int* current_index_;
     DestChar* start_;
@@ -405,6 +541,13 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+bool JsonStringifyToUtf8(Isolate* isolate, Handle<Object> object,
+                         Handle<Object> replacer, Handle<Object> gap,
+                         v8::JSON::Utf8Sink* sink) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToUtf8(object, replacer, gap, sink);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -464,16 +607,15 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
   part_ptr_ = one_byte_ptr_;
 }
 
-MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
-                                               Handle<Object> replacer,
-                                               Handle<Object> gap) {
+JsonStringifier::Result JsonStringifier::StringifyToPart(
+    Handle<Object> object, Handle<Object> replacer, Handle<Object> gap) {
   if (!InitializeReplacer(replacer)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
     CHECK(isolate_->has_exception());
-    return MaybeHandle<Object>();
+    return EXCEPTION;
   }
   Result result = SerializeObject(object);
   if (result == NEED_STACK) {
@@ -481,6 +623,14 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
     current_index_ = 0;
     result = SerializeObject(object);
   }
+  DCHECK_NE(result, NEED_STACK);
+  return result;
+}
+
+MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
+                                               Handle<Object> replacer,
+                                               Handle<Object> gap) {
+  Result result = StringifyToPart(object, replacer, gap);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) {
     if (overflowed_ || current_index_ > String::kMaxLength) {
@@ -501,6 +651,81 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+namespace {
+
+// Encodes {chars} as UTF-8 into the buffers of {sink}. Lone surrogates, which
+// can only come from the gap or from raw JSON, are replaced by U+FFFD.
+template <typename Char>
+void WriteUtf8ToSink(base::Vector<const Char> chars,
+                     v8::JSON::Utf8Sink* sink) {
+  static_assert(v8::JSON::Utf8Sink::kMinBufferSize >=
+                unibrow::Utf8::kMaxEncodedSize);
+  char* buffer = nullptr;
+  size_t size = 0;
+  size_t position = 0;
+  auto reserve = [&](size_t length) {
+    if (size - position >= length) return;
+    if (buffer != nullptr) sink->BufferWritten(position);
+    buffer = sink->GetBuffer(&size);
+    CHECK_NOT_NULL(buffer);
+    CHECK_GE(size, v8::JSON::Utf8Sink::kMinBufferSize);
+    position = 0;
+  };
+  int i = 0;
+  while (i < chars.length()) {
+    if (chars[i] <= unibrow::Utf8::kMaxOneByteChar) {
+      // Copy a run of ASCII characters.
+      reserve(1);
+      while (i < chars.length() && position < size &&
+             chars[i] <= unibrow::Utf8::kMaxOneByteChar) {
+        buffer[position++] = static_cast<char>(chars[i++]);
+      }
+      continue;
+    }
+    reserve(unibrow::Utf8::kMaxEncodedSize);
+    unibrow::uchar c = chars[i++];
+    if (sizeof(Char) == 2 && unibrow::Utf16::IsLeadSurrogate(c) &&
+        i < chars.length() && unibrow::Utf16::IsTrailSurrogate(chars[i])) {
+      c = unibrow::Utf16::CombineSurrogatePair(c, chars[i++]);
+    }
+    position += unibrow::Utf8::Encode(buffer + position, c,
+                                      unibrow::Utf16::kNoPreviousCharacter,
+                                      true);
+  }
+  if (buffer != nullptr) sink->BufferWritten(position);
+}
+
+}  // namespace
+
+bool JsonStringifier::StringifyToUtf8(Handle<Object> object,
+                                      Handle<Object> replacer,
+                                      Handle<Object> gap,
+                                      v8::JSON::Utf8Sink* sink) {
+  Result result = StringifyToPart(object, replacer, gap);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    return false;
+  }
+  if (result == UNCHANGED) {
+    // Like v8::JSON::Stringify, which converts the result to a string.
+    WriteUtf8ToSink(base::StaticOneByteVector("undefined"), sink);
+    return true;
+  }
+  DCHECK_EQ(result, SUCCESS);
+  if (overflowed_ || current_index_ > String::kMaxLength) {
+    isolate_->Throw(*factory()->NewInvalidStringLengthError());
+    return false;
+  }
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    WriteUtf8ToSink(
+        base::Vector<const uint8_t>(one_byte_ptr_, current_index_), sink);
+  } else {
+    WriteUtf8ToSink(
+        base::Vector<const base::uc16>(two_byte_ptr_, current_index_), sink);
+  }
+  return true;
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1224,6 +1449,50 @@ V8_INLINE bool CanFastSerializeJSObject(PtrComprCageBase cage_base,
   return elements == roots.empty_fixed_array() ||
          elements == roots.empty_slow_element_dictionary();
 }
+
+// Objects in dictionary mode without elements can be serialized from their
+// property dictionary, without collecting their keys with a KeyAccumulator.
+bool CanSerializeFromPropertyDictionary(PtrComprCageBase cage_base,
+                                        Tagged<JSObject> raw_object,
+                                        Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  if (IsCustomElementsReceiverMap(raw_object->map(cage_base))) return false;
+  if (raw_object->HasFastProperties(cage_base)) return false;
+  auto roots = ReadOnlyRoots(isolate);
+  auto elements = raw_object->elements(cage_base);
+  return elements == roots.empty_fixed_array() ||
+         elements == roots.empty_slow_element_dictionary();
+}
+
+// Returns the value of the data property {key} of {object} if it is (still) in
+// the property dictionary of {object}.
+bool TryGetDictionaryDataProperty(Isolate* isolate,
+                                  DirectHandle<JSObject> object,
+                                  Handle<String> key,
+                                  Handle<Object>* value) {
+  DisallowGarbageCollection no_gc;
+  Tagged<JSObject> raw_object = *object;
+  if (raw_object->HasFastProperties()) return false;
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    Tagged<SwissNameDictionary> dictionary =
+        raw_object->property_dictionary_swiss();
+    InternalIndex entry = dictionary->FindEntry(isolate, *key);
+    if (entry.is_not_found()) return false;
+    if (dictionary->DetailsAt(entry).kind() != PropertyKind::kData) {
+      return false;
+    }
+    *value = handle(dictionary->ValueAt(entry), isolate);
+  } else {
+    Tagged<NameDictionary> dictionary = raw_object->property_dictionary();
+    InternalIndex entry = dictionary->FindEntry(isolate, key);
+    if (entry.is_not_found()) return false;
+    if (dictionary->DetailsAt(entry).kind() != PropertyKind::kData) {
+      return false;
+    }
+    *value = handle(dictionary->ValueAt(entry), isolate);
+  }
+  return true;
+}
 }  // namespace
 
 JsonStringifier::Result JsonStringifier::SerializeJSObject(
@@ -1312,6 +1581,11 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
+  if (contents.is_null() && IsJSObject(*object) &&
+      CanSerializeFromPropertyDictionary(isolate_, Cast<JSObject>(*object),
+                                         isolate_)) {
+    return SerializeJSObjectWithDictionaryProperties(Cast<JSObject>(object));
+  }
   if (contents.is_null()) {
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
         isolate_, contents,
@@ -1339,6 +1613,35 @@ JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
   return SUCCESS;
 }
 
+JsonStringifier::Result
+JsonStringifier::SerializeJSObjectWithDictionaryProperties(
+    Handle<JSObject> object) {
+  // The enumerable string keys in the order of property creation.
+  Handle<FixedArray> keys =
+      KeyAccumulator::GetOwnEnumPropertyKeys(isolate_, object);
+  AppendCharacter('{');
+  Indent();
+  bool comma = false;
+  for (int i = 0; i < keys->length(); i++) {
+    Handle<String> key(Cast<String>(keys->get(i)), isolate_);
+    Handle<Object> property;
+    // Serializing earlier properties can run user code (e.g. toJSON), which
+    // may have changed the object, so look up each key again.
+    if (!TryGetDictionaryDataProperty(isolate_, object, key, &property)) {
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, property,
+          Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
+    }
+    Result result = SerializeProperty(property, comma, key);
+    if (!comma && result == SUCCESS) comma = true;
+    if (result == EXCEPTION || result == NEED_STACK) return result;
+  }
+  Unindent();
+  if (comma) NewLine();
+  AppendCharacter('}');
+  return SUCCESS;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSProxy(
     Handle<JSProxy> object, Handle<Object> key) {
   HandleScope scope(isolate_);
@@ -1381,10 +1684,23 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // Assert that base::uc16 character is not truncated down to 8 bit.
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
+  if constexpr (raw_json) {
+    dest->AppendChars(src.begin(), src.length());
+    return false;
+  }
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
+    // Copy runs of characters which don't need escaping in bulk.
+    const SrcChar* run_end =
+        SkipCharactersNotToEscape(src.begin() + i, src.end());
+    if (run_end != src.begin() + i) {
+      int run_length = static_cast<int>(run_end - (src.begin() + i));
+      dest->AppendChars(src.begin() + i, run_length);
+      i += run_length;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
+    if (DoNotEscape(c)) {
       dest->Append(c);
     } else if (sizeof(SrcChar) != 1 &&
                base::IsInRange(c, static_cast<SrcChar>(0xD800),
@@ -1453,10 +1769,20 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
         &current_index_);
     required_escaping = SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
         vector, &no_extend);
+  } else if constexpr (raw_json) {
+    AppendChars<SrcChar, DestChar>(vector.begin(), vector.length());
   } else {
     for (int i = 0; i < vector.length(); i++) {
+      const SrcChar* run_end =
+          SkipCharactersNotToEscape(vector.begin() + i, vector.end());
+      if (run_end != vector.begin() + i) {
+        int run_length = static_cast<int>(run_end - (vector.begin() + i));
+        AppendChars<SrcChar, DestChar>(vector.begin() + i, run_length);
+        i += run_length;
+        if (i == vector.length()) break;
+      }
       SrcChar c = vector.at(i);
-      if (raw_json || DoNotEscape(c)) {
+      if (DoNotEscape(c)) {
         Append<SrcChar, DestChar>(c);
       } else if (sizeof(SrcChar) != 1 &&
                  base::IsInRange(c, static_cast<SrcChar>(0xD800),
@@ -4,9 +4,15 @@
 
 #include "src/libplatform/default-job.h"
 
+#include <algorithm>
+
 #include "src/base/bits.h"
 #include "src/base/macros.h"
 
+#if !defined(V8_USE_PERFETTO)
+#include "src/tracing/trace-event-no-perfetto.h"
+#endif
+
 namespace v8 {
 namespace platform {
 namespace {
@@ -14,6 +20,18 @@ namespace {
 // Capped to allow assigning task_ids from a bitfield.
 constexpr size_t kMaxWorkersPerJob = 32;
 
+// Duration of a throughput measurement for adaptive concurrency.
+constexpr double kMeasurementSeconds = 0.001;
+// Number of work items after which workers check whether the current
+// measurement is complete.
+constexpr size_t kProgressCheckInterval = 4;
+// Number of measurements after which throughput is measured again at all
+// worker counts, to adapt to changes in the load of the machine.
+constexpr size_t kRemeasureInterval = 64;
+// Minimal throughput that an additional worker needs to add, relative to the
+// throughput of an average worker.
+constexpr double kMinMarginalGain = 0.5;
+
 }  // namespace
 
 DefaultJobState::JobDelegate::~JobDelegate() {
@@ -31,11 +49,17 @@ uint8_t DefaultJobState::JobDelegate::GetTaskId() {
 DefaultJobState::DefaultJobState(Platform* platform,
                                  std::unique_ptr<JobTask> job_task,
                                  TaskPriority priority,
-                                 size_t num_worker_threads)
+                                 size_t num_worker_threads,
+                                 JobConcurrencyMode concurrency_mode)
     : platform_(platform),
       job_task_(std::move(job_task)),
       priority_(priority),
-      num_worker_threads_(std::min(num_worker_threads, kMaxWorkersPerJob)) {}
+      num_worker_threads_(std::min(num_worker_threads, kMaxWorkersPerJob)),
+      adaptive_concurrency_(concurrency_mode == JobConcurrencyMode::kAdaptive),
+      concurrency_limit_(num_worker_threads_) {
+  // One more for the joining thread.
+  if (adaptive_concurrency_) throughput_.resize(kMaxWorkersPerJob + 2);
+}
 
 DefaultJobState::~DefaultJobState() { DCHECK_EQ(0U, active_workers_); }
 
@@ -46,12 +70,8 @@ void DefaultJobState::NotifyConcurrencyIncrease() {
   TaskPriority priority;
   {
     base::MutexGuard guard(&mutex_);
-    const size_t max_concurrency = CappedMaxConcurrency(active_workers_);
-    // Consider |pending_tasks_| to avoid posting too many tasks.
-    if (max_concurrency > active_workers_ + pending_tasks_) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
-    }
+    num_tasks_to_post =
+        ReservePendingTasks(CappedMaxConcurrency(active_workers_));
     priority = priority_;
   }
   // Post additional worker tasks to reach |max_concurrency|.
@@ -61,6 +81,121 @@ void DefaultJobState::NotifyConcurrencyIncrease() {
   }
 }
 
+void DefaultJobState::NotifyProgress(size_t work_items) {
+  if (!adaptive_concurrency_) return;
+  size_t previous = progress_.fetch_add(work_items, std::memory_order_relaxed);
+  if (previous / kProgressCheckInterval ==
+      (previous + work_items) / kProgressCheckInterval) {
+    return;
+  }
+  size_t num_tasks_to_post = 0;
+  TaskPriority priority;
+  {
+    // Skip the check if other threads are busy with the job's state.
+    if (!mutex_.TryLock()) return;
+    num_tasks_to_post = AdaptConcurrency();
+    priority = priority_;
+    mutex_.Unlock();
+  }
+  for (size_t i = 0; i < num_tasks_to_post; ++i) {
+    CallOnWorkerThread(priority, std::make_unique<DefaultJobWorker>(
+                                     shared_from_this(), job_task_.get()));
+  }
+}
+
+size_t DefaultJobState::ReservePendingTasks(size_t max_concurrency) {
+  // Consider |pending_tasks_| to avoid posting too many tasks.
+  if (max_concurrency <= active_workers_ + pending_tasks_) return 0;
+  size_t num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
+  pending_tasks_ += num_tasks_to_post;
+  return num_tasks_to_post;
+}
+
+size_t DefaultJobState::AdaptConcurrency() {
+  double now = platform_->MonotonicallyIncreasingTime();
+  size_t progress = progress_.load(std::memory_order_relaxed);
+  if (measurement_workers_ != active_workers_) {
+    StartMeasurement(now, progress);
+    return 0;
+  }
+  double elapsed = now - measurement_start_time_;
+  if (elapsed < kMeasurementSeconds) return 0;
+
+  const size_t workers = active_workers_;
+  double throughput = (progress - measurement_start_progress_) / elapsed;
+  if (++num_measurements_ % kRemeasureInterval == 0) {
+    std::fill(throughput_.begin(), throughput_.end(), 0);
+  }
+  double& measured = throughput_[workers];
+  measured = measured == 0 ? throughput : (measured + throughput) / 2;
+  StartMeasurement(now, progress);
+
+  if (workers > 1 && workers >= concurrency_limit_ &&
+      (throughput_[workers - 1] == 0 ||
+       !GainsThroughput(workers - 1, workers))) {
+    // Either the last worker doesn't pay off, or it is unknown whether it
+    // does. In the latter case, the next measurement with one worker less
+    // tells, and the limit is raised again if the worker paid off.
+    SetConcurrencyLimit(workers - 1);
+    return 0;
+  }
+  if (workers == concurrency_limit_ && workers < num_worker_threads_ &&
+      (throughput_[workers + 1] == 0 ||
+       GainsThroughput(workers, workers + 1))) {
+    SetConcurrencyLimit(workers + 1);
+    return ReservePendingTasks(CappedMaxConcurrency(active_workers_));
+  }
+  return 0;
+}
+
+void DefaultJobState::StartMeasurement(double now, size_t progress) {
+  measurement_start_time_ = now;
+  measurement_start_progress_ = progress;
+  measurement_workers_ = active_workers_;
+}
+
+bool DefaultJobState::GainsThroughput(size_t workers,
+                                      size_t more_workers) const {
+  DCHECK_LT(0, workers);
+  DCHECK_LT(workers, more_workers);
+  double per_worker = throughput_[workers] / workers;
+  return throughput_[more_workers] - throughput_[workers] >=
+         kMinMarginalGain * per_worker * (more_workers - workers);
+}
+
+void DefaultJobState::SetConcurrencyLimit(size_t limit) {
+  DCHECK_LT(0, limit);
+  if (limit == concurrency_limit_) return;
+  concurrency_limit_ = limit;
+  excess_workers_.store(active_workers_ > limit ? active_workers_ - limit : 0,
+                        std::memory_order_relaxed);
+#if !defined(V8_USE_PERFETTO)
+  TracingController* tracing_controller = platform_->GetTracingController();
+  const uint8_t* category_enabled =
+      tracing_controller->GetCategoryGroupEnabled("v8");
+  if (*category_enabled) {
+    const char* arg_names[] = {"limit"};
+    const uint8_t arg_types[] = {TRACE_VALUE_TYPE_UINT};
+    const uint64_t arg_values[] = {limit};
+    tracing_controller->AddTraceEvent(
+        TRACE_EVENT_PHASE_COUNTER, category_enabled, "V8.JobConcurrencyLimit",
+        nullptr, 0, 0, 1, arg_names, arg_types, arg_values, nullptr,
+        TRACE_EVENT_FLAG_NONE);
+  }
+#endif  // !defined(V8_USE_PERFETTO)
+}
+
+bool DefaultJobState::TryClaimExcessWorker() {
+  size_t excess = excess_workers_.load(std::memory_order_relaxed);
+  while (excess > 0) {
+    if (excess_workers_.compare_exchange_weak(excess, excess - 1,
+                                              std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 uint8_t DefaultJobState::AcquireTaskId() {
   static_assert(kMaxWorkersPerJob <= sizeof(assigned_task_ids_) * 8,
                 "TaskId bitfield isn't big enough to fit kMaxWorkersPerJob.");
@@ -119,14 +254,12 @@ void DefaultJobState::Join() {
     // GetMaxConcurrency() is ignored here, but if necessary we wait below
     // for workers to return so we don't exceed GetMaxConcurrency().
     ++num_worker_threads_;
+    ++concurrency_limit_;
     ++active_workers_;
     size_t max_concurrency = WaitForParticipationOpportunity();
     if (max_concurrency == 0) return;
     // Compute the number of additional worker tasks to spawn.
-    if (max_concurrency > active_workers_ + pending_tasks_) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
-    }
+    num_tasks_to_post = ReservePendingTasks(max_concurrency);
   }
   // Spawn more worker tasks if needed.
   for (size_t i = 0; i < num_tasks_to_post; ++i) {
@@ -188,11 +321,7 @@ bool DefaultJobState::DidRunTask() {
       worker_released_condition_.NotifyOne();
       return false;
     }
-    // Consider |pending_tasks_| to avoid posting too many tasks.
-    if (max_concurrency > active_workers_ + pending_tasks_) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
-    }
+    num_tasks_to_post = ReservePendingTasks(max_concurrency);
     priority = priority_;
   }
   // Post additional worker tasks to reach |max_concurrency| in the case that
@@ -208,8 +337,8 @@ bool DefaultJobState::DidRunTask() {
 }
 
 size_t DefaultJobState::CappedMaxConcurrency(size_t worker_count) const {
-  return std::min(job_task_->GetMaxConcurrency(worker_count),
-                  num_worker_threads_);
+  return std::min({job_task_->GetMaxConcurrency(worker_count),
+                   num_worker_threads_, concurrency_limit_});
 }
 
 void DefaultJobState::CallOnWorkerThread(TaskPriority priority,
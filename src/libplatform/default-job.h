@@ -7,8 +7,10 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
@@ -35,11 +37,15 @@ class V8_PLATFORM_EXPORT DefaultJobState
       DCHECK(!was_told_to_yield_);
       // Thread-safe but may return an outdated result.
       was_told_to_yield_ |=
-          outer_->is_canceled_.load(std::memory_order_relaxed);
+          outer_->is_canceled_.load(std::memory_order_relaxed) ||
+          (!is_joining_thread_ && outer_->TryClaimExcessWorker());
       return was_told_to_yield_;
     }
     uint8_t GetTaskId() override;
     bool IsJoiningThread() const override { return is_joining_thread_; }
+    void NotifyProgress(size_t work_items) override {
+      outer_->NotifyProgress(work_items);
+    }
 
    private:
     static constexpr uint8_t kInvalidTaskId =
@@ -51,11 +57,14 @@ class V8_PLATFORM_EXPORT DefaultJobState
     bool was_told_to_yield_ = false;
   };
 
-  DefaultJobState(Platform* platform, std::unique_ptr<JobTask> job_task,
-                  TaskPriority priority, size_t num_worker_threads);
+  DefaultJobState(
+      Platform* platform, std::unique_ptr<JobTask> job_task,
+      TaskPriority priority, size_t num_worker_threads,
+      JobConcurrencyMode concurrency_mode = JobConcurrencyMode::kFixed);
   virtual ~DefaultJobState();
 
   void NotifyConcurrencyIncrease();
+  void NotifyProgress(size_t work_items);
   uint8_t AcquireTaskId();
   void ReleaseTaskId(uint8_t task_id);
 
@@ -79,6 +88,23 @@ class V8_PLATFORM_EXPORT DefaultJobState
   // job.
   size_t CappedMaxConcurrency(size_t worker_count) const;
 
+  // Returns the number of worker tasks that need to be posted to reach the
+  // current max concurrency, and accounts for them in |pending_tasks_|.
+  size_t ReservePendingTasks(size_t max_concurrency);
+
+  // With JobConcurrencyMode::kAdaptive, measures the throughput of the job at
+  // the current number of active workers, and moves |concurrency_limit_| to
+  // the number of workers beyond which an additional worker adds less than
+  // kMinMarginalGain of the throughput of an average worker. Returns the number
+  // of worker tasks to post if the limit was raised.
+  size_t AdaptConcurrency();
+  void StartMeasurement(double now, size_t progress);
+  bool GainsThroughput(size_t workers, size_t more_workers) const;
+  void SetConcurrencyLimit(size_t limit);
+  // Returns true for as many workers as have to return after the concurrency
+  // limit was lowered.
+  bool TryClaimExcessWorker();
+
   void CallOnWorkerThread(TaskPriority priority, std::unique_ptr<Task> task);
 
   Platform* const platform_;
@@ -99,6 +125,26 @@ class V8_PLATFORM_EXPORT DefaultJobState
   base::ConditionVariable worker_released_condition_;
 
   std::atomic<uint32_t> assigned_task_ids_{0};
+
+  // State of JobConcurrencyMode::kAdaptive.
+  const bool adaptive_concurrency_;
+  // Total number of work items reported via NotifyProgress().
+  std::atomic<size_t> progress_{0};
+  // Number of active workers that should yield to reach |concurrency_limit_|.
+  std::atomic<size_t> excess_workers_{0};
+  // All members below are protected by |mutex_|.
+  // Number of workers that the job is limited to, in addition to
+  // |num_worker_threads_|.
+  size_t concurrency_limit_;
+  // The current measurement, which is only valid while the number of active
+  // workers doesn't change.
+  double measurement_start_time_ = 0;
+  size_t measurement_start_progress_ = 0;
+  size_t measurement_workers_ = 0;
+  size_t num_measurements_ = 0;
+  // Measured throughput in work items per second, indexed by the number of
+  // active workers, or 0 if not measured.
+  std::vector<double> throughput_;
 };
 
 class V8_PLATFORM_EXPORT DefaultJobHandle : public JobHandle {
@@ -46,14 +46,14 @@ std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
     std::unique_ptr<v8::TracingController> tracing_controller,
-    PriorityMode priority_mode) {
+    PriorityMode priority_mode, JobConcurrencyMode job_concurrency_mode) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
       thread_pool_size, idle_task_support, std::move(tracing_controller),
-      priority_mode);
+      priority_mode, job_concurrency_mode);
   return platform;
 }
 
@@ -92,15 +92,22 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
   static_cast<DefaultPlatform*>(platform)->NotifyIsolateShutdown(isolate);
 }
 
+bool SetWorkerThreadCpus(v8::Platform* platform, TaskPriority priority,
+                         const std::vector<int>& cpus) {
+  return static_cast<DefaultPlatform*>(platform)->SetWorkerThreadCpus(priority,
+                                                                      cpus);
+}
+
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     std::unique_ptr<v8::TracingController> tracing_controller,
-    PriorityMode priority_mode)
+    PriorityMode priority_mode, JobConcurrencyMode job_concurrency_mode)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()),
-      priority_mode_(priority_mode) {
+      priority_mode_(priority_mode),
+      job_concurrency_mode_(job_concurrency_mode) {
   if (!tracing_controller_) {
     tracing::TracingController* controller = new tracing::TracingController();
 #if !defined(V8_USE_PERFETTO)
@@ -238,6 +245,22 @@ void DefaultPlatform::PostDelayedTaskOnWorkerThreadImpl(
                                                        delay_in_seconds);
 }
 
+std::map<DefaultWorkerThreadsTaskRunner::TaskSource,
+         DefaultWorkerThreadsTaskRunner::TaskSourceStats>
+DefaultPlatform::GetWorkerTaskSourceStats(TaskPriority priority) {
+  int index = priority_to_index(priority);
+  DCHECK_NOT_NULL(worker_threads_task_runners_[index]);
+  return worker_threads_task_runners_[index]->GetTaskSourceStats();
+}
+
+bool DefaultPlatform::SetWorkerThreadCpus(TaskPriority priority,
+                                          const std::vector<int>& cpus) {
+  base::MutexGuard guard(&lock_);
+  int index = priority_to_index(priority);
+  if (!worker_threads_task_runners_[index]) return false;
+  return worker_threads_task_runners_[index]->SetCpus(cpus);
+}
+
 bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
   return idle_task_support_ == IdleTaskSupport::kEnabled;
 }
@@ -249,8 +272,9 @@ std::unique_ptr<JobHandle> DefaultPlatform::CreateJobImpl(
   if (priority == TaskPriority::kBestEffort && num_worker_threads > 2) {
     num_worker_threads = 2;
   }
-  return NewDefaultJobHandle(this, priority, std::move(job_task),
-                             num_worker_threads);
+  return std::make_unique<DefaultJobHandle>(std::make_shared<DefaultJobState>(
+      this, std::move(job_task), priority, num_worker_threads,
+      job_concurrency_mode_));
 }
 
 double DefaultPlatform::MonotonicallyIncreasingTime() {
@@ -15,6 +15,7 @@
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/mutex.h"
 #include "src/libplatform/default-thread-isolated-allocator.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
 
 namespace v8 {
 namespace platform {
@@ -22,7 +23,6 @@ namespace platform {
 class Thread;
 class WorkerThread;
 class DefaultForegroundTaskRunner;
-class DefaultWorkerThreadsTaskRunner;
 class DefaultPageAllocator;
 
 class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
@@ -31,7 +31,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
       int thread_pool_size = 0,
       IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
       std::unique_ptr<v8::TracingController> tracing_controller = {},
-      PriorityMode priority_mode = PriorityMode::kDontApply);
+      PriorityMode priority_mode = PriorityMode::kDontApply,
+      JobConcurrencyMode job_concurrency_mode = JobConcurrencyMode::kFixed);
 
   ~DefaultPlatform() override;
 
@@ -76,6 +77,16 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void NotifyIsolateShutdown(Isolate* isolate);
 
+  // Returns the stats of the worker tasks posted with |priority|, by task
+  // source. Without priority mode, all priorities share the same stats.
+  std::map<DefaultWorkerThreadsTaskRunner::TaskSource,
+           DefaultWorkerThreadsTaskRunner::TaskSourceStats>
+  GetWorkerTaskSourceStats(TaskPriority priority);
+
+  // Restricts the worker threads running tasks with |priority| to |cpus|.
+  // Without priority mode, all priorities share the same threads.
+  bool SetWorkerThreadCpus(TaskPriority priority, const std::vector<int>& cpus);
+
  private:
   base::Thread::Priority priority_from_index(int i) const {
     if (priority_mode_ == PriorityMode::kDontApply) {
@@ -115,6 +126,7 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   DefaultThreadIsolatedAllocator thread_isolated_allocator_;
 
   const PriorityMode priority_mode_;
+  const JobConcurrencyMode job_concurrency_mode_;
   TimeFunction time_function_for_testing_ = nullptr;
 };
 
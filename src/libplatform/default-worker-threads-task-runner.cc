@@ -4,18 +4,54 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include <algorithm>
+
 #include "src/base/platform/time.h"
 #include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+// Number of tasks after which a worker checks for due delayed tasks even if it
+// could get immediate tasks, so that delayed tasks are not starved.
+constexpr size_t kDelayedTaskCheckInterval = 32;
+
+thread_local DefaultWorkerThreadsTaskRunner::TaskSource current_task_source =
+    nullptr;
+
+}  // namespace
+
+DefaultWorkerThreadsTaskRunner::TaskSourceScope::TaskSourceScope(
+    TaskSource source)
+    : previous_source_(current_task_source) {
+  current_task_source = source;
+}
+
+DefaultWorkerThreadsTaskRunner::TaskSourceScope::~TaskSourceScope() {
+  current_task_source = previous_source_;
+}
+
+// static
+DefaultWorkerThreadsTaskRunner::TaskSource
+DefaultWorkerThreadsTaskRunner::CurrentTaskSource() {
+  if (current_task_source) return current_task_source;
+  // Identifies the current thread.
+  static thread_local const char thread_task_source = 0;
+  return &thread_task_source;
+}
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function,
     base::Thread::Priority priority)
     : queue_(time_function), time_function_(time_function) {
+  DCHECK_LT(0, thread_pool_size);
+  for (uint32_t i = 0; i < thread_pool_size; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i, priority));
   }
 }
 
@@ -28,9 +64,10 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   {
     base::MutexGuard guard(&lock_);
-    terminated_ = true;
+    terminated_.store(true, std::memory_order_relaxed);
     queue_.Terminate();
     idle_threads_.clear();
+    num_idle_threads_.store(0);
   }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
@@ -38,26 +75,35 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 
 void DefaultWorkerThreadsTaskRunner::PostTaskImpl(
     std::unique_ptr<Task> task, const SourceLocation& location) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  num_immediate_tasks_.fetch_add(1);
+  size_t index =
+      next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+  WorkerQueue* queue = queues_[index].get();
+  TaskSource source = CurrentTaskSource();
+  double post_time = MonotonicallyIncreasingTime();
+  {
+    base::MutexGuard guard(&queue->mutex);
+    std::deque<QueuedTask>& tasks = queue->tasks[source];
+    if (tasks.empty()) queue->ready_sources.push_back(source);
+    tasks.push_back({std::move(task), source, post_time});
   }
+  // Pairs with the check of |num_immediate_tasks_| in WaitForTask(): either
+  // the worker sees the new task, or it is idle by now and gets notified.
+  if (num_idle_threads_.load() > 0) NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTaskImpl(
     std::unique_ptr<Task> task, double delay_in_seconds,
     const SourceLocation& location) {
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
+  if (terminated_.load(std::memory_order_relaxed)) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
 
   if (!idle_threads_.empty()) {
     idle_threads_.back()->Notify();
     idle_threads_.pop_back();
+    num_idle_threads_.store(idle_threads_.size());
   }
 }
 
@@ -72,11 +118,90 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
+std::map<DefaultWorkerThreadsTaskRunner::TaskSource,
+         DefaultWorkerThreadsTaskRunner::TaskSourceStats>
+DefaultWorkerThreadsTaskRunner::GetTaskSourceStats() {
+  std::map<TaskSource, TaskSourceStats> result;
+  for (auto& queue : queues_) {
+    base::MutexGuard guard(&queue->mutex);
+    for (const auto& [source, stats] : queue->stats) {
+      TaskSourceStats& total = result[source];
+      total.num_tasks += stats.num_tasks;
+      total.queue_time += stats.queue_time;
+      total.run_time += stats.run_time;
+    }
+  }
+  return result;
+}
+
+bool DefaultWorkerThreadsTaskRunner::SetCpus(const std::vector<int>& cpus) {
+  if (terminated_.load(std::memory_order_relaxed)) return false;
+  bool result = true;
+  for (auto& thread : thread_pool_) {
+    result &= thread->SetCpus(cpus);
+  }
+  return result;
+}
+
+DefaultWorkerThreadsTaskRunner::QueuedTask
+DefaultWorkerThreadsTaskRunner::TryGetImmediateTask(size_t index) {
+  if (num_immediate_tasks_.load(std::memory_order_relaxed) == 0) return {};
+  const size_t num_queues = queues_.size();
+  for (size_t i = 0; i < num_queues; ++i) {
+    WorkerQueue* queue = queues_[(index + i) % num_queues].get();
+    base::MutexGuard guard(&queue->mutex);
+    if (queue->ready_sources.empty()) continue;
+    // Round-robin between the sources with queued tasks.
+    TaskSource source = queue->ready_sources.front();
+    queue->ready_sources.pop_front();
+    auto it = queue->tasks.find(source);
+    DCHECK(it != queue->tasks.end());
+    QueuedTask queued_task = std::move(it->second.front());
+    it->second.pop_front();
+    if (it->second.empty()) {
+      queue->tasks.erase(it);
+    } else {
+      queue->ready_sources.push_back(source);
+    }
+    num_immediate_tasks_.fetch_sub(1, std::memory_order_relaxed);
+    return queued_task;
+  }
+  return {};
+}
+
+void DefaultWorkerThreadsTaskRunner::RunImmediateTask(size_t index,
+                                                      QueuedTask queued_task) {
+  double start_time = MonotonicallyIncreasingTime();
+  {
+    TaskSourceScope source_scope(queued_task.source);
+    queued_task.task->Run();
+  }
+  double end_time = MonotonicallyIncreasingTime();
+  queued_task.task.reset();
+
+  WorkerQueue* queue = queues_[index].get();
+  base::MutexGuard guard(&queue->mutex);
+  TaskSourceStats& stats = queue->stats[queued_task.source];
+  stats.num_tasks++;
+  stats.queue_time += start_time - queued_task.post_time;
+  stats.run_time += end_time - start_time;
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleThread() {
+  base::MutexGuard guard(&lock_);
+  if (idle_threads_.empty()) return;
+  idle_threads_.back()->Notify();
+  idle_threads_.pop_back();
+  num_idle_threads_.store(idle_threads_.size());
+}
+
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    DefaultWorkerThreadsTaskRunner* runner, size_t index,
+    base::Thread::Priority priority)
     : Thread(
           Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
@@ -86,32 +211,62 @@ DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  base::MutexGuard guard(&runner_->lock_);
+  size_t tasks_since_delayed_check = 0;
   while (true) {
-    DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
-    switch (next_task.state) {
-      case DelayedTaskQueue::MaybeNextTask::kTask:
-        runner_->lock_.Unlock();
-        next_task.task->Run();
-        runner_->lock_.Lock();
-        continue;
-      case DelayedTaskQueue::MaybeNextTask::kTerminated:
-        return;
-      case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
-        runner_->idle_threads_.push_back(this);
-        condition_var_.Wait(&runner_->lock_);
-        continue;
-      case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
-        // WaitFor unfortunately doesn't care about our fake time and will wait
-        // the 'real' amount of time, based on whatever clock the system call
-        // uses.
-        runner_->idle_threads_.push_back(this);
-        bool notified =
-            condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
-        USE(notified);
+    if (++tasks_since_delayed_check < kDelayedTaskCheckInterval) {
+      QueuedTask queued_task = runner_->TryGetImmediateTask(index_);
+      if (queued_task.task) {
+        runner_->RunImmediateTask(index_, std::move(queued_task));
         continue;
+      }
+    }
+    tasks_since_delayed_check = 0;
+    bool terminated = false;
+    std::unique_ptr<Task> task = WaitForTask(&terminated);
+    if (terminated) return;
+    if (task) task->Run();
+  }
+}
+
+std::unique_ptr<Task>
+DefaultWorkerThreadsTaskRunner::WorkerThread::WaitForTask(bool* terminated) {
+  base::MutexGuard guard(&runner_->lock_);
+  DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
+  switch (next_task.state) {
+    case DelayedTaskQueue::MaybeNextTask::kTask:
+      return std::move(next_task.task);
+    case DelayedTaskQueue::MaybeNextTask::kTerminated:
+      // Immediate tasks posted before termination still run.
+      *terminated = runner_->num_immediate_tasks_.load() == 0;
+      return nullptr;
+    case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
+    case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
+      break;
+  }
+
+  std::vector<WorkerThread*>& idle_threads = runner_->idle_threads_;
+  idle_threads.push_back(this);
+  runner_->num_idle_threads_.store(idle_threads.size());
+  // Pairs with the check of |num_idle_threads_| in PostTaskImpl().
+  if (runner_->num_immediate_tasks_.load() == 0) {
+    if (next_task.state == DelayedTaskQueue::MaybeNextTask::kWaitIndefinite) {
+      condition_var_.Wait(&runner_->lock_);
+    } else {
+      // WaitFor unfortunately doesn't care about our fake time and will wait
+      // the 'real' amount of time, based on whatever clock the system call
+      // uses.
+      bool notified =
+          condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
+      USE(notified);
     }
   }
+  // Whoever notified this thread already removed it from the idle threads.
+  auto it = std::find(idle_threads.begin(), idle_threads.end(), this);
+  if (it != idle_threads.end()) {
+    idle_threads.erase(it);
+    runner_->num_idle_threads_.store(idle_threads.size());
+  }
+  return nullptr;
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Notify() {
@@ -5,6 +5,9 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -23,6 +26,40 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  public:
   using TimeFunction = double (*)();
 
+  // Immediate tasks are grouped by the source that posted them, and workers
+  // take turns between the sources with queued tasks, so that a source posting
+  // many tasks does not starve the others. By default, the source of a task is
+  // the thread that posted it, which for tasks posted by V8 usually identifies
+  // an isolate. Tasks posted by a running task belong to the source of that
+  // task, so that e.g. job workers count towards the thread that posted the
+  // job.
+  using TaskSource = const void*;
+
+  // Attributes all tasks posted on the current thread during its lifetime to
+  // |source|.
+  class V8_PLATFORM_EXPORT V8_NODISCARD TaskSourceScope final {
+   public:
+    explicit TaskSourceScope(TaskSource source);
+    ~TaskSourceScope();
+
+    TaskSourceScope(const TaskSourceScope&) = delete;
+    TaskSourceScope& operator=(const TaskSourceScope&) = delete;
+
+   private:
+    TaskSource previous_source_;
+  };
+
+  struct TaskSourceStats {
+    // Number of tasks of the source that ran.
+    size_t num_tasks = 0;
+    // Total time in seconds, as reported by the runner's time function, that
+    // these tasks spent queued and running.
+    double queue_time = 0;
+    double run_time = 0;
+  };
+
+  static TaskSource CurrentTaskSource();
+
   DefaultWorkerThreadsTaskRunner(
       uint32_t thread_pool_size, TimeFunction time_function,
       base::Thread::Priority priority = base::Thread::Priority::kDefault);
@@ -36,6 +73,13 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   // v8::TaskRunner implementation.
   bool IdleTasksEnabled() override;
 
+  // Returns the stats of the immediate tasks that ran so far, by source.
+  std::map<TaskSource, TaskSourceStats> GetTaskSourceStats();
+
+  // Restricts all worker threads to the given CPUs, see base::Thread::SetCpus.
+  // Must not be called concurrently with Terminate().
+  bool SetCpus(const std::vector<int>& cpus);
+
  private:
   // v8::TaskRunner implementation.
   void PostTaskImpl(std::unique_ptr<Task> task,
@@ -50,7 +94,7 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   class WorkerThread : public base::Thread {
    public:
     explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
-                          base::Thread::Priority priority);
+                          size_t index, base::Thread::Priority priority);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -62,24 +106,70 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     void Notify();
 
    private:
+    // Waits on the delayed task queue of |runner_| until a task is posted or
+    // the next delayed task is due. Returns a due delayed task if there is
+    // one, or nullptr after waking up. Sets |terminated| if the runner was
+    // terminated and has no more tasks.
+    std::unique_ptr<Task> WaitForTask(bool* terminated);
+
     DefaultWorkerThreadsTaskRunner* runner_;
+    // Index of this thread's queue in |runner_->queues_|.
+    const size_t index_;
     base::ConditionVariable condition_var_;
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  struct QueuedTask {
+    std::unique_ptr<Task> task;
+    TaskSource source;
+    double post_time;
+  };
+
+  // Immediate tasks are distributed round-robin over one queue per worker
+  // thread. Workers run the tasks of their own queue and steal from the queues
+  // of other workers when it is empty, so that posting and running tasks does
+  // not contend on |lock_|, which is only taken for delayed tasks and for
+  // putting workers to sleep and waking them up.
+  struct WorkerQueue {
+    base::Mutex mutex;
+    // Queued tasks of each source, and the order in which the sources with
+    // queued tasks get to run their next task.
+    std::map<TaskSource, std::deque<QueuedTask>> tasks;
+    std::deque<TaskSource> ready_sources;
+    // Stats of the tasks run by the worker owning this queue.
+    std::map<TaskSource, TaskSourceStats> stats;
+  };
+
+  // Pops the next task from the queue of worker |index|, or steals one from
+  // another queue. Returns a QueuedTask without a task if all queues are
+  // empty.
+  QueuedTask TryGetImmediateTask(size_t index);
+
+  // Runs an immediate task on worker |index| and records its stats.
+  void RunImmediateTask(size_t index, QueuedTask queued_task);
+
+  // Wakes up one idle worker, if there is any.
+  void NotifyIdleThread();
 
-  bool terminated_ = false;
+  std::atomic<bool> terminated_{false};
   base::Mutex lock_;
   // Vector of idle threads -- these are pushed in LIFO order, so that the most
   // recently active thread is the first to be reactivated.
   std::vector<WorkerThread*> idle_threads_;
+  // Mirrors |idle_threads_.size()|, so that posting a task only takes |lock_|
+  // if a worker needs to be woken up.
+  std::atomic<size_t> num_idle_threads_{0};
+  // Number of tasks in |queues_|. Incremented before a task is pushed and
+  // decremented after it is popped, so it never underestimates the number of
+  // queued tasks.
+  std::atomic<size_t> num_immediate_tasks_{0};
+  std::atomic<size_t> next_queue_{0};
+  // Outlive the worker threads, so that tasks can be posted concurrently with
+  // Terminate().
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   // Worker threads access this queue, so we can only destroy it after all
-  // workers stopped.
+  // workers stopped. Only holds delayed tasks.
   DelayedTaskQueue queue_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
   TimeFunction time_function_;
 };
 
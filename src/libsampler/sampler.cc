@@ -34,6 +34,13 @@
 
 #include <unistd.h>
 
+#if V8_OS_LINUX
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#endif
+
 #elif V8_OS_WIN || V8_OS_CYGWIN
 
 #include <windows.h>
@@ -205,9 +212,14 @@ class Sampler::PlatformData {
   int vm_tid() const { return vm_tid_; }
   pthread_t vm_tself() const { return vm_tself_; }
 
+  // File descriptor of the perf_event backing the per-thread timer, or -1.
+  int timer_fd() const { return timer_fd_; }
+  void set_timer_fd(int fd) { timer_fd_ = fd; }
+
  private:
   int vm_tid_;
   pthread_t vm_tself_;
+  int timer_fd_ = -1;
 };
 
 void SamplerManager::AddSampler(Sampler* sampler) {
@@ -587,6 +599,11 @@ void Sampler::Start() {
 
 void Sampler::Stop() {
 #if defined(USE_SIGNALS)
+  if (HasPerThreadTimer()) {
+    per_thread_timer_.store(false, std::memory_order_relaxed);
+    close(platform_data()->timer_fd());
+    platform_data()->set_timer_fd(-1);
+  }
   SamplerManager::instance()->RemoveSampler(this);
   SignalHandler::DecreaseSamplerCount();
 #endif
@@ -603,6 +620,56 @@ void Sampler::DoSample() {
   pthread_kill(platform_data()->vm_tself(), SIGPROF);
 }
 
+#if V8_OS_LINUX
+
+bool Sampler::StartPerThreadTimer(base::TimeDelta interval) {
+  DCHECK(IsActive());
+  DCHECK(!HasPerThreadTimer());
+  base::RecursiveMutexGuard lock_guard(SignalHandler::mutex());
+  if (!SignalHandler::Installed()) return false;
+
+  // The task clock only advances while the thread is running, and its
+  // overflows are turned into SIGPROF by the kernel and delivered to the
+  // thread directly, without waking up another thread.
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_SOFTWARE;
+  attr.config = PERF_COUNT_SW_TASK_CLOCK;
+  attr.sample_period =
+      static_cast<uint64_t>(std::max<int64_t>(interval.InNanoseconds(), 1));
+  attr.wakeup_events = 1;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  int tid = platform_data()->vm_tid();
+  int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1,
+                                    PERF_FLAG_FD_CLOEXEC));
+  // Fails e.g. if perf events are restricted by perf_event_paranoid or a
+  // seccomp sandbox.
+  if (fd < 0) return false;
+
+  struct f_owner_ex owner;
+  owner.type = F_OWNER_TID;
+  owner.pid = tid;
+  if (fcntl(fd, F_SETFL, O_ASYNC) != 0 || fcntl(fd, F_SETSIG, SIGPROF) != 0 ||
+      fcntl(fd, F_SETOWN_EX, &owner) != 0) {
+    close(fd);
+    return false;
+  }
+  platform_data()->set_timer_fd(fd);
+  per_thread_timer_.store(true, std::memory_order_relaxed);
+  if (ioctl(fd, PERF_EVENT_IOC_ENABLE, 0) != 0) {
+    per_thread_timer_.store(false, std::memory_order_relaxed);
+    platform_data()->set_timer_fd(-1);
+    close(fd);
+    return false;
+  }
+  return true;
+}
+
+#endif  // V8_OS_LINUX
+
 #elif V8_OS_WIN || V8_OS_CYGWIN
 
 void Sampler::DoSample() {
@@ -686,5 +753,9 @@ void Sampler::DoSample() {
 
 #endif  // USE_SIGNALS
 
+#if !defined(USE_SIGNALS) || !V8_OS_LINUX
+bool Sampler::StartPerThreadTimer(base::TimeDelta interval) { return false; }
+#endif
+
 }  // namespace sampler
 }  // namespace v8
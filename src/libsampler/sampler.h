@@ -12,6 +12,7 @@
 
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 #if V8_OS_POSIX && !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 #define USE_SIGNALS
@@ -54,10 +55,24 @@ class V8_EXPORT_PRIVATE Sampler {
   // Whether the sampler is running (start has been called).
   bool IsActive() const { return active_.load(std::memory_order_relaxed); }
 
+  // Asks the kernel to send the sampling signal to the sampled thread every
+  // |interval| of CPU time consumed by that thread, so that DoSample() no
+  // longer needs to be called. Only supported on Linux, where it uses a
+  // perf_event task clock. Returns false if the timer could not be set up.
+  // Must be called after Start(); the timer is stopped by Stop().
+  bool StartPerThreadTimer(base::TimeDelta interval);
+
+  // Whether samples are triggered by a per-thread timer.
+  bool HasPerThreadTimer() const {
+    return per_thread_timer_.load(std::memory_order_relaxed);
+  }
+
   // Returns true and consumes the pending sample bit if a sample should be
-  // dispatched to this sampler.
+  // dispatched to this sampler. Every signal is a sample request when a
+  // per-thread timer is used.
   bool ShouldRecordSample() {
-    return record_sample_.exchange(false, std::memory_order_relaxed);
+    return HasPerThreadTimer() ||
+           record_sample_.exchange(false, std::memory_order_relaxed);
   }
 
   void DoSample();
@@ -91,6 +106,7 @@ class V8_EXPORT_PRIVATE Sampler {
   Isolate* isolate_;
   std::atomic_bool active_{false};
   std::atomic_bool record_sample_{false};
+  std::atomic_bool per_thread_timer_{false};
   std::unique_ptr<PlatformData> data_;  // Platform specific data.
   DISALLOW_IMPLICIT_CONSTRUCTORS(Sampler);
 };
@@ -13,7 +13,7 @@ namespace internal {
 // Generic range histograms.
 // HR(name, caption, min, max, num_buckets)
 #define HISTOGRAM_RANGE_LIST(HR)                                               \
-  HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 9, 9)              \
+  HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 10, 10)            \
   HR(errors_thrown_per_context, V8.ErrorsThrownPerContext, 0, 200, 20)         \
   HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0,             \
      kGarbageCollectionReasonMaxValue, kGarbageCollectionReasonMaxValue + 1)   \
@@ -97,6 +97,11 @@ namespace internal {
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
   /* Number of times a cache event is triggered for a wasm module. */          \
   HR(wasm_cache_count, V8.WasmCacheCount, 0, 100, 101)                         \
+  /* Size of the pool of finished JSPI stacks, sampled when a stack is */      \
+  /* added, and the percentage of stacks taken from the pool since the */      \
+  /* last time it was released. */                                             \
+  HR(wasm_stack_pool_size_kb, V8.WasmStackPoolSizeKiB, 0, 4096, 64)            \
+  HR(wasm_stack_pool_reuse_percent, V8.WasmStackPoolReusePercent, 0, 100, 101) \
   /* Number of in-use external pointers in the external pointer table. */      \
   /* Counted after sweeping the table at the end of mark-compact GC. */        \
   HR(external_pointers_count, V8.SandboxedExternalPointersCount, 0,            \
@@ -362,6 +367,8 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  SC(descriptor_lookup_cache_hits, V8.DescriptorLookupCacheHits)               \
+  SC(descriptor_lookup_cache_misses, V8.DescriptorLookupCacheMisses)           \
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
@@ -385,7 +392,31 @@ namespace internal {
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
-  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
+  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)              \
+  /* Stacks for JSPI suspendable calls, newly allocated or reused from the */  \
+  /* stack pool. */                                                            \
+  SC(wasm_stacks_allocated, V8.WasmStacksAllocated)                            \
+  SC(wasm_stacks_reused, V8.WasmStacksReused)                                  \
+  /* Number of RwxMemoryWriteBatchScopes and the code memory permission */     \
+  /* switches they saved. */                                                   \
+  SC(rwx_write_batch_scopes, V8.RwxMemoryWriteBatchScopes)                     \
+  SC(rwx_write_batch_saved_permission_switches,                                \
+     V8.RwxMemoryWriteBatchSavedPermissionSwitches)                            \
+  /* Refills of shared space LABs outside of GC and how often the shared */    \
+  /* space lock was contended during a refill. */                              \
+  SC(shared_space_lab_refills, V8.SharedSpaceLabRefills)                       \
+  SC(shared_space_lab_lock_waits, V8.SharedSpaceLabLockWaits)                  \
+  /* Functions queued for, compiled by, and installed from concurrent */       \
+  /* Sparkplug batches. */                                                     \
+  SC(sparkplug_queued_functions, V8.SparkplugQueuedFunctions)                  \
+  SC(sparkplug_compiled_functions, V8.SparkplugCompiledFunctions)              \
+  SC(sparkplug_installed_functions, V8.SparkplugInstalledFunctions)            \
+  /* Bytes of JSON.parse and deserialized payloads that were allocated in */   \
+  /* old space based on pretenuring feedback and thus never scavenged. */      \
+  SC(parse_pretenured_bytes, V8.ParsePretenuredBytes)                          \
+  /* ICU formatters reused from, or added to, the Intl formatter cache. */     \
+  SC(intl_formatter_cache_hits, V8.IntlFormatterCacheHits)                     \
+  SC(intl_formatter_cache_misses, V8.IntlFormatterCacheMisses)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
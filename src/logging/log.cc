@@ -23,6 +23,7 @@
 #include "src/common/assert-scope.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/diagnostics/perf-jit.h"
+#include "src/diagnostics/perf-output-writer.h"
 #include "src/execution/isolate.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
@@ -361,6 +362,8 @@ class LinuxPerfBasicLogger : public CodeEventLogger {
 #endif  // V8_ENABLE_WEBASSEMBLY
   void WriteLogRecordedBuffer(uintptr_t address, int size, const char* name,
                               int name_length);
+  void WriteBufferedLogRecordedBuffer(uintptr_t address, int size,
+                                      const char* name, int name_length);
 
   static base::LazyRecursiveMutex& GetFileMutex();
 
@@ -372,6 +375,8 @@ class LinuxPerfBasicLogger : public CodeEventLogger {
   // to determine when it goes away, we keep the reference count.
   static FILE* perf_output_handle_;
   static uint64_t reference_count_;
+  // Writes the file from a background thread with --perf-prof-buffered.
+  static PerfOutputWriter* perf_output_writer_;
 };
 
 // Extra space for the "perf-%d.map" filename, including the PID.
@@ -387,6 +392,7 @@ base::LazyRecursiveMutex& LinuxPerfBasicLogger::GetFileMutex() {
 // LinuxPerfBasicLogger::GetFileMutex().
 uint64_t LinuxPerfBasicLogger::reference_count_ = 0;
 FILE* LinuxPerfBasicLogger::perf_output_handle_ = nullptr;
+PerfOutputWriter* LinuxPerfBasicLogger::perf_output_writer_ = nullptr;
 
 LinuxPerfBasicLogger::LinuxPerfBasicLogger(Isolate* isolate)
     : CodeEventLogger(isolate) {
@@ -407,7 +413,11 @@ LinuxPerfBasicLogger::LinuxPerfBasicLogger(Isolate* isolate)
     perf_output_handle_ =
         base::OS::FOpen(perf_dump_name.begin(), base::OS::LogFileOpenMode);
     CHECK_NOT_NULL(perf_output_handle_);
-    setvbuf(perf_output_handle_, nullptr, _IOLBF, 0);
+    if (v8_flags.perf_prof_buffered) {
+      perf_output_writer_ = new PerfOutputWriter(perf_output_handle_);
+    } else {
+      setvbuf(perf_output_handle_, nullptr, _IOLBF, 0);
+    }
   }
 }
 
@@ -418,6 +428,8 @@ LinuxPerfBasicLogger::~LinuxPerfBasicLogger() {
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
     CHECK_NOT_NULL(perf_output_handle_);
+    delete perf_output_writer_;
+    perf_output_writer_ = nullptr;
     base::Fclose(perf_output_handle_);
     perf_output_handle_ = nullptr;
   }
@@ -426,6 +438,10 @@ LinuxPerfBasicLogger::~LinuxPerfBasicLogger() {
 void LinuxPerfBasicLogger::WriteLogRecordedBuffer(uintptr_t address, int size,
                                                   const char* name,
                                                   int name_length) {
+  if (perf_output_writer_ != nullptr) {
+    WriteBufferedLogRecordedBuffer(address, size, name, name_length);
+    return;
+  }
   // Linux perf expects hex literals without a leading 0x, while some
   // implementations of printf might prepend one when using the %p format
   // for pointers, leading to wrongly formatted JIT symbols maps. On the other
@@ -442,6 +458,25 @@ void LinuxPerfBasicLogger::WriteLogRecordedBuffer(uintptr_t address, int size,
 #endif
 }
 
+void LinuxPerfBasicLogger::WriteBufferedLogRecordedBuffer(uintptr_t address,
+                                                          int size,
+                                                          const char* name,
+                                                          int name_length) {
+  // Same format as above. Leaves room for the address, the size and the
+  // separators around the name.
+  static constexpr int kMaxPrefixLength = 48;
+  base::ScopedVector<char> line(kMaxPrefixLength + name_length);
+#ifdef V8_OS_ANDROID
+  int length = SNPrintF(line, "0x%" V8PRIxPTR " 0x%x %.*s\n", address, size,
+                        name_length, name);
+#else
+  int length = SNPrintF(line, "%" V8PRIxPTR " %x %.*s\n", address, size,
+                        name_length, name);
+#endif
+  CHECK_GT(length, 0);
+  perf_output_writer_->Write(line.begin(), length);
+}
+
 void LinuxPerfBasicLogger::LogRecordedBuffer(Tagged<AbstractCode> code,
                                              MaybeHandle<SharedFunctionInfo>,
                                              const char* name, int length) {
@@ -201,16 +201,38 @@ void RuntimeCallStats::Enter(RuntimeCallTimer* timer,
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallCounter* counter = GetCounter(counter_id);
   DCHECK_NOT_NULL(counter->name());
-  timer->Start(counter, current_timer());
+  RuntimeCallTimer* parent = current_timer();
+  if (V8_UNLIKELY(IsSampledMode()) && !ShouldTimeSampledEntry(parent)) {
+    // Keep the timer stopped, Leave() only increments the count.
+    timer->set_counter(counter);
+    timer->set_parent(parent);
+  } else {
+    timer->Start(counter, parent);
+  }
   current_timer_.SetValue(timer);
   current_counter_.SetValue(counter);
 }
 
+bool RuntimeCallStats::ShouldTimeSampledEntry(RuntimeCallTimer* parent) {
+  // Nested entries are timed if and only if their parent is, so that the own
+  // times of the timed entries stay exact.
+  if (parent != nullptr) return parent->IsStarted();
+  if (entries_until_timed_ > 1) {
+    entries_until_timed_--;
+    return false;
+  }
+  entries_until_timed_ = v8_flags.rcs_sampling_interval;
+  return true;
+}
+
 void RuntimeCallStats::Leave(RuntimeCallTimer* timer) {
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallTimer* stack_top = current_timer();
   if (stack_top == nullptr) return;  // Missing timer is a result of Reset().
   CHECK(stack_top == timer);
+  if (V8_UNLIKELY(IsSampledMode()) && !timer->IsStarted()) {
+    timer->counter()->Increment();
+  }
   current_timer_.SetValue(timer->Stop());
   RuntimeCallTimer* cur_timer = current_timer();
   current_counter_.SetValue(cur_timer ? cur_timer->counter() : nullptr);
@@ -274,6 +296,7 @@ void RuntimeCallStats::Reset() {
   for (int i = 0; i < kNumberOfCounters; i++) {
     GetCounter(i)->Reset();
   }
+  entries_until_timed_ = 0;
 
   in_use_ = true;
 }
@@ -320,6 +343,14 @@ void WorkerThreadRuntimeCallStats::AddToMainTable(
   }
 }
 
+void WorkerThreadRuntimeCallStats::AddTo(RuntimeCallStats* stats) {
+  base::MutexGuard lock(&mutex_);
+  for (auto& worker_stats : tables_) {
+    DCHECK_NE(stats, worker_stats.get());
+    stats->Add(worker_stats.get());
+  }
+}
+
 WorkerThreadRuntimeCallStatsScope::WorkerThreadRuntimeCallStatsScope(
     WorkerThreadRuntimeCallStats* worker_stats) {
   if (V8_LIKELY(!TracingFlags::is_runtime_stats_enabled())) return;
@@ -204,6 +204,7 @@ class RuntimeCallTimer final {
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMany)                                        \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -273,6 +274,7 @@ class RuntimeCallTimer final {
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
   V(String_NewFromUtf8Literal)                             \
+  V(String_NewSubString)                                   \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
@@ -394,6 +396,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLateOptimization)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopPeeling)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnrolling)           \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopVectorization)       \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMachineLowering)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMaglevGraphBuilding)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftOptimize)                \
@@ -638,6 +641,14 @@ class RuntimeCallStats final {
   // parent.
   V8_EXPORT_PRIVATE void Leave(RuntimeCallTimer* timer);
 
+  // With --rcs-sampling-interval=n, every entry is counted but only every n-th
+  // outermost entry is timed, together with all entries nested in it. The
+  // times of the counters then have to be scaled up by n.
+  static bool IsSampledMode() {
+    return TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
+           v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLED_COUNTERS;
+  }
+
   // Set counter id for the innermost measurement. It can be used to refine
   // event kind when a runtime entry counter is too generic.
   V8_EXPORT_PRIVATE void CorrectCurrentCounterId(
@@ -692,12 +703,16 @@ class RuntimeCallStats final {
   }
 
  private:
+  bool ShouldTimeSampledEntry(RuntimeCallTimer* parent);
+
   // Top of a stack of active timers.
   base::AtomicValue<RuntimeCallTimer*> current_timer_;
   // Active counter object associated with current timer.
   base::AtomicValue<RuntimeCallCounter*> current_counter_;
   // Used to track nested tracing scopes.
   bool in_use_;
+  // Outermost entries left until the next timed one in sampled mode.
+  uint32_t entries_until_timed_ = 0;
   ThreadType thread_type_;
   ThreadId thread_id_;
   RuntimeCallCounter counters_[kNumberOfCounters];
@@ -718,6 +733,10 @@ class WorkerThreadRuntimeCallStats final {
   // Adds the counters from the worker thread tables to |main_call_stats|.
   void AddToMainTable(RuntimeCallStats* main_call_stats);
 
+  // Adds the counters from the worker thread tables to |stats| without
+  // resetting the worker thread tables.
+  void AddTo(RuntimeCallStats* stats);
+
  private:
   base::Mutex mutex_;
   std::vector<std::unique_ptr<RuntimeCallStats>> tables_;
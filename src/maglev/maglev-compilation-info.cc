@@ -18,6 +18,7 @@
 #endif
 #include "src/maglev/maglev-compilation-unit.h"
 #include "src/maglev/maglev-graph-labeller.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/identity-map.h"
 
@@ -71,6 +72,15 @@ static bool SpecializeToFunctionContext(
          ReadOnlyRoots(isolate).one_closure_cell_map();
 }
 
+// The TieringManager only raises the OSR urgency of a function when it keeps
+// running a loop after a tier-up was requested, and cached OSR code means that
+// such a request was served before.
+static bool HadLongRunningLoops(DirectHandle<JSFunction> function) {
+  if (!function->has_feedback_vector()) return false;
+  Tagged<FeedbackVector> vector = function->feedback_vector();
+  return vector->osr_urgency() > 0 || vector->maybe_has_optimized_osr_code();
+}
+
 }  // namespace
 
 MaglevCompilationInfo::MaglevCompilationInfo(
@@ -93,7 +103,8 @@ MaglevCompilationInfo::MaglevCompilationInfo(
 #undef V
       ,
       specialize_to_function_context_(SpecializeToFunctionContext(
-          isolate, osr_offset, function, specialize_to_function_context)) {
+          isolate, osr_offset, function, specialize_to_function_context)),
+      toplevel_had_long_running_loops_(HadLongRunningLoops(function)) {
   if (owns_broker_) {
     canonical_handles_ = std::make_unique<CanonicalHandlesMap>(
         isolate->heap(), ZoneAllocationPolicy(&zone_));
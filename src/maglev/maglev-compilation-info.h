@@ -105,6 +105,12 @@ class MaglevCompilationInfo final {
     return specialize_to_function_context_;
   }
 
+  // True if the feedback of the toplevel function shows that one of its loops
+  // ran long enough in a lower tier to request OSR.
+  bool toplevel_had_long_running_loops() const {
+    return toplevel_had_long_running_loops_;
+  }
+
   // Must be called from within a MaglevCompilationHandleScope. Transfers owned
   // handles (e.g. shared_, function_) to the new scope.
   void ReopenAndCanonicalizeHandlesInNewScope(Isolate* isolate);
@@ -180,6 +186,10 @@ class MaglevCompilationInfo final {
   // contexts.
   const bool specialize_to_function_context_;
 
+  // Snapshot of the OSR state of the toplevel feedback vector, taken on the
+  // main thread. See toplevel_had_long_running_loops().
+  const bool toplevel_had_long_running_loops_;
+
   // 1) PersistentHandles created via PersistentHandlesScope inside of
   //    CompilationHandleScope.
   // 2) Owned by MaglevCompilationInfo.
@@ -4,9 +4,11 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include "include/v8-metrics.h"
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/deoptimizer/deopt-stats.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate-inl.h"
 #include "src/flags/flags.h"
@@ -112,7 +114,11 @@ MaglevCompilationJob::MaglevCompilationJob(
       info_(std::move(info)),
       zone_stats_(isolate->allocator()),
       pipeline_statistics_(
-          CreatePipelineStatistics(isolate, info_.get(), &zone_stats_)) {
+          CreatePipelineStatistics(isolate, info_.get(), &zone_stats_)),
+      bytecode_size_(info_->toplevel_function()
+                         ->shared()
+                         ->GetBytecodeArray(isolate)
+                         ->length()) {
   DCHECK(maglev::IsMaglevEnabled());
 }
 
@@ -231,6 +237,27 @@ void MaglevCompilationJob::RecordCompilationStats(Isolate* isolate) const {
   }
 }
 
+void MaglevCompilationJob::RecordCompileJob(Isolate* isolate,
+                                            BailoutReason reason) const {
+  v8::metrics::CompileJob event;
+  event.tier = v8::metrics::CompileJob::Tier::kMaglev;
+  event.osr = is_osr();
+  InitializeCompileJobEvent(&event);
+  event.bytecode_size_in_bytes = bytecode_size_;
+  Handle<Code> maglev_code;
+  if (event.success && code().ToHandle(&maglev_code)) {
+    event.code_size_in_bytes = maglev_code->instruction_size();
+  } else {
+    event.success = false;
+    event.bailout_reason = static_cast<int>(reason);
+    if (DeoptStats* deopt_stats = isolate->deopt_stats()) {
+      deopt_stats->RecordBailout(function()->shared(), CodeKind::MAGLEV,
+                                 reason);
+    }
+  }
+  Compiler::RecordCompileJob(isolate, event);
+}
+
 uint64_t MaglevCompilationJob::trace_id() const {
   // Xor together the this pointer, the info pointer, and the top level
   // function's Handle address, to try to make the id more unique on platforms
@@ -268,7 +295,18 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
     LocalIsolate local_isolate(isolate(), ThreadKind::kBackground);
     DCHECK(local_isolate.heap()->IsParked());
 
-    std::unique_ptr<MaglevCompilationJob> job_to_destruct;
+    // Installing code requires a round-trip to the main thread, so the
+    // request is only made once per batch of compiled functions, or when
+    // there is nothing left to compile.
+    int batch_bytecode_size = 0;
+    bool install_pending = false;
+    auto request_install = [&]() {
+      if (!install_pending) return;
+      isolate()->stack_guard()->RequestInstallMaglevCode();
+      install_pending = false;
+      batch_bytecode_size = 0;
+    };
+
     while (!delegate->ShouldYield()) {
       std::unique_ptr<MaglevCompilationJob> job;
       if (incoming_queue()->Dequeue(&job)) {
@@ -282,8 +320,14 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
         CompilationJob::Status status =
             job->ExecuteJob(local_isolate.runtime_call_stats(), &local_isolate);
         if (status == CompilationJob::SUCCEEDED) {
+          batch_bytecode_size += job->bytecode_size();
+          install_pending = true;
           outgoing_queue()->Enqueue(std::move(job));
-          isolate()->stack_guard()->RequestInstallMaglevCode();
+        }
+        if (batch_bytecode_size >=
+                v8_flags.concurrent_maglev_batch_bytecode_size ||
+            incoming_queue()->IsEmpty()) {
+          request_install();
         }
       } else if (destruction_queue()->Dequeue(&job)) {
         // Maglev jobs aren't cheap to destruct, so destroy them here in the
@@ -298,6 +342,7 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
         break;
       }
     }
+    request_install();
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -364,6 +409,7 @@ void MaglevConcurrentDispatcher::EnqueueJob(
 
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
+  bool enqueued_for_destruction = false;
   while (!outgoing_queue_.IsEmpty()) {
     std::unique_ptr<MaglevCompilationJob> job;
     outgoing_queue_.Dequeue(&job);
@@ -378,7 +424,7 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
       // Maglev jobs aren't cheap to destruct, so re-enqueue them for
       // destruction on a background thread.
       destruction_queue_.Enqueue(std::move(job));
-      job_handle_->NotifyConcurrencyIncrease();
+      enqueued_for_destruction = true;
     } else {
       TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                              "V8.MaglevDestruct", job->trace_id(),
@@ -386,6 +432,8 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
       job.reset();
     }
   }
+  // Notify the worker once for the whole batch of finalized jobs.
+  if (enqueued_for_destruction) job_handle_->NotifyConcurrencyIncrease();
 }
 
 void MaglevConcurrentDispatcher::AwaitCompileJobs() {
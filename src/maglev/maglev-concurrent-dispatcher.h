@@ -63,11 +63,17 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
 
   bool specialize_to_function_context() const;
 
+  // The size of the bytecode of the top-level function, used to batch
+  // installation requests.
+  int bytecode_size() const { return bytecode_size_; }
+
   base::TimeDelta time_taken_to_prepare() { return time_taken_to_prepare_; }
   base::TimeDelta time_taken_to_execute() { return time_taken_to_execute_; }
   base::TimeDelta time_taken_to_finalize() { return time_taken_to_finalize_; }
 
   void RecordCompilationStats(Isolate* isolate) const;
+  // |reason| is why the job was dropped before it was finalized, if it was.
+  void RecordCompileJob(Isolate* isolate, BailoutReason reason) const;
 
   void DisposeOnMainThread(Isolate* isolate);
 
@@ -89,6 +95,7 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   // Currently only totals are collected.
   compiler::ZoneStats zone_stats_;
   std::unique_ptr<MaglevPipelineStatistics> pipeline_statistics_;
+  const int bytecode_size_;
 };
 
 // The public API for Maglev concurrent compilation.
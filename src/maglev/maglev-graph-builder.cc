@@ -28,6 +28,7 @@
 #include "src/compiler/js-heap-broker-inl.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/compiler/processed-feedback.h"
+#include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimize-reason.h"
 #include "src/execution/protectors.h"
 #include "src/flags/flags.h"
@@ -1016,6 +1017,15 @@ BasicBlock* MaglevGraphBuilder::EndPrologue() {
   return first_block;
 }
 
+void MaglevGraphBuilder::BuildBreakpointEntryCheck() {
+  // Deoptimize before the first bytecode if the function has been prepared
+  // for debugging since this code was compiled.
+  breakpoint_entry_check_built_ = true;
+  AddNewNode<CheckBreakpointEntry>(
+      {}, broker()->isolate()->debug()->BreakpointEntryCheckAddress(
+              *compilation_unit_->shared_function_info().object()));
+}
+
 void MaglevGraphBuilder::SetArgument(int i, ValueNode* value) {
   interpreter::Register reg = interpreter::Register::FromParameterIndex(i);
   current_interpreter_frame_.set(reg, value);
@@ -1240,6 +1250,11 @@ MaglevGraphBuilder::GetResultLocationAndSize() const {
   using OperandType = interpreter::OperandType;
   using ImplicitRegisterUse = interpreter::ImplicitRegisterUse;
   Bytecode bytecode = iterator_.current_bytecode();
+  // StarGetNamedProperty writes its output register before the load, so only
+  // the accumulator holds the result of a lazy deopt.
+  if (bytecode == Bytecode::kStarGetNamedProperty) {
+    return {interpreter::Register::virtual_accumulator(), 1};
+  }
   // TODO(leszeks): Only emit these cases for bytecodes we know can lazy deopt.
   switch (bytecode) {
 #define CASE(Name, ...)                                           \
@@ -5455,22 +5470,22 @@ ValueNode* MaglevGraphBuilder::BuildLoadElements(ValueNode* object) {
 ReduceResult MaglevGraphBuilder::BuildLoadTypedArrayLength(
     ValueNode* object, ElementsKind elements_kind) {
   DCHECK(IsTypedArrayOrRabGsabTypedArrayElementsKind(elements_kind));
-  bool is_variable_length = IsRabGsabTypedArrayElementsKind(elements_kind);
-
-  if (!is_variable_length) {
-    // Note: We can't use broker()->length_string() here, because it could
-    // conflict with redefinitions of the TypedArray length property.
-    RETURN_IF_DONE(TryFindLoadedProperty(
-        known_node_aspects().loaded_constant_properties, object,
-        KnownNodeAspects::LoadedPropertyMapKey::TypedArrayLength()));
+  if (IsRabGsabTypedArrayElementsKind(elements_kind)) {
+    // The length of length-tracking and RAB backed typed arrays changes when
+    // the buffer is resized, so it can't be cached.
+    return AddNewNode<LoadRabGsabTypedArrayLength>({object}, elements_kind);
   }
 
+  // Note: We can't use broker()->length_string() here, because it could
+  // conflict with redefinitions of the TypedArray length property.
+  RETURN_IF_DONE(TryFindLoadedProperty(
+      known_node_aspects().loaded_constant_properties, object,
+      KnownNodeAspects::LoadedPropertyMapKey::TypedArrayLength()));
+
   ValueNode* result = AddNewNode<LoadTypedArrayLength>({object}, elements_kind);
-  if (!is_variable_length) {
-    RecordKnownProperty(
-        object, KnownNodeAspects::LoadedPropertyMapKey::TypedArrayLength(),
-        result, true, compiler::AccessMode::kLoad);
-  }
+  RecordKnownProperty(
+      object, KnownNodeAspects::LoadedPropertyMapKey::TypedArrayLength(),
+      result, true, compiler::AccessMode::kLoad);
   return result;
 }
 
@@ -5540,7 +5555,11 @@ ReduceResult MaglevGraphBuilder::TryBuildElementAccessOnTypedArray(
     compiler::KeyedAccessMode const& keyed_mode) {
   DCHECK(HasOnlyJSTypedArrayMaps(
       base::VectorOf(access_info.lookup_start_object_maps())));
-  ElementsKind elements_kind = access_info.elements_kind();
+  // RAB/GSAB backed typed arrays only differ in how their length is computed,
+  // their elements are accessed like the ones of other typed arrays.
+  ElementsKind length_kind = access_info.elements_kind();
+  ElementsKind elements_kind =
+      GetCorrespondingNonRabGsabElementsKind(length_kind);
   if (elements_kind == FLOAT16_ELEMENTS ||
       elements_kind == BIGUINT64_ELEMENTS ||
       elements_kind == BIGINT64_ELEMENTS) {
@@ -5571,7 +5590,7 @@ ReduceResult MaglevGraphBuilder::TryBuildElementAccessOnTypedArray(
   ValueNode* index;
   ValueNode* length;
   GET_VALUE_OR_ABORT(index, GetUint32ElementIndex(index_object));
-  GET_VALUE_OR_ABORT(length, BuildLoadTypedArrayLength(object, elements_kind));
+  GET_VALUE_OR_ABORT(length, BuildLoadTypedArrayLength(object, length_kind));
   AddNewNode<CheckTypedArrayBounds>({index, length});
   switch (keyed_mode.access_mode()) {
     case compiler::AccessMode::kLoad:
@@ -5886,11 +5905,6 @@ ReduceResult MaglevGraphBuilder::TryBuildElementAccess(
   // Check for monomorphic case.
   if (access_infos.size() == 1) {
     compiler::ElementAccessInfo const& access_info = access_infos.front();
-    // TODO(victorgomes): Support RAB/GSAB backed typed arrays.
-    if (IsRabGsabTypedArrayElementsKind(access_info.elements_kind())) {
-      return ReduceResult::Fail();
-    }
-
     if (!access_info.transition_sources().empty()) {
       compiler::MapRef transition_target =
           access_info.lookup_start_object_maps().front();
@@ -5902,7 +5916,8 @@ ReduceResult MaglevGraphBuilder::TryBuildElementAccess(
       RETURN_IF_ABORT(BuildCheckMaps(
           object, base::VectorOf(access_info.lookup_start_object_maps())));
     }
-    if (IsTypedArrayElementsKind(access_info.elements_kind())) {
+    if (IsTypedArrayOrRabGsabTypedArrayElementsKind(
+            access_info.elements_kind())) {
       return TryBuildElementAccessOnTypedArray(object, index_object,
                                                access_info, keyed_mode);
     }
@@ -5973,10 +5988,8 @@ ReduceResult MaglevGraphBuilder::TryBuildPolymorphicElementAccess(
       continue;
     }
     ReduceResult result;
-    // TODO(victorgomes): Support RAB/GSAB backed typed arrays.
-    if (IsRabGsabTypedArrayElementsKind(access_info.elements_kind())) {
-      result = ReduceResult::Fail();
-    } else if (IsTypedArrayElementsKind(access_info.elements_kind())) {
+    if (IsTypedArrayOrRabGsabTypedArrayElementsKind(
+            access_info.elements_kind())) {
       result = TryBuildElementAccessOnTypedArray(object, index_object,
                                                  access_info, keyed_mode);
     } else {
@@ -6413,6 +6426,13 @@ ValueNode* MaglevGraphBuilder::GetTrustedConstant(compiler::HeapObjectRef ref,
 #endif
 }
 
+void MaglevGraphBuilder::VisitStarGetNamedProperty() {
+  // StarGetNamedProperty <object> <name_index> <slot>
+  MoveNodeBetweenRegisters(interpreter::Register::virtual_accumulator(),
+                           iterator_.GetRegisterOperand(0));
+  VisitGetNamedProperty();
+}
+
 void MaglevGraphBuilder::VisitGetNamedPropertyFromSuper() {
   // GetNamedPropertyFromSuper <receiver> <name_index> <slot>
   ValueNode* receiver = LoadRegister(0);
@@ -6778,17 +6798,50 @@ void MaglevGraphBuilder::VisitDefineKeyedOwnProperty() {
   // DefineKeyedOwnProperty <object> <key> <flags> <slot>
   ValueNode* object = LoadRegister(0);
   ValueNode* key = LoadRegister(1);
-  ValueNode* flags = GetSmiConstant(GetFlag8Operand(2));
+  int flags = GetFlag8Operand(2);
   FeedbackSlot slot = GetSlotOperand(3);
   compiler::FeedbackSource feedback_source{feedback(), slot};
 
-  // TODO(victorgomes): Add monomorphic fast path.
+  auto build_generic_access = [this, object, key, flags, &feedback_source]() {
+    ValueNode* context = GetContext();
+    ValueNode* value = GetAccumulator();
+    AddNewNode<DefineKeyedOwnGeneric>(
+        {context, object, key, value, GetSmiConstant(flags)}, feedback_source);
+    return ReduceResult::Done();
+  };
+
+  // Private fields and brands are defined with a constant private symbol as
+  // the key, so the feedback is usually monomorphic on the name. Define them
+  // like named properties, so that instance field initialization becomes a
+  // map check and a transitioning store. SetFunctionName has to go through
+  // the IC though.
+  if (flags == static_cast<int>(DefineKeyedOwnPropertyFlag::kNoFlags)) {
+    const compiler::ProcessedFeedback& processed_feedback =
+        broker()->GetFeedbackForPropertyAccess(
+            feedback_source, compiler::AccessMode::kDefine, std::nullopt);
+
+    switch (processed_feedback.kind()) {
+      case compiler::ProcessedFeedback::kInsufficient:
+        RETURN_VOID_ON_ABORT(EmitUnconditionalDeopt(
+            DeoptimizeReason::kInsufficientTypeFeedbackForGenericKeyedAccess));
+
+      case compiler::ProcessedFeedback::kNamedAccess: {
+        compiler::NameRef name = processed_feedback.AsNamedAccess().name();
+        RETURN_VOID_IF_ABORT(BuildCheckValue(key, name));
+        RETURN_VOID_IF_DONE(TryBuildNamedAccess(
+            object, object, processed_feedback.AsNamedAccess(),
+            feedback_source, compiler::AccessMode::kDefine,
+            build_generic_access));
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
 
   // Create a generic store in the fallthrough.
-  ValueNode* context = GetContext();
-  ValueNode* value = GetAccumulator();
-  AddNewNode<DefineKeyedOwnGeneric>({context, object, key, value, flags},
-                                    feedback_source);
+  RETURN_VOID_IF_ABORT(build_generic_access());
 }
 
 void MaglevGraphBuilder::VisitStaInArrayLiteral() {
@@ -8766,6 +8819,21 @@ ReduceResult MaglevGraphBuilder::TryReduceObjectGetPrototypeOf(
   return TryReduceGetProto(args[0]);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceReflectGet(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (args.count() != 2 && args.count() != 3) {
+    return ReduceResult::Fail();
+  }
+  // Reflect.get throws if the target is not a receiver, which we don't expect
+  // in optimized code.
+  ValueNode* object = GetTaggedValue(args[0]);
+  BuildCheckJSReceiver(object);
+  ValueNode* receiver = args.count() == 3 ? GetTaggedValue(args[2]) : object;
+  return BuildCallBuiltin<Builtin::kGetPropertyWithReceiver>(
+      {object, GetTaggedValue(args[1]), receiver,
+       GetSmiConstant(static_cast<int>(OnNonExistent::kReturnUndefined))});
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceReflectGetPrototypeOf(
     compiler::JSFunctionRef target, CallArguments& args) {
   return TryReduceObjectGetPrototypeOf(target, args);
@@ -9482,6 +9550,46 @@ ReduceResult MaglevGraphBuilder::ReduceCallForTarget(
   return ReduceCallForConstant(target, args, feedback_source);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceCallForBoundFunction(
+    ValueNode* target_node, compiler::JSBoundFunctionRef target,
+    CallArguments& args, const compiler::FeedbackSource& feedback_source) {
+  // TODO(victorgomes): Support spread and array-like calls by prepending the
+  // bound arguments to the spread.
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+
+  compiler::FixedArrayRef bound_arguments = target.bound_arguments(broker());
+  int const bound_arguments_length = bound_arguments.length();
+  base::SmallVector<ValueNode*, 8> new_args_nodes;
+  compiler::ObjectRef bound_this = target.bound_this(broker());
+  ConvertReceiverMode receiver_mode;
+  if (bound_this.IsUndefined()) {
+    receiver_mode = ConvertReceiverMode::kNullOrUndefined;
+  } else {
+    // A null receiver has to be passed explicitly, since strict mode callees
+    // observe it.
+    receiver_mode = bound_this.IsNull()
+                        ? ConvertReceiverMode::kAny
+                        : ConvertReceiverMode::kNotNullOrUndefined;
+    new_args_nodes.push_back(GetConstant(bound_this));
+  }
+  for (int i = 0; i < bound_arguments_length; ++i) {
+    compiler::OptionalObjectRef maybe_arg = bound_arguments.TryGet(broker(), i);
+    if (!maybe_arg.has_value()) return ReduceResult::Fail();
+    new_args_nodes.push_back(GetConstant(maybe_arg.value()));
+  }
+  for (size_t i = 0; i < args.count(); ++i) {
+    new_args_nodes.push_back(args[i]);
+  }
+
+  RETURN_IF_ABORT(BuildCheckValue(target_node, target));
+  // Calling the bound target function directly skips the CallBoundFunction
+  // trampoline. Chains of bound functions are flattened by reducing the call
+  // again, which also lets us inline the final target.
+  CallArguments new_args(receiver_mode, std::move(new_args_nodes));
+  return ReduceCall(GetConstant(target.bound_target_function(broker())),
+                    new_args, feedback_source);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallForNewClosure(
     ValueNode* target_node, ValueNode* target_context,
     compiler::SharedFunctionInfoRef shared,
@@ -9719,6 +9827,154 @@ ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLike(
   return BuildGenericCall(target_node, Call::TargetType::kAny, args);
 }
 
+namespace {
+
+// A possible target of a polymorphic call. Known functions are dispatched on
+// by identity; closures are dispatched on by their SharedFunctionInfo, which
+// covers all closures that were created from the same function literal.
+struct PolymorphicCallTarget {
+  compiler::OptionalJSFunctionRef function;
+  compiler::SharedFunctionInfoRef shared;
+  compiler::OptionalFeedbackVectorRef feedback_vector;
+};
+
+}  // namespace
+
+ReduceResult MaglevGraphBuilder::TryBuildPolymorphicCall(
+    Phi* target_node, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source) {
+  if (!v8_flags.maglev_polymorphic_inlining || !v8_flags.maglev_inlining ||
+      args.mode() != CallArguments::kDefault || target_node->is_loop_phi() ||
+      target_node->is_exception_phi()) {
+    return ReduceResult::Fail();
+  }
+
+  // The inputs of a (non-loop) phi are the only values that it can have, so
+  // they are all the possible targets of the call.
+  base::SmallVector<PolymorphicCallTarget, 4> targets;
+  int inlined_bytecode_size = 0;
+  for (int i = 0; i < target_node->input_count(); i++) {
+    ValueNode* input = target_node->input(i).node();
+    std::optional<PolymorphicCallTarget> target;
+    if (compiler::OptionalHeapObjectRef constant = TryGetConstant(input)) {
+      if (!constant->IsJSFunction()) return ReduceResult::Fail();
+      compiler::JSFunctionRef function = constant->AsJSFunction();
+      target = PolymorphicCallTarget{function, function.shared(broker()),
+                                     function.feedback_vector(broker())};
+    } else if (FastCreateClosure* closure =
+                   input->TryCast<FastCreateClosure>()) {
+      target = PolymorphicCallTarget{
+          {},
+          closure->shared_function_info(),
+          closure->feedback_cell().feedback_vector(broker())};
+    } else if (CreateClosure* closure = input->TryCast<CreateClosure>()) {
+      target = PolymorphicCallTarget{
+          {},
+          closure->shared_function_info(),
+          closure->feedback_cell().feedback_vector(broker())};
+    } else {
+      return ReduceResult::Fail();
+    }
+
+    bool is_duplicate = std::any_of(
+        targets.begin(), targets.end(),
+        [&](const PolymorphicCallTarget& other) {
+          if (target->function.has_value() != other.function.has_value()) {
+            return false;
+          }
+          return target->function.has_value()
+                     ? target->function->equals(*other.function)
+                     : target->shared.equals(other.shared);
+        });
+    if (is_duplicate) continue;
+
+    if (static_cast<int>(targets.size()) >=
+        v8_flags.max_maglev_polymorphic_inlining_targets) {
+      TRACE_INLINING("  cannot inline polymorphic call: more than "
+                     << v8_flags.max_maglev_polymorphic_inlining_targets
+                     << " targets");
+      return ReduceResult::Fail();
+    }
+    compiler::SharedFunctionInfoRef shared = target->shared;
+    if (!target->feedback_vector.has_value() ||
+        shared.GetInlineability(broker()) !=
+            SharedFunctionInfo::Inlineability::kIsInlineable) {
+      TRACE_CANNOT_INLINE("polymorphic call target is not inlineable");
+      return ReduceResult::Fail();
+    }
+    inlined_bytecode_size += shared.GetBytecodeArray(broker()).length();
+    targets.push_back(*target);
+  }
+  DCHECK(!targets.empty());
+
+  // All targets are inlined into the same call site, so they share the budget
+  // of a single inlined function.
+  if (inlined_bytecode_size > v8_flags.max_maglev_inlined_bytecode_size) {
+    TRACE_INLINING("  cannot inline polymorphic call: size ("
+                   << inlined_bytecode_size << ") >= max-size ("
+                   << v8_flags.max_maglev_inlined_bytecode_size << ")");
+    return ReduceResult::Fail();
+  }
+  TRACE_INLINING("  polymorphic call with " << targets.size() << " targets");
+
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable ret_val(0);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, static_cast<int>(targets.size()), {&ret_val});
+  ValueNode* shared_node = nullptr;
+  for (size_t i = 0; i < targets.size(); i++) {
+    const PolymorphicCallTarget& target = targets[i];
+    ValueNode* dispatch_value = target_node;
+    compiler::HeapObjectRef expected = target.shared;
+    if (target.function.has_value()) {
+      expected = *target.function;
+    } else {
+      if (shared_node == nullptr) {
+        shared_node = BuildLoadTaggedField(
+            target_node, JSFunction::kSharedFunctionInfoOffset);
+      }
+      dispatch_value = shared_node;
+    }
+
+    // Like for polymorphic property accesses, the last target is checked with
+    // a deopting check rather than a branch, so that no generic call has to be
+    // emitted as a fallback.
+    std::optional<MaglevSubGraphBuilder::Label> next_target;
+    if (i == targets.size() - 1) {
+      if (BuildCheckValue(dispatch_value, expected).IsDoneWithAbort()) {
+        break;
+      }
+    } else {
+      next_target.emplace(&sub_graph, 1);
+      sub_graph.GotoIfFalse<BranchIfReferenceEqual>(
+          &*next_target, {dispatch_value, GetConstant(expected)});
+    }
+
+    ReduceResult result;
+    if (target.function.has_value()) {
+      result = ReduceCallForConstant(*target.function, args, feedback_source);
+    } else {
+      ValueNode* context =
+          BuildLoadTaggedField(target_node, JSFunction::kContextOffset);
+      result = ReduceCallForNewClosure(target_node, context, target.shared,
+                                       target.feedback_vector, args,
+                                       feedback_source);
+    }
+    DCHECK(result.IsDone());
+    if (result.IsDoneWithValue()) {
+      sub_graph.set(ret_val, result.value());
+      sub_graph.Goto(&done);
+    }
+
+    if (next_target.has_value()) {
+      sub_graph.Bind(&*next_target);
+    }
+  }
+
+  RETURN_IF_ABORT(sub_graph.TrimPredecessorsAndBind(&done));
+  return sub_graph.get(ret_val);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCall(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source) {
@@ -9728,6 +9984,11 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
       ReduceResult result = ReduceCallForTarget(
           target_node, maybe_constant->AsJSFunction(), args, feedback_source);
       RETURN_IF_DONE(result);
+    } else if (maybe_constant->IsJSBoundFunction()) {
+      ReduceResult result = TryReduceCallForBoundFunction(
+          target_node, maybe_constant->AsJSBoundFunction(), args,
+          feedback_source);
+      RETURN_IF_DONE(result);
     }
   }
 
@@ -9750,6 +10011,8 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
         create_closure->feedback_cell().feedback_vector(broker()), args,
         feedback_source);
     RETURN_IF_DONE(result);
+  } else if (Phi* phi = target_node->TryCast<Phi>()) {
+    RETURN_IF_DONE(TryBuildPolymorphicCall(phi, args, feedback_source));
   }
 
   // On fallthrough, create a generic call.
@@ -13436,8 +13699,21 @@ void MaglevGraphBuilder::VisitDebugger() {
 }
 
 void MaglevGraphBuilder::VisitIncBlockCounter() {
+  int slot_index = iterator_.GetIndexOperand(0);
+  if (v8_flags.inline_block_coverage_counters) {
+    // Bump the counter in place rather than calling the builtin, which looks
+    // up the coverage info in C++ on every execution.
+    if (compiler::OptionalHeapObjectRef coverage_info =
+            compilation_unit_->shared_function_info().coverage_info(broker())) {
+      AddNewNode<IncrementBlockCount>(
+          {GetConstant(*coverage_info)}, slot_index,
+          v8_flags.block_coverage_first_execution_only);
+      return;
+    }
+  }
+
   ValueNode* closure = GetClosure();
-  ValueNode* coverage_array_slot = GetSmiConstant(iterator_.GetIndexOperand(0));
+  ValueNode* coverage_array_slot = GetSmiConstant(slot_index);
   BuildCallBuiltin<Builtin::kIncBlockCounter>(
       {GetTaggedValue(closure), coverage_array_slot});
 }
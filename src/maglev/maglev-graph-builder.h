@@ -255,6 +255,7 @@ class MaglevGraphBuilder {
                                         ValueNode* new_target = nullptr);
   void BuildMergeStates();
   BasicBlock* EndPrologue();
+  void BuildBreakpointEntryCheck();
   void PeelLoop();
   void BuildLoopForPeeling();
 
@@ -478,7 +479,11 @@ class MaglevGraphBuilder {
   bool ShouldEmitOsrInterruptBudgetChecks() {
     if (!v8_flags.turbofan || !v8_flags.use_osr || !v8_flags.osr_from_maglev)
       return false;
-    if (!graph_->is_osr() && !v8_flags.always_osr_from_maglev) return false;
+    if (!graph_->is_osr() && !v8_flags.always_osr_from_maglev &&
+        !(v8_flags.osr_from_maglev_hot_loops &&
+          compilation_unit_->info()->toplevel_had_long_running_loops())) {
+      return false;
+    }
     // TODO(olivf) OSR from maglev requires lazy recompilation (see
     // CompileOptimizedOSRFromMaglev for details). Without this we end up in
     // deopt loops, e.g., in chromium content_unittests.
@@ -848,6 +853,11 @@ class MaglevGraphBuilder {
     new_nodes_.clear();
 #endif
 
+    if (V8_UNLIKELY(v8_flags.breakpoint_entry_checks) &&
+        !breakpoint_entry_check_built_) {
+      BuildBreakpointEntryCheck();
+    }
+
     if (iterator_.current_bytecode() == interpreter::Bytecode::kJumpLoop &&
         iterator_.GetJumpTargetOffset() < entrypoint_) {
       static_assert(kLoopsMustBeEnteredThroughHeader);
@@ -1921,6 +1931,7 @@ class MaglevGraphBuilder {
   V(FunctionPrototypeHasInstance)              \
   V(ObjectPrototypeGetProto)                   \
   V(ObjectGetPrototypeOf)                      \
+  V(ReflectGet)                                \
   V(ReflectGetPrototypeOf)                     \
   V(ObjectPrototypeHasOwnProperty)             \
   V(NumberParseInt)                            \
@@ -1999,11 +2010,17 @@ class MaglevGraphBuilder {
   ReduceResult ReduceCallForTarget(
       ValueNode* target_node, compiler::JSFunctionRef target,
       CallArguments& args, const compiler::FeedbackSource& feedback_source);
+  ReduceResult TryReduceCallForBoundFunction(
+      ValueNode* target_node, compiler::JSBoundFunctionRef target,
+      CallArguments& args, const compiler::FeedbackSource& feedback_source);
   ReduceResult ReduceCallForNewClosure(
       ValueNode* target_node, ValueNode* target_context,
       compiler::SharedFunctionInfoRef shared,
       compiler::OptionalFeedbackVectorRef feedback_vector, CallArguments& args,
       const compiler::FeedbackSource& feedback_source);
+  ReduceResult TryBuildPolymorphicCall(
+      Phi* target_node, CallArguments& args,
+      const compiler::FeedbackSource& feedback_source);
   ReduceResult TryBuildCallKnownApiFunction(
       compiler::JSFunctionRef function, compiler::SharedFunctionInfoRef shared,
       CallArguments& args);
@@ -2914,6 +2931,7 @@ class MaglevGraphBuilder {
 
   // Current block information.
   bool in_prologue_ = true;
+  bool breakpoint_entry_check_built_ = false;
   BasicBlock* current_block_ = nullptr;
   std::optional<InterpretedDeoptFrame> entry_stack_check_frame_;
   std::optional<DeoptFrame> latest_checkpointed_frame_;
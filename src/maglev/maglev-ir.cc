@@ -23,6 +23,7 @@
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/interpreter/bytecode-flags-and-tokens.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/js-array.h"
@@ -4564,6 +4565,37 @@ void StoreFloat64::GenerateCode(MaglevAssembler* masm,
   __ StoreFloat64(FieldMemOperand(object, offset()), value);
 }
 
+void CheckBreakpointEntry::GenerateCode(MaglevAssembler* masm,
+                                        const ProcessingState& state) {
+  MaglevAssembler::TemporaryRegisterScope temps(masm);
+  Register scratch = temps.AcquireScratch();
+  __ Move(scratch, ExternalReference::FromRawAddress(check_address()));
+  __ LoadByte(scratch, MemOperand(scratch, 0));
+  __ CompareInt32AndJumpIf(
+      scratch, 0, kNotEqual,
+      __ GetDeoptLabel(this, DeoptimizeReason::kBreakpointSet));
+}
+
+void IncrementBlockCount::SetValueLocationConstraints() {
+  UseRegister(coverage_info_input());
+  if (!first_execution_only()) set_temporaries_needed(1);
+}
+void IncrementBlockCount::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  Register coverage_info = ToRegister(coverage_info_input());
+  int offset = CoverageInfo::BlockCountOffset(slot_index());
+  if (first_execution_only()) {
+    __ StoreInt32Field(coverage_info, offset, 1);
+    return;
+  }
+  MaglevAssembler::TemporaryRegisterScope temps(masm);
+  Register count = temps.Acquire();
+  __ LoadSignedField(count, FieldMemOperand(coverage_info, offset),
+                     kInt32Size);
+  __ IncrementInt32(count);
+  __ StoreField(FieldMemOperand(coverage_info, offset), count, kInt32Size);
+}
+
 void StoreTaggedFieldNoWriteBarrier::SetValueLocationConstraints() {
   UseRegister(object_input());
   UseRegister(value_input());
@@ -6231,6 +6263,36 @@ void SetContinuationPreservedEmbedderData::GenerateCode(
   __ Move(reference, data);
 }
 
+void LoadRabGsabTypedArrayLength::SetValueLocationConstraints() {
+  UseRegister(receiver_input());
+  DefineAsRegister(this);
+}
+void LoadRabGsabTypedArrayLength::GenerateCode(MaglevAssembler* masm,
+                                              const ProcessingState& state) {
+  Register object = ToRegister(receiver_input());
+  Register result_reg = ToRegister(result());
+  __ AssertNotSmi(object);
+  if (v8_flags.debug_code) {
+    __ AssertObjectType(object, JS_TYPED_ARRAY_TYPE,
+                        AbortReason::kUnexpectedValue);
+  }
+  // The length depends on whether the array is length-tracking, whether it's
+  // backed by a RAB or a GSAB, and, for GSABs, on the backing store, so leave
+  // it to C++.
+  RegisterSnapshot snapshot = register_snapshot();
+  snapshot.live_registers.clear(result_reg);
+  DCHECK(!snapshot.live_tagged_registers.has(result_reg));
+  {
+    SaveRegisterStateForCall save_register_state(masm, snapshot);
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ PrepareCallCFunction(1);
+    __ Move(kCArgRegs[0], object);
+    __ CallCFunction(ExternalReference::rab_gsab_typed_array_length(), 1);
+    // No need for safepoint since this is a fast C call.
+    __ Move(result_reg, kReturnRegister0);
+  }
+}
+
 namespace {
 
 template <typename ResultReg, typename NodeT>
@@ -7118,6 +7180,18 @@ void StoreFloat64::PrintParams(std::ostream& os,
   os << "(0x" << std::hex << offset() << std::dec << ")";
 }
 
+void CheckBreakpointEntry::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << reinterpret_cast<void*>(check_address()) << ")";
+}
+
+void IncrementBlockCount::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << slot_index();
+  if (first_execution_only()) os << ", first execution only";
+  os << ")";
+}
+
 void StoreTaggedFieldNoWriteBarrier::PrintParams(
     std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
   os << "(0x" << std::hex << offset() << std::dec << ")";
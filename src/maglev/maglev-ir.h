@@ -203,6 +203,7 @@ class ExceptionHandlerInfo;
   V(LoadSignedIntDataViewElement)                   \
   V(LoadDoubleDataViewElement)                      \
   V(LoadTypedArrayLength)                           \
+  V(LoadRabGsabTypedArrayLength)                    \
   V(LoadSignedIntTypedArrayElement)                 \
   V(LoadUnsignedIntTypedArrayElement)               \
   V(LoadDoubleTypedArrayElement)                    \
@@ -318,11 +319,13 @@ class ExceptionHandlerInfo;
   V(CheckValueEqualsInt32)                    \
   V(CheckValueEqualsFloat64)                  \
   V(CheckValueEqualsString)                   \
+  V(CheckBreakpointEntry)                     \
   V(CheckInstanceType)                        \
   V(Dead)                                     \
   V(DebugBreak)                               \
   V(FunctionEntryStackCheck)                  \
   V(GeneratorStore)                           \
+  V(IncrementBlockCount)                      \
   V(TryOnStackReplacement)                    \
   V(StoreMap)                                 \
   V(StoreDoubleField)                         \
@@ -5898,6 +5901,27 @@ class CheckFloat64IsNan : public FixedInputNodeT<1, CheckFloat64IsNan> {
   void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
 };
 
+// Deoptimizes if the function that is being entered was prepared for
+// debugging, see Debug::BreakpointEntryCheckAddress.
+class CheckBreakpointEntry : public FixedInputNodeT<0, CheckBreakpointEntry> {
+  using Base = FixedInputNodeT<0, CheckBreakpointEntry>;
+
+ public:
+  explicit CheckBreakpointEntry(uint64_t bitfield, Address check_address)
+      : Base(bitfield), check_address_(check_address) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  Address check_address() const { return check_address_; }
+
+  void SetValueLocationConstraints() {}
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const Address check_address_;
+};
+
 class CheckValueEqualsString
     : public FixedInputNodeT<1, CheckValueEqualsString> {
   using Base = FixedInputNodeT<1, CheckValueEqualsString>;
@@ -6287,6 +6311,39 @@ class LoadTypedArrayLength
   ElementsKind elements_kind_;
 };
 
+// Loads the length of a typed array with a RAB/GSAB elements kind, i.e. a
+// length-tracking or RAB backed typed array. Unlike LoadTypedArrayLength, the
+// result isn't constant and is 0 when the array is out of bounds or detached.
+class LoadRabGsabTypedArrayLength
+    : public FixedInputValueNodeT<1, LoadRabGsabTypedArrayLength> {
+  using Base = FixedInputValueNodeT<1, LoadRabGsabTypedArrayLength>;
+
+ public:
+  explicit LoadRabGsabTypedArrayLength(uint64_t bitfield,
+                                       ElementsKind elements_kind)
+      : Base(bitfield), elements_kind_(elements_kind) {}
+  static constexpr OpProperties kProperties = OpProperties::IntPtr() |
+                                              OpProperties::CanRead() |
+                                              OpProperties::DeferredCall();
+  static constexpr
+      typename Base::InputTypes kInputTypes{ValueRepresentation::kTagged};
+
+  static constexpr int kReceiverIndex = 0;
+  Input& receiver_input() { return input(kReceiverIndex); }
+
+  int MaxCallStackArgs() const;
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const {}
+
+  auto options() const { return std::tuple{elements_kind_}; }
+
+  ElementsKind elements_kind() const { return elements_kind_; }
+
+ private:
+  ElementsKind elements_kind_;
+};
+
 class CheckTypedArrayNotDetached
     : public FixedInputNodeT<1, CheckTypedArrayNotDetached> {
   using Base = FixedInputNodeT<1, CheckTypedArrayNotDetached>;
@@ -7499,6 +7556,38 @@ class StoreDoubleField : public FixedInputNodeT<2, StoreDoubleField> {
   const int offset_;
 };
 
+// Records the execution of a coverage block directly in the function's
+// CoverageInfo, as the IncBlockCounter builtin does.
+class IncrementBlockCount : public FixedInputNodeT<1, IncrementBlockCount> {
+  using Base = FixedInputNodeT<1, IncrementBlockCount>;
+
+ public:
+  explicit IncrementBlockCount(uint64_t bitfield, int slot_index,
+                               bool first_execution_only)
+      : Base(bitfield),
+        slot_index_(slot_index),
+        first_execution_only_(first_execution_only) {}
+
+  static constexpr OpProperties kProperties = OpProperties::CanWrite();
+  static constexpr typename Base::InputTypes kInputTypes{
+      ValueRepresentation::kTagged};
+
+  int slot_index() const { return slot_index_; }
+  // If set, the block count is set to 1 rather than incremented.
+  bool first_execution_only() const { return first_execution_only_; }
+
+  static constexpr int kCoverageInfoIndex = 0;
+  Input& coverage_info_input() { return input(kCoverageInfoIndex); }
+
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const int slot_index_;
+  const bool first_execution_only_;
+};
+
 class StoreFloat64 : public FixedInputNodeT<2, StoreFloat64> {
   using Base = FixedInputNodeT<2, StoreFloat64>;
 
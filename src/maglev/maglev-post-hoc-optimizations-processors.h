@@ -123,26 +123,38 @@ class LoopOptimizationProcessor {
   }
 
   ProcessResult Process(CheckMaps* maps, const ProcessingState& state) {
+    return ProcessCheck(maps, maps->receiver_input().node());
+  }
+
+  ProcessResult Process(CheckHeapObject* check, const ProcessingState& state) {
+    // Typically precedes the map check of the same object, which could not be
+    // hoisted otherwise.
+    return ProcessCheck(check, check->receiver_input().node());
+  }
+
+  template <typename NodeT>
+  ProcessResult ProcessCheck(NodeT* check, ValueNode* object) {
     DCHECK(loop_effects);
-    // Conservatively not hoist map checks if we ever deoptimized this function
-    // to avoid deopt loops.
-    if (was_deoptimized) return ProcessResult::kContinue;
-    ValueNode* object = maps->receiver_input().node();
     if (IsLoopPhi(object)) {
       return ProcessResult::kContinue;
     }
-    if (!loop_effects->unstable_aspects_cleared && CanHoist(maps)) {
+    // Conservatively not hoist checks if we ever deoptimized this function
+    // to avoid deopt loops.
+    if (!was_deoptimized && !loop_effects->unstable_aspects_cleared &&
+        CanHoist(check)) {
       if (auto j = current_block->predecessor_at(0)
                        ->control_node()
                        ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
-                                maps->eager_deopt_info()->feedback_to_update());
-      } else {
-        return ProcessResult::kContinue;
+        check->SetEagerDeoptInfo(
+            zone, j->eager_deopt_info()->top_frame(),
+            check->eager_deopt_info()->feedback_to_update());
+        return ProcessResult::kHoist;
       }
-      return ProcessResult::kHoist;
     }
-    return ProcessResult::kContinue;
+    // The loads of {object} that follow the check depend on it, so they must
+    // not be hoisted either.
+    loop_effects = nullptr;
+    return ProcessResult::kSkipBlock;
   }
 
   template <typename NodeT>
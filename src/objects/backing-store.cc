@@ -4,7 +4,9 @@
 
 #include "src/objects/backing-store.h"
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <optional>
 
 #include "src/base/bits.h"
@@ -216,9 +218,69 @@ BackingStore::~BackingStore() {
   auto allocator = get_v8_api_array_buffer_allocator();
   TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
            buffer_start_, byte_length(), byte_capacity_);
+  if (BatchedFreeScope* batched_free_scope = BatchedFreeScope::current()) {
+    batched_free_scope->Add(
+        allocator,
+        holds_shared_ptr_to_allocator_
+            ? type_specific_data_.v8_api_array_buffer_allocator_shared
+            : nullptr,
+        buffer_start_, byte_length_);
+    return;
+  }
   allocator->Free(buffer_start_, byte_length_);
 }
 
+namespace {
+thread_local BackingStore::BatchedFreeScope* current_batched_free_scope =
+    nullptr;
+}  // namespace
+
+BackingStore::BatchedFreeScope::BatchedFreeScope()
+    : previous_(current_batched_free_scope) {
+  current_batched_free_scope = this;
+}
+
+BackingStore::BatchedFreeScope::~BatchedFreeScope() {
+  DCHECK_EQ(this, current_batched_free_scope);
+  Flush();
+  current_batched_free_scope = previous_;
+}
+
+// static
+BackingStore::BatchedFreeScope* BackingStore::BatchedFreeScope::current() {
+  return current_batched_free_scope;
+}
+
+void BackingStore::BatchedFreeScope::Add(
+    v8::ArrayBuffer::Allocator* allocator,
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_owner, void* data,
+    size_t length) {
+  pending_.push_back({allocator, std::move(allocator_owner), data, length});
+  if (pending_.size() >= kMaxPendingFrees) Flush();
+}
+
+void BackingStore::BatchedFreeScope::Flush() {
+  if (pending_.empty()) return;
+  // Group the requests by allocator. Usually all of them belong to the same
+  // allocator.
+  std::stable_sort(pending_.begin(), pending_.end(),
+                   [](const PendingFree& a, const PendingFree& b) {
+                     return std::less<v8::ArrayBuffer::Allocator*>()(
+                         a.allocator, b.allocator);
+                   });
+  std::vector<v8::ArrayBuffer::Allocator::FreeRequest> requests;
+  requests.reserve(pending_.size());
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    requests.push_back({pending_[i].data, pending_[i].length});
+    if (i + 1 == pending_.size() ||
+        pending_[i + 1].allocator != pending_[i].allocator) {
+      pending_[i].allocator->FreeBatch({requests.data(), requests.size()});
+      requests.clear();
+    }
+  }
+  pending_.clear();
+}
+
 // Allocate a backing store using the array buffer allocator from the embedder.
 std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
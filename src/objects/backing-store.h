@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "include/v8-array-buffer.h"
 #include "include/v8-internal.h"
@@ -42,6 +43,44 @@ struct SharedWasmMemoryData;
 // and the destructor frees the memory (and page allocation if necessary).
 class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
  public:
+  // Within the scope, the memory of backing stores that are destroyed on the
+  // current thread and were allocated through the embedder's
+  // v8::ArrayBuffer::Allocator is not freed right away. Instead, it is released
+  // with one v8::ArrayBuffer::Allocator::FreeBatch() call per allocator when
+  // the scope is left or enough blocks are pending.
+  class V8_EXPORT_PRIVATE V8_NODISCARD BatchedFreeScope final {
+   public:
+    BatchedFreeScope();
+    ~BatchedFreeScope();
+
+    BatchedFreeScope(const BatchedFreeScope&) = delete;
+    BatchedFreeScope& operator=(const BatchedFreeScope&) = delete;
+
+   private:
+    static constexpr size_t kMaxPendingFrees = 1024;
+
+    struct PendingFree {
+      v8::ArrayBuffer::Allocator* allocator;
+      // Keeps the allocator alive in case the backing store held the last
+      // reference to it.
+      std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_owner;
+      void* data;
+      size_t length;
+    };
+
+    static BatchedFreeScope* current();
+
+    void Add(v8::ArrayBuffer::Allocator* allocator,
+             std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_owner,
+             void* data, size_t length);
+    void Flush();
+
+    BatchedFreeScope* const previous_;
+    std::vector<PendingFree> pending_;
+
+    friend class BackingStore;
+  };
+
   ~BackingStore();
 
   // Allocate an array buffer backing store using the default method,
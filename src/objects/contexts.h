@@ -187,6 +187,8 @@ enum ContextLookupFlags {
   V(ITERATOR_DROP_HELPER_MAP_INDEX, Map, iterator_drop_helper_map)             \
   V(ITERATOR_FLAT_MAP_HELPER_MAP_INDEX, Map, iterator_flatMap_helper_map)      \
   V(ITERATOR_FUNCTION_INDEX, JSFunction, iterator_function)                    \
+  V(ITERATOR_HELPER_PROTOTYPE_NEXT_INDEX, JSFunction,                          \
+    iterator_helper_prototype_next)                                            \
   V(VALID_ITERATOR_WRAPPER_MAP_INDEX, Map, valid_iterator_wrapper_map)         \
   V(ITERATOR_RESULT_MAP_INDEX, Map, iterator_result_map)                       \
   V(JS_ARRAY_PACKED_SMI_ELEMENTS_MAP_INDEX, Map,                               \
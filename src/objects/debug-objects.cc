@@ -49,6 +49,7 @@ void DebugInfo::ClearBreakInfo(Isolate* isolate) {
     }
 
     SharedFunctionInfo::UninstallDebugBytecode(shared(), isolate);
+    isolate->debug()->SetBreakpointEntryCheck(shared(), false);
   }
   set_break_points(ReadOnlyRoots(isolate).empty_fixed_array());
 
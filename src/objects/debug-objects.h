@@ -188,6 +188,12 @@ class CoverageInfo
     return OBJECT_POINTER_ALIGN(kHeaderSize + slot_count * Slot::kSize);
   }
 
+  // Computes the offset of the block counter of the given slot. Optimized
+  // code increments block counters directly at this offset.
+  static constexpr int BlockCountOffset(int slot_index) {
+    return kHeaderSize + slot_index * Slot::kSize + Slot::kBlockCountOffset;
+  }
+
   // Print debug info.
   void CoverageInfoPrint(std::ostream& os,
                          std::unique_ptr<char[]> function_name = nullptr);
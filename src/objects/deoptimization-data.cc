@@ -6,7 +6,9 @@
 
 #include <iomanip>
 
+#include "src/base/vlq.h"
 #include "src/deoptimizer/translated-state.h"
+#include "src/deoptimizer/translation-opcode.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/casting.h"
 #include "src/objects/code.h"
@@ -381,6 +383,31 @@ void DeoptTranslationIterator::SkipOpcodeAndItsOperandsAtPreviousIndex() {
   }
 }
 
+int DeoptimizationFrameTranslation::UnsharedSizeInBytes() const {
+#ifdef V8_USE_ZLIB
+  if (V8_UNLIKELY(v8_flags.turbo_compress_frame_translations)) {
+    return get_int(kUncompressedSizeOffset) *
+           kDeoptimizationFrameTranslationElementSize;
+  }
+#endif  // V8_USE_ZLIB
+  if (length() == 0) return 0;
+  int size = 0;
+  auto count_byte = [&size](uint8_t) { size++; };
+  // The iterator expands MATCH_PREVIOUS_TRANSLATION instructions, so this
+  // re-encodes every instruction of every translation in full. Reading the
+  // operands as unsigned yields the raw VLQ bits, which have the same encoded
+  // size as the signed operands they represent.
+  DeoptimizationFrameTranslation::Iterator iterator(*this, 0);
+  while (iterator.HasNextOpcode()) {
+    TranslationOpcode opcode = iterator.NextOpcode();
+    size++;
+    for (int i = 0; i < TranslationOpcodeOperandCount(opcode); i++) {
+      base::VLQEncodeUnsigned(count_byte, iterator.NextOperandUnsigned());
+    }
+  }
+  return size;
+}
+
 #ifdef ENABLE_DISASSEMBLER
 
 void DeoptimizationFrameTranslation::PrintFrameTranslation(
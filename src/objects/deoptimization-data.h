@@ -197,6 +197,11 @@ class DeoptimizationFrameTranslation : public TrustedByteArray {
   inline uint32_t get_int(int offset) const;
   inline void set_int(int offset, uint32_t value);
 
+  // Returns the number of bytes the translations would take if every
+  // translation was written out in full, i.e. without
+  // MATCH_PREVIOUS_TRANSLATION instructions and without compression.
+  int UnsharedSizeInBytes() const;
+
 #ifdef ENABLE_DISASSEMBLER
   void PrintFrameTranslation(
       std::ostream& os, int index,
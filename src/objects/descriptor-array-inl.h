@@ -9,6 +9,7 @@
 #include "src/handles/maybe-handles-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/heap.h"
+#include "src/logging/counters.h"
 #include "src/objects/descriptor-array.h"
 #include "src/objects/dictionary.h"
 #include "src/objects/field-type.h"
@@ -95,9 +96,12 @@ InternalIndex DescriptorArray::SearchWithCache(Isolate* isolate,
   int number = cache->Lookup(map, name);
 
   if (number == DescriptorLookupCache::kAbsent) {
+    isolate->counters()->descriptor_lookup_cache_misses()->Increment();
     InternalIndex result = Search(name, number_of_own_descriptors);
     number = result.is_found() ? result.as_int() : DescriptorArray::kNotFound;
     cache->Update(map, name, number);
+  } else {
+    isolate->counters()->descriptor_lookup_cache_hits()->Increment();
   }
   if (number == DescriptorArray::kNotFound) return InternalIndex::NotFound();
   return InternalIndex(number);
@@ -262,6 +262,12 @@ void NameDictionary::set_flags(uint32_t flags) {
 BIT_FIELD_ACCESSORS(NameDictionary, flags, may_have_interesting_properties,
                     NameDictionary::MayHaveInterestingPropertiesBit)
 
+void NameDictionary::ClearReadCount() {
+  uint32_t current = flags();
+  if (ReadCountBits::decode(current) == 0) return;
+  set_flags(ReadCountBits::update(current, 0));
+}
+
 Tagged<PropertyCell> GlobalDictionary::CellAt(InternalIndex entry) {
   PtrComprCageBase cage_base = GetPtrComprCageBase(*this);
   return CellAt(cage_base, entry);
@@ -246,6 +246,11 @@ class V8_EXPORT_PRIVATE NameDictionary
   // Note: Flags are stored as smi, so only 31 bits are usable.
   using MayHaveInterestingPropertiesBit = base::BitField<bool, 0, 1, uint32_t>;
   DECL_BOOLEAN_ACCESSORS(may_have_interesting_properties)
+  // Number of own property loads from this dictionary since a property was
+  // last added or deleted, saturating at kMax. Used to find read-mostly
+  // dictionary-mode objects, see JSObject::TryMigrateReadMostlyToFast.
+  using ReadCountBits = MayHaveInterestingPropertiesBit::Next<uint32_t, 10>;
+  inline void ClearReadCount();
 
   static constexpr int kFlagsDefault = 0;
 
@@ -22,6 +22,7 @@
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
 #include "src/utils/utils.h"
@@ -2372,6 +2373,23 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     }
     DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
 
+    if (IsSmiOrObjectElementsKind(Subclass::kind())) {
+      // Store the value into the whole range at once, and record the written
+      // slots with a single write barrier.
+      DisallowGarbageCollection no_gc;
+      Tagged<FixedArray> elements = Cast<FixedArray>(receiver->elements());
+      ObjectSlot first = elements->RawFieldOfElementAt(static_cast<int>(start));
+      ObjectSlot last = elements->RawFieldOfElementAt(static_cast<int>(end));
+      MemsetTagged(first, *obj_value, end - start);
+      if (IsHeapObject(*obj_value) &&
+          GetWriteBarrierMode(elements, Subclass::kind(), no_gc) ==
+              UPDATE_WRITE_BARRIER) {
+        receiver->GetIsolate()->heap()->WriteBarrierForRange(elements, first,
+                                                             last);
+      }
+      return MaybeHandle<Object>(receiver);
+    }
+
     for (size_t index = start; index < end; ++index) {
       Subclass::SetImpl(receiver, InternalIndex(index), *obj_value);
     }
@@ -3238,6 +3256,18 @@ class FastHoleyDoubleElementsAccessor
 
 enum IsSharedBuffer : bool { kShared = true, kUnshared = false };
 
+// The element type that the vectorized searches in simd.h compare typed array
+// elements as: integers are compared by their bit pattern, floating point
+// numbers by value (so that -0 matches +0).
+template <typename T, bool = std::is_floating_point_v<T>>
+struct VectorizedSearchType {
+  using type = T;
+};
+template <typename T>
+struct VectorizedSearchType<T, false> {
+  using type = std::make_unsigned_t<T>;
+};
+
 // Super class for all external element arrays.
 template <ElementsKind Kind, typename ElementType>
 class TypedElementsAccessor
@@ -3560,6 +3590,60 @@ class TypedElementsAccessor
     return MaybeHandle<Object>(typed_array);
   }
 
+  // Searches of at least this many elements use SIMD.
+  static constexpr size_t kVectorizedSearchMinLength = 48;
+
+  static bool CanUseVectorizedSearch(ElementType* data_ptr,
+                                     IsSharedBuffer is_shared,
+                                     size_t num_elements) {
+    // Shared buffers need the relaxed atomic loads of GetImpl, and the
+    // vectorized searches need element-aligned data.
+    return !is_shared && num_elements >= kVectorizedSearchMinLength &&
+           IsAligned(reinterpret_cast<Address>(data_ptr), alignof(ElementType));
+  }
+
+  // Returns the index of the first element in [start_from, length) which is
+  // equal to {value}, or -1.
+  static int64_t SearchValue(ElementType* data_ptr, IsSharedBuffer is_shared,
+                             ElementType value, size_t start_from,
+                             size_t length) {
+    if (start_from < length &&
+        CanUseVectorizedSearch(data_ptr, is_shared, length - start_from)) {
+      using SearchType = typename VectorizedSearchType<ElementType>::type;
+      uintptr_t index = TypedArrayIndexOf<SearchType>(
+          reinterpret_cast<SearchType*>(data_ptr), length, start_from,
+          base::bit_cast<SearchType>(value));
+      if (index == static_cast<uintptr_t>(-1)) return -1;
+      return static_cast<int64_t>(index);
+    }
+    for (size_t k = start_from; k < length; ++k) {
+      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
+      if (elem_k == value) return static_cast<int64_t>(k);
+    }
+    return -1;
+  }
+
+  // Returns the index of the last element in [0, start_from] which is equal
+  // to {value}, or -1.
+  static int64_t SearchValueReverse(ElementType* data_ptr,
+                                    IsSharedBuffer is_shared,
+                                    ElementType value, size_t start_from) {
+    if (CanUseVectorizedSearch(data_ptr, is_shared, start_from + 1)) {
+      using SearchType = typename VectorizedSearchType<ElementType>::type;
+      uintptr_t index = TypedArrayLastIndexOf<SearchType>(
+          reinterpret_cast<SearchType*>(data_ptr), start_from,
+          base::bit_cast<SearchType>(value));
+      if (index == static_cast<uintptr_t>(-1)) return -1;
+      return static_cast<int64_t>(index);
+    }
+    size_t k = start_from;
+    do {
+      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
+      if (elem_k == value) return static_cast<int64_t>(k);
+    } while (k-- != 0);
+    return -1;
+  }
+
   static Maybe<bool> IncludesValueImpl(Isolate* isolate,
                                        DirectHandle<JSObject> receiver,
                                        Handle<Object> value, size_t start_from,
@@ -3627,11 +3711,8 @@ class TypedElementsAccessor
       }
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    return Just(SearchValue(data_ptr, is_shared, typed_search_value,
+                            start_from, length) != -1);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3686,11 +3767,8 @@ class TypedElementsAccessor
     }
 
     auto is_shared = typed_array->buffer()->is_shared() ? kShared : kUnshared;
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
-    }
-    return Just<int64_t>(-1);
+    return Just<int64_t>(SearchValue(data_ptr, is_shared, typed_search_value,
+                                     start_from, length));
   }
 
   static Maybe<int64_t> LastIndexOfValueImpl(DirectHandle<JSObject> receiver,
@@ -3740,13 +3818,9 @@ class TypedElementsAccessor
       start_from = typed_array_length - 1;
     }
 
-    size_t k = start_from;
     auto is_shared = typed_array->buffer()->is_shared() ? kShared : kUnshared;
-    do {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr + k, is_shared);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
-    } while (k-- != 0);
-    return Just<int64_t>(-1);
+    return Just<int64_t>(SearchValueReverse(data_ptr, is_shared,
+                                            typed_search_value, start_from));
   }
 
   static void ReverseImpl(Tagged<JSObject> receiver) {
@@ -4163,24 +4237,47 @@ class TypedElementsAccessor
   }
 };
 
+// Converts {length} elements from {source_data_ptr} with {convert}. Without
+// the relaxed atomics that shared buffers need, the loop for unshared buffers
+// is a plain conversion loop, which compilers vectorize for most pairs of
+// element types.
+template <ElementsKind Kind, typename ElementType, ElementsKind SourceKind,
+          typename SourceElementType, typename Convert>
+void ConvertBetweenBackingStores(SourceElementType* source_data_ptr,
+                                 ElementType* dest_data_ptr, size_t length,
+                                 IsSharedBuffer is_shared, Convert convert) {
+  using SourceAccessor = TypedElementsAccessor<SourceKind, SourceElementType>;
+  using DestAccessor = TypedElementsAccessor<Kind, ElementType>;
+  if (is_shared == kUnshared) {
+    for (size_t i = 0; i < length; ++i) {
+      SourceElementType source_elem =
+          SourceAccessor::GetImpl(source_data_ptr + i, kUnshared);
+      DestAccessor::SetImpl(dest_data_ptr + i, convert(source_elem),
+                            kUnshared);
+    }
+    return;
+  }
+  for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
+    // We use scalar accessors to avoid boxing/unboxing, so there are no
+    // allocations.
+    SourceElementType source_elem =
+        SourceAccessor::GetImpl(source_data_ptr, kShared);
+    DestAccessor::SetImpl(dest_data_ptr, convert(source_elem), kShared);
+  }
+}
+
 template <ElementsKind Kind, typename ElementType, ElementsKind SourceKind,
           typename SourceElementType>
 struct CopyBetweenBackingStoresImpl {
   static void Copy(SourceElementType* source_data_ptr,
                    ElementType* dest_data_ptr, size_t length,
                    IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      SourceElementType source_elem =
-          TypedElementsAccessor<SourceKind, SourceElementType>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(source_elem);
-
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
+    ConvertBetweenBackingStores<Kind, ElementType, SourceKind>(
+        source_data_ptr, dest_data_ptr, length, is_shared,
+        [](SourceElementType source_elem) {
+          return TypedElementsAccessor<Kind, ElementType>::FromScalar(
+              source_elem);
+        });
   }
 };
 
@@ -4189,19 +4286,12 @@ struct CopyBetweenBackingStoresImpl<Kind, ElementType, FLOAT16_ELEMENTS,
                                     uint16_t> {
   static void Copy(uint16_t* source_data_ptr, ElementType* dest_data_ptr,
                    size_t length, IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      uint16_t source_elem =
-          TypedElementsAccessor<FLOAT16_ELEMENTS, uint16_t>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(
+    ConvertBetweenBackingStores<Kind, ElementType, FLOAT16_ELEMENTS>(
+        source_data_ptr, dest_data_ptr, length, is_shared,
+        [](uint16_t source_elem) {
+          return TypedElementsAccessor<Kind, ElementType>::FromScalar(
               fp16_ieee_to_fp32_value(source_elem));
-
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
+        });
   }
 };
 
@@ -4210,19 +4300,12 @@ struct CopyBetweenBackingStoresImpl<Kind, ElementType,
                                     RAB_GSAB_FLOAT16_ELEMENTS, uint16_t> {
   static void Copy(uint16_t* source_data_ptr, ElementType* dest_data_ptr,
                    size_t length, IsSharedBuffer is_shared) {
-    for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      uint16_t source_elem =
-          TypedElementsAccessor<RAB_GSAB_FLOAT16_ELEMENTS, uint16_t>::GetImpl(
-              source_data_ptr, is_shared);
-      ElementType dest_elem =
-          TypedElementsAccessor<Kind, ElementType>::FromScalar(
+    ConvertBetweenBackingStores<Kind, ElementType, RAB_GSAB_FLOAT16_ELEMENTS>(
+        source_data_ptr, dest_data_ptr, length, is_shared,
+        [](uint16_t source_elem) {
+          return TypedElementsAccessor<Kind, ElementType>::FromScalar(
               fp16_ieee_to_fp32_value(source_elem));
-
-      TypedElementsAccessor<Kind, ElementType>::SetImpl(dest_data_ptr,
-                                                        dest_elem, is_shared);
-    }
+        });
   }
 };
 
@@ -709,6 +709,20 @@ bool FeedbackNexus::ConfigureMegamorphic() {
   return false;
 }
 
+void FeedbackNexus::ConfigureGenericOperation() {
+  DisallowGarbageCollection no_gc;
+  switch (kind()) {
+    case FeedbackSlotKind::kBinaryOp:
+      SetFeedback(Smi::FromInt(BinaryOperationFeedback::kAny));
+      break;
+    case FeedbackSlotKind::kCompareOp:
+      SetFeedback(Smi::FromInt(CompareOperationFeedback::kAny));
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
 void FeedbackNexus::ConfigureMegaDOM(const MaybeObjectHandle& handler) {
   DisallowGarbageCollection no_gc;
   Tagged<MaybeObject> sentinel = MegaDOMSentinel();
@@ -895,6 +895,9 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   // was changed. Extra feedback is cleared if the 0 parameter version is used.
   bool ConfigureMegamorphic();
   bool ConfigureMegamorphic(IcCheckType property_type);
+  // Generalizes the feedback of a binary or compare operation, so that no
+  // further speculation is done on its inputs.
+  void ConfigureGenericOperation();
 
   inline Tagged<MaybeObject> GetFeedback() const;
   inline Tagged<MaybeObject> GetFeedbackExtra() const;
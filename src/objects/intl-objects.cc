@@ -5,6 +5,7 @@
 #include "src/objects/intl-objects.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -48,6 +49,8 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
@@ -333,9 +336,9 @@ Tagged<String> Intl::ConvertOneByteToLower(Tagged<String> src,
 
     // If not ASCII, we keep the result up to index_to_first_unprocessed and
     // process the rest.
-    for (int index = index_to_first_unprocessed; index < length; ++index) {
-      dst_data[index] = ToLatin1Lower(src_data[index]);
-    }
+    FastLatin1ToLower(dst_data + index_to_first_unprocessed,
+                      src_data + index_to_first_unprocessed,
+                      length - index_to_first_unprocessed);
   } else {
     DCHECK(src_flat.IsTwoByte());
     int index_to_first_unprocessed = FindFirstUpperOrNonAscii(src, length);
@@ -410,7 +413,12 @@ MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
           return has_changed_character ? result : s;
         }
         // If not ASCII, we keep the result up to index_to_first_unprocessed and
-        // process the rest.
+        // process the rest, which is mostly done in bulk until the first
+        // character that needs special handling.
+        index_to_first_unprocessed += FastLatin1ToUpper(
+            dest + index_to_first_unprocessed,
+            src.begin() + index_to_first_unprocessed,
+            length - index_to_first_unprocessed);
         is_result_single_byte =
             ToUpperOneByte(src.SubVector(index_to_first_unprocessed, length),
                            dest + index_to_first_unprocessed, &sharp_s_count);
@@ -935,6 +943,24 @@ MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
   }
 }
 
+namespace {
+
+// Lists all of the available locales that are statically known to fulfill
+// fast path conditions. See the StringLocaleCompareFastPath test as a
+// starting point to update this list.
+//
+// Locale entries are roughly sorted s.t. common locales come first.
+//
+// The actual conditions are verified in debug builds in
+// CollatorAllowsFastComparison.
+const char* const kFastLocales[] = {
+    "en-US", "en", "fr", "es",    "de",    "pt",    "it", "ca",
+    "de-AT", "fi", "id", "id-ID", "ms",    "nl",    "pl", "ro",
+    "sl",    "sv", "sw", "vi",    "en-DE", "en-GB",
+};
+
+}  // namespace
+
 // static
 template <class IsolateT>
 Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
@@ -944,20 +970,6 @@ Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
     return CompareStringsOptions::kNone;
   }
 
-  // Lists all of the available locales that are statically known to fulfill
-  // fast path conditions. See the StringLocaleCompareFastPath test as a
-  // starting point to update this list.
-  //
-  // Locale entries are roughly sorted s.t. common locales come first.
-  //
-  // The actual conditions are verified in debug builds in
-  // CollatorAllowsFastComparison.
-  static const char* const kFastLocales[] = {
-      "en-US", "en", "fr", "es",    "de",    "pt",    "it", "ca",
-      "de-AT", "fi", "id", "id-ID", "ms",    "nl",    "pl", "ro",
-      "sl",    "sv", "sw", "vi",    "en-DE", "en-GB",
-  };
-
   if (IsUndefined(*locales, isolate)) {
     const std::string& default_locale = isolate->DefaultLocale();
     for (const char* fast_locale : kFastLocales) {
@@ -987,6 +999,63 @@ template Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
 template Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
     LocalIsolate*, DirectHandle<Object>, DirectHandle<Object>);
 
+// static
+Intl::CompareStringsOptions Intl::CompareStringsOptionsFor(
+    const icu::Collator& icu_collator, const std::string& locale) {
+  bool is_fast_locale = false;
+  for (const char* fast_locale : kFastLocales) {
+    if (locale == fast_locale) {
+      is_fast_locale = true;
+      break;
+    }
+  }
+  if (!is_fast_locale) return CompareStringsOptions::kNone;
+
+  // Options passed to the collator may still change the order of ASCII
+  // strings, e.g. through numeric collation or by ignoring punctuation.
+  UErrorCode status = U_ZERO_ERROR;
+  icu::Locale icu_locale(icu_collator.getLocale(ULOC_VALID_LOCALE, status));
+  if (U_FAILURE(status)) return CompareStringsOptions::kNone;
+  static constexpr int kBufferSize = 64;
+  char buffer[kBufferSize];
+  const int collation_keyword_length =
+      icu_locale.getKeywordValue("collation", buffer, kBufferSize, status);
+  if (U_FAILURE(status) || collation_keyword_length != 0) {
+    return CompareStringsOptions::kNone;
+  }
+
+  static constexpr struct {
+    UColAttribute attribute;
+    UColAttributeValue legal_value;
+  } kAttributeChecks[] = {
+      {UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE},
+      {UCOL_CASE_FIRST, UCOL_OFF},
+      {UCOL_CASE_LEVEL, UCOL_OFF},
+      {UCOL_FRENCH_COLLATION, UCOL_OFF},
+      {UCOL_NUMERIC_COLLATION, UCOL_OFF},
+  };
+  for (const auto& check : kAttributeChecks) {
+    if (icu_collator.getAttribute(check.attribute, status) !=
+            check.legal_value ||
+        U_FAILURE(status)) {
+      return CompareStringsOptions::kNone;
+    }
+  }
+
+  // The collation weights of ASCII characters only differ in their primary
+  // and tertiary (case) levels, so sensitivity "base" and "accent" both
+  // compare strings by their primary weights only.
+  switch (icu_collator.getAttribute(UCOL_STRENGTH, status)) {
+    case UCOL_PRIMARY:
+    case UCOL_SECONDARY:
+      return CompareStringsOptions::kTryFastPathIgnoringCase;
+    case UCOL_TERTIARY:
+      return CompareStringsOptions::kTryFastPath;
+    default:
+      return CompareStringsOptions::kNone;
+  }
+}
+
 std::optional<int> Intl::StringLocaleCompare(
     Isolate* isolate, Handle<String> string1, Handle<String> string2,
     Handle<Object> locales, Handle<Object> options, const char* method_name) {
@@ -1028,8 +1097,10 @@ std::optional<int> Intl::StringLocaleCompare(
             collator->icu_collator()->get()));
   }
   icu::Collator* icu_collator = collator->icu_collator()->raw();
+  // The collator knows whether its options, e.g. the sensitivity, still allow
+  // for the fast path.
   return Intl::CompareStrings(isolate, *icu_collator, string1, string2,
-                              compare_strings_options);
+                              collator->compare_strings_options());
 }
 
 namespace {
@@ -1242,7 +1313,8 @@ bool USetContainsAllAsciiItem(USet* set) {
   return false;
 }
 
-bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
+bool CollatorAllowsFastComparison(const icu::Collator& icu_collator,
+                                  bool ignore_case) {
   UErrorCode status = U_ZERO_ERROR;
 
   icu::Locale icu_locale(icu_collator.getLocale(ULOC_VALID_LOCALE, status));
@@ -1265,7 +1337,6 @@ bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
       {UCOL_CASE_LEVEL, UCOL_OFF},
       {UCOL_FRENCH_COLLATION, UCOL_OFF},
       {UCOL_NUMERIC_COLLATION, UCOL_OFF},
-      {UCOL_STRENGTH, UCOL_TERTIARY},
   };
 
   for (const auto& check : kAttributeChecks) {
@@ -1276,6 +1347,15 @@ bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
     DCHECK(U_SUCCESS(status));
   }
 
+  const UColAttributeValue strength =
+      icu_collator.getAttribute(UCOL_STRENGTH, status);
+  DCHECK(U_SUCCESS(status));
+  if (ignore_case) {
+    if (strength != UCOL_PRIMARY && strength != UCOL_SECONDARY) return false;
+  } else {
+    if (strength != UCOL_TERTIARY) return false;
+  }
+
   // No reordering codes are allowed.
   int num_reorder_codes =
       ucol_getReorderCodes(icu_collator.toUCollator(), nullptr, 0, &status);
@@ -1356,10 +1436,12 @@ bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
 //
 //   return UCOL_EQUAL;
 // }
+//
+// When {ignore_case} is set, the L3 weights are not applied.
 std::optional<UCollationResult> TryFastCompareStrings(
     Isolate* isolate, const icu::Collator& icu_collator,
     DirectHandle<String> string1, DirectHandle<String> string2,
-    int* processed_until_out) {
+    bool ignore_case, int* processed_until_out) {
   // TODO(jgruber): We could avoid the flattening (done by the caller) as well
   // by implementing comparison through string iteration. This has visible
   // performance benefits (e.g. 7% on CDJS) but complicates the code. Consider
@@ -1371,7 +1453,7 @@ std::optional<UCollationResult> TryFastCompareStrings(
 
 #ifdef DEBUG
   // Checked by the caller, see CompareStringsOptionsFor.
-  SLOW_DCHECK(CollatorAllowsFastComparison(icu_collator));
+  SLOW_DCHECK(CollatorAllowsFastComparison(icu_collator, ignore_case));
   USE(CollatorAllowsFastComparison);
 #endif  // DEBUG
 
@@ -1416,7 +1498,7 @@ std::optional<UCollationResult> TryFastCompareStrings(
   }
 
   // L1-equal and same length, the L3 result wins.
-  return d.l3_result;
+  return ignore_case ? UCollationResult::UCOL_EQUAL : d.l3_result;
 }
 
 }  // namespace
@@ -1450,9 +1532,12 @@ int Intl::CompareStrings(Isolate* isolate, const icu::Collator& icu_collator,
   string2 = String::Flatten(isolate, string2);
 
   int processed_until = 0;
-  if (compare_strings_options == CompareStringsOptions::kTryFastPath) {
-    std::optional<int> maybe_result = TryFastCompareStrings(
-        isolate, icu_collator, string1, string2, &processed_until);
+  if (compare_strings_options != CompareStringsOptions::kNone) {
+    const bool ignore_case = compare_strings_options ==
+                             CompareStringsOptions::kTryFastPathIgnoringCase;
+    std::optional<int> maybe_result =
+        TryFastCompareStrings(isolate, icu_collator, string1, string2,
+                              ignore_case, &processed_until);
     if (maybe_result.has_value()) return maybe_result.value();
   }
 
@@ -2678,15 +2763,81 @@ class ICUTimezoneCache : public base::TimezoneCache {
   void Clear(TimeZoneDetection time_zone_detection) override;
 
  private:
+  // Offsets of the default time zone are looked up in a table of its
+  // transitions. ICU provides them for windows of kTransitionWindowMs,
+  // which are loaded as times in them are used.
+  static constexpr double kTransitionWindowMs = 366.0 * 24 * 60 * 60 * 1000;
+  // Upper bound on the number of loaded windows; the table is cleared when
+  // more are needed.
+  static constexpr size_t kMaxTransitionWindows = 512;
+  // No time zone offset is a day or more, so a local time L can only refer
+  // to a UTC time in (L - kMaxOffsetMs, L + kMaxOffsetMs).
+  static constexpr double kMaxOffsetMs = 24 * 60 * 60 * 1000;
+  // Size of the cache of recently used offset segments.
+  static constexpr int kOffsetCacheSize = 4;
+
+  struct Transition {
+    // UTC time from which {offset_ms} and {dst_offset_ms} apply.
+    double time_ms;
+    // First local time that is interpreted with the new offsets. Skipped and
+    // repeated local times are interpreted with the former offsets, like
+    // UCAL_TZ_LOCAL_FORMER does.
+    double local_time_ms;
+    int32_t offset_ms;
+    int32_t dst_offset_ms;
+  };
+
+  struct TransitionWindow {
+    // The window covers UTC times [index, index + 1) * kTransitionWindowMs.
+    int64_t index;
+    // The first entry holds the offsets before the window's start, the
+    // others are the transitions in the window.
+    std::vector<Transition> transitions;
+  };
+
+  // A range of UTC or local times in which the offsets don't change.
+  struct OffsetSegment {
+    double start_ms;
+    double end_ms;
+    int32_t offset_ms;
+    int32_t dst_offset_ms;
+    bool is_utc;
+  };
+
   icu::TimeZone* GetTimeZone();
 
   bool GetOffsets(double time_ms, bool is_utc, int32_t* raw_offset,
                   int32_t* dst_offset);
 
+  // Looks up the offsets in the cache of recent segments, then in the
+  // transition table. Returns false if the offsets have to be computed by
+  // ICU instead.
+  bool GetCachedOffsets(double time_ms, bool is_utc, int32_t* offset,
+                        int32_t* dst_offset);
+
+  static int64_t WindowIndex(double time_ms) {
+    return static_cast<int64_t>(std::floor(time_ms / kTransitionWindowMs));
+  }
+
+  // Computes the segment around {time_ms} from the transition table.
+  bool FindOffsetSegment(double time_ms, bool is_utc, OffsetSegment* segment);
+
+  // Makes sure that windows [first, last] are loaded, and returns the first.
+  const TransitionWindow* GetTransitionWindows(int64_t first, int64_t last);
+
+  void ClearTransitions();
+
   icu::TimeZone* timezone_;
 
   std::string timezone_name_;
   std::string dst_timezone_name_;
+
+  // Loaded windows, sorted by index.
+  std::vector<TransitionWindow> transition_windows_;
+
+  // Most recently used segments first.
+  OffsetSegment offset_cache_[kOffsetCacheSize];
+  int offset_cache_size_;
 };
 
 const char* ICUTimezoneCache::LocalTimezone(double time_ms) {
@@ -2728,14 +2879,184 @@ bool ICUTimezoneCache::GetOffsets(double time_ms, bool is_utc,
   return U_SUCCESS(status);
 }
 
+bool ICUTimezoneCache::GetCachedOffsets(double time_ms, bool is_utc,
+                                        int32_t* offset, int32_t* dst_offset) {
+  for (int i = 0; i < offset_cache_size_; i++) {
+    const OffsetSegment& segment = offset_cache_[i];
+    if (segment.is_utc == is_utc && segment.start_ms <= time_ms &&
+        time_ms < segment.end_ms) {
+      *offset = segment.offset_ms;
+      *dst_offset = segment.dst_offset_ms;
+      // Move the segment to the front.
+      std::rotate(offset_cache_, offset_cache_ + i, offset_cache_ + i + 1);
+      return true;
+    }
+  }
+
+  OffsetSegment segment;
+  if (!FindOffsetSegment(time_ms, is_utc, &segment)) return false;
+  DCHECK(segment.start_ms <= time_ms && time_ms < segment.end_ms);
+  if (offset_cache_size_ < kOffsetCacheSize) offset_cache_size_++;
+  std::copy_backward(offset_cache_, offset_cache_ + offset_cache_size_ - 1,
+                     offset_cache_ + offset_cache_size_);
+  offset_cache_[0] = segment;
+  *offset = segment.offset_ms;
+  *dst_offset = segment.dst_offset_ms;
+  return true;
+}
+
+bool ICUTimezoneCache::FindOffsetSegment(double time_ms, bool is_utc,
+                                         OffsetSegment* segment) {
+  // This is well beyond the range of valid dates.
+  constexpr double kMaxTimeMs = 1e16;
+  if (!(-kMaxTimeMs < time_ms && time_ms < kMaxTimeMs)) return false;
+  segment->is_utc = is_utc;
+
+  // Returns the last transition in {window} at or before {time}.
+  auto find = [](const TransitionWindow* window, double time) {
+    const Transition* it = window->transitions.data();
+    // Branchless binary search, as random times would mispredict most
+    // branches. The first entry always qualifies.
+    for (size_t n = window->transitions.size(); n > 1;) {
+      size_t half = n / 2;
+      it = it[half].time_ms <= time ? it + half : it;
+      n -= half;
+    }
+    return it;
+  };
+
+  if (is_utc) {
+    int64_t index = WindowIndex(time_ms);
+    const TransitionWindow* window = GetTransitionWindows(index, index);
+    const Transition* it = find(window, time_ms);
+    bool is_last = it + 1 == window->transitions.data() +
+                                 window->transitions.size();
+    segment->start_ms = std::max(it->time_ms, index * kTransitionWindowMs);
+    segment->end_ms =
+        is_last ? (index + 1) * kTransitionWindowMs : it[1].time_ms;
+    segment->offset_ms = it->offset_ms;
+    segment->dst_offset_ms = it->dst_offset_ms;
+    return true;
+  }
+
+  // A local time is interpreted with the offsets of the last transition
+  // that starts at or before it. Only transitions in the UTC range
+  // (time_ms - kMaxOffsetMs, time_ms + kMaxOffsetMs) can start after it,
+  // so we search backwards from the end of that range.
+  double low_ms = time_ms - kMaxOffsetMs;
+  double high_ms = time_ms + kMaxOffsetMs;
+  int64_t low = WindowIndex(low_ms);
+  int64_t high = WindowIndex(high_ms);
+  DCHECK_LE(high - low, 1);
+  const TransitionWindow* window =
+      GetTransitionWindows(low, high) + (high - low);
+  // The segment ends where a skipped transition starts, or where the loaded
+  // windows end.
+  segment->end_ms = (high + 1) * kTransitionWindowMs - kMaxOffsetMs;
+  const Transition* it = find(window, high_ms);
+  if (it + 1 < window->transitions.data() + window->transitions.size()) {
+    segment->end_ms = it[1].time_ms - kMaxOffsetMs;
+  }
+  while (true) {
+    if (it == window->transitions.data() && window->index != low) {
+      // Continue with the last transition of the previous window.
+      window--;
+      it = window->transitions.data() + window->transitions.size() - 1;
+      continue;
+    }
+    if (it == window->transitions.data()) {
+      DCHECK_LE(low * kTransitionWindowMs, low_ms);
+      segment->start_ms = low * kTransitionWindowMs + kMaxOffsetMs;
+      break;
+    }
+    if (it->local_time_ms <= time_ms) {
+      segment->start_ms = it->local_time_ms;
+      break;
+    }
+    segment->end_ms = std::min(segment->end_ms, it->local_time_ms);
+    it--;
+  }
+  segment->offset_ms = it->offset_ms;
+  segment->dst_offset_ms = it->dst_offset_ms;
+  return true;
+}
+
+const ICUTimezoneCache::TransitionWindow*
+ICUTimezoneCache::GetTransitionWindows(int64_t first, int64_t last) {
+  auto compare = [](const TransitionWindow& window, int64_t index) {
+    return window.index < index;
+  };
+  if (!transition_windows_.empty()) {
+    // Branchless search for the window, as in FindOffsetSegment.
+    const TransitionWindow* it = transition_windows_.data();
+    for (size_t n = transition_windows_.size(); n > 1;) {
+      size_t half = n / 2;
+      it = it[half].index <= first ? it + half : it;
+      n -= half;
+    }
+    const TransitionWindow* end =
+        transition_windows_.data() + transition_windows_.size();
+    if (it->index == first &&
+        (last == first || (it + 1 < end && it[1].index == last))) {
+      return it;
+    }
+  }
+
+  if (transition_windows_.size() + (last - first + 1) > kMaxTransitionWindows) {
+    transition_windows_.clear();
+  }
+  const icu::BasicTimeZone* timezone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  for (int64_t index = first; index <= last; index++) {
+    auto it = std::lower_bound(transition_windows_.begin(),
+                          transition_windows_.end(), index, compare);
+    if (it != transition_windows_.end() && it->index == index) continue;
+    double start_ms = index * kTransitionWindowMs;
+    double end_ms = start_ms + kTransitionWindowMs;
+    TransitionWindow window{index, {}};
+    int32_t raw_offset = 0, dst_offset = 0;
+    GetOffsets(start_ms - 1, true, &raw_offset, &dst_offset);
+    window.transitions.push_back(
+        {-std::numeric_limits<double>::infinity(),
+         -std::numeric_limits<double>::infinity(), raw_offset + dst_offset,
+         dst_offset});
+    icu::TimeZoneTransition transition;
+    bool inclusive = true;
+    double time_ms = start_ms;
+    while (timezone->getNextTransition(time_ms, inclusive, transition) &&
+           transition.getTime() < end_ms) {
+      time_ms = transition.getTime();
+      inclusive = false;
+      const icu::TimeZoneRule* rule = transition.getTo();
+      int32_t offset = rule->getRawOffset() + rule->getDSTSavings();
+      int32_t offset_before = window.transitions.back().offset_ms;
+      window.transitions.push_back(
+          {time_ms, time_ms + std::max(offset_before, offset), offset,
+           rule->getDSTSavings()});
+    }
+    transition_windows_.insert(it, std::move(window));
+  }
+  return &*std::lower_bound(transition_windows_.begin(),
+                            transition_windows_.end(), first, compare);
+}
+
+void ICUTimezoneCache::ClearTransitions() {
+  transition_windows_.clear();
+  offset_cache_size_ = 0;
+}
+
 double ICUTimezoneCache::DaylightSavingsOffset(double time_ms) {
-  int32_t raw_offset, dst_offset;
+  int32_t offset, dst_offset;
+  if (GetCachedOffsets(time_ms, true, &offset, &dst_offset)) return dst_offset;
+  int32_t raw_offset;
   if (!GetOffsets(time_ms, true, &raw_offset, &dst_offset)) return 0;
   return dst_offset;
 }
 
 double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
-  int32_t raw_offset, dst_offset;
+  int32_t offset, dst_offset;
+  if (GetCachedOffsets(time_ms, is_utc, &offset, &dst_offset)) return offset;
+  int32_t raw_offset;
   if (!GetOffsets(time_ms, is_utc, &raw_offset, &dst_offset)) return 0;
   return raw_offset + dst_offset;
 }
@@ -2745,6 +3066,7 @@ void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   timezone_ = nullptr;
   timezone_name_.clear();
   dst_timezone_name_.clear();
+  ClearTransitions();
   if (time_zone_detection == TimeZoneDetection::kRedetect) {
     icu::TimeZone::adoptDefault(icu::TimeZone::detectHostTimeZone());
   }
@@ -152,11 +152,17 @@ class Intl {
   enum class CompareStringsOptions {
     kNone,
     kTryFastPath,
+    // Like kTryFastPath, for collators which ignore case differences (i.e.
+    // sensitivity "base" or "accent").
+    kTryFastPathIgnoringCase,
   };
   template <class IsolateT>
   V8_EXPORT_PRIVATE static CompareStringsOptions CompareStringsOptionsFor(
       IsolateT* isolate, DirectHandle<Object> locales,
       DirectHandle<Object> options);
+  // For an already configured collator of the given resolved {locale}.
+  static CompareStringsOptions CompareStringsOptionsFor(
+      const icu::Collator& icu_collator, const std::string& locale);
   V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT static int CompareStrings(
       Isolate* isolate, const icu::Collator& collator, Handle<String> s1,
       Handle<String> s2,
@@ -422,6 +422,14 @@ size_t JSTypedArray::LengthTrackingGsabBackedTypedArrayLength(
   return (backing_byte_length - array->byte_offset()) / element_byte_size;
 }
 
+// static
+size_t JSTypedArray::RabGsabTypedArrayLength(Address raw_array) {
+  DisallowGarbageCollection no_gc;
+  Tagged<JSTypedArray> array = Cast<JSTypedArray>(Tagged<Object>(raw_array));
+  DCHECK(array->IsVariableLength());
+  return array->GetLength();
+}
+
 size_t JSTypedArray::GetVariableLengthOrOutOfBounds(bool& out_of_bounds) const {
   DCHECK(!WasDetached());
   if (is_length_tracking()) {
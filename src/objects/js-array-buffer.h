@@ -340,6 +340,10 @@ class JSTypedArray
   static size_t LengthTrackingGsabBackedTypedArrayLength(Isolate* isolate,
                                                          Address raw_array);
 
+  // Returns the length of a variable length typed array, or 0 if it's detached
+  // or out of bounds. Called from optimized code.
+  static size_t RabGsabTypedArrayLength(Address raw_array);
+
   // Note: this is a pointer compression specific optimization.
   // Normally, on-heap typed arrays contain HeapObject value in |base_pointer|
   // field and an offset in |external_pointer|.
@@ -125,6 +125,10 @@ class JSArray : public TorqueGeneratedJSArray<JSArray, JSObject> {
   // Max. number of elements being copied in Array builtins.
   static const int kMaxCopyElements = 100;
 
+  // Min. length of a fast array whose elements are shared copy-on-write with
+  // its clones made by spread, slice() and Array.from(), instead of copied.
+  static const int kMinCopyOnWriteCloneLength = 16;
+
   // Valid array indices range from +0 <= i < 2^32 - 1 (kMaxUInt32).
   static constexpr uint32_t kMaxArrayLength = JSObject::kMaxElementCount;
   static constexpr uint32_t kMaxArrayIndex = JSObject::kMaxElementIndex;
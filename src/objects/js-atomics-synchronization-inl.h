@@ -240,6 +240,12 @@ std::atomic<int32_t>* JSAtomicsMutex::AtomicOwnerThreadIdPtr() {
   return base::AsAtomicPtr(owner_thread_id_ptr);
 }
 
+std::atomic<int32_t>* JSAtomicsMutex::AtomicSpinEstimatePtr() {
+  int32_t* spin_estimate_ptr =
+      reinterpret_cast<int32_t*>(field_address(kSpinEstimateOffset));
+  return base::AsAtomicPtr(spin_estimate_ptr);
+}
+
 TQ_OBJECT_CONSTRUCTORS_IMPL(JSAtomicsCondition)
 
 }  // namespace internal
@@ -215,6 +215,36 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
     SetNotInListForVerification();
   }
 
+  // Lets the unlocking thread hand the mutex over to this waiter once it has
+  // been waiting since {wait_start} for longer than
+  // --js-atomics-mutex-handoff-threshold-ms. Only untimed waits may receive
+  // the lock, since a timed out waiter can't tell whether it was handed the
+  // lock before dequeuing itself.
+  void EnableLockHandOff(base::TimeTicks wait_start) {
+    DCHECK_GE(v8_flags.js_atomics_mutex_handoff_threshold_ms, 0);
+    handoff_wait_start_ = wait_start;
+  }
+
+  bool ShouldReceiveLockHandOff() override {
+    if (handoff_wait_start_.IsNull()) return false;
+    return base::TimeTicks::Now() - handoff_wait_start_ >=
+           base::TimeDelta::FromMilliseconds(
+               v8_flags.js_atomics_mutex_handoff_threshold_ms);
+  }
+
+  void NotifyWithLockHandOff() override {
+    DCHECK(!handoff_wait_start_.IsNull());
+    base::MutexGuard guard(&wait_lock_);
+    lock_handed_off_ = true;
+    should_wait_ = false;
+    wait_cond_var_.NotifyOne();
+    SetNotInListForVerification();
+  }
+
+  // Whether the waiter was woken up as the new owner of the mutex. Must only
+  // be called after waiting.
+  bool lock_handed_off() const { return lock_handed_off_; }
+
   bool IsSameIsolateForAsyncCleanup(Isolate* isolate) override {
     // Sync waiters are only queued while the thread is sleeping, so there
     // should not be sync nodes while cleaning up the isolate.
@@ -232,6 +262,8 @@ class V8_NODISCARD SyncWaiterQueueNode final : public WaiterQueueNode {
   base::Mutex wait_lock_;
   base::ConditionVariable wait_cond_var_;
   bool should_wait_;
+  base::TimeTicks handoff_wait_start_;
+  bool lock_handed_off_ = false;
 };
 
 template <typename T>
@@ -591,14 +623,26 @@ bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
                                     DirectHandle<JSAtomicsMutex> mutex,
                                     std::atomic<StateT>* state) {
   // The backoff algorithm is copied from PartitionAlloc's SpinningMutex.
-  constexpr int kSpinCount = 64;
   constexpr int kMaxBackoff = 16;
 
+  // The spin estimate approximates how long the lock is held for by how many
+  // spins it recently took to acquire it, similar to glibc's adaptive mutexes.
+  std::atomic<int32_t>* spin_estimate_ptr = mutex->AtomicSpinEstimatePtr();
+  int32_t spin_estimate = spin_estimate_ptr->load(std::memory_order_relaxed);
+  const int spin_count = SpinCount(spin_estimate);
+
   int tries = 0;
   int backoff = 1;
   StateT current_state = state->load(std::memory_order_relaxed);
   do {
-    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) return true;
+    if (JSAtomicsMutex::TryLockExplicit(state, current_state)) {
+      // Move the estimate 1/8th of the way towards the spins it took this
+      // time. Racy updates only lose precision.
+      spin_estimate_ptr->store(spin_estimate + (tries - spin_estimate) / 8,
+                               std::memory_order_relaxed);
+      requester->js_atomics_mutex_stats().spun++;
+      return true;
+    }
 
     for (int yields = 0; yields < backoff; yields++) {
       YIELD_PROCESSOR;
@@ -606,10 +650,28 @@ bool JSAtomicsMutex::BackoffTryLock(Isolate* requester,
     }
 
     backoff = std::min(kMaxBackoff, backoff << 1);
-  } while (tries < kSpinCount);
+  } while (tries < spin_count);
+
+  // Spinning was not worth it, so spin for less next time.
+  spin_estimate_ptr->store(spin_estimate - spin_estimate / 8,
+                           std::memory_order_relaxed);
   return false;
 }
 
+// static
+int JSAtomicsMutex::SpinCount(int32_t spin_estimate) {
+  constexpr int kSpinCount = 64;
+  constexpr int kMinSpinCount = 16;
+  constexpr int kMaxSpinCount = 1024;
+
+  if (!v8_flags.js_atomics_mutex_adaptive_spinning) return kSpinCount;
+  return std::min(kMaxSpinCount, 2 * spin_estimate + kMinSpinCount);
+}
+
+int JSAtomicsMutex::SpinCountForTesting() {
+  return SpinCount(AtomicSpinEstimatePtr()->load(std::memory_order_relaxed));
+}
+
 bool JSAtomicsMutex::MaybeEnqueueNode(Isolate* requester,
                                       DirectHandle<JSAtomicsMutex> mutex,
                                       std::atomic<StateT>* state,
@@ -729,6 +791,10 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
                                   DirectHandle<JSAtomicsMutex> mutex,
                                   std::atomic<StateT>* state,
                                   std::optional<base::TimeDelta> timeout) {
+  requester->js_atomics_mutex_stats().contended++;
+  // When the first attempt to park happened, for handing off the lock to
+  // threads that have been waiting for too long.
+  base::TimeTicks wait_start;
   for (;;) {
     // Spin for a little bit to try to acquire the lock, so as to be fast under
     // microcontention.
@@ -740,8 +806,13 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
     // Allocate a waiter queue node on-stack, since this thread is going to
     // sleep and will be blocked anyway.
     SyncWaiterQueueNode this_waiter(requester);
+    if (!timeout && v8_flags.js_atomics_mutex_handoff_threshold_ms >= 0) {
+      if (wait_start.IsNull()) wait_start = base::TimeTicks::Now();
+      this_waiter.EnableLockHandOff(wait_start);
+    }
     if (!MaybeEnqueueNode(requester, mutex, state, &this_waiter)) return true;
 
+    requester->js_atomics_mutex_stats().parked++;
     bool rv;
     // Wait for another thread to release the lock and wake us up.
     if (timeout) {
@@ -761,6 +832,12 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
       // Reload the state pointer after wake up in case of shared GC while
       // blocked.
       state = mutex->AtomicStatePtr();
+      if (this_waiter.lock_handed_off()) {
+        // The unlocking thread kept the lock locked for us.
+        DCHECK(IsLockedField::decode(state->load()));
+        requester->js_atomics_mutex_stats().handed_off++;
+        return true;
+      }
     }
 
     // After wake up we try to acquire the lock again by spinning, as the
@@ -793,12 +870,19 @@ void JSAtomicsMutex::UnlockSlowPath(Isolate* requester,
   WaiterQueueNode* old_head = WaiterQueueNode::Dequeue(&waiter_head);
 
   // Release both the lock and the queue lock, and install the new waiter queue
-  // head.
-  StateT new_state = IsLockedField::update(current_state, false);
+  // head. A waiter that has been waiting for too long is handed the lock
+  // instead, so that it isn't starved by threads that keep acquiring the lock
+  // by spinning.
+  const bool hand_off = old_head->ShouldReceiveLockHandOff();
+  StateT new_state = IsLockedField::update(current_state, hand_off);
   new_state = SetWaiterQueueHead(requester, waiter_head, new_state);
   waiter_queue_lock_guard.set_new_state(new_state);
 
-  old_head->Notify();
+  if (hand_off) {
+    old_head->NotifyWithLockHandOff();
+  } else {
+    old_head->Notify();
+  }
 }
 
 // The lockAsync flow is controlled by a series of promises:
@@ -123,11 +123,12 @@ class JSSynchronizationPrimitive
 // A non-recursive mutex that is exposed to JS.
 //
 // It has the following properties:
-//   - Slim: 12-16 bytes. Lock state is 4 bytes, waiter queue head is 4 bytes
-//     when V8_COMPRESS_POINTERS, and sizeof(void*) otherwise. Owner thread is
-//     an additional 4 bytes.
+//   - Slim: 16-20 bytes. Lock state is 4 bytes, waiter queue head is 4 bytes
+//     when V8_COMPRESS_POINTERS, and sizeof(void*) otherwise. Owner thread and
+//     spin estimate are an additional 4 bytes each.
 //   - Fast when uncontended: a single weak CAS.
-//   - Possibly unfair under contention.
+//   - Possibly unfair under contention, unless
+//     --js-atomics-mutex-handoff-threshold-ms is set.
 //   - Moving GC safe. It uses an index into the shared Isolate's external
 //     pointer table to store a queue of sleeping threads.
 //   - Parks the main thread LocalHeap when the thread is blocked on acquiring
@@ -148,7 +149,8 @@ class JSSynchronizationPrimitive
 //  1. Fast Path. Unlocked+Uncontended(0b000) -> Locked+Uncontended(0b100).
 //  2. Otherwise, slow path.
 //    a. Attempt to acquire the L bit (set current state | 0b100) on the state
-//       using a CAS spin loop bounded to some number of iterations.
+//       using a CAS spin loop bounded to some number of iterations. The bound
+//       adapts to how many iterations recently sufficed to acquire the lock.
 //    b. If L bit cannot be acquired, park the current thread:
 //     i.   Acquire the Q bit (set current state | 0b010) in a spinlock.
 //     ii.  Destructively get the waiter queue head.
@@ -169,6 +171,9 @@ class JSSynchronizationPrimitive
 //    f. If the list is empty, clear the W bit (set current state & ~0b001).
 //    g. Release the Q bit and clear the L bit (set current state & ~0b100).
 //       (The W and Q bits must be set in a single CAS operation).
+//       If the dequeued head has been parked for longer than
+//       --js-atomics-mutex-handoff-threshold-ms, keep the L bit set instead,
+//       handing the lock to the head.
 //    h. If the list was not empty, notify the dequeued head.
 class JSAtomicsMutex
     : public TorqueGeneratedJSAtomicsMutex<JSAtomicsMutex,
@@ -262,6 +267,10 @@ class JSAtomicsMutex
   inline bool IsHeld();
   inline bool IsCurrentThreadOwner();
 
+  // Returns how many times a thread currently spins on the contended mutex
+  // before parking.
+  int SpinCountForTesting();
+
   void UnlockAsyncLockedMutex(
       Isolate* requester, DirectHandle<Foreign> async_locked_waiter_wrapper);
 
@@ -307,6 +316,9 @@ class JSAtomicsMutex
   inline void ClearOwnerThread();
 
   inline std::atomic<int32_t>* AtomicOwnerThreadIdPtr();
+  inline std::atomic<int32_t>* AtomicSpinEstimatePtr();
+
+  static int SpinCount(int32_t spin_estimate);
 
   V8_EXPORT_PRIVATE static bool LockSlowPath(
       Isolate* requester, DirectHandle<JSAtomicsMutex> mutex,
@@ -357,6 +369,10 @@ class JSAtomicsMutex
       JSAtomicsMutex, JSSynchronizationPrimitive>::owner_thread_id;
   using TorqueGeneratedJSAtomicsMutex<
       JSAtomicsMutex, JSSynchronizationPrimitive>::set_owner_thread_id;
+  using TorqueGeneratedJSAtomicsMutex<
+      JSAtomicsMutex, JSSynchronizationPrimitive>::spin_estimate;
+  using TorqueGeneratedJSAtomicsMutex<
+      JSAtomicsMutex, JSSynchronizationPrimitive>::set_spin_estimate;
 };
 
 // A condition variable that is exposed to JS.
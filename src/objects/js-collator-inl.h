@@ -25,6 +25,19 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(JSCollator)
 ACCESSORS(JSCollator, icu_collator, Tagged<Managed<icu::Collator>>,
           kIcuCollatorOffset)
 
+inline void JSCollator::set_compare_strings_options(
+    Intl::CompareStringsOptions compare_strings_options) {
+  DCHECK(CompareStringsOptionsBits::is_valid(compare_strings_options));
+  int hints = flags();
+  hints = CompareStringsOptionsBits::update(hints, compare_strings_options);
+  set_flags(hints);
+}
+
+inline Intl::CompareStringsOptions JSCollator::compare_strings_options()
+    const {
+  return CompareStringsOptionsBits::decode(flags());
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -8,6 +8,8 @@
 
 #include "src/objects/js-collator.h"
 
+#include <optional>
+
 #include "src/execution/isolate.h"
 #include "src/objects/js-collator-inl.h"
 #include "src/objects/js-locale.h"
@@ -271,6 +273,82 @@ void SetCaseFirstOption(icu::Collator* icu_collator, CaseFirst case_first) {
   DCHECK(U_SUCCESS(status));
 }
 
+// Creates the ICU collator for the given locale, with the attributes resolved
+// from the options and the unicode extensions applied. Returns nullptr if ICU
+// fails to create it.
+std::unique_ptr<icu::Collator> CreateICUCollator(
+    const icu::Locale& icu_locale, std::optional<bool> numeric,
+    std::optional<CaseFirst> case_first, Sensitivity sensitivity,
+    std::optional<bool> alternate_shifted) {
+  UErrorCode status = U_ZERO_ERROR;
+  std::unique_ptr<icu::Collator> icu_collator(
+      icu::Collator::createInstance(icu_locale, status));
+  if (U_FAILURE(status) || icu_collator == nullptr) {
+    status = U_ZERO_ERROR;
+    // Remove extensions and try again.
+    icu::Locale no_extension_locale(icu_locale.getBaseName());
+    icu_collator.reset(
+        icu::Collator::createInstance(no_extension_locale, status));
+
+    if (U_FAILURE(status) || icu_collator == nullptr) return nullptr;
+  }
+  DCHECK(U_SUCCESS(status));
+
+  // 22. If relevantExtensionKeys contains "kn", then
+  //     a. Set collator.[[Numeric]] to ! SameValue(r.[[kn]], "true").
+  if (numeric.has_value()) SetNumericOption(icu_collator.get(), *numeric);
+
+  // 23. If relevantExtensionKeys contains "kf", then
+  //     a. Set collator.[[CaseFirst]] to r.[[kf]].
+  if (case_first.has_value()) {
+    SetCaseFirstOption(icu_collator.get(), *case_first);
+  }
+
+  // Normalization is always on, by the spec. We are free to optimize
+  // if the strings are already normalized (but we don't have a way to tell
+  // that right now).
+  icu_collator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
+  DCHECK(U_SUCCESS(status));
+
+  // 26. Set collator.[[Sensitivity]] to sensitivity.
+  switch (sensitivity) {
+    case Sensitivity::kBase:
+      icu_collator->setStrength(icu::Collator::PRIMARY);
+      break;
+    case Sensitivity::kAccent:
+      icu_collator->setStrength(icu::Collator::SECONDARY);
+      break;
+    case Sensitivity::kCase:
+      icu_collator->setStrength(icu::Collator::PRIMARY);
+      status = U_ZERO_ERROR;
+      icu_collator->setAttribute(UCOL_CASE_LEVEL, UCOL_ON, status);
+      DCHECK(U_SUCCESS(status));
+      break;
+    case Sensitivity::kVariant:
+      icu_collator->setStrength(icu::Collator::TERTIARY);
+      break;
+    case Sensitivity::kUndefined:
+      break;
+  }
+
+  // 28. Set collator.[[IgnorePunctuation]] to ignorePunctuation.
+
+  // Note: The following implementation does not strictly follow the spec text
+  // due to https://github.com/tc39/ecma402/issues/832
+  // If the ignorePunctuation is not defined, instead of fall back
+  // to default false, we just depend on ICU to default based on the
+  // built in locale collation rule, which in "th" locale that is true
+  // but false on other locales.
+  if (alternate_shifted.has_value()) {
+    status = U_ZERO_ERROR;
+    icu_collator->setAttribute(
+        UCOL_ALTERNATE_HANDLING,
+        *alternate_shifted ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, status);
+    DCHECK(U_SUCCESS(status));
+  }
+  return icu_collator;
+}
+
 }  // anonymous namespace
 
 // static
@@ -417,63 +495,6 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, DirectHandle<Map> map,
   // here. The collation value can be looked up from icu::Collator on
   // demand, as part of Intl.Collator.prototype.resolvedOptions.
 
-  std::unique_ptr<icu::Collator> icu_collator(
-      icu::Collator::createInstance(icu_locale, status));
-  if (U_FAILURE(status) || icu_collator == nullptr) {
-    status = U_ZERO_ERROR;
-    // Remove extensions and try again.
-    icu::Locale no_extension_locale(icu_locale.getBaseName());
-    icu_collator.reset(
-        icu::Collator::createInstance(no_extension_locale, status));
-
-    if (U_FAILURE(status) || icu_collator == nullptr) {
-      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
-    }
-  }
-  DCHECK(U_SUCCESS(status));
-
-  icu::Locale collator_locale(
-      icu_collator->getLocale(ULOC_VALID_LOCALE, status));
-
-  // 22. If relevantExtensionKeys contains "kn", then
-  //     a. Set collator.[[Numeric]] to ! SameValue(r.[[kn]], "true").
-  //
-  // If the numeric value is passed in through the options object,
-  // then we use it. Otherwise, we check if the numeric value is
-  // passed in through the unicode extensions.
-  status = U_ZERO_ERROR;
-  if (found_numeric.FromJust()) {
-    SetNumericOption(icu_collator.get(), numeric);
-  } else {
-    auto kn_extension_it = r.extensions.find("kn");
-    if (kn_extension_it != r.extensions.end()) {
-      SetNumericOption(icu_collator.get(), (kn_extension_it->second == "true"));
-    }
-  }
-
-  // 23. If relevantExtensionKeys contains "kf", then
-  //     a. Set collator.[[CaseFirst]] to r.[[kf]].
-  //
-  // If the caseFirst value is passed in through the options object,
-  // then we use it. Otherwise, we check if the caseFirst value is
-  // passed in through the unicode extensions.
-  if (case_first != CaseFirst::kUndefined) {
-    SetCaseFirstOption(icu_collator.get(), case_first);
-  } else {
-    auto kf_extension_it = r.extensions.find("kf");
-    if (kf_extension_it != r.extensions.end()) {
-      SetCaseFirstOption(icu_collator.get(),
-                         ToCaseFirst(kf_extension_it->second.c_str()));
-    }
-  }
-
-  // Normalization is always on, by the spec. We are free to optimize
-  // if the strings are already normalized (but we don't have a way to tell
-  // that right now).
-  status = U_ZERO_ERROR;
-  icu_collator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
-  DCHECK(U_SUCCESS(status));
-
   // 24. Let sensitivity be ? GetOption(options, "sensitivity",
   // "string", « "base", "accent", "case", "variant" », undefined).
   Maybe<Sensitivity> maybe_sensitivity =
@@ -493,26 +514,6 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, DirectHandle<Map> map,
       sensitivity = Sensitivity::kVariant;
     }
   }
-  // 26. Set collator.[[Sensitivity]] to sensitivity.
-  switch (sensitivity) {
-    case Sensitivity::kBase:
-      icu_collator->setStrength(icu::Collator::PRIMARY);
-      break;
-    case Sensitivity::kAccent:
-      icu_collator->setStrength(icu::Collator::SECONDARY);
-      break;
-    case Sensitivity::kCase:
-      icu_collator->setStrength(icu::Collator::PRIMARY);
-      status = U_ZERO_ERROR;
-      icu_collator->setAttribute(UCOL_CASE_LEVEL, UCOL_ON, status);
-      DCHECK(U_SUCCESS(status));
-      break;
-    case Sensitivity::kVariant:
-      icu_collator->setStrength(icu::Collator::TERTIARY);
-      break;
-    case Sensitivity::kUndefined:
-      break;
-  }
 
   // 27.Let ignorePunctuation be ? GetOption(options,
   // "ignorePunctuation", "boolean", undefined, false).
@@ -521,22 +522,62 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, DirectHandle<Map> map,
       isolate, options, "ignorePunctuation", service, &ignore_punctuation);
   MAYBE_RETURN(found_ignore_punctuation, MaybeHandle<JSCollator>());
 
-  // 28. Set collator.[[IgnorePunctuation]] to ignorePunctuation.
-
-  // Note: The following implementation does not strictly follow the spec text
-  // due to https://github.com/tc39/ecma402/issues/832
-  // If the ignorePunctuation is not defined, instead of fall back
-  // to default false, we just depend on ICU to default based on the
-  // built in locale collation rule, which in "th" locale that is true
-  // but false on other locales.
+  // If the numeric and caseFirst values are passed in through the options
+  // object, then we use them. Otherwise, we check if they are passed in
+  // through the unicode extensions.
+  std::optional<bool> kn;
+  if (found_numeric.FromJust()) {
+    kn = numeric;
+  } else {
+    auto kn_extension_it = r.extensions.find("kn");
+    if (kn_extension_it != r.extensions.end()) {
+      kn = kn_extension_it->second == "true";
+    }
+  }
+  std::optional<CaseFirst> kf;
+  if (case_first != CaseFirst::kUndefined) {
+    kf = case_first;
+  } else {
+    auto kf_extension_it = r.extensions.find("kf");
+    if (kf_extension_it != r.extensions.end()) {
+      kf = ToCaseFirst(kf_extension_it->second.c_str());
+    }
+  }
+  std::optional<bool> alternate_shifted;
   if (found_ignore_punctuation.FromJust()) {
-    status = U_ZERO_ERROR;
-    icu_collator->setAttribute(
-        UCOL_ALTERNATE_HANDLING,
-        ignore_punctuation ? UCOL_SHIFTED : UCOL_NON_IGNORABLE, status);
-    DCHECK(U_SUCCESS(status));
+    alternate_shifted = ignore_punctuation;
   }
 
+  // The ICU collator only depends on the locale and on the options read
+  // above, so it is shared with the collators created earlier with the same
+  // settings.
+  std::string cache_key = icu_locale.getName();
+  cache_key += kn.has_value() ? (*kn ? "|1" : "|0") : "|-";
+  cache_key += '|';
+  cache_key += kf.has_value() ? static_cast<char>('0' + static_cast<int>(*kf))
+                              : '-';
+  cache_key += '|';
+  cache_key += static_cast<char>('0' + static_cast<int>(sensitivity));
+  cache_key += alternate_shifted.has_value()
+                   ? (*alternate_shifted ? "|1" : "|0")
+                   : "|-";
+  std::shared_ptr<icu::Collator> icu_collator =
+      std::static_pointer_cast<icu::Collator>(isolate->get_cached_icu_formatter(
+          Isolate::ICUFormatterCacheType::kCollator, cache_key));
+  if (!icu_collator) {
+    icu_collator =
+        CreateICUCollator(icu_locale, kn, kf, sensitivity, alternate_shifted);
+    if (!icu_collator) {
+      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+    }
+    isolate->set_icu_formatter_in_cache(
+        Isolate::ICUFormatterCacheType::kCollator, std::move(cache_key),
+        icu_collator);
+  }
+
+  icu::Locale collator_locale(
+      icu_collator->getLocale(ULOC_VALID_LOCALE, status));
+
   DirectHandle<Managed<icu::Collator>> managed_collator =
       Managed<icu::Collator>::From(isolate, 0, std::move(icu_collator));
 
@@ -550,6 +591,13 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, DirectHandle<Map> map,
   DisallowGarbageCollection no_gc;
   collator->set_icu_collator(*managed_collator);
   collator->set_locale(*locale_str);
+  collator->set_flags(0);
+  // Collators for searching and with an explicit collation never take the
+  // fast path.
+  collator->set_compare_strings_options(
+      (usage == Usage::SORT && collation_str == nullptr)
+          ? Intl::CompareStringsOptionsFor(*managed_collator->raw(), r.locale)
+          : Intl::CompareStringsOptions::kNone);
 
   // 29. Return collator.
   return collator;
@@ -48,6 +48,18 @@ class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
 
   DECL_ACCESSORS(icu_collator, Tagged<Managed<icu::Collator>>)
 
+  // Whether comparisons with this collator may take the fast path for ASCII
+  // strings, see Intl::CompareStrings.
+  inline void set_compare_strings_options(
+      Intl::CompareStringsOptions compare_strings_options);
+  inline Intl::CompareStringsOptions compare_strings_options() const;
+
+  // Bit positions in |flags|.
+  DEFINE_TORQUE_GENERATED_JS_COLLATOR_FLAGS()
+
+  static_assert(CompareStringsOptionsBits::is_valid(
+      Intl::CompareStringsOptions::kTryFastPathIgnoringCase));
+
   TQ_OBJECT_CONSTRUCTORS(JSCollator)
 };
 
@@ -2368,7 +2368,20 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::CreateDateTimeFormat(
 
   DateTimeStyle date_style = DateTimeStyle::kUndefined;
   DateTimeStyle time_style = DateTimeStyle::kUndefined;
-  std::unique_ptr<icu::SimpleDateFormat> icu_date_format;
+  std::shared_ptr<icu::SimpleDateFormat> icu_date_format;
+  std::unique_ptr<icu::SimpleDateFormat> new_date_format;
+
+  // The ICU date format only depends on the locale, the time zone of the
+  // calendar and the pattern options below, so it is shared with the formats
+  // created earlier with the same settings. An empty key means that the new
+  // format is not cached.
+  std::string cache_key = icu_locale.getName();
+  {
+    icu::UnicodeString tz_id;
+    calendar->getTimeZone().getID(tz_id);
+    cache_key += '|';
+    tz_id.toUTF8String(cache_key);
+  }
 
   // 35. Let hasExplicitFormatComponents be false.
   int32_t explicit_format_components =
@@ -2499,11 +2512,21 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::CreateDateTimeFormat(
     isolate->CountUsage(
         v8::Isolate::UseCounterFeature::kDateTimeFormatDateTimeStyle);
 
-    icu_date_format =
-        DateTimeStylePattern(date_style, time_style, icu_locale,
-                             dateTimeFormatHourCycle, generator.get());
-    if (icu_date_format.get() == nullptr) {
-      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+    cache_key += "|s";
+    cache_key += static_cast<char>('0' + static_cast<int>(date_style));
+    cache_key += static_cast<char>('0' + static_cast<int>(time_style));
+    cache_key +=
+        static_cast<char>('0' + static_cast<int>(dateTimeFormatHourCycle));
+    icu_date_format = std::static_pointer_cast<icu::SimpleDateFormat>(
+        isolate->get_cached_icu_formatter(
+            Isolate::ICUFormatterCacheType::kSimpleDateFormat, cache_key));
+    if (!icu_date_format) {
+      new_date_format =
+          DateTimeStylePattern(date_style, time_style, icu_locale,
+                               dateTimeFormatHourCycle, generator.get());
+      if (new_date_format.get() == nullptr) {
+        THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+      }
     }
   } else {
     // a. Let needDefaults be *true*.
@@ -2575,24 +2598,44 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::CreateDateTimeFormat(
       // Set dateTimeFormat.[[HourCycle]] to undefined.
       dateTimeFormatHourCycle = HourCycle::kUndefined;
     }
-    icu::UnicodeString skeleton_ustr(skeleton.c_str());
-    icu_date_format = CreateICUDateFormatFromCache(
-        icu_locale, skeleton_ustr, generator.get(), dateTimeFormatHourCycle);
-    if (icu_date_format.get() == nullptr) {
-      // Remove extensions and try again.
-      icu_locale = icu::Locale(icu_locale.getBaseName());
-      icu_date_format = CreateICUDateFormatFromCache(
+    cache_key += "|k";
+    cache_key +=
+        static_cast<char>('0' + static_cast<int>(dateTimeFormatHourCycle));
+    cache_key += skeleton;
+    icu_date_format = std::static_pointer_cast<icu::SimpleDateFormat>(
+        isolate->get_cached_icu_formatter(
+            Isolate::ICUFormatterCacheType::kSimpleDateFormat, cache_key));
+    if (!icu_date_format) {
+      icu::UnicodeString skeleton_ustr(skeleton.c_str());
+      new_date_format = CreateICUDateFormatFromCache(
           icu_locale, skeleton_ustr, generator.get(), dateTimeFormatHourCycle);
-      if (icu_date_format.get() == nullptr) {
-        THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+      if (new_date_format.get() == nullptr) {
+        // Remove extensions and try again. This changes the locale, so the
+        // format is not cached.
+        icu_locale = icu::Locale(icu_locale.getBaseName());
+        cache_key.clear();
+        new_date_format = CreateICUDateFormatFromCache(
+            icu_locale, skeleton_ustr, generator.get(),
+            dateTimeFormatHourCycle);
+        if (new_date_format.get() == nullptr) {
+          THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+        }
       }
     }
   }
 
-  // The creation of Calendar depends on timeZone so we have to put 13 after 17.
-  // Also icu_date_format is not created until here.
-  // 13. Set dateTimeFormat.[[Calendar]] to r.[[ca]].
-  icu_date_format->adoptCalendar(calendar.release());
+  if (new_date_format) {
+    // The creation of Calendar depends on timeZone so we have to put 13 after
+    // 17. Also icu_date_format is not created until here.
+    // 13. Set dateTimeFormat.[[Calendar]] to r.[[ca]].
+    new_date_format->adoptCalendar(calendar.release());
+    icu_date_format = std::move(new_date_format);
+    if (!cache_key.empty()) {
+      isolate->set_icu_formatter_in_cache(
+          Isolate::ICUFormatterCacheType::kSimpleDateFormat,
+          std::move(cache_key), icu_date_format);
+    }
+  }
 
   // 12.1.1 InitializeDateTimeFormat ( dateTimeFormat, locales, options )
   //
@@ -47,6 +47,12 @@ class Boolean;
 // their next() (and return(), if necessary) builtins. E.g., Calling next() on
 // JSIteratorMapHelper would ultimately call Builtin::kIteratorMapHelperNext.
 //
+// The next() builtins return the yielded value, or the hole when the helper is
+// done, and only %IteratorHelperPrototype%.next allocates the iterator result
+// object. Helpers and the reducing methods (toArray, reduce, etc.) that
+// consume another helper with the original next method call its builtin
+// directly, so pipelines of helpers don't allocate per stage.
+//
 // [1] https://tc39.es/ecma262/#sec-generatorresume
 
 // The superclass of all iterator helpers.
@@ -1456,13 +1456,13 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::New(Isolate* isolate,
   // 30. Set numberFormat.[[NegativePattern]] to
   // stylePatterns.[[negativePattern]].
   //
-  icu::number::LocalizedNumberFormatter fmt = settings.locale(icu_locale);
+  std::shared_ptr<icu::number::LocalizedNumberFormatter> fmt =
+      GetOrCreateLocalizedNumberFormatter(isolate, settings, icu_locale);
 
   DirectHandle<Managed<icu::number::LocalizedNumberFormatter>>
       managed_number_formatter =
           Managed<icu::number::LocalizedNumberFormatter>::From(
-              isolate, 0,
-              std::make_shared<icu::number::LocalizedNumberFormatter>(fmt));
+              isolate, 0, std::move(fmt));
 
   // Now all properties are ready, so we can allocate the result object.
   Handle<JSNumberFormat> number_format = Cast<JSNumberFormat>(
@@ -1477,6 +1477,38 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::New(Isolate* isolate,
   return number_format;
 }
 
+// static
+std::shared_ptr<icu::number::LocalizedNumberFormatter>
+JSNumberFormat::GetOrCreateLocalizedNumberFormatter(
+    Isolate* isolate, const icu::number::UnlocalizedNumberFormatter& settings,
+    const icu::Locale& icu_locale) {
+  // The skeleton together with the locale fully describes the formatter, so
+  // formatters created earlier with the same settings are shared. Besides the
+  // construction, this keeps the formatting code ICU compiles for a formatter
+  // after its first few uses.
+  UErrorCode status = U_ZERO_ERROR;
+  icu::UnicodeString skeleton = settings.toSkeleton(status);
+  if (U_FAILURE(status)) {
+    return std::make_shared<icu::number::LocalizedNumberFormatter>(
+        settings.locale(icu_locale));
+  }
+  std::string cache_key = icu_locale.getName();
+  cache_key += '|';
+  skeleton.toUTF8String(cache_key);
+  std::shared_ptr<icu::number::LocalizedNumberFormatter> fmt =
+      std::static_pointer_cast<icu::number::LocalizedNumberFormatter>(
+          isolate->get_cached_icu_formatter(
+              Isolate::ICUFormatterCacheType::kNumberFormat, cache_key));
+  if (!fmt) {
+    fmt = std::make_shared<icu::number::LocalizedNumberFormatter>(
+        settings.locale(icu_locale));
+    isolate->set_icu_formatter_in_cache(
+        Isolate::ICUFormatterCacheType::kNumberFormat, std::move(cache_key),
+        fmt);
+  }
+  return fmt;
+}
+
 namespace {
 
 icu::number::FormattedNumber FormatDecimalString(
@@ -9,6 +9,7 @@
 #ifndef V8_OBJECTS_JS_NUMBER_FORMAT_H_
 #define V8_OBJECTS_JS_NUMBER_FORMAT_H_
 
+#include <memory>
 #include <set>
 #include <string>
 
@@ -107,6 +108,14 @@ class JSNumberFormat
   static const icu::UnicodeString NumberingSystemFromSkeleton(
       const icu::UnicodeString& skeleton);
 
+  // Returns the formatter for the settings in the locale. Formatters are
+  // shared through the isolate's ICU formatter cache, so they must not be
+  // modified.
+  static std::shared_ptr<icu::number::LocalizedNumberFormatter>
+  GetOrCreateLocalizedNumberFormatter(
+      Isolate* isolate, const icu::number::UnlocalizedNumberFormatter& settings,
+      const icu::Locale& icu_locale);
+
   V8_WARN_UNUSED_RESULT static Maybe<icu::number::LocalizedNumberRangeFormatter>
   GetRangeFormatter(
       Isolate* isolate, Tagged<String> locale,
@@ -9,6 +9,7 @@
 
 #include "src/api/api-arguments-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/functional.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/date/date.h"
@@ -4031,6 +4032,108 @@ void JSObject::MigrateSlowToFast(DirectHandle<JSObject> object,
   DCHECK(object->HasFastProperties());
 }
 
+namespace {
+
+// Number of entries of the DictionaryToFastMapCache root, which remembers the
+// maps that read-mostly objects went back to fast properties with.
+constexpr int kDictionaryToFastMapCacheEntries = 64;
+
+int DictionaryToFastMapCacheIndex(Tagged<Map> map) {
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors();
+  size_t hash = map->NumberOfOwnDescriptors();
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    hash = base::hash_combine(hash, descriptors->GetKey(i)->hash());
+  }
+  return static_cast<int>(hash % kDictionaryToFastMapCacheEntries);
+}
+
+// Returns whether an object which was just given the fresh |map| by
+// MigrateSlowToFast can use |cached| instead. Both need the same properties
+// in the same fields. The fields of |cached| may have been generalized since.
+bool CanUseDictionaryToFastMap(Tagged<Map> cached, Tagged<Map> map) {
+  if (cached->is_deprecated()) return false;
+  if (!cached->EquivalentToForNormalization(map, map->elements_kind(),
+                                            map->prototype(),
+                                            KEEP_INOBJECT_PROPERTIES)) {
+    return false;
+  }
+  if (cached->instance_size() != map->instance_size() ||
+      cached->UnusedPropertyFields() != map->UnusedPropertyFields() ||
+      cached->NumberOfOwnDescriptors() != map->NumberOfOwnDescriptors()) {
+    return false;
+  }
+  Tagged<DescriptorArray> cached_descriptors = cached->instance_descriptors();
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors();
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (cached_descriptors->GetKey(i) != descriptors->GetKey(i)) return false;
+    PropertyDetails cached_details = cached_descriptors->GetDetails(i);
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (cached_details.kind() != details.kind() ||
+        cached_details.location() != details.location() ||
+        cached_details.attributes() != details.attributes()) {
+      return false;
+    }
+    if (details.location() == PropertyLocation::kField) {
+      if (cached_details.field_index() != details.field_index()) return false;
+    } else if (cached_descriptors->GetStrongValue(i) !=
+               descriptors->GetStrongValue(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// static
+void JSObject::TryMigrateReadMostlyToFast(Isolate* isolate,
+                                          DirectHandle<JSObject> object) {
+  if (!v8_flags.read_mostly_dictionary_to_fast) return;
+  if (object->HasFastProperties()) return;
+  DirectHandle<Map> old_map(object->map(), isolate);
+  // Prototypes go back to fast mode when they are optimized as such, and
+  // exotic, global, API and non-extensible objects stay in dictionary mode.
+  if (old_map->instance_type() != JS_OBJECT_TYPE ||
+      old_map->is_prototype_map() || old_map->is_access_check_needed() ||
+      old_map->has_named_interceptor() || !old_map->is_extensible()) {
+    return;
+  }
+  int number_of_properties;
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    number_of_properties =
+        object->property_dictionary_swiss()->NumberOfElements();
+  } else {
+    number_of_properties = object->property_dictionary()->NumberOfElements();
+  }
+  if (number_of_properties - old_map->GetInObjectProperties() >
+      v8_flags.max_fast_properties) {
+    return;
+  }
+
+  MigrateSlowToFast(object, 0, "ReadMostly");
+  if (!object->HasFastProperties()) return;
+
+  if (IsUndefined(isolate->heap()->dictionary_to_fast_map_cache(), isolate)) {
+    DirectHandle<WeakFixedArray> cache = isolate->factory()->NewWeakFixedArray(
+        kDictionaryToFastMapCacheEntries, AllocationType::kOld);
+    isolate->heap()->SetDictionaryToFastMapCache(*cache);
+  }
+  DisallowGarbageCollection no_gc;
+  Tagged<Map> new_map = object->map();
+  Tagged<WeakFixedArray> cache =
+      Cast<WeakFixedArray>(isolate->heap()->dictionary_to_fast_map_cache());
+  int index = DictionaryToFastMapCacheIndex(new_map);
+  Tagged<HeapObject> cached;
+  if (cache->get(index).GetHeapObjectIfWeak(&cached) &&
+      CanUseDictionaryToFastMap(Cast<Map>(cached), new_map)) {
+    // The layouts match, so the object can simply switch maps and the fresh
+    // map dies.
+    object->set_map(Cast<Map>(cached), kReleaseStore);
+    return;
+  }
+  cache->set(index, MakeWeak(new_map));
+}
+
 void JSObject::RequireSlowElements(Tagged<NumberDictionary> dictionary) {
   DCHECK_NE(dictionary,
             ReadOnlyRoots(GetIsolate()).empty_slow_element_dictionary());
@@ -5122,6 +5225,7 @@ void InvalidateOnePrototypeValidityCellInternal(Tagged<Map> map) {
   Tagged<PrototypeInfo> prototype_info;
   if (map->TryGetPrototypeInfo(&prototype_info)) {
     prototype_info->set_prototype_chain_enum_cache(Smi::zero());
+    prototype_info->set_dictionary_enum_cache(Smi::zero());
   }
 
   // We may inline accesses to constants stored in dictionary mode prototypes in
@@ -710,6 +710,13 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
                                                   int unused_property_fields,
                                                   const char* reason);
 
+  // Called once many own properties of the dictionary-mode |object| were
+  // loaded without any property being added or deleted in between. Migrates
+  // plain objects back to fast properties, sharing the resulting map with
+  // other objects that went back to fast mode with the same properties.
+  static void TryMigrateReadMostlyToFast(Isolate* isolate,
+                                         DirectHandle<JSObject> object);
+
   // Access property in dictionary mode object at the given dictionary index.
   static Handle<Object> DictionaryPropertyAt(Isolate* isolate,
                                              DirectHandle<JSObject> object,
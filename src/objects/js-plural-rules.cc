@@ -119,18 +119,35 @@ MaybeHandle<JSPluralRules> JSPluralRules::New(Isolate* isolate,
   icu::number::UnlocalizedNumberFormatter settings =
       icu::number::UnlocalizedNumberFormatter().roundingMode(UNUM_ROUND_HALFUP);
 
-  std::unique_ptr<icu::PluralRules> icu_plural_rules;
-  bool success =
-      CreateICUPluralRules(isolate, r.icu_locale, type, &icu_plural_rules);
-  if (!success || icu_plural_rules == nullptr) {
-    // Remove extensions and try again.
-    icu::Locale no_extension_locale(icu_locale.getBaseName());
-    success = CreateICUPluralRules(isolate, no_extension_locale, type,
-                                   &icu_plural_rules);
-    icu_locale = no_extension_locale;
-
-    if (!success || icu_plural_rules == nullptr) {
-      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+  // Plural rules only depend on the locale and the type, so they are shared
+  // with the plural rules created earlier for the same locale and type.
+  std::string cache_key = icu_locale.getName();
+  cache_key += type == Type::ORDINAL ? "|ordinal" : "|cardinal";
+  std::shared_ptr<icu::PluralRules> icu_plural_rules =
+      std::static_pointer_cast<icu::PluralRules>(
+          isolate->get_cached_icu_formatter(
+              Isolate::ICUFormatterCacheType::kPluralRules, cache_key));
+  if (!icu_plural_rules) {
+    std::unique_ptr<icu::PluralRules> new_plural_rules;
+    bool success =
+        CreateICUPluralRules(isolate, r.icu_locale, type, &new_plural_rules);
+    if (success && new_plural_rules != nullptr) {
+      icu_plural_rules = std::move(new_plural_rules);
+      isolate->set_icu_formatter_in_cache(
+          Isolate::ICUFormatterCacheType::kPluralRules, std::move(cache_key),
+          icu_plural_rules);
+    } else {
+      // Remove extensions and try again. The locale also changes for the
+      // number formatter then, so these plural rules are not cached.
+      icu::Locale no_extension_locale(icu_locale.getBaseName());
+      success = CreateICUPluralRules(isolate, no_extension_locale, type,
+                                     &new_plural_rules);
+      icu_locale = no_extension_locale;
+
+      if (!success || new_plural_rules == nullptr) {
+        THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError));
+      }
+      icu_plural_rules = std::move(new_plural_rules);
     }
   }
 
@@ -142,9 +159,6 @@ MaybeHandle<JSPluralRules> JSPluralRules::New(Isolate* isolate,
   settings =
       JSNumberFormat::SetDigitOptionsToFormatter(settings, digit_options);
 
-  icu::number::LocalizedNumberFormatter icu_number_formatter =
-      settings.locale(icu_locale);
-
   DirectHandle<Managed<icu::PluralRules>> managed_plural_rules =
       Managed<icu::PluralRules>::From(isolate, 0, std::move(icu_plural_rules));
 
@@ -152,8 +166,8 @@ MaybeHandle<JSPluralRules> JSPluralRules::New(Isolate* isolate,
       managed_number_formatter =
           Managed<icu::number::LocalizedNumberFormatter>::From(
               isolate, 0,
-              std::make_shared<icu::number::LocalizedNumberFormatter>(
-                  icu_number_formatter));
+              JSNumberFormat::GetOrCreateLocalizedNumberFormatter(
+                  isolate, settings, icu_locale));
 
   // Now all properties are ready, so we can allocate the result object.
   Handle<JSPluralRules> plural_rules = Cast<JSPluralRules>(
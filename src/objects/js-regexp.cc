@@ -4,6 +4,7 @@
 
 #include "src/objects/js-regexp.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/base/strings.h"
@@ -392,13 +393,30 @@ void IrRegExpData::ResetLastTierUpTick() {
   set_ticks_until_tier_up(tier_up_ticks + 1);
 }
 
-void IrRegExpData::TierUpTick() {
+void IrRegExpData::TierUpTick(uint32_t work) {
   int tier_up_ticks = ticks_until_tier_up();
   if (tier_up_ticks == 0) {
     return;
   }
 
-  set_ticks_until_tier_up(tier_up_ticks - 1);
+  int total_work = static_cast<int>(
+      std::min<uint64_t>(static_cast<uint64_t>(tier_up_work()) + work,
+                         Smi::kMaxValue));
+  set_tier_up_work(total_work);
+  if (tier_up_ticks > 1) {
+    set_ticks_until_tier_up(tier_up_ticks - 1);
+    return;
+  }
+
+  // Regexps which only ever run on a few short subjects are cheaper to keep
+  // interpreting than to compile.
+  if (total_work < v8_flags.regexp_tier_up_work) return;
+
+  set_ticks_until_tier_up(0);
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF("JSRegExp data object %p marked for tier-up after %d work\n",
+           reinterpret_cast<void*>(ptr()), total_work);
+  }
 }
 
 void IrRegExpData::MarkTierUpForNextExec() {
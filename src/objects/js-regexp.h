@@ -257,12 +257,18 @@ class IrRegExpData : public RegExpData {
   // Number of captures (without the match itself).
   DECL_INT_ACCESSORS(capture_count)
   DECL_INT_ACCESSORS(ticks_until_tier_up)
+  // The work done by the interpreter so far, see TierUpTick.
+  DECL_INT_ACCESSORS(tier_up_work)
   DECL_INT_ACCESSORS(backtrack_limit)
 
   bool CanTierUp();
   bool MarkedForTierUp();
   void ResetLastTierUpTick();
-  void TierUpTick();
+  // Counts an execution of the bytecode which did {work} backtracks and
+  // character advances. The regexp is marked for tier-up once it has been
+  // executed regexp_tier_up_ticks times and has done at least
+  // regexp_tier_up_work work in total.
+  void TierUpTick(uint32_t work);
   void MarkTierUpForNextExec();
   bool ShouldProduceBytecode();
 
@@ -285,6 +291,7 @@ class IrRegExpData : public RegExpData {
   V(kMaxRegisterCountOffset, kTaggedSize)         \
   V(kCaptureCountOffset, kTaggedSize)             \
   V(kTicksUntilTierUpOffset, kTaggedSize)         \
+  V(kTierUpWorkOffset, kTaggedSize)               \
   V(kBacktrackLimitOffset, kTaggedSize)           \
   V(kHeaderSize, 0)                               \
   V(kSize, 0)
@@ -7,11 +7,13 @@
 #include <optional>
 #include <set>
 
+#include "src/builtins/builtins.h"
 #include "src/common/globals.h"
 #include "src/date/date.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
 #include "src/numbers/conversions-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/js-objects-inl.h"
 #include "src/objects/js-objects.h"
 #include "src/objects/js-temporal-objects-inl.h"
@@ -758,6 +760,70 @@ MaybeHandle<JSTemporalPlainDateTime> CreateTemporalDateTimeDefaultTarget(
                                 calendar);
 }
 
+// Calendar and time zone operations look up and call the methods of the
+// calendar or time zone object, which for the built-in Temporal.Calendar and
+// Temporal.TimeZone objects means entering JavaScript only to call back into
+// C++. After the (observable) lookup, the C++ implementation of a built-in
+// method of the current native context is called directly instead.
+std::optional<Builtin> BuiltinMethodId(Isolate* isolate,
+                                       Tagged<Object> function) {
+  if (!IsJSFunction(function)) return std::nullopt;
+  Tagged<JSFunction> js_function = Cast<JSFunction>(function);
+  if (js_function->native_context() != isolate->raw_native_context()) {
+    return std::nullopt;
+  }
+  Tagged<SharedFunctionInfo> shared = js_function->shared();
+  if (!shared->HasBuiltinId()) return std::nullopt;
+  return shared->builtin_id();
+}
+
+#ifdef V8_INTL_SUPPORT
+#define BUILTIN_CALENDAR_METHOD_INTL_LIST(V) V(Era) V(EraYear)
+#else
+#define BUILTIN_CALENDAR_METHOD_INTL_LIST(V)
+#endif  // V8_INTL_SUPPORT
+
+// Calendar methods which take a single date-like argument.
+#define BUILTIN_CALENDAR_METHOD_LIST(V)                                        \
+  V(Year)                                                                      \
+  V(Month)                                                                     \
+  V(MonthCode)                                                                 \
+  V(Day)                                                                       \
+  V(DayOfWeek)                                                                 \
+  V(DayOfYear)                                                                 \
+  V(WeekOfYear)                                                                \
+  V(DaysInWeek)                                                                \
+  V(DaysInMonth)                                                               \
+  V(DaysInYear)                                                                \
+  V(MonthsInYear)                                                              \
+  V(InLeapYear)                                                                \
+  BUILTIN_CALENDAR_METHOD_INTL_LIST(V)
+
+// Returns the result of {function}(date_like) if {function} is one of the
+// built-in calendar methods above, or nothing if it needs to be called.
+std::optional<MaybeHandle<Object>> CallBuiltinCalendarMethod(
+    Isolate* isolate, Handle<JSReceiver> calendar, Tagged<Object> function,
+    Handle<Object> date_like) {
+  if (!IsJSTemporalCalendar(*calendar)) return std::nullopt;
+  std::optional<Builtin> builtin = BuiltinMethodId(isolate, function);
+  if (!builtin.has_value()) return std::nullopt;
+  DirectHandle<JSTemporalCalendar> temporal_calendar =
+      Cast<JSTemporalCalendar>(calendar);
+  switch (*builtin) {
+#define CASE(Name)                                                             \
+  case Builtin::kTemporalCalendarPrototype##Name:                              \
+    return MaybeHandle<Object>(                                                \
+        JSTemporalCalendar::Name(isolate, temporal_calendar, date_like));
+    BUILTIN_CALENDAR_METHOD_LIST(CASE)
+#undef CASE
+    default:
+      return std::nullopt;
+  }
+}
+
+#undef BUILTIN_CALENDAR_METHOD_LIST
+#undef BUILTIN_CALENDAR_METHOD_INTL_LIST
+
 }  // namespace
 
 namespace temporal {
@@ -2128,6 +2194,27 @@ MaybeHandle<T> FromFields(Isolate* isolate, Handle<JSReceiver> calendar,
     THROW_NEW_ERROR(
         isolate, NewTypeError(MessageTemplate::kCalledNonCallable, property));
   }
+  if (IsJSTemporalCalendar(*calendar)) {
+    std::optional<Builtin> builtin = BuiltinMethodId(isolate, *function);
+    DirectHandle<JSTemporalCalendar> temporal_calendar =
+        Cast<JSTemporalCalendar>(calendar);
+    if constexpr (std::is_same_v<T, JSTemporalPlainDate>) {
+      if (builtin == Builtin::kTemporalCalendarPrototypeDateFromFields) {
+        return JSTemporalCalendar::DateFromFields(isolate, temporal_calendar,
+                                                  fields, options);
+      }
+    } else if constexpr (std::is_same_v<T, JSTemporalPlainYearMonth>) {
+      if (builtin == Builtin::kTemporalCalendarPrototypeYearMonthFromFields) {
+        return JSTemporalCalendar::YearMonthFromFields(
+            isolate, temporal_calendar, fields, options);
+      }
+    } else if constexpr (std::is_same_v<T, JSTemporalPlainMonthDay>) {
+      if (builtin == Builtin::kTemporalCalendarPrototypeMonthDayFromFields) {
+        return JSTemporalCalendar::MonthDayFromFields(
+            isolate, temporal_calendar, fields, options);
+      }
+    }
+  }
   Handle<Object> argv[] = {fields, options};
   Handle<Object> result;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -4098,6 +4185,13 @@ MaybeHandle<JSTemporalPlainDate> CalendarDateAdd(
   DCHECK(IsJSReceiver(*options) || IsUndefined(*options));
 
   // 3. Let addedDate be ? Call(dateAdd, calendar, « date, duration, options »).
+  if (IsJSTemporalCalendar(*calendar) &&
+      BuiltinMethodId(isolate, *date_add) ==
+          Builtin::kTemporalCalendarPrototypeDateAdd) {
+    return JSTemporalCalendar::DateAdd(isolate,
+                                       Cast<JSTemporalCalendar>(calendar),
+                                       date, duration, options);
+  }
   Handle<Object> argv[] = {date, duration, options};
   Handle<Object> added_date;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -4133,6 +4227,13 @@ MaybeHandle<JSTemporalDuration> CalendarDateUntil(
                           isolate->factory()->dateUntil_string()));
   }
   // 3. Let duration be ? Call(dateUntil, calendar, « one, two, options »).
+  if (IsJSTemporalCalendar(*calendar) &&
+      BuiltinMethodId(isolate, *date_until) ==
+          Builtin::kTemporalCalendarPrototypeDateUntil) {
+    return JSTemporalCalendar::DateUntil(isolate,
+                                         Cast<JSTemporalCalendar>(calendar),
+                                         one, two, options);
+  }
   Handle<Object> argv[] = {one, two, options};
   Handle<Object> duration;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -4274,12 +4375,22 @@ Maybe<int64_t> GetOffsetNanosecondsFor(Isolate* isolate,
   Handle<Object> offset_nanoseconds_obj;
   // 3. Let offsetNanoseconds be ? Call(getOffsetNanosecondsFor, timeZone, «
   // instant »).
-  Handle<Object> argv[] = {instant};
-  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-      isolate, offset_nanoseconds_obj,
-      Execution::Call(isolate, get_offset_nanoseconds_for, time_zone_obj, 1,
-                      argv),
-      Nothing<int64_t>());
+  if (IsJSTemporalTimeZone(*time_zone_obj) &&
+      BuiltinMethodId(isolate, *get_offset_nanoseconds_for) ==
+          Builtin::kTemporalTimeZonePrototypeGetOffsetNanosecondsFor) {
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, offset_nanoseconds_obj,
+        JSTemporalTimeZone::GetOffsetNanosecondsFor(
+            isolate, Cast<JSTemporalTimeZone>(time_zone_obj), instant),
+        Nothing<int64_t>());
+  } else {
+    Handle<Object> argv[] = {instant};
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, offset_nanoseconds_obj,
+        Execution::Call(isolate, get_offset_nanoseconds_for, time_zone_obj, 1,
+                        argv),
+        Nothing<int64_t>());
+  }
 
   // 4. If Type(offsetNanoseconds) is not Number, throw a TypeError exception.
   if (!IsNumber(*offset_nanoseconds_obj)) {
@@ -4342,6 +4453,9 @@ MaybeHandle<Object> InvokeCalendarMethod(Isolate* isolate,
     THROW_NEW_ERROR(isolate,
                     NewTypeError(MessageTemplate::kCalledNonCallable, name));
   }
+  std::optional<MaybeHandle<Object>> builtin_result =
+      CallBuiltinCalendarMethod(isolate, calendar, *function, date_like);
+  if (builtin_result.has_value()) return *builtin_result;
   Handle<Object> argv[] = {date_like};
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, result,
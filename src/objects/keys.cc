@@ -61,6 +61,35 @@ static int AddKey(Tagged<Object> key, DirectHandle<FixedArray> combined_keys,
   return 1;
 }
 
+// Like CombineKeys, for dictionary-mode receivers: the prototype chain keys
+// are shadowed by all own properties in the receiver's {dictionary}.
+template <typename Dictionary>
+static Handle<FixedArray> CombineDictionaryKeys(
+    Isolate* isolate, Handle<FixedArray> own_keys,
+    Handle<FixedArray> prototype_chain_keys,
+    DirectHandle<Dictionary> dictionary, bool may_have_elements) {
+  if (dictionary->NumberOfElements() == 0 && !may_have_elements) {
+    return prototype_chain_keys;
+  }
+
+  int prototype_chain_keys_length = prototype_chain_keys->length();
+  int own_keys_length = own_keys.is_null() ? 0 : own_keys->length();
+  Handle<FixedArray> combined_keys = isolate->factory()->NewFixedArray(
+      own_keys_length + prototype_chain_keys_length);
+  if (own_keys_length != 0) {
+    FixedArray::CopyElements(isolate, *combined_keys, 0, *own_keys, 0,
+                             own_keys_length);
+  }
+  int target_keys_length = own_keys_length;
+  for (int i = 0; i < prototype_chain_keys_length; i++) {
+    Handle<Name> key(Cast<Name>(prototype_chain_keys->get(i)), isolate);
+    if (dictionary->FindEntry(isolate, key).is_found()) continue;
+    combined_keys->set(target_keys_length++, *key);
+  }
+  return FixedArray::RightTrimOrEmpty(isolate, combined_keys,
+                                      target_keys_length);
+}
+
 static Handle<FixedArray> CombineKeys(Isolate* isolate,
                                       Handle<FixedArray> own_keys,
                                       Handle<FixedArray> prototype_chain_keys,
@@ -70,6 +99,20 @@ static Handle<FixedArray> CombineKeys(Isolate* isolate,
   if (prototype_chain_keys_length == 0) return own_keys;
 
   Tagged<Map> map = receiver->map();
+  if (map->is_dictionary_map()) {
+    auto object = Cast<JSObject>(receiver);
+    if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+      return CombineDictionaryKeys(
+          isolate, own_keys, prototype_chain_keys,
+          direct_handle(object->property_dictionary_swiss(), isolate),
+          may_have_elements);
+    } else {
+      return CombineDictionaryKeys(
+          isolate, own_keys, prototype_chain_keys,
+          direct_handle(object->property_dictionary(), isolate),
+          may_have_elements);
+    }
+  }
   int nof_descriptors = map->NumberOfOwnDescriptors();
   if (nof_descriptors == 0 && !may_have_elements) return prototype_chain_keys;
 
@@ -664,7 +707,9 @@ bool FastKeyAccumulator::MayHaveElements(Tagged<JSReceiver> receiver) {
 bool FastKeyAccumulator::TryPrototypeInfoCache(Handle<JSReceiver> receiver) {
   if (may_have_elements_ && !only_own_has_simple_elements_) return false;
   Handle<JSObject> object = Cast<JSObject>(receiver);
-  if (!object->HasFastProperties()) return false;
+  // Dictionary-mode receivers combine their own keys with the cached keys of
+  // the prototype chain as well, except for the global object.
+  if (IsJSGlobalObject(*object)) return false;
   if (object->HasNamedInterceptor()) return false;
   if (IsAccessCheckNeeded(*object) &&
       !isolate_->MayAccess(isolate_->native_context(), object)) {
@@ -932,6 +977,46 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(
   return storage;
 }
 
+// Returns the own enumerable string keys of the dictionary-mode {object}.
+// Dictionary-mode objects don't have an enum cache on their map, but the keys
+// of prototypes can be cached on their PrototypeInfo: all changes to a
+// prototype invalidate its PrototypeInfo's caches, like its validity cell.
+// Users of this function have to make sure to never directly leak the cache.
+Handle<FixedArray> GetDictionaryEnumPropertyKeys(
+    Isolate* isolate, DirectHandle<JSObject> object) {
+  DCHECK(!object->HasFastProperties());
+  DCHECK(!IsJSGlobalObject(*object));
+  DirectHandle<Map> map(object->map(), isolate);
+  bool use_cache = map->is_prototype_map() &&
+                   IsJSObjectThatCanBeTrackedAsPrototype(*object);
+  if (use_cache) {
+    Tagged<PrototypeInfo> prototype_info;
+    if (map->TryGetPrototypeInfo(&prototype_info) &&
+        IsFixedArray(prototype_info->dictionary_enum_cache())) {
+      isolate->counters()->enum_cache_hits()->Increment();
+      return handle(Cast<FixedArray>(prototype_info->dictionary_enum_cache()),
+                    isolate);
+    }
+  }
+
+  Handle<FixedArray> keys;
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    keys = GetOwnEnumPropertyDictionaryKeys(
+        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
+        object->property_dictionary_swiss());
+  } else {
+    keys = GetOwnEnumPropertyDictionaryKeys(
+        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
+        object->property_dictionary());
+  }
+  if (use_cache) {
+    isolate->counters()->enum_cache_misses()->Increment();
+    Map::GetOrCreatePrototypeInfo(object, isolate)
+        ->set_dictionary_enum_cache(*keys);
+  }
+  return keys;
+}
+
 // Collect the keys from |dictionary| into |keys|, in ascending chronological
 // order of property creation.
 template <typename Dictionary>
@@ -1176,14 +1261,8 @@ Handle<FixedArray> KeyAccumulator::GetOwnEnumPropertyKeys(
     return GetOwnEnumPropertyDictionaryKeys(
         isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
         Cast<JSGlobalObject>(*object)->global_dictionary(kAcquireLoad));
-  } else if (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
-    return GetOwnEnumPropertyDictionaryKeys(
-        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
-        object->property_dictionary_swiss());
   } else {
-    return GetOwnEnumPropertyDictionaryKeys(
-        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
-        object->property_dictionary());
+    return GetDictionaryEnumPropertyKeys(isolate, object);
   }
 }
 
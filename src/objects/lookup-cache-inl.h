@@ -12,21 +12,23 @@
 namespace v8 {
 namespace internal {
 
-// static
-int DescriptorLookupCache::Hash(Tagged<Map> source, Tagged<Name> name) {
+int DescriptorLookupCache::SetIndex(Tagged<Map> source,
+                                    Tagged<Name> name) const {
   DCHECK(IsUniqueName(name));
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
   uint32_t name_hash = name->hash();
-  return (source_hash ^ name_hash) % kLength;
+  return ((source_hash ^ name_hash) & (sets_ - 1)) * kWays;
 }
 
 int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  // Pointers in the table might be stale, so use SafeEquals.
-  if (key.source.SafeEquals(source) && key.name.SafeEquals(name)) {
-    return results_[index];
+  Entry* set = &entries_[SetIndex(source, name)];
+  for (int way = 0; way < kWays; ++way) {
+    Entry& entry = set[way];
+    // Pointers in the table might be stale, so use SafeEquals.
+    if (entry.source.SafeEquals(source) && entry.name.SafeEquals(name)) {
+      return entry.result;
+    }
   }
   return kAbsent;
 }
@@ -34,11 +36,52 @@ int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
 void DescriptorLookupCache::Update(Tagged<Map> source, Tagged<Name> name,
                                    int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  key.source = source;
-  key.name = name;
-  results_[index] = result;
+  Entry* set = &entries_[SetIndex(source, name)];
+  // Evict the least recently updated entry and insert the new one in front.
+  for (int way = kWays - 1; way > 0; --way) set[way] = set[way - 1];
+  set[0] = {source, name, result};
+}
+
+// static
+int TransitionLookupCache::Index(Tagged<Map> source, Tagged<Name> name) {
+  DCHECK(IsUniqueName(name));
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
+  return (source_hash ^ name->hash()) & (kLength - 1);
+}
+
+// static
+int TransitionLookupCache::DetailsKey(PropertyKind kind,
+                                      PropertyAttributes attributes) {
+  return (static_cast<int>(attributes) << 1) | static_cast<int>(kind);
+}
+
+Tagged<Map> TransitionLookupCache::Lookup(Tagged<Map> source,
+                                          Tagged<Name> name, PropertyKind kind,
+                                          PropertyAttributes attributes) {
+  Entry& entry = entries_[Index(source, name)];
+  // Pointers in the table might be stale, so use SafeEquals.
+  if (entry.source.SafeEquals(source) && entry.name.SafeEquals(name) &&
+      entry.details == DetailsKey(kind, attributes)) {
+    return entry.target;
+  }
+  return Tagged<Map>();
+}
+
+void TransitionLookupCache::Update(Tagged<Map> source, Tagged<Name> name,
+                                   PropertyKind kind,
+                                   PropertyAttributes attributes,
+                                   Tagged<Map> target) {
+  DCHECK(!target.is_null());
+  entries_[Index(source, name)] = {source, name, DetailsKey(kind, attributes),
+                                   target};
+}
+
+void TransitionLookupCache::Invalidate(Tagged<Map> source, Tagged<Name> name) {
+  Entry& entry = entries_[Index(source, name)];
+  if (entry.source.SafeEquals(source) && entry.name.SafeEquals(name)) {
+    entry.source = Tagged<Map>();
+  }
 }
 
 }  // namespace internal
@@ -4,11 +4,33 @@
 
 #include "src/objects/lookup-cache.h"
 
+#include <algorithm>
+
+#include "src/base/bits.h"
+
 namespace v8 {
 namespace internal {
 
+DescriptorLookupCache::DescriptorLookupCache(uint32_t length)
+    : sets_(static_cast<int>(base::bits::RoundUpToPowerOfTwo32(
+          std::max(length, static_cast<uint32_t>(kWays)))) /
+            kWays),
+      entries_(new Entry[sets_ * kWays]) {
+  for (int index = 0; index < sets_ * kWays; index++) {
+    entries_[index] = {Tagged<Map>(), Tagged<Name>(), kAbsent};
+  }
+}
+
 void DescriptorLookupCache::Clear() {
-  for (int index = 0; index < kLength; index++) keys_[index].source = Map();
+  for (int index = 0; index < sets_ * kWays; index++) {
+    entries_[index].source = Tagged<Map>();
+  }
+}
+
+void TransitionLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) {
+    entries_[index] = {Tagged<Map>(), Tagged<Name>(), 0, Tagged<Map>()};
+  }
 }
 
 }  // namespace internal
@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include <memory>
+
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -16,6 +18,10 @@ namespace internal {
 // The cache contains both positive and negative results.
 // Descriptor index equals kNotFound means the property is absent.
 // Cleared at startup and prior to any gc.
+//
+// The cache is set-associative: a (map, name) pair hashes to a set of kWays
+// entries, which are kept in most recently updated order. The number of
+// entries is configured with --descriptor-lookup-cache-size.
 class DescriptorLookupCache {
  public:
   DescriptorLookupCache(const DescriptorLookupCache&) = delete;
@@ -30,31 +36,75 @@ class DescriptorLookupCache {
   // Clear the cache.
   void Clear();
 
+  int length() const { return sets_ * kWays; }
+
   static const int kAbsent = -2;
+  static const int kWays = 4;
 
  private:
-  DescriptorLookupCache() {
-    for (int i = 0; i < kLength; ++i) {
-      keys_[i].source = Tagged<Map>();
-      keys_[i].name = Tagged<Name>();
-      results_[i] = kAbsent;
-    }
-  }
-
-  static inline int Hash(Tagged<Map> source, Tagged<Name> name);
-
-  static const int kLength = 64;
-  struct Key {
+  explicit DescriptorLookupCache(uint32_t length);
+
+  inline int SetIndex(Tagged<Map> source, Tagged<Name> name) const;
+
+  struct Entry {
     Tagged<Map> source;
     Tagged<Name> name;
+    int result;
   };
 
-  Key keys_[kLength];
-  int results_[kLength];
+  const int sets_;
+  std::unique_ptr<Entry[]> entries_;
 
   friend class Isolate;
 };
 
+// Cache for mapping (map, property name, kind, attributes) into the target of
+// the matching transition. Only used for maps with at least kMinTransitions
+// transitions, where searching the TransitionArray gets expensive. Only
+// positive results are cached, since inserting a transition must not leave a
+// stale negative entry behind. Overwritten transitions are invalidated, and
+// the cache is cleared at startup and prior to any gc, like the
+// DescriptorLookupCache.
+class TransitionLookupCache {
+ public:
+  TransitionLookupCache() { Clear(); }
+  TransitionLookupCache(const TransitionLookupCache&) = delete;
+  TransitionLookupCache& operator=(const TransitionLookupCache&) = delete;
+
+  // Lookup the transition target for (map, name, kind, attributes).
+  // If absent, a null map is returned.
+  inline Tagged<Map> Lookup(Tagged<Map> source, Tagged<Name> name,
+                            PropertyKind kind, PropertyAttributes attributes);
+
+  // Update an element in the cache.
+  inline void Update(Tagged<Map> source, Tagged<Name> name, PropertyKind kind,
+                     PropertyAttributes attributes, Tagged<Map> target);
+
+  // Drop all entries for transitions from |source| with |name|.
+  inline void Invalidate(Tagged<Map> source, Tagged<Name> name);
+
+  // Clear the cache.
+  void Clear();
+
+  static const int kMinTransitions = 16;
+
+ private:
+  static const int kLength = 256;
+
+  inline static int Index(Tagged<Map> source, Tagged<Name> name);
+  inline static int DetailsKey(PropertyKind kind,
+                               PropertyAttributes attributes);
+
+  struct Entry {
+    Tagged<Map> source;
+    Tagged<Name> name;
+    int details;
+    Tagged<Map> target;
+  };
+
+  Entry entries_[kLength];
+};
+
 }  // namespace internal
 }  // namespace v8
 
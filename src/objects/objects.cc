@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 #include "src/api/api-arguments-inl.h"
@@ -5530,6 +5531,9 @@ Handle<Derived> Dictionary<Derived, Shape>::DeleteEntry(
          dictionary->DetailsAt(entry).IsConfigurable());
   dictionary->ClearEntry(entry);
   dictionary->ElementRemoved();
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    dictionary->ClearReadCount();
+  }
   return Shrink(isolate, dictionary);
 }
 
@@ -5594,6 +5598,9 @@ Handle<Derived> BaseNameDictionary<Derived, Shape>::Add(
   // Update enumeration index here in order to avoid potential modification of
   // the canonical empty dictionary which lives in read only space.
   dictionary->set_next_enumeration_index(index + 1);
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    dictionary->ClearReadCount();
+  }
   return dictionary;
 }
 
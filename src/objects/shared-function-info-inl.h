@@ -397,6 +397,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, properties_are_final,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
                     private_name_lookup_skips_outer_class,
                     SharedFunctionInfo::PrivateNameLookupSkipsOuterClassBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
+                    bytecode_flush_reuse_level,
+                    SharedFunctionInfo::BytecodeFlushReuseLevelBits)
 
 bool SharedFunctionInfo::optimization_disabled() const {
   return disabled_optimization_reason() != BailoutReason::kNoReason;
@@ -467,6 +470,30 @@ void SharedFunctionInfo::set_age(uint16_t value) {
   RELAXED_WRITE_UINT16_FIELD(*this, kAgeOffset, value);
 }
 
+uint16_t SharedFunctionInfo::BytecodeOldAge() const {
+  if (!v8_flags.adaptive_bytecode_flushing) return v8_flags.bytecode_old_age;
+  return v8_flags.bytecode_old_age << bytecode_flush_reuse_level();
+}
+
+void SharedFunctionInfo::SetAgeAfterBytecodeFlush() {
+  DCHECK(v8_flags.adaptive_bytecode_flushing);
+  set_age(kMaxAge);
+}
+
+bool SharedFunctionInfo::HasAgeAfterBytecodeFlush() const {
+  DCHECK(v8_flags.adaptive_bytecode_flushing);
+  // Ages of compiled functions never get close to kMaxAge when code flushing
+  // is based on the number of GCs.
+  return age() > kMaxAge / 2;
+}
+
+void SharedFunctionInfo::MakeAgeAfterBytecodeFlushOlder() {
+  uint16_t current_age = age();
+  if (current_age > kMaxAge / 2 + 1) {
+    CompareExchangeAge(current_age, current_age - 1);
+  }
+}
+
 uint16_t SharedFunctionInfo::CompareExchangeAge(uint16_t expected_age,
                                                 uint16_t new_age) {
   Address age_addr = address() + kAgeOffset;
@@ -871,10 +871,22 @@ void SharedFunctionInfo::EnsureOldForTesting(Tagged<SharedFunctionInfo> sfi) {
       v8_flags.flush_code_based_on_tab_visibility) {
     sfi->set_age(kMaxAge);
   } else {
-    sfi->set_age(v8_flags.bytecode_old_age);
+    sfi->set_age(sfi->BytecodeOldAge());
   }
 }
 
+void SharedFunctionInfo::UpdateBytecodeFlushReuseLevel() {
+  DCHECK(HasAgeAfterBytecodeFlush());
+  const int gcs_since_flush = kMaxAge - age();
+  uint32_t level = bytecode_flush_reuse_level();
+  if (gcs_since_flush < BytecodeOldAge()) {
+    if (level < kMaxBytecodeFlushReuseLevel) level++;
+  } else if (level > 0) {
+    level--;
+  }
+  set_bytecode_flush_reuse_level(level);
+}
+
 #ifdef DEBUG
 // static
 bool SharedFunctionInfo::UniqueIdsAreUnique(Isolate* isolate) {
@@ -522,6 +522,28 @@ class SharedFunctionInfo
 
   DECL_UINT16_ACCESSORS(age)
 
+  // The age at which the bytecode of this function is old enough to be
+  // flushed when code flushing is based on the number of GCs.
+  inline uint16_t BytecodeOldAge() const;
+
+  // With --adaptive-bytecode-flushing, the age of a function whose bytecode
+  // was flushed is set to kMaxAge and counts down with each full GC until the
+  // function is compiled again.
+  inline void SetAgeAfterBytecodeFlush();
+  inline bool HasAgeAfterBytecodeFlush() const;
+  inline void MakeAgeAfterBytecodeFlushOlder();
+
+  // Updates the bytecode_flush_reuse_level() of a function which is compiled
+  // again after its bytecode was flushed. Functions which are needed again
+  // before their bytecode would have become old get twice as much time until
+  // their next flush, and functions which are needed much later lose the extra
+  // time again.
+  void UpdateBytecodeFlushReuseLevel();
+
+  DECL_PRIMITIVE_ACCESSORS(bytecode_flush_reuse_level, uint32_t)
+  static constexpr uint32_t kMaxBytecodeFlushReuseLevel =
+      BytecodeFlushReuseLevelBits::kMax;
+
   // True if the outer class scope contains a private brand for
   // private instance methods.
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
@@ -74,6 +74,22 @@ inline uintptr_t slow_search(T* array, uintptr_t array_len, uintptr_t index,
   return -1;
 }
 
+// Searches backwards for |search_element| in |array|, starting at index
+// |end| - 1 and going down to index 0. This is used as a fall-back when SIMD
+// are not available, and to process the parts of arrays that SIMD cannot
+// process.
+template <typename T>
+inline uintptr_t slow_search_reverse(T* array, uintptr_t end,
+                                     T search_element) {
+  while (end > 0) {
+    end--;
+    if (array[end] == search_element) {
+      return end;
+    }
+  }
+  return -1;
+}
+
 #ifdef NEON64
 // extract_first_nonzero_index returns the first non-zero index in |v|. |v| is a
 // Neon vector that can be either 32x4 (the return is then 0, 1, 2 or 3) or 64x2
@@ -121,11 +137,44 @@ inline int extract_first_nonzero_index_uint64x2_t(uint64x2_t v) {
   return 2 - vmaxvq_u32(mask);
 }
 
+inline int extract_first_nonzero_index_uint16x8_t(uint16x8_t v) {
+  static constexpr uint16_t kMask[] = {8, 7, 6, 5, 4, 3, 2, 1};
+  uint16x8_t mask = vandq_u16(vld1q_u16(kMask), v);
+  return 8 - vmaxvq_u16(mask);
+}
+
+inline int extract_first_nonzero_index_uint8x16_t(uint8x16_t v) {
+  static constexpr uint8_t kMask[] = {16, 15, 14, 13, 12, 11, 10, 9,
+                                      8,  7,  6,  5,  4,  3,  2,  1};
+  uint8x16_t mask = vandq_u8(vld1q_u8(kMask), v);
+  return 16 - vmaxvq_u8(mask);
+}
+
 inline int32_t reinterpret_vmaxvq_u64(uint64x2_t v) {
   return vmaxvq_u32(vreinterpretq_u32_u64(v));
 }
 #endif
 
+// Defines the is_<type> constants that the vectorized searches dispatch on.
+// Integral types are searched by their bit pattern, so signed types should be
+// passed as their unsigned counterparts.
+#define SIMD_SEARCH_ELEMENT_TYPES(T)                                        \
+  static constexpr bool is_uint8 =                                          \
+      sizeof(T) == sizeof(uint8_t) && std::is_integral<T>::value;           \
+  static constexpr bool is_uint16 =                                         \
+      sizeof(T) == sizeof(uint16_t) && std::is_integral<T>::value;          \
+  static constexpr bool is_uint32 =                                         \
+      sizeof(T) == sizeof(uint32_t) && std::is_integral<T>::value;          \
+  static constexpr bool is_uint64 =                                         \
+      sizeof(T) == sizeof(uint64_t) && std::is_integral<T>::value;          \
+  static constexpr bool is_float =                                          \
+      sizeof(T) == sizeof(float) && std::is_floating_point<T>::value;       \
+  static constexpr bool is_double =                                         \
+      sizeof(T) == sizeof(double) && std::is_floating_point<T>::value;      \
+                                                                            \
+  static_assert(is_uint8 || is_uint16 || is_uint32 || is_uint64 ||          \
+                is_float || is_double);
+
 #define VECTORIZED_LOOP_Neon(type_load, type_eq, set1, cmp, movemask)        \
   {                                                                          \
     constexpr int elems_in_vector = sizeof(type_load) / sizeof(T);           \
@@ -155,20 +204,30 @@ inline int32_t reinterpret_vmaxvq_u64(uint64x2_t v) {
     }                                                                         \
   }
 
+// Walks backwards over |array| one vector at a time, from |end| down to 0. Once
+// a vector contains a match, slow_search_reverse finds its last match.
+#define VECTORIZED_REVERSE_LOOP(type_load, type_eq, set1, cmp, movemask)    \
+  {                                                                         \
+    constexpr uintptr_t elems_in_vector = sizeof(type_load) / sizeof(T);    \
+    type_load search_element_vec = set1(search_element);                    \
+                                                                            \
+    for (; end >= elems_in_vector; end -= elems_in_vector) {                \
+      type_load vector =                                                    \
+          *reinterpret_cast<type_load*>(&array[end - elems_in_vector]);     \
+      type_eq eq = cmp(vector, search_element_vec);                         \
+      if (movemask(eq)) {                                                   \
+        return slow_search_reverse(array, end, search_element);             \
+      }                                                                     \
+    }                                                                       \
+  }
+
 // Uses SIMD to vectorize the search loop. This function should only be called
 // for large-ish arrays. Note that nothing will break if |array_len| is less
 // than vectorization_threshold: things will just be slower than necessary.
 template <typename T>
 inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
                                    uintptr_t index, T search_element) {
-  static constexpr bool is_uint32 =
-      sizeof(T) == sizeof(uint32_t) && std::is_integral<T>::value;
-  static constexpr bool is_uint64 =
-      sizeof(T) == sizeof(uint64_t) && std::is_integral<T>::value;
-  static constexpr bool is_double =
-      sizeof(T) == sizeof(double) && std::is_floating_point<T>::value;
-
-  static_assert(is_uint32 || is_uint64 || is_double);
+  SIMD_SEARCH_ELEMENT_TYPES(T)
 
 #if !(defined(__SSE3__) || defined(NEON64))
   // No SIMD available.
@@ -196,7 +255,22 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 
   // Inserting one of the vectorized loop
 #ifdef __SSE3__
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+#define SET1(x) _mm_set1_epi8(static_cast<char>(x))
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m128i, __m128i, SET1, _mm_cmpeq_epi8,
+                        _mm_movemask_epi8, EXTRACT)
+#undef SET1
+#undef EXTRACT
+  } else if constexpr (is_uint16) {
+#define SET1(x) _mm_set1_epi16(static_cast<int16_t>(x))
+// _mm_movemask_epi8 produces two bits per 16-bit lane.
+#define EXTRACT(x) (base::bits::CountTrailingZeros32(x) / 2)
+    VECTORIZED_LOOP_x86(__m128i, __m128i, SET1, _mm_cmpeq_epi16,
+                        _mm_movemask_epi8, EXTRACT)
+#undef SET1
+#undef EXTRACT
+  } else if constexpr (is_uint32) {
 #define MOVEMASK(x) _mm_movemask_ps(_mm_castsi128_ps(x))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m128i, __m128i, _mm_set1_epi32, _mm_cmpeq_epi32,
@@ -215,15 +289,29 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m128d, __m128d, _mm_set1_pd, _mm_cmpeq_pd,
                         _mm_movemask_pd, EXTRACT)
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m128, __m128, _mm_set1_ps, _mm_cmpeq_ps,
+                        _mm_movemask_ps, EXTRACT)
 #undef EXTRACT
   }
 #elif defined(NEON64)
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+    VECTORIZED_LOOP_Neon(uint8x16_t, uint8x16_t, vdupq_n_u8, vceqq_u8,
+                         vmaxvq_u8)
+  } else if constexpr (is_uint16) {
+    VECTORIZED_LOOP_Neon(uint16x8_t, uint16x8_t, vdupq_n_u16, vceqq_u16,
+                         vmaxvq_u16)
+  } else if constexpr (is_uint32) {
     VECTORIZED_LOOP_Neon(uint32x4_t, uint32x4_t, vdupq_n_u32, vceqq_u32,
                          vmaxvq_u32)
   } else if constexpr (is_uint64) {
     VECTORIZED_LOOP_Neon(uint64x2_t, uint64x2_t, vdupq_n_u64, vceqq_u64,
                          reinterpret_vmaxvq_u64)
+  } else if constexpr (is_float) {
+    VECTORIZED_LOOP_Neon(float32x4_t, uint32x4_t, vdupq_n_f32, vceqq_f32,
+                         vmaxvq_u32)
   } else if constexpr (is_double) {
     VECTORIZED_LOOP_Neon(float64x2_t, uint64x2_t, vdupq_n_f64, vceqq_f64,
                          reinterpret_vmaxvq_u64)
@@ -238,6 +326,82 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
   return slow_search(array, array_len, index, search_element);
 }
 
+// Like fast_search_noavx, but returns the last match before index |end|.
+template <typename T>
+inline uintptr_t fast_search_reverse_noavx(T* array, uintptr_t end,
+                                           T search_element) {
+  SIMD_SEARCH_ELEMENT_TYPES(T)
+
+#if !(defined(__SSE3__) || defined(NEON64))
+  // No SIMD available.
+  return slow_search_reverse(array, end, search_element);
+#endif
+
+  const int target_align = 16;
+
+  // Scalar loop to reach desired alignment
+  for (; end > 0 &&
+         (reinterpret_cast<std::uintptr_t>(&(array[end])) % target_align) != 0;
+       end--) {
+    if (array[end - 1] == search_element) {
+      return end - 1;
+    }
+  }
+
+#ifdef __SSE3__
+  if constexpr (is_uint8) {
+#define SET1(x) _mm_set1_epi8(static_cast<char>(x))
+    VECTORIZED_REVERSE_LOOP(__m128i, __m128i, SET1, _mm_cmpeq_epi8,
+                            _mm_movemask_epi8)
+#undef SET1
+  } else if constexpr (is_uint16) {
+#define SET1(x) _mm_set1_epi16(static_cast<int16_t>(x))
+    VECTORIZED_REVERSE_LOOP(__m128i, __m128i, SET1, _mm_cmpeq_epi16,
+                            _mm_movemask_epi8)
+#undef SET1
+  } else if constexpr (is_uint32) {
+    VECTORIZED_REVERSE_LOOP(__m128i, __m128i, _mm_set1_epi32, _mm_cmpeq_epi32,
+                            _mm_movemask_epi8)
+  } else if constexpr (is_uint64) {
+#define SET1(x) _mm_castsi128_ps(_mm_set1_epi64x(x))
+#define CMP(a, b) _mm_cmpeq_pd(_mm_castps_pd(a), _mm_castps_pd(b))
+    VECTORIZED_REVERSE_LOOP(__m128, __m128d, SET1, CMP, _mm_movemask_pd)
+#undef SET1
+#undef CMP
+  } else if constexpr (is_float) {
+    VECTORIZED_REVERSE_LOOP(__m128, __m128, _mm_set1_ps, _mm_cmpeq_ps,
+                            _mm_movemask_ps)
+  } else if constexpr (is_double) {
+    VECTORIZED_REVERSE_LOOP(__m128d, __m128d, _mm_set1_pd, _mm_cmpeq_pd,
+                            _mm_movemask_pd)
+  }
+#elif defined(NEON64)
+  if constexpr (is_uint8) {
+    VECTORIZED_REVERSE_LOOP(uint8x16_t, uint8x16_t, vdupq_n_u8, vceqq_u8,
+                            vmaxvq_u8)
+  } else if constexpr (is_uint16) {
+    VECTORIZED_REVERSE_LOOP(uint16x8_t, uint16x8_t, vdupq_n_u16, vceqq_u16,
+                            vmaxvq_u16)
+  } else if constexpr (is_uint32) {
+    VECTORIZED_REVERSE_LOOP(uint32x4_t, uint32x4_t, vdupq_n_u32, vceqq_u32,
+                            vmaxvq_u32)
+  } else if constexpr (is_uint64) {
+    VECTORIZED_REVERSE_LOOP(uint64x2_t, uint64x2_t, vdupq_n_u64, vceqq_u64,
+                            reinterpret_vmaxvq_u64)
+  } else if constexpr (is_float) {
+    VECTORIZED_REVERSE_LOOP(float32x4_t, uint32x4_t, vdupq_n_f32, vceqq_f32,
+                            vmaxvq_u32)
+  } else if constexpr (is_double) {
+    VECTORIZED_REVERSE_LOOP(float64x2_t, uint64x2_t, vdupq_n_f64, vceqq_f64,
+                            reinterpret_vmaxvq_u64)
+  }
+#else
+  UNREACHABLE();
+#endif
+
+  return slow_search_reverse(array, end, search_element);
+}
+
 #if defined(_MSC_VER) && defined(__clang__)
 // Generating AVX2 code with Clang on Windows without the /arch:AVX2 flag does
 // not seem possible at the moment.
@@ -258,14 +422,7 @@ template <typename T>
 TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
                                              uintptr_t index,
                                              T search_element) {
-  static constexpr bool is_uint32 =
-      sizeof(T) == sizeof(uint32_t) && std::is_integral<T>::value;
-  static constexpr bool is_uint64 =
-      sizeof(T) == sizeof(uint64_t) && std::is_integral<T>::value;
-  static constexpr bool is_double =
-      sizeof(T) == sizeof(double) && std::is_floating_point<T>::value;
-
-  static_assert(is_uint32 || is_uint64 || is_double);
+  SIMD_SEARCH_ELEMENT_TYPES(T)
 
   const int target_align = 32;
   // Scalar loop to reach desired alignment
@@ -279,7 +436,22 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
   }
 
   // Generating vectorized loop
-  if constexpr (is_uint32) {
+  if constexpr (is_uint8) {
+#define SET1(x) _mm256_set1_epi8(static_cast<char>(x))
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m256i, __m256i, SET1, _mm256_cmpeq_epi8,
+                        _mm256_movemask_epi8, EXTRACT)
+#undef SET1
+#undef EXTRACT
+  } else if constexpr (is_uint16) {
+#define SET1(x) _mm256_set1_epi16(static_cast<int16_t>(x))
+// _mm256_movemask_epi8 produces two bits per 16-bit lane.
+#define EXTRACT(x) (base::bits::CountTrailingZeros32(x) / 2)
+    VECTORIZED_LOOP_x86(__m256i, __m256i, SET1, _mm256_cmpeq_epi16,
+                        _mm256_movemask_epi8, EXTRACT)
+#undef SET1
+#undef EXTRACT
+  } else if constexpr (is_uint32) {
 #define MOVEMASK(x) _mm256_movemask_ps(_mm256_castsi256_ps(x))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
     VECTORIZED_LOOP_x86(__m256i, __m256i, _mm256_set1_epi32, _mm256_cmpeq_epi32,
@@ -299,6 +471,13 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
     VECTORIZED_LOOP_x86(__m256d, __m256d, _mm256_set1_pd, CMP,
                         _mm256_movemask_pd, EXTRACT)
 #undef CMP
+#undef EXTRACT
+  } else if constexpr (is_float) {
+#define CMP(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define EXTRACT(x) base::bits::CountTrailingZeros32(x)
+    VECTORIZED_LOOP_x86(__m256, __m256, _mm256_set1_ps, CMP,
+                        _mm256_movemask_ps, EXTRACT)
+#undef CMP
 #undef EXTRACT
   }
 
@@ -308,6 +487,52 @@ TARGET_AVX2 inline uintptr_t fast_search_avx(T* array, uintptr_t array_len,
   return slow_search(array, array_len, index, search_element);
 }
 
+template <typename T>
+TARGET_AVX2 inline uintptr_t fast_search_reverse_avx(T* array, uintptr_t end,
+                                                     T search_element) {
+  SIMD_SEARCH_ELEMENT_TYPES(T)
+
+  const int target_align = 32;
+  // Scalar loop to reach desired alignment
+  for (; end > 0 &&
+         (reinterpret_cast<std::uintptr_t>(&(array[end])) % target_align) != 0;
+       end--) {
+    if (array[end - 1] == search_element) {
+      return end - 1;
+    }
+  }
+
+  if constexpr (is_uint8) {
+#define SET1(x) _mm256_set1_epi8(static_cast<char>(x))
+    VECTORIZED_REVERSE_LOOP(__m256i, __m256i, SET1, _mm256_cmpeq_epi8,
+                            _mm256_movemask_epi8)
+#undef SET1
+  } else if constexpr (is_uint16) {
+#define SET1(x) _mm256_set1_epi16(static_cast<int16_t>(x))
+    VECTORIZED_REVERSE_LOOP(__m256i, __m256i, SET1, _mm256_cmpeq_epi16,
+                            _mm256_movemask_epi8)
+#undef SET1
+  } else if constexpr (is_uint32) {
+    VECTORIZED_REVERSE_LOOP(__m256i, __m256i, _mm256_set1_epi32,
+                            _mm256_cmpeq_epi32, _mm256_movemask_epi8)
+  } else if constexpr (is_uint64) {
+    VECTORIZED_REVERSE_LOOP(__m256i, __m256i, _mm256_set1_epi64x,
+                            _mm256_cmpeq_epi64, _mm256_movemask_epi8)
+  } else if constexpr (is_float) {
+#define CMP(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+    VECTORIZED_REVERSE_LOOP(__m256, __m256, _mm256_set1_ps, CMP,
+                            _mm256_movemask_ps)
+#undef CMP
+  } else if constexpr (is_double) {
+#define CMP(a, b) _mm256_cmp_pd(a, b, _CMP_EQ_OQ)
+    VECTORIZED_REVERSE_LOOP(__m256d, __m256d, _mm256_set1_pd, CMP,
+                            _mm256_movemask_pd)
+#undef CMP
+  }
+
+  return slow_search_reverse(array, end, search_element);
+}
+
 #undef TARGET_AVX2
 #elif defined(IS_CLANG_WIN)
 template <typename T>
@@ -316,17 +541,29 @@ inline uintptr_t fast_search_avx(T* array, uintptr_t array_len, uintptr_t index,
   // Falling back to SSE version
   return fast_search_noavx(array, array_len, index, search_element);
 }
+template <typename T>
+inline uintptr_t fast_search_reverse_avx(T* array, uintptr_t end,
+                                         T search_element) {
+  // Falling back to SSE version
+  return fast_search_reverse_noavx(array, end, search_element);
+}
 #else
 template <typename T>
 uintptr_t fast_search_avx(T* array, uintptr_t array_len, uintptr_t index,
                           T search_element) {
   UNREACHABLE();
 }
+template <typename T>
+uintptr_t fast_search_reverse_avx(T* array, uintptr_t end, T search_element) {
+  UNREACHABLE();
+}
 #endif  // ifdef __SSE3__
 
 #undef IS_CLANG_WIN
+#undef SIMD_SEARCH_ELEMENT_TYPES
 #undef VECTORIZED_LOOP_Neon
 #undef VECTORIZED_LOOP_x86
+#undef VECTORIZED_REVERSE_LOOP
 
 template <typename T>
 inline uintptr_t search(T* array, uintptr_t array_len, uintptr_t index,
@@ -338,6 +575,15 @@ inline uintptr_t search(T* array, uintptr_t array_len, uintptr_t index,
   }
 }
 
+template <typename T>
+inline uintptr_t search_reverse(T* array, uintptr_t end, T search_element) {
+  if (get_vectorization_kind() == SimdKinds::kAVX2) {
+    return fast_search_reverse_avx(array, end, search_element);
+  } else {
+    return fast_search_reverse_noavx(array, end, search_element);
+  }
+}
+
 enum class ArrayIndexOfIncludesKind { DOUBLE, OBJECTORSMI };
 
 // ArrayIndexOfIncludes only handles cases that can be efficiently
@@ -426,6 +672,29 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+template <typename T>
+uintptr_t TypedArrayIndexOf(T* array, uintptr_t array_len, uintptr_t from_index,
+                            T search_element) {
+  return search<T>(array, array_len, from_index, search_element);
+}
+
+template <typename T>
+uintptr_t TypedArrayLastIndexOf(T* array, uintptr_t from_index,
+                                T search_element) {
+  return search_reverse<T>(array, from_index + 1, search_element);
+}
+
+#define INSTANTIATE_TYPED_ARRAY_SEARCH(T)                                     \
+  template uintptr_t TypedArrayIndexOf<T>(T*, uintptr_t, uintptr_t, T);       \
+  template uintptr_t TypedArrayLastIndexOf<T>(T*, uintptr_t, T);
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint8_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint16_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint32_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(uint64_t)
+INSTANTIATE_TYPED_ARRAY_SEARCH(float)
+INSTANTIATE_TYPED_ARRAY_SEARCH(double)
+#undef INSTANTIATE_TYPED_ARRAY_SEARCH
+
 #ifdef NEON64
 #undef NEON64
 #endif
@@ -20,6 +20,21 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
 
+// Returns the index of the first element of |array| in [|from_index|,
+// |array_len|) which is equal to |search_element|, or -1 if there is none.
+// Integral elements are compared by their bit pattern, so signed types are
+// searched as their unsigned counterparts. Instantiated for uint8_t, uint16_t,
+// uint32_t, uint64_t, float and double.
+template <typename T>
+uintptr_t TypedArrayIndexOf(T* array, uintptr_t array_len, uintptr_t from_index,
+                            T search_element);
+
+// Returns the index of the last element of |array| in [0, |from_index|] which
+// is equal to |search_element|, or -1 if there is none.
+template <typename T>
+uintptr_t TypedArrayLastIndexOf(T* array, uintptr_t from_index,
+                                T search_element);
+
 }  // namespace internal
 }  // namespace v8
 
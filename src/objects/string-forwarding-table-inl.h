@@ -331,7 +331,11 @@ template <typename Func>
 void StringForwardingTable::IterateElements(Func&& callback) {
   if (empty()) return;
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  const uint32_t last_block_index = static_cast<uint32_t>(blocks->size() - 1);
+  // The table may have grown ahead of its size, so the last block in use
+  // is determined by the last index.
+  uint32_t last_index_in_block;
+  const uint32_t last_block_index =
+      BlockForIndex(size() - 1, &last_index_in_block);
   for (uint32_t block_index = 0; block_index < last_block_index;
        ++block_index) {
     Block* block = blocks->LoadBlock(block_index);
@@ -341,7 +345,7 @@ void StringForwardingTable::IterateElements(Func&& callback) {
     }
   }
   // Handle last block separately, as it is not filled to capacity.
-  const uint32_t max_index = IndexInBlock(size() - 1, last_block_index) + 1;
+  const uint32_t max_index = last_index_in_block + 1;
   Block* block = blocks->LoadBlock(last_block_index);
   for (uint32_t index = 0; index < max_index; ++index) {
     Record* rec = block->record(index);
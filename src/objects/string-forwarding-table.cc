@@ -203,6 +203,17 @@ StringForwardingTable::BlockVector* StringForwardingTable::EnsureCapacity(
   return blocks;
 }
 
+StringForwardingTable::BlockVector*
+StringForwardingTable::EnsureCapacityForRecord(uint32_t block_index,
+                                               uint32_t index_in_block) {
+  BlockVector* blocks = EnsureCapacity(block_index);
+  // Exactly one writer claims the record in the middle of the block.
+  if (V8_UNLIKELY(index_in_block == CapacityForBlock(block_index) / 2)) {
+    EnsureCapacity(block_index + 1);
+  }
+  return blocks;
+}
+
 int StringForwardingTable::AddForwardString(Tagged<String> string,
                                             Tagged<String> forward_to) {
   DCHECK_IMPLIES(!v8_flags.always_use_string_forwarding_table,
@@ -213,7 +224,7 @@ int StringForwardingTable::AddForwardString(Tagged<String> string,
   uint32_t index_in_block;
   const uint32_t block_index = BlockForIndex(index, &index_in_block);
 
-  BlockVector* blocks = EnsureCapacity(block_index);
+  BlockVector* blocks = EnsureCapacityForRecord(block_index, index_in_block);
   Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
   block->record(index_in_block)->SetInternalized(string, forward_to);
   return index;
@@ -242,7 +253,7 @@ int StringForwardingTable::AddExternalResourceAndHash(Tagged<String> string,
   uint32_t index_in_block;
   const uint32_t block_index = BlockForIndex(index, &index_in_block);
 
-  BlockVector* blocks = EnsureCapacity(block_index);
+  BlockVector* blocks = EnsureCapacityForRecord(block_index, index_in_block);
   Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
   block->record(index_in_block)
       ->SetExternal(string, resource, is_one_byte, raw_hash);
@@ -358,15 +369,18 @@ void StringForwardingTable::UpdateAfterYoungEvacuation() {
   if (empty()) return;
 
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  const unsigned int last_block_index =
-      static_cast<unsigned int>(blocks->size() - 1);
-  for (unsigned int block_index = 0; block_index < last_block_index;
+  // The table may have grown ahead of its size, so the last block in use
+  // is determined by the last index.
+  uint32_t last_index_in_block;
+  const uint32_t last_block_index =
+      BlockForIndex(size() - 1, &last_index_in_block);
+  for (uint32_t block_index = 0; block_index < last_block_index;
        ++block_index) {
     Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
     block->UpdateAfterYoungEvacuation(isolate_);
   }
   // Handle last block separately, as it is not filled to capacity.
-  const int max_index = IndexInBlock(size() - 1, last_block_index) + 1;
+  const int max_index = static_cast<int>(last_index_in_block) + 1;
   blocks->LoadBlock(last_block_index, kAcquireLoad)
       ->UpdateAfterYoungEvacuation(isolate_, max_index);
 }
@@ -375,15 +389,18 @@ void StringForwardingTable::UpdateAfterFullEvacuation() {
   if (empty()) return;
 
   BlockVector* blocks = blocks_.load(std::memory_order_relaxed);
-  const unsigned int last_block_index =
-      static_cast<unsigned int>(blocks->size() - 1);
-  for (unsigned int block_index = 0; block_index < last_block_index;
+  // The table may have grown ahead of its size, so the last block in use
+  // is determined by the last index.
+  uint32_t last_index_in_block;
+  const uint32_t last_block_index =
+      BlockForIndex(size() - 1, &last_index_in_block);
+  for (uint32_t block_index = 0; block_index < last_block_index;
        ++block_index) {
     Block* block = blocks->LoadBlock(block_index, kAcquireLoad);
     block->UpdateAfterFullEvacuation(isolate_);
   }
   // Handle last block separately, as it is not filled to capacity.
-  const int max_index = IndexInBlock(size() - 1, last_block_index) + 1;
+  const int max_index = static_cast<int>(last_index_in_block) + 1;
   blocks->LoadBlock(last_block_index, kAcquireLoad)
       ->UpdateAfterFullEvacuation(isolate_, max_index);
 }
@@ -87,6 +87,11 @@ class StringForwardingTable {
   // inserted into the BlockVector. The BlockVector itself might grow (to double
   // the capacity).
   BlockVector* EnsureCapacity(uint32_t block);
+  // Ensures that the record at |index_in_block| of |block| exists. Once half
+  // of |block| is used, the next block is added ahead of time, so that
+  // concurrent writers rarely have to wait on |grow_mutex_| while the table
+  // grows.
+  BlockVector* EnsureCapacityForRecord(uint32_t block, uint32_t index_in_block);
 
   Isolate* isolate_;
   std::atomic<BlockVector*> blocks_;
@@ -60,6 +60,31 @@ class StringTable::OffHeapStringHashSet
   }
   void Set(InternalIndex index, Tagged<String> key) { SetKey(index, key); }
 
+  // Adds {key} to the first empty entry of its probe sequence, racing with
+  // the concurrent insertions of other keys. Deleted entries are not reused,
+  // so that the number of deleted elements only changes during resizes and
+  // GCs. The number of elements is accounted for by the caller.
+  void AddConcurrently(PtrComprCageBase cage_base, Tagged<String> key) {
+    uint32_t count = 1;
+    for (InternalIndex entry = FirstProbe(key->hash(), capacity());;
+         entry = NextProbe(entry, count++, capacity())) {
+      OffHeapObjectSlot entry_slot = slot(entry);
+      if (entry_slot.Acquire_Load(cage_base) != empty_element()) continue;
+      entry_slot.Release_CompareAndSwap(empty_element(), key);
+      // Only this thread can be inserting {key}, so finding it in the entry
+      // means that the compare-and-swap succeeded.
+      if (entry_slot.Acquire_Load(cage_base) == key) return;
+    }
+  }
+
+  bool HasSufficientCapacityToAddConcurrently(int concurrently_added_elements) {
+    return HasSufficientCapacityToAdd(
+        capacity(), number_of_elements() + concurrently_added_elements,
+        number_of_deleted_elements(), 1);
+  }
+
+  void ElementsAddedConcurrently(int count) { number_of_elements_ += count; }
+
   void CopyEntryExcludingKeyInto(PtrComprCageBase, InternalIndex,
                                  OffHeapStringHashSet*, InternalIndex) {
     // Do nothing, since the entry size is 1 (just the key).
@@ -106,6 +131,30 @@ class StringTable::Data {
   Data* PreviousData() { return previous_data_.get(); }
   void DropPreviousData() { previous_data_.reset(); }
 
+  // Reserves the capacity for adding one element concurrently with other
+  // insertions, which must all hold the resize mutex shared. Returns false if
+  // the table needs to be resized first.
+  bool TryReserveConcurrentInsertion() {
+    int added = concurrently_added_elements_.load(std::memory_order_relaxed);
+    do {
+      if (!table_.HasSufficientCapacityToAddConcurrently(added)) return false;
+    } while (!concurrently_added_elements_.compare_exchange_weak(
+        added, added + 1, std::memory_order_relaxed));
+    return true;
+  }
+
+  // Accounts the elements added concurrently in the table. Must be called
+  // while holding the resize mutex exclusively, or in a safepoint.
+  void FlushConcurrentInsertions() {
+    table_.ElementsAddedConcurrently(
+        concurrently_added_elements_.exchange(0, std::memory_order_relaxed));
+  }
+
+  int NumberOfElements() const {
+    return table_.number_of_elements() +
+           concurrently_added_elements_.load(std::memory_order_relaxed);
+  }
+
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
@@ -113,6 +162,7 @@ class StringTable::Data {
   explicit Data(int capacity) : table_(capacity) {}
 
   std::unique_ptr<Data> previous_data_;
+  std::atomic<int> concurrently_added_elements_{0};
   OffHeapStringHashSet table_;
 };
 
@@ -142,6 +192,7 @@ std::unique_ptr<StringTable::Data> StringTable::Data::New(int capacity) {
 std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
     PtrComprCageBase cage_base, std::unique_ptr<Data> data, int capacity) {
   std::unique_ptr<Data> new_data(new (capacity) Data(capacity));
+  DCHECK_EQ(data->concurrently_added_elements_.load(), 0);
   data->table_.RehashInto(cage_base, &new_data->table_);
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -171,8 +222,8 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->table().number_of_elements();
+    base::SharedMutexGuard<base::kShared> table_resize_guard(&resize_mutex_);
+    return data_.load(std::memory_order_relaxed)->NumberOfElements();
   }
 }
 
@@ -393,8 +444,8 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //   - Writes to the string table only ever fill empty entries, by atomically
+  //     swapping the empty sentinel for the new string,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -416,6 +467,18 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // and on a miss we take the lock and try to write the entry, with a second
   // read lookup in case the non-locked read missed a write.
   //
+  // Writes are striped, so that internalizing different strings doesn't
+  // serialize threads:
+  //
+  //   - Insertions hold the resize mutex shared, and only resizing the table
+  //     holds it exclusively. Readers never wait for a resize, they keep
+  //     reading the old table, which stays alive until the next GC.
+  //   - Insertions of equal strings hold the same insertion stripe, so the
+  //     second read lookup under the stripe lock sees all earlier insertions
+  //     of an equal string, and at most one copy is added to the table.
+  //   - Insertions of different strings may race for the same empty entry,
+  //     which the compare-and-swap in AddConcurrently resolves.
+  //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
   // re-allocation of the string table on resize. So, we optimistically allocate
@@ -444,33 +507,40 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
-
-    Data* data = EnsureCapacity(isolate, 1);
-    OffHeapStringHashSet& table = data->table();
-
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = table.FindEntryOrInsertionEntry(isolate, key, key->hash());
-
-    Tagged<Object> element = table.GetKey(isolate, entry);
-    if (element == OffHeapStringHashSet::empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.AddAt(isolate, entry, *new_string);
-      return new_string;
-    } else if (element == OffHeapStringHashSet::deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.OverwriteDeletedAt(isolate, entry, *new_string);
-      return new_string;
-    } else {
-      // Return the existing string as a handle.
-      return direct_handle(Cast<String>(element), isolate);
+    base::MutexGuard table_stripe_guard(
+        &insertion_stripes_[key->hash() % kInsertionStripes]);
+
+    for (;;) {
+      {
+        base::SharedMutexGuard<base::kShared> table_resize_guard(
+            &resize_mutex_);
+
+        // The table pointer can only be modified while the resize mutex is
+        // held exclusively.
+        Data* data = data_.load(std::memory_order_relaxed);
+        OffHeapStringHashSet& table = data->table();
+
+        // Check one last time if the key is present in the table, in case it
+        // was added after the check.
+        entry = table.FindEntry(isolate, key, key->hash());
+        if (entry.is_found()) {
+          // Return the existing string as a handle.
+          return direct_handle(Cast<String>(table.GetKey(isolate, entry)),
+                               isolate);
+        }
+
+        if (data->TryReserveConcurrentInsertion()) {
+          DirectHandle<String> new_string = key->GetHandleForInsertion();
+          DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+          table.AddConcurrently(isolate, *new_string);
+          return new_string;
+        }
+      }
+
+      // The table is too full to add the string, so resize it and retry.
+      base::SharedMutexGuard<base::kExclusive> table_resize_guard(
+          &resize_mutex_);
+      EnsureCapacity(isolate, 1);
     }
   }
 }
@@ -496,12 +566,11 @@ template DirectHandle<String> StringTable::LookupKey(
 
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
-
-  // This load can be relaxed as the table pointer can only be modified while
-  // the lock is held.
+  // This call is only allowed while the resize mutex is held exclusively, so
+  // this load can be relaxed as the table pointer can only be modified while
+  // the lock is held, and there are no concurrent insertions.
   Data* data = data_.load(std::memory_order_relaxed);
+  data->FlushConcurrentInsertions();
 
   int new_capacity;
   if (data->table().ShouldResizeToAdd(additional_elements, &new_capacity)) {
@@ -676,7 +745,8 @@ void StringTable::InsertForIsolateDeserialization(
 
   const int length = static_cast<int>(strings.size());
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_resize_guard(
+        &resize_mutex_);
 
     Data* const data = EnsureCapacity(isolate, length);
 
@@ -698,7 +768,8 @@ void StringTable::InsertForIsolateDeserialization(
 void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
   DCHECK_EQ(NumberOfElements(), 0);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_resize_guard(
+        &resize_mutex_);
 
     Data* const data = EnsureCapacity(isolate, 1);
 
@@ -743,7 +814,9 @@ void StringTable::NotifyElementsRemoved(int count) {
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->table().ElementsRemoved(count);
+  Data* data = data_.load(std::memory_order_relaxed);
+  data->FlushConcurrentInsertions();
+  data->table().ElementsRemoved(count);
 }
 
 }  // namespace internal
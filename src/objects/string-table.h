@@ -82,8 +82,8 @@ class V8_EXPORT_PRIVATE StringTable {
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
-  // The following methods must be called either while holding the write lock,
-  // or while in a Heap safepoint.
+  // The following methods must be called either while holding the resize mutex
+  // exclusively, or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
   void DropOldData();
   void NotifyElementsRemoved(int count);
@@ -94,12 +94,20 @@ class V8_EXPORT_PRIVATE StringTable {
   class OffHeapStringHashSet;
   class Data;
 
+  // Stripes serializing insertions of strings with the same hash.
+  static constexpr int kInsertionStripes = 64;
+
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
+  // Insertions hold the resize mutex shared, so that they can proceed in
+  // parallel, and only resizing the table takes it exclusively. The mutex is
+  // mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  mutable base::SharedMutex resize_mutex_;
+  // Insertions of equal strings are serialized by the insertion stripe of
+  // their hash, so that at most one of them is added to the table.
+  base::Mutex insertion_stripes_[kInsertionStripes];
   Isolate* isolate_;
 };
 
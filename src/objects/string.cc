@@ -1242,6 +1242,83 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+void CopyFlatChars(base::uc16* dest, const String::FlatContent& content,
+                   int from, int length) {
+  if (content.IsOneByte()) {
+    CopyChars(dest, content.ToOneByteVector().begin() + from, length);
+  } else {
+    CopyChars(dest, content.ToUC16Vector().begin() + from, length);
+  }
+}
+
+constexpr int kConsSearchBailout = -2;
+
+// Searches {pattern} in the segments of {cons} one at a time. Matches which
+// span segments are found in a window of the last characters before and the
+// first characters of each segment. Returns kConsSearchBailout if {cons} has
+// too many segments for this to be cheaper than flattening it.
+template <typename PatChar>
+int SearchConsString(Isolate* isolate, Tagged<ConsString> cons,
+                     base::Vector<const PatChar> pattern, int start_index,
+                     const DisallowGarbageCollection& no_gc) {
+  const int pattern_length = pattern.length();
+  DCHECK_LE(pattern_length, ConsString::kMaxSearchPatternLength);
+  base::uc16 window[2 * ConsString::kMaxSearchPatternLength];
+  // The number of characters before the current segment in {window}.
+  int tail_length = 0;
+
+  const int first = std::max(0, start_index - (pattern_length - 1));
+  ConsStringIterator iter(cons, first);
+  int offset;
+  Tagged<String> segment = iter.Next(&offset);
+  int segment_start = first - offset;
+  for (int segment_count = 1; !segment.is_null(); segment_count++) {
+    if (segment_count > ConsString::kMaxSearchSegments) {
+      return kConsSearchBailout;
+    }
+    const String::FlatContent content = segment->GetFlatContent(no_gc);
+    const int segment_length = content.length();
+
+    // Matches which start in an earlier segment and end in this one.
+    const int window_start = segment_start - tail_length;
+    const int window_from = std::max(0, start_index - window_start);
+    if (window_from < tail_length) {
+      const int head_length = std::min(segment_length, pattern_length - 1);
+      CopyFlatChars(window + tail_length, content, 0, head_length);
+      int index = SearchString(
+          isolate,
+          base::Vector<const base::uc16>(window, tail_length + head_length),
+          pattern, window_from);
+      if (index >= 0) return window_start + index;
+    }
+
+    // Matches within this segment.
+    const int from = std::max(0, start_index - segment_start);
+    if (from + pattern_length <= segment_length) {
+      int index = SearchString(isolate, content, pattern, from);
+      if (index >= 0) return segment_start + index;
+    }
+
+    // Keep the last {pattern_length - 1} characters for the next segment.
+    const int keep = pattern_length - 1;
+    if (segment_length >= keep) {
+      CopyFlatChars(window, content, segment_length - keep, keep);
+      tail_length = keep;
+    } else {
+      const int drop = std::max(0, tail_length + segment_length - keep);
+      MemMove(window, window + drop, (tail_length - drop) * sizeof(window[0]));
+      tail_length -= drop;
+      CopyFlatChars(window + tail_length, content, 0, segment_length);
+      tail_length += segment_length;
+    }
+
+    segment_start += segment_length;
+    segment = iter.Next(&offset);
+    DCHECK_EQ(0, offset);
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1255,9 +1332,25 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
+  if (IsConsString(*receiver) && !Cast<ConsString>(*receiver)->IsFlat() &&
+      receiver_length >= ConsString::kMinSearchLength &&
+      search_length <= ConsString::kMaxSearchPatternLength) {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    Tagged<ConsString> cons = Cast<ConsString>(*receiver);
+    int index =
+        search_content.IsOneByte()
+            ? SearchConsString(isolate, cons, search_content.ToOneByteVector(),
+                               start_index, no_gc)
+            : SearchConsString(isolate, cons, search_content.ToUC16Vector(),
+                               start_index, no_gc);
+    if (index != kConsSearchBailout) return index;
+  }
+
+  receiver = String::Flatten(isolate, receiver);
+
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent receiver_content = receiver->GetFlatContent(no_gc);
@@ -1274,6 +1367,22 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
                                         start_index);
 }
 
+// static
+bool String::IsSubstringAt(Isolate* isolate, Handle<String> receiver,
+                           Handle<String> search, int start_index) {
+  DCHECK_LE(0, start_index);
+  DCHECK_LE(start_index + search->length(), receiver->length());
+  search = String::Flatten(isolate, search);
+
+  DisallowGarbageCollection no_gc;
+  String::FlatContent search_content = search->GetFlatContent(no_gc);
+  StringCharacterStream stream(*receiver, start_index);
+  for (int i = 0; i < search_content.length(); i++) {
+    if (stream.GetNext() != search_content.Get(i)) return false;
+  }
+  return true;
+}
+
 MaybeHandle<String> String::GetSubstitution(Isolate* isolate, Match* match,
                                             Handle<String> replacement,
                                             int start_index) {
@@ -1294,7 +1403,7 @@ MaybeHandle<String> String::GetSubstitution(Isolate* isolate, Match* match,
     return replacement;
   }
 
-  IncrementalStringBuilder builder(isolate);
+  IncrementalStringBuilder builder(isolate, replacement_length);
 
   if (next_dollar_ix > 0) {
     builder.AppendString(factory->NewSubString(replacement, 0, next_dollar_ix));
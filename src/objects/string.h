@@ -335,6 +335,12 @@ V8_OBJECT class String : public Name {
   static int IndexOf(Isolate* isolate, Handle<String> receiver,
                      Handle<String> search, int start_index);
 
+  // Returns whether {search} occurs in {receiver} at {start_index}, without
+  // flattening {receiver}. Caller must ensure that
+  // 0 <= start_index <= receiver->length() - search->length().
+  static bool IsSubstringAt(Isolate* isolate, Handle<String> receiver,
+                            Handle<String> search, int start_index);
+
   static Tagged<Object> LastIndexOf(Isolate* isolate, Handle<Object> receiver,
                                     Handle<Object> search,
                                     Handle<Object> position);
@@ -939,6 +945,14 @@ V8_OBJECT class ConsString : public String {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Searches in cons strings of at least this length go through the segments
+  // of the string, rather than flattening it first. Only patterns of up to
+  // kMaxSearchPatternLength characters are searched that way, and a string with
+  // more than kMaxSearchSegments segments is flattened after all.
+  static const int kMinSearchLength = 1024;
+  static const int kMaxSearchPatternLength = 64;
+  static const int kMaxSearchSegments = 64;
+
   DECL_VERIFIER(ConsString)
 
  private:
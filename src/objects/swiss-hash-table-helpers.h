@@ -40,9 +40,18 @@
 #error "Bad configuration!"
 #endif
 
+// The NEON implementation needs the across-vector additions of AArch64.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
 // Unlike Abseil, we cannot select SSE purely by host capabilities. When
-// creating a snapshot, the group width must be compatible. The SSE
-// implementation uses a group width of 16, whereas the non-SSE version uses 8.
+// creating a snapshot, the group width must be compatible. The SSE and NEON
+// implementations use a group width of 16, whereas the portable version uses 8.
 // Thus we select the group size based on target capabilities and, if the host
 // does not match, select a polyfill implementation. This means, in supported
 // cross-compiling configurations, we must be able to determine matching target
@@ -56,6 +65,15 @@
 #endif
 #endif
 
+#ifndef V8_SWISS_TABLE_HAVE_NEON_TARGET
+#if V8_TARGET_ARCH_ARM64
+// arm64 always has NEON.
+#define V8_SWISS_TABLE_HAVE_NEON_TARGET 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_TARGET 0
+#endif
+#endif
+
 #if V8_SWISS_TABLE_HAVE_SSE2_HOST
 #include <emmintrin.h>
 #endif
@@ -64,6 +82,10 @@
 #include <tmmintrin.h>
 #endif
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -248,8 +270,43 @@ struct GroupSse2Impl {
 };
 #endif  // V8_SWISS_TABLE_HAVE_SSE2_HOST
 
-// A portable, inefficient version of GroupSse2Impl. This exists so SSE2-less
-// hosts can generate snapshots for SSE2-capable targets.
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// The NEON counterpart to GroupSse2Impl, with the same group width and masks.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 16;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos) {
+    ctrl = vld1q_s8(reinterpret_cast<const int8_t*>(pos));
+  }
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint32_t, kWidth> Match(h2_t hash) const {
+    auto match = vdupq_n_s8(static_cast<int8_t>(hash));
+    return BitMask<uint32_t, kWidth>(MoveMask(vceqq_s8(match, ctrl)));
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint32_t, kWidth> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  int8x16_t ctrl;
+
+ private:
+  // Turns the all-ones or all-zeros lanes of a comparison into one bit per
+  // lane, like _mm_movemask_epi8.
+  static uint32_t MoveMask(uint8x16_t lanes) {
+    static constexpr uint8_t kLaneBits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                              1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(lanes, vld1q_u8(kLaneBits));
+    return vaddv_u8(vget_low_u8(bits)) |
+           (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+  }
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
+// A portable, inefficient version of GroupSse2Impl. This exists so hosts
+// without SSE2 or NEON can generate snapshots for targets that have them.
 struct GroupSse2Polyfill {
   static constexpr size_t kWidth = 16;  // the number of slots per group
 
@@ -323,7 +380,8 @@ struct GroupPortableImpl {
 };
 
 // Determine which Group implementation SwissNameDictionary uses.
-#if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
+#if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG && \
+    V8_SWISS_TABLE_HAVE_SSE2_TARGET
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
 // to use SwissNameDictionary as the dictionary backing store. If we want to use
 // the SIMD version of SwissNameDictionary, that would require us to compile SSE
@@ -353,6 +411,16 @@ using Group = GroupSse2Impl;
 #endif
 using Group = GroupSse2Polyfill;
 #endif
+#elif V8_SWISS_TABLE_HAVE_NEON_TARGET
+// The generated builtins use the same 16 wide SIMD group matching as on
+// ia32/x64, which the host must match when creating the snapshot.
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+using Group = GroupNeonImpl;
+#elif V8_SWISS_TABLE_HAVE_SSE2_HOST
+using Group = GroupSse2Impl;
+#else
+using Group = GroupSse2Polyfill;
+#endif
 #else
 using Group = GroupPortableImpl;
 #endif
@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "src/base/small-vector.h"
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/transitions-inl.h"
 #include "src/utils/utils.h"
@@ -156,6 +157,7 @@ void TransitionsAccessor::InsertHelper(Isolate* isolate, DirectHandle<Map> map,
       base::SharedMutexGuard<base::kExclusive> shared_mutex_guard(
           isolate->full_transition_array_access());
       array->SetRawTarget(index, MakeWeak(*target));
+      isolate->transition_lookup_cache()->Invalidate(*map, *name);
       return;
     }
 
@@ -241,7 +243,23 @@ Tagged<Map> TransitionsAccessor::SearchTransition(
     case kFullTransitionArray: {
       base::SharedMutexGuardIf<base::kShared> scope(
           isolate_->full_transition_array_access(), concurrent_access_);
-      return transitions()->SearchAndGetTarget(kind, name, attributes);
+      Tagged<TransitionArray> array = transitions();
+      // Background threads must not touch the isolate's lookup cache, and
+      // small arrays are searched quickly enough.
+      if (concurrent_access_ ||
+          array->number_of_transitions() <
+              TransitionLookupCache::kMinTransitions) {
+        return array->SearchAndGetTarget(kind, name, attributes);
+      }
+      TransitionLookupCache* cache = isolate_->transition_lookup_cache();
+      Tagged<Map> target = cache->Lookup(map_, name, kind, attributes);
+      if (!target.is_null()) {
+        DCHECK_EQ(target, array->SearchAndGetTarget(kind, name, attributes));
+        return target;
+      }
+      target = array->SearchAndGetTarget(kind, name, attributes);
+      if (!target.is_null()) cache->Update(map_, name, kind, attributes, target);
+      return target;
     }
   }
   UNREACHABLE();
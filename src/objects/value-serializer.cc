@@ -20,6 +20,7 @@
 #include "src/handles/maybe-handles-inl.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/heap/factory.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -186,6 +187,9 @@ enum class SerializationTag : uint8_t {
   kResizableArrayBuffer = '~',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer whose contents the delegate keeps out of band.
+  // contentsID:uint32_t
+  kArrayBufferOutOfBand = 'O',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -319,6 +323,13 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetChunkSize(size_t chunk_size) {
+  DCHECK_NOT_NULL(delegate_);
+  DCHECK_EQ(0, total_size());
+  DCHECK_GT(chunk_size, 0);
+  chunk_size_ = chunk_size;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -386,6 +397,19 @@ void ValueSerializer::WriteBigIntContents(Tagged<BigInt> bigint) {
 }
 
 void ValueSerializer::WriteRawBytes(const void* source, size_t length) {
+  if (V8_UNLIKELY(chunk_size_ != 0 && length >= chunk_size_)) {
+    // Pass large payloads to the delegate directly instead of copying them
+    // into the buffer first.
+    if (out_of_memory_ || FlushChunk().IsNothing()) return;
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    if (!delegate_->WriteChunk(v8_isolate, static_cast<const uint8_t*>(source),
+                               length)) {
+      out_of_memory_ = true;
+      return;
+    }
+    streamed_size_ += length;
+    return;
+  }
   uint8_t* dest;
   if (ReserveRawBytes(length).To(&dest) && length > 0) {
     memcpy(dest, source, length);
@@ -396,8 +420,14 @@ Maybe<uint8_t*> ValueSerializer::ReserveRawBytes(size_t bytes) {
   size_t old_size = buffer_size_;
   size_t new_size = old_size + bytes;
   if (V8_UNLIKELY(new_size > buffer_capacity_)) {
+    if (chunk_size_ != 0 && old_size >= chunk_size_) {
+      // Hand the full chunk to the delegate and reuse the buffer.
+      if (FlushChunk().IsNothing()) return Nothing<uint8_t*>();
+      old_size = 0;
+      new_size = bytes;
+    }
     bool ok;
-    if (!ExpandBuffer(new_size).To(&ok)) {
+    if (new_size > buffer_capacity_ && !ExpandBuffer(new_size).To(&ok)) {
       return Nothing<uint8_t*>();
     }
   }
@@ -405,10 +435,27 @@ Maybe<uint8_t*> ValueSerializer::ReserveRawBytes(size_t bytes) {
   return Just(&buffer_[old_size]);
 }
 
+Maybe<bool> ValueSerializer::FlushChunk() {
+  DCHECK_NE(0, chunk_size_);
+  if (buffer_size_ == 0) return Just(true);
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  if (!delegate_->WriteChunk(v8_isolate, buffer_, buffer_size_)) {
+    out_of_memory_ = true;
+    return Nothing<bool>();
+  }
+  streamed_size_ += buffer_size_;
+  buffer_size_ = 0;
+  return Just(true);
+}
+
 Maybe<bool> ValueSerializer::ExpandBuffer(size_t required_capacity) {
   DCHECK_GT(required_capacity, buffer_capacity_);
   size_t requested_capacity =
       std::max(required_capacity, buffer_capacity_ * 2) + 64;
+  if (chunk_size_ != 0) {
+    // In streaming mode the buffer only needs to hold about one chunk.
+    requested_capacity = std::max(required_capacity, chunk_size_) + 64;
+  }
   size_t provided_capacity = 0;
   void* new_buffer = nullptr;
   if (delegate_) {
@@ -563,7 +610,7 @@ void ValueSerializer::WriteString(Handle<String> string) {
     base::Vector<const base::uc16> chars = flat.ToUC16Vector();
     uint32_t byte_length = chars.length() * sizeof(base::uc16);
     // The existing reading code expects 16-byte strings to be aligned.
-    if ((buffer_size_ + 1 + BytesNeededForVarint(byte_length)) & 1)
+    if ((total_size() + 1 + BytesNeededForVarint(byte_length)) & 1)
       WriteTag(SerializationTag::kPadding);
     WriteTag(SerializationTag::kTwoByteString);
     WriteTwoByteString(chars);
@@ -981,6 +1028,18 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
   }
+  if (delegate_ && !array_buffer->is_resizable_by_js()) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    uint32_t contents_id;
+    Maybe<bool> out_of_band = delegate_->WriteArrayBufferContentsOutOfBand(
+        v8_isolate, Utils::ToLocal(array_buffer), &contents_id);
+    RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+    if (out_of_band.FromJust()) {
+      WriteTag(SerializationTag::kArrayBufferOutOfBand);
+      WriteVarint(contents_id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   if (array_buffer->is_resizable_by_js()) {
     size_t max_byte_length = array_buffer->max_byte_length();
     if (max_byte_length > std::numeric_limits<uint32_t>::max()) {
@@ -1513,6 +1572,10 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectWrapper() {
   // normally, and if it fails, and the version is 13, tries to read the broken
   // format.
   const uint8_t* original_position = position_;
+  ParsePretenuringScope pretenuring_scope(
+      isolate_, ParsePretenuringScope::Kind::kDeserialize,
+      static_cast<size_t>(end_ - position_));
+  allocation_ = pretenuring_scope.allocation();
   suppress_deserialization_errors_ = true;
   MaybeHandle<Object> result = ReadObject();
 
@@ -1529,6 +1592,9 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectWrapper() {
         MessageTemplate::kDataCloneDeserializationError));
   }
 
+  Handle<Object> object;
+  if (result.ToHandle(&object)) pretenuring_scope.SetResult(object);
+  allocation_ = AllocationType::kYoung;
   return result;
 }
 
@@ -1593,16 +1659,20 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kDouble: {
       Maybe<double> number = ReadDouble();
       if (number.IsNothing()) return MaybeHandle<Object>();
+      if (allocation_ == AllocationType::kOld) {
+        return isolate_->factory()->NewNumber<AllocationType::kOld>(
+            number.FromJust());
+      }
       return isolate_->factory()->NewNumber(number.FromJust());
     }
     case SerializationTag::kBigInt:
       return ReadBigInt();
     case SerializationTag::kUtf8String:
-      return ReadUtf8String();
+      return ReadUtf8String(allocation_);
     case SerializationTag::kOneByteString:
-      return ReadOneByteString();
+      return ReadOneByteString(allocation_);
     case SerializationTag::kTwoByteString:
-      return ReadTwoByteString();
+      return ReadTwoByteString(allocation_);
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1641,6 +1711,9 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferOutOfBand: {
+      return ReadOutOfBandJSArrayBuffer();
+    }
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -1747,8 +1820,8 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSObject> object =
-      isolate_->factory()->NewJSObject(isolate_->object_function());
+  Handle<JSObject> object = isolate_->factory()->NewJSObject(
+      isolate_->object_function(), allocation_);
   AddObjectWithID(id, object);
 
   uint32_t num_properties;
@@ -1773,8 +1846,8 @@ MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array =
-      isolate_->factory()->NewJSArray(0, TERMINAL_FAST_ELEMENTS_KIND);
+  Handle<JSArray> array = isolate_->factory()->NewJSArray(
+      0, TERMINAL_FAST_ELEMENTS_KIND, allocation_);
   MAYBE_RETURN(JSArray::SetLength(array, length), MaybeHandle<JSArray>());
   AddObjectWithID(id, array);
 
@@ -1811,7 +1884,8 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   HandleScope scope(isolate_);
   Handle<JSArray> array = isolate_->factory()->NewJSArray(
       HOLEY_ELEMENTS, length, length,
-      ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+      ArrayStorageAllocationMode::INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE,
+      allocation_);
   AddObjectWithID(id, array);
 
   DirectHandle<FixedArray> elements(Cast<FixedArray>(array->elements()),
@@ -2092,6 +2166,24 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  uint32_t contents_id;
+  Local<ArrayBuffer> array_buffer_value;
+  if (!ReadVarint<uint32_t>().To(&contents_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetArrayBufferFromContentsId(
+               reinterpret_cast<v8::Isolate*>(isolate_), contents_id)
+           .ToLocal(&array_buffer_value)) {
+    RETURN_EXCEPTION_IF_EXCEPTION(isolate_);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer = Utils::OpenHandle(*array_buffer_value);
+  if (array_buffer->is_shared()) return MaybeHandle<JSArrayBuffer>();
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     DirectHandle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
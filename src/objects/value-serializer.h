@@ -97,9 +97,20 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Passes the serialized data to Delegate::WriteChunk in chunks of about
+   * |chunk_size| bytes instead of growing a single buffer. Must be called
+   * before anything is written, and only when a Delegate was passed.
+   */
+  void SetChunkSize(size_t chunk_size);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
+  // Passes the buffered data to the delegate in streaming mode.
+  Maybe<bool> FlushChunk();
+  // Offset of the next byte in the whole serialized data.
+  size_t total_size() const { return streamed_size_ + buffer_size_; }
 
   // Writing the wire format.
   void WriteTag(SerializationTag tag);
@@ -175,6 +186,10 @@ class ValueSerializer {
   uint8_t* buffer_ = nullptr;
   size_t buffer_size_ = 0;
   size_t buffer_capacity_ = 0;
+  // In streaming mode, the size of the chunks passed to the delegate, and the
+  // number of bytes passed so far.
+  size_t chunk_size_ = 0;
+  size_t streamed_size_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
   bool out_of_memory_ = false;
@@ -297,6 +312,8 @@ class ValueDeserializer {
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       DirectHandle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   bool ValidateJSArrayBufferViewFlags(
@@ -331,6 +348,8 @@ class ValueDeserializer {
   uint32_t next_id_ = 0;
   bool version_13_broken_data_mode_ = false;
   bool suppress_deserialization_errors_ = false;
+  // Where to allocate the deserialized objects, based on pretenuring feedback.
+  AllocationType allocation_ = AllocationType::kYoung;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
@@ -69,6 +69,12 @@ class V8_NODISCARD WaiterQueueNode {
 
   virtual void Notify() = 0;
 
+  // Whether the unlocking thread should keep a JSAtomicsMutex locked and hand
+  // it over to this waiter, instead of releasing it before notifying.
+  virtual bool ShouldReceiveLockHandOff() { return false; }
+  // Notifies the waiter that it now owns the mutex it was waiting for.
+  virtual void NotifyWithLockHandOff() { UNREACHABLE(); }
+
   // Async cleanup functions.
   virtual bool IsSameIsolateForAsyncCleanup(Isolate* isolate) = 0;
   virtual void CleanupMatchingAsyncWaiters(const DequeueMatcher& matcher) = 0;
@@ -41,6 +41,19 @@ void LiteralBuffer::ExpandBuffer() {
   backing_store_ = new_store;
 }
 
+void LiteralBuffer::AddAsciiChars(base::Vector<const uint16_t> code_units) {
+  int char_size = is_one_byte() ? kOneByteSize : base::kUC16Size;
+  int size = code_units.length() * char_size;
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(backing_store_.begin() + position_, code_units.begin(),
+              code_units.length());
+  } else {
+    MemCopy(backing_store_.begin() + position_, code_units.begin(), size);
+  }
+  position_ += size;
+}
+
 void LiteralBuffer::ConvertToTwoByte() {
   DCHECK(is_one_byte());
   base::Vector<uint8_t> new_store;
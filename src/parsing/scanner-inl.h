@@ -10,6 +10,14 @@
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(_M_X64))
+#define V8_SCANNER_SSE2
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#define V8_SCANNER_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -255,6 +263,177 @@ static constexpr const uint8_t character_scan_flags[128] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// ----------------------------------------------------------------------------
+// Block scanning
+//
+// The helpers below skip whole blocks of buffered code units which the scalar
+// scanning loops would run through without stopping, using SSE2 on x64 and
+// Neon on arm64. The block which contains the stop is left to the scalar
+// loops, so they still see every character they act on.
+
+#if defined(V8_SCANNER_SSE2) || defined(V8_SCANNER_NEON)
+constexpr int kScannerBlockLength = 8;
+
+#ifdef V8_SCANNER_SSE2
+using ScannerBlock = __m128i;
+V8_INLINE ScannerBlock LoadScannerBlock(const uint16_t* cursor) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+}
+V8_INLINE ScannerBlock ScannerBlockEquals(ScannerBlock chars, uint16_t c) {
+  return _mm_cmpeq_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(c)));
+}
+// The bounds must be ASCII, so that the signed comparisons don't pick up code
+// units from 0x8000 on.
+V8_INLINE ScannerBlock ScannerBlockInRange(ScannerBlock chars, uint16_t from,
+                                           uint16_t to) {
+  return _mm_andnot_si128(
+      _mm_cmplt_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(from))),
+      _mm_cmplt_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(to + 1))));
+}
+V8_INLINE ScannerBlock ScannerBlockOr(ScannerBlock a, ScannerBlock b) {
+  return _mm_or_si128(a, b);
+}
+V8_INLINE ScannerBlock ScannerBlockMask(ScannerBlock chars, uint16_t mask) {
+  return _mm_and_si128(chars, _mm_set1_epi16(static_cast<int16_t>(mask)));
+}
+V8_INLINE bool ScannerBlockAny(ScannerBlock lanes) {
+  return _mm_movemask_epi8(lanes) != 0;
+}
+V8_INLINE bool ScannerBlockAll(ScannerBlock lanes) {
+  return _mm_movemask_epi8(lanes) == 0xFFFF;
+}
+#else
+using ScannerBlock = uint16x8_t;
+V8_INLINE ScannerBlock LoadScannerBlock(const uint16_t* cursor) {
+  return vld1q_u16(cursor);
+}
+V8_INLINE ScannerBlock ScannerBlockEquals(ScannerBlock chars, uint16_t c) {
+  return vceqq_u16(chars, vdupq_n_u16(c));
+}
+V8_INLINE ScannerBlock ScannerBlockInRange(ScannerBlock chars, uint16_t from,
+                                           uint16_t to) {
+  return vandq_u16(vcgeq_u16(chars, vdupq_n_u16(from)),
+                   vcleq_u16(chars, vdupq_n_u16(to)));
+}
+V8_INLINE ScannerBlock ScannerBlockOr(ScannerBlock a, ScannerBlock b) {
+  return vorrq_u16(a, b);
+}
+V8_INLINE ScannerBlock ScannerBlockMask(ScannerBlock chars, uint16_t mask) {
+  return vandq_u16(chars, vdupq_n_u16(mask));
+}
+V8_INLINE bool ScannerBlockAny(ScannerBlock lanes) {
+  return vmaxvq_u16(lanes) != 0;
+}
+V8_INLINE bool ScannerBlockAll(ScannerBlock lanes) {
+  return vminvq_u16(lanes) != 0;
+}
+#endif
+
+// Skips blocks which contain none of {stop} and {stops}, nor U+2028 or U+2029
+// if {kStopAtLineSeparators}.
+template <bool kStopAtLineSeparators, typename... Stops>
+V8_INLINE const uint16_t* SkipBlocksWithout(const uint16_t* cursor,
+                                            const uint16_t* end, uint16_t stop,
+                                            Stops... stops) {
+  while (end - cursor >= kScannerBlockLength) {
+    ScannerBlock chars = LoadScannerBlock(cursor);
+    ScannerBlock found = ScannerBlockEquals(chars, stop);
+    ((found = ScannerBlockOr(found, ScannerBlockEquals(chars, stops))), ...);
+    if constexpr (kStopAtLineSeparators) {
+      found = ScannerBlockOr(
+          found, ScannerBlockEquals(ScannerBlockMask(chars, 0xFFFE), 0x2028));
+    }
+    if (ScannerBlockAny(found)) break;
+    cursor += kScannerBlockLength;
+  }
+  return cursor;
+}
+
+// Skips blocks which only contain ' ', '\t', '\n' and '\r'. Sets
+// {line_terminator} if a skipped block contains '\n' or '\r'.
+V8_INLINE const uint16_t* SkipWhitespaceBlocks(const uint16_t* cursor,
+                                               const uint16_t* end,
+                                               bool* line_terminator) {
+  while (end - cursor >= kScannerBlockLength) {
+    ScannerBlock chars = LoadScannerBlock(cursor);
+    ScannerBlock newlines = ScannerBlockOr(ScannerBlockEquals(chars, '\n'),
+                                           ScannerBlockEquals(chars, '\r'));
+    ScannerBlock blanks = ScannerBlockOr(ScannerBlockEquals(chars, ' '),
+                                         ScannerBlockEquals(chars, '\t'));
+    if (!ScannerBlockAll(ScannerBlockOr(blanks, newlines))) break;
+    if (ScannerBlockAny(newlines)) *line_terminator = true;
+    cursor += kScannerBlockLength;
+  }
+  return cursor;
+}
+
+// Skips blocks which only contain ASCII identifier parts. Clears
+// {can_be_keyword} if a skipped block contains anything but 'a' to 'z'.
+V8_INLINE const uint16_t* SkipAsciiIdentifierPartBlocks(const uint16_t* cursor,
+                                                        const uint16_t* end,
+                                                        bool* can_be_keyword) {
+  while (end - cursor >= kScannerBlockLength) {
+    ScannerBlock chars = LoadScannerBlock(cursor);
+    ScannerBlock lowercase = ScannerBlockInRange(chars, 'a', 'z');
+    ScannerBlock parts = ScannerBlockOr(
+        ScannerBlockOr(lowercase, ScannerBlockInRange(chars, 'A', 'Z')),
+        ScannerBlockOr(ScannerBlockInRange(chars, '0', '9'),
+                       ScannerBlockOr(ScannerBlockEquals(chars, '_'),
+                                      ScannerBlockEquals(chars, '$'))));
+    if (!ScannerBlockAll(parts)) break;
+    if (!ScannerBlockAll(lowercase)) *can_be_keyword = false;
+    cursor += kScannerBlockLength;
+  }
+  return cursor;
+}
+
+// Skips blocks which only contain ASCII characters that don't terminate string
+// literals, i.e. none of '"', '\'', '\\', '\n' and '\r'.
+V8_INLINE const uint16_t* SkipAsciiStringBlocks(const uint16_t* cursor,
+                                                const uint16_t* end) {
+  while (end - cursor >= kScannerBlockLength) {
+    ScannerBlock chars = LoadScannerBlock(cursor);
+    ScannerBlock ascii = ScannerBlockEquals(ScannerBlockMask(chars, 0xFF80), 0);
+    ScannerBlock stops = ScannerBlockOr(
+        ScannerBlockOr(ScannerBlockEquals(chars, '"'),
+                       ScannerBlockEquals(chars, '\'')),
+        ScannerBlockOr(ScannerBlockEquals(chars, '\\'),
+                       ScannerBlockOr(ScannerBlockEquals(chars, '\n'),
+                                      ScannerBlockEquals(chars, '\r'))));
+    if (!ScannerBlockAll(ascii) || ScannerBlockAny(stops)) break;
+    cursor += kScannerBlockLength;
+  }
+  return cursor;
+}
+#else
+template <bool kStopAtLineSeparators, typename... Stops>
+V8_INLINE const uint16_t* SkipBlocksWithout(const uint16_t* cursor,
+                                            const uint16_t* end, uint16_t stop,
+                                            Stops... stops) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* SkipWhitespaceBlocks(const uint16_t* cursor,
+                                               const uint16_t* end,
+                                               bool* line_terminator) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* SkipAsciiIdentifierPartBlocks(const uint16_t* cursor,
+                                                        const uint16_t* end,
+                                                        bool* can_be_keyword) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* SkipAsciiStringBlocks(const uint16_t* cursor,
+                                                const uint16_t* end) {
+  return cursor;
+}
+#endif
+
+#undef V8_SCANNER_SSE2
+#undef V8_SCANNER_NEON
+
 inline bool CharCanBeKeyword(base::uc32 c) {
   return static_cast<uint32_t>(c) < arraysize(character_scan_flags) &&
          CanBeKeyword(character_scan_flags[c]);
@@ -277,6 +456,20 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
+      SkipBufferedBlocks([this, &scan_flags](const uint16_t* cursor,
+                                             const uint16_t* end) {
+        bool can_be_keyword = true;
+        const uint16_t* parts_end =
+            SkipAsciiIdentifierPartBlocks(cursor, end, &can_be_keyword);
+        if (parts_end != cursor) {
+          next().literal_chars.AddAsciiChars(base::Vector<const uint16_t>(
+              cursor, static_cast<size_t>(parts_end - cursor)));
+          if (!can_be_keyword) {
+            scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+          }
+        }
+        return parts_end;
+      });
       AdvanceUntil([this, &scan_flags](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
@@ -330,6 +523,12 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
   }
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
+  SkipBufferedBlocks([this](const uint16_t* cursor, const uint16_t* end) {
+    bool line_terminator = false;
+    cursor = SkipWhitespaceBlocks(cursor, end, &line_terminator);
+    if (line_terminator) next().after_line_terminator = true;
+    return cursor;
+  });
   base::uc32 hint = ' ';
   AdvanceUntil([this, &hint](base::uc32 c0) {
     if (V8_LIKELY(c0 == hint)) return false;
@@ -236,6 +236,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
+  SkipBufferedBlocks([](const uint16_t* cursor, const uint16_t* end) {
+    return SkipBlocksWithout<true>(cursor, end, '\n', '\r');
+  });
   AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::kWhitespace;
@@ -315,6 +318,9 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
+      SkipBufferedBlocks([](const uint16_t* cursor, const uint16_t* end) {
+        return SkipBlocksWithout<true>(cursor, end, '*', '\n', '\r');
+      });
       AdvanceUntil([](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
@@ -340,6 +346,9 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
+    SkipBufferedBlocks([](const uint16_t* cursor, const uint16_t* end) {
+      return SkipBlocksWithout<false>(cursor, end, '*');
+    });
     AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
@@ -494,6 +503,14 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
+    SkipBufferedBlocks([this](const uint16_t* cursor, const uint16_t* end) {
+      const uint16_t* chars_end = SkipAsciiStringBlocks(cursor, end);
+      if (chars_end != cursor) {
+        next().literal_chars.AddAsciiChars(base::Vector<const uint16_t>(
+            cursor, static_cast<size_t>(chars_end - cursor)));
+      }
+      return chars_end;
+    });
     AdvanceUntil([this](base::uc32 c0) {
       if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
         if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
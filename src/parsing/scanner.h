@@ -95,6 +95,17 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past the buffered code units skipped by {skip}, which gets the
+  // cursor and the end of the buffer, and returns the new cursor. Doesn't
+  // read further blocks.
+  template <typename FunctionType>
+  V8_INLINE void SkipBuffered(FunctionType skip) {
+    if (V8_LIKELY(buffer_cursor_ < buffer_end_)) {
+      buffer_cursor_ = skip(buffer_cursor_, buffer_end_);
+      DCHECK_LE(buffer_cursor_, buffer_end_);
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -559,6 +570,13 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  // Skips buffered characters after c0_ with one of the block scanning
+  // helpers. Leaves c0_ stale, so it must be followed by AdvanceUntil.
+  template <typename FunctionType>
+  V8_INLINE void SkipBufferedBlocks(FunctionType skip) {
+    source_->SkipBuffered(skip);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
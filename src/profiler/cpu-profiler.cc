@@ -59,9 +59,18 @@ class CpuSampler : public sampler::Sampler {
     }
     // Every bailout up until here resulted in a dropped sample. From now on,
     // the sample is created in the buffer.
-    sample->Init(isolate, regs, TickSample::kIncludeCEntryFrame,
-                 /* update_stats */ true,
-                 /* use_simulator_reg_state */ true, processor_->period());
+    if (v8_flags.cpu_profiler_leaf_only_samples) {
+      // Only record the topmost frame; the symbolizer expands the functions
+      // inlined at its pc from the code entry.
+      sample->Init(isolate, regs, TickSample::kSkipCEntryFrame,
+                   /* update_stats */ true,
+                   /* use_simulator_reg_state */ true, processor_->period(),
+                   /* max_frames_count */ 1);
+    } else {
+      sample->Init(isolate, regs, TickSample::kIncludeCEntryFrame,
+                   /* update_stats */ true,
+                   /* use_simulator_reg_state */ true, processor_->period());
+    }
     if (is_counting_samples_ && !sample->timestamp.IsNull()) {
       if (sample->state == JS) ++js_sample_count_;
       if (sample->state == EXTERNAL) ++external_sample_count_;
@@ -134,6 +143,11 @@ SamplingEventsProcessor::SamplingEventsProcessor(
 #endif  // V8_OS_WIN
 
   sampler_->Start();
+  if (v8_flags.cpu_profiler_per_thread_timer) {
+    // Falls back to signals sent from the profiler thread if the kernel does
+    // not allow the timer.
+    sampler_->StartPerThreadTimer(period_);
+  }
 }
 
 SamplingEventsProcessor::~SamplingEventsProcessor() { sampler_->Stop(); }
@@ -322,8 +336,8 @@ void SamplingEventsProcessor::Run() {
       }
     }
 
-    // Schedule next sample.
-    sampler_->DoSample();
+    // Schedule next sample, unless the kernel already does.
+    if (!sampler_->HasPerThreadTimer()) sampler_->DoSample();
   }
 
   // Process remaining tick events.
@@ -693,6 +707,11 @@ CpuProfile* CpuProfiler::StopProfiling(ProfilerId id) {
   return profile;
 }
 
+CpuProfile* CpuProfiler::TakeSnapshot(ProfilerId id) {
+  if (!is_profiling_) return nullptr;
+  return profiles_->TakeSnapshot(id);
+}
+
 CpuProfile* CpuProfiler::StopProfiling(Tagged<String> title) {
   return StopProfiling(profiles_->GetName(title));
 }
@@ -366,6 +366,9 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(Tagged<String> title);
   CpuProfile* StopProfiling(ProfilerId id);
+  // Moves everything the running profile collected so far into a new finished
+  // profile and restarts the running profile with an empty call tree.
+  CpuProfile* TakeSnapshot(ProfilerId id);
 
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
@@ -4,9 +4,11 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <atomic>
 #include <optional>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/vector.h"
 #include "src/codegen/assembler-inl.h"
@@ -17,6 +19,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -288,6 +291,11 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type, const char* name,
                                   HeapEntry* entry,
                                   HeapSnapshotGenerator* generator,
                                   ReferenceVerification verification) {
+  if (!snapshot_->record_all_edges()) {
+    // Weak edges neither retain objects nor contribute to dominators.
+    if (type == HeapGraphEdge::kWeak) return;
+    name = "";
+  }
   ++children_count_;
   snapshot_->edges().emplace_back(type, name, this, entry);
   VerifyReference(type, entry, generator, verification);
@@ -308,6 +316,10 @@ void HeapEntry::SetNamedAutoIndexReference(HeapGraphEdge::Type type,
                                            StringsStorage* names,
                                            HeapSnapshotGenerator* generator,
                                            ReferenceVerification verification) {
+  if (!snapshot_->record_all_edges()) {
+    SetNamedReference(type, "", child, generator, verification);
+    return;
+  }
   int index = children_count_ + 1;
   const char* name = description
                          ? names->GetFormatted("%d / %s", index, description)
@@ -413,10 +425,12 @@ const char* HeapEntry::TypeAsString() const {
 
 HeapSnapshot::HeapSnapshot(HeapProfiler* profiler,
                            v8::HeapProfiler::HeapSnapshotMode snapshot_mode,
-                           v8::HeapProfiler::NumericsMode numerics_mode)
+                           v8::HeapProfiler::NumericsMode numerics_mode,
+                           v8::HeapProfiler::EdgesMode edges_mode)
     : profiler_(profiler),
       snapshot_mode_(snapshot_mode),
-      numerics_mode_(numerics_mode) {
+      numerics_mode_(numerics_mode),
+      edges_mode_(edges_mode) {
   // It is very important to keep objects that form a heap snapshot
   // as small as possible. Check assumptions about data structure sizes.
   static_assert(kSystemPointerSize != 4 || sizeof(HeapGraphEdge) == 12);
@@ -1871,6 +1885,8 @@ void V8HeapExplorer::ExtractPrototypeInfoReferences(
     HeapEntry* entry, Tagged<PrototypeInfo> info) {
   TagObject(info->prototype_chain_enum_cache(), "(prototype chain enum cache)",
             HeapEntry::kObjectShape);
+  TagObject(info->dictionary_enum_cache(), "(dictionary enum cache)",
+            HeapEntry::kObjectShape);
   TagObject(info->prototype_users(), "(prototype users)",
             HeapEntry::kObjectShape);
 }
@@ -2547,8 +2563,10 @@ void V8HeapExplorer::SetContextReference(HeapEntry* parent_entry,
   HeapEntry* child_entry = GetEntry(child_obj);
   if (child_entry == nullptr) return;
   parent_entry->SetNamedReference(HeapGraphEdge::kContextVariable,
-                                  names_->GetName(reference_name), child_entry,
-                                  generator_);
+                                  snapshot_->record_all_edges()
+                                      ? names_->GetName(reference_name)
+                                      : "",
+                                  child_entry, generator_);
   MarkVisitedField(field_offset);
 }
 
@@ -2599,9 +2617,10 @@ void V8HeapExplorer::SetInternalReference(HeapEntry* parent_entry, int index,
   }
   HeapEntry* child_entry = GetEntry(child_obj);
   DCHECK_NOT_NULL(child_entry);
-  parent_entry->SetNamedReference(HeapGraphEdge::kInternal,
-                                  names_->GetName(index), child_entry,
-                                  generator_);
+  parent_entry->SetNamedReference(
+      HeapGraphEdge::kInternal,
+      snapshot_->record_all_edges() ? names_->GetName(index) : "", child_entry,
+      generator_);
   MarkVisitedField(field_offset);
 }
 
@@ -2642,11 +2661,13 @@ void V8HeapExplorer::SetWeakReference(HeapEntry* parent_entry, int index,
   if (!IsEssentialObject(child_obj)) {
     return;
   }
-  HeapEntry* child_entry = GetEntry(child_obj);
-  DCHECK_NOT_NULL(child_entry);
-  parent_entry->SetNamedReference(HeapGraphEdge::kWeak,
-                                  names_->GetFormatted("%d", index),
-                                  child_entry, generator_);
+  if (snapshot_->record_all_edges()) {
+    HeapEntry* child_entry = GetEntry(child_obj);
+    DCHECK_NOT_NULL(child_entry);
+    parent_entry->SetNamedReference(HeapGraphEdge::kWeak,
+                                    names_->GetFormatted("%d", index),
+                                    child_entry, generator_);
+  }
   if (field_offset.has_value()) {
     MarkVisitedField(*field_offset);
   }
@@ -2676,14 +2697,16 @@ void V8HeapExplorer::SetPropertyReference(HeapEntry* parent_entry,
       IsSymbol(reference_name) || Cast<String>(reference_name)->length() > 0
           ? HeapGraphEdge::kProperty
           : HeapGraphEdge::kInternal;
-  const char* name =
-      name_format_string != nullptr && IsString(reference_name)
-          ? names_->GetFormatted(
-                name_format_string,
-                Cast<String>(reference_name)
-                    ->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL)
-                    .get())
-          : names_->GetName(reference_name);
+  const char* name = "";
+  if (snapshot_->record_all_edges()) {
+    name = name_format_string != nullptr && IsString(reference_name)
+               ? names_->GetFormatted(
+                     name_format_string,
+                     Cast<String>(reference_name)
+                         ->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL)
+                         .get())
+               : names_->GetName(reference_name);
+  }
 
   parent_entry->SetNamedReference(type, name, child_entry, generator_);
   MarkVisitedField(field_offset);
@@ -3736,4 +3759,173 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+namespace {
+
+// Magic bytes at the start of a binary snapshot, followed by the version.
+constexpr char kBinarySnapshotMagic[] = {'V', '8', 'H', 'S'};
+constexpr uint32_t kBinarySnapshotVersion = 1;
+
+void WriteVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+// Returns false if the embedder aborted serialization.
+bool WriteToStream(v8::OutputStream* stream, const std::string& data) {
+  const size_t chunk_size = static_cast<size_t>(stream->GetChunkSize());
+  for (size_t pos = 0; pos < data.size(); pos += chunk_size) {
+    int size = static_cast<int>(std::min(chunk_size, data.size() - pos));
+    if (stream->WriteAsciiChunk(const_cast<char*>(&data[pos]), size) ==
+        v8::OutputStream::kAbort) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// Encodes the node chunks followed by the edge chunks, each one into its own
+// buffer, so that the output doesn't depend on which worker encoded what.
+class HeapSnapshotBinarySerializer::EncodeJob final : public JobTask {
+ public:
+  EncodeJob(const HeapSnapshotBinarySerializer* serializer, size_t node_chunks,
+            std::vector<std::string>* chunks)
+      : serializer_(serializer), node_chunks_(node_chunks), chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    const size_t node_count = serializer_->node_name_ids_.size();
+    const size_t edge_count = serializer_->edge_names_or_indices_.size();
+    while (!delegate->ShouldYield()) {
+      const size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunks_->size()) return;
+      std::string* out = &(*chunks_)[chunk];
+      if (chunk < node_chunks_) {
+        const size_t begin = chunk * kItemsPerChunk;
+        serializer_->EncodeNodes(
+            begin, std::min(begin + kItemsPerChunk, node_count), out);
+      } else {
+        const size_t begin = (chunk - node_chunks_) * kItemsPerChunk;
+        serializer_->EncodeEdges(
+            begin, std::min(begin + kItemsPerChunk, edge_count), out);
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk < chunks_->size() ? chunks_->size() - next_chunk : 0;
+  }
+
+ private:
+  const HeapSnapshotBinarySerializer* const serializer_;
+  const size_t node_chunks_;
+  std::vector<std::string>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  DCHECK_EQ(0, snapshot_->root()->index());
+
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  node_name_ids_.reserve(entries.size());
+  for (const HeapEntry& entry : entries) {
+    node_name_ids_.push_back(GetStringId(entry.name()));
+  }
+  edge_names_or_indices_.reserve(edges.size());
+  for (const HeapGraphEdge* edge : edges) {
+    edge_names_or_indices_.push_back(
+        edge->type() == HeapGraphEdge::kElement ||
+                edge->type() == HeapGraphEdge::kHidden
+            ? static_cast<uint32_t>(edge->index())
+            : GetStringId(edge->name()));
+  }
+
+  const size_t node_chunks =
+      (entries.size() + kItemsPerChunk - 1) / kItemsPerChunk;
+  const size_t edge_chunks =
+      (edges.size() + kItemsPerChunk - 1) / kItemsPerChunk;
+  std::vector<std::string> chunks(node_chunks + edge_chunks);
+  V8::GetCurrentPlatform()
+      ->CreateJob(TaskPriority::kUserBlocking,
+                  std::make_unique<EncodeJob>(this, node_chunks, &chunks))
+      ->Join();
+
+  std::string header(kBinarySnapshotMagic, sizeof(kBinarySnapshotMagic));
+  WriteVarint(kBinarySnapshotVersion, &header);
+  WriteVarint(entries.size(), &header);
+  WriteVarint(edges.size(), &header);
+  WriteVarint(strings_.size(), &header);
+  for (const char* string : strings_) {
+    const size_t length = strlen(string);
+    WriteVarint(length, &header);
+    header.append(string, length);
+  }
+  if (!WriteToStream(stream, header)) return;
+  for (const std::string& chunk : chunks) {
+    if (!WriteToStream(stream, chunk)) return;
+  }
+  std::string locations;
+  EncodeLocations(&locations);
+  if (!WriteToStream(stream, locations)) return;
+  stream->EndOfStream();
+
+  if (i::v8_flags.profile_heap_snapshot) {
+    base::OS::PrintError(
+        "[Binary serialization of heap snapshot took %0.3f ms]\n",
+        timer.Elapsed().InMillisecondsF());
+  }
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto [it, was_inserted] =
+      string_ids_.emplace(s, static_cast<uint32_t>(strings_.size()));
+  if (was_inserted) strings_.push_back(s);
+  return it->second;
+}
+
+void HeapSnapshotBinarySerializer::EncodeNodes(size_t begin, size_t end,
+                                               std::string* out) const {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  for (size_t i = begin; i < end; i++) {
+    const HeapEntry& entry = entries[i];
+    WriteVarint(entry.type(), out);
+    WriteVarint(node_name_ids_[i], out);
+    WriteVarint(entry.id(), out);
+    WriteVarint(entry.self_size(), out);
+    WriteVarint(entry.children_count(), out);
+    WriteVarint(entry.trace_node_id(), out);
+    WriteVarint(entry.detachedness(), out);
+  }
+}
+
+void HeapSnapshotBinarySerializer::EncodeEdges(size_t begin, size_t end,
+                                               std::string* out) const {
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  for (size_t i = begin; i < end; i++) {
+    const HeapGraphEdge* edge = edges[i];
+    WriteVarint(edge->type(), out);
+    WriteVarint(edge_names_or_indices_[i], out);
+    // Unlike in the JSON format, edges refer to the ordinal of the node.
+    WriteVarint(edge->to()->index(), out);
+  }
+}
+
+void HeapSnapshotBinarySerializer::EncodeLocations(std::string* out) const {
+  const std::vector<EntrySourceLocation>& locations = snapshot_->locations();
+  WriteVarint(locations.size(), out);
+  for (const EntrySourceLocation& location : locations) {
+    WriteVarint(location.entry_index, out);
+    WriteVarint(location.scriptId, out);
+    WriteVarint(location.line, out);
+    WriteVarint(location.col, out);
+  }
+}
+
 }  // namespace v8::internal
@@ -8,6 +8,7 @@
 #include <deque>
 #include <memory>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -222,7 +223,9 @@ class HeapSnapshot {
  public:
   HeapSnapshot(HeapProfiler* profiler,
                v8::HeapProfiler::HeapSnapshotMode snapshot_mode,
-               v8::HeapProfiler::NumericsMode numerics_mode);
+               v8::HeapProfiler::NumericsMode numerics_mode,
+               v8::HeapProfiler::EdgesMode edges_mode =
+                   v8::HeapProfiler::EdgesMode::kAllEdges);
   HeapSnapshot(const HeapSnapshot&) = delete;
   HeapSnapshot& operator=(const HeapSnapshot&) = delete;
   void Delete();
@@ -254,6 +257,11 @@ class HeapSnapshot {
     return snapshot_mode_ ==
            v8::HeapProfiler::HeapSnapshotMode::kExposeInternals;
   }
+  // Whether weak edges and edge names are recorded. If not, edges are
+  // recorded with empty names and weak edges are dropped.
+  bool record_all_edges() const {
+    return edges_mode_ == v8::HeapProfiler::EdgesMode::kAllEdges;
+  }
 
   void AddLocation(HeapEntry* entry, int scriptId, int line, int col);
   HeapEntry* AddEntry(HeapEntry::Type type,
@@ -290,6 +298,7 @@ class HeapSnapshot {
   SnapshotObjectId max_snapshot_js_object_id_ = -1;
   v8::HeapProfiler::HeapSnapshotMode snapshot_mode_;
   v8::HeapProfiler::NumericsMode numerics_mode_;
+  v8::HeapProfiler::EdgesMode edges_mode_;
 
   // The ScriptsLineEndsMap instance stores the line ends of scripts that did
   // not get their line_ends() information populated in heap.
@@ -782,6 +791,38 @@ class HeapSnapshotJSONSerializer {
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Writes a snapshot in the compact binary format described next to
+// v8::HeapSnapshot::Serialize. String ids are assigned on the calling thread,
+// after which nodes and edges are encoded in parallel, in chunks.
+class HeapSnapshotBinarySerializer {
+ public:
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot) {}
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(const HeapSnapshotBinarySerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  class EncodeJob;
+
+  // Number of nodes or edges encoded as one unit of parallel work.
+  static constexpr size_t kItemsPerChunk = 16 * 1024;
+
+  uint32_t GetStringId(const char* s);
+  void EncodeNodes(size_t begin, size_t end, std::string* out) const;
+  void EncodeEdges(size_t begin, size_t end, std::string* out) const;
+  void EncodeLocations(std::string* out) const;
+
+  HeapSnapshot* snapshot_;
+  // Names come from the snapshot's StringsStorage, which deduplicates them,
+  // so they are interned by address.
+  std::unordered_map<const char*, uint32_t> string_ids_;
+  std::vector<const char*> strings_;
+  std::vector<uint32_t> node_name_ids_;
+  std::vector<uint32_t> edge_names_or_indices_;
+};
+
 }  // namespace v8::internal
 
 #endif  // V8_PROFILER_HEAP_SNAPSHOT_GENERATOR_H_
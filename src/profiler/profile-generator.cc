@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "include/v8-profiler.h"
+#include "src/base/functional.h"
 #include "src/base/lazy-instance.h"
 #include "src/codegen/source-position.h"
 #include "src/objects/shared-function-info-inl.h"
@@ -576,7 +577,8 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, ProfilerId id, const char* title,
       options_(std::move(options)),
       delegate_(std::move(delegate)),
       start_time_(base::TimeTicks::Now()),
-      top_down_(profiler->isolate(), profiler->code_entries()),
+      top_down_(std::make_unique<ProfileTree>(profiler->isolate(),
+                                              profiler->code_entries())),
       profiler_(profiler),
       streaming_next_sample_(0),
       id_(id) {
@@ -626,7 +628,7 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
   if (!CheckSubsample(sampling_interval)) return;
 
   ProfileNode* top_frame_node =
-      top_down_.AddPathFromEnd(path, src_line, update_stats, options_.mode());
+      top_down_->AddPathFromEnd(path, src_line, update_stats, options_.mode());
 
   bool is_buffer_full =
       options_.max_samples() != CpuProfilingOptions::kNoSampleLimit &&
@@ -650,7 +652,7 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
   const int kSamplesFlushCount = 100;
   const int kNodesFlushCount = 10;
   if (samples_.size() - streaming_next_sample_ >= kSamplesFlushCount ||
-      top_down_.pending_nodes_count() >= kNodesFlushCount) {
+      top_down_->pending_nodes_count() >= kNodesFlushCount) {
     StreamPendingTraceEvents();
   }
 }
@@ -686,7 +688,8 @@ void BuildNodeValue(const ProfileNode* node, TracedValue* value) {
 }  // namespace
 
 void CpuProfile::StreamPendingTraceEvents() {
-  std::vector<const ProfileNode*> pending_nodes = top_down_.TakePendingNodes();
+  std::vector<const ProfileNode*> pending_nodes =
+      top_down_->TakePendingNodes();
   if (pending_nodes.empty() && samples_.empty()) return;
   auto value = TracedValue::Create();
 
@@ -765,6 +768,24 @@ void CpuProfile::FinishProfile() {
                               "ProfileChunk", id_, "data", std::move(value));
 }
 
+std::unique_ptr<CpuProfile> CpuProfile::TakeSnapshot(ProfilerId snapshot_id) {
+  StreamPendingTraceEvents();
+  auto snapshot = std::make_unique<CpuProfile>(
+      profiler_, snapshot_id, title_,
+      CpuProfilingOptions(options_.mode(), 0,
+                          options_.sampling_interval_us()));
+  base::TimeTicks now = base::TimeTicks::Now();
+  snapshot->start_time_ = start_time_;
+  snapshot->end_time_ = now;
+  // The samples point into the tree, so they move along with it.
+  std::swap(top_down_, snapshot->top_down_);
+  std::swap(samples_, snapshot->samples_);
+  snapshot->streaming_next_sample_ = snapshot->samples_.size();
+  streaming_next_sample_ = 0;
+  start_time_ = now;
+  return snapshot;
+}
+
 namespace {
 
 void FlattenNodesTree(const v8::CpuProfileNode* node,
@@ -919,9 +940,181 @@ void CpuProfileJSONSerializer::SerializeImpl() {
   writer_->Finalize();
 }
 
+namespace {
+
+// Wire types and field numbers of the pprof profile.proto messages.
+constexpr int kVarintWireType = 0;
+constexpr int kLengthDelimitedWireType = 2;
+
+constexpr int kProfileSampleTypeField = 1;
+constexpr int kProfileSampleField = 2;
+constexpr int kProfileLocationField = 4;
+constexpr int kProfileFunctionField = 5;
+constexpr int kProfileStringTableField = 6;
+constexpr int kProfileTimeNanosField = 9;
+constexpr int kProfileDurationNanosField = 10;
+constexpr int kProfilePeriodTypeField = 11;
+constexpr int kProfilePeriodField = 12;
+constexpr int kValueTypeTypeField = 1;
+constexpr int kValueTypeUnitField = 2;
+constexpr int kSampleLocationIdField = 1;
+constexpr int kSampleValueField = 2;
+constexpr int kLocationIdField = 1;
+constexpr int kLocationLineField = 4;
+constexpr int kLineFunctionIdField = 1;
+constexpr int kLineLineField = 2;
+constexpr int kFunctionIdField = 1;
+constexpr int kFunctionNameField = 2;
+constexpr int kFunctionSystemNameField = 3;
+constexpr int kFunctionFilenameField = 4;
+constexpr int kFunctionStartLineField = 5;
+
+void WriteVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void WriteVarintField(int field, uint64_t value, std::string* out) {
+  WriteVarint((field << 3) | kVarintWireType, out);
+  WriteVarint(value, out);
+}
+
+void WriteBytesField(int field, const char* data, size_t length,
+                     std::string* out) {
+  WriteVarint((field << 3) | kLengthDelimitedWireType, out);
+  WriteVarint(length, out);
+  out->append(data, length);
+}
+
+void WriteBytesField(int field, const std::string& data, std::string* out) {
+  WriteBytesField(field, data.data(), data.size(), out);
+}
+
+}  // namespace
+
+size_t CpuProfilePprofSerializer::FunctionKeyHasher::operator()(
+    const FunctionKey& key) const {
+  return base::hash_combine(key.name, key.resource_name, key.line_number);
+}
+
+uint64_t CpuProfilePprofSerializer::GetStringId(const char* string) {
+  auto [it, inserted] = string_ids_.emplace(string, strings_.size());
+  if (inserted) strings_.push_back(string);
+  return it->second;
+}
+
+uint64_t CpuProfilePprofSerializer::GetFunctionId(const CodeEntry* entry,
+                                                  std::string* out) {
+  FunctionKey key{entry->name(), entry->resource_name(),
+                  entry->line_number()};
+  auto [it, inserted] = function_ids_.emplace(key, function_ids_.size() + 1);
+  if (!inserted) return it->second;
+
+  std::string function;
+  uint64_t name_id = GetStringId(entry->name());
+  WriteVarintField(kFunctionIdField, it->second, &function);
+  WriteVarintField(kFunctionNameField, name_id, &function);
+  WriteVarintField(kFunctionSystemNameField, name_id, &function);
+  WriteVarintField(kFunctionFilenameField, GetStringId(entry->resource_name()),
+                   &function);
+  WriteVarintField(kFunctionStartLineField,
+                   std::max(entry->line_number(), 0), &function);
+  WriteBytesField(kProfileFunctionField, function, out);
+  return it->second;
+}
+
+void CpuProfilePprofSerializer::SerializeNode(const ProfileNode* node,
+                                              std::string* out) {
+  // The root has no function of its own and is left out of all samples.
+  if (node->parent() != nullptr) {
+    std::string line;
+    WriteVarintField(kLineFunctionIdField, GetFunctionId(node->entry(), out),
+                     &line);
+    WriteVarintField(kLineLineField, std::max(node->line_number(), 0), &line);
+    std::string location;
+    WriteVarintField(kLocationIdField, node->id(), &location);
+    WriteBytesField(kLocationLineField, line, &location);
+    WriteBytesField(kProfileLocationField, location, out);
+
+    if (node->self_ticks() > 0) {
+      // Locations are listed from the leaf to the outermost caller, as packed
+      // repeated fields.
+      std::string location_ids;
+      for (const ProfileNode* caller = node; caller->parent() != nullptr;
+           caller = caller->parent()) {
+        WriteVarint(caller->id(), &location_ids);
+      }
+      std::string values;
+      WriteVarint(node->self_ticks(), &values);
+      WriteVarint(node->self_ticks() * period_ns_, &values);
+      std::string sample;
+      WriteBytesField(kSampleLocationIdField, location_ids, &sample);
+      WriteBytesField(kSampleValueField, values, &sample);
+      WriteBytesField(kProfileSampleField, sample, out);
+    }
+  }
+  for (const ProfileNode* child : *node->children()) {
+    SerializeNode(child, out);
+  }
+}
+
+void CpuProfilePprofSerializer::Serialize(v8::OutputStream* stream) {
+  // The first entry of the string table must be the empty string.
+  GetStringId("");
+
+  base::TimeDelta period =
+      base::TimeDelta::FromMicroseconds(profile_->sampling_interval_us());
+  if (period.IsZero()) period = profile_->cpu_profiler()->sampling_interval();
+  period_ns_ = static_cast<uint64_t>(period.InNanoseconds());
+
+  std::string out;
+  std::string samples_type;
+  WriteVarintField(kValueTypeTypeField, GetStringId("samples"), &samples_type);
+  WriteVarintField(kValueTypeUnitField, GetStringId("count"), &samples_type);
+  WriteBytesField(kProfileSampleTypeField, samples_type, &out);
+  std::string cpu_type;
+  WriteVarintField(kValueTypeTypeField, GetStringId("cpu"), &cpu_type);
+  WriteVarintField(kValueTypeUnitField, GetStringId("nanoseconds"), &cpu_type);
+  WriteBytesField(kProfileSampleTypeField, cpu_type, &out);
+  WriteBytesField(kProfilePeriodTypeField, cpu_type, &out);
+  WriteVarintField(kProfilePeriodField, period_ns_, &out);
+
+  // The profile's time ticks are converted to wall clock time.
+  base::TimeTicks start_ticks = profile_->start_time();
+  base::TimeTicks end_ticks = profile_->end_time();
+  if (end_ticks.IsNull()) end_ticks = base::TimeTicks::Now();
+  base::TimeDelta start_since_epoch = base::Time::Now() -
+                                      base::Time::UnixEpoch() -
+                                      (base::TimeTicks::Now() - start_ticks);
+  WriteVarintField(kProfileTimeNanosField,
+                   static_cast<uint64_t>(start_since_epoch.InNanoseconds()),
+                   &out);
+  WriteVarintField(
+      kProfileDurationNanosField,
+      static_cast<uint64_t>((end_ticks - start_ticks).InNanoseconds()), &out);
+
+  SerializeNode(profile_->top_down()->root(), &out);
+
+  for (const char* string : strings_) {
+    WriteBytesField(kProfileStringTableField, string, strlen(string), &out);
+  }
+
+  const size_t chunk_size = static_cast<size_t>(stream->GetChunkSize());
+  for (size_t pos = 0; pos < out.size(); pos += chunk_size) {
+    int size = static_cast<int>(std::min(chunk_size, out.size() - pos));
+    if (stream->WriteAsciiChunk(&out[pos], size) == v8::OutputStream::kAbort) {
+      return;
+    }
+  }
+  stream->EndOfStream();
+}
+
 void CpuProfile::Print() const {
   base::OS::Print("[Top down]:\n");
-  top_down_.Print();
+  top_down_->Print();
   ProfilerStats::Instance()->Print();
   ProfilerStats::Instance()->Clear();
 }
@@ -1115,6 +1308,17 @@ CpuProfile* CpuProfilesCollection::StopProfiling(ProfilerId id) {
   return profile;
 }
 
+CpuProfile* CpuProfilesCollection::TakeSnapshot(ProfilerId id) {
+  base::RecursiveMutexGuard profiles_guard{&current_profiles_mutex_};
+  auto it = std::find_if(
+      current_profiles_.begin(), current_profiles_.end(),
+      [=](const std::unique_ptr<CpuProfile>& p) { return id == p->id(); });
+  if (it == current_profiles_.end()) return nullptr;
+
+  finished_profiles_.push_back((*it)->TakeSnapshot(++last_id_));
+  return finished_profiles_.back().get();
+}
+
 CpuProfile* CpuProfilesCollection::Lookup(const char* title) {
   if (title == nullptr) return nullptr;
   // http://crbug/51594, edge case console.profile may provide an empty title
@@ -10,6 +10,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -432,9 +433,12 @@ class CpuProfile {
                base::TimeDelta sampling_interval, StateTag state,
                EmbedderStateTag embedder_state);
   void FinishProfile();
+  // Moves the call tree and samples collected so far into a new finished
+  // profile with the given id, and continues with an empty call tree.
+  std::unique_ptr<CpuProfile> TakeSnapshot(ProfilerId snapshot_id);
 
   const char* title() const { return title_; }
-  const ProfileTree* top_down() const { return &top_down_; }
+  const ProfileTree* top_down() const { return top_down_.get(); }
 
   int samples_count() const { return static_cast<int>(samples_.size()); }
   const SampleInfo& sample(int index) const { return samples_[index]; }
@@ -463,7 +467,7 @@ class CpuProfile {
   base::TimeTicks start_time_;
   base::TimeTicks end_time_;
   std::deque<SampleInfo> samples_;
-  ProfileTree top_down_;
+  std::unique_ptr<ProfileTree> top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
   const ProfilerId id_;
@@ -553,6 +557,7 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   // This Method is only visible for testing
   CpuProfilingResult StartProfilingForTesting(ProfilerId id);
   CpuProfile* StopProfiling(ProfilerId id);
+  CpuProfile* TakeSnapshot(ProfilerId id);
   bool IsLastProfileLeft(ProfilerId id);
   CpuProfile* Lookup(const char* title);
 
@@ -599,6 +604,45 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   Isolate* isolate_;
 };
 
+// Writes the call tree of a profile as an uncompressed pprof 'Profile'
+// message (see https://github.com/google/pprof/blob/main/proto/profile.proto).
+// Every node with self ticks becomes a sample whose locations are the node and
+// its ancestors; functions are shared between nodes of the same function.
+class CpuProfilePprofSerializer {
+ public:
+  explicit CpuProfilePprofSerializer(CpuProfile* profile) : profile_(profile) {}
+  CpuProfilePprofSerializer(const CpuProfilePprofSerializer&) = delete;
+  CpuProfilePprofSerializer& operator=(const CpuProfilePprofSerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  struct FunctionKey {
+    const char* name;
+    const char* resource_name;
+    int line_number;
+    bool operator==(const FunctionKey& other) const {
+      return name == other.name && resource_name == other.resource_name &&
+             line_number == other.line_number;
+    }
+  };
+  struct FunctionKeyHasher {
+    size_t operator()(const FunctionKey& key) const;
+  };
+
+  void SerializeNode(const ProfileNode* node, std::string* out);
+  uint64_t GetFunctionId(const CodeEntry* entry, std::string* out);
+  uint64_t GetStringId(const char* string);
+
+  CpuProfile* profile_;
+  uint64_t period_ns_ = 0;
+  std::unordered_map<std::string, uint64_t> string_ids_;
+  std::vector<const char*> strings_;
+  // Function names are interned in StringsStorage, so the names of the same
+  // function compare equal by address.
+  std::unordered_map<FunctionKey, uint64_t, FunctionKeyHasher> function_ids_;
+};
+
 class CpuProfileJSONSerializer {
  public:
   explicit CpuProfileJSONSerializer(CpuProfile* profile)
@@ -147,10 +147,30 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   return parent->AddChildNode(id, std::move(new_child));
 }
 
+SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
+    AllocationNode* parent, Tagged<SharedFunctionInfo> shared) {
+  int script_id = v8::UnboundScript::kNoScriptId;
+  if (IsScript(shared->script())) {
+    script_id = Cast<Script>(shared->script())->id();
+  }
+  const int start_position = shared->StartPosition();
+  if (script_id != v8::UnboundScript::kNoScriptId) {
+    // Nodes of script functions are identified by their position, so the
+    // debug name only needs to be computed when a new node is added.
+    AllocationNode* child = parent->FindChildNode(
+        AllocationNode::function_id(script_id, start_position, nullptr));
+    if (child) return child;
+  }
+  const char* name = names()->GetCopy(shared->DebugNameCStr().get());
+  return FindOrAddChildNode(parent, name, script_id, start_position);
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
-  std::vector<Tagged<SharedFunctionInfo>> stack;
+  // Reuse the buffer across samples to avoid allocating on each sample.
+  std::vector<Tagged<SharedFunctionInfo>>& stack = stack_buffer_;
+  stack.clear();
   JavaScriptStackFrameIterator frame_it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
@@ -211,14 +231,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // We need to process the stack in reverse order as the top of the stack is
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-    Tagged<SharedFunctionInfo> shared = *it;
-    const char* name = this->names()->GetCopy(shared->DebugNameCStr().get());
-    int script_id = v8::UnboundScript::kNoScriptId;
-    if (IsScript(shared->script())) {
-      Tagged<Script> script = Cast<Script>(shared->script());
-      script_id = script->id();
-    }
-    node = FindOrAddChildNode(node, name, script_id, shared->StartPosition());
+    node = FindOrAddChildNode(node, *it);
   }
 
   if (found_arguments_marker_frames) {
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "include/v8-profiler.h"
 #include "src/heap/heap.h"
@@ -22,6 +23,8 @@ class RandomNumberGenerator;
 
 namespace internal {
 
+class SharedFunctionInfo;
+
 class AllocationProfile : public v8::AllocationProfile {
  public:
   AllocationProfile() = default;
@@ -164,6 +167,8 @@ class SamplingHeapProfiler {
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent,
+                                     Tagged<SharedFunctionInfo> shared);
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
 
   uint32_t next_node_id() { return ++last_node_id_; }
@@ -191,6 +196,9 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Scratch buffer for the frames of the current sample. Only valid during
+  // AddStack().
+  std::vector<Tagged<SharedFunctionInfo>> stack_buffer_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
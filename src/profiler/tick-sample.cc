@@ -166,12 +166,14 @@ DISABLE_ASAN void TickSample::Init(Isolate* v8_isolate,
                                    RecordCEntryFrame record_c_entry_frame,
                                    bool update_stats,
                                    bool use_simulator_reg_state,
-                                   base::TimeDelta sampling_interval) {
+                                   base::TimeDelta sampling_interval,
+                                   unsigned max_frames_count) {
+  DCHECK_LE(max_frames_count, kMaxFramesCount);
   update_stats_ = update_stats;
   SampleInfo info;
   RegisterState regs = reg_state;
   if (!GetStackSample(v8_isolate, &regs, record_c_entry_frame, stack,
-                      kMaxFramesCount, &info, &state,
+                      max_frames_count, &info, &state,
                       use_simulator_reg_state)) {
     // It is executing JS but failed to collect a stack trace.
     // Mark the sample as spoiled.
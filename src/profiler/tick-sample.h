@@ -34,11 +34,13 @@ struct V8_EXPORT TickSample {
    *                                register state rather than the one provided
    *                                with |state| argument. Otherwise the method
    *                                will use provided register |state| as is.
+   * \param max_frames_count At most this many frames are walked and recorded.
    */
   void Init(Isolate* isolate, const v8::RegisterState& state,
             RecordCEntryFrame record_c_entry_frame, bool update_stats,
             bool use_simulator_reg_state = true,
-            base::TimeDelta sampling_interval = base::TimeDelta());
+            base::TimeDelta sampling_interval = base::TimeDelta(),
+            unsigned max_frames_count = kMaxFramesCount);
   /**
    * Get a call stack sample from the isolate.
    * \param isolate The isolate.
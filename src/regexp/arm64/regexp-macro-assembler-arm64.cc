@@ -638,6 +638,89 @@ void RegExpMacroAssemblerARM64::CheckBitInTable(
   CompareAndBranchOrBacktrack(w11, 0, ne, on_bit_set);
 }
 
+bool RegExpMacroAssemblerARM64::SkipUntilCharactersAfterAnd(
+    base::Vector<const base::uc16> chars, base::uc16 mask, int cp_offset) {
+  DCHECK_LE(1, chars.length());
+  DCHECK_GE(kMaxSkipCharacters, chars.length());
+  if (!v8_flags.regexp_simd_skip) return false;
+
+  // Broadcasts {value} to all lanes of {dst}.
+  auto broadcast = [&](const VRegister& dst, base::uc16 value) {
+    __ Mov(w11, value);
+    if (mode_ == LATIN1) {
+      __ Dup(dst.V16B(), w11);
+    } else {
+      __ Dup(dst.V8H(), w11);
+    }
+  };
+  auto compare = [&](const VRegister& dst, const VRegister& lhs,
+                     const VRegister& rhs) {
+    if (mode_ == LATIN1) {
+      __ Cmeq(dst.V16B(), lhs.V16B(), rhs.V16B());
+    } else {
+      __ Cmeq(dst.V8H(), lhs.V8H(), rhs.V8H());
+    }
+  };
+  const VRegister kData = v0;
+  const VRegister kMask = v1;
+  const VRegister kChars[] = {v2, v3};
+  const VRegister kScratch = v4;
+  broadcast(kMask, mask);
+  for (int i = 0; i < chars.length(); i++) broadcast(kChars[i], chars[i]);
+
+  // w10: Position of the character to check, as negative byte offset from the
+  // end of the input.
+  Label vector_loop, scalar_loop, found_in_vector, done;
+  __ Add(w10, current_input_offset(), cp_offset * char_size());
+
+  // Check 16 bytes at a time while they are all within the input.
+  __ Bind(&vector_loop);
+  __ Add(w11, w10, kQRegSize);
+  __ Cmp(w11, 0);
+  __ B(gt, &scalar_loop);
+  __ Ldr(kData.Q(), MemOperand(input_end(), w10, SXTW));
+  __ And(kData.V16B(), kData.V16B(), kMask.V16B());
+  compare(kScratch, kData, kChars[0]);
+  for (int i = 1; i < chars.length(); i++) {
+    compare(kData, kData, kChars[i]);
+    __ Orr(kScratch.V16B(), kScratch.V16B(), kData.V16B());
+  }
+  // Narrow the comparison result to 4 bits per byte.
+  __ Shrn(kScratch.V8B(), kScratch.V8H(), 4);
+  __ Fmov(x11, kScratch.D());
+  __ Cbnz(x11, &found_in_vector);
+  __ Add(w10, w10, kQRegSize);
+  __ B(&vector_loop);
+
+  __ Bind(&found_in_vector);
+  // The lowest set bit is in the first byte of the first matching character.
+  __ Rbit(x11, x11);
+  __ Clz(x11, x11);
+  __ Add(w10, w10, Operand(w11, LSR, 2));
+  __ B(&done);
+
+  // Check the remaining characters one by one.
+  __ Bind(&scalar_loop);
+  __ Cmp(w10, 0);
+  __ B(ge, &done);
+  if (mode_ == LATIN1) {
+    __ Ldrb(w11, MemOperand(input_end(), w10, SXTW));
+  } else {
+    __ Ldrh(w11, MemOperand(input_end(), w10, SXTW));
+  }
+  __ And(w11, w11, mask);
+  for (base::uc16 c : chars) {
+    __ Cmp(w11, c);
+    __ B(eq, &done);
+  }
+  __ Add(w10, w10, char_size());
+  __ B(&scalar_loop);
+
+  __ Bind(&done);
+  __ Sub(current_input_offset(), w10, cp_offset * char_size());
+  return true;
+}
+
 bool RegExpMacroAssemblerARM64::CheckSpecialClassRanges(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -63,6 +63,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool SkipUntilCharactersAfterAnd(base::Vector<const base::uc16> chars,
+                                   base::uc16 mask, int cp_offset) override;
   void BindJumpTarget(Label* label = nullptr) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
@@ -15,6 +15,7 @@
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -301,6 +302,7 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        first_char_ranges_(0, zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -357,6 +359,11 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_skip_ahead &&
+        lookbehind_pc_.is_empty()) {
+      ComputeFirstChars();
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -580,6 +587,12 @@ class NfaInterpreter {
     while (input_index_ != input_.length() &&
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
+      if (TrySkipAhead()) {
+        err_code = RunActiveThreads();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        continue;
+      }
+
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
@@ -804,6 +817,116 @@ class NfaInterpreter {
 
   bool FoundMatch() const { return best_match_thread_.has_value(); }
 
+  // If the regexp is unanchored, its bytecode starts with a preamble for
+  // /.*?/, followed by the body of the regexp:
+  //
+  //     FORK body
+  //     JMP end
+  //   body:
+  //     BEGIN_LOOP
+  //     CONSUME_RANGE [0x0000-0xFFFF]
+  //     END_LOOP
+  //     FORK body
+  //   end:
+  //     ...
+  //
+  // Collects the ranges of all CONSUME_RANGE instructions that the body can
+  // reach without consuming a character, i.e. the characters which a match
+  // can start with. Assertions are assumed to hold, so the ranges are an
+  // over-approximation. Leaves `preamble_consume_pc_` unset if there is no
+  // such preamble or if the body can match the empty string.
+  void ComputeFirstChars() {
+    constexpr int kConsumePc = 3;
+    if (bytecode_.length() <= kConsumePc + 3 ||
+        bytecode_[0].opcode != RegExpInstruction::FORK ||
+        bytecode_[1].opcode != RegExpInstruction::JMP ||
+        bytecode_[kConsumePc].opcode != RegExpInstruction::CONSUME_RANGE ||
+        bytecode_[kConsumePc].payload.consume_range.min != 0 ||
+        bytecode_[kConsumePc].payload.consume_range.max != 0xFFFF) {
+      return;
+    }
+
+    ZoneVector<bool> visited(bytecode_.length(), false, zone_);
+    ZoneVector<int> worklist(zone_);
+    worklist.push_back(bytecode_[1].payload.pc);
+    while (!worklist.empty()) {
+      int pc = worklist.back();
+      worklist.pop_back();
+      SBXCHECK_BOUNDS(pc, bytecode_.size());
+      if (visited[pc]) continue;
+      visited[pc] = true;
+      RegExpInstruction inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          first_char_ranges_.Add(inst.payload.consume_range, zone_);
+          break;
+        case RegExpInstruction::FORK:
+          worklist.push_back(inst.payload.pc);
+          worklist.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::ACCEPT:
+          // The body can match the empty string, so matches can start
+          // anywhere.
+          first_char_ranges_.Rewind(0);
+          return;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          worklist.push_back(pc + 1);
+          break;
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::FILTER_QUANTIFIER:
+        case RegExpInstruction::FILTER_GROUP:
+        case RegExpInstruction::FILTER_CHILD:
+          UNREACHABLE();
+      }
+    }
+    preamble_consume_pc_ = kConsumePc;
+  }
+
+  bool IsFirstChar(base::uc16 c) const {
+    for (const RegExpInstruction::Uc16Range& range : first_char_ranges_) {
+      if (c >= range.min && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  // Skips input positions at which no match can start, if all blocked threads
+  // started at the current input position (or are the preamble's thread). No
+  // state then depends on the skipped input, so the search can restart from
+  // the beginning of the bytecode at the next position where a match can
+  // start. Returns true if it skipped ahead; the threads to run from there
+  // are in `active_threads_`.
+  bool TrySkipAhead() {
+    if (!preamble_consume_pc_.has_value() || FoundMatch()) return false;
+    for (const InterpreterThread& t : blocked_threads_) {
+      if (t.pc != *preamble_consume_pc_ &&
+          GetRegisterArray(t)[0] != input_index_) {
+        return false;
+      }
+    }
+    int next_index = input_index_;
+    while (next_index != input_.length() && !IsFirstChar(input_[next_index])) {
+      ++next_index;
+    }
+    if (next_index == input_index_) return false;
+
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.Rewind(0);
+    SetInputIndex(next_index);
+    active_threads_.Add(NewEmptyThread(0), zone_);
+    return true;
+  }
+
   size_t ApproximateTotalMemoryUsage() {
     return (blocked_threads_.length() + active_threads_.length()) *
            memory_consumption_per_thread_;
@@ -1089,6 +1212,12 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // PC of the CONSUME_RANGE instruction of the /.*?/ preamble, and the
+  // characters which a match can start with. Only set if the interpreter can
+  // skip ahead to such characters (see `ComputeFirstChars`).
+  std::optional<int> preamble_consume_pc_;
+  ZoneList<RegExpInstruction::Uc16Range> first_char_ranges_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
@@ -3019,6 +3019,13 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
+    const base::uc16 chars[] = {static_cast<base::uc16>(single_character)};
+    const base::uc16 mask =
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xFFFF;
+    if (masm->SkipUntilCharactersAfterAnd(base::ArrayVector(chars), mask,
+                                          max_lookahead)) {
+      return;
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -3041,6 +3048,27 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK_NE(0, skip_distance);
 
+  // If only a few characters can occur at {max_lookahead}, scanning for them
+  // (with vector instructions) finds the next possible match start faster
+  // than skipping through the table.
+  base::uc16 chars[RegExpMacroAssembler::kMaxSkipCharacters];
+  int char_count = 0;
+  for (int i = 0; i < kSize; i++) {
+    if (boolean_skip_table->get(i) == 0) continue;
+    if (char_count == RegExpMacroAssembler::kMaxSkipCharacters) {
+      char_count = 0;
+      break;
+    }
+    chars[char_count++] = i;
+  }
+  if (char_count > 0 &&
+      masm->SkipUntilCharactersAfterAnd(base::Vector<const base::uc16>(
+                                            chars, char_count),
+                                        RegExpMacroAssembler::kTableMask,
+                                        max_lookahead)) {
+    return;
+  }
+
   Label cont, again;
   masm->Bind(&again);
   masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -6,6 +6,8 @@
 
 #include "src/regexp/regexp-interpreter.h"
 
+#include <cstdlib>
+
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/execution/isolate.h"
@@ -397,7 +399,7 @@ IrregexpInterpreter::Result RawMatch(
     Tagged<String> subject_string, base::Vector<const Char> subject,
     int* output_registers, int output_register_count, int total_register_count,
     int current, uint32_t current_char, RegExp::CallOrigin call_origin,
-    const uint32_t backtrack_limit) {
+    const uint32_t backtrack_limit, uint32_t* work) {
   DisallowGarbageCollection no_gc;
 
 #if V8_USE_COMPUTED_GOTO
@@ -456,6 +458,13 @@ IrregexpInterpreter::Result RawMatch(
   BacktrackStack backtrack_stack;
 
   uint32_t backtrack_count = 0;
+  // The backtracks and the distance between the start and the end position
+  // approximate the work done for the match.
+  const int start_position = current;
+  auto record_work = [&]() {
+    *work = backtrack_count +
+            static_cast<uint32_t>(std::abs(current - start_position));
+  };
 
 #ifdef DEBUG
   if (v8_flags.trace_regexp_bytecodes) {
@@ -535,6 +544,7 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(POP_BT) {
       static_assert(JSRegExp::kNoBacktrackLimit == 0);
       if (++backtrack_count == backtrack_limit) {
+        record_work();
         int return_code = LoadPacked24Signed(insn);
         return static_cast<IrregexpInterpreter::Result>(return_code);
       }
@@ -555,11 +565,13 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(FAIL) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      record_work();
       return IrregexpInterpreter::FAILURE;
     }
     BYTECODE(SUCCEED) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      record_work();
       registers.CopyToOutputRegisters();
       return IrregexpInterpreter::SUCCESS;
     }
@@ -1068,9 +1080,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, Tagged<IrRegExpData> regexp_data,
     Tagged<String> subject_string, int* output_registers,
     int output_register_count, int start_position,
-    RegExp::CallOrigin call_origin) {
-  if (v8_flags.regexp_tier_up) regexp_data->TierUpTick();
-
+    RegExp::CallOrigin call_origin, uint32_t* work) {
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
   Tagged<TrustedByteArray> code_array = regexp_data->bytecode(is_one_byte);
   int total_register_count = regexp_data->max_register_count();
@@ -1078,14 +1088,14 @@ IrregexpInterpreter::Result IrregexpInterpreter::Match(
   return MatchInternal(isolate, code_array, subject_string, output_registers,
                        output_register_count, total_register_count,
                        start_position, call_origin,
-                       regexp_data->backtrack_limit());
+                       regexp_data->backtrack_limit(), work);
 }
 
 IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     Isolate* isolate, Tagged<TrustedByteArray> code_array,
     Tagged<String> subject_string, int* output_registers,
     int output_register_count, int total_register_count, int start_position,
-    RegExp::CallOrigin call_origin, uint32_t backtrack_limit) {
+    RegExp::CallOrigin call_origin, uint32_t backtrack_limit, uint32_t* work) {
   DCHECK(subject_string->IsFlat());
 
   // Note: Heap allocation *is* allowed in two situations if calling from
@@ -1109,7 +1119,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, work);
   } else {
     DCHECK(subject_content.IsTwoByte());
     base::Vector<const base::uc16> subject_vector =
@@ -1118,7 +1128,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, work);
   }
 }
 
@@ -1143,14 +1153,28 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
   Tagged<IrRegExpData> regexp_data_obj =
       Cast<IrRegExpData>(Tagged<Object>(regexp_data));
 
+  if (regexp_data_obj->CanTierUp() &&
+      subject_string->length() >= JSRegExp::kTierUpForSubjectLengthValue) {
+    // Like in RegExpImpl::IrregexpExec, tier up eagerly for very long
+    // subjects.
+    regexp_data_obj->MarkTierUpForNextExec();
+    if (v8_flags.trace_regexp_tier_up) {
+      PrintF("Forcing tier-up for very long strings in MatchForCallFromJs\n");
+    }
+  }
+
   if (regexp_data_obj->MarkedForTierUp()) {
     // Returning RETRY will re-enter through runtime, where actual recompilation
     // for tier-up takes place.
     return IrregexpInterpreter::RETRY;
   }
 
-  return Match(isolate, regexp_data_obj, subject_string, output_registers,
-               output_register_count, start_position, call_origin);
+  uint32_t work = 0;
+  Result result =
+      Match(isolate, regexp_data_obj, subject_string, output_registers,
+            output_register_count, start_position, call_origin, &work);
+  if (v8_flags.regexp_tier_up) regexp_data_obj->TierUpTick(work);
+  return result;
 }
 
 #endif  // !COMPILING_IRREGEXP_FOR_EXTERNAL_EMBEDDER
@@ -1159,9 +1183,13 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromRuntime(
     Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
     DirectHandle<String> subject_string, int* output_registers,
     int output_register_count, int start_position) {
-  return Match(isolate, *regexp_data, *subject_string, output_registers,
-               output_register_count, start_position,
-               RegExp::CallOrigin::kFromRuntime);
+  uint32_t work = 0;
+  Result result = Match(isolate, *regexp_data, *subject_string,
+                        output_registers, output_register_count,
+                        start_position, RegExp::CallOrigin::kFromRuntime, &work);
+  // Interrupts may have moved the regexp data, so tick through the handle.
+  if (v8_flags.regexp_tier_up) regexp_data->TierUpTick(work);
+  return result;
 }
 
 }  // namespace internal
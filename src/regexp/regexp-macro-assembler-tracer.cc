@@ -405,6 +405,19 @@ bool RegExpMacroAssemblerTracer::CheckSpecialClassRanges(
   return supported;
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharactersAfterAnd(
+    base::Vector<const base::uc16> chars, base::uc16 mask, int cp_offset) {
+  bool supported =
+      assembler_->SkipUntilCharactersAfterAnd(chars, mask, cp_offset);
+  PrintF(" SkipUntilCharactersAfterAnd(chars=[");
+  for (int i = 0; i < chars.length(); i++) {
+    PrintF(i == 0 ? "0x%04x" : ", 0x%04x", chars[i]);
+  }
+  PrintF("], mask=0x%04x, offset=%d): %s;\n", mask, cp_offset,
+         supported ? "true" : "false");
+  return supported;
+}
+
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
   PrintF(" IfRegisterLT(register=%d, number=%d, label[%08x]);\n",
@@ -56,6 +56,8 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool SkipUntilCharactersAfterAnd(base::Vector<const base::uc16> chars,
+                                   base::uc16 mask, int cp_offset) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
   void GoTo(Label* label) override;
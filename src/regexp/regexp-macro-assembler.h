@@ -39,6 +39,9 @@ class RegExpMacroAssembler {
   static constexpr int kTableSize = 1 << kTableSizeBits;
   static constexpr int kTableMask = kTableSize - 1;
 
+  // The maximum number of characters for {SkipUntilCharactersAfterAnd}.
+  static constexpr int kMaxSkipCharacters = 2;
+
   static constexpr int kUseCharactersValue = -1;
 
   RegExpMacroAssembler(Isolate* isolate, Zone* zone);
@@ -119,6 +122,17 @@ class RegExpMacroAssembler {
                                        Label* on_no_match) {
     return false;
   }
+  // Advances the current position to the first position at or after it at
+  // which the character at {cp_offset}, and'ed with {mask}, is one of
+  // {chars}. If there is no such position, advances it until {cp_offset} is at
+  // the end of the input (or not at all if it already is). Returns false if
+  // the assembler doesn't have custom support for this; nothing is emitted in
+  // this case.
+  // May clobber the current loaded character.
+  virtual bool SkipUntilCharactersAfterAnd(base::Vector<const base::uc16> chars,
+                                           base::uc16 mask, int cp_offset) {
+    return false;
+  }
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -601,6 +601,87 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharactersAfterAnd(
+    base::Vector<const base::uc16> chars, base::uc16 mask, int cp_offset) {
+  DCHECK_LE(1, chars.length());
+  DCHECK_GE(kMaxSkipCharacters, chars.length());
+  if (!v8_flags.regexp_simd_skip) return false;
+
+  // Broadcasts {value} to all lanes of {dst}.
+  auto broadcast = [&](XMMRegister dst, base::uc16 value) {
+    uint32_t replicated =
+        mode_ == LATIN1 ? (value & 0xFF) * 0x01010101u : value * 0x00010001u;
+    __ movl(rbx, Immediate(replicated));
+    __ Movd(dst, rbx);
+    __ Pshufd(dst, dst, 0);
+  };
+  const XMMRegister kData = xmm0;
+  const XMMRegister kMask = xmm1;
+  const XMMRegister kChars[] = {xmm2, xmm3};
+  const XMMRegister kScratch = xmm4;
+  broadcast(kMask, mask);
+  for (int i = 0; i < chars.length(); i++) broadcast(kChars[i], chars[i]);
+
+  // rax: Position of the character to check, as negative byte offset from the
+  // end of the input.
+  Label vector_loop, scalar_loop, found_in_vector, done;
+  __ leaq(rax, Operand(rdi, cp_offset * char_size()));
+
+  // Check 16 bytes at a time while they are all within the input.
+  __ bind(&vector_loop);
+  __ leaq(rbx, Operand(rax, kSimd128Size));
+  __ testq(rbx, rbx);
+  __ j(greater, &scalar_loop);
+  __ Movdqu(kData, Operand(rsi, rax, times_1, 0));
+  __ Pand(kData, kMask);
+  for (int i = 1; i < chars.length(); i++) {
+    __ Movaps(kScratch, kData);
+    if (mode_ == LATIN1) {
+      __ Pcmpeqb(kScratch, kChars[i]);
+    } else {
+      __ Pcmpeqw(kScratch, kChars[i]);
+    }
+  }
+  if (mode_ == LATIN1) {
+    __ Pcmpeqb(kData, kChars[0]);
+  } else {
+    __ Pcmpeqw(kData, kChars[0]);
+  }
+  if (chars.length() > 1) __ Por(kData, kScratch);
+  __ Pmovmskb(rbx, kData);
+  __ testl(rbx, rbx);
+  __ j(not_zero, &found_in_vector, Label::kNear);
+  __ addq(rax, Immediate(kSimd128Size));
+  __ jmp(&vector_loop);
+
+  __ bind(&found_in_vector);
+  // The lowest set bit is the first byte of the first matching character.
+  __ bsfl(rbx, rbx);
+  __ addq(rax, rbx);
+  __ jmp(&done, Label::kNear);
+
+  // Check the remaining characters one by one.
+  __ bind(&scalar_loop);
+  __ testq(rax, rax);
+  __ j(greater_equal, &done, Label::kNear);
+  if (mode_ == LATIN1) {
+    __ movzxbl(rbx, Operand(rsi, rax, times_1, 0));
+  } else {
+    __ movzxwl(rbx, Operand(rsi, rax, times_1, 0));
+  }
+  __ andl(rbx, Immediate(mask));
+  for (base::uc16 c : chars) {
+    __ cmpl(rbx, Immediate(c));
+    __ j(equal, &done, Label::kNear);
+  }
+  __ addq(rax, Immediate(char_size()));
+  __ jmp(&scalar_loop);
+
+  __ bind(&done);
+  __ leaq(rdi, Operand(rax, -cp_offset * char_size()));
+  return true;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -59,6 +59,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialClassRanges(StandardCharacterSet type,
                                Label* on_no_match) override;
+  bool SkipUntilCharactersAfterAnd(base::Vector<const base::uc16> chars,
+                                   base::uc16 mask, int cp_offset) override;
 
   void BindJumpTarget(Label* label) override;
 
@@ -349,6 +349,7 @@ class RootVisitor;
   /* Caches */                                                                 \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, json_object_map_cache, JsonObjectMapCache)                     \
   /* Indirection lists for isolate-independent builtins */                     \
   V(FixedArray, builtins_constants_table, BuiltinsConstantsTable)              \
   /* Internal SharedFunctionInfos */                                           \
@@ -398,6 +399,10 @@ class RootVisitor;
   V(WeakArrayList, shared_wasm_memories, SharedWasmMemories)                \
   /* EphemeronHashTable for debug scopes (local debug evaluate) */          \
   V(HeapObject, locals_block_list_cache, DebugLocalsBlockListCache)         \
+  /* EphemeronHashTable of recent deopts per SharedFunctionInfo */          \
+  V(HeapObject, deopt_history_table, DeoptHistoryTable)                     \
+  /* WeakFixedArray of maps for JSObject::TryMigrateReadMostlyToFast */    \
+  V(HeapObject, dictionary_to_fast_map_cache, DictionaryToFastMapCache)     \
   IF_WASM(V, HeapObject, active_continuation, ActiveContinuation)           \
   IF_WASM(V, HeapObject, active_suspender, ActiveSuspender)                 \
   IF_WASM(V, WeakArrayList, js_to_wasm_wrappers, JSToWasmWrappers)          \
@@ -10,6 +10,8 @@
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
+#include "src/deoptimizer/deopt-history.h"
+#include "src/deoptimizer/deopt-stats.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
@@ -380,8 +382,12 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // code object from deoptimizer.
   DirectHandle<Code> optimized_code = deoptimizer->compiled_code();
   const DeoptimizeKind deopt_kind = deoptimizer->deopt_kind();
-  const DeoptimizeReason deopt_reason =
-      deoptimizer->GetDeoptInfo().deopt_reason;
+  const Deoptimizer::DeoptInfo deopt_info = deoptimizer->GetDeoptInfo();
+  const DeoptimizeReason deopt_reason = deopt_info.deopt_reason;
+  if (DeoptStats* deopt_stats = isolate->deopt_stats()) {
+    deopt_stats->RecordDeopt(*optimized_code, deopt_info.position, deopt_kind,
+                             deopt_reason);
+  }
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -411,6 +417,13 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  // Generalize the feedback of bytecodes which keep deoptimizing for the same
+  // reason, so that the next optimization doesn't repeat the speculation.
+  if (v8_flags.deopt_loop_detection && top_frame->is_unoptimized()) {
+    DeoptHistory::RecordDeopt(isolate, UnoptimizedFrame::cast(top_frame),
+                              deopt_reason);
+  }
+
   // Non-OSR'd code is deoptimized unconditionally. If the deoptimization occurs
   // inside the outermost loop containning a loop that can trigger OSR
   // compilation, we remove the OSR code, it will avoid hit the out of date OSR
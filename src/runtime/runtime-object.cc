@@ -852,6 +852,16 @@ RUNTIME_FUNCTION(Runtime_ToFastProperties) {
   return *object;
 }
 
+RUNTIME_FUNCTION(Runtime_TryMigrateReadMostlyToFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  Handle<Object> object = args.at(0);
+  if (IsJSObject(*object)) {
+    JSObject::TryMigrateReadMostlyToFast(isolate, Cast<JSObject>(object));
+  }
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_AllocateHeapNumber) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
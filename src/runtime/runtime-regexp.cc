@@ -1354,7 +1354,9 @@ static Tagged<Object> SearchRegExpMultiple(
         }
 
         DCHECK_EQ(cursor, argc);
-        builder.Add(*isolate->factory()->NewJSArrayWithElements(elements));
+        // The arguments are passed to the replace function as they are, so
+        // don't wrap them in a JSArray.
+        builder.Add(*elements);
       } else {
         builder.Add(*match);
       }
@@ -1456,7 +1458,9 @@ V8_WARN_UNUSED_RESULT MaybeHandle<String> RegExpReplace(
       regexp->set_last_index(Smi::FromInt(end_index), SKIP_WRITE_BARRIER);
     }
 
-    IncrementalStringBuilder builder(isolate);
+    IncrementalStringBuilder builder(
+        isolate, string->length() - (end_index - start_index) +
+                     replace->length());
     builder.AppendString(factory->NewSubString(string, 0, start_index));
 
     if (replace->length() > 0) {
@@ -1598,7 +1602,7 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
     regexp->set_last_index(Smi::FromInt(end_of_match), SKIP_WRITE_BARRIER);
   }
 
-  IncrementalStringBuilder builder(isolate);
+  IncrementalStringBuilder builder(isolate, subject->length());
   builder.AppendString(factory->NewSubString(subject, 0, index));
 
   // Compute the parameter list consisting of the match, captures, index,
@@ -1931,7 +1935,7 @@ RUNTIME_FUNCTION(Runtime_RegExpReplaceRT) {
   }
 
   // TODO(jgruber): Look into ReplacementStringBuilder instead.
-  IncrementalStringBuilder builder(isolate);
+  IncrementalStringBuilder builder(isolate, string->length());
   uint32_t next_source_position = 0;
 
   for (const auto& result : results) {
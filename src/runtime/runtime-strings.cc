@@ -134,6 +134,29 @@ RUNTIME_FUNCTION(Runtime_StringReplaceOneCharWithString) {
   return isolate->StackOverflow();
 }
 
+RUNTIME_FUNCTION(Runtime_StringIndexOfConsString) {
+  // This is used by Wasm stringrefs.
+  SaveAndClearThreadInWasmFlag non_wasm_scope(isolate);
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<String> subject = args.at<String>(0);
+  Handle<String> search = args.at<String>(1);
+  int start_index = args.smi_value_at(2);
+  DCHECK(IsConsString(*subject));
+  return Smi::FromInt(String::IndexOf(isolate, subject, search, start_index));
+}
+
+RUNTIME_FUNCTION(Runtime_StringIsSubstringAtConsString) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<String> subject = args.at<String>(0);
+  Handle<String> search = args.at<String>(1);
+  int start_index = args.smi_value_at(2);
+  DCHECK(IsConsString(*subject));
+  return isolate->heap()->ToBoolean(
+      String::IsSubstringAt(isolate, subject, search, start_index));
+}
+
 RUNTIME_FUNCTION(Runtime_StringLastIndexOf) {
   HandleScope handle_scope(isolate);
   return String::LastIndexOf(isolate, args.at(0), args.at(1),
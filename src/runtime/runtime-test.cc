@@ -2086,6 +2086,36 @@ RUNTIME_FUNCTION(
       static_cast<uint32_t>(isolate->async_waiter_queue_nodes().size()));
 }
 
+RUNTIME_FUNCTION(Runtime_AtomicsMutexContentionStatsForTesting) {
+  HandleScope scope(isolate);
+  const Isolate::JSAtomicsMutexStats& stats =
+      isolate->js_atomics_mutex_stats();
+  Handle<JSObject> result =
+      isolate->factory()->NewJSObject(isolate->object_function());
+  JSObject::AddProperty(
+      isolate, result, "contended",
+      isolate->factory()->NewNumberFromSize(stats.contended), NONE);
+  JSObject::AddProperty(isolate, result, "spun",
+                        isolate->factory()->NewNumberFromSize(stats.spun),
+                        NONE);
+  JSObject::AddProperty(isolate, result, "parked",
+                        isolate->factory()->NewNumberFromSize(stats.parked),
+                        NONE);
+  JSObject::AddProperty(
+      isolate, result, "handedOff",
+      isolate->factory()->NewNumberFromSize(stats.handed_off), NONE);
+  return *result;
+}
+
+RUNTIME_FUNCTION(Runtime_AtomicsMutexSpinCountForTesting) {
+  HandleScope scope(isolate);
+  if (args.length() != 1 || !IsJSAtomicsMutex(args[0])) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  DirectHandle<JSAtomicsMutex> mutex = args.at<JSAtomicsMutex>(0);
+  return Smi::FromInt(mutex->SpinCountForTesting());
+}
+
 RUNTIME_FUNCTION(Runtime_GetWeakCollectionSize) {
   HandleScope scope(isolate);
   if (args.length() != 1 || !IsJSWeakCollection(args[0])) {
@@ -2,10 +2,19 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
@@ -95,6 +104,166 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Typed arrays with at least this many elements are radix sorted.
+constexpr size_t kRadixSortMinLength = 4096;
+// With --parallel-typed-array-sort, typed arrays with at least this many
+// elements are radix sorted in chunks of at least this many elements on
+// background threads.
+constexpr size_t kParallelRadixSortMinChunkLength = 256 * KB;
+
+// Returns an unsigned integer key for {value}, such that the keys are in the
+// same order as the values are in CompareNum.
+template <typename T>
+auto RadixSortKey(T value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    using Key = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+    static_assert(sizeof(Key) == sizeof(T));
+    constexpr Key kSignBit = Key{1} << (kBitsPerByte * sizeof(Key) - 1);
+    // NaN is greater than any number.
+    if (std::isnan(value)) return std::numeric_limits<Key>::max();
+    // Negative numbers, including -0.0, are less than positive numbers, and
+    // order the other way around.
+    Key bits = base::bit_cast<Key>(value);
+    return (bits & kSignBit) ? static_cast<Key>(~bits) : (bits | kSignBit);
+  } else {
+    using Key = std::make_unsigned_t<T>;
+    if constexpr (std::is_signed<T>::value) {
+      constexpr Key kSignBit = Key{1} << (kBitsPerByte * sizeof(Key) - 1);
+      return static_cast<Key>(static_cast<Key>(value) ^ kSignBit);
+    } else {
+      return value;
+    }
+  }
+}
+
+// Runs {work} for all chunks in [0, num_chunks) on the current thread and on
+// background threads.
+class RadixSortJob final : public JobTask {
+ public:
+  RadixSortJob(size_t num_chunks, const std::function<void(size_t)>& work)
+      : num_chunks_(num_chunks), work_(work) {}
+
+  void Run(JobDelegate* delegate) override {
+    for (size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+         chunk < num_chunks_;
+         chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed)) {
+      work_(chunk);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return worker_count +
+           (next_chunk < num_chunks_ ? num_chunks_ - next_chunk : 0);
+  }
+
+ private:
+  const size_t num_chunks_;
+  const std::function<void(size_t)>& work_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+void RunRadixSortChunks(size_t num_chunks,
+                        const std::function<void(size_t)>& work) {
+  if (num_chunks == 1) {
+    work(0);
+    return;
+  }
+  V8::GetCurrentPlatform()
+      ->CreateJob(TaskPriority::kUserBlocking,
+                  std::make_unique<RadixSortJob>(num_chunks, work))
+      ->Join();
+}
+
+size_t RadixSortChunks(size_t length, bool is_shared) {
+  if (!v8_flags.parallel_typed_array_sort || is_shared) return 1;
+  size_t max_chunks =
+      static_cast<size_t>(V8::GetCurrentPlatform()->NumberOfWorkerThreads()) +
+      1;
+  return std::max<size_t>(
+      1, std::min(max_chunks, length / kParallelRadixSortMinChunkLength));
+}
+
+// Stable LSD radix sort of {data} by RadixSortKey, one byte per pass. The
+// elements are split into {num_chunks} chunks, which are counted and
+// scattered in parallel.
+template <typename T>
+void RadixSort(T* data, size_t length, size_t num_chunks) {
+  using Key = decltype(RadixSortKey(T{}));
+  constexpr int kRadixBits = kBitsPerByte;
+  constexpr size_t kRadix = size_t{1} << kRadixBits;
+  constexpr int kPasses = sizeof(Key);
+  using Counts = std::array<size_t, kRadix>;
+  auto digit = [](T value, int pass) {
+    return static_cast<size_t>((RadixSortKey(value) >> (pass * kRadixBits)) &
+                               (kRadix - 1));
+  };
+  const size_t chunk_length = (length + num_chunks - 1) / num_chunks;
+  auto chunk_begin = [=](size_t chunk) {
+    return std::min(length, chunk * chunk_length);
+  };
+
+  // Count the digits of all passes in one go. The counts over all chunks do
+  // not depend on the order of the elements, so they are valid for all
+  // passes if there is a single chunk.
+  std::vector<std::array<Counts, kPasses>> counts(num_chunks);
+  RunRadixSortChunks(num_chunks, [&](size_t chunk) {
+    std::array<Counts, kPasses>& chunk_counts = counts[chunk];
+    for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+      Key key = RadixSortKey(data[i]);
+      for (int pass = 0; pass < kPasses; pass++) {
+        chunk_counts[pass][(key >> (pass * kRadixBits)) & (kRadix - 1)]++;
+      }
+    }
+  });
+
+  std::vector<T> buffer(length);
+  T* from = data;
+  T* to = buffer.data();
+  std::vector<Counts> offsets(num_chunks);
+  bool scattered = false;
+  for (int pass = 0; pass < kPasses; pass++) {
+    // Skip the pass if all elements have the same digit, which is common for
+    // the high bytes.
+    size_t first_digit = digit(from[0], pass);
+    size_t first_digit_count = 0;
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+      first_digit_count += counts[chunk][pass][first_digit];
+    }
+    if (first_digit_count == length) continue;
+
+    // The counts of the chunks change once elements have been scattered.
+    if (num_chunks > 1 && scattered) {
+      RunRadixSortChunks(num_chunks, [&](size_t chunk) {
+        Counts& chunk_counts = counts[chunk][pass];
+        chunk_counts.fill(0);
+        for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+          chunk_counts[digit(from[i], pass)]++;
+        }
+      });
+    }
+    // Elements go to the offset of their digit, and within a digit in chunk
+    // order, which keeps the sort stable.
+    size_t offset = 0;
+    for (size_t d = 0; d < kRadix; d++) {
+      for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        offsets[chunk][d] = offset;
+        offset += counts[chunk][pass][d];
+      }
+    }
+    RunRadixSortChunks(num_chunks, [&](size_t chunk) {
+      Counts& chunk_offsets = offsets[chunk];
+      for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+        T value = from[i];
+        to[chunk_offsets[digit(value, pass)]++] = value;
+      }
+    });
+    std::swap(from, to);
+    scattered = true;
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -150,9 +319,13 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array ||                 \
-        kExternal##Type##Array == kExternalFloat16Array) {                 \
+    if (kExternal##Type##Array != kExternalFloat16Array &&                 \
+        length >= kRadixSortMinLength &&                                   \
+        IsAligned(reinterpret_cast<Address>(data), alignof(ctype))) {      \
+      RadixSort(data, length, RadixSortChunks(length, copy_data));         \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array ||          \
+               kExternal##Type##Array == kExternalFloat16Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
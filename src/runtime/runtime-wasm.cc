@@ -17,6 +17,7 @@
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
 #include "src/strings/unicode-inl.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/trap-handler/trap-handler.h"
 #include "src/wasm/compilation-environment-inl.h"
 #include "src/wasm/module-compiler.h"
@@ -1394,7 +1395,7 @@ RUNTIME_FUNCTION(Runtime_WasmAllocateSuspender) {
                            isolate->root(RootIndex::kActiveContinuation)),
                        isolate);
   std::unique_ptr<wasm::StackMemory> target_stack =
-      isolate->stack_pool().GetOrAllocate();
+      isolate->stack_pool().GetOrAllocate(isolate);
   DirectHandle<WasmContinuationObject> target = WasmContinuationObject::New(
       isolate, target_stack.get(), wasm::JumpBuffer::Inactive, parent);
   target_stack->set_index(isolate->wasm_stacks().size());
@@ -1658,6 +1659,16 @@ int MeasureWtf8(base::Vector<const T> wtf16) {
   }
   return length;
 }
+int MeasureWtf8(base::Vector<const uint8_t> latin1) {
+  // Latin-1 characters take one byte if they are ASCII and two otherwise.
+  // Skip the ASCII prefix, which is usually the whole string, word-wise.
+  int length = static_cast<int>(latin1.size());
+  int utf8_length = length;
+  for (int i = NonAsciiStart(latin1.begin(), length); i < length; i++) {
+    if (latin1[i] > unibrow::Utf8::kMaxOneByteChar) utf8_length++;
+  }
+  return utf8_length;
+}
 int MeasureWtf8(Isolate* isolate, Handle<String> string) {
   string = String::Flatten(isolate, string);
   DisallowGarbageCollection no_gc;
@@ -1712,8 +1723,17 @@ int EncodeWtf8(base::Vector<char> bytes, size_t offset,
 
   char* dst_start = bytes.begin() + offset;
   char* dst = dst_start;
+  size_t i = 0;
+  if constexpr (sizeof(T) == 1) {
+    // ASCII characters encode as themselves, so copy the ASCII prefix of
+    // one-byte strings in bulk.
+    i = NonAsciiStart(wtf16.begin(), static_cast<int>(wtf16.size()));
+    MemCopy(dst, wtf16.begin(), i);
+    dst += i;
+  }
   int previous = unibrow::Utf16::kNoPreviousCharacter;
-  for (auto code_unit : wtf16) {
+  for (; i < wtf16.size(); i++) {
+    auto code_unit = wtf16[i];
     dst += unibrow::Utf8::Encode(dst, code_unit, previous, replace_invalid);
     previous = code_unit;
   }
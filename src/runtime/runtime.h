@@ -49,25 +49,27 @@ namespace internal {
   F(TransitionElementsKind, 2, 1)      \
   F(TransitionElementsKindWithKind, 2, 1)
 
-#define FOR_EACH_INTRINSIC_ATOMICS(F, I)                       \
-  F(AtomicsLoad64, 2, 1)                                       \
-  F(AtomicsStore64, 3, 1)                                      \
-  F(AtomicsAdd, 3, 1)                                          \
-  F(AtomicsAnd, 3, 1)                                          \
-  F(AtomicsCompareExchange, 4, 1)                              \
-  F(AtomicsExchange, 3, 1)                                     \
-  F(AtomicsNumWaitersForTesting, 2, 1)                         \
-  F(AtomicsNumUnresolvedAsyncPromisesForTesting, 2, 1)         \
-  F(AtomicsOr, 3, 1)                                           \
-  F(AtomicsSub, 3, 1)                                          \
-  F(AtomicsXor, 3, 1)                                          \
-  F(SetAllowAtomicsWait, 1, 1)                                 \
-  F(AtomicsLoadSharedStructOrArray, 2, 1)                      \
-  F(AtomicsStoreSharedStructOrArray, 3, 1)                     \
-  F(AtomicsExchangeSharedStructOrArray, 3, 1)                  \
-  F(AtomicsCompareExchangeSharedStructOrArray, 4, 1)           \
-  F(AtomicsSynchronizationPrimitiveNumWaitersForTesting, 1, 1) \
-  F(AtomicsSychronizationNumAsyncWaitersInIsolateForTesting, 0, 1)
+#define FOR_EACH_INTRINSIC_ATOMICS(F, I)                           \
+  F(AtomicsLoad64, 2, 1)                                           \
+  F(AtomicsStore64, 3, 1)                                          \
+  F(AtomicsAdd, 3, 1)                                              \
+  F(AtomicsAnd, 3, 1)                                              \
+  F(AtomicsCompareExchange, 4, 1)                                  \
+  F(AtomicsExchange, 3, 1)                                         \
+  F(AtomicsNumWaitersForTesting, 2, 1)                             \
+  F(AtomicsNumUnresolvedAsyncPromisesForTesting, 2, 1)             \
+  F(AtomicsOr, 3, 1)                                               \
+  F(AtomicsSub, 3, 1)                                              \
+  F(AtomicsXor, 3, 1)                                              \
+  F(SetAllowAtomicsWait, 1, 1)                                     \
+  F(AtomicsLoadSharedStructOrArray, 2, 1)                          \
+  F(AtomicsStoreSharedStructOrArray, 3, 1)                         \
+  F(AtomicsExchangeSharedStructOrArray, 3, 1)                      \
+  F(AtomicsCompareExchangeSharedStructOrArray, 4, 1)               \
+  F(AtomicsSynchronizationPrimitiveNumWaitersForTesting, 1, 1)     \
+  F(AtomicsSychronizationNumAsyncWaitersInIsolateForTesting, 0, 1) \
+  F(AtomicsMutexContentionStatsForTesting, 0, 1)                   \
+  F(AtomicsMutexSpinCountForTesting, 1, 1)
 
 #define FOR_EACH_INTRINSIC_BIGINT(F, I) \
   F(BigIntCompareToNumber, 3, 1)        \
@@ -366,6 +368,7 @@ namespace internal {
   F(ToObject, 1, 1)                                                    \
   F(ToString, 1, 1)                                                    \
   F(TryMigrateInstance, 1, 1)                                          \
+  F(TryMigrateReadMostlyToFast, 1, 1)                                  \
   F(SetPrivateMember, 3, 1)                                            \
   F(SwissTableAdd, 4, 1)                                               \
   F(SwissTableAllocate, 1, 1)                                          \
@@ -476,6 +479,8 @@ namespace internal {
   F(StringEscapeQuotes, 1, 1)             \
   F(StringGreaterThan, 2, 1)              \
   F(StringGreaterThanOrEqual, 2, 1)       \
+  F(StringIndexOfConsString, 3, 1)        \
+  F(StringIsSubstringAtConsString, 3, 1)  \
   F(StringIsWellFormed, 1, 1)             \
   F(StringLastIndexOf, 2, 1)              \
   F(StringLessThan, 2, 1)                 \
@@ -256,6 +256,19 @@ ExternalEntityTable<Entry, size>::Extend(Space* space) {
   return freelist_head;
 }
 
+template <typename Entry, size_t size>
+typename ExternalEntityTable<Entry, size>::Segment
+ExternalEntityTable<Entry, size>::ExtendWithUnsharedSegment(Space* space) {
+  DCHECK(space->BelongsTo(this));
+  DCHECK(!space->is_internal_read_only_space());
+
+  auto [segment, freelist_head] = this->AllocateAndInitializeSegment();
+  DCHECK_EQ(freelist_head.next(), segment.first_entry());
+  base::MutexGuard guard(&space->mutex_);
+  space->segments_.insert(segment);
+  return segment;
+}
+
 template <typename Entry, size_t size>
 void ExternalEntityTable<Entry, size>::Extend(Space* space, Segment segment,
                                               FreelistHead freelist) {
@@ -185,6 +185,14 @@ class V8_EXPORT_PRIVATE ExternalEntityTable
   // allocated segment.
   FreelistHead Extend(Space* space);
 
+  // Allocate a new segment and add it to the given space, without adding its
+  // entries to the freelist of the space.
+  //
+  // The caller is responsible for handing out the entries of the segment,
+  // which it may do until the space is next swept. The entries form a
+  // freelist, so sweeping frees the ones that were not handed out.
+  Segment ExtendWithUnsharedSegment(Space* space);
+
   // Sweeps the given space.
   //
   // This will free all unmarked entries to the freelist and unmark all live
@@ -4,8 +4,10 @@
 
 #include "src/sandbox/external-pointer-table.h"
 
+#include "include/v8-platform.h"
 #include "src/execution/isolate.h"
 #include "src/heap/read-only-spaces.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/sandbox/external-pointer-table-inl.h"
 
@@ -82,6 +84,48 @@ class SegmentsIterator {
   std::vector<Stream> streams_;
 };
 
+// Runs a callback for each of a number of independent work items on the
+// worker threads and the current thread, returning once all are done.
+class ParallelSweepingJob final : public JobTask {
+ public:
+  ParallelSweepingJob(size_t num_items, std::function<void(size_t)> callback)
+      : num_items_(num_items), callback_(std::move(callback)) {}
+
+  static void RunForEach(size_t num_items,
+                         std::function<void(size_t)> callback) {
+    // Below this number of segments, posting a job costs more than it saves.
+    static constexpr size_t kMinItemsForParallelSweeping = 4;
+    if (!v8_flags.parallel_external_pointer_table_sweeping ||
+        num_items < kMinItemsForParallelSweeping) {
+      for (size_t i = 0; i < num_items; i++) callback(i);
+      return;
+    }
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<ParallelSweepingJob>(num_items,
+                                                          std::move(callback)))
+        ->Join();
+  }
+
+  void Run(JobDelegate* delegate) override {
+    for (size_t i = next_item_.fetch_add(1, std::memory_order_relaxed);
+         i < num_items_;
+         i = next_item_.fetch_add(1, std::memory_order_relaxed)) {
+      callback_(i);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_item = next_item_.load(std::memory_order_relaxed);
+    return next_item < num_items_ ? num_items_ - next_item : 0;
+  }
+
+ private:
+  const size_t num_items_;
+  const std::function<void(size_t)> callback_;
+  std::atomic<size_t> next_item_{0};
+};
+
 uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
                                                           Space* from_space,
                                                           Counters* counters) {
@@ -141,27 +185,39 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
   // algorithm so that evacuated entries are evacuated to the start of a space.
   // This method must run either on the mutator thread or while the mutator is
   // stopped.
-  uint32_t current_freelist_head = 0;
-  uint32_t current_freelist_length = 0;
-  auto AddToFreelist = [&](uint32_t entry_index) {
-    at(entry_index).MakeFreelistEntry(current_freelist_head);
-    current_freelist_head = entry_index;
-    current_freelist_length++;
+  //
+  // Segments are swept independently of each other, possibly in parallel, and
+  // each one builds its own sorted freelist. These are then concatenated in
+  // order.
+  struct SegmentSweepingState {
+    Segment segment;
+    CompactionResult compaction;
+    bool will_be_evacuated;
+    uint32_t freelist_head = 0;
+    uint32_t freelist_tail = 0;
+    uint32_t freelist_length = 0;
   };
-
-  std::vector<Segment> segments_to_deallocate;
+  std::vector<SegmentSweepingState> segments;
   while (auto current = segments_iter.Next()) {
     Segment segment = current->first;
     CompactionResult compaction = current->second;
-
     bool segment_will_be_evacuated =
         compaction.success &&
         segment.first_entry() >= compaction.start_of_evacuation_area;
+    segments.push_back({segment, compaction, segment_will_be_evacuated});
+  }
+
+  auto SweepSegment = [&](SegmentSweepingState& state) {
+    Segment segment = state.segment;
+    CompactionResult compaction = state.compaction;
+    bool segment_will_be_evacuated = state.will_be_evacuated;
 
-    // Remember the state of the freelist before this segment in case this
-    // segment turns out to be completely empty and we deallocate it.
-    uint32_t previous_freelist_head = current_freelist_head;
-    uint32_t previous_freelist_length = current_freelist_length;
+    auto AddToFreelist = [&](uint32_t entry_index) {
+      at(entry_index).MakeFreelistEntry(state.freelist_head);
+      if (state.freelist_length == 0) state.freelist_tail = entry_index;
+      state.freelist_head = entry_index;
+      state.freelist_length++;
+    };
 
     // Process every entry in this segment, again going top to bottom.
     for (uint32_t i = segment.last_entry(); i >= segment.first_entry(); i--) {
@@ -212,8 +268,8 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
 
         // The entry must now contain an external pointer and be unmarked as
         // the entry that was evacuated must have been processed already (it
-        // is in an evacuated segment, which are processed first as they are
-        // at the end of the space). This will have cleared the marking bit.
+        // is in an evacuated segment, which are all swept before any other
+        // segment). This will have cleared the marking bit.
         DCHECK(at(i).GetRawPayload().ContainsPointer());
         DCHECK(!at(i).GetRawPayload().HasMarkBitSet());
       } else if (!payload.HasMarkBitSet()) {
@@ -229,19 +285,40 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
       // process them again during the next GC, which would cause problems.
       DCHECK(!at(i).HasEvacuationEntry());
     }
+  };
 
+  // Segments that will be evacuated are swept first, as resolving the
+  // evacuation entries in the other segments copies entries out of them.
+  std::vector<SegmentSweepingState*> evacuated_segments;
+  std::vector<SegmentSweepingState*> other_segments;
+  for (SegmentSweepingState& state : segments) {
+    (state.will_be_evacuated ? evacuated_segments : other_segments)
+        .push_back(&state);
+  }
+  for (auto* phase : {&evacuated_segments, &other_segments}) {
+    ParallelSweepingJob::RunForEach(
+        phase->size(),
+        [&SweepSegment, phase](size_t i) { SweepSegment(*(*phase)[i]); });
+  }
+
+  // Concatenate the freelists of the segments, from top to bottom.
+  uint32_t current_freelist_head = 0;
+  uint32_t current_freelist_length = 0;
+  std::vector<Segment> segments_to_deallocate;
+  for (const SegmentSweepingState& state : segments) {
     // If a segment is completely empty, or if all live entries will be
-    // evacuated out of it at the end of this loop, free the segment.
+    // evacuated out of it, free the segment.
     // Note: for segments that will be evacuated, we could avoid building up a
     // freelist, but it's probably not worth the effort.
-    uint32_t free_entries = current_freelist_length - previous_freelist_length;
-    bool segment_is_empty = free_entries == kEntriesPerSegment;
-    if (segment_is_empty || segment_will_be_evacuated) {
-      segments_to_deallocate.push_back(segment);
-      // Restore the state of the freelist before this segment.
-      current_freelist_head = previous_freelist_head;
-      current_freelist_length = previous_freelist_length;
+    bool segment_is_empty = state.freelist_length == kEntriesPerSegment;
+    if (segment_is_empty || state.will_be_evacuated) {
+      segments_to_deallocate.push_back(state.segment);
+      continue;
     }
+    if (state.freelist_length == 0) continue;
+    at(state.freelist_tail).MakeFreelistEntry(current_freelist_head);
+    current_freelist_head = state.freelist_head;
+    current_freelist_length += state.freelist_length;
   }
 
   space->segments_.merge(from_space_segments);
@@ -337,7 +337,9 @@ class V8_EXPORT_PRIVATE ExternalPointerTable
   // The from_space will be left empty with an empty free list.
   //
   // This method must only be called while mutator threads are stopped as it is
-  // not safe to allocate table entries while the table is being swept.
+  // not safe to allocate table entries while the table is being swept. Large
+  // spaces are swept by worker threads in parallel, see
+  // --parallel-external-pointer-table-sweeping.
   //
   // SweepAndCompact is the same as EvacuateAndSweepAndCompact, except without
   // the evacuation phase.
@@ -82,7 +82,7 @@ bool JSDispatchTable::HasCode(JSDispatchHandle handle) {
 JSDispatchHandle JSDispatchTable::AllocateAndInitializeEntry(
     Space* space, uint16_t parameter_count) {
   DCHECK(space->BelongsTo(this));
-  uint32_t index = AllocateEntry(space);
+  uint32_t index = AllocateEntryFromBatch(space);
   CFIMetadataWriteScope write_scope("JSDispatchTable initialize");
   at(index).MakeJSDispatchEntry(kNullAddress, kNullAddress, parameter_count,
                                 space->allocate_black());
@@ -98,7 +98,7 @@ JSDispatchHandle JSDispatchTable::AllocateAndInitializeEntry(
   CHECK(new_code->parameter_count() == kDontAdaptArgumentsSentinel ||
         new_code->parameter_count() == parameter_count);
 
-  uint32_t index = AllocateEntry(space);
+  uint32_t index = AllocateEntryFromBatch(space);
   JSDispatchEntry& entry = at(index);
   CFIMetadataWriteScope write_scope("JSDispatchTable initialize");
   entry.MakeJSDispatchEntry(kNullAddress, kNullAddress, parameter_count,
@@ -63,7 +63,59 @@ void JSDispatchTable::InitializePreAllocatedEntry(Space* space,
                                 parameter_count, space->allocate_black());
 }
 
+namespace {
+
+// The batch of entries of the current thread. Only one batch is kept per
+// thread, as threads rarely allocate entries in more than one space.
+struct EntryBatch {
+  const JSDispatchTable::Space* space = nullptr;
+  uint64_t epoch = 0;
+  uint32_t next = 0;
+  uint32_t end = 0;
+};
+thread_local EntryBatch current_entry_batch;
+
+std::atomic<uint64_t> next_batch_epoch{1};
+
+}  // namespace
+
+// static
+uint64_t JSDispatchTable::NextBatchEpoch() {
+  return next_batch_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t JSDispatchTable::AllocateEntryFromBatch(Space* space) {
+  if (!v8_flags.js_dispatch_table_thread_local_batches ||
+      space->is_internal_read_only_space()) {
+    return AllocateEntry(space);
+  }
+
+  // Entry allocation does not trigger GC, see AllocateEntry, so the space
+  // can't be swept while this thread allocates an entry.
+  DisallowGarbageCollection no_gc;
+
+  EntryBatch& batch = current_entry_batch;
+  const uint64_t epoch = space->batch_epoch_.load(std::memory_order_relaxed);
+  if (batch.space == space && batch.epoch == epoch && batch.next < batch.end) {
+    return batch.next++;
+  }
+
+  // Reuse the free entries of the space, which the previous GC left on its
+  // freelist, before taking more memory.
+  if (uint32_t index = AllocateEntryBelow(space, kMaxCapacity)) return index;
+
+  Segment segment = ExtendWithUnsharedSegment(space);
+  batch.space = space;
+  batch.epoch = epoch;
+  batch.next = segment.first_entry() + 1;
+  batch.end = segment.last_entry() + 1;
+  return segment.first_entry();
+}
+
 uint32_t JSDispatchTable::Sweep(Space* space, Counters* counters) {
+  // Entries that were not handed out from batches are still freelist
+  // entries, and are freed along with all other unmarked entries.
+  space->batch_epoch_.store(NextBatchEpoch(), std::memory_order_relaxed);
   uint32_t num_live_entries = GenericSweep(space);
   counters->js_dispatch_table_entries_count()->AddSample(num_live_entries);
   return num_live_entries;
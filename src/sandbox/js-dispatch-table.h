@@ -142,7 +142,12 @@ class V8_EXPORT_PRIVATE JSDispatchTable
   JSDispatchTable& operator=(const JSDispatchTable&) = delete;
 
   // The Spaces used by a JSDispatchTable.
-  using Space = Base::SpaceWithBlackAllocationSupport;
+  struct Space : public Base::SpaceWithBlackAllocationSupport {
+    // Identifies the entries that threads may allocate from their own batch,
+    // see AllocateEntryFromBatch. Sweeping the space changes the epoch, which
+    // invalidates all batches.
+    std::atomic<uint64_t> batch_epoch_{NextBatchEpoch()};
+  };
 
   // Retrieves the entrypoint of the entry referenced by the given handle.
   inline Address GetEntrypoint(JSDispatchHandle handle);
@@ -253,6 +258,18 @@ class V8_EXPORT_PRIVATE JSDispatchTable
   static base::LeakyObject<JSDispatchTable> instance_;
   static JSDispatchTable* instance_nocheck() { return instance_.get(); }
 
+  // Returns a process-wide unique epoch, so that a batch can't be mistaken for
+  // a batch of a later space at the same address.
+  static uint64_t NextBatchEpoch();
+
+  // Allocates an entry without contending with other threads when possible.
+  //
+  // Entries are allocated from the freelist of the space while it has any.
+  // Instead of extending the freelist of the space when it is empty, each
+  // thread gets a segment of its own and allocates its entries one after
+  // another, until the space is swept.
+  uint32_t AllocateEntryFromBatch(Space* space);
+
   static uint32_t HandleToIndex(JSDispatchHandle handle) {
     uint32_t index = handle >> kJSDispatchHandleShift;
     DCHECK_EQ(handle, index << kJSDispatchHandleShift);
@@ -24,6 +24,9 @@
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
 #include "src/snapshot/object-deserializer.h"
+#ifdef V8_SNAPSHOT_COMPRESSION
+#include "src/snapshot/snapshot-compression.h"
+#endif  // V8_SNAPSHOT_COMPRESSION
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/snapshot.h"
 #include "src/utils/version.h"
@@ -46,9 +49,30 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// Returns the function literal ids of the functions of |script| which have
+// bytecode, in increasing order.
+std::vector<uint32_t> CompiledFunctionsOf(Tagged<Script> script) {
+  std::vector<uint32_t> compiled_functions;
+  Tagged<WeakFixedArray> infos = script->infos();
+  for (int i = 0; i < infos->length(); ++i) {
+    Tagged<HeapObject> info;
+    if (infos->get(i).GetHeapObjectIfWeak(&info) &&
+        Is<SharedFunctionInfo>(info) &&
+        Cast<SharedFunctionInfo>(info)->HasBytecodeArray()) {
+      compiled_functions.push_back(i);
+    }
+  }
+  return compiled_functions;
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
-    Isolate* isolate, Handle<SharedFunctionInfo> info) {
+    Isolate* isolate, Handle<SharedFunctionInfo> info,
+    AlignedCachedData* previous_cache) {
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
   NestedTimedHistogramScope histogram_timer(
       isolate->counters()->compile_serialize());
@@ -76,6 +100,11 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
                                  source, script->origin_options()));
   DisallowGarbageCollection no_gc;
   cs.reference_map()->AddAttachedReference(*source);
+  if (previous_cache != nullptr &&
+      !cs.AttachBaseFunctions(*script, previous_cache)) {
+    return nullptr;
+  }
+  cs.compiled_functions_ = CompiledFunctionsOf(*script);
   AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
 
   if (v8_flags.profile_deserialization) {
@@ -93,6 +122,36 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   return result;
 }
 
+bool CodeSerializer::AttachBaseFunctions(Tagged<Script> script,
+                                         AlignedCachedData* previous_cache) {
+  SerializedCodeSanityCheckResult sanity_check_result =
+      SerializedCodeSanityCheckResult::kSuccess;
+  const SerializedCodeData previous =
+      SerializedCodeData::FromCachedDataForDelta(
+          isolate(), previous_cache, source_hash_, &sanity_check_result);
+  if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+    return false;
+  }
+  // The functions compiled in the previous cache are compiled in the script
+  // the delta is applied to, so their bytecode is referenced rather than
+  // serialized again. Functions which have been flushed here since are
+  // serialized as uncompiled.
+  Tagged<WeakFixedArray> infos = script->infos();
+  for (uint32_t id : previous.CompiledFunctions()) {
+    if (id >= static_cast<uint32_t>(infos->length())) return false;
+    Tagged<HeapObject> info;
+    if (!infos->get(id).GetHeapObjectIfWeak(&info) ||
+        !Is<SharedFunctionInfo>(info) ||
+        !Cast<SharedFunctionInfo>(info)->HasBytecodeArray()) {
+      continue;
+    }
+    reference_map()->AddAttachedReference(
+        Cast<SharedFunctionInfo>(info)->GetBytecodeArray(isolate()));
+    base_functions_.push_back(id);
+  }
+  return true;
+}
+
 AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
   DisallowGarbageCollection no_gc;
@@ -102,6 +161,17 @@ AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
   SerializeDeferredObjects();
   Pad();
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (v8_flags.compress_code_cache) {
+    SnapshotData compressed =
+        SnapshotCompression::Compress(base::VectorOf(*sink_.data()));
+    const std::vector<uint8_t> payload(compressed.RawData().begin(),
+                                       compressed.RawData().end());
+    SerializedCodeData data(&payload, this);
+    return data.GetScriptData();
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
   SerializedCodeData data(sink_.data(), this);
 
   return data.GetScriptData();
@@ -178,7 +248,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
               debug_info->OriginalBytecodeArray(isolate()), isolate());
         }
       }
-      if (v8_flags.profile_guided_optimization) {
+      // Unless requested otherwise, only the decision to tier up to Sparkplug
+      // early is cached. The optimization decisions are made on feedback that
+      // the deserializing isolate has yet to collect.
+      if (v8_flags.profile_guided_optimization &&
+          !v8_flags.profile_guided_optimization_in_code_cache) {
         cached_tiering_decision = sfi->cached_tiering_decision();
         if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
           sfi->set_cached_tiering_decision(
@@ -194,6 +268,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                   isolate());
     }
     if (v8_flags.profile_guided_optimization &&
+        !v8_flags.profile_guided_optimization_in_code_cache &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
     }
@@ -226,6 +301,8 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
   if (V8_UNLIKELY(v8_flags.interpreted_frames_native_stack) &&
       IsInterpreterData(*obj)) {
     obj = handle(Cast<InterpreterData>(*obj)->bytecode_array(), isolate());
+    // The bytecode array may be attached in a delta.
+    if (SerializeBackReference(*obj)) return;
   }
 
   // Past this point we should not see any (context-specific) maps anymore.
@@ -336,8 +413,7 @@ class StressOffThreadDeserializeThread final : public base::Thread {
 
 void FinalizeDeserialization(Isolate* isolate,
                              DirectHandle<SharedFunctionInfo> result,
-                             const base::ElapsedTimer& timer,
-                             const ScriptDetails& script_details) {
+                             const base::ElapsedTimer& timer) {
   // Devtools can report time in this function as profiler overhead, since none
   // of the following tasks would need to happen normally.
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -351,12 +427,6 @@ void FinalizeDeserialization(Isolate* isolate,
   }
 
   DirectHandle<Script> script(Cast<Script>(result->script()), isolate);
-  // Reset the script details, including host-defined options.
-  {
-    DisallowGarbageCollection no_gc;
-    SetScriptFieldsFromDetails(isolate, *script, script_details, &no_gc);
-  }
-
   bool needs_source_positions = isolate->NeedsSourcePositions();
   if (!log_code_creation && !needs_source_positions) return;
 
@@ -397,6 +467,19 @@ void FinalizeDeserialization(Isolate* isolate,
   }
 }
 
+void FinalizeDeserialization(Isolate* isolate,
+                             DirectHandle<SharedFunctionInfo> result,
+                             const base::ElapsedTimer& timer,
+                             const ScriptDetails& script_details) {
+  // Reset the script details, including host-defined options.
+  {
+    DisallowGarbageCollection no_gc;
+    SetScriptFieldsFromDetails(isolate, Cast<Script>(result->script()),
+                               script_details, &no_gc);
+  }
+  FinalizeDeserialization(isolate, result, timer);
+}
+
 #ifdef V8_ENABLE_SPARKPLUG
 void BaselineBatchCompileIfSparkplugCompiled(Isolate* isolate,
                                              Tagged<Script> script) {
@@ -414,8 +497,41 @@ void BaselineBatchCompileIfSparkplugCompiled(Isolate* isolate,
     }
   }
 }
+
+// The off-thread part of BaselineBatchCompileIfSparkplugCompiled: collects the
+// functions whose cached tiering decision asks for early Sparkplug code.
+void CollectBaselineBatchCompileCandidates(
+    LocalIsolate* isolate, DirectHandle<Script> script,
+    std::vector<Handle<SharedFunctionInfo>>* candidates) {
+  if (v8_flags.concurrent_sparkplug && v8_flags.baseline_batch_compilation) {
+    SharedFunctionInfo::ScriptIterator iter(handle(script->infos(), isolate));
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info->cached_tiering_decision() != CachedTieringDecision::kPending &&
+          info->HasBytecodeArray()) {
+        candidates->push_back(isolate->heap()->NewPersistentHandle(info));
+      }
+    }
+  }
+}
+
+// The main-thread part: the checks which depend on the debugger state.
+void EnqueueBaselineBatchCompileCandidates(
+    Isolate* isolate,
+    const std::vector<Handle<SharedFunctionInfo>>& candidates) {
+  for (DirectHandle<SharedFunctionInfo> info : candidates) {
+    if (CanCompileWithBaseline(isolate, *info)) {
+      isolate->baseline_batch_compiler()->EnqueueSFI(*info);
+    }
+  }
+}
 #else
 void BaselineBatchCompileIfSparkplugCompiled(Isolate*, Tagged<Script>) {}
+void CollectBaselineBatchCompileCandidates(
+    LocalIsolate*, DirectHandle<Script>,
+    std::vector<Handle<SharedFunctionInfo>>*) {}
+void EnqueueBaselineBatchCompileCandidates(
+    Isolate*, const std::vector<Handle<SharedFunctionInfo>>&) {}
 #endif  // V8_ENABLE_SPARKPLUG
 
 const char* ToString(SerializedCodeSanityCheckResult result) {
@@ -438,6 +554,8 @@ const char* ToString(SerializedCodeSanityCheckResult result) {
       return "length mismatch";
     case SerializedCodeSanityCheckResult::kReadOnlySnapshotChecksumMismatch:
       return "read-only snapshot checksum mismatch";
+    case SerializedCodeSanityCheckResult::kDeltaBaseMismatch:
+      return "delta base mismatch";
   }
 }
 }  // namespace
@@ -556,6 +674,12 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
   MaybeHandle<SharedFunctionInfo> local_maybe_result =
       OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
           local_isolate, &scd, &result.scripts);
+  if (!local_maybe_result.is_null()) {
+    DCHECK_EQ(result.scripts.size(), 1);
+    CollectBaselineBatchCompileCandidates(
+        local_isolate, result.scripts[0],
+        &result.baseline_batch_compile_candidates);
+  }
 
   result.maybe_result =
       local_isolate->heap()->NewPersistentMaybeHandle(local_maybe_result);
@@ -644,12 +768,13 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     Handle<WeakArrayList> list = isolate->factory()->script_list();
     for (Handle<Script> script : data.scripts) {
       script->set_deserialized(true);
-      BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
       DCHECK(data.persistent_handles->Contains(script.location()));
       list = WeakArrayList::AddToEnd(isolate, list,
                                      MaybeObjectHandle::Weak(script));
     }
     isolate->heap()->SetRootScriptList(*list);
+    EnqueueBaselineBatchCompileCandidates(
+        isolate, data.baseline_batch_compile_candidates);
   }
 
   if (v8_flags.profile_deserialization) {
@@ -667,12 +792,103 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
   return scope.CloseAndEscape(result);
 }
 
+// static
+bool CodeSerializer::DeserializeDelta(
+    Isolate* isolate, AlignedCachedData* cached_data,
+    DirectHandle<SharedFunctionInfo> toplevel) {
+  base::ElapsedTimer timer;
+  if (v8_flags.profile_deserialization || v8_flags.log_function_events) {
+    timer.Start();
+  }
+
+  HandleScope scope(isolate);
+  Handle<Script> script(Cast<Script>(toplevel->script()), isolate);
+  Handle<String> source(Cast<String>(script->source()), isolate);
+
+  SerializedCodeSanityCheckResult sanity_check_result =
+      SerializedCodeSanityCheckResult::kSuccess;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedDataForDelta(
+      isolate, cached_data,
+      SerializedCodeData::SourceHash(source, script->origin_options()),
+      &sanity_check_result);
+  // The delta refers to the bytecode of the functions compiled in the caches
+  // it builds on, which have to be compiled in the script still.
+  std::vector<Handle<BytecodeArray>> base_bytecode;
+  if (sanity_check_result == SerializedCodeSanityCheckResult::kSuccess) {
+    DisallowGarbageCollection no_gc;
+    Tagged<WeakFixedArray> infos = script->infos();
+    for (uint32_t id : scd.BaseFunctions()) {
+      Tagged<HeapObject> info;
+      if (id >= static_cast<uint32_t>(infos->length()) ||
+          !infos->get(id).GetHeapObjectIfWeak(&info) ||
+          !Is<SharedFunctionInfo>(info) ||
+          !Cast<SharedFunctionInfo>(info)->HasBytecodeArray()) {
+        sanity_check_result =
+            SerializedCodeSanityCheckResult::kDeltaBaseMismatch;
+        cached_data->Reject();
+        break;
+      }
+      base_bytecode.push_back(handle(
+          Cast<SharedFunctionInfo>(info)->GetBytecodeArray(isolate), isolate));
+    }
+  }
+  if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+    if (v8_flags.profile_deserialization) {
+      PrintF("[Cached code failed check: %s]\n", ToString(sanity_check_result));
+    }
+    DCHECK(cached_data->rejected());
+    isolate->counters()->code_cache_reject_reason()->AddSample(
+        static_cast<int>(sanity_check_result));
+    return false;
+  }
+
+  MaybeHandle<SharedFunctionInfo> maybe_result =
+      ObjectDeserializer::DeserializeSharedFunctionInfo(isolate, &scd, source,
+                                                        base_bytecode);
+  Handle<SharedFunctionInfo> result;
+  if (!maybe_result.ToHandle(&result)) {
+    if (v8_flags.profile_deserialization) PrintF("[Deserializing failed]\n");
+    return false;
+  }
+
+  // Merge the functions compiled in the delta into the script, the same way
+  // as a cache consumed for a script from the Isolate compilation cache.
+  BackgroundMergeTask merge;
+  merge.SetUpOnMainThread(isolate, script);
+  CHECK(merge.HasPendingBackgroundWork());
+  DirectHandle<Script> new_script(Cast<Script>(result->script()), isolate);
+  merge.BeginMergeInBackground(isolate->AsLocalIsolate(), new_script);
+  CHECK(merge.HasPendingForegroundWork());
+  result = merge.CompleteMergeInForeground(isolate, new_script);
+  DCHECK_EQ(*result, *toplevel);
+
+  BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
+  if (v8_flags.profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Applying delta of %d bytes took %0.3f ms]\n", length, ms);
+  }
+
+  FinalizeDeserialization(isolate, result, timer);
+  return true;
+}
+
 SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
                                        const CodeSerializer* cs) {
   DisallowGarbageCollection no_gc;
 
   // Calculate sizes.
-  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size());
+  const std::vector<uint32_t>& compiled_functions = cs->compiled_functions();
+  const std::vector<uint32_t>& base_functions = cs->base_functions();
+  // The function table is padded to keep the size aligned, since a compressed
+  // payload is not.
+  uint32_t payload_length = static_cast<uint32_t>(payload->size());
+  uint32_t function_table_length =
+      static_cast<uint32_t>(POINTER_SIZE_ALIGN(
+          payload_length + (2 + compiled_functions.size() +
+                            base_functions.size()) * kUInt32Size)) -
+      payload_length;
+  uint32_t size = kHeaderSize + payload_length + function_table_length;
   DCHECK(IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
@@ -689,7 +905,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   SetHeaderValue(kReadOnlySnapshotChecksumOffset,
                  Snapshot::ExtractReadOnlySnapshotChecksum(
                      cs->isolate()->snapshot_blob()));
-  SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kPayloadLengthOffset, payload_length);
+  SetHeaderValue(kFunctionTableLengthOffset, function_table_length);
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
@@ -697,6 +914,20 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   // Copy serialized data.
   CopyBytes(data_ + kHeaderSize, payload->data(),
             static_cast<size_t>(payload->size()));
+
+  // Write the function table, zeroing out its padding.
+  uint32_t function_table_offset = kHeaderSize + payload_length;
+  memset(data_ + function_table_offset, 0, function_table_length);
+  for (const std::vector<uint32_t>* functions :
+       {&compiled_functions, &base_functions}) {
+    SetHeaderValue(function_table_offset,
+                   static_cast<uint32_t>(functions->size()));
+    function_table_offset += kUInt32Size;
+    for (uint32_t id : *functions) {
+      SetHeaderValue(function_table_offset, id);
+      function_table_offset += kUInt32Size;
+    }
+  }
   uint32_t checksum =
       v8_flags.verify_snapshot_checksum ? Checksum(ChecksummedContent()) : 0;
   SetHeaderValue(kChecksumOffset, checksum);
@@ -743,8 +974,21 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
     return SerializedCodeSanityCheckResult::kReadOnlySnapshotChecksumMismatch;
   }
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
+  uint32_t function_table_length = GetHeaderValue(kFunctionTableLengthOffset);
   uint32_t max_payload_length = size_ - kHeaderSize;
-  if (payload_length > max_payload_length) {
+  if (payload_length > max_payload_length ||
+      function_table_length != max_payload_length - payload_length) {
+    return SerializedCodeSanityCheckResult::kLengthMismatch;
+  }
+  // Both function lists, with their counts, have to fit the function table.
+  uint32_t function_table_size = function_table_length / kUInt32Size;
+  if (function_table_size < 2) {
+    return SerializedCodeSanityCheckResult::kLengthMismatch;
+  }
+  uint32_t compiled_count = GetFunctionTableValue(0);
+  if (compiled_count > function_table_size - 2 ||
+      GetFunctionTableValue(compiled_count + 1) >
+          function_table_size - 2 - compiled_count) {
     return SerializedCodeSanityCheckResult::kLengthMismatch;
   }
   if (v8_flags.verify_snapshot_checksum) {
@@ -781,10 +1025,48 @@ base::Vector<const uint8_t> SerializedCodeData::Payload() const {
   const uint8_t* payload = data_ + kHeaderSize;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
-  DCHECK_EQ(data_ + size_, payload + length);
+  DCHECK_EQ(data_ + size_,
+            payload + length + GetHeaderValue(kFunctionTableLengthOffset));
   return base::Vector<const uint8_t>(payload, length);
 }
 
+SnapshotData SerializedCodeData::PayloadData() const {
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (v8_flags.compress_code_cache) {
+    return SnapshotCompression::Decompress(Payload());
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+  return SnapshotData(Payload());
+}
+
+uint32_t SerializedCodeData::GetFunctionTableValue(uint32_t index) const {
+  return GetHeaderValue(kHeaderSize + GetHeaderValue(kPayloadLengthOffset) +
+                        index * kUInt32Size);
+}
+
+std::vector<uint32_t> SerializedCodeData::CompiledFunctions() const {
+  uint32_t count = GetFunctionTableValue(0);
+  std::vector<uint32_t> functions(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    functions[i] = GetFunctionTableValue(1 + i);
+  }
+  return functions;
+}
+
+std::vector<uint32_t> SerializedCodeData::BaseFunctions() const {
+  uint32_t start = GetFunctionTableValue(0) + 1;
+  uint32_t count = GetFunctionTableValue(start);
+  std::vector<uint32_t> functions(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    functions[i] = GetFunctionTableValue(start + 1 + i);
+  }
+  return functions;
+}
+
+bool SerializedCodeData::IsDelta() const {
+  return GetFunctionTableValue(GetFunctionTableValue(0) + 1) != 0;
+}
+
 SerializedCodeData::SerializedCodeData(AlignedCachedData* data)
     : SerializedData(const_cast<uint8_t*>(data->data()), data->length()) {}
 
@@ -794,6 +1076,26 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SerializedCodeSanityCheckResult* rejection_result) {
   DisallowGarbageCollection no_gc;
   SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheck(
+      Snapshot::ExtractReadOnlySnapshotChecksum(isolate->snapshot_blob()),
+      expected_source_hash);
+  if (*rejection_result == SerializedCodeSanityCheckResult::kSuccess &&
+      scd.IsDelta()) {
+    *rejection_result = SerializedCodeSanityCheckResult::kDeltaBaseMismatch;
+  }
+  if (*rejection_result != SerializedCodeSanityCheckResult::kSuccess) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
+SerializedCodeData SerializedCodeData::FromCachedDataForDelta(
+    Isolate* isolate, AlignedCachedData* cached_data,
+    uint32_t expected_source_hash,
+    SerializedCodeSanityCheckResult* rejection_result) {
+  DisallowGarbageCollection no_gc;
+  SerializedCodeData scd(cached_data);
   *rejection_result = scd.SanityCheck(
       Snapshot::ExtractReadOnlySnapshotChecksum(isolate->snapshot_blob()),
       expected_source_hash);
@@ -812,6 +1114,10 @@ SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
   *rejection_result =
       scd.SanityCheckWithoutSource(Snapshot::ExtractReadOnlySnapshotChecksum(
           local_isolate->snapshot_blob()));
+  if (*rejection_result == SerializedCodeSanityCheckResult::kSuccess &&
+      scd.IsDelta()) {
+    *rejection_result = SerializedCodeSanityCheckResult::kDeltaBaseMismatch;
+  }
   if (*rejection_result != SerializedCodeSanityCheckResult::kSuccess) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
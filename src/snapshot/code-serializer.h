@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -55,8 +57,14 @@ typedef v8::ScriptCompiler::CachedData::CompatibilityCheckResult
 
 // If this fails, update the static_assert AND the code_cache_reject_reason
 // histogram definition.
-static_assert(static_cast<int>(SerializedCodeSanityCheckResult::kLast) == 9);
-
+static_assert(static_cast<int>(SerializedCodeSanityCheckResult::kLast) == 10);
+
+// Serializes the bytecode, SharedFunctionInfos and Scripts of a script for
+// the code cache. Feedback is not serialized: feedback vectors belong to
+// closures rather than SharedFunctionInfos, and their maps, call targets and
+// allocation sites are specific to the native context that collected them.
+// Only the CachedTieringDecision of each SharedFunctionInfo carries profile
+// information over (see --profile-guided-optimization-in-code-cache).
 class CodeSerializer : public Serializer {
  public:
   struct OffThreadDeserializeData {
@@ -70,12 +78,21 @@ class CodeSerializer : public Serializer {
     std::vector<Handle<Script>> scripts;
     std::unique_ptr<PersistentHandles> persistent_handles;
     SerializedCodeSanityCheckResult sanity_check_result;
+    // The functions to batch compile with Sparkplug, which are collected
+    // off-thread so that the main thread only has to enqueue them.
+    std::vector<Handle<SharedFunctionInfo>> baseline_batch_compile_candidates;
   };
 
   CodeSerializer(const CodeSerializer&) = delete;
   CodeSerializer& operator=(const CodeSerializer&) = delete;
+  // Serializes the script of |info|. If |previous_cache| is given, this
+  // serializes a delta on top of it, which takes the bytecode of the functions
+  // compiled in |previous_cache| from the script it is applied to. Returns
+  // nullptr if the script cannot be serialized, or |previous_cache| does not
+  // belong to it.
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
-      Isolate* isolate, Handle<SharedFunctionInfo> info);
+      Isolate* isolate, Handle<SharedFunctionInfo> info,
+      AlignedCachedData* previous_cache = nullptr);
 
   AlignedCachedData* SerializeSharedFunctionInfo(
       Handle<SharedFunctionInfo> info);
@@ -96,7 +113,20 @@ class CodeSerializer : public Serializer {
       const ScriptDetails& script_details,
       BackgroundMergeTask* background_merge_task = nullptr);
 
+  // Applies a delta created by Serialize on top of a previous cache to the
+  // script of |toplevel|, which was deserialized from that previous cache.
+  // Returns false and rejects |cached_data| if the delta does not apply.
+  V8_EXPORT_PRIVATE static bool DeserializeDelta(
+      Isolate* isolate, AlignedCachedData* cached_data,
+      DirectHandle<SharedFunctionInfo> toplevel);
+
   uint32_t source_hash() const { return source_hash_; }
+  const std::vector<uint32_t>& compiled_functions() const {
+    return compiled_functions_;
+  }
+  const std::vector<uint32_t>& base_functions() const {
+    return base_functions_;
+  }
 
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
@@ -107,8 +137,23 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  // Attaches the bytecode of the functions which are compiled both in
+  // |previous_cache| and in |script|. Returns false if |previous_cache| does
+  // not belong to the script.
+  bool AttachBaseFunctions(Tagged<Script> script,
+                           AlignedCachedData* previous_cache);
+
+  // The compile hints are kept in the cache, so that a script consumed from the
+  // cache continues collecting them where the cached one left off.
+  bool SerializesCompileHints() const override { return true; }
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  // The function literal ids of the functions which are compiled once the
+  // cache is applied, and of the functions whose bytecode a delta takes from
+  // the script it is applied to instead of serializing it.
+  std::vector<uint32_t> compiled_functions_;
+  std::vector<uint32_t> base_functions_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -122,7 +167,10 @@ class SerializedCodeData : public SerializedData {
       kFlagHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset =
       kReadOnlySnapshotChecksumOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kFunctionTableLengthOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset =
+      kFunctionTableLengthOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
@@ -143,6 +191,14 @@ class SerializedCodeData : public SerializedData {
       AlignedCachedData* cached_data, uint32_t expected_source_hash,
       SerializedCodeSanityCheckResult* rejection_result);
 
+  // For cached data which a delta is created on top of, or which is applied
+  // to a script that was deserialized from the cache it builds on. Unlike the
+  // above, this accepts deltas.
+  static SerializedCodeData FromCachedDataForDelta(
+      Isolate* isolate, AlignedCachedData* cached_data,
+      uint32_t expected_source_hash,
+      SerializedCodeSanityCheckResult* rejection_result);
+
   // Used when producing.
   SerializedCodeData(const std::vector<uint8_t>* payload,
                      const CodeSerializer* cs);
@@ -151,6 +207,19 @@ class SerializedCodeData : public SerializedData {
   AlignedCachedData* GetScriptData();
 
   base::Vector<const uint8_t> Payload() const;
+  // Returns the payload to deserialize. With --compress-code-cache, which
+  // the flag hash check makes consistent between producer and consumer, it
+  // is decompressed into the returned data.
+  SnapshotData PayloadData() const;
+
+  // The function table follows the payload. It lists the compiled functions
+  // and the base functions of the cache (see CodeSerializer), each as a
+  // uint32_t count followed by the function literal ids.
+  std::vector<uint32_t> CompiledFunctions() const;
+  std::vector<uint32_t> BaseFunctions() const;
+  // Whether the cache is a delta, which refers to bytecode of the script it
+  // is applied to.
+  bool IsDelta() const;
 
   static uint32_t SourceHash(DirectHandle<String> source,
                              ScriptOriginOptions origin_options);
@@ -165,6 +234,9 @@ class SerializedCodeData : public SerializedData {
                                        size_ - kHeaderSize);
   }
 
+  // Returns the function table entry at |index|, in uint32_t units.
+  uint32_t GetFunctionTableValue(uint32_t index) const;
+
   SerializedCodeSanityCheckResult SanityCheck(
       uint32_t expected_ro_snapshot_checksum,
       uint32_t expected_source_hash) const;
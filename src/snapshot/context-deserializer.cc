@@ -7,6 +7,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/common/assert-scope.h"
+#include "src/init/startup-timings.h"
 #include "src/logging/counters-scopes.h"
 #include "src/snapshot/serializer-deserializer.h"
 
@@ -24,6 +25,8 @@ MaybeHandle<Context> ContextDeserializer::DeserializeContext(
   if (V8_UNLIKELY(v8_flags.profile_deserialization)) timer.Start();
   NestedTimedHistogramScope histogram_timer(
       isolate->counters()->snapshot_deserialize_context());
+  StartupTimings::Scope startup_timings_scope(
+      isolate, StartupTimings::Phase::kContextDeserialization);
 
   ContextDeserializer d(isolate, data, can_rehash);
   MaybeHandle<Object> maybe_result =
@@ -62,10 +65,14 @@ MaybeHandle<Object> ContextDeserializer::Deserialize(
     result = ReadObject();
     DCHECK(IsNativeContext(*result));
     DeserializeDeferredObjects();
-    DeserializeEmbedderFields(Cast<NativeContext>(result),
-                              embedder_fields_deserializer);
-    DeserializeApiWrapperFields(
-        embedder_fields_deserializer.api_wrapper_callback);
+    {
+      StartupTimings::Scope startup_timings_scope(
+          isolate, StartupTimings::Phase::kEmbedderCallbacks);
+      DeserializeEmbedderFields(Cast<NativeContext>(result),
+                                embedder_fields_deserializer);
+      DeserializeApiWrapperFields(
+          embedder_fields_deserializer.api_wrapper_callback);
+    }
     LogNewMapEvents();
     WeakenDescriptorArrays();
   }
@@ -15,16 +15,21 @@ namespace v8 {
 namespace internal {
 
 ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
-                                       const SerializedCodeData* data)
-    : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
-                   false) {}
+                                       base::Vector<const uint8_t> payload,
+                                       uint32_t magic_number)
+    : Deserializer(isolate, payload, magic_number, true, false) {}
 
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfo(
-    Isolate* isolate, const SerializedCodeData* data, Handle<String> source) {
-  ObjectDeserializer d(isolate, data);
+    Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+    const std::vector<Handle<BytecodeArray>>& base_bytecode) {
+  SnapshotData payload = data->PayloadData();
+  ObjectDeserializer d(isolate, payload.RawData(), data->GetMagicNumber());
 
   d.AddAttachedObject(source);
+  for (Handle<BytecodeArray> bytecode : base_bytecode) {
+    d.AddAttachedObject(bytecode);
+  }
 
   Handle<HeapObject> result;
   return d.Deserialize().ToHandle(&result) ? Cast<SharedFunctionInfo>(result)
@@ -82,15 +87,17 @@ void ObjectDeserializer::LinkAllocationSites() {
 }
 
 OffThreadObjectDeserializer::OffThreadObjectDeserializer(
-    LocalIsolate* isolate, const SerializedCodeData* data)
-    : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
-                   false) {}
+    LocalIsolate* isolate, base::Vector<const uint8_t> payload,
+    uint32_t magic_number)
+    : Deserializer(isolate, payload, magic_number, true, false) {}
 
 MaybeHandle<SharedFunctionInfo>
 OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
     LocalIsolate* isolate, const SerializedCodeData* data,
     std::vector<Handle<Script>>* deserialized_scripts) {
-  OffThreadObjectDeserializer d(isolate, data);
+  SnapshotData payload = data->PayloadData();
+  OffThreadObjectDeserializer d(isolate, payload.RawData(),
+                                data->GetMagicNumber());
 
   // Attach the empty string as the source.
   d.AddAttachedObject(isolate->factory()->empty_string());
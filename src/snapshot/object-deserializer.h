@@ -10,17 +10,22 @@
 namespace v8 {
 namespace internal {
 
+class BytecodeArray;
 class SerializedCodeData;
 class SharedFunctionInfo;
 
 // Deserializes the object graph rooted at a given object.
 class ObjectDeserializer final : public Deserializer<Isolate> {
  public:
+  // |base_bytecode| is attached after the source, for a code cache delta
+  // which refers to the bytecode of the script it is applied to.
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
-      Isolate* isolate, const SerializedCodeData* data, Handle<String> source);
+      Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+      const std::vector<Handle<BytecodeArray>>& base_bytecode = {});
 
  private:
-  explicit ObjectDeserializer(Isolate* isolate, const SerializedCodeData* data);
+  ObjectDeserializer(Isolate* isolate, base::Vector<const uint8_t> payload,
+                     uint32_t magic_number);
 
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
@@ -37,8 +42,9 @@ class OffThreadObjectDeserializer final : public Deserializer<LocalIsolate> {
       std::vector<Handle<Script>>* deserialized_scripts);
 
  private:
-  explicit OffThreadObjectDeserializer(LocalIsolate* isolate,
-                                       const SerializedCodeData* data);
+  OffThreadObjectDeserializer(LocalIsolate* isolate,
+                              base::Vector<const uint8_t> payload,
+                              uint32_t magic_number);
 
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize(
@@ -836,8 +836,10 @@ void Serializer::ObjectSerializer::Serialize(SlotType slot_type) {
   if (InstanceTypeChecker::IsScript(instance_type)) {
     // Clear cached line ends & compiled lazy function positions.
     Cast<Script>(object_)->set_line_ends(Smi::zero());
-    Cast<Script>(object_)->set_compiled_lazy_function_positions(
-        ReadOnlyRoots(isolate()).undefined_value());
+    if (!serializer_->SerializesCompileHints()) {
+      Cast<Script>(object_)->set_compiled_lazy_function_positions(
+          ReadOnlyRoots(isolate()).undefined_value());
+    }
   }
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -239,6 +239,10 @@ class Serializer : public SerializerDeserializer {
 
   virtual bool MustBeDeferred(Tagged<HeapObject> object);
 
+  // Whether the compile hints collected on Scripts (their compiled lazy
+  // function positions) are serialized. Otherwise they are cleared.
+  virtual bool SerializesCompileHints() const { return false; }
+
   void VisitRootPointers(Root root, const char* description,
                          FullObjectSlot start, FullObjectSlot end) override;
   void SerializeRootObject(FullObjectSlot slot);
@@ -20,15 +20,18 @@ uint32_t GetUncompressedSize(const Bytef* compressed_data) {
 
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  return Compress(uncompressed_data->RawData());
+}
+
+SnapshotData SnapshotCompression::Compress(
+    base::Vector<const uint8_t> uncompressed_data) {
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
+  const uLongf input_size = static_cast<uLongf>(uncompressed_data.size());
+  uint32_t payload_length = static_cast<uint32_t>(uncompressed_data.size());
 
   uLongf compressed_data_size = compressBound(input_size);
 
@@ -46,7 +49,7 @@ SnapshotData SnapshotCompression::Compress(
       zlib_internal::CompressHelper(
           zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
           &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
+          reinterpret_cast<const Bytef*>(uncompressed_data.begin()),
           input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
       Z_OK);
 
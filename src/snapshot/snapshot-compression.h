@@ -15,6 +15,8 @@ class SnapshotCompression : public AllStatic {
  public:
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      base::Vector<const uint8_t> uncompressed_data);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       base::Vector<const uint8_t> compressed_data);
 };
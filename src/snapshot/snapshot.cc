@@ -15,8 +15,10 @@
 #include "src/heap/read-only-promotion.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/startup-timings.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
@@ -43,11 +45,12 @@ class SnapshotImpl : public AllStatic {
       const SnapshotData* read_only_snapshot_in,
       const SnapshotData* shared_heap_snapshot_in,
       const std::vector<SnapshotData*>& context_snapshots_in,
-      bool can_be_rehashed);
+      bool can_be_rehashed, uint64_t hash_seed);
 
   static uint32_t ExtractNumContexts(const v8::StartupData* data);
   static uint32_t ExtractContextOffset(const v8::StartupData* data,
                                        uint32_t index);
+  static uint64_t ExtractHashSeed(const v8::StartupData* data);
   static base::Vector<const uint8_t> ExtractStartupData(
       const v8::StartupData* data);
   static base::Vector<const uint8_t> ExtractReadOnlyData(
@@ -73,13 +76,14 @@ class SnapshotImpl : public AllStatic {
   // Snapshot blob layout:
   // [0] number of contexts N
   // [1] rehashability
-  // [2] checksum
-  // [3] read-only snapshot checksum
-  // [4] (64 bytes) version string
-  // [5] offset to readonly
-  // [6] offset to shared heap
-  // [7] offset to context 0
-  // [8] offset to context 1
+  // [2] (8 bytes) hash seed
+  // [3] checksum
+  // [4] read-only snapshot checksum
+  // [5] (64 bytes) version string
+  // [6] offset to readonly
+  // [7] offset to shared heap
+  // [8] offset to context 0
+  // [9] offset to context 1
   // ...
   // ... offset to context N - 1
   // ... startup snapshot data
@@ -92,7 +96,8 @@ class SnapshotImpl : public AllStatic {
   // TODO(yangguo): generalize rehashing, and remove this flag.
   static const uint32_t kRehashabilityOffset =
       kNumberOfContextsOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kHashSeedOffset = kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kHashSeedOffset + kInt64Size;
   static const uint32_t kReadOnlySnapshotChecksumOffset =
       kChecksumOffset + kUInt32Size;
   static const uint32_t kVersionStringOffset =
@@ -109,9 +114,9 @@ class SnapshotImpl : public AllStatic {
       const v8::StartupData* data) {
     // The hashed region is everything but the header slots up-to-and-including
     // the checksum slot itself.
-    // TODO(jgruber): We currently exclude #contexts and rehashability. This
-    // seems arbitrary and I think we could shuffle header slot order around to
-    // include them, just for consistency.
+    // TODO(jgruber): We currently exclude #contexts, rehashability and the
+    // hash seed. This seems arbitrary and I think we could shuffle header slot
+    // order around to include them, just for consistency.
     static_assert(kReadOnlySnapshotChecksumOffset ==
                   kChecksumOffset + kUInt32Size);
     const uint32_t kChecksumStart = kReadOnlySnapshotChecksumOffset;
@@ -139,6 +144,8 @@ SnapshotData MaybeDecompress(Isolate* isolate,
   RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
   NestedTimedHistogramScope histogram_timer(
       isolate->counters()->snapshot_decompress());
+  StartupTimings::Scope startup_timings_scope(
+      isolate, StartupTimings::Phase::kSnapshotDecompression);
   return SnapshotCompression::Decompress(snapshot_data);
 #else
   return SnapshotData(snapshot_data);
@@ -195,9 +202,16 @@ bool Snapshot::Initialize(Isolate* isolate) {
   SnapshotData shared_heap_snapshot_data(
       MaybeDecompress(isolate, shared_heap_data));
 
+  // Rehashing is only needed if the isolate gets a different hash seed than
+  // the one the snapshot was created with. That is always the case for random
+  // seeds, but not if --hash-seed is the snapshot's seed.
+  bool can_rehash =
+      ExtractRehashability(blob) &&
+      (v8_flags.hash_seed == 0 ||
+       v8_flags.hash_seed != SnapshotImpl::ExtractHashSeed(blob));
   return isolate->InitWithSnapshot(
       &startup_snapshot_data, &read_only_snapshot_data,
-      &shared_heap_snapshot_data, ExtractRehashability(blob));
+      &shared_heap_snapshot_data, can_rehash);
 }
 
 MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
@@ -206,7 +220,10 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   if (!isolate->snapshot_available()) return Handle<Context>();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  bool can_rehash = ExtractRehashability(blob);
+  // The context only needs rehashing if the isolate's seed differs from the
+  // snapshot's.
+  bool can_rehash = ExtractRehashability(blob) &&
+                    HashSeed(isolate) != SnapshotImpl::ExtractHashSeed(blob);
   base::Vector<const uint8_t> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
@@ -316,6 +333,9 @@ void Snapshot::ClearReconstructableDataForSerialization(
   ReadOnlyRoots roots(isolate);
   isolate->heap()->SetFunctionsMarkedForManualOptimization(
       roots.undefined_value());
+  // The deopt history only matters for the functions of this isolate.
+  isolate->heap()->SetDeoptHistoryTable(roots.undefined_value());
+  isolate->heap()->SetDictionaryToFastMapCache(roots.undefined_value());
 
 #if V8_ENABLE_WEBASSEMBLY
   {
@@ -488,7 +508,7 @@ v8::StartupData Snapshot::Create(
   SnapshotData startup_snapshot(&startup_serializer);
   v8::StartupData result = SnapshotImpl::CreateSnapshotBlob(
       &startup_snapshot, &read_only_snapshot, &shared_heap_snapshot,
-      context_snapshots, can_be_rehashed);
+      context_snapshots, can_be_rehashed, HashSeed(isolate));
 
   for (const SnapshotData* ptr : context_snapshots) delete ptr;
 
@@ -501,7 +521,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
     const SnapshotData* read_only_snapshot_in,
     const SnapshotData* shared_heap_snapshot_in,
     const std::vector<SnapshotData*>& context_snapshots_in,
-    bool can_be_rehashed) {
+    bool can_be_rehashed, uint64_t hash_seed) {
   TRACE_EVENT0("v8", "V8.SnapshotCompress");
   // Have these separate from snapshot_in for compression, since we need to
   // access the compressed data as well as the uncompressed reservations.
@@ -556,6 +576,11 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
                                num_contexts);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kRehashabilityOffset,
                                can_be_rehashed ? 1 : 0);
+  SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kHashSeedOffset,
+                               static_cast<uint32_t>(hash_seed));
+  SnapshotImpl::SetHeaderValue(
+      data, SnapshotImpl::kHashSeedOffset + kUInt32Size,
+      static_cast<uint32_t>(hash_seed >> 32));
 
   // Write version string into snapshot data.
   memset(data + SnapshotImpl::kVersionStringOffset, 0,
@@ -679,6 +704,12 @@ bool Snapshot::ExtractRehashability(const v8::StartupData* data) {
   return rehashability != 0;
 }
 
+uint64_t SnapshotImpl::ExtractHashSeed(const v8::StartupData* data) {
+  uint64_t low = GetHeaderValue(data, kHashSeedOffset);
+  uint64_t high = GetHeaderValue(data, kHashSeedOffset + kUInt32Size);
+  return (high << 32) | low;
+}
+
 // static
 uint32_t Snapshot::ExtractReadOnlySnapshotChecksum(
     const v8::StartupData* data) {
@@ -1041,6 +1072,30 @@ void ConvertSerializedObjectsToFixedArray(Isolate* isolate,
   }
 }
 
+// Collects the functions whose bytecode was not run during the last
+// --snapshot-cold-bytecode-age GCs. The ages have to be looked at before the
+// snapshot GCs, which age all functions.
+std::vector<Handle<SharedFunctionInfo>> CollectColdSharedFunctionInfos(
+    Isolate* isolate) {
+  std::vector<Handle<SharedFunctionInfo>> cold;
+  const int cold_age = v8_flags.snapshot_cold_bytecode_age;
+  if (cold_age <= 0) return cold;
+  PtrComprCageBase cage_base(isolate);
+  HeapObjectIterator it(isolate->heap());
+  for (Tagged<HeapObject> o = it.Next(); !o.is_null(); o = it.Next()) {
+    if (!IsSharedFunctionInfo(o, cage_base)) continue;
+    Tagged<SharedFunctionInfo> shared = Cast<SharedFunctionInfo>(o);
+    if (!shared->HasBytecodeArray() || shared->age() < cold_age) continue;
+    if (IsScript(shared->script(cage_base), cage_base) &&
+        Cast<Script>(shared->script(cage_base))->type() ==
+            Script::Type::kExtension) {
+      continue;  // Don't clear extensions, they cannot be recompiled.
+    }
+    if (shared->CanDiscardCompiled()) cold.emplace_back(shared, isolate);
+  }
+  return cold;
+}
+
 }  // anonymous namespace
 
 // static
@@ -1079,24 +1134,41 @@ StartupData SnapshotCreatorImpl::CreateBlob(
     isolate_->heap()->SetSerializedGlobalProxySizes(*global_proxy_sizes);
   }
 
-  // We might rehash strings and re-sort descriptors. Clear the lookup cache.
+  // We might rehash strings and re-sort descriptors. Clear the lookup caches.
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
 
-  // If we don't do this then we end up with a stray root pointing at the
-  // context even after we have disposed of the context.
-  {
-    // Note that we need to run a garbage collection without stack at this
-    // point, so that all dead objects are reclaimed. This is required to avoid
-    // conservative stack scanning and guarantee deterministic behaviour.
-    EmbedderStackStateScope stack_scope(
-        isolate_->heap(), EmbedderStackStateOrigin::kExplicitInvocation,
-        StackState::kNoHeapPointers);
-    isolate_->heap()->CollectAllAvailableGarbage(
-        GarbageCollectionReason::kSnapshotCreator);
-  }
   {
+    // With kKeep, the bytecode of cold functions is dropped from the snapshot
+    // and instead compiled lazily when the function is first called.
     HandleScope scope(isolate_);
+    std::vector<Handle<SharedFunctionInfo>> cold_functions;
+    if (function_code_handling ==
+        SnapshotCreator::FunctionCodeHandling::kKeep) {
+      cold_functions = CollectColdSharedFunctionInfos(isolate_);
+    }
+
+    // If we don't do this then we end up with a stray root pointing at the
+    // context even after we have disposed of the context.
+    {
+      // Note that we need to run a garbage collection without stack at this
+      // point, so that all dead objects are reclaimed. This is required to
+      // avoid conservative stack scanning and guarantee deterministic
+      // behaviour.
+      EmbedderStackStateScope stack_scope(
+          isolate_->heap(), EmbedderStackStateOrigin::kExplicitInvocation,
+          StackState::kNoHeapPointers);
+      isolate_->heap()->CollectAllAvailableGarbage(
+          GarbageCollectionReason::kSnapshotCreator);
+    }
     isolate_->heap()->CompactWeakArrayLists();
+
+    // The JSFunctions of these are reset to CompileLazy below.
+    for (DirectHandle<SharedFunctionInfo> shared : cold_functions) {
+      if (shared->CanDiscardCompiled()) {
+        SharedFunctionInfo::DiscardCompiled(isolate_, shared);
+      }
+    }
   }
 
   Snapshot::ClearReconstructableDataForSerialization(
@@ -243,10 +243,18 @@ void ReplacementStringBuilder::AddElement(DirectHandle<Object> element) {
 }
 
 IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
+    : IncrementalStringBuilder(isolate, 0) {}
+
+IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate,
+                                                   int length_hint)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       overflowed_(false),
-      part_length_(kInitialPartLength),
+      presized_(length_hint >= kInitialPartLength &&
+                length_hint < kMaxPresizedPartLength),
+      // One more than the hint, since the current part is extended as soon as
+      // it is full.
+      part_length_(presized_ ? length_hint + 1 : kInitialPartLength),
       current_index_(0) {
   // Create an accumulator handle starting with the empty string.
   accumulator_ =
@@ -311,11 +319,12 @@ MaybeDirectHandle<String> IncrementalStringBuilder::Finish() {
 
 // Short strings can be copied directly to {current_part_}.
 // Requires the IncrementalStringBuilder to either have two byte encoding or
-// the incoming string to have one byte representation "underneath" (The
-// one byte check requires the string to be flat).
+// the incoming string to have one byte representation, possibly "underneath"
+// (that check requires the string to be flat).
 bool IncrementalStringBuilder::CanAppendByCopy(DirectHandle<String> string) {
   const bool representation_ok =
       encoding_ == String::TWO_BYTE_ENCODING ||
+      string->IsOneByteRepresentation() ||
       (string->IsFlat() && String::IsOneByteRepresentationUnderneath(*string));
 
   return representation_ok && CurrentPartCanFit(string->length());
@@ -345,7 +354,31 @@ void IncrementalStringBuilder::AppendStringByCopy(DirectHandle<String> string) {
   if (current_index_ == part_length_) Extend();
 }
 
+bool IncrementalStringBuilder::CanWidenCurrentPart(
+    DirectHandle<String> string) {
+  return presized_ && encoding_ == String::ONE_BYTE_ENCODING &&
+         accumulator()->length() == 0 && CurrentPartCanFit(string->length());
+}
+
+void IncrementalStringBuilder::WidenCurrentPart() {
+  DCHECK_EQ(String::ONE_BYTE_ENCODING, encoding_);
+  DCHECK_EQ(0, accumulator()->length());
+  DirectHandle<SeqTwoByteString> new_part =
+      factory()->NewRawTwoByteString(part_length_).ToHandleChecked();
+  {
+    DisallowGarbageCollection no_gc;
+    CopyChars(new_part->GetChars(no_gc),
+              Cast<SeqOneByteString>(current_part())->GetChars(no_gc),
+              current_index_);
+  }
+  set_current_part(new_part);
+  encoding_ = String::TWO_BYTE_ENCODING;
+}
+
 void IncrementalStringBuilder::AppendString(DirectHandle<String> string) {
+  if (!CanAppendByCopy(string) && CanWidenCurrentPart(string)) {
+    WidenCurrentPart();
+  }
   if (CanAppendByCopy(string)) {
     AppendStringByCopy(string);
     return;
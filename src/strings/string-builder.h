@@ -79,6 +79,10 @@ class ReplacementStringBuilder {
 class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
+  // Pre-sizes the first part for a result of about {length_hint} characters,
+  // so that a result of up to that length is built in a single sequential
+  // string, which switches to two-byte encoding at most once.
+  IncrementalStringBuilder(Isolate* isolate, int length_hint);
 
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
@@ -188,14 +192,21 @@ class IncrementalStringBuilder {
   void AppendStringByCopy(DirectHandle<String> string);
   bool CanAppendByCopy(DirectHandle<String> string);
 
+  // Copies the single part of a pre-sized builder to a two-byte part of the
+  // same length.
+  bool CanWidenCurrentPart(DirectHandle<String> string);
+  void WidenCurrentPart();
+
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
   static const int kIntToCStringBufferSize = 100;
+  static const int kMaxPresizedPartLength = 64 * 1024;
 
   Isolate* isolate_;
   String::Encoding encoding_;
   bool overflowed_;
+  bool presized_;
   int part_length_;
   int current_index_;
   DirectHandle<String> accumulator_;
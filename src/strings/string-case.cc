@@ -9,9 +9,53 @@
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+#ifdef V8_HOST_ARCH_X64
+// Has all bits set in every byte of {v} in the range [lo, lo + count).
+V8_INLINE __m128i InRange(__m128i v, uint8_t lo, uint8_t count) {
+  const __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+  return _mm_cmpeq_epi8(
+      _mm_min_epu8(offset, _mm_set1_epi8(static_cast<char>(count - 1))),
+      offset);
+}
+#elif defined(V8_HOST_ARCH_ARM64)
+V8_INLINE uint8x16_t InRange(uint8x16_t v, uint8_t lo, uint8_t count) {
+  return vcltq_u8(vsubq_u8(v, vdupq_n_u8(lo)), vdupq_n_u8(count));
+}
+#endif
+
+// Whether {c} is in the ranges [A-Z] or [\u00C0-\u00DE] except for U+00D7,
+// which are converted to lower case by setting bit 5.
+V8_INLINE bool IsLatin1Upper(uint8_t c) {
+  return static_cast<uint8_t>(c - 'A') < 26 ||
+         (static_cast<uint8_t>(c - 0xC0) < 0x1F && c != 0xD7);
+}
+
+// Whether {c} is in the ranges [a-z] or [\u00E0-\u00FE] except for U+00F7,
+// which are converted to upper case by clearing bit 5.
+V8_INLINE bool IsLatin1LowerWithLatin1Upper(uint8_t c) {
+  return static_cast<uint8_t>(c - 'a') < 26 ||
+         (static_cast<uint8_t>(c - 0xE0) < 0x1F && c != 0xF7);
+}
+
+// The lower case characters whose upper case is not a single Latin-1
+// character: U+00B5 (micro sign), U+00DF (sharp s) and U+00FF.
+V8_INLINE bool IsLatin1UpperSpecialCase(uint8_t c) {
+  return c == 0xB5 || c == 0xDF || c == 0xFF;
+}
+
+}  // namespace
+
 // FastAsciiConvert tries to do character processing on a word_t basis if
 // source and destination strings are properly aligned. Natural alignment of
 // string data depends on kTaggedSize so we define word_t via Tagged_t.
@@ -77,6 +121,35 @@ int FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
+
+  // Convert 16 characters at a time where SIMD is available. The loops below
+  // then only see the last few characters.
+#ifdef V8_HOST_ARCH_X64
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  while (limit - src >= 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    if (_mm_movemask_epi8(v) != 0) return static_cast<int>(src - saved_src);
+    const __m128i m = InRange(v, lo + 1, hi - lo - 1);
+    changed |= _mm_movemask_epi8(m) != 0;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_xor_si128(v, _mm_and_si128(m, case_bit)));
+    src += 16;
+    dst += 16;
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+  while (limit - src >= 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+    if (vmaxvq_u8(v) > 0x7F) return static_cast<int>(src - saved_src);
+    const uint8x16_t m = InRange(v, lo + 1, hi - lo - 1);
+    changed |= vmaxvq_u8(m) != 0;
+    vst1q_u8(reinterpret_cast<uint8_t*>(dst),
+             veorq_u8(v, vandq_u8(m, case_bit)));
+    src += 16;
+    dst += 16;
+  }
+#endif
+
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
     // Process the prefix of the input that requires no conversion one aligned
@@ -132,5 +205,82 @@ template int FastAsciiConvert<false>(char* dst, const char* src, int length,
 template int FastAsciiConvert<true>(char* dst, const char* src, int length,
                                     bool* changed_out);
 
+void FastLatin1ToLower(uint8_t* dst, const uint8_t* src, int length) {
+  int i = 0;
+#ifdef V8_HOST_ARCH_X64
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  const __m128i times = _mm_set1_epi8(static_cast<char>(0xD7));
+  for (; length - i >= 16; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i m = _mm_or_si128(
+        InRange(v, 'A', 26),
+        _mm_andnot_si128(_mm_cmpeq_epi8(v, times), InRange(v, 0xC0, 0x1F)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_or_si128(v, _mm_and_si128(m, case_bit)));
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+  const uint8x16_t times = vdupq_n_u8(0xD7);
+  for (; length - i >= 16; i += 16) {
+    const uint8x16_t v = vld1q_u8(src + i);
+    const uint8x16_t m =
+        vorrq_u8(InRange(v, 'A', 26),
+                 vbicq_u8(InRange(v, 0xC0, 0x1F), vceqq_u8(v, times)));
+    vst1q_u8(dst + i, vorrq_u8(v, vandq_u8(m, case_bit)));
+  }
+#endif
+  for (; i < length; i++) {
+    const uint8_t c = src[i];
+    dst[i] = c | (IsLatin1Upper(c) << 5);
+  }
+}
+
+int FastLatin1ToUpper(uint8_t* dst, const uint8_t* src, int length) {
+  int i = 0;
+#ifdef V8_HOST_ARCH_X64
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  const __m128i division = _mm_set1_epi8(static_cast<char>(0xF7));
+  const __m128i micro = _mm_set1_epi8(static_cast<char>(0xB5));
+  const __m128i sharp_s = _mm_set1_epi8(static_cast<char>(0xDF));
+  const __m128i y_diaeresis = _mm_set1_epi8(static_cast<char>(0xFF));
+  for (; length - i >= 16; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i special = _mm_or_si128(
+        _mm_cmpeq_epi8(v, micro),
+        _mm_or_si128(_mm_cmpeq_epi8(v, sharp_s),
+                     _mm_cmpeq_epi8(v, y_diaeresis)));
+    if (_mm_movemask_epi8(special) != 0) return i;
+    const __m128i m = _mm_or_si128(
+        InRange(v, 'a', 26),
+        _mm_andnot_si128(_mm_cmpeq_epi8(v, division), InRange(v, 0xE0, 0x1F)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_andnot_si128(_mm_and_si128(m, case_bit), v));
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+  const uint8x16_t division = vdupq_n_u8(0xF7);
+  for (; length - i >= 16; i += 16) {
+    const uint8x16_t v = vld1q_u8(src + i);
+    const uint8x16_t special =
+        vorrq_u8(vceqq_u8(v, vdupq_n_u8(0xB5)),
+                 vorrq_u8(vceqq_u8(v, vdupq_n_u8(0xDF)),
+                          vceqq_u8(v, vdupq_n_u8(0xFF))));
+    if (vmaxvq_u8(special) != 0) return i;
+    const uint8x16_t m =
+        vorrq_u8(InRange(v, 'a', 26),
+                 vbicq_u8(InRange(v, 0xE0, 0x1F), vceqq_u8(v, division)));
+    vst1q_u8(dst + i, vbicq_u8(v, vandq_u8(m, case_bit)));
+  }
+#endif
+  for (; i < length; i++) {
+    const uint8_t c = src[i];
+    if (IsLatin1UpperSpecialCase(c)) return i;
+    dst[i] = c & ~(IsLatin1LowerWithLatin1Upper(c) << 5);
+  }
+  return length;
+}
+
 }  // namespace internal
 }  // namespace v8
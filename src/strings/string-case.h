@@ -5,12 +5,23 @@
 #ifndef V8_STRINGS_STRING_CASE_H_
 #define V8_STRINGS_STRING_CASE_H_
 
+#include <cstdint>
+
 namespace v8 {
 namespace internal {
 
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length, bool* changed_out);
 
+// Writes the lower case of the {length} Latin-1 characters of {src} to {dst}.
+void FastLatin1ToLower(uint8_t* dst, const uint8_t* src, int length);
+
+// Writes the upper case of the Latin-1 characters of {src} to {dst}. Stops at
+// or shortly before the first character whose upper case is not a single
+// Latin-1 character (U+00B5, U+00DF and U+00FF), and returns the number of
+// characters written.
+int FastLatin1ToUpper(uint8_t* dst, const uint8_t* src, int length);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/memory.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,36 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+namespace detail {
+
+// Returns whether all of the {length} characters are decimal digits. One-byte
+// characters are checked eight at a time.
+template <typename uchar>
+V8_INLINE bool AllDecimalDigits(const uchar* chars, int length) {
+  int i = 0;
+  if constexpr (sizeof(uchar) == 1) {
+    constexpr uint64_t kHighNibbles = uint64_t{0xF0F0F0F0F0F0F0F0};
+    constexpr uint64_t kDigitHighNibbles = uint64_t{0x3030303030303030};
+    constexpr uint64_t kSixes = uint64_t{0x0606060606060606};
+    for (; i + 8 <= length; i += 8) {
+      uint64_t word = base::ReadUnalignedValue<uint64_t>(
+          reinterpret_cast<Address>(chars + i));
+      // Every byte is in 0x30..0x3F, and stays there when adding 6, i.e. it
+      // is in 0x30..0x39. Adding 6 can't carry into the next byte here.
+      if ((word & kHighNibbles) != kDigitHighNibbles ||
+          ((word + kSixes) & kHighNibbles) != kDigitHighNibbles) {
+        return false;
+      }
+    }
+  }
+  for (; i < length; i++) {
+    if (!IsDecimalDigit(chars[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace detail
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -56,7 +87,12 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   DCHECK_LE(0, length);
   DCHECK_IMPLIES(0 < length, chars != nullptr);
   if (length >= 1) {
-    if (IsDecimalDigit(chars[0]) && (length == 1 || chars[0] != '0')) {
+    // Only strings of digits can be indices. Other strings which start with a
+    // digit, e.g. dates or hex ids, get the same hash that the index checks
+    // below would compute, without parsing them as an index first.
+    if (IsDecimalDigit(chars[0]) && (length == 1 || chars[0] != '0') &&
+        length <= String::kMaxIntegerIndexSize &&
+        detail::AllDecimalDigits(chars + 1, length - 1)) {
       if (length <= String::kMaxArrayIndexSize) {
         // Possible array index; try to compute the array index hash.
         uint32_t index = chars[0] - '0';
@@ -0,0 +1,102 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include "src/base/bits.h"
+
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+template <typename Char>
+int FindCharacterPairScalar(const Char* subject, int start, int end,
+                            Char first, Char last, int distance) {
+  for (int i = start; i < end; i++) {
+    if (subject[i] == first && subject[i + distance] == last) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+// Compares 16 bytes of positions at once with the first and, {distance}
+// characters later, with the last character of the pattern. See "SIMD-friendly
+// algorithms for substring searching" by Wojciech Muła.
+int FindCharacterPair(const uint8_t* subject, int start, int end,
+                      uint8_t first, uint8_t last, int distance) {
+  DCHECK_LE(0, start);
+  DCHECK_LT(0, distance);
+  int i = start;
+#ifdef V8_HOST_ARCH_X64
+  const __m128i first_chars = _mm_set1_epi8(static_cast<char>(first));
+  const __m128i last_chars = _mm_set1_epi8(static_cast<char>(last));
+  for (; end - i >= 16; i += 16) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + distance));
+    int mask = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(block_first, first_chars),
+                      _mm_cmpeq_epi8(block_last, last_chars)));
+    if (mask != 0) return i + base::bits::CountTrailingZeros32(mask);
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  const uint8x16_t first_chars = vdupq_n_u8(first);
+  const uint8x16_t last_chars = vdupq_n_u8(last);
+  for (; end - i >= 16; i += 16) {
+    uint8x16_t matches =
+        vandq_u8(vceqq_u8(vld1q_u8(subject + i), first_chars),
+                 vceqq_u8(vld1q_u8(subject + i + distance), last_chars));
+    // Narrow every byte to four bits, to get a 64-bit mask.
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    if (mask != 0) return i + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+#endif
+  return FindCharacterPairScalar(subject, i, end, first, last, distance);
+}
+
+int FindCharacterPair(const base::uc16* subject, int start, int end,
+                      base::uc16 first, base::uc16 last, int distance) {
+  DCHECK_LE(0, start);
+  DCHECK_LT(0, distance);
+  int i = start;
+#ifdef V8_HOST_ARCH_X64
+  const __m128i first_chars = _mm_set1_epi16(static_cast<int16_t>(first));
+  const __m128i last_chars = _mm_set1_epi16(static_cast<int16_t>(last));
+  for (; end - i >= 8; i += 8) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + distance));
+    int mask = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi16(block_first, first_chars),
+                      _mm_cmpeq_epi16(block_last, last_chars)));
+    if (mask != 0) return i + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  const uint16x8_t first_chars = vdupq_n_u16(first);
+  const uint16x8_t last_chars = vdupq_n_u16(last);
+  for (; end - i >= 8; i += 8) {
+    uint16x8_t matches =
+        vandq_u16(vceqq_u16(vld1q_u16(subject + i), first_chars),
+                  vceqq_u16(vld1q_u16(subject + i + distance), last_chars));
+    // Narrow every character to one byte, to get a 64-bit mask.
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+    if (mask != 0) return i + base::bits::CountTrailingZeros64(mask) / 8;
+  }
+#endif
+  return FindCharacterPairScalar(subject, i, end, first, last, distance);
+}
+
+}  // namespace internal
+}  // namespace v8
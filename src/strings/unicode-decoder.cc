@@ -4,6 +4,7 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include "src/base/bits.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -11,6 +12,12 @@
 #include "src/third_party/utf8-decoder/generalized-utf8-decoder.h"
 #endif
 
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -54,6 +61,78 @@ struct DecoderTraits<StrictUtf8Decoder> {
   using DfaDecoder = Utf8DfaDecoder;
 };
 #endif  // V8_ENABLE_WEBASSEMBLY
+
+// Returns the number of ASCII characters at the start of [cursor, end), which
+// must not be empty and start with an ASCII character.
+size_t AsciiRunLength(const uint8_t* cursor, const uint8_t* end) {
+  DCHECK_LT(cursor, end);
+  DCHECK_LE(*cursor, unibrow::Utf8::kMaxOneByteChar);
+  const uint8_t* start = cursor;
+#ifdef V8_HOST_ARCH_X64
+  for (; end - cursor >= 16; cursor += 16) {
+    int mask = _mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor)));
+    if (mask != 0) {
+      return cursor - start + base::bits::CountTrailingZeros32(mask);
+    }
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  for (; end - cursor >= 16; cursor += 16) {
+    // Narrow the sign bit of every byte to four bits, to get a 64-bit mask.
+    uint8x16_t non_ascii = vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(cursor)));
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(non_ascii), 4)),
+        0);
+    if (mask != 0) {
+      return cursor - start + base::bits::CountTrailingZeros64(mask) / 4;
+    }
+  }
+#endif
+  while (cursor < end && *cursor <= unibrow::Utf8::kMaxOneByteChar) cursor++;
+  return cursor - start;
+}
+
+bool IsContinuationByte(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+// Decodes the well-formed multi-byte sequence at {cursor} without going
+// through the DFA, one byte at a time. Returns the length of the sequence, or
+// 0 if it is truncated, ill-formed, or encodes a surrogate, which is left to
+// the DFA of the respective decoder.
+V8_INLINE int DecodeWellFormedSequence(const uint8_t* cursor,
+                                       const uint8_t* end,
+                                       uint32_t* code_point) {
+  const uint8_t lead = cursor[0];
+  const ptrdiff_t available = end - cursor;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    if (available < 2 || !IsContinuationByte(cursor[1])) return 0;
+    *code_point = ((lead & 0x1F) << 6) | (cursor[1] & 0x3F);
+    return 2;
+  }
+  if (lead >= 0xE0 && lead <= 0xEF) {
+    if (available < 3 || !IsContinuationByte(cursor[1]) ||
+        !IsContinuationByte(cursor[2])) {
+      return 0;
+    }
+    uint32_t value =
+        ((lead & 0x0F) << 12) | ((cursor[1] & 0x3F) << 6) | (cursor[2] & 0x3F);
+    if (value < 0x800 || (value & 0xF800) == 0xD800) return 0;
+    *code_point = value;
+    return 3;
+  }
+  if (lead >= 0xF0 && lead <= 0xF4) {
+    if (available < 4 || !IsContinuationByte(cursor[1]) ||
+        !IsContinuationByte(cursor[2]) || !IsContinuationByte(cursor[3])) {
+      return 0;
+    }
+    uint32_t value = ((lead & 0x07) << 18) | ((cursor[1] & 0x3F) << 12) |
+                     ((cursor[2] & 0x3F) << 6) | (cursor[3] & 0x3F);
+    if (value < 0x10000 || value > 0x10FFFF) return 0;
+    *code_point = value;
+    return 4;
+  }
+  return 0;
+}
+
 }  // namespace
 
 template <class Decoder>
@@ -72,14 +151,29 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
-    if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
-                  state == Traits::DfaDecoder::kAccept)) {
+    if (V8_LIKELY(state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
-      continue;
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        size_t run = AsciiRunLength(cursor, end);
+        DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
+        previous = cursor[run - 1];
+        utf16_length_ += static_cast<int>(run);
+        cursor += run;
+        continue;
+      }
+      uint32_t code_point;
+      int sequence_length = DecodeWellFormedSequence(cursor, end, &code_point);
+      if (V8_LIKELY(sequence_length != 0)) {
+        DCHECK(!Traits::IsInvalidSurrogatePair(previous, code_point));
+        is_one_byte = is_one_byte && code_point <= unibrow::Latin1::kMaxChar;
+        utf16_length_++;
+        if (code_point > unibrow::Utf16::kMaxNonSurrogateCharCode) {
+          utf16_length_++;
+        }
+        previous = code_point;
+        cursor += sequence_length;
+        continue;
+      }
     }
 
     auto previous_state = state;
@@ -141,12 +235,28 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
-    if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
-                  state == Traits::DfaDecoder::kAccept)) {
+    if (V8_LIKELY(state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
-      continue;
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        size_t run = AsciiRunLength(cursor, end);
+        CopyChars(out, cursor, run);
+        out += run;
+        cursor += run;
+        continue;
+      }
+      uint32_t code_point;
+      int sequence_length = DecodeWellFormedSequence(cursor, end, &code_point);
+      if (V8_LIKELY(sequence_length != 0)) {
+        if (sizeof(Char) == 1 ||
+            code_point <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+          *(out++) = static_cast<Char>(code_point);
+        } else {
+          *(out++) = unibrow::Utf16::LeadSurrogate(code_point);
+          *(out++) = unibrow::Utf16::TrailSurrogate(code_point);
+        }
+        cursor += sequence_length;
+        continue;
+      }
     }
 
     auto previous_state = state;
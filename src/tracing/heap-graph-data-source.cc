@@ -0,0 +1,288 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/tracing/heap-graph-data-source.h"
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "perfetto/protozero/packed_repeated_fields.h"
+#include "protos/perfetto/common/data_source_descriptor.gen.h"
+#include "protos/perfetto/trace/profiling/heap_graph.pbzero.h"
+#include "protos/perfetto/trace/trace_packet.pbzero.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/profiler/heap-profiler.h"
+#include "src/profiler/heap-snapshot-generator-inl.h"
+
+PERFETTO_DEFINE_DATA_SOURCE_STATIC_MEMBERS(v8::internal::HeapGraphDataSource);
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using ::perfetto::protos::pbzero::HeapGraph;
+using ::perfetto::protos::pbzero::HeapGraphObject;
+using ::perfetto::protos::pbzero::HeapGraphRoot;
+using ::perfetto::protos::pbzero::HeapGraphType;
+using ::perfetto::protos::pbzero::InternedString;
+
+// Number of objects written per trace packet, which keeps packets well below
+// the size at which Perfetto has to fragment them.
+constexpr size_t kObjectsPerPacket = 1024;
+
+// Returns the class name shared by all entries of |type|, or nullptr if
+// entries of that type are classified by their own name. The names match the
+// ones DevTools uses to group .heapsnapshot nodes.
+const char* GetSharedClassName(HeapEntry::Type type) {
+  switch (type) {
+    case HeapEntry::kHidden:
+      return "(system)";
+    case HeapEntry::kArray:
+      return "(array)";
+    case HeapEntry::kString:
+    case HeapEntry::kConsString:
+    case HeapEntry::kSlicedString:
+      return "(string)";
+    case HeapEntry::kCode:
+      return "(compiled code)";
+    case HeapEntry::kClosure:
+      return "(closure)";
+    case HeapEntry::kRegExp:
+      return "(regexp)";
+    case HeapEntry::kHeapNumber:
+      return "(number)";
+    case HeapEntry::kSymbol:
+      return "(symbol)";
+    case HeapEntry::kBigInt:
+      return "(bigint)";
+    case HeapEntry::kObjectShape:
+      return "(object shape)";
+    case HeapEntry::kObject:
+    case HeapEntry::kNative:
+    case HeapEntry::kSynthetic:
+      return nullptr;
+    case HeapEntry::kNumTypes:
+      break;
+  }
+  UNREACHABLE();
+}
+
+// Writes a heap snapshot as a sequence of HeapGraph packets. Types and field
+// names are interned: each one is written once, in the first packet that
+// refers to it.
+class HeapGraphWriter {
+ public:
+  HeapGraphWriter(HeapGraphDataSource::TraceContext& context,
+                  HeapSnapshot* snapshot)
+      : context_(context),
+        snapshot_(snapshot),
+        timestamp_(base::TimeTicks::Now().since_origin().InNanoseconds()) {}
+
+  void Write() {
+    StartPacket();
+    HeapGraphRoot* root = heap_graph_->add_roots();
+    protozero::PackedVarInt root_ids;
+    root_ids.Append(snapshot_->root()->id());
+    root->set_object_ids(root_ids);
+    root->set_root_type(HeapGraphRoot::ROOT_UNKNOWN);
+
+    size_t objects_in_packet = 0;
+    for (HeapEntry& entry : snapshot_->entries()) {
+      if (objects_in_packet == kObjectsPerPacket) {
+        FinishPacket(true);
+        StartPacket();
+        objects_in_packet = 0;
+      }
+      WriteObject(entry);
+      objects_in_packet++;
+    }
+    FinishPacket(false);
+  }
+
+ private:
+  void StartPacket() {
+    packet_ = context_.NewTracePacket();
+    packet_->set_timestamp(timestamp_);
+    heap_graph_ = packet_->set_heap_graph();
+    heap_graph_->set_pid(base::OS::GetCurrentProcessId());
+    heap_graph_->set_index(next_packet_index_++);
+  }
+
+  void FinishPacket(bool continued) {
+    heap_graph_->set_continued(continued);
+    heap_graph_ = nullptr;
+    packet_ = HeapGraphDataSource::TraceContext::TracePacketHandle();
+  }
+
+  void WriteObject(HeapEntry& entry) {
+    HeapGraphObject* object = heap_graph_->add_objects();
+    object->set_id(entry.id());
+    object->set_type_id(InternType(entry));
+    object->set_self_size(entry.self_size());
+
+    field_ids_.Reset();
+    object_ids_.Reset();
+    bool has_references = false;
+    for (int i = 0; i < entry.children_count(); i++) {
+      HeapGraphEdge* edge = entry.child(i);
+      // Weak references don't retain their targets, and shortcuts duplicate
+      // paths that exist through other edges, so neither are part of the
+      // retention graph.
+      if (edge->type() == HeapGraphEdge::kWeak ||
+          edge->type() == HeapGraphEdge::kShortcut) {
+        continue;
+      }
+      field_ids_.Append(InternFieldName(edge));
+      object_ids_.Append(edge->to()->id());
+      has_references = true;
+    }
+    if (has_references) {
+      object->set_reference_field_id(field_ids_);
+      object->set_reference_object_id(object_ids_);
+    }
+  }
+
+  uint64_t InternType(const HeapEntry& entry) {
+    const char* class_name = GetSharedClassName(entry.type());
+    if (class_name == nullptr) class_name = entry.name();
+    auto [it, was_inserted] =
+        type_iids_.emplace(class_name, type_iids_.size() + 1);
+    if (was_inserted) {
+      HeapGraphType* type = heap_graph_->add_types();
+      type->set_id(it->second);
+      type->set_class_name(class_name, strlen(class_name));
+    }
+    return it->second;
+  }
+
+  uint64_t InternFieldName(HeapGraphEdge* edge) {
+    if (edge->type() == HeapGraphEdge::kHidden) {
+      if (hidden_field_iid_ == 0) {
+        hidden_field_iid_ = next_field_iid_++;
+        AddFieldName(hidden_field_iid_, "(hidden)");
+      }
+      return hidden_field_iid_;
+    }
+    if (edge->type() == HeapGraphEdge::kElement) {
+      auto [it, was_inserted] =
+          element_field_iids_.emplace(edge->index(), next_field_iid_);
+      if (was_inserted) {
+        next_field_iid_++;
+        AddFieldName(it->second, "[" + std::to_string(edge->index()) + "]");
+      }
+      return it->second;
+    }
+    // Names of edges are owned by the snapshot's StringsStorage, which
+    // deduplicates them, so they can be interned by address.
+    auto [it, was_inserted] =
+        named_field_iids_.emplace(edge->name(), next_field_iid_);
+    if (was_inserted) {
+      next_field_iid_++;
+      AddFieldName(it->second, edge->name());
+    }
+    return it->second;
+  }
+
+  void AddFieldName(uint64_t iid, const std::string& name) {
+    InternedString* field_name = heap_graph_->add_field_names();
+    field_name->set_iid(iid);
+    field_name->set_str(reinterpret_cast<const uint8_t*>(name.data()),
+                        name.size());
+  }
+
+  HeapGraphDataSource::TraceContext& context_;
+  HeapSnapshot* const snapshot_;
+  const int64_t timestamp_;
+  HeapGraphDataSource::TraceContext::TracePacketHandle packet_;
+  HeapGraph* heap_graph_ = nullptr;
+  uint64_t next_packet_index_ = 0;
+
+  // Reused for every object to avoid reallocating the packed buffers.
+  protozero::PackedVarInt field_ids_;
+  protozero::PackedVarInt object_ids_;
+
+  std::unordered_map<const char*, uint64_t> type_iids_;
+  std::unordered_map<const char*, uint64_t> named_field_iids_;
+  std::unordered_map<int, uint64_t> element_field_iids_;
+  uint64_t hidden_field_iid_ = 0;
+  uint64_t next_field_iid_ = 1;
+};
+
+class IsolateRegistry {
+ public:
+  static IsolateRegistry& GetInstance() {
+    static IsolateRegistry* g_instance = new IsolateRegistry();
+    return *g_instance;
+  }
+
+  void Register(Isolate* isolate) {
+    base::MutexGuard lock(&mutex_);
+    CHECK(isolates_.insert(isolate).second);
+  }
+
+  void Unregister(Isolate* isolate) {
+    base::MutexGuard lock(&mutex_);
+    CHECK_EQ(1, isolates_.erase(isolate));
+  }
+
+  // Snapshots are taken on the isolates' own threads, the next time they
+  // handle interrupts.
+  void RequestHeapGraphs() {
+    base::MutexGuard lock(&mutex_);
+    for (Isolate* isolate : isolates_) {
+      isolate->RequestInterrupt(
+          [](v8::Isolate* v8_isolate, void*) {
+            Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+            HeapSnapshot* snapshot = isolate->heap_profiler()->TakeSnapshot(
+                v8::HeapProfiler::HeapSnapshotOptions());
+            if (snapshot == nullptr) return;
+            HeapGraphDataSource::WriteHeapGraph(snapshot);
+            snapshot->Delete();
+          },
+          nullptr);
+    }
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::unordered_set<Isolate*> isolates_;
+};
+
+}  // namespace
+
+// static
+void HeapGraphDataSource::Register() {
+  perfetto::DataSourceDescriptor desc;
+  desc.set_name("dev.v8.heap_graph");
+  DataSource::Register(desc);
+}
+
+// static
+void HeapGraphDataSource::RegisterIsolate(Isolate* isolate) {
+  IsolateRegistry::GetInstance().Register(isolate);
+}
+
+// static
+void HeapGraphDataSource::UnregisterIsolate(Isolate* isolate) {
+  IsolateRegistry::GetInstance().Unregister(isolate);
+}
+
+// static
+void HeapGraphDataSource::WriteHeapGraph(HeapSnapshot* snapshot) {
+  Trace([snapshot](TraceContext context) {
+    HeapGraphWriter(context, snapshot).Write();
+  });
+}
+
+void HeapGraphDataSource::OnStart(const StartArgs&) {
+  IsolateRegistry::GetInstance().RequestHeapGraphs();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TRACING_HEAP_GRAPH_DATA_SOURCE_H_
+#define V8_TRACING_HEAP_GRAPH_DATA_SOURCE_H_
+
+#include "perfetto/tracing/data_source.h"
+
+namespace v8 {
+namespace internal {
+
+class HeapSnapshot;
+class Isolate;
+
+// Perfetto data source that dumps the heap of every registered isolate as a
+// HeapGraph when a tracing session starts. The heap snapshot is written out in
+// a series of packets instead of the .heapsnapshot JSON format, with type and
+// field names interned, so dumps are much smaller and need no JSON parsing.
+class HeapGraphDataSource
+    : public perfetto::DataSource<HeapGraphDataSource> {
+ public:
+  static void Register();
+  static void RegisterIsolate(Isolate* isolate);
+  static void UnregisterIsolate(Isolate* isolate);
+
+  // Writes |snapshot| to all active instances of the data source.
+  static void WriteHeapGraph(HeapSnapshot* snapshot);
+
+  void OnSetup(const SetupArgs&) override {}
+  void OnStart(const StartArgs&) override;
+  void OnStop(const StopArgs&) override {}
+};
+
+}  // namespace internal
+}  // namespace v8
+
+PERFETTO_DECLARE_DATA_SOURCE_STATIC_MEMBERS(v8::internal::HeapGraphDataSource);
+
+#endif  // V8_TRACING_HEAP_GRAPH_DATA_SOURCE_H_
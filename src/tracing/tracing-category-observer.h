@@ -22,6 +22,8 @@ class TracingCategoryObserver
     ENABLED_BY_NATIVE = 1 << 0,
     ENABLED_BY_TRACING = 1 << 1,
     ENABLED_BY_SAMPLING = 1 << 2,
+    ENABLED_BY_SAMPLED_COUNTERS = 1 << 3,
+    ENABLED_BY_SITE_STATS = 1 << 4,
   };
 
   static void SetUp();
@@ -651,6 +651,22 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsBeforeLoop(int max_register_locals) {
+  int num_register_locals = 0;
+  for (VarState& local_slot :
+       base::VectorOf(cache_state_.stack_state.data(), num_locals_)) {
+    // Back edges move the locals into the registers of the loop header state.
+    // A register which also holds another value would overwrite that value.
+    if (local_slot.is_reg() && num_register_locals < max_register_locals &&
+        !local_slot.reg().is_pair() &&
+        cache_state_.get_use_count(local_slot.reg()) == 1) {
+      ++num_register_locals;
+      continue;
+    }
+    Spill(&local_slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (VarState& slot : cache_state_.stack_state) {
     if (!slot.is_reg()) continue;
@@ -564,6 +564,10 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills the locals before entering a loop, except for up to
+  // {max_register_locals} locals which are in a register of their own. These
+  // stay in their registers for the whole loop.
+  void SpillLocalsBeforeLoop(int max_register_locals);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
@@ -1406,10 +1406,18 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
+    // into registers at branches. With --liftoff-loop-register-locals, a few
+    // locals which are already in registers stay there instead, which saves
+    // the loads and stores of loops that keep them in registers. Code for
+    // debugging keeps spilling all locals.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (v8_flags.liftoff_loop_register_locals > 0 &&
+        for_debugging_ == kNotForDebugging) {
+      __ SpillLocalsBeforeLoop(v8_flags.liftoff_loop_register_locals);
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -1609,7 +1609,7 @@ void PrepareFunctionData(
   // objects have migrated into trusted space.
   static_assert(!i::kAllCodeObjectsLiveInTrustedSpace);
   if (!function_data->c_wrapper_code(isolate).SafeEquals(
-          *BUILTIN_CODE(isolate, Illegal))) {
+          isolate->builtins()->code(i::Builtin::kIllegal))) {
     return;
   }
   // Compile wrapper code.
@@ -1756,8 +1756,10 @@ auto Func::call(const Val args[], Val results[]) const -> own<Trap> {
       function_data->instance_data(), isolate};
   int function_index = function_data->function_index();
   const i::wasm::WasmModule* module = instance_data->module();
-  // Caching {sig} would give a ~10% reduction in overhead.
-  const i::wasm::FunctionSig* sig = module->functions[function_index].sig;
+  // The function data caches the signature, so we don't have to look it up in
+  // the module on every call.
+  const i::wasm::FunctionSig* sig = function_data->sig();
+  DCHECK_EQ(sig, module->functions[function_index].sig);
   PrepareFunctionData(isolate, function_data, sig, module);
   i::DirectHandle<i::Code> wrapper_code(function_data->c_wrapper_code(isolate),
                                         isolate);
@@ -1768,10 +1770,10 @@ auto Func::call(const Val args[], Val results[]) const -> own<Trap> {
 
   i::DirectHandle<i::Object> object_ref;
   if (function_index < static_cast<int>(module->num_imported_functions)) {
-    object_ref =
-        i::handle(instance_data->dispatch_table_for_imports()->implicit_arg(
-                      function_index),
-                  isolate);
+    object_ref = i::direct_handle(
+        instance_data->dispatch_table_for_imports()->implicit_arg(
+            function_index),
+        isolate);
     if (IsWasmImportData(*object_ref)) {
       i::Tagged<i::JSFunction> jsfunc = i::Cast<i::JSFunction>(
           i::Cast<i::WasmImportData>(*object_ref)->callable());
@@ -1791,7 +1793,7 @@ auto Func::call(const Val args[], Val results[]) const -> own<Trap> {
   } else {
     // TODO(42204563): Avoid crashing if the instance object is not available.
     CHECK(instance_data->has_instance_object());
-    object_ref = handle(instance_data->instance_object(), isolate);
+    object_ref = i::direct_handle(instance_data->instance_object(), isolate);
   }
 
   i::Execution::CallWasm(isolate, wrapper_code, call_target, object_ref,
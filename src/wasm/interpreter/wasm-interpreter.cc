@@ -1479,6 +1479,34 @@ INSTRUCTION_HANDLER_FUNC s2s_RefSelect(const uint8_t* code, uint32_t* sp,
 FOREACH_ARITHMETIC_BINOP(DEFINE_BINOP)
 #undef DEFINE_BINOP
 
+////////////////////////////////////////////////////////////////////////////////
+// Binary arithmetic operators followed by LocalSet
+
+#define DEFINE_BINOP_LOCALSET(name, ctype, reg, op, type)                  \
+  INSTRUCTION_HANDLER_FUNC r2s_##name##_LocalSet(                         \
+      const uint8_t* code, uint32_t* sp,                                  \
+      WasmInterpreterRuntime* wasm_runtime, int64_t r0, double fp0) {     \
+    ctype rval = static_cast<ctype>(reg);                                 \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                      \
+    uint32_t to = ReadI32(code);                                          \
+    base::WriteUnalignedValue<ctype>(reinterpret_cast<Address>(sp + to),  \
+                                     static_cast<ctype>(lval op rval));   \
+    NextOp();                                                             \
+  }                                                                       \
+                                                                          \
+  INSTRUCTION_HANDLER_FUNC s2s_##name##_LocalSet(                         \
+      const uint8_t* code, uint32_t* sp,                                  \
+      WasmInterpreterRuntime* wasm_runtime, int64_t r0, double fp0) {     \
+    ctype rval = pop<ctype>(sp, code, wasm_runtime);                      \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                      \
+    uint32_t to = ReadI32(code);                                          \
+    base::WriteUnalignedValue<ctype>(reinterpret_cast<Address>(sp + to),  \
+                                     static_cast<ctype>(lval op rval));   \
+    NextOp();                                                             \
+  }
+FOREACH_ARITHMETIC_BINOP(DEFINE_BINOP_LOCALSET)
+#undef DEFINE_BINOP_LOCALSET
+
 ////////////////////////////////////////////////////////////////////////////////
 // Binary arithmetic operators that can trap
 
@@ -6384,14 +6412,18 @@ size_t WasmBytecodeGenerator::Simd128Hash::operator()(
 // Look if the slot that hold the value at {stack_index} is being shared with
 // other slots. This can happen if there are multiple load.get operations that
 // copy from the same local.
-bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index) const {
+bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index,
+                                          uint32_t ignored_entries) const {
   // Only consider stack entries added in the current block.
   // We don't need to consider ancestor blocks because if a block has a
   // non-empty signature we always pass arguments and results into separate
   // slots, emitting CopySlot operations.
   uint32_t start_slot_index = blocks_[current_block_index_].stack_size_;
+  DCHECK_LE(ignored_entries, stack_.size());
+  uint32_t end_slot_index =
+      static_cast<uint32_t>(stack_.size()) - ignored_entries;
 
-  for (uint32_t i = start_slot_index; i < stack_.size(); i++) {
+  for (uint32_t i = start_slot_index; i < end_slot_index; i++) {
     if (stack_[i] == stack_[stack_index]) {
       return true;
     }
@@ -11169,6 +11201,33 @@ bool WasmBytecodeGenerator::EncodeSuperInstruction(
       STORE_CASE(F64StoreMem, Float64, uint64_t, kFloat64, F64);
 #undef STORE_CASE
 
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprLocalSet) {
+    uint32_t to_stack_index = next_instr.optional.index;
+    switch (curr_instr.orig) {
+// The operands are read before the local is written, so they may share the
+// slot of the local. Do not optimize if any other stack entry shares it.
+#define BINOP_CASE(name, ctype, reg, op, type)                    \
+  case kExpr##name: {                                             \
+    if (reg_mode == RegMode::kNoReg) {                            \
+      if (HasSharedSlot(to_stack_index, 2)) return false;         \
+      EMIT_INSTR_HANDLER(s2s_##name##_LocalSet);                  \
+      type##Pop();                                                \
+      type##Pop();                                                \
+    } else {                                                      \
+      if (HasSharedSlot(to_stack_index, 1)) return false;         \
+      EMIT_INSTR_HANDLER(r2s_##name##_LocalSet);                  \
+      type##Pop();                                                \
+    }                                                             \
+    EmitI32Const(slots_[stack_[to_stack_index]].slot_offset);     \
+    reg_mode = RegMode::kNoReg;                                   \
+    return true;                                                  \
+  }
+      FOREACH_ARITHMETIC_BINOP(BINOP_CASE)
+#undef BINOP_CASE
+
       default:
         return false;
     }
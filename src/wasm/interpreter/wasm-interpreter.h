@@ -1620,7 +1620,9 @@ class WasmBytecodeGenerator {
   void PatchLoopJumpInstructions();
   void RestoreIfElseParams(uint32_t if_block_index);
 
-  bool HasSharedSlot(uint32_t stack_index) const;
+  // Returns true if a stack entry of the current block shares the slot of the
+  // entry at {stack_index}, ignoring the top {ignored_entries} entries.
+  bool HasSharedSlot(uint32_t stack_index, uint32_t ignored_entries = 0) const;
   bool FindSharedSlot(uint32_t stack_index, uint32_t* new_slot_index);
 
   inline const FunctionSig* GetFunctionSignature(uint32_t function_index) const;
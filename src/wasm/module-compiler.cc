@@ -1635,6 +1635,13 @@ void TriggerTierUp(Isolate* isolate,
   // increased at least to four, and is a power of two.
   if (priority == 2 || !base::bits::IsPowerOfTwo(priority)) return;
 
+  // All isolates which use this native module share its code. Another isolate
+  // (or an instance still running Liftoff code) might already have triggered
+  // the tier-up of this function; don't process feedback for it again.
+  if (native_module->HasCodeWithTier(func_index, ExecutionTier::kTurbofan)) {
+    return;
+  }
+
   // Before adding the tier-up unit or increasing priority, process type
   // feedback for best code generation.
   if (native_module->enabled_features().has_inlining() || module->is_wasm_gc) {
@@ -1974,6 +1981,7 @@ CompilationExecutionResult ExecuteCompilationUnits(
       // We don't eagerly compile import wrappers any more.
       DCHECK_GE(unit->func_index(), env->module->num_imported_functions);
       results_to_publish.emplace_back(std::move(result));
+      if (delegate) delegate->NotifyProgress(1);
 
       bool yield = delegate && delegate->ShouldYield();
 
@@ -2570,6 +2578,7 @@ struct ValidateFunctionsStreamingJobData {
     // Check invariant: {next <= end}.
     DCHECK_LE(next_available_unit.load(std::memory_order_relaxed), ptr);
     *ptr++ = {declared_func_index, code};
+    pending_units.fetch_add(1, std::memory_order_relaxed);
     // Use release semantics, so whoever loads this pointer (using acquire
     // semantics) sees all our previous stores.
     end_of_available_units.store(ptr, std::memory_order_release);
@@ -2617,28 +2626,40 @@ struct ValidateFunctionsStreamingJobData {
   std::atomic<Unit*> next_available_unit;
   std::atomic<Unit*> end_of_available_units;
   std::atomic<bool> found_error{false};
+  // The number of units which were added but not validated yet, plus one
+  // until the end of the stream. With --wasm-async-streaming-validation, the
+  // thread which decrements it to zero finishes validation.
+  std::atomic<int> pending_units{1};
 };
 
 class ValidateFunctionsStreamingJob final : public JobTask {
  public:
-  ValidateFunctionsStreamingJob(const WasmModule* module,
+  ValidateFunctionsStreamingJob(AsyncCompileJob* job, const WasmModule* module,
                                 WasmEnabledFeatures enabled_features,
                                 ValidateFunctionsStreamingJobData* data)
-      : module_(module), enabled_features_(enabled_features), data_(data) {}
+      : job_(job),
+        module_(module),
+        enabled_features_(enabled_features),
+        data_(data) {}
 
   void Run(JobDelegate* delegate) override {
     TRACE_EVENT0("v8.wasm", "wasm.ValidateFunctionsStreaming");
     using Unit = ValidateFunctionsStreamingJobData::Unit;
     Zone validation_zone{GetWasmEngine()->allocator(), ZONE_NAME};
     while (Unit unit = data_->GetUnit()) {
-      validation_zone.Reset();
-      DecodeResult result =
-          ValidateSingleFunction(&validation_zone, module_, unit.func_index,
-                                 unit.code, enabled_features_);
-
-      if (result.failed()) {
-        data_->found_error.store(true, std::memory_order_relaxed);
-        break;
+      // After an error, the remaining units are only counted.
+      if (!data_->found_error.load(std::memory_order_relaxed)) {
+        validation_zone.Reset();
+        DecodeResult result =
+            ValidateSingleFunction(&validation_zone, module_, unit.func_index,
+                                   unit.code, enabled_features_);
+        if (result.failed()) {
+          data_->found_error.store(true, std::memory_order_relaxed);
+        }
+      }
+      if (data_->pending_units.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        job_->OnStreamingValidationFinished();
+        return;
       }
       // After validating one function, check if we should yield.
       if (delegate->ShouldYield()) break;
@@ -2650,6 +2671,7 @@ class ValidateFunctionsStreamingJob final : public JobTask {
   }
 
  private:
+  AsyncCompileJob* const job_;
   const WasmModule* const module_;
   const WasmEnabledFeatures enabled_features_;
   ValidateFunctionsStreamingJobData* data_;
@@ -2693,8 +2715,6 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   int num_functions_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
-  ValidateFunctionsStreamingJobData validate_functions_job_data_;
-  std::unique_ptr<JobHandle> validate_functions_job_handle_;
 
   // Running hash of the wire bytes up to code section size, but excluding the
   // code section itself. Used by the {NativeModuleCache} to detect potential
@@ -2711,6 +2731,8 @@ std::shared_ptr<StreamingDecoder> AsyncCompileJob::CreateStreamingDecoder() {
 
 AsyncCompileJob::~AsyncCompileJob() {
   // Note: This destructor always runs on the foreground thread of the isolate.
+  // Cancel background validation first, so that it doesn't post new tasks.
+  if (validate_functions_job_handle_) validate_functions_job_handle_->Cancel();
   background_task_manager_.CancelAndWait();
   // If initial compilation did not finish yet we can abort it.
   if (native_module_) {
@@ -2911,6 +2933,14 @@ class AsyncCompileJob::CompilationStateCallback
       case CompilationEvent::kFinishedBaselineCompilation:
         DCHECK_EQ(CompilationEvent::kFinishedExportWrappers, last_event_);
         if (job_->DecrementAndCheckFinisherCount()) {
+          // Background validation has finished if it was a finisher, but it
+          // might have found an invalid function.
+          if (job_->StreamingValidationFailed()) {
+            GetWasmEngine()->UpdateNativeModuleCache(true, job_->native_module_,
+                                                     job_->isolate_);
+            job_->DoSync<Fail>();
+            break;
+          }
           // Install the native module in the cache, or reuse a conflicting one.
           // If we get a conflicting module, wait until we are back in the
           // main thread to update {job_->native_module_} to avoid a data race.
@@ -3254,6 +3284,55 @@ class AsyncCompileJob::Fail : public CompileStep {
   }
 };
 
+//==========================================================================
+// Step 3 or 4 (sync): Background validation of a streamed module finished.
+//==========================================================================
+class AsyncCompileJob::FinishStreamingValidation : public CompileStep {
+ private:
+  void RunInForeground(AsyncCompileJob* job) override {
+    TRACE_COMPILE("(3) Streaming validation finished\n");
+    job->validate_functions_job_handle_->Join();
+    if (!job->DecrementAndCheckFinisherCount()) return;
+    const bool failed = job->native_module_->compilation_state()->failed() ||
+                        job->StreamingValidationFailed();
+    auto* prev_native_module = job->native_module_.get();
+    job->native_module_ = GetWasmEngine()->UpdateNativeModuleCache(
+        failed, std::move(job->native_module_), job->isolate_);
+    const bool cache_hit = prev_native_module != job->native_module_.get();
+    // {Failed} and {FinishCompile} delete {job}.
+    if (failed) {
+      job->Failed();
+    } else {
+      job->FinishCompile(cache_hit);
+    }
+  }
+};
+
+// Posted from the background validation job, which must not switch the step
+// of the {AsyncCompileJob} itself.
+class AsyncCompileJob::StreamingValidationFinishedTask : public CancelableTask {
+ public:
+  explicit StreamingValidationFinishedTask(AsyncCompileJob* job)
+      : CancelableTask(&job->background_task_manager_), job_(job) {}
+
+  void RunInternal() final { job_->DoSync<FinishStreamingValidation>(); }
+
+ private:
+  AsyncCompileJob* const job_;
+};
+
+bool AsyncCompileJob::StreamingValidationFailed() const {
+  return validate_functions_job_data_ &&
+         validate_functions_job_data_->found_error.load(
+             std::memory_order_relaxed);
+}
+
+void AsyncCompileJob::OnStreamingValidationFinished() {
+  DCHECK(v8_flags.wasm_async_streaming_validation);
+  foreground_task_runner_->PostTask(
+      std::make_unique<StreamingValidationFinishedTask>(this));
+}
+
 void AsyncCompileJob::FinishSuccessfully() {
   TRACE_COMPILE("(4) Finish module...\n");
   {
@@ -3405,15 +3484,20 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
     // {bytes} is part of a section buffer owned by the streaming decoder. The
     // streaming decoder is held alive by the {AsyncCompileJob}, so we can just
     // use the {bytes} vector as long as the {AsyncCompileJob} is still running.
-    if (!validate_functions_job_handle_) {
-      validate_functions_job_data_.Initialize(module->num_declared_functions);
-      validate_functions_job_handle_ = V8::GetCurrentPlatform()->CreateJob(
-          TaskPriority::kUserVisible,
-          std::make_unique<ValidateFunctionsStreamingJob>(
-              module, enabled_features, &validate_functions_job_data_));
+    if (!job_->validate_functions_job_handle_) {
+      job_->validate_functions_job_data_ =
+          std::make_unique<ValidateFunctionsStreamingJobData>();
+      job_->validate_functions_job_data_->Initialize(
+          module->num_declared_functions);
+      job_->validate_functions_job_handle_ =
+          V8::GetCurrentPlatform()->CreateJob(
+              TaskPriority::kUserVisible,
+              std::make_unique<ValidateFunctionsStreamingJob>(
+                  job_, module, enabled_features,
+                  job_->validate_functions_job_data_.get()));
     }
-    validate_functions_job_data_.AddUnit(func_index, bytes,
-                                         validate_functions_job_handle_.get());
+    job_->validate_functions_job_data_->AddUnit(
+        func_index, bytes, job_->validate_functions_job_handle_.get());
   }
 
   auto* compilation_state = Impl(job_->native_module_->compilation_state());
@@ -3439,14 +3523,29 @@ void AsyncStreamingProcessor::OnFinishedStream(
   ModuleResult module_result = decoder_.FinishDecoding();
   if (module_result.failed()) after_error = true;
 
-  if (validate_functions_job_handle_) {
-    // Wait for background validation to finish, then check if a validation
-    // error was found.
-    // TODO(13447): Do not block here; register validation as another finisher
-    // instead.
-    validate_functions_job_handle_->Join();
-    validate_functions_job_handle_.reset();
-    if (validate_functions_job_data_.found_error) after_error = true;
+  if (job_->validate_functions_job_handle_) {
+    ValidateFunctionsStreamingJobData* data =
+        job_->validate_functions_job_data_.get();
+    if (v8_flags.wasm_async_streaming_validation && !after_error) {
+      // Don't wait for background validation, but register it as another
+      // finisher if it is still running. Register it before dropping the
+      // stream's reference on {pending_units}, so that validation cannot
+      // finish before it is registered.
+      job_->outstanding_finishers_.fetch_add(1);
+      if (data->pending_units.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // All function bodies were validated already.
+        CHECK(!job_->DecrementAndCheckFinisherCount());
+        if (data->found_error.load(std::memory_order_relaxed)) {
+          after_error = true;
+        }
+      }
+    } else {
+      // Wait for background validation to finish, then check if a validation
+      // error was found.
+      job_->validate_functions_job_handle_->Join();
+      job_->validate_functions_job_handle_.reset();
+      if (data->found_error) after_error = true;
+    }
   }
 
   job_->wire_bytes_ = ModuleWireBytes(bytes.as_vector());
@@ -3539,7 +3638,8 @@ void AsyncStreamingProcessor::OnFinishedStream(
   const bool needs_finish = job_->DecrementAndCheckFinisherCount();
   DCHECK_IMPLIES(!has_code_section, needs_finish);
   if (needs_finish) {
-    const bool failed = job_->native_module_->compilation_state()->failed();
+    const bool failed = job_->native_module_->compilation_state()->failed() ||
+                        job_->StreamingValidationFailed();
     if (!cache_hit) {
       auto* prev_native_module = job_->native_module_.get();
       job_->native_module_ = GetWasmEngine()->UpdateNativeModuleCache(
@@ -3558,9 +3658,9 @@ void AsyncStreamingProcessor::OnFinishedStream(
 
 void AsyncStreamingProcessor::OnAbort() {
   TRACE_STREAMING("Abort stream...\n");
-  if (validate_functions_job_handle_) {
-    validate_functions_job_handle_->Cancel();
-    validate_functions_job_handle_.reset();
+  if (job_->validate_functions_job_handle_) {
+    job_->validate_functions_job_handle_->Cancel();
+    job_->validate_functions_job_handle_.reset();
   }
   if (job_->native_module_ && job_->native_module_->wire_bytes().empty()) {
     // Clean up the temporary cache entry.
@@ -48,6 +48,7 @@ class ModuleCompiler;
 class NativeModule;
 class ProfileInformation;
 class StreamingDecoder;
+struct ValidateFunctionsStreamingJobData;
 class WasmCode;
 struct WasmModule;
 
@@ -155,7 +156,14 @@ class AsyncCompileJob {
   // promise.
   class Fail;
 
+  // Background validation of function bodies finished after the end of the
+  // stream (see --wasm-async-streaming-validation). Finishes the compilation
+  // if it was the last finisher.
+  class FinishStreamingValidation;
+  class StreamingValidationFinishedTask;
+
   friend class AsyncStreamingProcessor;
+  friend class ValidateFunctionsStreamingJob;
 
   // Decrements the number of outstanding finishers. The last caller of this
   // function should finish the asynchronous compilation, see the comment on
@@ -174,6 +182,14 @@ class AsyncCompileJob {
 
   void FinishCompile(bool is_after_cache_hit);
 
+  // Returns true if background validation of function bodies during streaming
+  // found an invalid function.
+  bool StreamingValidationFailed() const;
+
+  // Called from the background validation job when the last function body
+  // after the end of the stream was validated.
+  void OnStreamingValidationFinished();
+
   void Failed();
 
   void AsyncCompileSucceeded(Handle<WasmModuleObject> result);
@@ -240,7 +256,9 @@ class AsyncCompileJob {
 
   // For async compilation the AsyncCompileJob is the only finisher. For
   // streaming compilation also the AsyncStreamingProcessor has to finish before
-  // compilation can be finished.
+  // compilation can be finished, and with --wasm-async-streaming-validation
+  // also the background validation of function bodies if it is still running
+  // at the end of the stream.
   std::atomic<int32_t> outstanding_finishers_{1};
 
   // A reference to a pending foreground task, or {nullptr} if none is pending.
@@ -252,6 +270,13 @@ class AsyncCompileJob {
   // StreamingDecoder.
   std::shared_ptr<StreamingDecoder> stream_;
 
+  // Validates function bodies in the background during streaming compilation.
+  // They are owned by the {AsyncCompileJob} (rather than by the
+  // {AsyncStreamingProcessor}), so that validation can outlive the stream.
+  std::unique_ptr<ValidateFunctionsStreamingJobData>
+      validate_functions_job_data_;
+  std::unique_ptr<JobHandle> validate_functions_job_handle_;
+
   // The compilation id to identify trace events linked to this compilation.
   const int compilation_id_;
 };
@@ -1974,19 +1974,6 @@ bool InstanceBuilder::ProcessImportedFunction(
     }
     default: {
       // The imported function is a callable.
-      if (UseGenericWasmToJSWrapper(kind, expected_sig, resolved.suspend())) {
-        DCHECK(kind == ImportCallKind::kJSFunctionArityMatch ||
-               kind == ImportCallKind::kJSFunctionArityMismatch);
-        imported_entry.SetGenericWasmToJs(isolate_, js_receiver,
-                                          resolved.suspend(), expected_sig);
-        break;
-      }
-      if (v8_flags.wasm_jitless) {
-        WasmCode* no_code = nullptr;
-        imported_entry.SetCompiledWasmToJs(isolate_, js_receiver, no_code,
-                                           resolved.suspend(), expected_sig);
-        break;
-      }
       int expected_arity = static_cast<int>(expected_sig->parameter_count());
       if (kind == ImportCallKind::kJSFunctionArityMismatch) {
         auto function = Cast<JSFunction>(js_receiver);
@@ -1999,6 +1986,33 @@ bool InstanceBuilder::ProcessImportedFunction(
           module_->canonical_sig_id(module_->functions[func_index].sig_index);
       WasmImportWrapperCache* cache = GetWasmImportWrapperCache();
       WasmCodeRefScope code_ref_scope;
+      if (UseGenericWasmToJSWrapper(kind, expected_sig, resolved.suspend())) {
+        DCHECK(kind == ImportCallKind::kJSFunctionArityMatch ||
+               kind == ImportCallKind::kJSFunctionArityMismatch);
+        // If the generic wrapper of another import with the same signature
+        // and callee kind already tiered up, e.g. in an earlier instance of
+        // this module, start with the compiled wrapper right away.
+        WasmCode* wasm_code =
+            v8_flags.wasm_to_js_reuse_tiered_wrappers
+                ? cache->MaybeGet(kind, canonical_sig_id, expected_arity,
+                                  resolved.suspend())
+                : nullptr;
+        if (wasm_code) {
+          imported_entry.SetCompiledWasmToJs(isolate_, js_receiver, wasm_code,
+                                             resolved.suspend(), expected_sig);
+        } else {
+          imported_entry.SetGenericWasmToJs(isolate_, js_receiver,
+                                            resolved.suspend(), expected_sig);
+        }
+        break;
+      }
+      if (v8_flags.wasm_jitless) {
+        WasmCode* no_code = nullptr;
+        imported_entry.SetCompiledWasmToJs(isolate_, js_receiver, no_code,
+                                           resolved.suspend(), expected_sig);
+        break;
+      }
+
       WasmCode* wasm_code = cache->MaybeGet(kind, canonical_sig_id,
                                             expected_arity, resolved.suspend());
       if (!wasm_code) {
@@ -102,60 +102,109 @@ class ProfileGenerator {
   const std::atomic<uint32_t>* const tiering_budget_array_;
 };
 
-void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
-  base::SharedMutexGuard<base::kShared> type_feedback_guard{
-      &module->type_feedback.mutex};
-  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
-      module->type_feedback.feedback_for_function;
+// Decodes the type feedback of a profile into {type_feedback}. Returns false
+// if the data is malformed or doesn't fit {module}.
+bool DeserializeTypeFeedback(
+    Decoder& decoder, const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>>* type_feedback) {
+  const uint32_t num_functions = static_cast<uint32_t>(module->functions.size());
   uint32_t num_entries = decoder.consume_u32v("num function entries");
-  CHECK_LE(num_entries, module->num_declared_functions);
+  if (num_entries > module->num_declared_functions) return false;
+  type_feedback->reserve(num_entries);
   for (uint32_t missing_entries = num_entries; missing_entries > 0;
        --missing_entries) {
     FunctionTypeFeedback feedback;
     uint32_t function_index = decoder.consume_u32v("function index");
-    // Deserialize {feedback_vector}.
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      return false;
+    }
+    // Deserialize {feedback_vector}. Each entry takes at least one byte.
     uint32_t feedback_vector_size =
         decoder.consume_u32v("feedback vector size");
+    if (feedback_vector_size > decoder.available_bytes()) return false;
     feedback.feedback_vector.resize(feedback_vector_size);
     for (CallSiteFeedback& feedback : feedback.feedback_vector) {
       int num_cases = decoder.consume_i32v("num cases");
+      if (num_cases < 0 || num_cases > kMaxPolymorphism) return false;
       if (num_cases == 0) continue;  // no feedback
       if (num_cases == 1) {          // monomorphic
         int called_function_index = decoder.consume_i32v("function index");
         int call_count = decoder.consume_i32v("call count");
+        if (static_cast<uint32_t>(called_function_index) >= num_functions) {
+          return false;
+        }
         feedback = CallSiteFeedback{called_function_index, call_count};
       } else {  // polymorphic
         auto* polymorphic = new CallSiteFeedback::PolymorphicCase[num_cases];
+        // {feedback} owns the cases from now on.
+        feedback = CallSiteFeedback{polymorphic, num_cases};
         for (int i = 0; i < num_cases; ++i) {
           polymorphic[i].function_index =
               decoder.consume_i32v("function index");
           polymorphic[i].absolute_call_frequency =
               decoder.consume_i32v("call count");
+          if (static_cast<uint32_t>(polymorphic[i].function_index) >=
+              num_functions) {
+            return false;
+          }
         }
-        feedback = CallSiteFeedback{polymorphic, num_cases};
       }
     }
-    // Deserialize {call_targets}.
+    // Deserialize {call_targets}. Each entry takes at least one byte.
     uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (num_call_targets > decoder.available_bytes()) return false;
+    if (feedback_vector_size != 0 && feedback_vector_size != num_call_targets) {
+      return false;
+    }
     feedback.call_targets =
         base::OwnedVector<uint32_t>::NewForOverwrite(num_call_targets);
     for (uint32_t& call_target : feedback.call_targets) {
       call_target = decoder.consume_u32v("call target");
+      if (call_target >= num_functions &&
+          call_target != FunctionTypeFeedback::kCallRef &&
+          call_target != FunctionTypeFeedback::kCallIndirect) {
+        return false;
+      }
     }
+    if (!decoder.ok()) return false;
+    type_feedback->emplace_back(function_index, std::move(feedback));
+  }
+  return decoder.ok();
+}
 
-    // Finally, insert the new feedback into the map. Overwrite existing
-    // feedback, but check for consistency.
+// Inserts {type_feedback} into {module}. Existing feedback is overwritten, but
+// only if it is consistent with the new feedback; otherwise nothing is changed
+// and false is returned.
+bool InstallTypeFeedback(
+    const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>> type_feedback) {
+  base::SharedMutexGuard<base::kShared> type_feedback_guard{
+      &module->type_feedback.mutex};
+  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  for (const auto& [function_index, feedback] : type_feedback) {
+    auto feedback_it = feedback_for_function.find(function_index);
+    if (feedback_it == feedback_for_function.end()) continue;
+    const FunctionTypeFeedback& old_feedback = feedback_it->second;
+    if (!old_feedback.feedback_vector.empty() &&
+        old_feedback.feedback_vector.size() !=
+            feedback.feedback_vector.size()) {
+      return false;
+    }
+    if (old_feedback.call_targets.as_vector() !=
+        feedback.call_targets.as_vector()) {
+      return false;
+    }
+  }
+  for (auto& [function_index, feedback] : type_feedback) {
     auto [feedback_it, is_new] =
         feedback_for_function.emplace(function_index, std::move(feedback));
     if (!is_new) {
-      FunctionTypeFeedback& old_feedback = feedback_it->second;
-      CHECK(old_feedback.feedback_vector.empty() ||
-            old_feedback.feedback_vector.size() == feedback_vector_size);
-      CHECK_EQ(old_feedback.call_targets.as_vector(),
-               feedback.call_targets.as_vector());
-      std::swap(old_feedback.feedback_vector, feedback.feedback_vector);
+      std::swap(feedback_it->second.feedback_vector, feedback.feedback_vector);
     }
   }
+  return true;
 }
 
 std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
@@ -166,31 +215,60 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
     uint8_t tiering_info = decoder.consume_u8("tiering info");
-    CHECK_EQ(0, tiering_info & ~3);
+    if (tiering_info & ~3) return {};
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
     if (was_tiered_up) tiered_up_functions.push_back(func_index);
     if (was_executed) executed_functions.push_back(func_index);
   }
+  if (!decoder.ok()) return {};
 
   return std::make_unique<ProfileInformation>(std::move(executed_functions),
                                               std::move(tiered_up_functions));
 }
 
+// Returns nullptr without changing {module} if {decoder} doesn't hold valid
+// profile data for {module}.
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
-  Decoder decoder{profile_data.begin(), profile_data.end()};
-
-  DeserializeTypeFeedback(decoder, module);
+    const WasmModule* module, Decoder& decoder) {
+  std::vector<std::pair<uint32_t, FunctionTypeFeedback>> type_feedback;
+  if (!DeserializeTypeFeedback(decoder, module, &type_feedback)) return {};
   std::unique_ptr<ProfileInformation> pgo_info =
       DeserializeTieringInformation(decoder, module);
+  if (!pgo_info || decoder.pc() != decoder.end()) return {};
 
-  CHECK(decoder.ok());
-  CHECK_EQ(decoder.pc(), decoder.end());
-
+  if (!InstallTypeFeedback(module, std::move(type_feedback))) return {};
   return pgo_info;
 }
 
+base::OwnedVector<uint8_t> GetProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array) {
+  ProfileGenerator profile_generator{module, tiering_budget_array};
+  base::OwnedVector<uint8_t> profile_data = profile_generator.GetProfileData();
+
+  // Prefix the data with the hash of the wire bytes, so that a profile is not
+  // accidentally applied to a different module.
+  AccountingAllocator allocator;
+  Zone zone{&allocator, "wasm::GetProfile"};
+  ZoneBuffer buffer{&zone};
+  buffer.write_u32(static_cast<uint32_t>(GetWireBytesHash(wire_bytes)));
+  buffer.write(profile_data.begin(), profile_data.size());
+  return base::OwnedVector<uint8_t>::Of(buffer);
+}
+
+std::unique_ptr<ProfileInformation> LoadProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile) {
+  Decoder decoder{profile.begin(), profile.end()};
+  uint32_t hash = decoder.consume_u32("wire bytes hash", nullptr);
+  if (!decoder.ok() ||
+      hash != static_cast<uint32_t>(GetWireBytesHash(wire_bytes))) {
+    return {};
+  }
+  return RestoreProfileData(module, decoder);
+}
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array) {
@@ -248,7 +326,11 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
 
   base::Fclose(file);
 
-  return RestoreProfileData(module, profile_data.as_vector());
+  Decoder decoder{profile_data.begin(), profile_data.end()};
+  std::unique_ptr<ProfileInformation> pgo_info =
+      RestoreProfileData(module, decoder);
+  CHECK_NOT_NULL(pgo_info);
+  return pgo_info;
 }
 
 }  // namespace v8::internal::wasm
@@ -47,6 +47,20 @@ void DumpProfileToFile(const WasmModule* module,
 V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
     const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
 
+// Returns the type feedback and tiering decisions of {module}, in a format
+// that {LoadProfile} accepts for a new compilation of the same wire bytes.
+base::OwnedVector<uint8_t> GetProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array);
+
+// Installs the type feedback of a profile returned by {GetProfile} in
+// {module}, and returns its tiering information. Returns nullptr without
+// changing {module} if {profile} is malformed or was not created for
+// {wire_bytes}.
+V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_PGO_H_
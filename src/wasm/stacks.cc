@@ -5,7 +5,9 @@
 #include "src/wasm/stacks.h"
 
 #include "src/base/platform/platform.h"
+#include "src/execution/isolate.h"
 #include "src/execution/simulator.h"
+#include "src/logging/counters.h"
 #include "src/wasm/wasm-engine.h"
 
 namespace v8::internal::wasm {
@@ -71,7 +73,8 @@ bool StackMemory::Grow(Address current_fp) {
     const size_t size_limit = v8_flags.stack_size * KB;
     PageAllocator* allocator = GetPlatformPageAllocator();
     auto page_size = allocator->AllocatePageSize();
-    size_t room_to_grow = RoundDown(size_limit - size_, page_size);
+    size_t room_to_grow =
+        size_ < size_limit ? RoundDown(size_limit - size_, page_size) : 0;
     size_t new_size = std::min(2 * active_segment_->size_, room_to_grow);
     if (new_size < page_size) {
       // We cannot grow less than page size.
@@ -119,28 +122,45 @@ void StackMemory::Reset() {
 #endif
 }
 
-std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
+std::unique_ptr<StackMemory> StackPool::GetOrAllocate(Isolate* isolate) {
   std::unique_ptr<StackMemory> stack;
   if (freelist_.empty()) {
     stack = StackMemory::New();
+    allocated_count_++;
+    isolate->counters()->wasm_stacks_allocated()->Increment();
   } else {
     stack = std::move(freelist_.back());
     freelist_.pop_back();
-    size_ -= stack->size_;
+    size_ -= stack->allocated_size();
+    reused_count_++;
+    isolate->counters()->wasm_stacks_reused()->Increment();
   }
   return stack;
 }
 
-void StackPool::Add(std::unique_ptr<StackMemory> stack) {
-  if (size_ + stack->size_ > kMaxSize) {
+void StackPool::Add(Isolate* isolate, std::unique_ptr<StackMemory> stack) {
+  // Stacks keep the segments they grew, so account for all of them.
+  size_t stack_size = stack->allocated_size();
+  if (size_ + stack_size > kMaxSize) {
     return;
   }
-  size_ += stack->allocated_size();
+  size_ += stack_size;
   stack->Reset();
   freelist_.push_back(std::move(stack));
+  isolate->counters()->wasm_stack_pool_size_kb()->AddSample(
+      static_cast<int>(size_ / KB));
 }
 
-void StackPool::ReleaseFinishedStacks() { freelist_.clear(); }
+void StackPool::ReleaseFinishedStacks(Isolate* isolate) {
+  if (size_t requested = reused_count_ + allocated_count_; requested > 0) {
+    isolate->counters()->wasm_stack_pool_reuse_percent()->AddSample(
+        static_cast<int>(100 * reused_count_ / requested));
+  }
+  reused_count_ = 0;
+  allocated_count_ = 0;
+  freelist_.clear();
+  size_ = 0;
+}
 
 size_t StackPool::Size() const {
   return freelist_.size() * sizeof(decltype(freelist_)::value_type) + size_;
@@ -166,16 +166,22 @@ class StackMemory {
 class StackPool {
  public:
   // Gets a stack from the free list if one exists, else allocates it.
-  std::unique_ptr<StackMemory> GetOrAllocate();
+  std::unique_ptr<StackMemory> GetOrAllocate(Isolate* isolate);
   // Adds a finished stack to the free list.
-  void Add(std::unique_ptr<StackMemory> stack);
+  void Add(Isolate* isolate, std::unique_ptr<StackMemory> stack);
   // Decommit the stack memories and empty the freelist.
-  void ReleaseFinishedStacks();
+  void ReleaseFinishedStacks(Isolate* isolate);
   size_t Size() const;
 
  private:
   std::vector<std::unique_ptr<StackMemory>> freelist_;
+  // The allocated size of the stacks in the free list, including the segments
+  // they grew.
   size_t size_ = 0;
+  // The number of stacks that were taken from the free list and that were
+  // newly allocated since the last release of the free list.
+  size_t reused_count_ = 0;
+  size_t allocated_count_ = 0;
   // If the next finished stack would move the total size above this limit, the
   // stack is freed instead of being added to the free list.
   static constexpr int kMaxSize = 4 * MB;
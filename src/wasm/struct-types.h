@@ -9,6 +9,8 @@
 #ifndef V8_WASM_STRUCT_TYPES_H_
 #define V8_WASM_STRUCT_TYPES_H_
 
+#include <array>
+
 #include "src/base/iterator.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
@@ -71,7 +73,7 @@ class StructType : public ZoneObject {
     return field_count() == 0 ? 0 : field_offsets_[field_count() - 1];
   }
 
-  uint32_t Align(uint32_t offset, uint32_t alignment) {
+  static uint32_t Align(uint32_t offset, uint32_t alignment) {
     return RoundUp(offset, std::min(alignment, uint32_t{kTaggedSize}));
   }
 
@@ -79,39 +81,21 @@ class StructType : public ZoneObject {
     if (field_count() == 0) return;
     DCHECK(!offsets_initialized_);
     uint32_t offset = field(0).value_kind_size();
-    // Optimization: we track the last gap that was introduced by alignment,
-    // and place any sufficiently-small fields in it.
+    // Optimization: we track the gaps that were introduced by alignment, and
+    // place any sufficiently-small fields in them.
     // It's important that the algorithm that assigns offsets to fields is
     // subtyping-safe, i.e. two lists of fields with a common prefix must
     // always compute the same offsets for the fields in this common prefix.
-    uint32_t gap_position = 0;
-    uint32_t gap_size = 0;
+    // This is also why fields are never reordered, e.g. to group references.
+    FieldGaps gaps;
     for (uint32_t i = 1; i < field_count(); i++) {
       uint32_t field_size = field(i).value_kind_size();
-      if (field_size <= gap_size) {
-        uint32_t aligned_gap = Align(gap_position, field_size);
-        uint32_t gap_before = aligned_gap - gap_position;
-        uint32_t aligned_gap_size = gap_size - gap_before;
-        if (field_size <= aligned_gap_size) {
-          field_offsets_[i - 1] = aligned_gap;
-          uint32_t gap_after = aligned_gap_size - field_size;
-          if (gap_before > gap_after) {
-            // Keep old {gap_position}.
-            gap_size = gap_before;
-          } else {
-            gap_position = aligned_gap + field_size;
-            gap_size = gap_after;
-          }
-          continue;  // Successfully placed the field in the gap.
-        }
+      if (gaps.TryPlace(field_size, &field_offsets_[i - 1])) {
+        continue;  // Successfully placed the field in a gap.
       }
       uint32_t old_offset = offset;
       offset = Align(offset, field_size);
-      uint32_t gap = offset - old_offset;
-      if (gap > gap_size) {
-        gap_size = gap;
-        gap_position = old_offset;
-      }
+      gaps.Add(old_offset, offset - old_offset);
       field_offsets_[i - 1] = offset;
       offset += field_size;
     }
@@ -193,6 +177,51 @@ class StructType : public ZoneObject {
       (kV8MaxWasmStructFields - 1) * kMaxValueTypeSize;
 
  private:
+  // The gaps between fields which were introduced by alignment. Only the
+  // biggest {kMaxGaps} gaps are remembered.
+  class FieldGaps {
+   public:
+    void Add(uint32_t position, uint32_t size) {
+      if (size == 0) return;
+      Gap* smallest = &gaps_[0];
+      for (Gap& gap : gaps_) {
+        if (gap.size < smallest->size) smallest = &gap;
+      }
+      if (smallest->size < size) *smallest = {position, size};
+    }
+
+    // Places a field of {field_size} in the smallest gap that can hold it.
+    // Returns false if there is no such gap.
+    bool TryPlace(uint32_t field_size, uint32_t* offset) {
+      Gap* best = nullptr;
+      uint32_t best_offset = 0;
+      for (Gap& gap : gaps_) {
+        if (gap.size < field_size) continue;
+        if (best != nullptr && gap.size >= best->size) continue;
+        uint32_t aligned = Align(gap.position, field_size);
+        if (aligned + field_size > gap.position + gap.size) continue;
+        best = &gap;
+        best_offset = aligned;
+      }
+      if (best == nullptr) return false;
+      Gap old = *best;
+      *best = {};
+      Add(old.position, best_offset - old.position);
+      Add(best_offset + field_size,
+          old.position + old.size - (best_offset + field_size));
+      *offset = best_offset;
+      return true;
+    }
+
+   private:
+    struct Gap {
+      uint32_t position = 0;
+      uint32_t size = 0;
+    };
+    static constexpr int kMaxGaps = 4;
+    std::array<Gap, kMaxGaps> gaps_;
+  };
+
   const uint32_t field_count_;
 #if DEBUG
   bool offsets_initialized_ = false;
@@ -6912,6 +6912,39 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     }
   }
 
+  // Returns true if the 64-bit {index} is known to be below {limit}, e.g.
+  // because it is a zero-extended i32 or masked with a small constant.
+  bool IndexIsBelow(OpIndex index, uint64_t limit) {
+    if (!index.valid()) return false;
+    OperationMatcher matcher(__ output_graph());
+    uint64_t constant;
+    if (matcher.MatchIntegralWord64Constant(index, &constant)) {
+      return constant < limit;
+    }
+    OpIndex input;
+    if (matcher.MatchChange(index, &input,
+                            compiler::turboshaft::ChangeOp::Kind::kZeroExtend,
+                            RegisterRepresentation::Word32(),
+                            RegisterRepresentation::Word64())) {
+      return limit > uint64_t{kMaxUInt32};
+    }
+    V<Word64> value;
+    if (matcher.MatchBitwiseAndWithConstant(
+            index, &value, &constant,
+            compiler::turboshaft::WordRepresentation::Word64())) {
+      return constant < limit;
+    }
+    int amount;
+    if (matcher.MatchConstantShift(
+            index, &input,
+            compiler::turboshaft::ShiftOp::Kind::kShiftRightLogical,
+            compiler::turboshaft::WordRepresentation::Word64(), &amount) &&
+        amount > 0) {
+      return (uint64_t{1} << (64 - amount)) <= limit;
+    }
+    return false;
+  }
+
   std::pair<V<WordPtr>, compiler::BoundsCheckResult> BoundsCheckMem(
       const wasm::WasmMemory* memory, MemoryRepresentation repr, OpIndex index,
       uintptr_t offset, compiler::EnforceBoundsCheck enforce_bounds_check,
@@ -6991,8 +7024,11 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     if (bounds_checks == kTrapHandler &&
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
-      if (memory->is_memory64) {
-        V<Word32> cond = __ __ Uint64LessThan(
+      // The guard regions of memory64 only cover indexes below the guards
+      // size; skip the check if the index is known to be in that range.
+      if (memory->is_memory64 &&
+          !IndexIsBelow(index, memory->GetMemory64GuardsSize())) {
+        V<Word32> cond = __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
             __ Word64Constant(memory->GetMemory64GuardsSize()));
         __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
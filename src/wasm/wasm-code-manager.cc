@@ -832,6 +832,46 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
     code_space = free_code_space_.Allocate(size);
     CHECK(!code_space.is_empty());
   }
+  return CommitCodeSpace(code_space);
+}
+
+base::Vector<uint8_t> WasmCodeAllocator::AllocateForHotCode(
+    NativeModule* native_module, size_t size) {
+  DCHECK_LT(0, size);
+  size = RoundUp<kCodeAlignment>(size);
+  base::AddressRegion code_space = hot_code_space_.Allocate(size);
+  if (V8_UNLIKELY(code_space.is_empty())) {
+    if (!ReserveHotCodeRegion(size)) {
+      return AllocateForCode(native_module, size);
+    }
+    code_space = hot_code_space_.Allocate(size);
+    CHECK(!code_space.is_empty());
+  }
+  return CommitCodeSpace(code_space);
+}
+
+bool WasmCodeAllocator::ReserveHotCodeRegion(size_t size) {
+  size_t region_size = RoundUp<kHotCodeRegionSize>(size);
+  for (base::AddressRegion free_region : free_code_space_.regions()) {
+    Address aligned_start = RoundUp<kHotCodeRegionSize>(free_region.begin());
+    if (aligned_start >= free_region.end() ||
+        free_region.end() - aligned_start < region_size) {
+      continue;
+    }
+    base::AddressRegion hot_region = free_code_space_.AllocateInRegion(
+        region_size, {aligned_start, region_size});
+    DCHECK_EQ(aligned_start, hot_region.begin());
+    hot_code_space_.Merge(hot_region);
+    TRACE_HEAP("Hot code region for %p: 0x%" PRIxPTR ",+%zu\n", this,
+               hot_region.begin(), hot_region.size());
+    return true;
+  }
+  return false;
+}
+
+base::Vector<uint8_t> WasmCodeAllocator::CommitCodeSpace(
+    base::AddressRegion code_space) {
+  auto* code_manager = GetWasmCodeManager();
   const Address commit_page_size = CommitPageSize();
   Address commit_start = RoundUp(code_space.begin(), commit_page_size);
   Address commit_end = RoundUp(code_space.end(), commit_page_size);
@@ -857,7 +897,7 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
 
   TRACE_HEAP("Code alloc for %p: 0x%" PRIxPTR ",+%zu\n", this,
-             code_space.begin(), size);
+             code_space.begin(), code_space.size());
   return {reinterpret_cast<uint8_t*>(code_space.begin()), code_space.size()};
 }
 
@@ -2432,9 +2472,22 @@ std::vector<std::unique_ptr<WasmCode>> NativeModule::AddCompiledCode(
   }
   base::Vector<uint8_t> code_space;
   NativeModule::JumpTablesRef jump_tables;
+  // With --wasm-hot-code-region, keep code of functions which were tiered up
+  // dynamically apart from the (much bigger) Liftoff code, to improve its
+  // locality. The Liftoff code which it replaces is freed by the wasm code GC.
+  const bool is_hot_code =
+      v8_flags.wasm_hot_code_region &&
+      compilation_state_->dynamic_tiering() &&
+      std::all_of(results.begin(), results.end(), [](const auto& result) {
+        return result.result_tier == ExecutionTier::kTurbofan &&
+               result.for_debugging == kNotForDebugging;
+      });
   {
     base::RecursiveMutexGuard guard{&allocation_mutex_};
-    code_space = code_allocator_.AllocateForCode(this, total_code_space);
+    code_space =
+        is_hot_code
+            ? code_allocator_.AllocateForHotCode(this, total_code_space)
+            : code_allocator_.AllocateForCode(this, total_code_space);
     // Lookup the jump tables to use once, then use for all code objects.
     jump_tables =
         FindJumpTablesForRegionLocked(base::AddressRegionOf(code_space));
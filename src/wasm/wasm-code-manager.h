@@ -488,6 +488,12 @@ class WasmCodeAllocator {
   base::Vector<uint8_t> AllocateForCode(NativeModule*, size_t size);
   // Same, but for wrappers (which are shared across NativeModules).
   base::Vector<uint8_t> AllocateForWrapper(size_t size);
+  // Same, but for tiered-up code of hot functions, which is packed into a
+  // contiguous region aligned to {kHotCodeRegionSize} (see
+  // --wasm-hot-code-region). Falls back to {AllocateForCode} if no such region
+  // can be reserved.
+  // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
+  base::Vector<uint8_t> AllocateForHotCode(NativeModule*, size_t size);
 
   // Allocate code space within a specific region. Returns a valid buffer or
   // fails with OOM (crash).
@@ -505,13 +511,27 @@ class WasmCodeAllocator {
 
   Counters* counters() const { return async_counters_.get(); }
 
+  // The size (and alignment) of the regions for hot code. This matches the
+  // size of a transparent huge page on x64 and arm64 Linux.
+  static constexpr size_t kHotCodeRegionSize = size_t{2} * MB;
+
  private:
+  // Carve a region for hot code which can hold {size} bytes out of
+  // {free_code_space_}. Returns false if there is no such free region.
+  bool ReserveHotCodeRegion(size_t size);
+
+  // Commit the pages of a newly allocated {code_space} and do the bookkeeping.
+  base::Vector<uint8_t> CommitCodeSpace(base::AddressRegion code_space);
+
   //////////////////////////////////////////////////////////////////////////////
   // These fields are protected by the mutex in {NativeModule}.
 
   // Code space that was reserved and is available for allocations
   // (subset of {owned_code_space_}).
   DisjointAllocationPool free_code_space_;
+  // Code space for hot code that is available for allocations. Each region
+  // was taken from {free_code_space_} and is aligned to {kHotCodeRegionSize}.
+  DisjointAllocationPool hot_code_space_;
   // Code space that was allocated before but is dead now. Full
   // pages within this region are discarded. It's still a subset of
   // {owned_code_space_}.
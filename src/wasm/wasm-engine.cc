@@ -659,7 +659,7 @@ Handle<WasmModuleObject> WasmEngine::FinalizeTranslatedAsmJs(
 MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, WasmEnabledFeatures enabled,
     CompileTimeImports compile_imports, ErrorThrower* thrower,
-    ModuleWireBytes bytes) {
+    ModuleWireBytes bytes, base::Vector<const uint8_t> profile) {
   int compilation_id = next_compilation_id_.fetch_add(1);
   TRACE_EVENT1("v8.wasm", "wasm.SyncCompile", "id", compilation_id);
   v8::metrics::Recorder::ContextId context_id =
@@ -685,9 +685,13 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     }
   }
 
-  // If experimental PGO via files is enabled, load profile information now.
+  // Load profile information from the embedder, or from a file if
+  // experimental PGO via files is enabled. Invalid embedder profiles are
+  // ignored.
   std::unique_ptr<ProfileInformation> pgo_info;
-  if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
+  if (!profile.empty()) {
+    pgo_info = LoadProfile(module.get(), bytes.module_bytes(), profile);
+  } else if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
     pgo_info = LoadProfileFromFile(module.get(), bytes.module_bytes());
   }
 
@@ -2003,6 +2007,8 @@ size_t WasmEngine::EstimateCurrentMemoryConsumption() const {
       result += ContentSize(current_gc_info_->dead_code);
     }
   }
+  // The import wrappers are shared by all isolates in the process.
+  result += GetWasmImportWrapperCache()->EstimateCurrentMemoryConsumption();
   if (v8_flags.trace_wasm_offheap_memory) {
     PrintF("WasmEngine: %zu\n", result);
   }
@@ -184,11 +184,12 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   // Synchronously compiles the given bytes that represent an encoded Wasm
   // module.
-  MaybeHandle<WasmModuleObject> SyncCompile(Isolate* isolate,
-                                            WasmEnabledFeatures enabled,
-                                            CompileTimeImports compile_imports,
-                                            ErrorThrower* thrower,
-                                            ModuleWireBytes bytes);
+  // If {profile} is not empty, it is a profile returned by {GetProfile} (see
+  // pgo.h) which guides tiering and inlining of the new module.
+  MaybeHandle<WasmModuleObject> SyncCompile(
+      Isolate* isolate, WasmEnabledFeatures enabled,
+      CompileTimeImports compile_imports, ErrorThrower* thrower,
+      ModuleWireBytes bytes, base::Vector<const uint8_t> profile = {});
 
   // Synchronously instantiate the given Wasm module with the given imports.
   // If the module represents an asm.js module, then the supplied {memory}
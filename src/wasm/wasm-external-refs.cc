@@ -982,7 +982,7 @@ void return_switch(Isolate* isolate, Address raw_continuation) {
   for (size_t i = 0; i < isolate->wasm_stacks().size(); ++i) {
     SLOW_DCHECK(isolate->wasm_stacks()[i]->index() == i);
   }
-  isolate->stack_pool().Add(std::move(stack));
+  isolate->stack_pool().Add(isolate, std::move(stack));
   isolate->SyncStackLimit();
 }
 
@@ -199,8 +199,12 @@ WasmCode* WasmImportWrapperCache::Lookup(Address pc) const {
 size_t WasmImportWrapperCache::EstimateCurrentMemoryConsumption() const {
   UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 120);
   base::MutexGuard lock(&mutex_);
-  return sizeof(WasmImportWrapperCache) + ContentSize(entry_map_) +
-         ContentSize(codes_);
+  size_t result = sizeof(WasmImportWrapperCache) + ContentSize(entry_map_) +
+                  ContentSize(codes_);
+  for (const auto& [address, code] : codes_) {
+    result += code->EstimateCurrentMemoryConsumption();
+  }
+  return result;
 }
 
 }  // namespace v8::internal::wasm
@@ -665,7 +665,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
  private:
   friend class DeserializeCodeTask;
 
-  void ReadHeader(Reader* reader);
+  bool ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
   void CopyAndRelocate(const DeserializationUnit& unit);
@@ -684,6 +684,8 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> eager_functions_;
+  // Set once the data ends before the code of a function.
+  bool truncated_ = false;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -756,7 +758,7 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   read_called_ = true;
 #endif
 
-  ReadHeader(reader);
+  if (!ReadHeader(reader)) return false;
   if (compile_imports_.compare(native_module_->compile_imports()) != 0) {
     return false;
   }
@@ -787,6 +789,12 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   std::vector<DeserializationUnit> batch;
   size_t batch_size = 0;
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    // With --wasm-partial-deserialization, the functions after the end of
+    // truncated data are compiled lazily.
+    if (truncated_) {
+      lazy_functions_.push_back(i);
+      continue;
+    }
     DeserializationUnit unit = ReadCode(i, reader);
     if (!unit.code) continue;
     batch_size += unit.code->instructions().size();
@@ -801,8 +809,8 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
 
   // We should have read the expected amount of code now, and should have fully
   // utilized the allocated code space.
-  DCHECK_EQ(0, remaining_code_size_);
-  DCHECK_EQ(0, current_code_space_.size());
+  DCHECK_IMPLIES(!truncated_, remaining_code_size_ == 0);
+  DCHECK_IMPLIES(!truncated_, current_code_space_.empty());
 
   if (!batch.empty()) {
     reloc_queue.Add(std::move(batch));
@@ -812,14 +820,22 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   // Wait for all tasks to finish, while participating in their work.
   job_handle->Join();
 
+  if (truncated_) return true;
   ReadTieringBudget(reader);
   return reader->current_size() == 0;
 }
 
-void NativeModuleDeserializer::ReadHeader(Reader* reader) {
+bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
+  if (reader->current_size() <
+      sizeof(CompileTimeImportFlags::StorageType) + sizeof(uint32_t)) {
+    return false;
+  }
   auto compile_imports_flags =
       reader->Read<CompileTimeImportFlags::StorageType>();
   uint32_t constants_module_size = reader->Read<uint32_t>();
+  if (reader->current_size() < constants_module_size + kHeaderSize) {
+    return false;
+  }
   base::Vector<const char> constants_module_data =
       reader->ReadVector<char>(constants_module_size);
   compile_imports_ = CompileTimeImports::FromSerialized(compile_imports_flags,
@@ -830,15 +846,50 @@ void NativeModuleDeserializer::ReadHeader(Reader* reader) {
 
   uint32_t imported = native_module_->module()->num_imported_functions;
   if (imported > 0) {
+    if (reader->current_size() < imported * sizeof(WellKnownImport)) {
+      return false;
+    }
     base::Vector<const WellKnownImport> well_known_imports =
         reader->ReadVector<WellKnownImport>(imported);
     native_module_->module()->type_feedback.well_known_imports.Initialize(
         well_known_imports);
   }
+  return true;
 }
 
+namespace {
+
+// Returns true if {reader} contains the complete code of the next function.
+// Takes {reader} by value, so that the caller's position doesn't change.
+bool HasCompleteCode(Reader reader) {
+  if (reader.current_size() < sizeof(uint8_t)) return false;
+  uint8_t code_kind = reader.Read<uint8_t>();
+  if (code_kind == kLazyFunction || code_kind == kEagerFunction) return true;
+  if (reader.current_size() < kCodeHeaderSize - sizeof(uint8_t)) return false;
+  // Skip the offsets, the unpadded binary size, the stack slot counts and the
+  // tagged parameter slots.
+  reader.Skip(7 * sizeof(int) + sizeof(uint32_t));
+  size_t data_size = 0;
+  // The sizes of the code, the reloc info, the source and inlining positions,
+  // the deopt data and the protected instructions.
+  for (int i = 0; i < 6; ++i) {
+    int size = reader.Read<int>();
+    if (size < 0) return false;
+    data_size += size;
+  }
+  reader.Skip(sizeof(WasmCode::Kind) + sizeof(ExecutionTier));
+  return reader.current_size() >= data_size;
+}
+
+}  // namespace
+
 DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
+  if (v8_flags.wasm_partial_deserialization && !HasCompleteCode(*reader)) {
+    truncated_ = true;
+    lazy_functions_.push_back(fn_index);
+    return {};
+  }
   uint8_t code_kind = reader->Read<uint8_t>();
   if (code_kind == kLazyFunction) {
     lazy_functions_.push_back(fn_index);
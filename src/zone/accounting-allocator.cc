@@ -6,9 +6,11 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -25,6 +27,33 @@ namespace {
 
 static constexpr size_t kZonePageSize = 256 * KB;
 
+static constexpr int kMinPooledSegmentSizeLog2 = 13;  // 8 KB
+static constexpr size_t kMinPooledSegmentSize = size_t{1}
+                                                << kMinPooledSegmentSizeLog2;
+static constexpr size_t kMaxPooledSegmentSize = 64 * KB;
+
+// Returns the smallest size class whose segments can hold {bytes}, or -1 if
+// segments of that size are not pooled.
+int SizeClassForAllocation(size_t bytes) {
+  if (bytes > kMaxPooledSegmentSize) return -1;
+  bytes = base::bits::RoundUpToPowerOfTwo(
+      std::max(bytes, kMinPooledSegmentSize));
+  return base::bits::WhichPowerOfTwo(bytes) - kMinPooledSegmentSizeLog2;
+}
+
+// Returns the largest size class whose allocations a segment of {bytes} can
+// serve, or -1 if the segment should not be pooled. The allocator may hand
+// out more memory than requested, so returned segments need not be exactly
+// as large as their size class.
+int SizeClassForSegment(size_t bytes) {
+  if (bytes < kMinPooledSegmentSize || bytes >= 2 * kMaxPooledSegmentSize) {
+    return -1;
+  }
+  int log2 = (kBitsPerByte * sizeof(size_t) - 1) -
+             base::bits::CountLeadingZeros(bytes);
+  return log2 - kMinPooledSegmentSizeLog2;
+}
+
 VirtualMemory ReserveAddressSpace(v8::PageAllocator* platform_allocator) {
   DCHECK(IsAligned(ZoneCompression::kReservationSize,
                    platform_allocator->AllocatePageSize()));
@@ -75,10 +104,23 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { TrimSegmentPool(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
+  if (!(COMPRESS_ZONES_BOOL && supports_compression)) {
+    if (Segment* segment = TryAllocateSegmentFromPool(bytes)) {
+      IncreaseMemoryUsage(segment->total_size());
+      return segment;
+    }
+    // Allocate the full size class, so that the segment can serve any
+    // allocation of its class once it is pooled.
+    int size_class = SizeClassForAllocation(bytes);
+    if (size_class >= 0 && v8_flags.zone_segment_pool_size > 0) {
+      bytes = kMinPooledSegmentSize << size_class;
+    }
+  }
+
   void* memory;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
@@ -92,6 +134,12 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
   }
   if (memory == nullptr) return nullptr;
 
+  IncreaseMemoryUsage(bytes);
+  DCHECK_LE(sizeof(Segment), bytes);
+  return new (memory) Segment(bytes);
+}
+
+void AccountingAllocator::IncreaseMemoryUsage(size_t bytes) {
   size_t current =
       current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
   size_t max = max_memory_usage_.load(std::memory_order_relaxed);
@@ -99,8 +147,6 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                               max, current, std::memory_order_relaxed)) {
     // {max} was updated by {compare_exchange_weak}; retry.
   }
-  DCHECK_LE(sizeof(Segment), bytes);
-  return new (memory) Segment(bytes);
 }
 
 void AccountingAllocator::ReturnSegment(Segment* segment,
@@ -108,6 +154,10 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
+  if (!(COMPRESS_ZONES_BOOL && supports_compression) &&
+      TryReturnSegmentToPool(segment)) {
+    return;
+  }
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
@@ -116,5 +166,64 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   }
 }
 
+Segment* AccountingAllocator::TryAllocateSegmentFromPool(size_t bytes) {
+  int size_class = SizeClassForAllocation(bytes);
+  if (size_class < 0) return nullptr;
+
+  Segment* segment;
+  {
+    base::MutexGuard guard(&segment_pool_mutex_);
+    segment = segment_pool_[size_class];
+    if (segment == nullptr) {
+      segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    segment_pool_[size_class] = segment->next();
+    pooled_memory_.store(
+        pooled_memory_.load(std::memory_order_relaxed) - segment->total_size(),
+        std::memory_order_relaxed);
+  }
+  segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+  DCHECK_GE(segment->total_size(), bytes);
+  return new (segment) Segment(segment->total_size());
+}
+
+bool AccountingAllocator::TryReturnSegmentToPool(Segment* segment) {
+  int size_class = SizeClassForSegment(segment->total_size());
+  if (size_class < 0) return false;
+
+  base::MutexGuard guard(&segment_pool_mutex_);
+  size_t pooled = pooled_memory_.load(std::memory_order_relaxed);
+  if (pooled + segment->total_size() > v8_flags.zone_segment_pool_size) {
+    return false;
+  }
+  pooled_memory_.store(pooled + segment->total_size(),
+                       std::memory_order_relaxed);
+  segment->set_zone(nullptr);
+  segment->set_next(segment_pool_[size_class]);
+  segment_pool_[size_class] = segment;
+  return true;
+}
+
+void AccountingAllocator::TrimSegmentPool() {
+  Segment* segments[kNumberOfSegmentSizeClasses];
+  {
+    base::MutexGuard guard(&segment_pool_mutex_);
+    for (int i = 0; i < kNumberOfSegmentSizeClasses; i++) {
+      segments[i] = segment_pool_[i];
+      segment_pool_[i] = nullptr;
+    }
+    pooled_memory_.store(0, std::memory_order_relaxed);
+  }
+  for (Segment* segment : segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      segment->ZapHeader();
+      free(segment);
+      segment = next;
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
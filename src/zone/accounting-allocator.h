@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -38,6 +39,9 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Releases all pooled segments, e.g. on memory pressure.
+  void TrimSegmentPool();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -46,6 +50,27 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Lowers the peak memory usage to the current usage, so that the peak of a
+  // subsequent phase can be measured on its own.
+  void ResetMaxMemoryUsage() {
+    max_memory_usage_.store(GetCurrentMemoryUsage(), std::memory_order_relaxed);
+  }
+
+  // The size of the segments in the pool, which is not included in the
+  // current memory usage.
+  size_t GetPooledMemory() const {
+    return pooled_memory_.load(std::memory_order_relaxed);
+  }
+
+  // The number of segment allocations that were served from the pool and
+  // that had to allocate a new segment, respectively.
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +92,25 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Pooled segments are kept in size classes of powers of two, from 8 KB to
+  // 64 KB. Larger segments and segments of compressed zones are never pooled.
+  static constexpr int kNumberOfSegmentSizeClasses = 4;
+
+  Segment* TryAllocateSegmentFromPool(size_t bytes);
+  bool TryReturnSegmentToPool(Segment* segment);
+  void IncreaseMemoryUsage(size_t bytes);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  // Guards the pool. {pooled_memory_} is only written while holding it.
+  base::Mutex segment_pool_mutex_;
+  // Singly linked lists of pooled segments, one for each size class.
+  Segment* segment_pool_[kNumberOfSegmentSizeClasses] = {};
+  std::atomic<size_t> pooled_memory_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 };
@@ -10,6 +10,9 @@
 int main(int argc, char** argv) {
   v8::V8::InitializeICUDefaultLocation(argv[0]);
   v8::V8::InitializeExternalStartupData(argv[0]);
+  // Consume V8 flags, e.g. --shared-string-table, before the benchmark
+  // library rejects them as unrecognized.
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
 
   v8::benchmarking::BenchmarkWithIsolate::InitializeProcess();
   // Contents of BENCHMARK_MAIN().
@@ -25,6 +25,7 @@ class BenchmarkWithIsolate : public benchmark::Fixture {
   static void ShutdownProcess();
 
  protected:
+  V8_INLINE v8::Platform* platform() { return platform_; }
   V8_INLINE v8::Isolate* v8_isolate() { return v8_isolate_; }
   V8_INLINE cppgc::AllocationHandle& allocation_handle() {
     return v8_isolate_->GetCppHeap()->GetAllocationHandle();
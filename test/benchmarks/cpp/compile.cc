@@ -0,0 +1,437 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the compile throughput of each tier on a fixed corpus. The corpus
+// is read from the files listed, separated by ':', in the
+// V8_COMPILE_BENCHMARK_CORPUS environment variable; files ending in ".wasm"
+// are compiled as WebAssembly modules and all others as classic scripts.
+// Without it, a generated script and module are used. Benchmarks are
+// registered per corpus entry and labeled with its file name, and report
+// source bytes per second and the peak zone memory of a compilation.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/api/api-inl.h"
+#include "src/base/macros.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/codegen/compiler.h"
+#include "src/execution/isolate-inl.h"
+#include "src/flags/flags.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/zone/accounting-allocator.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+#if V8_ENABLE_WEBASSEMBLY
+#include "include/v8-wasm.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module.h"
+#include "src/wasm/wasm-objects-inl.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+namespace {
+
+namespace i = v8::internal;
+
+struct CorpusEntry {
+  std::string name;
+  std::string bytes;
+};
+
+struct Corpus {
+  std::vector<CorpusEntry> scripts;
+  std::vector<CorpusEntry> wasm_modules;
+};
+
+// A script with many small functions in the style of application code.
+std::string GenerateScript() {
+  std::ostringstream out;
+  for (int j = 0; j < 500; j++) {
+    out << "function f" << j << "(items, scale) {\n"
+        << "  let total = 0;\n"
+        << "  for (let k = 0; k < items.length; k++) {\n"
+        << "    const item = items[k];\n"
+        << "    if (item.enabled && item.value > " << j << ") {\n"
+        << "      total += item.value * scale;\n"
+        << "    } else {\n"
+        << "      total -= (item.weight | 0);\n"
+        << "    }\n"
+        << "  }\n"
+        << "  return {id: 'f" << j << "', total, avg: total / items.length};\n"
+        << "}\n"
+        << "class C" << j << " {\n"
+        << "  constructor(x) { this.x = x; this.cache = new Map(); }\n"
+        << "  get(key) {\n"
+        << "    if (!this.cache.has(key)) this.cache.set(key, f" << j
+        << "(this.x, key));\n"
+        << "    return this.cache.get(key);\n"
+        << "  }\n"
+        << "}\n";
+  }
+  return out.str();
+}
+
+#if V8_ENABLE_WEBASSEMBLY
+void WriteU32V(std::string& out, uint32_t value) {
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0) byte |= 0x80;
+    out.push_back(static_cast<char>(byte));
+  } while (value != 0);
+}
+
+void WriteSection(std::string& out, uint8_t id, const std::string& payload) {
+  out.push_back(static_cast<char>(id));
+  WriteU32V(out, static_cast<uint32_t>(payload.size()));
+  out += payload;
+}
+
+// A module with many functions of type (i32, i32) -> i32, each running a loop
+// of integer arithmetic.
+std::string GenerateWasmModule() {
+  constexpr uint32_t kFunctionCount = 500;
+  std::string module("\0asm\x01\0\0\0", 8);
+
+  std::string types;
+  WriteU32V(types, 1);
+  types += "\x60\x02\x7f\x7f\x01\x7f";
+  WriteSection(module, 1, types);
+
+  std::string functions;
+  WriteU32V(functions, kFunctionCount);
+  for (uint32_t j = 0; j < kFunctionCount; j++) functions.push_back(0);
+  WriteSection(module, 3, functions);
+
+  // local.get 0, local.get 1, i32.mul, local.get 0, i32.add, local.set 0,
+  // repeated in a loop that counts local 1 down to zero.
+  const std::string kStep("\x20\x00\x20\x01\x6c\x20\x00\x6a\x21\x00", 10);
+  std::string body;
+  WriteU32V(body, 0);  // No locals.
+  body += "\x03\x40";  // loop
+  for (int j = 0; j < 20; j++) body += kStep;
+  body += std::string("\x20\x01\x41\x01\x6b\x22\x01\x0d\x00", 9);  // br_if
+  body += "\x0b";  // end loop
+  body += std::string("\x20\x00\x0b", 3);
+  std::string code;
+  WriteU32V(code, kFunctionCount);
+  for (uint32_t j = 0; j < kFunctionCount; j++) {
+    WriteU32V(code, static_cast<uint32_t>(body.size()));
+    code += body;
+  }
+  WriteSection(module, 10, code);
+  return module;
+}
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+const Corpus& GetCorpus() {
+  static const Corpus* corpus = [] {
+    Corpus* corpus = new Corpus();
+    const char* files = std::getenv("V8_COMPILE_BENCHMARK_CORPUS");
+    if (files == nullptr || *files == '\0') {
+      corpus->scripts.push_back({"generated.js", GenerateScript()});
+#if V8_ENABLE_WEBASSEMBLY
+      corpus->wasm_modules.push_back({"generated.wasm", GenerateWasmModule()});
+#endif  // V8_ENABLE_WEBASSEMBLY
+      return corpus;
+    }
+    std::istringstream paths(files);
+    std::string path;
+    while (std::getline(paths, path, ':')) {
+      if (path.empty()) continue;
+      std::ifstream file(path, std::ios::binary);
+      CHECK_WITH_MSG(file.good(), "cannot read corpus file");
+      CorpusEntry entry{path, std::string(std::istreambuf_iterator<char>(file),
+                                          std::istreambuf_iterator<char>())};
+      const std::string kWasmSuffix = ".wasm";
+      bool is_wasm = path.size() >= kWasmSuffix.size() &&
+                     path.compare(path.size() - kWasmSuffix.size(),
+                                  kWasmSuffix.size(), kWasmSuffix) == 0;
+      (is_wasm ? corpus->wasm_modules : corpus->scripts)
+          .push_back(std::move(entry));
+    }
+    return corpus;
+  }();
+  return *corpus;
+}
+
+void ForEachScript(benchmark::internal::Benchmark* benchmark) {
+  for (size_t j = 0; j < GetCorpus().scripts.size(); j++) {
+    benchmark->Arg(static_cast<int64_t>(j));
+  }
+}
+
+void ForEachWasmModule(benchmark::internal::Benchmark* benchmark) {
+  for (size_t j = 0; j < GetCorpus().wasm_modules.size(); j++) {
+    benchmark->Arg(static_cast<int64_t>(j));
+  }
+}
+
+// Tracks the peak zone memory of the compilations of a benchmark.
+class PeakZoneMemoryScope {
+ public:
+  explicit PeakZoneMemoryScope(i::AccountingAllocator* allocator)
+      : allocator_(allocator) {}
+
+  void Start() {
+    allocator_->ResetMaxMemoryUsage();
+    baseline_ = allocator_->GetCurrentMemoryUsage();
+  }
+
+  void Stop() {
+    peak_ = std::max(peak_, allocator_->GetMaxMemoryUsage() - baseline_);
+  }
+
+  void Report(benchmark::State& state) {
+    state.counters["peak_zone_bytes"] = static_cast<double>(peak_);
+  }
+
+ private:
+  i::AccountingAllocator* const allocator_;
+  size_t baseline_ = 0;
+  size_t peak_ = 0;
+};
+
+class CompileBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context_.Reset(v8_isolate(), context);
+    context->Enter();
+    // Every iteration has to compile from scratch.
+    i_isolate()->compilation_cache()->DisableScriptAndEval();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    i_isolate()->compilation_cache()->EnableScriptAndEval();
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+
+  const CorpusEntry& Script(benchmark::State& state) {
+    const CorpusEntry& entry = GetCorpus().scripts[state.range(0)];
+    state.SetLabel(entry.name);
+    return entry;
+  }
+
+  i::Handle<i::Script> CompileScript(const CorpusEntry& entry,
+                                     v8::ScriptCompiler::CompileOptions
+                                         options) {
+    v8::ScriptCompiler::Source source(
+        v8::String::NewFromUtf8(v8_isolate(), entry.bytes.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(entry.bytes.size()))
+            .ToLocalChecked());
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(v8_isolate(), &source,
+                                                 options)
+            .ToLocalChecked();
+    return i::handle(
+        i::Cast<i::Script>(
+            i::Cast<i::SharedFunctionInfo>(*v8::Utils::OpenHandle(*script))
+                ->script()),
+        i_isolate());
+  }
+
+  // Compiles |entry| eagerly, and returns the shared function infos of all of
+  // its functions, which then all have bytecode.
+  std::vector<i::Handle<i::SharedFunctionInfo>> CompileFunctions(
+      const CorpusEntry& entry) {
+    i::Handle<i::Script> script =
+        CompileScript(entry, v8::ScriptCompiler::kEagerCompile);
+    std::vector<i::Handle<i::SharedFunctionInfo>> functions;
+    i::SharedFunctionInfo::ScriptIterator iterator(i_isolate(), *script);
+    for (i::Tagged<i::SharedFunctionInfo> info = iterator.Next();
+         !info.is_null(); info = iterator.Next()) {
+      if (info->is_toplevel() || !info->is_compiled()) continue;
+      functions.push_back(i::handle(info, i_isolate()));
+    }
+    return functions;
+  }
+
+  // Creates closures with feedback vectors for all functions of |entry|, for
+  // the optimizing tiers. The feedback vectors are empty, so the optimizing
+  // tiers see code that has never run.
+  std::vector<i::Handle<i::JSFunction>> CreateClosures(
+      const CorpusEntry& entry) {
+    std::vector<i::Handle<i::JSFunction>> closures;
+    for (i::Handle<i::SharedFunctionInfo> shared : CompileFunctions(entry)) {
+      i::Handle<i::JSFunction> function =
+          i::Factory::JSFunctionBuilder{i_isolate(), shared,
+                                        i_isolate()->native_context()}
+              .Build();
+      i::IsCompiledScope is_compiled_scope(
+          shared->is_compiled_scope(i_isolate()));
+      i::JSFunction::EnsureFeedbackVector(i_isolate(), function,
+                                          &is_compiled_scope);
+      closures.push_back(function);
+    }
+    return closures;
+  }
+
+  void BenchmarkScriptCompile(benchmark::State& state,
+                              v8::ScriptCompiler::CompileOptions options) {
+    const CorpusEntry& entry = Script(state);
+    PeakZoneMemoryScope zone_memory(i_isolate()->allocator());
+    for (auto _ : state) {
+      USE(_);
+      i::HandleScope scope(i_isolate());
+      zone_memory.Start();
+      benchmark::DoNotOptimize(CompileScript(entry, options));
+      zone_memory.Stop();
+    }
+    state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+    zone_memory.Report(state);
+  }
+
+  void BenchmarkOptimizingTier(benchmark::State& state, i::CodeKind kind) {
+    const CorpusEntry& entry = Script(state);
+    PeakZoneMemoryScope zone_memory(i_isolate()->allocator());
+    for (auto _ : state) {
+      USE(_);
+      state.PauseTiming();
+      i::HandleScope scope(i_isolate());
+      std::vector<i::Handle<i::JSFunction>> closures = CreateClosures(entry);
+      zone_memory.Start();
+      state.ResumeTiming();
+      for (i::Handle<i::JSFunction> function : closures) {
+        i::Compiler::CompileOptimized(i_isolate(), function,
+                                      i::ConcurrencyMode::kSynchronous, kind);
+      }
+      zone_memory.Stop();
+    }
+    state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+    zone_memory.Report(state);
+  }
+
+#if V8_ENABLE_WEBASSEMBLY
+  void BenchmarkWasmTier(benchmark::State& state, i::wasm::ExecutionTier tier) {
+    const CorpusEntry& entry = GetCorpus().wasm_modules[state.range(0)];
+    state.SetLabel(entry.name);
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::WasmModuleObject> module =
+        v8::WasmModuleObject::Compile(
+            v8_isolate(),
+            {reinterpret_cast<const uint8_t*>(entry.bytes.data()),
+             entry.bytes.size()})
+            .ToLocalChecked();
+    i::wasm::NativeModule* native_module =
+        i::Cast<i::WasmModuleObject>(*v8::Utils::OpenHandle(*module))
+            ->native_module();
+    const i::wasm::WasmModule* wasm_module = native_module->module();
+    PeakZoneMemoryScope zone_memory(i::wasm::GetWasmEngine()->allocator());
+    for (auto _ : state) {
+      USE(_);
+      zone_memory.Start();
+      for (uint32_t index = wasm_module->num_imported_functions;
+           index < wasm_module->functions.size(); index++) {
+        i::wasm::GetWasmEngine()->CompileFunction(
+            i_isolate()->counters(), native_module, index, tier);
+      }
+      zone_memory.Stop();
+    }
+    state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+    zone_memory.Report(state);
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace
+
+// Parses the top-level code and pre-parses all functions, and compiles the
+// top-level code to bytecode.
+BENCHMARK_DEFINE_F(CompileBenchmark, Parse)(benchmark::State& state) {
+  BenchmarkScriptCompile(state, v8::ScriptCompiler::kNoCompileOptions);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, Parse)->Apply(ForEachScript);
+
+// Parses and compiles all functions to bytecode.
+BENCHMARK_DEFINE_F(CompileBenchmark, Ignition)(benchmark::State& state) {
+  BenchmarkScriptCompile(state, v8::ScriptCompiler::kEagerCompile);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, Ignition)->Apply(ForEachScript);
+
+BENCHMARK_DEFINE_F(CompileBenchmark, Sparkplug)(benchmark::State& state) {
+  if (!i::v8_flags.sparkplug) {
+    state.SkipWithError("Sparkplug is disabled");
+    return;
+  }
+  const CorpusEntry& entry = Script(state);
+  PeakZoneMemoryScope zone_memory(i_isolate()->allocator());
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    i::HandleScope scope(i_isolate());
+    std::vector<i::Handle<i::SharedFunctionInfo>> functions =
+        CompileFunctions(entry);
+    zone_memory.Start();
+    state.ResumeTiming();
+    for (i::Handle<i::SharedFunctionInfo> shared : functions) {
+      i::IsCompiledScope is_compiled_scope(
+          shared->is_compiled_scope(i_isolate()));
+      i::Compiler::CompileSharedWithBaseline(i_isolate(), shared,
+                                             i::Compiler::CLEAR_EXCEPTION,
+                                             &is_compiled_scope);
+    }
+    zone_memory.Stop();
+  }
+  state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+  zone_memory.Report(state);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, Sparkplug)->Apply(ForEachScript);
+
+BENCHMARK_DEFINE_F(CompileBenchmark, Maglev)(benchmark::State& state) {
+  if (!i::v8_flags.maglev) {
+    state.SkipWithError("Maglev is disabled");
+    return;
+  }
+  BenchmarkOptimizingTier(state, i::CodeKind::MAGLEV);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, Maglev)->Apply(ForEachScript);
+
+BENCHMARK_DEFINE_F(CompileBenchmark, TurboFan)(benchmark::State& state) {
+  if (!i::v8_flags.turbofan) {
+    state.SkipWithError("TurboFan is disabled");
+    return;
+  }
+  BenchmarkOptimizingTier(state, i::CodeKind::TURBOFAN_JS);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, TurboFan)->Apply(ForEachScript);
+
+#if V8_ENABLE_WEBASSEMBLY
+BENCHMARK_DEFINE_F(CompileBenchmark, Liftoff)(benchmark::State& state) {
+  BenchmarkWasmTier(state, i::wasm::ExecutionTier::kLiftoff);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, Liftoff)->Apply(ForEachWasmModule);
+
+BENCHMARK_DEFINE_F(CompileBenchmark, WasmTurbofan)(benchmark::State& state) {
+  BenchmarkWasmTier(state, i::wasm::ExecutionTier::kTurbofan);
+}
+BENCHMARK_REGISTER_F(CompileBenchmark, WasmTurbofan)
+    ->Apply(ForEachWasmModule);
+#endif  // V8_ENABLE_WEBASSEMBLY
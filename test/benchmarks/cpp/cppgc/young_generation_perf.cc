@@ -0,0 +1,137 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if defined(CPPGC_YOUNG_GENERATION)
+
+#include <array>
+#include <memory>
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "include/cppgc/visitor.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/metric-recorder.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using YoungGeneration = testing::BenchmarkWithHeap;
+
+// Number of short-lived objects allocated per iteration.
+constexpr size_t kObjectsPerIteration = 4096;
+// Every kRetainEvery-th object is kept alive by an old holder object, which
+// adds it to the old-to-new remembered set.
+constexpr size_t kRetainEvery = 64;
+
+class Wrapper final : public GarbageCollected<Wrapper> {
+ public:
+  void Trace(Visitor*) const {}
+
+ private:
+  char payload_[32];
+};
+
+class Holder final : public GarbageCollected<Holder> {
+ public:
+  static constexpr size_t kSlots = kObjectsPerIteration / kRetainEvery;
+
+  void Trace(Visitor* visitor) const {
+    for (const auto& slot : slots_) visitor->Trace(slot);
+  }
+
+  void Set(size_t index, Wrapper* wrapper) { slots_[index] = wrapper; }
+
+ private:
+  std::array<Member<Wrapper>, kSlots> slots_;
+};
+
+class CountingMetricRecorder final : public MetricRecorder {
+ public:
+  struct Counts {
+    size_t major_gcs = 0;
+    size_t minor_gcs = 0;
+    int64_t remembered_slots = 0;
+  };
+
+  explicit CountingMetricRecorder(Counts& counts) : counts_(counts) {}
+
+  void AddMainThreadEvent(const GCCycle& event) final {
+    if (event.type == GCCycle::Type::kMinor) {
+      counts_.minor_gcs++;
+      counts_.remembered_slots += event.remembered_set.slots;
+    } else {
+      counts_.major_gcs++;
+    }
+  }
+
+ private:
+  Counts& counts_;
+};
+
+void AllocateShortLivedWrappers(cppgc::Heap& heap, Holder* holder) {
+  for (size_t i = 0; i < kObjectsPerIteration; ++i) {
+    Wrapper* wrapper =
+        MakeGarbageCollected<Wrapper>(heap.GetAllocationHandle());
+    if (i % kRetainEvery == 0) holder->Set(i / kRetainEvery, wrapper);
+    benchmark::DoNotOptimize(wrapper);
+  }
+}
+
+void ReportCounts(benchmark::State& st,
+                  const CountingMetricRecorder::Counts& counts) {
+  st.counters["major_gcs"] = static_cast<double>(counts.major_gcs);
+  st.counters["minor_gcs"] = static_cast<double>(counts.minor_gcs);
+  st.counters["remembered_slots_per_minor_gc"] =
+      counts.minor_gcs
+          ? static_cast<double>(counts.remembered_slots) / counts.minor_gcs
+          : 0;
+  st.SetItemsProcessed(st.iterations() * kObjectsPerIteration);
+}
+
+BENCHMARK_F(YoungGeneration, MinorGCs)(benchmark::State& st) {
+  Heap& heap_impl = *Heap::From(&heap());
+  heap_impl.EnableGenerationalGC();
+  // Promote the holder so that stores into it go through the remembered set.
+  Persistent<Holder> holder =
+      MakeGarbageCollected<Holder>(heap().GetAllocationHandle());
+  heap_impl.CollectGarbage(GCConfig::PreciseAtomicConfig());
+
+  CountingMetricRecorder::Counts counts;
+  heap_impl.SetMetricRecorder(std::make_unique<CountingMetricRecorder>(counts));
+  for (auto _ : st) {
+    USE(_);
+    AllocateShortLivedWrappers(heap(), holder.Get());
+    heap_impl.CollectGarbage(GCConfig::MinorPreciseAtomicConfig());
+  }
+  heap_impl.SetMetricRecorder(nullptr);
+  ReportCounts(st, counts);
+}
+
+BENCHMARK_F(YoungGeneration, MajorGCsOnly)(benchmark::State& st) {
+  Heap& heap_impl = *Heap::From(&heap());
+  Persistent<Holder> holder =
+      MakeGarbageCollected<Holder>(heap().GetAllocationHandle());
+
+  CountingMetricRecorder::Counts counts;
+  heap_impl.SetMetricRecorder(std::make_unique<CountingMetricRecorder>(counts));
+  for (auto _ : st) {
+    USE(_);
+    AllocateShortLivedWrappers(heap(), holder.Get());
+    heap_impl.CollectGarbage(GCConfig::PreciseAtomicConfig());
+  }
+  heap_impl.SetMetricRecorder(nullptr);
+  ReportCounts(st, counts);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // defined(CPPGC_YOUNG_GENERATION)
@@ -3,13 +3,19 @@
 // found in the LICENSE file.
 
 #include "src/base/macros.h"
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/dtoa.h"
 #include "src/base/numbers/fast-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
 #include "src/base/vector.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
+using v8::base::BIGNUM_DTOA_SHORTEST;
+using v8::base::DTOA_PRECISION;
 using v8::base::FAST_DTOA_PRECISION;
 using v8::base::FAST_DTOA_SHORTEST;
 using v8::base::kFastDtoaMaximalLength;
+using v8::base::kSchubfachDtoaMaximalLength;
 using v8::base::Vector;
 
 // This is a dump from a benchmark (MotionMark suits).
@@ -1065,5 +1071,46 @@ static void BM_DtoaSixDigits(benchmark::State& state) {
   }
 }
 
+// FastDtoa with the BignumDtoa fallback, which is what DoubleToAscii used to do
+// for the shortest representation.
+static void BM_DtoaShortestWithFallback(benchmark::State& state) {
+  char output[kFastDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    double v = kTestDoubles[idx++ % 4096];
+    if (!FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, &length, &decimal_point)) {
+      BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, buffer, &length, &decimal_point);
+    }
+  }
+}
+
+static void BM_SchubfachDtoaShortest(benchmark::State& state) {
+  char output[kSchubfachDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    SchubfachDtoa(kTestDoubles[idx++ % 4096], buffer, &length, &decimal_point);
+  }
+}
+
+// DoubleToAscii falls back to the shortest representation before BignumDtoa
+// when FastDtoa fails in precision mode.
+static void BM_DoubleToAsciiSixDigits(benchmark::State& state) {
+  char output[kFastDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int sign, length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    DoubleToAscii(kTestDoubles[idx++ % 4096], DTOA_PRECISION, 6, buffer, &sign,
+                  &length, &decimal_point);
+  }
+}
+
 BENCHMARK(BM_DtoaShortest);
 BENCHMARK(BM_DtoaSixDigits);
+BENCHMARK(BM_DtoaShortestWithFallback);
+BENCHMARK(BM_SchubfachDtoaShortest);
+BENCHMARK(BM_DoubleToAsciiSixDigits);
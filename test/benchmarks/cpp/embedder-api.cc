@@ -0,0 +1,275 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-fast-api-calls.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-template.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+v8::Local<v8::String> v8_str(v8::Isolate* isolate, const char* x) {
+  return v8::String::NewFromUtf8(isolate, x).ToLocalChecked();
+}
+
+// Number of calls that a script makes per benchmark iteration to amortize the
+// cost of entering JavaScript.
+constexpr int kCallsPerScriptRun = 1000;
+
+int32_t FastAdd(v8::Local<v8::Object> receiver, int32_t a, int32_t b) {
+  return a + b;
+}
+
+void SlowAdd(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+  int32_t a = info[0]->Int32Value(context).FromJust();
+  int32_t b = info[1]->Int32Value(context).FromJust();
+  info.GetReturnValue().Set(a + b);
+}
+
+// Measures the cost of common embedder API operations, each on a fresh
+// context of the shared isolate.
+class EmbedderApiBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context_.Reset(v8_isolate(), context);
+    context->Enter();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  v8::Local<v8::Value> RunScript(const char* source) {
+    v8::EscapableHandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        v8::Script::Compile(v8_context(), v8_str(v8_isolate(), source))
+            .ToLocalChecked()
+            ->Run(v8_context())
+            .ToLocalChecked();
+    return handle_scope.Escape(result);
+  }
+
+  // Installs |name| on the global object as a function that adds its two
+  // arguments, optionally with a fast API implementation.
+  void InstallAddFunction(const char* name, const v8::CFunction* c_function) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::FunctionTemplate> function_template =
+        v8::FunctionTemplate::New(
+            v8_isolate(), SlowAdd, v8::Local<v8::Value>(),
+            v8::Local<v8::Signature>(), 2, v8::ConstructorBehavior::kThrow,
+            v8::SideEffectType::kHasNoSideEffect, c_function);
+    v8_context()
+        ->Global()
+        ->Set(v8_context(), v8_str(v8_isolate(), name),
+              function_template->GetFunction(v8_context()).ToLocalChecked())
+        .Check();
+  }
+
+  // Runs a loop calling |name| from JavaScript. The loop is optimized by
+  // TurboFan after a few iterations, which enables fast API calls.
+  void BenchmarkCallsFromJS(benchmark::State& state, const char* name) {
+    v8::HandleScope handle_scope(v8_isolate());
+    std::string source = std::string("(function() { let sum = 0; ") +
+                         "for (let i = 0; i < " +
+                         std::to_string(kCallsPerScriptRun) + "; i++) " +
+                         "sum = " + name + "(sum, i) | 0; return sum; })";
+    v8::Local<v8::Function> loop =
+        RunScript(source.c_str()).As<v8::Function>();
+    for (auto _ : state) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      benchmark::DoNotOptimize(
+          loop->Call(v8_context(), v8_context()->Global(), 0, nullptr)
+              .ToLocalChecked());
+    }
+    state.SetItemsProcessed(state.iterations() * kCallsPerScriptRun);
+  }
+
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace
+
+BENCHMARK_F(EmbedderApiBenchmark, FunctionCall)(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Function> function =
+      RunScript("(function(a, b) { return a + b; })").As<v8::Function>();
+  v8::Local<v8::Value> args[] = {v8::Integer::New(v8_isolate(), 1),
+                                 v8::Integer::New(v8_isolate(), 2)};
+  v8::Local<v8::Value> receiver = v8::Undefined(v8_isolate());
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        function->Call(v8_context(), receiver, 2, args).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, ObjectGet)(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Object> object =
+      RunScript("({x: 1, y: 2, z: 3})").As<v8::Object>();
+  v8::Local<v8::String> key = v8_str(v8_isolate(), "y");
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(object->Get(v8_context(), key).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, ObjectSet)(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Object> object =
+      RunScript("({x: 1, y: 2, z: 3})").As<v8::Object>();
+  v8::Local<v8::String> key = v8_str(v8_isolate(), "y");
+  v8::Local<v8::Value> value = v8::Integer::New(v8_isolate(), 42);
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(object->Set(v8_context(), key, value).FromJust());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, ObjectTemplateNewInstance)
+(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::ObjectTemplate> object_template =
+      v8::ObjectTemplate::New(v8_isolate());
+  object_template->Set(v8_isolate(), "x", v8::Integer::New(v8_isolate(), 1));
+  object_template->Set(v8_isolate(), "y", v8::Integer::New(v8_isolate(), 2));
+  object_template->SetInternalFieldCount(1);
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        object_template->NewInstance(v8_context()).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, FunctionTemplateNewInstance)
+(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::FunctionTemplate> function_template =
+      v8::FunctionTemplate::New(v8_isolate());
+  function_template->InstanceTemplate()->SetInternalFieldCount(1);
+  function_template->PrototypeTemplate()->Set(
+      v8_isolate(), "method", v8::FunctionTemplate::New(v8_isolate()));
+  v8::Local<v8::Function> function =
+      function_template->GetFunction(v8_context()).ToLocalChecked();
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        function->NewInstance(v8_context()).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, StringNewFromUtf8OneByte)
+(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  static constexpr char kString[] = "The quick brown fox jumps over the dog";
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::String::NewFromUtf8(v8_isolate(), kString).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, StringNewFromUtf8TwoByte)
+(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  static constexpr char kString[] =
+      "Der schnelle braune Fuchs springt \xC3\xBC"
+      "ber den faulen Hund \xE2\x80\x94 \xE6\x97\xA5\xE6\x9C\xAC";
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        v8::String::NewFromUtf8(v8_isolate(), kString).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, StringWriteUtf8)(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::String> string =
+      RunScript("'The quick brown fox jumps over the lazy dog. '.repeat(16)")
+          .As<v8::String>();
+  std::unique_ptr<char[]> buffer(
+      new char[string->Utf8Length(v8_isolate()) + 1]);
+  for (auto _ : state) {
+    USE(_);
+    benchmark::DoNotOptimize(string->WriteUtf8(v8_isolate(), buffer.get()));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          string->Utf8Length(v8_isolate()));
+}
+
+BENCHMARK_DEFINE_F(EmbedderApiBenchmark, ArrayBufferNew)
+(benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  const size_t byte_length = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(v8::ArrayBuffer::New(v8_isolate(), byte_length));
+  }
+}
+BENCHMARK_REGISTER_F(EmbedderApiBenchmark, ArrayBufferNew)
+    ->Arg(16)
+    ->Arg(4 * 1024)
+    ->Arg(1024 * 1024);
+
+BENCHMARK_F(EmbedderApiBenchmark, ContextNew)(benchmark::State& state) {
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(v8::Context::New(v8_isolate()));
+  }
+}
+
+// Creates and disposes an isolate, which is deserialized from the startup
+// snapshot.
+BENCHMARK_F(EmbedderApiBenchmark, IsolateNew)(benchmark::State& state) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  for (auto _ : state) {
+    USE(_);
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    isolate->Dispose();
+  }
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, SlowApiCall)(benchmark::State& state) {
+  InstallAddFunction("add", nullptr);
+  BenchmarkCallsFromJS(state, "add");
+}
+
+BENCHMARK_F(EmbedderApiBenchmark, FastApiCall)(benchmark::State& state) {
+  static const v8::CFunction kFastAdd = v8::CFunction::Make(FastAdd);
+  InstallAddFunction("add", &kFastAdd);
+  BenchmarkCallsFromJS(state, "add");
+}
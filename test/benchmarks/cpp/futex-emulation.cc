@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-typed-array.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kMaxThreads = 64;
+constexpr int kRoundTripsPerIteration = 64;
+
+// Each pair of threads hands a token back and forth through its own element of
+// a shared Int32Array, so that all threads wait and notify concurrently, but on
+// distinct addresses.
+constexpr char kPingPongSource[] = R"(
+    (function(tokens, index, me, round_trips) {
+      for (let i = 0; i < round_trips; i++) {
+        while (Atomics.load(tokens, index) !== me) {
+          Atomics.wait(tokens, index, 1 - me);
+        }
+        Atomics.store(tokens, index, 1 - me);
+        Atomics.notify(tokens, index, 1);
+      }
+    }))";
+
+std::shared_ptr<v8::BackingStore> TokenStore() {
+  // The tokens are shared by the isolates of all benchmark threads and outlive
+  // them.
+  static int32_t tokens[kMaxThreads / 2];
+  static std::shared_ptr<v8::BackingStore> store =
+      v8::SharedArrayBuffer::NewBackingStore(
+          tokens, sizeof(tokens), v8::BackingStore::EmptyDeleter, nullptr);
+  return store;
+}
+
+}  // namespace
+
+// Runs pairs of isolates on the benchmark threads, which ping-pong a token
+// using Atomics.wait and Atomics.notify.
+static void BM_WaitNotifyPairs(benchmark::State& state) {
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::SharedArrayBuffer> buffer =
+        v8::SharedArrayBuffer::New(isolate, TokenStore());
+    v8::Local<v8::Function> ping_pong =
+        v8::Script::Compile(
+            context, v8::String::NewFromUtf8Literal(isolate, kPingPongSource))
+            .ToLocalChecked()
+            ->Run(context)
+            .ToLocalChecked()
+            .As<v8::Function>();
+    v8::Local<v8::Value> args[] = {
+        v8::Int32Array::New(buffer, 0, kMaxThreads / 2),
+        v8::Integer::New(isolate, state.thread_index() / 2),
+        v8::Integer::New(isolate, state.thread_index() % 2),
+        v8::Integer::New(isolate, kRoundTripsPerIteration)};
+
+    for (auto _ : state) {
+      v8::HandleScope iteration_scope(isolate);
+      ping_pong->Call(context, context->Global(), arraysize(args), args)
+          .ToLocalChecked();
+    }
+  }
+  isolate->Dispose();
+  state.SetItemsProcessed(state.iterations() * kRoundTripsPerIteration);
+}
+
+// Every thread needs a partner, so the thread counts are even.
+BENCHMARK(BM_WaitNotifyPairs)->ThreadRange(2, kMaxThreads)->UseRealTime();
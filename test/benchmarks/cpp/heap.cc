@@ -0,0 +1,291 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-context.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "src/base/macros.h"
+#include "src/execution/isolate-inl.h"
+#include "src/handles/global-handles.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/js-objects-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+// Small enough that a batch of young objects fits into the new space without
+// triggering a scavenge on its own.
+constexpr int kYoungObjectsPerIteration = 4096;
+constexpr int kYoungArrayLength = 8;
+
+// Sets up a context and provides access to the internal heap. The isolate is
+// shared by all benchmarks of the process, so each benchmark starts from a
+// full, atomic GC to not inherit garbage from the previous one.
+class HeapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context_.Reset(v8_isolate(), context);
+    context->Enter();
+    InvokeAtomicMajorGC();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    if (!graph_.is_null()) {
+      i::GlobalHandles::Destroy(graph_.location());
+      graph_ = i::Handle<i::FixedArray>();
+    }
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+    InvokeAtomicMajorGC();
+  }
+
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+  i::Heap* heap() { return i_isolate()->heap(); }
+  i::Factory* factory() { return i_isolate()->factory(); }
+
+  void InvokeMinorGC() {
+    heap()->CollectGarbage(i::NEW_SPACE, i::GarbageCollectionReason::kTesting);
+  }
+
+  void InvokeMajorGC() {
+    heap()->CollectGarbage(i::OLD_SPACE, i::GarbageCollectionReason::kTesting);
+  }
+
+  void CompleteSweeping() {
+    if (heap()->sweeping_in_progress()) {
+      heap()->EnsureSweepingCompleted(
+          i::Heap::SweepingForcedFinalizationMode::kV8Only);
+    }
+  }
+
+  void InvokeAtomicMajorGC() {
+    heap()->PreciseCollectAllGarbage(i::GCFlag::kNoFlags,
+                                     i::GarbageCollectionReason::kTesting);
+    CompleteSweeping();
+  }
+
+  // Allocates |kYoungObjectsPerIteration| young arrays, of which
+  // |survival_percent| are stored in the returned holder and the rest become
+  // garbage right away.
+  i::Handle<i::FixedArray> AllocateYoungObjects(int survival_percent) {
+    i::Handle<i::FixedArray> holder =
+        factory()->NewFixedArray(kYoungObjectsPerIteration);
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      i::Handle<i::FixedArray> object =
+          factory()->NewFixedArray(kYoungArrayLength);
+      if (j % 100 < survival_percent) holder->set(j, *object);
+    }
+    return holder;
+  }
+
+  // Builds a complete binary tree of |node_count| arrays in the old
+  // generation, which stays alive until TearDown().
+  void BuildOldGraph(int node_count) {
+    i::HandleScope scope(i_isolate());
+    i::Handle<i::FixedArray> nodes =
+        factory()->NewFixedArray(node_count, i::AllocationType::kOld);
+    for (int j = 0; j < node_count; j++) {
+      nodes->set(j, *factory()->NewFixedArray(2, i::AllocationType::kOld));
+    }
+    for (int j = 0; 2 * j + 1 < node_count; j++) {
+      i::Tagged<i::FixedArray> node = i::Cast<i::FixedArray>(nodes->get(j));
+      node->set(0, nodes->get(2 * j + 1));
+      if (2 * j + 2 < node_count) node->set(1, nodes->get(2 * j + 2));
+    }
+    graph_ = i_isolate()->global_handles()->Create(
+        i::Cast<i::FixedArray>(nodes->get(0)));
+  }
+
+  v8::Global<v8::Context> context_;
+  i::Handle<i::FixedArray> graph_;
+};
+
+}  // namespace
+
+// Scavenges a new space in which the given percentage of objects survives.
+BENCHMARK_DEFINE_F(HeapBenchmark, ScavengeSurvival)(benchmark::State& state) {
+  const int survival_percent = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    i::HandleScope scope(i_isolate());
+    i::Handle<i::FixedArray> holder = AllocateYoungObjects(survival_percent);
+    state.ResumeTiming();
+    InvokeMinorGC();
+    benchmark::DoNotOptimize(holder);
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, ScavengeSurvival)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100);
+
+// Full GCs on a large, live object graph, where marking dominates.
+BENCHMARK_DEFINE_F(HeapBenchmark, MarkLiveGraph)(benchmark::State& state) {
+  const int node_count = static_cast<int>(state.range(0));
+  BuildOldGraph(node_count);
+  InvokeAtomicMajorGC();
+  for (auto _ : state) {
+    USE(_);
+    InvokeMajorGC();
+    state.PauseTiming();
+    CompleteSweeping();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * node_count);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, MarkLiveGraph)
+    ->Arg(10 * 1000)
+    ->Arg(100 * 1000)
+    ->Arg(1000 * 1000)
+    ->Unit(benchmark::kMillisecond);
+
+// Full GCs on an old generation that is entirely garbage, where sweeping
+// dominates. Sweeping is finished on the main thread to include it in the
+// measurement.
+BENCHMARK_DEFINE_F(HeapBenchmark, SweepGarbage)(benchmark::State& state) {
+  const int object_count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    {
+      i::HandleScope scope(i_isolate());
+      for (int j = 0; j < object_count; j++) {
+        factory()->NewFixedArray(kYoungArrayLength, i::AllocationType::kOld);
+      }
+    }
+    state.ResumeTiming();
+    InvokeMajorGC();
+    CompleteSweeping();
+  }
+  state.SetItemsProcessed(state.iterations() * object_count);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, SweepGarbage)
+    ->Arg(100 * 1000)
+    ->Arg(1000 * 1000)
+    ->Unit(benchmark::kMillisecond);
+
+// Stores young objects into an old array, which takes the generational write
+// barrier's slow path and records every slot in the remembered set.
+BENCHMARK_DEFINE_F(HeapBenchmark, WriteBarrierOldToNew)
+(benchmark::State& state) {
+  i::HandleScope scope(i_isolate());
+  i::Handle<i::FixedArray> old_array = factory()->NewFixedArray(
+      kYoungObjectsPerIteration, i::AllocationType::kOld);
+  i::Handle<i::HeapNumber> young = factory()->NewHeapNumber(0.5);
+  for (auto _ : state) {
+    USE(_);
+    i::Tagged<i::FixedArray> raw_array = *old_array;
+    i::Tagged<i::HeapNumber> raw_young = *young;
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      raw_array->set(j, raw_young);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, WriteBarrierOldToNew);
+
+// Stores old objects into an old array, which only takes the barrier's fast
+// path while no incremental marking is running.
+BENCHMARK_DEFINE_F(HeapBenchmark, WriteBarrierOldToOld)
+(benchmark::State& state) {
+  i::HandleScope scope(i_isolate());
+  i::Handle<i::FixedArray> old_array = factory()->NewFixedArray(
+      kYoungObjectsPerIteration, i::AllocationType::kOld);
+  i::Handle<i::HeapNumber> old =
+      factory()->NewHeapNumber<i::AllocationType::kOld>(0.5);
+  for (auto _ : state) {
+    USE(_);
+    i::Tagged<i::FixedArray> raw_array = *old_array;
+    i::Tagged<i::HeapNumber> raw_old = *old;
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      raw_array->set(j, raw_old);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, WriteBarrierOldToOld);
+
+// Factory allocation fast paths. Each iteration allocates a batch of objects
+// in a fresh handle scope; the scavenges this causes are part of the cost.
+BENCHMARK_DEFINE_F(HeapBenchmark, FactoryNewFixedArray)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    USE(_);
+    i::HandleScope scope(i_isolate());
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      benchmark::DoNotOptimize(factory()->NewFixedArray(kYoungArrayLength));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, FactoryNewFixedArray);
+
+BENCHMARK_DEFINE_F(HeapBenchmark, FactoryNewHeapNumber)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    USE(_);
+    i::HandleScope scope(i_isolate());
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      benchmark::DoNotOptimize(factory()->NewHeapNumber(j + 0.5));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, FactoryNewHeapNumber);
+
+BENCHMARK_DEFINE_F(HeapBenchmark, FactoryNewJSObject)(benchmark::State& state) {
+  i::HandleScope outer_scope(i_isolate());
+  i::Handle<i::JSFunction> object_function = i_isolate()->object_function();
+  for (auto _ : state) {
+    USE(_);
+    i::HandleScope scope(i_isolate());
+    for (int j = 0; j < kYoungObjectsPerIteration; j++) {
+      benchmark::DoNotOptimize(factory()->NewJSObject(object_function));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kYoungObjectsPerIteration);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, FactoryNewJSObject);
+
+// Scavenges with an old array whose slots all point to young objects, so the
+// scavenger has to iterate the old-to-new remembered set of all of its pages.
+BENCHMARK_DEFINE_F(HeapBenchmark, RememberedSetIteration)
+(benchmark::State& state) {
+  const int slot_count = static_cast<int>(state.range(0));
+  i::HandleScope outer_scope(i_isolate());
+  i::Handle<i::FixedArray> old_array =
+      factory()->NewFixedArray(slot_count, i::AllocationType::kOld);
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    {
+      i::HandleScope scope(i_isolate());
+      i::Handle<i::HeapNumber> young = factory()->NewHeapNumber(0.5);
+      for (int j = 0; j < slot_count; j++) old_array->set(j, *young);
+    }
+    state.ResumeTiming();
+    InvokeMinorGC();
+  }
+  state.SetItemsProcessed(state.iterations() * slot_count);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, RememberedSetIteration)
+    ->Arg(10 * 1000)
+    ->Arg(100 * 1000)
+    ->Arg(1000 * 1000);
@@ -0,0 +1,250 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures how a mixed workload scales with the number of isolates in the
+// process, each running on its own thread. Every round, each isolate
+// deserializes the same code cache, allocates, internalizes strings, and
+// tiers up hot functions on the platform's worker pool. Ideally, a round takes
+// as long with N isolates as with one; the "efficiency" counter reports the
+// ratio of the two. Run with --shared-string-table or --harmony-struct to
+// measure the shared heap configuration.
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/execution/isolate.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+constexpr char kWorkloadSource[] = R"JS(
+function makeRecord(k) {
+  return {
+    id: k,
+    name: 'record' + (k % 1000),
+    tags: ['tag' + (k % 7), 'group' + (k % 13)],
+    value: k * 1.5,
+  };
+}
+
+function run(n) {
+  const index = {};
+  let sum = 0;
+  for (let k = 0; k < n; k++) {
+    const record = makeRecord(k);
+    // Computed property names are internalized in the string table.
+    index[record.name] = record;
+    const other = index['record' + ((k * 7) % 1000)];
+    if (other !== undefined) sum += other.value;
+  }
+  const json = JSON.stringify(Object.values(index).slice(0, 200));
+  return sum + JSON.parse(json).length;
+}
+)JS";
+
+constexpr char kRunSource[] = "run(20000)";
+
+v8::Local<v8::String> v8_str(v8::Isolate* isolate, const char* x) {
+  return v8::String::NewFromUtf8(isolate, x).ToLocalChecked();
+}
+
+// A thread that owns an isolate and runs one round of the workload each time
+// it is started, until it is stopped.
+class IsolateThread final : public v8::base::Thread {
+ public:
+  IsolateThread(v8::ArrayBuffer::Allocator* allocator,
+                const std::vector<uint8_t>* code_cache,
+                v8::base::Semaphore* done)
+      : v8::base::Thread(Options("IsolateThread")),
+        allocator_(allocator),
+        code_cache_(code_cache),
+        done_(done) {}
+
+  void StartRound() { start_.Signal(); }
+
+  void Stop() {
+    stopping_ = true;
+    start_.Signal();
+  }
+
+  // Whether any round failed, e.g. because the code cache was rejected.
+  bool failed() const { return failed_; }
+
+  void Run() override {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_;
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    // Each round deserializes the code cache instead of hitting the
+    // isolate's compilation cache.
+    reinterpret_cast<i::Isolate*>(isolate)
+        ->compilation_cache()
+        ->DisableScriptAndEval();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      while (true) {
+        start_.Wait();
+        if (stopping_) break;
+        if (!RunRound(isolate, context)) failed_ = true;
+        done_->Signal();
+      }
+    }
+    isolate->Dispose();
+  }
+
+ private:
+  bool RunRound(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    v8::HandleScope handle_scope(isolate);
+    // The source owns the cached data and deletes it, but the buffer is
+    // shared by all threads.
+    v8::ScriptCompiler::Source source(
+        v8_str(isolate, kWorkloadSource),
+        new v8::ScriptCompiler::CachedData(
+            code_cache_->data(), static_cast<int>(code_cache_->size()),
+            v8::ScriptCompiler::CachedData::BufferNotOwned));
+    v8::Local<v8::Script> script;
+    if (!v8::ScriptCompiler::Compile(context, &source,
+                                     v8::ScriptCompiler::kConsumeCodeCache)
+             .ToLocal(&script) ||
+        source.GetCachedData()->rejected) {
+      return false;
+    }
+    v8::Local<v8::Script> run;
+    return !script->Run(context).IsEmpty() &&
+           v8::Script::Compile(context, v8_str(isolate, kRunSource))
+               .ToLocal(&run) &&
+           !run->Run(context).IsEmpty();
+  }
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  const std::vector<uint8_t>* const code_cache_;
+  v8::base::Semaphore* const done_;
+  v8::base::Semaphore start_{0};
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> failed_{false};
+};
+
+class MultiIsolateBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    if (code_cache_.empty()) CreateCodeCache();
+    const int thread_count = static_cast<int>(state.range(0));
+    for (int j = 0; j < thread_count; j++) {
+      threads_.push_back(std::make_unique<IsolateThread>(
+          allocator_.get(), &code_cache_, &done_));
+      CHECK(threads_.back()->Start());
+    }
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    for (auto& thread : threads_) thread->Stop();
+    for (auto& thread : threads_) thread->Join();
+    threads_.clear();
+    allocator_.reset();
+  }
+
+ protected:
+  // Runs one round on all threads concurrently and returns whether all of
+  // them succeeded.
+  bool RunRound() {
+    for (auto& thread : threads_) thread->StartRound();
+    for (size_t j = 0; j < threads_.size(); j++) done_.Wait();
+    for (auto& thread : threads_) {
+      if (thread->failed()) return false;
+    }
+    return true;
+  }
+
+  // The duration of a round on a single isolate, or zero if the benchmark
+  // has not run with one thread yet.
+  static double single_isolate_round_seconds_;
+
+ private:
+  // Eagerly compiles the workload on the isolate of the fixture and
+  // serializes the bytecode of all of its functions.
+  void CreateCodeCache() {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    v8::Context::Scope context_scope(context);
+    v8::ScriptCompiler::Source source(v8_str(v8_isolate(), kWorkloadSource));
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &source,
+                                    v8::ScriptCompiler::kEagerCompile)
+            .ToLocalChecked();
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    code_cache_.assign(cached_data->data,
+                       cached_data->data + cached_data->length);
+  }
+
+  static std::vector<uint8_t> code_cache_;
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  std::vector<std::unique_ptr<IsolateThread>> threads_;
+  v8::base::Semaphore done_{0};
+};
+
+// static
+double MultiIsolateBenchmark::single_isolate_round_seconds_ = 0;
+
+// static
+std::vector<uint8_t> MultiIsolateBenchmark::code_cache_;
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(MultiIsolateBenchmark, MixedWorkload)
+(benchmark::State& state) {
+  const int thread_count = static_cast<int>(state.range(0));
+  // Warm up, so that the first measured round does not include starting the
+  // threads and creating the isolates.
+  if (!RunRound()) {
+    state.SkipWithError("Workload failed");
+    return;
+  }
+  v8::base::TimeTicks start = v8::base::TimeTicks::Now();
+  for (auto _ : state) {
+    USE(_);
+    if (!RunRound()) {
+      state.SkipWithError("Workload failed");
+      return;
+    }
+  }
+  double round_seconds = (v8::base::TimeTicks::Now() - start).InSecondsF() /
+                         static_cast<double>(state.iterations());
+  if (thread_count == 1) single_isolate_round_seconds_ = round_seconds;
+  if (single_isolate_round_seconds_ > 0) {
+    state.counters["efficiency"] =
+        single_isolate_round_seconds_ / round_seconds;
+  }
+  state.SetItemsProcessed(state.iterations() * thread_count);
+}
+// Arguments are run in order, so the single isolate baseline comes first.
+BENCHMARK_REGISTER_F(MultiIsolateBenchmark, MixedWorkload)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(32)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
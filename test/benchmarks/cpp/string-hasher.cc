@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/strings/string-hasher-inl.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::internal::StringHasher;
+
+constexpr uint64_t kSeed = 0x1234567890abcdef;
+
+// Property keys as they appear in JSON from web APIs and logs.
+std::vector<std::string> IdentifierKeys() {
+  return {"id",        "name",     "type",        "value",  "createdAt",
+          "updatedAt", "user_id",  "description", "status", "timestamp",
+          "x",         "y",        "width",       "height", "children",
+          "isEnabled", "metadata", "tags",        "url",    "version"};
+}
+
+std::vector<std::string> NumericKeys() {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 20; i++) keys.push_back(std::to_string(i * 7919));
+  return keys;
+}
+
+// Keys which start with a digit but aren't indices.
+std::vector<std::string> DigitPrefixKeys() {
+  return {"2024-01-01", "2024-01-02", "1px",      "10ms", "3f2a9c",
+          "0x1f",       "12:30:00",   "1.5",      "42nd", "7e3b1d2c",
+          "2024-02-29", "100%",       "9a8b7c6d", "1e10", "2d",
+          "3d",         "4k",         "5G",       "6-7",  "8x8"};
+}
+
+std::vector<std::string> LongKeys() {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 20; i++) {
+    keys.push_back("com.example.service.configuration.property" +
+                   std::to_string(i));
+  }
+  return keys;
+}
+
+void HashKeys(benchmark::State& state, const std::vector<std::string>& keys) {
+  for (auto _ : state) {
+    for (const std::string& key : keys) {
+      benchmark::DoNotOptimize(StringHasher::HashSequentialString(
+          key.data(), static_cast<int>(key.size()), kSeed));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_HashIdentifierKeys(benchmark::State& state) {
+  HashKeys(state, IdentifierKeys());
+}
+void BM_HashNumericKeys(benchmark::State& state) {
+  HashKeys(state, NumericKeys());
+}
+void BM_HashDigitPrefixKeys(benchmark::State& state) {
+  HashKeys(state, DigitPrefixKeys());
+}
+void BM_HashLongKeys(benchmark::State& state) { HashKeys(state, LongKeys()); }
+
+BENCHMARK(BM_HashIdentifierKeys);
+BENCHMARK(BM_HashNumericKeys);
+BENCHMARK(BM_HashDigitPrefixKeys);
+BENCHMARK(BM_HashLongKeys);
+
+}  // namespace
@@ -0,0 +1,110 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdint>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/numbers/strtod.h"
+#include "src/base/vector.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+using v8::base::EiselLemireStrtod;
+using v8::base::Strtod;
+using v8::base::Vector;
+
+namespace {
+
+constexpr int kNumInputs = 4096;
+
+struct Decimal {
+  char digits[20];
+  int length;
+  uint64_t significand;
+  int exponent;
+};
+
+// Random decimals with {num_digits} significant digits, and decimal exponents
+// in the range of typical JSON and CSS numbers or, with {wide_exponents}, of
+// all doubles.
+std::vector<Decimal> MakeDecimals(int num_digits, bool wide_exponents) {
+  std::vector<Decimal> decimals(kNumInputs);
+  uint64_t state = 0x9E3779B97F4A7C15;
+  for (Decimal& decimal : decimals) {
+    decimal.significand = 0;
+    for (int i = 0; i < num_digits; i++) {
+      state = state * 6364136223846793005 + 1442695040888963407;
+      int digit = static_cast<int>((state >> 33) % 10);
+      if (i == 0 && digit == 0) digit = 1;
+      decimal.digits[i] = static_cast<char>('0' + digit);
+      decimal.significand = decimal.significand * 10 + digit;
+    }
+    decimal.length = num_digits;
+    state = state * 6364136223846793005 + 1442695040888963407;
+    int range = wide_exponents ? 600 : 40;
+    decimal.exponent = static_cast<int>((state >> 33) % range) - range / 2;
+  }
+  return decimals;
+}
+
+const std::vector<Decimal> kShortDecimals = MakeDecimals(6, false);
+const std::vector<Decimal> kLongDecimals = MakeDecimals(17, false);
+const std::vector<Decimal> kWideDecimals = MakeDecimals(17, true);
+
+void RunStrtod(benchmark::State& state, const std::vector<Decimal>& inputs) {
+  unsigned idx = 0;
+  for (auto _ : state) {
+    const Decimal& decimal = inputs[idx++ % kNumInputs];
+    double result =
+        Strtod(Vector<const char>(decimal.digits, decimal.length),
+               decimal.exponent);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+void RunEiselLemire(benchmark::State& state,
+                    const std::vector<Decimal>& inputs) {
+  unsigned idx = 0;
+  for (auto _ : state) {
+    const Decimal& decimal = inputs[idx++ % kNumInputs];
+    double result;
+    bool ok =
+        EiselLemireStrtod(decimal.significand, decimal.exponent, &result);
+    USE(ok);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+}  // namespace
+
+static void BM_StrtodShortDigits(benchmark::State& state) {
+  RunStrtod(state, kShortDecimals);
+}
+
+static void BM_StrtodLongDigits(benchmark::State& state) {
+  RunStrtod(state, kLongDecimals);
+}
+
+static void BM_StrtodWideExponents(benchmark::State& state) {
+  RunStrtod(state, kWideDecimals);
+}
+
+static void BM_EiselLemireShortDigits(benchmark::State& state) {
+  RunEiselLemire(state, kShortDecimals);
+}
+
+static void BM_EiselLemireLongDigits(benchmark::State& state) {
+  RunEiselLemire(state, kLongDecimals);
+}
+
+static void BM_EiselLemireWideExponents(benchmark::State& state) {
+  RunEiselLemire(state, kWideDecimals);
+}
+
+BENCHMARK(BM_StrtodShortDigits);
+BENCHMARK(BM_StrtodLongDigits);
+BENCHMARK(BM_StrtodWideExponents);
+BENCHMARK(BM_EiselLemireShortDigits);
+BENCHMARK(BM_EiselLemireLongDigits);
+BENCHMARK(BM_EiselLemireWideExponents);
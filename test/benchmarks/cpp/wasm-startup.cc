@@ -0,0 +1,502 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the startup of WebAssembly modules: streaming compilation up to
+// the first call of an export, synchronous compilation, deserialization of a
+// cached native module, instantiation, and the memory cost of an instance.
+// The corpus is read from the files listed, separated by ':', in the
+// V8_WASM_STARTUP_BENCHMARK_CORPUS environment variable; modules may only
+// import functions. Without it, a generated module is used.
+//
+// Which tiers compile a module eagerly is determined by the V8 flags the
+// benchmark runs with, e.g. --no-wasm-lazy-compilation for eager Liftoff, or
+// additionally --no-liftoff --turboshaft-wasm for eager Turboshaft; the label
+// of each benchmark names the configuration. Every iteration compiles a copy
+// of the module with a unique custom section, so that the native module cache
+// never hits. Import wrappers are cached for the lifetime of the process, so
+// they are only compiled by the first instantiation that needs them.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-context.h"
+#include "include/v8-exception.h"
+#include "include/v8-function.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-statistics.h"
+#include "include/v8-wasm.h"
+#include "src/api/api-inl.h"
+#include "src/base/macros.h"
+#include "src/base/vector.h"
+#include "src/execution/isolate-inl.h"
+#include "src/flags/flags.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/wasm/module-compiler.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-js.h"
+#include "src/wasm/wasm-module.h"
+#include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-result.h"
+#include "src/wasm/wasm-serialization.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+// Streaming compilation receives the module in chunks of this size, as it
+// would from the network.
+constexpr size_t kStreamingChunkSize = 64 * 1024;
+
+// Number of instances that are kept alive at the same time to measure the
+// memory of an instance.
+constexpr int kInstancesForMemory = 100;
+
+// Builds an object that satisfies the function imports of a module.
+constexpr char kMakeImportsSource[] = R"JS(
+(function(module) {
+  const imports = {};
+  for (const {module: name, name: field, kind} of
+       WebAssembly.Module.imports(module)) {
+    if (kind !== 'function') throw new Error('Unsupported import: ' + kind);
+    (imports[name] ??= {})[field] = (a, b) => (a | 0) + (b | 0);
+  }
+  return imports;
+})
+)JS";
+
+// Calls the first exported function of an instance.
+constexpr char kCallFirstExportSource[] = R"JS(
+(function(instance) {
+  for (const value of Object.values(instance.exports)) {
+    if (typeof value === 'function') return value();
+  }
+})
+)JS";
+
+struct CorpusEntry {
+  std::string name;
+  std::string bytes;
+};
+
+void WriteU32V(std::string& out, uint32_t value) {
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value != 0) byte |= 0x80;
+    out.push_back(static_cast<char>(byte));
+  } while (value != 0);
+}
+
+void WriteName(std::string& out, const std::string& name) {
+  WriteU32V(out, static_cast<uint32_t>(name.size()));
+  out += name;
+}
+
+void WriteSection(std::string& out, uint8_t id, const std::string& payload) {
+  out.push_back(static_cast<char>(id));
+  WriteU32V(out, static_cast<uint32_t>(payload.size()));
+  out += payload;
+}
+
+// A large module with an imported function, a memory, and many functions of
+// type (i32, i32) -> i32. It exports "main", of type () -> i32, which calls
+// the first of them and the import.
+std::string GenerateWasmModule() {
+  constexpr uint32_t kFunctionCount = 5000;
+  constexpr uint32_t kMainIndex = kFunctionCount + 1;
+  std::string module("\0asm\x01\0\0\0", 8);
+
+  std::string types;
+  WriteU32V(types, 2);
+  types += "\x60\x02\x7f\x7f\x01\x7f";  // (i32, i32) -> i32
+  types += "\x60\x00\x01\x7f";          // () -> i32
+  WriteSection(module, 1, types);
+
+  std::string imports;
+  WriteU32V(imports, 1);
+  WriteName(imports, "env");
+  WriteName(imports, "add");
+  imports += std::string("\x00\x00", 2);  // Function of type 0.
+  WriteSection(module, 2, imports);
+
+  std::string functions;
+  WriteU32V(functions, kFunctionCount + 1);
+  for (uint32_t j = 0; j < kFunctionCount; j++) functions.push_back(0);
+  functions.push_back(1);
+  WriteSection(module, 3, functions);
+
+  std::string memories;
+  WriteU32V(memories, 1);
+  memories += std::string("\x00\x01", 2);  // At least one page.
+  WriteSection(module, 5, memories);
+
+  std::string exports;
+  WriteU32V(exports, 2);
+  WriteName(exports, "main");
+  exports.push_back(0);
+  WriteU32V(exports, kMainIndex);
+  WriteName(exports, "memory");
+  exports += std::string("\x02\x00", 2);
+  WriteSection(module, 7, exports);
+
+  // local.get 0, local.get 1, i32.mul, local.get 0, i32.add, local.set 0,
+  // repeated in a loop that counts local 1 down to zero.
+  const std::string kStep("\x20\x00\x20\x01\x6c\x20\x00\x6a\x21\x00", 10);
+  std::string body;
+  WriteU32V(body, 0);  // No locals.
+  body += "\x03\x40";  // loop
+  for (int j = 0; j < 20; j++) body += kStep;
+  body += std::string("\x20\x01\x41\x01\x6b\x22\x01\x0d\x00", 9);  // br_if
+  body += "\x0b";  // end loop
+  body += std::string("\x20\x00\x0b", 3);
+  // i32.const 3, i32.const 4, call 1, i32.const 1, call 0 (the import).
+  std::string main_body;
+  WriteU32V(main_body, 0);
+  main_body += std::string("\x41\x03\x41\x04\x10\x01\x41\x01\x10\x00\x0b", 11);
+  std::string code;
+  WriteU32V(code, kFunctionCount + 1);
+  for (uint32_t j = 0; j < kFunctionCount; j++) {
+    WriteU32V(code, static_cast<uint32_t>(body.size()));
+    code += body;
+  }
+  WriteU32V(code, static_cast<uint32_t>(main_body.size()));
+  code += main_body;
+  WriteSection(module, 10, code);
+  return module;
+}
+
+const std::vector<CorpusEntry>& GetCorpus() {
+  static const std::vector<CorpusEntry>* corpus = [] {
+    auto* corpus = new std::vector<CorpusEntry>();
+    const char* files = std::getenv("V8_WASM_STARTUP_BENCHMARK_CORPUS");
+    if (files == nullptr || *files == '\0') {
+      corpus->push_back({"generated.wasm", GenerateWasmModule()});
+      return corpus;
+    }
+    std::istringstream paths(files);
+    std::string path;
+    while (std::getline(paths, path, ':')) {
+      if (path.empty()) continue;
+      std::ifstream file(path, std::ios::binary);
+      CHECK_WITH_MSG(file.good(), "cannot read corpus file");
+      corpus->push_back({path, std::string(std::istreambuf_iterator<char>(file),
+                                           std::istreambuf_iterator<char>())});
+    }
+    return corpus;
+  }();
+  return *corpus;
+}
+
+void ForEachModule(benchmark::internal::Benchmark* benchmark) {
+  for (size_t j = 0; j < GetCorpus().size(); j++) {
+    benchmark->Arg(static_cast<int64_t>(j));
+  }
+}
+
+// Describes how modules are compiled with the current flags.
+std::string CompilationConfiguration() {
+  if (i::v8_flags.wasm_lazy_compilation) return "lazy";
+  if (i::v8_flags.liftoff) return "liftoff";
+  return i::v8_flags.turboshaft_wasm ? "turboshaft" : "turbofan";
+}
+
+class StreamingResolver final : public i::wasm::CompilationResultResolver {
+ public:
+  explicit StreamingResolver(v8::Isolate* isolate) : isolate_(isolate) {}
+
+  void OnCompilationSucceeded(i::Handle<i::WasmModuleObject> result) override {
+    module_.Reset(isolate_, v8::Utils::ToLocal(i::Cast<i::JSObject>(result)));
+    done_ = true;
+  }
+
+  void OnCompilationFailed(i::Handle<i::Object> error_reason) override {
+    done_ = true;
+  }
+
+  bool done() const { return done_; }
+  v8::Local<v8::Object> module() const { return module_.Get(isolate_); }
+
+ private:
+  v8::Isolate* const isolate_;
+  v8::Global<v8::Object> module_;
+  bool done_ = false;
+};
+
+class WasmStartupBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    context_.Reset(v8_isolate(), context);
+    context->Enter();
+    make_imports_.Reset(v8_isolate(), CompileFunction(kMakeImportsSource));
+    call_first_export_.Reset(v8_isolate(),
+                             CompileFunction(kCallFirstExportSource));
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    make_imports_.Reset();
+    call_first_export_.Reset();
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+    InvokeAtomicMajorGC();
+  }
+
+ protected:
+  i::Isolate* i_isolate() {
+    return reinterpret_cast<i::Isolate*>(v8_isolate());
+  }
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  const CorpusEntry& Module(benchmark::State& state) {
+    const CorpusEntry& entry = GetCorpus()[state.range(0)];
+    state.SetLabel(entry.name + " " + CompilationConfiguration());
+    return entry;
+  }
+
+  void InvokeAtomicMajorGC() {
+    i_isolate()->heap()->PreciseCollectAllGarbage(
+        i::GCFlag::kNoFlags, i::GarbageCollectionReason::kTesting);
+  }
+
+  // Returns the bytes of |entry| with a custom section appended that makes
+  // them different from those of all previous calls.
+  std::string UniqueBytes(const CorpusEntry& entry) {
+    std::string payload;
+    WriteName(payload, "benchmark");
+    WriteU32V(payload, unique_id_++);
+    std::string bytes = entry.bytes;
+    WriteSection(bytes, 0, payload);
+    return bytes;
+  }
+
+  i::Handle<i::WasmModuleObject> SyncCompile(const std::string& bytes) {
+    i::wasm::ErrorThrower thrower(i_isolate(), "WasmStartupBenchmark");
+    i::MaybeHandle<i::WasmModuleObject> module =
+        i::wasm::GetWasmEngine()->SyncCompile(
+            i_isolate(), i::wasm::WasmEnabledFeatures::FromIsolate(i_isolate()),
+            i::wasm::CompileTimeImports{}, &thrower,
+            i::wasm::ModuleWireBytes(v8::base::VectorOf(
+                reinterpret_cast<const uint8_t*>(bytes.data()),
+                bytes.size())));
+    CHECK_WITH_MSG(!thrower.error(), "cannot compile corpus module");
+    return module.ToHandleChecked();
+  }
+
+  v8::Local<v8::Object> Instantiate(v8::Local<v8::Object> module) {
+    v8::Local<v8::Value> argument = module;
+    v8::Local<v8::Object> imports =
+        make_imports_.Get(v8_isolate())
+            ->Call(v8_context(), v8::Undefined(v8_isolate()), 1, &argument)
+            .ToLocalChecked()
+            .As<v8::Object>();
+    i::wasm::ErrorThrower thrower(i_isolate(), "WasmStartupBenchmark");
+    i::Handle<i::WasmInstanceObject> instance =
+        i::wasm::GetWasmEngine()
+            ->SyncInstantiate(
+                i_isolate(), &thrower,
+                i::Cast<i::WasmModuleObject>(v8::Utils::OpenHandle(*module)),
+                v8::Utils::OpenHandle(*imports), {})
+            .ToHandleChecked();
+    return v8::Utils::ToLocal(i::Cast<i::JSObject>(instance));
+  }
+
+  // Calls the first export of |instance|. Exceptions and traps are ignored,
+  // as corpus modules may not expect to be called without arguments.
+  void CallFirstExport(v8::Local<v8::Object> instance) {
+    v8::TryCatch try_catch(v8_isolate());
+    v8::Local<v8::Value> argument = instance;
+    USE(call_first_export_.Get(v8_isolate())
+            ->Call(v8_context(), v8::Undefined(v8_isolate()), 1, &argument));
+  }
+
+  size_t CurrentMemory() {
+    v8::HeapStatistics stats;
+    v8_isolate()->GetHeapStatistics(&stats);
+    return stats.used_heap_size() + stats.external_memory() +
+           stats.malloced_memory();
+  }
+
+ private:
+  v8::Local<v8::Function> CompileFunction(const char* source) {
+    return v8::Script::Compile(
+               v8_context(),
+               v8::String::NewFromUtf8(v8_isolate(), source).ToLocalChecked())
+        .ToLocalChecked()
+        ->Run(v8_context())
+        .ToLocalChecked()
+        .As<v8::Function>();
+  }
+
+  v8::Global<v8::Context> context_;
+  v8::Global<v8::Function> make_imports_;
+  v8::Global<v8::Function> call_first_export_;
+  uint32_t unique_id_ = 0;
+};
+
+}  // namespace
+
+// Streams the module in chunks, instantiates it once compilation finished, and
+// calls its first export.
+BENCHMARK_DEFINE_F(WasmStartupBenchmark, StreamingCompileToFirstCall)
+(benchmark::State& state) {
+  const CorpusEntry& entry = Module(state);
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    std::string bytes = UniqueBytes(entry);
+    v8::HandleScope handle_scope(v8_isolate());
+    auto resolver = std::make_shared<StreamingResolver>(v8_isolate());
+    state.ResumeTiming();
+    std::unique_ptr<v8::WasmStreaming> streaming =
+        i::wasm::StartStreamingForTesting(i_isolate(), resolver);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(bytes.data());
+    for (size_t offset = 0; offset < bytes.size();
+         offset += kStreamingChunkSize) {
+      streaming->OnBytesReceived(
+          data + offset, std::min(kStreamingChunkSize, bytes.size() - offset));
+    }
+    streaming->Finish();
+    while (!resolver->done()) {
+      v8::platform::PumpMessageLoop(
+          platform(), v8_isolate(),
+          v8::platform::MessageLoopBehavior::kWaitForWork);
+    }
+    if (resolver->module().IsEmpty()) {
+      state.SkipWithError("Streaming compilation failed");
+      return;
+    }
+    CallFirstExport(Instantiate(resolver->module()));
+  }
+  state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+}
+BENCHMARK_REGISTER_F(WasmStartupBenchmark, StreamingCompileToFirstCall)
+    ->Apply(ForEachModule)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(WasmStartupBenchmark, SyncCompile)
+(benchmark::State& state) {
+  const CorpusEntry& entry = Module(state);
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    std::string bytes = UniqueBytes(entry);
+    i::HandleScope handle_scope(i_isolate());
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(SyncCompile(bytes));
+  }
+  state.SetBytesProcessed(state.iterations() * entry.bytes.size());
+}
+BENCHMARK_REGISTER_F(WasmStartupBenchmark, SyncCompile)
+    ->Apply(ForEachModule)
+    ->Unit(benchmark::kMillisecond);
+
+// Deserializes a native module that was fully tiered up before it was
+// serialized, as an embedder would from its code cache.
+BENCHMARK_DEFINE_F(WasmStartupBenchmark, Deserialize)
+(benchmark::State& state) {
+  const CorpusEntry& entry = Module(state);
+  std::vector<uint8_t> serialized;
+  {
+    v8::HandleScope handle_scope(v8_isolate());
+    i::Handle<i::WasmModuleObject> module = SyncCompile(UniqueBytes(entry));
+    v8::Local<v8::Object> instance =
+        Instantiate(v8::Utils::ToLocal(i::Cast<i::JSObject>(module)));
+    i::wasm::TierUpAllForTesting(
+        i_isolate(),
+        i::Cast<i::WasmInstanceObject>(v8::Utils::OpenHandle(*instance))
+            ->trusted_data(i_isolate()));
+    v8::OwnedBuffer buffer =
+        v8::Utils::ToLocal(i::Cast<i::JSObject>(module))
+            .As<v8::WasmModuleObject>()
+            ->GetCompiledModule()
+            .Serialize();
+    serialized.assign(buffer.buffer.get(), buffer.buffer.get() + buffer.size);
+  }
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    std::string bytes = UniqueBytes(entry);
+    i::HandleScope handle_scope(i_isolate());
+    state.ResumeTiming();
+    i::MaybeHandle<i::WasmModuleObject> module =
+        i::wasm::DeserializeNativeModule(
+            i_isolate(), v8::base::VectorOf(serialized),
+            v8::base::VectorOf(reinterpret_cast<const uint8_t*>(bytes.data()),
+                               bytes.size()),
+            i::wasm::CompileTimeImports{}, {});
+    if (module.is_null()) {
+      state.SkipWithError("Deserialization failed");
+      return;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * serialized.size());
+}
+BENCHMARK_REGISTER_F(WasmStartupBenchmark, Deserialize)
+    ->Apply(ForEachModule)
+    ->Unit(benchmark::kMillisecond);
+
+// Instantiates a compiled module, which includes building the imports object
+// and creating the instance's memory and tables.
+BENCHMARK_DEFINE_F(WasmStartupBenchmark, Instantiate)
+(benchmark::State& state) {
+  const CorpusEntry& entry = Module(state);
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Object> module =
+      v8::Utils::ToLocal(i::Cast<i::JSObject>(SyncCompile(UniqueBytes(entry))));
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(Instantiate(module));
+  }
+}
+BENCHMARK_REGISTER_F(WasmStartupBenchmark, Instantiate)->Apply(ForEachModule);
+
+// Reports the memory of an instance, including its memory, as the
+// "bytes_per_instance" counter. The time is that of creating all instances.
+BENCHMARK_DEFINE_F(WasmStartupBenchmark, InstanceMemory)
+(benchmark::State& state) {
+  const CorpusEntry& entry = Module(state);
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Object> module =
+      v8::Utils::ToLocal(i::Cast<i::JSObject>(SyncCompile(UniqueBytes(entry))));
+  double bytes_per_instance = 0;
+  for (auto _ : state) {
+    USE(_);
+    state.PauseTiming();
+    InvokeAtomicMajorGC();
+    const size_t before = CurrentMemory();
+    state.ResumeTiming();
+    v8::HandleScope iteration_scope(v8_isolate());
+    std::vector<v8::Local<v8::Object>> instances;
+    for (int j = 0; j < kInstancesForMemory; j++) {
+      instances.push_back(Instantiate(module));
+    }
+    state.PauseTiming();
+    InvokeAtomicMajorGC();
+    const size_t after = CurrentMemory();
+    bytes_per_instance = (static_cast<double>(after) - before) /
+                         static_cast<double>(kInstancesForMemory);
+    state.ResumeTiming();
+  }
+  state.counters["bytes_per_instance"] = bytes_per_instance;
+}
+BENCHMARK_REGISTER_F(WasmStartupBenchmark, InstanceMemory)
+    ->Apply(ForEachModule)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,75 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <map>
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+using v8::platform::DefaultWorkerThreadsTaskRunner;
+
+namespace {
+
+constexpr int kTasksPerIteration = 1024;
+
+double Now() {
+  return v8::base::TimeTicks::Now().ToInternalValue() /
+         static_cast<double>(v8::base::Time::kMicrosecondsPerSecond);
+}
+
+// Runners are shared by all benchmark threads, like the worker threads of a
+// platform are shared by all isolates of a process. They are never
+// terminated.
+DefaultWorkerThreadsTaskRunner* GetRunner(int num_workers) {
+  static v8::base::Mutex mutex;
+  static std::map<int, DefaultWorkerThreadsTaskRunner*> runners;
+  v8::base::MutexGuard guard(&mutex);
+  DefaultWorkerThreadsTaskRunner*& runner = runners[num_workers];
+  if (!runner) runner = new DefaultWorkerThreadsTaskRunner(num_workers, Now);
+  return runner;
+}
+
+class CountdownTask final : public v8::Task {
+ public:
+  CountdownTask(std::atomic<int>* remaining, v8::base::Semaphore* done)
+      : remaining_(remaining), done_(done) {}
+
+  void Run() override {
+    if (remaining_->fetch_sub(1) == 1) done_->Signal();
+  }
+
+ private:
+  std::atomic<int>* remaining_;
+  v8::base::Semaphore* done_;
+};
+
+}  // namespace
+
+// Posts small tasks from each benchmark thread to a runner with
+// |state.range(0)| workers and waits until they ran.
+static void BM_PostTasks(benchmark::State& state) {
+  DefaultWorkerThreadsTaskRunner* runner =
+      GetRunner(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::atomic<int> remaining{kTasksPerIteration};
+    v8::base::Semaphore done(0);
+    for (int i = 0; i < kTasksPerIteration; i++) {
+      runner->PostTask(std::make_unique<CountdownTask>(&remaining, &done));
+    }
+    done.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * kTasksPerIteration);
+}
+
+BENCHMARK(BM_PostTasks)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
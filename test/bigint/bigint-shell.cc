@@ -4,7 +4,10 @@
 
 #include <cmath>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +39,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +127,32 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs each posted task on a new thread.
+class ThreadPlatform : public Platform {
+ public:
+  explicit ThreadPlatform(int worker_threads)
+      : worker_threads_(worker_threads) {}
+  ~ThreadPlatform() override {
+    std::vector<std::thread> threads;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      threads.swap(threads_);
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+
+  int NumberOfWorkerThreads() override { return worker_threads_; }
+  void PostTask(std::unique_ptr<Task> task) override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    threads_.emplace_back([task = std::move(task)]() { task->Run(); });
+  }
+
+ private:
+  const int worker_threads_;
+  std::mutex mutex_;
+  std::vector<std::thread> threads_;
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -204,6 +234,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +345,87 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // Compares multiplications and conversions that are big enough to be
+    // split across worker threads with the results of a single thread.
+    std::unique_ptr<Processor, Processor::Destroyer> parallel_processor(
+        Processor::New(new ThreadPlatform(3)));
+    ProcessorImpl* parallel =
+        static_cast<ProcessorImpl*>(parallel_processor.get());
+    uint64_t random_bits = rng_.NextUint64();
+    {
+      // FFT.
+      int left_size = kFftParallelThreshold / 2 +
+                      static_cast<int>(random_bits & 0xFFF);
+      random_bits >>= 12;
+      int right_size = kFftParallelThreshold / 2 +
+                       static_cast<int>(random_bits & 0xFFF);
+      random_bits >>= 12;
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits reference(result_len);
+      parallel->Multiply(result, A, B);
+      processor()->Multiply(reference, A, B);
+      AssertEquals(A, B, reference, result);
+      if (error_) return;
+      (*count)++;
+      // Squaring.
+      ScratchDigits square(2 * left_size);
+      ScratchDigits square_reference(2 * left_size);
+      parallel->Multiply(square, A, A);
+      processor()->Multiply(square_reference, A, A);
+      AssertEquals(A, A, square_reference, square);
+      if (error_) return;
+      (*count)++;
+    }
+    {
+      // Toom-Cook, with {A} split into chunks.
+      int left_size = kToomParallelThreshold +
+                      static_cast<int>(random_bits & 0xFFF);
+      random_bits >>= 12;
+      int right_size = kToomThreshold + static_cast<int>(random_bits & 0x3FF);
+      random_bits >>= 10;
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits reference(result_len);
+      parallel->MultiplyToomCook(result, A, B);
+      processor()->ToomCookChunks(reference, A, B);
+      AssertEquals(A, B, reference, result);
+      if (error_) return;
+      (*count)++;
+    }
+    {
+      // Conversion to string.
+      int size = 2 * kToStringParallelThreshold +
+                 static_cast<int>(random_bits & 0xFFF);
+      random_bits >>= 12;
+      int radix = 2 + static_cast<int>(random_bits % 35);
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      int chars_required = ToStringResultLength(X, radix, false);
+      int result_len = chars_required;
+      int reference_len = chars_required;
+      std::unique_ptr<char[]> result(new char[result_len]);
+      std::unique_ptr<char[]> reference(new char[reference_len]);
+      parallel->ToString(result.get(), &result_len, X, radix, false);
+      processor()->ToString(reference.get(), &reference_len, X, radix, false);
+      AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                   result_len);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
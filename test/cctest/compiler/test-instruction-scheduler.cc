@@ -107,6 +107,23 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(MachineModels) {
+  const SchedulerMachineModel* generic =
+      InstructionScheduler::FindMachineModel("generic");
+  CHECK_NOT_NULL(generic);
+  CHECK_EQ(1, generic->issue_width);
+  CHECK_EQ(0, generic->load_latency);
+  CHECK_NULL(InstructionScheduler::FindMachineModel("unknown"));
+#if V8_TARGET_ARCH_X64
+  CHECK_NOT_NULL(InstructionScheduler::FindMachineModel("intel-core"));
+  CHECK_NOT_NULL(InstructionScheduler::FindMachineModel("amd-zen"));
+#elif V8_TARGET_ARCH_ARM64
+  CHECK_NOT_NULL(InstructionScheduler::FindMachineModel("neoverse-n1"));
+  CHECK_NOT_NULL(InstructionScheduler::FindMachineModel("neoverse-n2"));
+  CHECK_NOT_NULL(InstructionScheduler::FindMachineModel("neoverse-v1"));
+#endif
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
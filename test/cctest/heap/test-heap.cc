@@ -1146,6 +1146,89 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestAdaptiveBytecodeFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.adaptive_bytecode_flushing = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    IndirectHandle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    IndirectHandle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(IsJSFunction(*func_value));
+    IndirectHandle<JSFunction> function = Cast<JSFunction>(func_value);
+    IndirectHandle<SharedFunctionInfo> shared(function->shared(), i_isolate);
+    CHECK(shared->is_compiled());
+    CHECK_EQ(0u, shared->bytecode_flush_reuse_level());
+    const uint16_t old_age = shared->BytecodeOldAge();
+
+    i::SharedFunctionInfo::EnsureOldForTesting(*shared);
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(!shared->is_compiled());
+    CHECK(shared->HasAgeAfterBytecodeFlush());
+
+    // Recompiling foo soon after the flush gives it more time until the next
+    // flush.
+    CompileRun("foo()");
+    CHECK(shared->is_compiled());
+    CHECK_EQ(1u, shared->bytecode_flush_reuse_level());
+    CHECK_EQ(2 * old_age, shared->BytecodeOldAge());
+
+    // The bytecode is no longer flushed at the default age.
+    shared->set_age(old_age);
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(shared->is_compiled());
+
+    // Recompiling foo after a long time without calls takes the extra time
+    // away again.
+    i::SharedFunctionInfo::EnsureOldForTesting(*shared);
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(!shared->is_compiled());
+    shared->set_age(SharedFunctionInfo::kMaxAge - shared->BytecodeOldAge());
+    CompileRun("foo()");
+    CHECK(shared->is_compiled());
+    CHECK_EQ(0u, shared->bytecode_flush_reuse_level());
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
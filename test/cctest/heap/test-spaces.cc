@@ -261,7 +261,7 @@ TEST(MemoryAllocator) {
 
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
-  size_t page_size = MemoryAllocator::GetCommitPageSize();
+  size_t page_size = MemoryAllocator::GetDiscardPageSize();
   size_t free_header_size = FreeSpace::kSize;
 
   memory_area = MemoryAllocator::ComputeDiscardMemoryArea(0, 0);
@@ -252,6 +252,46 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheAdaptiveSizing) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  FlagScope<bool> adaptive_sizing(&v8_flags.stub_cache_adaptive_sizing, true);
+  Factory* factory = isolate->factory();
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(StubCache::kSecondaryTableSize,
+           stub_cache.table_size(StubCache::kSecondary));
+
+  Handle<Name> name = factory->InternalizeUtf8String("a");
+  DirectHandle<Map> map = Map::Create(isolate, 0);
+  Handle<Code> handler = CreateCodeOfKind(CodeKind::FOR_TESTING);
+
+  DisallowGarbageCollection no_gc;
+
+  // Few probes don't resize the tables.
+  stub_cache.Set(*name, *map, *handler);
+  CHECK_EQ(1u, stub_cache.miss_count());
+  stub_cache.Clear();
+  CHECK_EQ(0u, stub_cache.miss_count());
+  CHECK_EQ(StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+
+  // Only misses grow the tables.
+  for (int i = 0; i < 1000; i++) stub_cache.Set(*name, *map, *handler);
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+           stub_cache.table_size(StubCache::kSecondary));
+
+  // Entries can still be found after resizing.
+  CHECK_EQ(kNullAddress, stub_cache.Get(*name, *map).ptr());
+  stub_cache.Set(*name, *map, *handler);
+  CHECK_EQ(handler->ptr(), stub_cache.Get(*name, *map).ptr());
+}
+
 #include "src/codegen/undef-code-stub-assembler-macros.inc"
 
 }  // namespace internal
@@ -672,6 +672,51 @@ TEST(ScriptUsingOneByteStringResource) {
   CHECK_EQ(1, dispose_count);
 }
 
+TEST(NewSubStringOfExternalOneByteString) {
+  int dispose_count = 0;
+  const char* c_source = "line one of the file\nline two of the file\n";
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::Global<String> first_line;
+  v8::Global<String> second_line;
+  {
+    v8::HandleScope scope(isolate);
+    TestOneByteResource* resource =
+        new TestOneByteResource(i::StrDup(c_source), &dispose_count);
+    Local<String> source =
+        String::NewExternalOneByte(isolate, resource).ToLocalChecked();
+    first_line.Reset(isolate, String::NewSubString(isolate, source, 0, 20));
+    second_line.Reset(isolate, String::NewSubString(isolate, source, 21, 41));
+    // Long substrings refer to the characters of the external string.
+    if (i::v8_flags.string_slices) {
+      CHECK(i::IsSlicedString(*v8::Utils::OpenDirectHandle(
+          *first_line.Get(isolate))));
+    }
+  }
+  {
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  }
+  // The substrings keep the resource alive.
+  CHECK_EQ(0, dispose_count);
+  {
+    v8::HandleScope scope(isolate);
+    CHECK(
+        v8_str("line one of the file")->StrictEquals(first_line.Get(isolate)));
+    CHECK(
+        v8_str("line two of the file")->StrictEquals(second_line.Get(isolate)));
+  }
+  first_line.Reset();
+  second_line.Reset();
+  {
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  }
+  CHECK_EQ(1, dispose_count);
+}
+
 TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString(u"1 + 2 * 3 /* π */");
@@ -11864,6 +11909,35 @@ THREADED_TEST(HandleIteration) {
   CHECK_EQ(kNesting * kIterations, Recurse(isolate, kNesting, kIterations));
 }
 
+THREADED_TEST(HandleScopeReleasesBlocks) {
+  static const int kHandles = 5000;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope outer(isolate);
+  Local<v8::String> before = v8_str("before");
+  for (int round = 0; round < 3; round++) {
+    {
+      // Spans several handle blocks, so closing the scope has to release
+      // them again.
+      v8::HandleScope inner(isolate);
+      for (int i = 0; i < kHandles; i++) {
+        Local<v8::Number> n(v8::Integer::New(isolate, i));
+        CHECK_EQ(i + 2, v8::HandleScope::NumberOfHandles(isolate));
+      }
+    }
+    CHECK_EQ(1, v8::HandleScope::NumberOfHandles(isolate));
+    {
+      // Stays within the current block.
+      v8::HandleScope inner(isolate);
+      Local<v8::Number> n(v8::Integer::New(isolate, round));
+      CHECK_EQ(2, v8::HandleScope::NumberOfHandles(isolate));
+    }
+    CHECK_EQ(1, v8::HandleScope::NumberOfHandles(isolate));
+  }
+  i::heap::InvokeMajorGC(CcTest::heap());
+  CHECK(v8_str("before")->StrictEquals(before));
+}
+
 namespace {
 v8::Intercepted InterceptorCallICFastApi(
     Local<Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
@@ -21040,6 +21114,64 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+Local<Value> StreamingParse(Local<Context> context, const std::string& input,
+                            size_t chunk_size) {
+  v8::JSON::StreamingParser parser;
+  for (size_t i = 0; i < input.size(); i += chunk_size) {
+    parser.Feed(input.data() + i, std::min(chunk_size, input.size() - i));
+  }
+  return parser.Finish(context).ToLocalChecked();
+}
+}  // namespace
+
+THREADED_TEST(JSONStreamingParse) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  // Chunks of every size split the multi-byte characters at every position.
+  const std::string input =
+      "{\"a\":[1,\"\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\"]}";
+  for (size_t chunk_size = 1; chunk_size <= input.size(); chunk_size++) {
+    Local<Value> obj = StreamingParse(context.local(), input, chunk_size);
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectTrue("obj.a[1] == '\\u00e9\\u20ac\\u{1F600}'");
+  }
+
+  // Long texts are parsed from the decoded characters directly.
+  std::string long_input = "[\"" + std::string(5000, 'x') + "\"";
+  for (int i = 0; i < 100; i++) long_input += ",\"\xC3\xA9\"";
+  long_input += "]";
+  Local<Value> obj = StreamingParse(context.local(), long_input, 1000);
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectInt32("obj.length", 101);
+  ExpectInt32("obj[0].length", 5000);
+  ExpectTrue("obj[100] == '\\u00e9'");
+
+  // Invalid and incomplete UTF-8 sequences are replaced by U+FFFD.
+  obj = StreamingParse(context.local(), "\"\xFF\xC3\"", 1);
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj == '\\uFFFD\\uFFFD'");
+  obj = StreamingParse(context.local(), "\"\xE2\x82\"", 2);
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj == '\\uFFFD'");
+
+  // Syntax errors throw, and the parser can be used again afterwards.
+  v8::JSON::StreamingParser parser;
+  parser.Feed("[1,", 3);
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  parser.Feed("[1]", 3);
+  obj = parser.Finish(context.local()).ToLocalChecked();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "[1]");
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -21068,6 +21200,91 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+// Collects the output of v8::JSON::StringifyToUtf8 in buffers of a fixed size.
+class TestUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  explicit TestUtf8Sink(size_t buffer_size) : buffer_(buffer_size) {}
+
+  char* GetBuffer(size_t* size) override {
+    CHECK(!has_buffer_);
+    has_buffer_ = true;
+    *size = buffer_.size();
+    return buffer_.data();
+  }
+
+  void BufferWritten(size_t length) override {
+    CHECK(has_buffer_);
+    CHECK_LE(length, buffer_.size());
+    has_buffer_ = false;
+    output_.append(buffer_.data(), length);
+  }
+
+  const std::string& output() const {
+    CHECK(!has_buffer_);
+    return output_;
+  }
+
+ private:
+  std::vector<char> buffer_;
+  std::string output_;
+  bool has_buffer_ = false;
+};
+
+std::string StringifyToUtf8(Local<Context> context, Local<Value> value,
+                            size_t buffer_size,
+                            Local<String> gap = Local<String>()) {
+  TestUtf8Sink sink(buffer_size);
+  v8::JSON::StringifyToUtf8(context, value, &sink, gap).Check();
+  return sink.output();
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  // Buffers of every size get multi-byte characters at every position.
+  Local<Value> value = CompileRun(
+      "({a: [1, 'x\\u00e9\\u20ac\\u{1F600}\\ud800'], b: '\\n\"'})");
+  const std::string expected =
+      "{\"a\":[1,\"x\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\\ud800\"],"
+      "\"b\":\"\\n\\\"\"}";
+  for (size_t buffer_size = v8::JSON::Utf8Sink::kMinBufferSize;
+       buffer_size <= expected.size() + 1; buffer_size++) {
+    CHECK_EQ(expected, StringifyToUtf8(context.local(), value, buffer_size));
+  }
+
+  // The result matches v8::JSON::Stringify.
+  value = CompileRun(
+      "var obj = {x: 42, y: ['\\u00ff', {z: null}], long: 'a'.repeat(10000)};"
+      "obj");
+  Local<String> json =
+      v8::JSON::Stringify(context.local(), value, v8_str("  "))
+          .ToLocalChecked();
+  v8::String::Utf8Value utf8(isolate, json);
+  CHECK_EQ(std::string(*utf8, utf8.length()),
+           StringifyToUtf8(context.local(), value, 100, v8_str("  ")));
+  CHECK_EQ(std::string("undefined"),
+           StringifyToUtf8(context.local(), v8::Undefined(isolate), 16));
+
+  // Lone surrogates from the gap are replaced by U+FFFD.
+  CHECK_EQ(std::string("[\n\xEF\xBF\xBD" "1\n]"),
+           StringifyToUtf8(context.local(), CompileRun("[1]"), 16,
+                           CompileRun("'\\ud800'").As<String>()));
+
+  // Exceptions are propagated, and nothing is written to the sink.
+  {
+    v8::TryCatch try_catch(isolate);
+    TestUtf8Sink sink(16);
+    value = CompileRun("var cyclic = {}; cyclic.self = cyclic; cyclic");
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), value, &sink).IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK(sink.output().empty());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -21841,6 +22058,87 @@ THREADED_TEST(ObjectNew) {
   }
 }
 
+THREADED_TEST(ObjectNewFastProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> proto = v8::Object::New(isolate);
+  Local<v8::Name> names[3] = {v8_str("x"), v8_str("y"), v8_str("z")};
+  Local<v8::Value> values[3] = {v8_num(1.5), v8_str("two"), v8_num(3)};
+  Local<v8::Object> first =
+      v8::Object::New(isolate, proto, names, values, arraysize(values));
+  Local<v8::Object> second =
+      v8::Object::New(isolate, proto, names, values, arraysize(values));
+  Verify(isolate, first);
+  Verify(isolate, second);
+  auto i_first = v8::Utils::OpenDirectHandle(*first);
+  auto i_second = v8::Utils::OpenDirectHandle(*second);
+  CHECK(i_first->HasFastProperties());
+  CHECK_EQ(i_first->map(), i_second->map());
+  for (uint32_t i = 0; i < arraysize(names); ++i) {
+    CHECK(values[i]->SameValue(
+        first->Get(env.local(), names[i]).ToLocalChecked()));
+  }
+
+  // Duplicate names fall back to dictionary properties.
+  Local<v8::Name> duplicates[2] = {v8_str("x"), v8_str("x")};
+  Local<v8::Object> obj =
+      v8::Object::New(isolate, proto, duplicates, values, 2);
+  Verify(isolate, obj);
+  CHECK(!v8::Utils::OpenDirectHandle(*obj)->HasFastProperties());
+  CHECK(values[1]->SameValue(
+      obj->Get(env.local(), v8_str("x")).ToLocalChecked()));
+}
+
+THREADED_TEST(ObjectGetMany) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj =
+      CompileRun(
+          "var calls = 0;"
+          "var o = Object.create({inherited: 'proto'});"
+          "o.a = 1; o.b = 2.5; o.c = 'c';"
+          "Object.defineProperty(o, 'getter', {"
+          "  get() { calls++; this.d = 'added'; return 'got'; }"
+          "});"
+          "o")
+          .As<v8::Object>();
+  Local<v8::Name> names[7] = {v8_str("a"), v8_str("b"),
+                              v8_str("getter"), v8_str("c"),
+                              v8_str("d"), v8_str("inherited"),
+                              v8_str("missing")};
+  Local<v8::Value> values[7];
+  CHECK(obj->GetMany(env.local(), names, values, arraysize(names)).IsJust());
+  CHECK(v8_num(1)->SameValue(values[0]));
+  CHECK(v8_num(2.5)->SameValue(values[1]));
+  CHECK(v8_str("got")->SameValue(values[2]));
+  CHECK(v8_str("c")->SameValue(values[3]));
+  CHECK(v8_str("added")->SameValue(values[4]));
+  CHECK(v8_str("proto")->SameValue(values[5]));
+  CHECK(values[6]->IsUndefined());
+  CHECK_EQ(1, CompileRun("calls")->Int32Value(env.local()).FromJust());
+
+  // Exceptions thrown by getters are propagated.
+  CompileRun(
+      "Object.defineProperty(o, 'thrower', {"
+      "  get() { throw new Error('boom'); }"
+      "});");
+  v8::TryCatch try_catch(isolate);
+  Local<v8::Name> throwing[2] = {v8_str("a"), v8_str("thrower")};
+  CHECK(obj->GetMany(env.local(), throwing, values, 2).IsNothing());
+  CHECK(try_catch.HasCaught());
+
+  // Proxies and other special receivers take the generic path.
+  Local<v8::Object> proxy =
+      CompileRun("new Proxy(o, {get(t, k) { return k + '!'; }})")
+          .As<v8::Object>();
+  try_catch.Reset();
+  CHECK(proxy->GetMany(env.local(), names, values, 2).IsJust());
+  CHECK(v8_str("a!")->SameValue(values[0]));
+  CHECK(v8_str("b!")->SameValue(values[1]));
+}
+
 TEST(EscapableHandleScope) {
   HandleScope outer_scope(CcTest::isolate());
   LocalContext context;
@@ -812,6 +812,41 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+// With leaf-only samples, only the topmost frame is recorded, so the functions
+// that do the actual work show up directly under the root.
+TEST(CollectCpuProfileLeafOnlySamples) {
+  if (v8_flags.concurrent_sparkplug) return;
+
+  FlagScope<bool> leaf_only(&v8_flags.cpu_profiler_leaf_only_samples, true);
+  v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  // Without inlining, every sample consists of a single JS function.
+  CompileRun(
+      "%NeverOptimizeFunction(loop);\n"
+      "%NeverOptimizeFunction(delay);\n"
+      "%NeverOptimizeFunction(bar);\n"
+      "%NeverOptimizeFunction(baz);\n"
+      "%NeverOptimizeFunction(foo);\n"
+      "%NeverOptimizeFunction(start);\n");
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 1000);
+
+  const v8::CpuProfileNode* root = profile->GetTopDownRoot();
+  GetChild(env.local(), root, "loop");
+  const v8::CpuProfileNode* start_node = FindChild(env.local(), root, "start");
+  if (start_node) CHECK(!FindChild(env.local(), start_node, "foo"));
+
+  profile->Delete();
+}
+
 TEST(CollectCpuProfileCallerLineNumbers) {
   // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
   // since it requires a precise trace.
@@ -4904,6 +4939,54 @@ TEST(CpuProfileJSONSerialization) {
             ->Value() > 0);
 }
 
+TEST(CpuProfileSnapshots) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 200)};
+
+  ProfilerHelper helper(env.local());
+  v8::CpuProfiler* profiler = helper.profiler();
+  profiler->SetSamplingInterval(100);
+  // Continuous profiles don't record individual samples.
+  v8::CpuProfilingResult result =
+      profiler->Start({v8::kLeafNodeLineNumbers, 0});
+  CHECK_EQ(v8::CpuProfilingStatus::kStarted, result.status);
+
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+  v8::CpuProfile* first = profiler->TakeSnapshot(result.id);
+  CHECK(first);
+  CHECK_EQ(0, first->GetSamplesCount());
+  GetChild(env.local(), first->GetTopDownRoot(), "start");
+
+  // The running profile starts over where the snapshot ended.
+  v8::CpuProfile* second = profiler->TakeSnapshot(result.id);
+  CHECK(second);
+  CHECK_EQ(first->GetEndTime(), second->GetStartTime());
+
+  TestJSONStream stream;
+  first->Serialize(&stream, v8::CpuProfile::kPprof);
+  CHECK_EQ(1, stream.eos_signaled());
+  base::ScopedVector<char> pprof(stream.size());
+  stream.WriteTo(pprof);
+  std::string data(pprof.begin(), pprof.length());
+  // The profile starts with the first sample type, and the string table has
+  // the function names.
+  CHECK_EQ(0x0A, data[0]);
+  CHECK_NE(std::string::npos, data.find("samples"));
+  CHECK_NE(std::string::npos, data.find("start"));
+
+  first->Delete();
+  second->Delete();
+  v8::CpuProfile* last = profiler->Stop(result.id);
+  CHECK(last);
+  last->Delete();
+  CHECK_NULL(profiler->TakeSnapshot(result.id));
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
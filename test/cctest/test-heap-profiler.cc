@@ -398,6 +398,35 @@ TEST(HeapSnapshotObjectSizes) {
   CHECK_NE(0, static_cast<int>(x2->GetShallowSize()));
 }
 
+TEST(HeapSnapshotStrongEdgesWithoutNames) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  CompileRun(
+      "function X(a) { this.a = a; }\n"
+      "x = new X(new X(new X()));\n");
+  v8::HeapProfiler::HeapSnapshotOptions options;
+  options.edges_mode = v8::HeapProfiler::EdgesMode::kStrongEdgesWithoutNames;
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot(options);
+  CHECK(snapshot);
+  GetGlobalObject(snapshot);
+  int x_count = 0;
+  for (int i = 0, count = snapshot->GetNodesCount(); i < count; ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    if (!strcmp("X", GetName(node))) ++x_count;
+    for (int j = 0, children = node->GetChildrenCount(); j < children; ++j) {
+      const v8::HeapGraphEdge* edge = node->GetChild(j);
+      CHECK_NE(v8::HeapGraphEdge::kWeak, edge->GetType());
+      if (edge->GetType() != v8::HeapGraphEdge::kElement &&
+          edge->GetType() != v8::HeapGraphEdge::kHidden) {
+        CHECK_EQ(0, strcmp("", GetName(edge)));
+      }
+    }
+  }
+  // The prototype of X may be named after its constructor as well.
+  CHECK_LE(3, x_count);
+}
 
 TEST(BoundFunctionInSnapshot) {
   LocalContext env;
@@ -1250,6 +1279,85 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('binary');");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  v8::internal::TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  v8::base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  int pos = 0;
+  auto read_varint = [&]() {
+    uint64_t result = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos, data.length());
+      uint8_t byte = static_cast<uint8_t>(data[pos++]);
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (byte < 0x80) return result;
+    }
+  };
+  CHECK_EQ(0, memcmp(data.begin(), "V8HS", 4));
+  pos = 4;
+  CHECK_EQ(1u, read_varint());
+  uint64_t node_count = read_varint();
+  uint64_t edge_count = read_varint();
+  uint64_t string_count = read_varint();
+  CHECK_EQ(static_cast<uint64_t>(snapshot->GetNodesCount()), node_count);
+  bool found_string = false;
+  for (uint64_t i = 0; i < string_count; i++) {
+    int length = static_cast<int>(read_varint());
+    if (length == 6 && memcmp(&data[pos], "binary", 6) == 0) {
+      found_string = true;
+    }
+    pos += length;
+  }
+  CHECK(found_string);
+
+  uint64_t total_edge_count = 0;
+  for (int i = 0; i < static_cast<int>(node_count); i++) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    CHECK_EQ(static_cast<uint64_t>(node->GetType()), read_varint());
+    read_varint();  // name
+    CHECK_EQ(static_cast<uint64_t>(node->GetId()), read_varint());
+    CHECK_EQ(node->GetShallowSize(), read_varint());
+    uint64_t children_count = read_varint();
+    CHECK_EQ(static_cast<uint64_t>(node->GetChildrenCount()), children_count);
+    total_edge_count += children_count;
+    read_varint();  // trace_node_id
+    read_varint();  // detachedness
+  }
+  CHECK_EQ(edge_count, total_edge_count);
+  for (uint64_t i = 0; i < edge_count; i++) {
+    CHECK_LE(read_varint(), static_cast<uint64_t>(v8::HeapGraphEdge::kWeak));
+    read_varint();  // name_or_index
+    CHECK_LT(read_varint(), node_count);
+  }
+  uint64_t location_count = read_varint();
+  for (uint64_t i = 0; i < location_count * 4; i++) read_varint();
+  CHECK_EQ(data.length(), pos);
+}
+
+TEST(HeapSnapshotBinarySerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  v8::internal::TestJSONStream stream(5);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
@@ -1666,6 +1666,62 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithKeep) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobWithKeepDiscardsColdBytecode) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  v8_flags.flush_bytecode = true;
+  v8_flags.snapshot_cold_bytecode_age = 2;
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::ScriptOrigin origin(v8_str("test"));
+      v8::ScriptCompiler::Source source(
+          v8_str("function f() { return 1; }\n"
+                 "function g() { return 2; }"),
+          origin);
+      CompileRun(context, &source, v8::ScriptCompiler::kEagerCompile);
+      // Age both functions, then run f so that only g is cold.
+      heap::InvokeMajorGC(i_isolate->heap());
+      heap::InvokeMajorGC(i_isolate->heap());
+      CHECK(IsCompiled("f"));
+      CHECK(IsCompiled("g"));
+      CompileRun("f()");
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+  v8_flags.snapshot_cold_bytecode_age = 0;
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CHECK(IsCompiled("f"));
+      CHECK(!IsCompiled("g"));
+      CHECK_EQ(2, CompileRun("g()")->Int32Value(context).FromJust());
+      CHECK(IsCompiled("g"));
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(CustomSnapshotDataBlobImmortalImmovableRoots) {
   DisableAlwaysOpt();
   // Flood the startup snapshot with shared function infos. If they are
@@ -1881,6 +1937,62 @@ TEST(CodeSerializerOnePlusOneWithBlockCoverage) {
   TestCodeSerializerOnePlusOneImpl();
 }
 
+void TestCodeSerializerCachedTieringDecision(
+    bool in_code_cache, CachedTieringDecision expected_decision) {
+  v8_flags.profile_guided_optimization = true;
+  v8_flags.profile_guided_optimization_in_code_cache = in_code_cache;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "1 + 1";
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptDetails default_script_details;
+  ScriptCompiler::CompilationDetails compilation_details;
+  Handle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kNoCompileOptions,
+          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE,
+          &compilation_details)
+          .ToHandleChecked();
+  orig->set_cached_tiering_decision(CachedTieringDecision::kEarlyMaglev);
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  // Serializing doesn't change the decision of the serialized isolate.
+  CHECK_EQ(orig->cached_tiering_decision(),
+           CachedTieringDecision::kEarlyMaglev);
+
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+  DirectHandle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, default_script_details, &cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+  CHECK_NE(*orig, *copy);
+  CHECK_EQ(copy->cached_tiering_decision(), expected_decision);
+}
+
+TEST(CodeSerializerCachedTieringDecision) {
+  TestCodeSerializerCachedTieringDecision(
+      false, CachedTieringDecision::kEarlySparkplug);
+}
+
+TEST(CodeSerializerCachedTieringDecisionInCodeCache) {
+  TestCodeSerializerCachedTieringDecision(true,
+                                          CachedTieringDecision::kEarlyMaglev);
+}
+
 TEST(CodeSerializerPromotedToCompilationCache) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
@@ -5180,6 +5292,61 @@ UNINITIALIZED_TEST(ReinitializeHashSeedRehashable) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(ReinitializeHashSeedUnchanged) {
+  DisableAlwaysOpt();
+  i::v8_flags.rehash_snapshot = true;
+  i::v8_flags.hash_seed = 42;
+  i::v8_flags.allow_natives_syntax = true;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "var m = new Map();"
+          "m.set('a', 1);"
+          "var o = {};"
+          "%OptimizeObjectForAddingMultipleProperties(o, 3);"
+          "o.a = 1;"
+          "o.b = 2;"
+          "o.c = 3;");
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+    CHECK(blob.CanBeRehashed());
+  }
+
+  // The snapshot was created with the same seed, so the hash tables are used
+  // as they are.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.snapshot_blob = &blob;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    CHECK_EQ(static_cast<uint64_t>(42),
+             HashSeed(reinterpret_cast<i::Isolate*>(isolate)));
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    CHECK(!context.IsEmpty());
+    v8::Context::Scope context_scope(context);
+    i::Handle<i::Object> i_o = v8::Utils::OpenHandle(*CompileRun("o"));
+    CHECK(!i::Cast<i::JSObject>(i_o)->HasFastProperties());
+    ExpectInt32("m.get('a')", 1);
+    ExpectInt32("o.c", 3);
+    ExpectTrue("'Array' in globalThis");
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(ClassFields) {
   DisableAlwaysOpt();
   i::v8_flags.rehash_snapshot = true;
@@ -40,7 +40,9 @@
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -1872,6 +1874,9 @@ TEST(HashArrayIndexStrings) {
   IndexData tests[] = {
     {"", false, 0, false, 0},
     {"123no", false, 0, false, 0},
+    {"1234567x", false, 0, false, 0},
+    {"123456789012345x", false, 0, false, 0},
+    {"2024-01-01", false, 0, false, 0},
     {"12345", true, 12345, true, 12345},
     {"12345678", true, 12345678, true, 12345678},
     {"4294967294", true, 4294967294u, true, 4294967294u},
@@ -1893,6 +1898,32 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashDigitPrefixStrings) {
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(CcTest::isolate());
+  i::Isolate* isolate = CcTest::i_isolate();
+  uint64_t seed = HashSeed(isolate);
+
+  // Strings which start with a digit but aren't indices have a regular hash,
+  // in both representations.
+  const char* tests[] = {"1x",         "12345678a", "123456789012345:",
+                         "2024-01-01", "3f2a9c:",   "9/"};
+  for (const char* test : tests) {
+    int length = static_cast<int>(strlen(test));
+    uint32_t running_hash = static_cast<uint32_t>(seed);
+    for (int i = 0; i < length; i++) {
+      running_hash = StringHasher::AddCharacterCore(running_hash, test[i]);
+    }
+    uint32_t expected = String::CreateHashFieldValue(
+        StringHasher::GetHashCore(running_hash), String::HashFieldType::kHash);
+    CHECK_EQ(expected, StringHasher::HashSequentialString(test, length, seed));
+    std::vector<base::uc16> two_byte(test, test + length);
+    CHECK_EQ(expected,
+             StringHasher::HashSequentialString(two_byte.data(), length, seed));
+  }
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
@@ -755,6 +755,59 @@ STREAM_TEST(TestErrorInCodeSectionDetectedByCompiler) {
   CHECK(tester.IsPromiseRejected());
 }
 
+// Test that lazily compiled functions which are validated in the background
+// still reject the promise if they are invalid, if the end of the stream
+// doesn't wait for their validation.
+STREAM_TEST(TestAsyncStreamingValidation) {
+  FlagScope<bool> lazy_compilation(&v8_flags.wasm_lazy_compilation, true);
+  FlagScope<bool> async_streaming_validation(
+      &v8_flags.wasm_async_streaming_validation, true);
+
+  uint8_t code[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprLocalGet, 0, kExprEnd  // body
+  };
+
+  uint8_t invalid_code[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprI64Const, 0, kExprEnd  // body
+  };
+
+  const uint8_t bytes[] = {
+      WASM_MODULE_HEADER,                 // module header
+      kTypeSectionCode,                   // section code
+      U32V_1(1 + SIZEOF_SIG_ENTRY_x_x),   // section size
+      U32V_1(1),                          // type count
+      SIG_ENTRY_x_x(kI32Code, kI32Code),  // signature entry
+      kFunctionSectionCode,               // section code
+      U32V_1(1 + 2),                      // section size
+      U32V_1(2),                          // functions count
+      0,                                  // signature index
+      0,                                  // signature index
+      kCodeSectionCode,                   // section code
+      U32V_1(1 + arraysize(code) * 2),    // section size
+      U32V_1(2),                          // functions count
+  };
+
+  for (bool valid : {true, false}) {
+    StreamTester tester(isolate);
+    tester.OnBytesReceived(bytes, arraysize(bytes));
+    tester.OnBytesReceived(code, arraysize(code));
+    if (valid) {
+      tester.OnBytesReceived(code, arraysize(code));
+    } else {
+      tester.OnBytesReceived(invalid_code, arraysize(invalid_code));
+    }
+    tester.FinishStream();
+    tester.RunCompilerTasks();
+
+    CHECK_EQ(valid, tester.IsPromiseFulfilled());
+    CHECK_EQ(!valid, tester.IsPromiseRejected());
+  }
+}
+
 // Test Abort before any bytes arrive.
 STREAM_TEST(TestAbortImmediately) {
   StreamTester tester(isolate);
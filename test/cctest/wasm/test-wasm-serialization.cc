@@ -71,6 +71,11 @@ class WasmSerializationTest {
                          serialized_bytes_.size() - 1};
   }
 
+  void TruncateSerializedData() {
+    serialized_bytes_ = {serialized_bytes_.data(),
+                         serialized_bytes_.size() / 2};
+  }
+
   MaybeHandle<WasmModuleObject> Deserialize(
       base::Vector<const char> source_url = {}) {
     return DeserializeNativeModule(
@@ -264,6 +269,21 @@ TEST(DeserializeWireBytesAndSerializedDataInvalid) {
   test.CollectGarbage();
 }
 
+TEST(DeserializeTruncatedData) {
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    test.TruncateSerializedData();
+    {
+      FlagScope<bool> partial_deserialization(
+          &v8_flags.wasm_partial_deserialization, true);
+      // The functions whose code was cut off are compiled lazily.
+      test.DeserializeAndRun();
+    }
+  }
+  test.CollectGarbage();
+}
+
 bool False(v8::Local<v8::Context> context, v8::Local<v8::String> source) {
   return false;
 }
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turbofan --no-always-turbofan --turbo-inlining
+// Flags: --breakpoint-entry-checks
+
+var Debug = debug.Debug;
+var break_count = 0;
+
+function f1() {
+  return 1;
+}
+
+function f2() {
+  return f1() + 1;
+}
+
+function f3() {
+  return 3;
+}
+
+function optimize(f) {
+  %PrepareFunctionForOptimization(f);
+  f();
+  f();
+  %OptimizeFunctionOnNextCall(f);
+  f();
+}
+
+optimize(f1);
+optimize(f2);
+optimize(f3);
+
+Debug.setListener(function(event) {
+  if (event == Debug.DebugEvent.Break) break_count++;
+});
+
+Debug.setBreakPoint(f1, 1);
+
+// Setting the break point does not deoptimize anything by itself.
+assertOptimized(f1);
+assertOptimized(f2);
+assertOptimized(f3);
+
+// Entering f1 inlined into f2 deoptimizes f2 and hits the break point.
+assertEquals(2, f2());
+assertEquals(1, break_count);
+assertUnoptimized(f2);
+
+assertEquals(1, f1());
+assertEquals(2, break_count);
+assertUnoptimized(f1);
+
+assertEquals(3, f3());
+assertOptimized(f3);
+
+Debug.setListener(null);
@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Collators with sensitivity "base" or "accent" compare ASCII strings without
+// calling into ICU, ignoring case differences. Check that the results agree
+// with the expected ICU order, including the strings that have to leave the
+// fast path.
+
+function sign(x) {
+  return x < 0 ? -1 : (x > 0 ? 1 : 0);
+}
+
+(function TestBase() {
+  for (const locale of ['en', 'en-US', 'de']) {
+    for (const sensitivity of ['base', 'accent']) {
+      const compare = new Intl.Collator(locale, {sensitivity}).compare;
+      assertEquals(0, compare('abc', 'ABC'));
+      assertEquals(0, compare('Hello World', 'hello world'));
+      assertEquals(-1, sign(compare('abc', 'abd')));
+      assertEquals(-1, sign(compare('ABC', 'abd')));
+      assertEquals(1, sign(compare('abcd', 'ABC')));
+      assertEquals(-1, sign(compare('a-b', 'ab')));
+      assertEquals(1, sign(compare('b', 'A1')));
+      assertEquals(0, compare('', ''));
+    }
+  }
+})();
+
+(function TestAccents() {
+  const base = new Intl.Collator('en', {sensitivity: 'base'}).compare;
+  const accent = new Intl.Collator('en', {sensitivity: 'accent'}).compare;
+  assertEquals(0, base('resume', 'Résumé'));
+  assertEquals(0, base('resume', 'Résumé'));
+  assertEquals(-1, sign(accent('resume', 'Résumé')));
+  assertEquals(-1, sign(accent('resume', 'Résumé')));
+  assertEquals(0, accent('Résumé', 'Résumé'));
+  assertEquals(0, base('a', 'a\u0001'));
+})();
+
+(function TestOtherSensitivities() {
+  const variant = new Intl.Collator('en', {sensitivity: 'variant'}).compare;
+  const kase = new Intl.Collator('en', {sensitivity: 'case'}).compare;
+  assertEquals(-1, sign(variant('abc', 'ABC')));
+  assertEquals(-1, sign(kase('abc', 'ABC')));
+  assertEquals(0, kase('abc', 'abc'));
+
+  const upper_first =
+      new Intl.Collator('en', {sensitivity: 'base', caseFirst: 'upper'});
+  assertEquals(0, upper_first.compare('abc', 'ABC'));
+  const numeric =
+      new Intl.Collator('en', {sensitivity: 'base', numeric: true});
+  assertEquals(-1, sign(numeric.compare('A2', 'a10')));
+  const ignore_punctuation =
+      new Intl.Collator('en', {sensitivity: 'base', ignorePunctuation: true});
+  assertEquals(0, ignore_punctuation.compare('a-b', 'AB'));
+})();
+
+(function TestSort() {
+  const words = ['banana', 'Apple', 'cherry', 'apple', 'Banana', 'date',
+                 'Cherry', 'apple pie', 'apple-pie', 'Date1', 'date0'];
+  const compare = new Intl.Collator('en', {sensitivity: 'base'}).compare;
+  const sorted = words.slice().sort(compare);
+  for (let i = 1; i < sorted.length; i++) {
+    assertTrue(compare(sorted[i - 1], sorted[i]) <= 0);
+    assertEquals(sign(compare(sorted[i - 1], sorted[i])),
+                 sign(sorted[i - 1].localeCompare(
+                     sorted[i], 'en', {sensitivity: 'base'})));
+  }
+  assertEquals(0, 'Apple'.localeCompare('apple', 'en', {sensitivity: 'base'}));
+})();
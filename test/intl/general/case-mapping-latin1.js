@@ -0,0 +1,69 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Case conversion of long one-byte strings is done 16 characters at a time.
+// Check every Latin-1 character at every position of such a string.
+
+function lower(c) {
+  if ((c >= 0x41 && c <= 0x5A) || (c >= 0xC0 && c <= 0xDE && c != 0xD7)) {
+    return c + 0x20;
+  }
+  return c;
+}
+
+function upper(c) {
+  if ((c >= 0x61 && c <= 0x7A) || (c >= 0xE0 && c <= 0xFE && c != 0xF7)) {
+    return c - 0x20;
+  }
+  if (c == 0xB5) return 0x39C;
+  if (c == 0xFF) return 0x178;
+  return c;
+}
+
+function expectedUpper(s) {
+  let result = '';
+  for (let i = 0; i < s.length; i++) {
+    const c = s.charCodeAt(i);
+    result += c == 0xDF ? 'SS' : String.fromCharCode(upper(c));
+  }
+  return result;
+}
+
+const base = 'The Quick Brown Fox Jumps Over The Lazy Dog 0123456789';
+
+(function TestAscii() {
+  assertEquals(base.replace(/[A-Z]/g, c => c.toLowerCase()),
+               base.toLowerCase());
+  assertEquals(base.replace(/[a-z]/g, c => c.toUpperCase()),
+               base.toUpperCase());
+  const lower_only = 'already lower case, no change needed here';
+  assertSame(lower_only, lower_only.toLowerCase());
+})();
+
+(function TestLatin1() {
+  for (let c = 0x80; c <= 0xFF; c++) {
+    for (const position of [0, 15, 16, 17, 31, 40, base.length - 1]) {
+      const s = base.substring(0, position) + String.fromCharCode(c) +
+          base.substring(position);
+      assertEquals(
+          base.substring(0, position).toLowerCase() +
+              String.fromCharCode(lower(c)) +
+              base.substring(position).toLowerCase(),
+          s.toLowerCase());
+      assertEquals(expectedUpper(s), s.toUpperCase());
+    }
+  }
+})();
+
+(function TestAllLatin1() {
+  let s = '';
+  for (let c = 0; c <= 0xFF; c++) s += String.fromCharCode(c);
+  let expected_lower = '';
+  for (let c = 0; c <= 0xFF; c++) {
+    expected_lower += String.fromCharCode(lower(c));
+  }
+  assertEquals(expected_lower, s.toLowerCase());
+  assertEquals(expectedUpper(s), s.toUpperCase());
+  assertEquals(expectedUpper(s.repeat(3)), s.repeat(3).toUpperCase());
+})();
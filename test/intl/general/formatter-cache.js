@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --intl-formatter-cache-size=3
+
+// ICU formatters are shared between Intl objects created with the same
+// resolved locale and options. Create the objects for many settings in
+// varying order, with a cache which is smaller than the number of settings,
+// and check that each object formats according to its own settings.
+
+const settings = [
+  ['Collator', 'de', {}, c => ['a', 'Z', 'ä', '10', '9'].sort(c.compare)],
+  ['Collator', 'de', {numeric: true},
+   c => ['a', 'Z', 'ä', '10', '9'].sort(c.compare)],
+  ['Collator', 'de-u-kn', {},
+   c => ['a', 'Z', 'ä', '10', '9'].sort(c.compare)],
+  ['Collator', 'de', {caseFirst: 'upper'},
+   c => ['a', 'A', 'b', 'B'].sort(c.compare)],
+  ['Collator', 'de', {sensitivity: 'base'}, c => c.compare('a', 'Ä')],
+  ['Collator', 'de', {usage: 'search', sensitivity: 'base'},
+   c => c.compare('a', 'Ä')],
+  ['Collator', 'en', {ignorePunctuation: true}, c => c.compare('a-b', 'ab')],
+  ['NumberFormat', 'en', {}, f => f.format(1234.5678)],
+  ['NumberFormat', 'de', {}, f => f.format(1234.5678)],
+  ['NumberFormat', 'en', {maximumFractionDigits: 1}, f => f.format(1234.5678)],
+  ['NumberFormat', 'en', {style: 'currency', currency: 'EUR'},
+   f => f.format(1234.5678)],
+  ['NumberFormat', 'en', {style: 'percent'}, f => f.format(0.256)],
+  ['NumberFormat', 'en-u-nu-arab', {}, f => f.format(1234.5678)],
+  ['PluralRules', 'en', {}, p => [0, 1, 2, 1.5].map(n => p.select(n))],
+  ['PluralRules', 'en', {type: 'ordinal'},
+   p => [1, 2, 3, 4, 11].map(n => p.select(n))],
+  ['PluralRules', 'en', {minimumFractionDigits: 1},
+   p => [0, 1, 2].map(n => p.select(n))],
+  ['DateTimeFormat', 'en', {timeZone: 'UTC'}, f => f.format(0)],
+  ['DateTimeFormat', 'en', {timeZone: 'Asia/Tokyo'}, f => f.format(0)],
+  ['DateTimeFormat', 'de', {timeZone: 'UTC'}, f => f.format(0)],
+  ['DateTimeFormat', 'en', {timeZone: 'UTC', dateStyle: 'full'},
+   f => f.format(0)],
+  ['DateTimeFormat', 'en', {timeZone: 'UTC', timeStyle: 'short'},
+   f => f.format(0)],
+  ['DateTimeFormat', 'en',
+   {timeZone: 'UTC', timeStyle: 'short', hourCycle: 'h23'}, f => f.format(0)],
+  ['DateTimeFormat', 'en', {timeZone: 'UTC', hour: 'numeric'},
+   f => f.format(0)],
+  ['DateTimeFormat', 'en', {timeZone: 'UTC', hour: 'numeric', hour12: false},
+   f => f.format(0)],
+  ['DateTimeFormat', 'ja-u-ca-japanese', {timeZone: 'UTC', year: 'numeric'},
+   f => f.format(0)],
+];
+
+function check(index) {
+  const [type, locale, options, use] = settings[index];
+  const object = new Intl[type](locale, options);
+  return JSON.stringify([object.resolvedOptions(), use(object)]);
+}
+
+const expected = settings.map((_, i) => check(i));
+// The settings differ from each other.
+assertEquals(expected.length, new Set(expected).size);
+
+for (let round = 0; round < 5; round++) {
+  for (let i = 0; i < settings.length; i++) {
+    const index = (i * 7 + round) % settings.length;
+    assertEquals(expected[index], check(index));
+    assertEquals(expected[index], check(index));
+  }
+}
+
+// toLocaleString with options goes through the constructors too.
+for (let i = 0; i < 3; i++) {
+  assertEquals('1.234,568', (1234.5678).toLocaleString('de'));
+  assertEquals('1,234.6',
+               (1234.5678).toLocaleString('en', {maximumFractionDigits: 1}));
+  assertEquals('1/1/1970',
+               new Date(0).toLocaleDateString('en', {timeZone: 'UTC'}));
+  assertEquals('01.01.1970',
+               new Date(0).toLocaleDateString('de', {
+                 timeZone: 'UTC', day: '2-digit', month: '2-digit',
+                 year: 'numeric'}));
+}
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Copies of large fast arrays share the elements copy-on-write. The "Keep"
+// benchmarks retain many copies, like immutable state updates do, and are
+// dominated by allocation and GC when the elements are copied eagerly. The
+// "Write" benchmarks mutate the source after every copy, which has to copy
+// the shared elements.
+(() => {
+
+const kArraySize = 10000;
+const kKeptCopies = 100;
+
+const A = [];
+for (let i = 0; i < kArraySize; i++) A.push(`value ${i}`);
+assert(%HasObjectElements(A), "A should have object elements for this test");
+
+let copies = [];
+function Keep(copy) {
+  if (copies.length == kKeptCopies) copies = [];
+  copies.push(copy);
+}
+
+function TearDown() {
+  copies = [];
+}
+
+function SliceKeep() {
+  Keep(A.slice());
+}
+
+function SpreadKeep() {
+  Keep([...A]);
+}
+
+function ArrayFromKeep() {
+  Keep(Array.from(A));
+}
+
+function SliceWrite() {
+  const copy = A.slice();
+  A[0] = copy[1];
+}
+
+function SpreadWrite() {
+  const copy = [...A];
+  A[0] = copy[1];
+}
+
+createSuiteWithWarmup('CopyOnWrite-SliceKeep', 1, SliceKeep, null, TearDown);
+createSuiteWithWarmup('CopyOnWrite-SpreadKeep', 1, SpreadKeep, null, TearDown);
+createSuiteWithWarmup(
+    'CopyOnWrite-ArrayFromKeep', 1, ArrayFromKeep, null, TearDown);
+createSuiteWithWarmup('CopyOnWrite-SliceWrite', 1, SliceWrite);
+createSuiteWithWarmup('CopyOnWrite-SpreadWrite', 1, SpreadWrite);
+
+})();
@@ -19,6 +19,9 @@ createSuite('StringCopyWithin', 1000, CopyWithin, StringCopyWithinSetup);
 createSuite('SparseSmiCopyWithin', 1000, CopyWithin, SparseSmiCopyWithinSetup);
 createSuite(
     'SparseStringCopyWithin', 1000, CopyWithin, SparseStringCopyWithinSetup);
+createSuite('DoubleCopyWithin', 1000, CopyWithin, DoubleCopyWithinSetup);
+createSuite(
+    'HoleyDoubleCopyWithin', 1000, CopyWithin, HoleyDoubleCopyWithinSetup);
 
 function SmiCopyWithinSetup() {
   array = [];
@@ -30,6 +33,16 @@ function StringCopyWithinSetup() {
   for (let i = 0; i < kArraySize; ++i) array[i] = `Item no. ${i}`;
 }
 
+function DoubleCopyWithinSetup() {
+  array = [];
+  for (let i = 0; i < kArraySize; ++i) array[i] = i + 0.5;
+}
+
+function HoleyDoubleCopyWithinSetup() {
+  DoubleCopyWithinSetup();
+  delete array[kQuarterSize * 2 + 1];
+}
+
 function SparseSmiCopyWithinSetup() {
   array = [];
   for (let i = 0; i < kArraySize; i += 10) array[i] = i;
@@ -140,6 +140,7 @@ d8.file.execute('of.js');
 d8.file.execute('join.js');
 d8.file.execute('to-string.js');
 d8.file.execute('slice.js');
+d8.file.execute('copy-on-write.js');
 d8.file.execute('copy-within.js');
 d8.file.execute('at.js');
 
@@ -0,0 +1,48 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Formatting of log timestamps in local time. The timestamps are a few
+// seconds apart, with an occasional one from a different year, so that most
+// timezone offset lookups hit the cached transitions.
+
+const kTimestamps = (() => {
+  const timestamps = [];
+  let time = Date.UTC(2023, 2, 20);
+  for (let i = 0; i < 1000; i++) {
+    time += (i * 7919) % 30000;
+    timestamps.push(i % 100 == 0 ? time - 3e11 : time);
+  }
+  return timestamps;
+})();
+
+function LogTimestampToString() {
+  let length = 0;
+  for (const timestamp of kTimestamps) {
+    length += new Date(timestamp).toString().length;
+  }
+  return length;
+}
+createSuite('LogTimestampToString', 1000, LogTimestampToString, () => {});
+
+function LogTimestampFields() {
+  let result = '';
+  for (const timestamp of kTimestamps) {
+    const date = new Date(timestamp);
+    result = date.getFullYear() + '-' + (date.getMonth() + 1) + '-' +
+        date.getDate() + ' ' + date.getHours() + ':' + date.getMinutes() +
+        ':' + date.getSeconds();
+  }
+  return result;
+}
+createSuite('LogTimestampFields', 1000, LogTimestampFields, () => {});
+
+function LogTimestampFromLocalFields() {
+  let sum = 0;
+  for (let i = 0; i < kTimestamps.length; i++) {
+    sum += new Date(2023, 2, 20 + (i >> 6), i % 24, i % 60, i % 59).getTime();
+  }
+  return sum;
+}
+createSuite('LogTimestampFromLocalFields', 1000, LogTimestampFromLocalFields,
+            () => {});
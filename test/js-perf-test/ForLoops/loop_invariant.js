@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Invariant-Arithmetic', [1000], [
+  new Benchmark('Invariant-Arithmetic', false, false, 0, InvariantArithmetic),
+]);
+
+new BenchmarkSuite('Invariant-Length', [1000], [
+  new Benchmark('Invariant-Length', false, false, 0, InvariantLength),
+]);
+
+var values = [];
+for (var i = 0; i < 1000; i++) values.push(i * 0.5);
+var scale = 3;
+var offset = 7;
+
+// The scale and offset computations are the same on every iteration.
+function InvariantArithmetic() {
+  "use strict";
+  let sum = 0;
+  const a = scale, b = offset;
+  for (let i = 0; i < values.length; i++) {
+    sum += values[i] * (a * b + 1) + (a << 4);
+  }
+  return sum;
+}
+
+// The loop only reads memory, so the length of {values} can be loaded once.
+function InvariantLength() {
+  "use strict";
+  let max = 0;
+  for (let i = 0; i < values.length; i++) {
+    if (values[i] > max) max = values[i];
+  }
+  return max;
+}
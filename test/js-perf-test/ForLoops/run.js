@@ -4,6 +4,7 @@
 
 d8.file.execute('../base.js');
 d8.file.execute('for_loop.js');
+d8.file.execute('loop_invariant.js');
 
 var success = true;
 
@@ -0,0 +1,78 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Loops whose bodies are long chains of loads and arithmetic, where the order
+// of the instructions decides whether the core stalls on the loads. Compare
+// the "default" and "scheduling" variants to see the effect of
+// --turbo-instruction-scheduling.
+
+new BenchmarkSuite('DotProduct', [1000], [
+  new Benchmark('DotProduct', false, false, 0, DotProduct),
+]);
+
+new BenchmarkSuite('Polynomial', [1000], [
+  new Benchmark('Polynomial', false, false, 0, Polynomial),
+]);
+
+new BenchmarkSuite('Gather', [1000], [
+  new Benchmark('Gather', false, false, 0, Gather),
+]);
+
+new BenchmarkSuite('HashMix', [1000], [
+  new Benchmark('HashMix', false, false, 0, HashMix),
+]);
+
+const kLength = 4096;
+const a = new Float64Array(kLength);
+const b = new Float64Array(kLength);
+const indices = new Int32Array(kLength);
+const words = new Int32Array(kLength);
+for (let i = 0; i < kLength; i++) {
+  a[i] = i * 0.25;
+  b[i] = (kLength - i) * 0.5;
+  indices[i] = (i * 2654435761) & (kLength - 1);
+  words[i] = i * 0x9e3779b1;
+}
+
+// Independent loads feeding a multiply-add.
+function DotProduct() {
+  let sum = 0;
+  for (let i = 0; i < kLength; i += 4) {
+    sum += a[i] * b[i] + a[i + 1] * b[i + 1] + a[i + 2] * b[i + 2] +
+           a[i + 3] * b[i + 3];
+  }
+  return sum;
+}
+
+// Loads that are only used at the end of a long chain of multiplications.
+function Polynomial() {
+  let sum = 0;
+  for (let i = 0; i < kLength; i++) {
+    const x = a[i];
+    const y = b[i];
+    sum += ((((x * 1.5 + 2.5) * x + 3.5) * x + 4.5) * x + y);
+  }
+  return sum;
+}
+
+// Dependent loads, where the index of the second load comes from the first.
+function Gather() {
+  let sum = 0;
+  for (let i = 0; i < kLength; i++) {
+    sum += a[indices[i]] + b[indices[(i + 1) & (kLength - 1)]];
+  }
+  return sum;
+}
+
+// Integer arithmetic with loads from two independent streams.
+function HashMix() {
+  let h = 0;
+  for (let i = 0; i < kLength; i += 2) {
+    const x = words[i];
+    const y = words[i + 1];
+    h = Math.imul(h ^ x, 0x85ebca6b) + (y >>> 13);
+    h = Math.imul(h ^ (h >>> 16), 0xc2b2ae35) | 0;
+  }
+  return h;
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse of small and large payloads, with long strings and with
+// indentation, which exercise the string and whitespace scanning.
+
+function CreateBenchmark(name, payload) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, () => JSON.parse(payload)),
+  ]);
+}
+
+function Record(i) {
+  return {
+    id: i,
+    name: `user${i}`,
+    email: `user${i}@example.com`,
+    active: i % 2 == 0,
+    description: 'Lorem ipsum dolor sit amet, consectetur adipiscing elit, ' +
+        'sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.',
+    tags: ['alpha', 'beta', 'gamma'],
+    escaped: 'line\nbreak and "quotes"',
+  };
+}
+
+function Records(count) {
+  const records = [];
+  for (let i = 0; i < count; i++) records.push(Record(i));
+  return records;
+}
+
+const kSmall = JSON.stringify(Record(0));
+const kLarge = JSON.stringify(Records(10000));
+const kLargeIndented = JSON.stringify(Records(10000), null, 2);
+const kLargeTwoByte =
+    JSON.stringify(Records(10000).map(r => ({...r, name: `世${r.name}`})));
+
+CreateBenchmark('Small', kSmall);
+CreateBenchmark('Large', kLarge);
+CreateBenchmark('LargeIndented', kLargeIndented);
+CreateBenchmark('LargeTwoByte', kLargeTwoByte);
@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify of log-like records with long messages, which exercises the
+// escape scanning of strings, and of objects in dictionary mode.
+
+function CreateBenchmark(name, value) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, () => JSON.stringify(value)),
+  ]);
+}
+
+function LogRecord(i, prefix) {
+  return {
+    timestamp: 1700000000000 + i,
+    level: i % 10 == 0 ? 'warning' : 'info',
+    message: `${prefix}Request ${i} handled by worker ${i % 16} after ` +
+        'waiting in the queue; upstream responded with status 200 and a ' +
+        'payload of the expected size.',
+    path: `/api/v1/items/${i}?expand=true`,
+    quoted: 'a "quoted" value\tand a tab',
+  };
+}
+
+function DictionaryRecord(i) {
+  // Deleting a property other than the last one normalizes the object.
+  const record = LogRecord(i, '');
+  const path = record.path;
+  delete record.path;
+  record.path = path;
+  return record;
+}
+
+function Records(count, create) {
+  const records = [];
+  for (let i = 0; i < count; i++) records.push(create(i));
+  return records;
+}
+
+CreateBenchmark('StringifyLog', Records(10000, i => LogRecord(i, '')));
+CreateBenchmark('StringifyLogTwoByte', Records(10000, i => LogRecord(i, '世')));
+CreateBenchmark('StringifyDictionary', Records(10000, DictionaryRecord));
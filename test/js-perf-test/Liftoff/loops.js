@@ -0,0 +1,86 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compile time and performance of Liftoff code for loops which keep their
+// locals busy. Compare the "default" and "loop_register_locals" variants to
+// see the cost and the effect of keeping locals in registers across loop back
+// edges (--liftoff-loop-register-locals).
+//
+// The wasm module builder is not available for performance tests, so the
+// module is encoded by hand.
+
+new BenchmarkSuite('Compile', [1000], [
+  new Benchmark('Compile', false, false, 0, Compile),
+]);
+
+new BenchmarkSuite('Run', [1000], [
+  new Benchmark('Run', false, false, 0, Run),
+]);
+
+const kNumFunctions = 200;
+
+function U32(value) {
+  const bytes = [];
+  do {
+    let byte = value & 0x7f;
+    value >>>= 7;
+    if (value != 0) byte |= 0x80;
+    bytes.push(byte);
+  } while (value != 0);
+  return bytes;
+}
+
+function Section(id, contents) {
+  return [id, ...U32(contents.length), ...contents];
+}
+
+// (func (param $n i32) (result i32) (local $a $b $c $d $i i32) ...)
+// A loop with an if/else diamond, which updates all of its locals.
+const kBody = [
+  1, 5, 0x7f,                    // 5 locals of type i32
+  0x20, 0, 0x21, 1,              // a = n
+  0x20, 0, 0x41, 3, 0x6c, 0x21, 2,  // b = n * 3
+  0x03, 0x40,                    // loop
+    0x20, 1, 0x20, 2, 0x6a, 0x21, 1,  // a += b
+    0x20, 1, 0x41, 1, 0x71,      // if (a & 1)
+    0x04, 0x40,
+      0x20, 3, 0x20, 1, 0x73, 0x21, 3,  // c ^= a
+    0x05,                        // else
+      0x20, 4, 0x20, 2, 0x6b, 0x21, 4,  // d -= b
+    0x0b,
+    0x20, 2, 0x41, 1, 0x6a, 0x21, 2,  // b += 1
+    0x20, 5, 0x41, 1, 0x6a, 0x22, 5,  // i += 1
+    0x20, 0, 0x48, 0x0d, 0,      // br_if (i < n) loop
+  0x0b,
+  0x20, 1, 0x20, 3, 0x73, 0x20, 4, 0x6a,  // (a ^ c) + d
+  0x0b,
+];
+
+const kModuleBytes = (() => {
+  const types = [1, 0x60, 1, 0x7f, 1, 0x7f];
+  const functions = [...U32(kNumFunctions)];
+  const code = [...U32(kNumFunctions)];
+  for (let i = 0; i < kNumFunctions; i++) {
+    functions.push(0);
+    code.push(...U32(kBody.length), ...kBody);
+  }
+  const exports = [1, 4, ...[...'loop'].map(c => c.charCodeAt(0)), 0, 0];
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...Section(1, types),
+    ...Section(3, functions),
+    ...Section(7, exports),
+    ...Section(10, code),
+  ]);
+})();
+
+function Compile() {
+  return new WebAssembly.Module(kModuleBytes);
+}
+
+const loop = new WebAssembly.Instance(Compile()).exports.loop;
+
+function Run() {
+  return loop(10000);
+}
@@ -0,0 +1,111 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Deterministic generators for large, real-world shaped subjects. They use a
+// fixed-seed PRNG so that every run matches the same text.
+
+function CorpusRandom(seed) {
+  let state = seed;
+  return function() {
+    state = (state * 1103515245 + 12345) & 0x7fffffff;
+    return state;
+  };
+}
+
+function CorpusPick(random, items) {
+  return items[random() % items.length];
+}
+
+const kUserAgents = [
+  'Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 ' +
+      '(KHTML, like Gecko) Chrome/124.0.6367.91 Safari/537.36',
+  'Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15 ' +
+      '(KHTML, like Gecko) Version/17.4.1 Safari/605.1.15',
+  'Mozilla/5.0 (X11; Linux x86_64; rv:125.0) Gecko/20100101 Firefox/125.0',
+  'Mozilla/5.0 (iPhone; CPU iPhone OS 17_4_1 like Mac OS X) ' +
+      'AppleWebKit/605.1.15 (KHTML, like Gecko) CriOS/124.0.6367.88 ' +
+      'Mobile/15E148 Safari/604.1',
+  'Mozilla/5.0 (Linux; Android 14; Pixel 8) AppleWebKit/537.36 ' +
+      '(KHTML, like Gecko) Chrome/124.0.6367.82 Mobile Safari/537.36',
+  'Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 ' +
+      '(KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36 Edg/124.0.2478.67',
+  'Googlebot/2.1 (+http://www.google.com/bot.html)',
+  'curl/8.5.0',
+];
+
+const kPaths = [
+  '/', '/index.html', '/api/v1/users/42', '/api/v2/users/alice/posts/1337',
+  '/static/js/app.3f9a1c.js', '/static/css/main.css', '/search?q=v8+regexp',
+  '/api/v1/orders/98765/items', '/favicon.ico', '/blog/2024/05/tiering-up',
+];
+
+// Lines in the Apache combined log format.
+function CreateAccessLog(lineCount) {
+  const random = CorpusRandom(17);
+  const methods = ['GET', 'GET', 'GET', 'POST', 'PUT', 'DELETE'];
+  const statuses = ['200', '200', '200', '304', '404', '500'];
+  const lines = [];
+  for (let i = 0; i < lineCount; i++) {
+    const ip = `${random() % 256}.${random() % 256}.${random() % 256}.` +
+        `${random() % 256}`;
+    const day = String(1 + random() % 28).padStart(2, '0');
+    const time = [random() % 24, random() % 60, random() % 60]
+        .map(n => String(n).padStart(2, '0')).join(':');
+    lines.push(
+        `${ip} - user${random() % 100} [${day}/May/2024:${time} +0000] ` +
+        `"${CorpusPick(random, methods)} ${CorpusPick(random, kPaths)} ` +
+        `HTTP/1.1" ${CorpusPick(random, statuses)} ${random() % 50000} ` +
+        `"https://example.com/" "${CorpusPick(random, kUserAgents)}"`);
+  }
+  return lines;
+}
+
+// Structured application logs with ISO timestamps and key=value pairs.
+function CreateApplicationLog(lineCount) {
+  const random = CorpusRandom(23);
+  const levels = ['DEBUG', 'INFO', 'INFO', 'INFO', 'WARN', 'ERROR'];
+  const lines = [];
+  for (let i = 0; i < lineCount; i++) {
+    const ms = String(random() % 1000).padStart(3, '0');
+    const second = String(random() % 60).padStart(2, '0');
+    lines.push(
+        `2024-05-14T12:34:${second}.${ms}Z ${CorpusPick(random, levels)} ` +
+        `[worker-${random() % 16}] request_id=${random().toString(16)} ` +
+        `path=${CorpusPick(random, kPaths)} duration_ms=${random() % 2000} ` +
+        `user="user${random() % 1000}@example.com"`);
+  }
+  return lines.join('\n');
+}
+
+function CreateMarkdownDocument(sectionCount) {
+  const random = CorpusRandom(31);
+  const words = ['regexp', 'engine', 'tier', 'bytecode', 'native', 'string',
+                 'subject', 'match', 'capture', 'backtrack', 'the', 'a', 'of',
+                 'and', 'with', 'for'];
+  function sentence() {
+    const length = 6 + random() % 12;
+    const result = [];
+    for (let i = 0; i < length; i++) {
+      let word = CorpusPick(random, words);
+      switch (random() % 12) {
+        case 0: word = `**${word}**`; break;
+        case 1: word = `_${word}_`; break;
+        case 2: word = `\`${word}\``; break;
+        case 3: word = `[${word}](https://v8.dev/${word})`; break;
+      }
+      result.push(word);
+    }
+    return result.join(' ') + '.';
+  }
+  const sections = [];
+  for (let i = 0; i < sectionCount; i++) {
+    const section = [`${'#'.repeat(1 + i % 3)} Section ${i}`, ''];
+    for (let j = 0; j < 3; j++) section.push(sentence() + ' ' + sentence());
+    section.push('');
+    for (let j = 0; j < 4; j++) section.push(`- ${sentence()}`);
+    section.push('', '```js', 'const re = /a+b/;', '```', '');
+    sections.push(section.join('\n'));
+  }
+  return sections.join('\n');
+}
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const kAccessLogPattern =
+    /^(\S+) \S+ (\S+) \[([^\]]+)\] "([A-Z]+) ([^ "]+) HTTP\/[\d.]+" (\d{3}) (\d+|-) "([^"]*)" "([^"]*)"$/;
+const kTimestampPattern =
+    /(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.(\d+))?(Z|[+-]\d{2}:\d{2})/g;
+const kKeyValuePattern = /(\w+)=("[^"]*"|\S+)/g;
+const kErrorLinePattern = /^.*\b(?:ERROR|WARN)\b.*$/gm;
+
+let accessLog;
+let applicationLog;
+
+function SetupLogs() {
+  accessLog = CreateAccessLog(2000);
+  applicationLog = CreateApplicationLog(2000);
+}
+
+function AccessLogParse() {
+  let bytes = 0;
+  for (const line of accessLog) {
+    const match = kAccessLogPattern.exec(line);
+    if (match === null) throw new Error('unparsed line: ' + line);
+    if (match[7] !== '-') bytes += Number(match[7]);
+  }
+  return bytes;
+}
+
+function ApplicationLogTimestamps() {
+  let count = 0;
+  kTimestampPattern.lastIndex = 0;
+  while (kTimestampPattern.exec(applicationLog) !== null) count++;
+  return count;
+}
+
+function ApplicationLogKeyValues() {
+  let count = 0;
+  for (const match of applicationLog.matchAll(kKeyValuePattern)) {
+    if (match[1] === 'duration_ms') count += Number(match[2]);
+  }
+  return count;
+}
+
+function ApplicationLogErrors() {
+  return applicationLog.match(kErrorLinePattern).length;
+}
+
+new BenchmarkSuite('AccessLogParse', [1000], [
+  new Benchmark('AccessLogParse', false, false, 0, AccessLogParse,
+                SetupLogs),
+]);
+
+new BenchmarkSuite('ApplicationLogTimestamps', [1000], [
+  new Benchmark('ApplicationLogTimestamps', false, false, 0,
+                ApplicationLogTimestamps, SetupLogs),
+]);
+
+new BenchmarkSuite('ApplicationLogKeyValues', [1000], [
+  new Benchmark('ApplicationLogKeyValues', false, false, 0,
+                ApplicationLogKeyValues, SetupLogs),
+]);
+
+new BenchmarkSuite('ApplicationLogErrors', [1000], [
+  new Benchmark('ApplicationLogErrors', false, false, 0,
+                ApplicationLogErrors, SetupLogs),
+]);
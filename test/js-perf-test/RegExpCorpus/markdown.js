@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The block and inline rules of a small markdown renderer.
+const kHeadingPattern = /^(#{1,6})[ \t]+(.+?)[ \t]*#*$/gm;
+const kListItemPattern = /^[ \t]*[-*+][ \t]+(.*)$/gm;
+const kFencePattern = /^```(\w*)\n([\s\S]*?)^```$/gm;
+const kInlinePatterns = [
+  [/`([^`]+)`/g, '<code>$1</code>'],
+  [/\*\*([^*]+)\*\*/g, '<strong>$1</strong>'],
+  [/_([^_]+)_/g, '<em>$1</em>'],
+  [/\[([^\]]+)\]\(([^)\s]+)\)/g, '<a href="$2">$1</a>'],
+];
+
+let markdownDocument;
+
+function SetupMarkdown() {
+  markdownDocument = CreateMarkdownDocument(200);
+}
+
+function MarkdownBlocks() {
+  return markdownDocument
+      .replace(kFencePattern, '<pre lang="$1">$2</pre>')
+      .replace(kHeadingPattern, (_, hashes, text) =>
+          `<h${hashes.length}>${text}</h${hashes.length}>`)
+      .replace(kListItemPattern, '<li>$1</li>');
+}
+
+function MarkdownInline() {
+  let html = markdownDocument;
+  for (const [pattern, replacement] of kInlinePatterns) {
+    html = html.replace(pattern, replacement);
+  }
+  return html;
+}
+
+new BenchmarkSuite('MarkdownBlocks', [1000], [
+  new Benchmark('MarkdownBlocks', false, false, 0, MarkdownBlocks,
+                SetupMarkdown),
+]);
+
+new BenchmarkSuite('MarkdownInline', [1000], [
+  new Benchmark('MarkdownInline', false, false, 0, MarkdownInline,
+                SetupMarkdown),
+]);
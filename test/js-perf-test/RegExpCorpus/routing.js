@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Routes in the style of path-to-regexp, as used by web frameworks, which
+// are tried in order until one matches.
+const kRoutes = [
+  /^\/?$/i,
+  /^\/index\.html\/?$/i,
+  /^\/api\/v(\d+)\/users\/([^\/]+?)\/?$/i,
+  /^\/api\/v(\d+)\/users\/([^\/]+?)\/posts\/(\d+)\/?$/i,
+  /^\/api\/v(\d+)\/orders\/(\d+)\/items(?:\/(\d+))?\/?$/i,
+  /^\/static\/(js|css|img)\/([^\/]+?)\.([0-9a-f]+\.)?(js|css|png|svg)$/i,
+  /^\/blog\/(\d{4})\/(\d{2})\/([a-z0-9-]+)\/?$/i,
+  /^\/search\/?(?:\?(.*))?$/i,
+  /^\/favicon\.ico$/i,
+];
+
+let requestPaths;
+
+function SetupRouting() {
+  const random = CorpusRandom(41);
+  requestPaths = [];
+  for (let i = 0; i < 5000; i++) {
+    // Some paths don't match any route and go through the whole table.
+    const path = CorpusPick(random, kPaths);
+    requestPaths.push(random() % 8 === 0 ? path + '/missing' : path);
+  }
+}
+
+function Routing() {
+  let matched = 0;
+  for (const path of requestPaths) {
+    for (const route of kRoutes) {
+      if (route.exec(path) !== null) {
+        matched++;
+        break;
+      }
+    }
+  }
+  return matched;
+}
+
+new BenchmarkSuite('Routing', [1000], [
+  new Benchmark('Routing', false, false, 0, Routing, SetupRouting),
+]);
@@ -0,0 +1,29 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute('../base.js');
+d8.file.execute('corpus.js');
+d8.file.execute('log.js');
+d8.file.execute('routing.js');
+d8.file.execute('user-agent.js');
+d8.file.execute('markdown.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-RegExpCorpus(Score): ' + result);
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
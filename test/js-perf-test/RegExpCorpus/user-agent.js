@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// User agent sniffing as done by analytics and feature detection libraries.
+const kBrowserPatterns = [
+  ['Edge', /\bEdg(?:e|A|iOS)?\/(\d+)\.(\d+)/],
+  ['Chrome', /\b(?:Chrome|CriOS)\/(\d+)\.(\d+)/],
+  ['Firefox', /\b(?:Firefox|FxiOS)\/(\d+)\.(\d+)/],
+  ['Safari', /\bVersion\/(\d+)\.(\d+)(?:\.\d+)?.*\bSafari\//],
+];
+const kMobilePattern = /\b(?:Mobile|Android|iPhone|iPad|iPod)\b/i;
+const kBotPattern = /bot|crawl|spider|slurp|curl|wget/i;
+
+let userAgents;
+
+function SetupUserAgents() {
+  const random = CorpusRandom(53);
+  userAgents = [];
+  for (let i = 0; i < 5000; i++) {
+    userAgents.push(CorpusPick(random, kUserAgents));
+  }
+}
+
+function UserAgent() {
+  const counts = {};
+  for (const userAgent of userAgents) {
+    if (kBotPattern.test(userAgent)) continue;
+    let browser = 'Other';
+    for (const [name, pattern] of kBrowserPatterns) {
+      const match = pattern.exec(userAgent);
+      if (match !== null) {
+        browser = `${name} ${match[1]}`;
+        break;
+      }
+    }
+    if (kMobilePattern.test(userAgent)) browser += ' (mobile)';
+    counts[browser] = (counts[browser] || 0) + 1;
+  }
+  return counts;
+}
+
+new BenchmarkSuite('UserAgent', [1000], [
+  new Benchmark('UserAgent', false, false, 0, UserAgent, SetupUserAgents),
+]);
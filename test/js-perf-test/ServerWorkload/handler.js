@@ -0,0 +1,41 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A request handler for d8 --server-workload. Each request parses a JSON
+// body, waits for a simulated database lookup, renders a response and keeps
+// some of it in a cache, which gives the old generation a steady churn.
+
+const kCacheSize = 2000;
+const kDatabaseLatencyMs = 2;
+
+const cache = new Map();
+
+function sleep(ms) {
+  return new Promise(resolve => setTimeout(resolve, ms));
+}
+
+async function queryDatabase(userId) {
+  await sleep(kDatabaseLatencyMs);
+  const orders = [];
+  for (let i = 0; i < 20; i++) {
+    orders.push({id: userId * 100 + i, total: (i * 7.5) % 100, items: i % 5});
+  }
+  return {id: userId, name: `user${userId}`, orders};
+}
+
+function render(user) {
+  const rows = user.orders.map(
+      order => `<tr><td>${order.id}</td><td>${order.items}</td>` +
+          `<td>${order.total.toFixed(2)}</td></tr>`);
+  return `<h1>${user.name}</h1><table>${rows.join('')}</table>`;
+}
+
+async function handleRequest(index) {
+  const body = JSON.parse(JSON.stringify({userId: index % 5000, page: 1}));
+  const user = await queryDatabase(body.userId);
+  await null;
+  const response = render(user);
+  cache.set(index % kCacheSize, {user, response});
+  return response.length;
+}
@@ -0,0 +1,95 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf, split and replaceAll on large one-byte and two-byte subjects, and
+// on ropes that are built by concatenation right before they are searched.
+
+const kOneByteWords = ['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'needle',
+                       'consectetur', 'adipiscing', 'elit', 'caf\xe9'];
+const kTwoByteWords = ['лорем', 'ipsum',
+                       '漢字', 'needle', '—', 'dolor',
+                       'عربي', 'amet', '\u{1F600}', 'sit'];
+
+function CreateWords(words, count) {
+  let state = 7;
+  const result = [];
+  for (let i = 0; i < count; i++) {
+    state = (state * 1103515245 + 12345) & 0x7fffffff;
+    result.push(words[state % words.length]);
+  }
+  return result;
+}
+
+const oneByteWords = CreateWords(kOneByteWords, 20000);
+const twoByteWords = CreateWords(kTwoByteWords, 20000);
+const oneByteSubject = oneByteWords.join(' ');
+const twoByteSubject = twoByteWords.join(' ');
+
+// Builds a rope from |words| in chunks, like a string built up by appending
+// to it in a loop.
+function CreateRope(words) {
+  let rope = '';
+  for (let i = 0; i < words.length; i += 64) {
+    rope += words.slice(i, i + 64).join(' ') + ' ';
+  }
+  return rope;
+}
+
+function CountIndexOf(subject, search) {
+  let count = 0;
+  for (let i = subject.indexOf(search); i !== -1;
+       i = subject.indexOf(search, i + 1)) {
+    count++;
+  }
+  return count;
+}
+
+function IndexOfOneByte() {
+  return CountIndexOf(oneByteSubject, 'needle');
+}
+
+function IndexOfTwoByte() {
+  return CountIndexOf(twoByteSubject, 'needle');
+}
+
+function IndexOfTwoByteSearch() {
+  return CountIndexOf(twoByteSubject, '漢字');
+}
+
+function IndexOfRope() {
+  return CountIndexOf(CreateRope(oneByteWords), 'needle');
+}
+
+function SplitOneByte() {
+  return oneByteSubject.split(' ').length;
+}
+
+function SplitTwoByte() {
+  return twoByteSubject.split(' ').length;
+}
+
+function SplitRope() {
+  return CreateRope(oneByteWords).split(' ').length;
+}
+
+function ReplaceAllOneByte() {
+  return oneByteSubject.replaceAll('needle', 'thread').length;
+}
+
+function ReplaceAllTwoByte() {
+  return twoByteSubject.replaceAll('—', '-').length;
+}
+
+function ReplaceAllRope() {
+  return CreateRope(twoByteWords).replaceAll('needle', 'thread').length;
+}
+
+for (const benchmark of [IndexOfOneByte, IndexOfTwoByte, IndexOfTwoByteSearch,
+                         IndexOfRope, SplitOneByte, SplitTwoByte, SplitRope,
+                         ReplaceAllOneByte, ReplaceAllTwoByte,
+                         ReplaceAllRope]) {
+  new BenchmarkSuite(benchmark.name, [1000], [
+    new Benchmark(benchmark.name, false, false, 0, benchmark),
+  ]);
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Peak performance of code that depends on feedback and inlining. Compare the
+// "default" and "turboshaft_from_maglev" variants to see the effect of
+// building the Turboshaft graph from the Maglev graph instead of from the
+// bytecode (--turboshaft-from-maglev). The compile time of the two routes is
+// measured by the Compiler suite.
+
+new BenchmarkSuite('Arithmetic', [1000], [
+  new Benchmark('Arithmetic', false, false, 0, Arithmetic),
+]);
+
+new BenchmarkSuite('PropertyAccess', [1000], [
+  new Benchmark('PropertyAccess', false, false, 0, PropertyAccess),
+]);
+
+new BenchmarkSuite('Polymorphic', [1000], [
+  new Benchmark('Polymorphic', false, false, 0, Polymorphic),
+]);
+
+new BenchmarkSuite('InlinedCalls', [1000], [
+  new Benchmark('InlinedCalls', false, false, 0, InlinedCalls),
+]);
+
+const kLength = 1000;
+const numbers = [];
+for (let i = 0; i < kLength; i++) numbers.push(i * 0.25);
+
+function Arithmetic() {
+  let sum = 0;
+  for (let i = 0; i < numbers.length; i++) {
+    sum += (numbers[i] * 3 + i) % 7;
+  }
+  return sum;
+}
+
+class Point {
+  constructor(x, y) {
+    this.x = x;
+    this.y = y;
+  }
+}
+const points = [];
+for (let i = 0; i < kLength; i++) points.push(new Point(i, i + 1));
+
+function PropertyAccess() {
+  let sum = 0;
+  for (let i = 0; i < points.length; i++) {
+    sum += points[i].x * points[i].y;
+  }
+  return sum;
+}
+
+const shapes = [];
+for (let i = 0; i < kLength; i++) {
+  switch (i % 3) {
+    case 0: shapes.push({kind: 0, size: i}); break;
+    case 1: shapes.push({size: i, kind: 1}); break;
+    case 2: shapes.push({kind: 2, extra: 0, size: i}); break;
+  }
+}
+
+function Polymorphic() {
+  let sum = 0;
+  for (let i = 0; i < shapes.length; i++) {
+    sum += shapes[i].size + shapes[i].kind;
+  }
+  return sum;
+}
+
+function square(p) {
+  return p.x * p.x;
+}
+
+function distance(p) {
+  return Math.sqrt(square(p) + p.y * p.y);
+}
+
+function InlinedCalls() {
+  let sum = 0;
+  for (let i = 0; i < points.length; i++) {
+    sum += distance(points[i]);
+  }
+  return sum;
+}
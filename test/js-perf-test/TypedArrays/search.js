@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches through large typed arrays for an element near the far end.
+const kLength = 10000;
+
+function CreateBenchmark(name, ctor, method, value, filler) {
+  const array = new ctor(kLength).fill(filler);
+  const index = method == 'lastIndexOf' ? 1 : kLength - 2;
+  array[index] = value;
+  const expected = method == 'includes' ? true : index;
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, () => {
+      if (array[method](value) !== expected) {
+        throw new Error('Unexpected result!');
+      }
+    }),
+  ]);
+}
+
+CreateBenchmark('IndexOf-Int8', Int8Array, 'indexOf', -1, 1);
+CreateBenchmark('IndexOf-Uint16', Uint16Array, 'indexOf', 1000, 1);
+CreateBenchmark('IndexOf-Int32', Int32Array, 'indexOf', -1000, 1);
+CreateBenchmark('IndexOf-Float32', Float32Array, 'indexOf', 0.5, 1);
+CreateBenchmark('IndexOf-Float64', Float64Array, 'indexOf', 0.5, 1);
+CreateBenchmark('LastIndexOf-Uint8', Uint8Array, 'lastIndexOf', 200, 1);
+CreateBenchmark('LastIndexOf-Float64', Float64Array, 'lastIndexOf', 0.5, 1);
+CreateBenchmark('Includes-Int16', Int16Array, 'includes', -1000, 1);
+CreateBenchmark('Includes-BigInt64', BigInt64Array, 'includes', -1n, 1n);
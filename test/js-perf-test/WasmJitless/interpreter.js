@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Performance of a load/op/store loop in the Wasm interpreter (--wasm-jitless).
+// Compare the variants to see the effect of the super instructions and of
+// passing the top stack value in a register.
+//
+// The wasm module builder is not available for performance tests, so the
+// module is encoded by hand.
+
+new BenchmarkSuite('LoadOpStore', [1000], [
+  new Benchmark('LoadOpStore', false, false, 0, LoadOpStore),
+]);
+
+function Section(id, contents) {
+  return [id, contents.length, ...contents];
+}
+
+// (func (param $n i32) (result i32) (local $i $sum i32) ...)
+// do { sum += mem[i & 1023]; mem[i & 1023] = sum + i; } while (++i < n)
+const kBody = [
+  1, 2, 0x7f,                             // 2 locals of type i32
+  0x03, 0x40,                             // loop
+    0x20, 2,                              // sum
+    0x20, 1, 0x41, 2, 0x74,               // i << 2
+    0x41, 0xfc, 0x1f, 0x71,               // & 4092
+    0x28, 2, 0,                           // i32.load
+    0x6a, 0x21, 2,                        // sum = sum + load
+    0x20, 1, 0x41, 2, 0x74,               // i << 2
+    0x41, 0xfc, 0x1f, 0x71,               // & 4092
+    0x20, 2, 0x20, 1, 0x6a,               // sum + i
+    0x36, 2, 0,                           // i32.store
+    0x20, 1, 0x41, 1, 0x6a, 0x22, 1,      // i += 1
+    0x20, 0, 0x48, 0x0d, 0,               // br_if (i < n) loop
+  0x0b,
+  0x20, 2,                                // sum
+  0x0b,
+];
+
+const kModuleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+  ...Section(1, [1, 0x60, 1, 0x7f, 1, 0x7f]),
+  ...Section(3, [1, 0]),
+  ...Section(5, [1, 0, 1]),
+  ...Section(7, [1, 3, ...[...'run'].map(c => c.charCodeAt(0)), 0, 0]),
+  ...Section(10, [1, kBody.length, ...kBody]),
+]);
+
+const run = new WebAssembly.Instance(new WebAssembly.Module(kModuleBytes))
+                .exports.run;
+
+function LoadOpStore() {
+  return run(10000);
+}
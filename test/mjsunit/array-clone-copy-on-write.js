@@ -0,0 +1,122 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Spread, slice() and Array.from() of a large fast array share its elements
+// copy-on-write. Check that writes to the source and to the copies through
+// the various Array builtins stay independent.
+
+const kLength = 32;
+
+function makeArray(kind) {
+  const a = [];
+  for (let i = 0; i < kLength; i++) {
+    a.push(kind == 'smi' ? i : kind == 'object' ? {i} : 'v' + i);
+  }
+  return a;
+}
+
+const copiers = [
+  a => a.slice(),
+  a => [...a],
+  a => Array.from(a),
+  a => a.concat(),
+];
+
+const mutators = [
+  a => { a[0] = 'x'; },
+  a => { a[kLength - 1] = 'x'; },
+  a => { a[kLength] = 'x'; },
+  a => a.push('x'),
+  a => a.pop(),
+  a => a.shift(),
+  a => a.unshift('x'),
+  a => a.reverse(),
+  a => a.sort(),
+  a => a.fill('x', 3, 7),
+  a => a.copyWithin(0, 5),
+  a => a.splice(2, 3, 'x'),
+  a => { a.length = 3; },
+  a => { a[2.5] = 'x'; delete a[1]; },
+];
+
+(function TestIndependence() {
+  for (const kind of ['smi', 'string', 'object']) {
+    for (const copy of copiers) {
+      for (const mutate of mutators) {
+        const source = makeArray(kind);
+        const expected = source.map(x => x);
+        const copied = copy(source);
+        assertEquals(expected, copied);
+
+        mutate(copied);
+        assertEquals(expected, source);
+        const mutated = copied.map(x => x);
+        mutate(source);
+        assertEquals(mutated, copied);
+        const copied_again = copy(source);
+        mutate(copied_again);
+        assertEquals(mutated, copied);
+      }
+    }
+  }
+})();
+
+(function TestSharing() {
+  const source = makeArray('string');
+  const copied = source.slice();
+  assertTrue(%HasCowElements(source));
+  assertTrue(%HasCowElements(copied));
+  copied[0] = 'x';
+  assertFalse(%HasCowElements(copied));
+  assertTrue(%HasCowElements(source));
+  assertEquals('v0', source[0]);
+
+  // Short arrays, double arrays and holey arrays copied with holes filled
+  // are copied eagerly.
+  const short = ['a', 'b', 'c'];
+  short.push('d');
+  short.slice();
+  assertFalse(%HasCowElements(short));
+  const doubles = makeArray('smi').map(x => x + 0.5);
+  doubles.slice();
+  assertFalse(%HasCowElements(doubles));
+  const holey = makeArray('string');
+  delete holey[3];
+  const filled = Array.from(holey);
+  assertFalse(%HasCowElements(holey));
+  assertEquals(undefined, filled[3]);
+  assertTrue(3 in filled);
+})();
+
+(function TestOptimizedStores() {
+  function store(a, i, v) {
+    a[i] = v;
+  }
+  function cloneAndStore(a) {
+    const b = a.slice();
+    a[0] = 'a';
+    b[1] = 'b';
+    return b;
+  }
+  %PrepareFunctionForOptimization(store);
+  %PrepareFunctionForOptimization(cloneAndStore);
+  for (let i = 0; i < 3; i++) {
+    const a = makeArray('string');
+    store(a, 0, 'y');
+    const b = cloneAndStore(a);
+    assertEquals(['a', 'v1'], a.slice(0, 2));
+    assertEquals(['y', 'b'], b.slice(0, 2));
+  }
+  %OptimizeFunctionOnNextCall(store);
+  %OptimizeFunctionOnNextCall(cloneAndStore);
+  const a = makeArray('string');
+  const b = [...a];
+  store(a, 0, 'y');
+  assertEquals('v0', b[0]);
+  const c = cloneAndStore(a);
+  assertEquals(['a', 'v1'], a.slice(0, 2));
+  assertEquals(['y', 'b'], c.slice(0, 2));
+})();
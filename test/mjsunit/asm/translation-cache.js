@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --validate-asm --allow-natives-syntax
+
+// Loading the same asm.js module in several realms translates it once and
+// reuses the translation afterwards, including the asm.js offset table used
+// for stack traces.
+const source = `
+function Module(stdlib, foreign) {
+  "use asm";
+  var fail = foreign.fail;
+  function add(a, b) {
+    a = a | 0;
+    b = b | 0;
+    return (a + b) | 0;
+  }
+  function throws() {
+    fail();
+  }
+  return { add: add, throws: throws };
+}
+var m = Module(this, { fail: function() { throw new Error('fail'); } });
+`;
+
+function Load() {
+  const realm = Realm.create();
+  Realm.eval(realm, source);
+  assertTrue(Realm.eval(realm, '%IsAsmWasmCode(Module)'));
+  assertEquals(5, Realm.eval(realm, 'm.add(2, 3)'));
+  const stack =
+      Realm.eval(realm, 'try { m.throws(); } catch (e) { e.stack; }');
+  Realm.dispose(realm);
+  return stack.match(/at throws \((.*)\)/)[1];
+}
+
+const position = Load();
+assertEquals(position, Load());
+assertEquals(position, Load());
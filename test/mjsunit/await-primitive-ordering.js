@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting non-promise values resumes after exactly one microtask tick, in
+// the same order as awaiting already resolved native promises, and each
+// async function keeps resuming correctly across many awaits.
+
+(function TestOrdering() {
+  const log = [];
+  async function primitive(name) {
+    log.push(name + ':start');
+    await 1;
+    log.push(name + ':1');
+    await undefined;
+    log.push(name + ':2');
+    await 'x';
+    log.push(name + ':3');
+  }
+  async function promise(name) {
+    log.push(name + ':start');
+    await Promise.resolve(1);
+    log.push(name + ':1');
+    await Promise.resolve(2);
+    log.push(name + ':2');
+    await Promise.resolve(3);
+    log.push(name + ':3');
+  }
+  primitive('a');
+  promise('b');
+  Promise.resolve().then(() => log.push('then'));
+  %PerformMicrotaskCheckpoint();
+  assertEquals(
+      ['a:start', 'b:start', 'a:1', 'b:1', 'then', 'a:2', 'b:2', 'a:3', 'b:3'],
+      log);
+})();
+
+(function TestValuesAndExceptions() {
+  let result;
+  async function f() {
+    let sum = 0;
+    for (let i = 0; i < 100; i++) sum += await i;
+    try {
+      await Promise.reject(sum);
+    } catch (e) {
+      return e + await Symbol.iterator.description.length;
+    }
+  }
+  f().then(v => result = v);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(4950 + 'Symbol.iterator'.length, result);
+})();
+
+(function TestThenableGetterNotCalledForPrimitives() {
+  let calls = 0;
+  Object.defineProperty(Number.prototype, 'then', {
+    get() { calls++; return undefined; },
+    configurable: true
+  });
+  let done = false;
+  (async () => { await 42; done = true; })();
+  %PerformMicrotaskCheckpoint();
+  delete Number.prototype.then;
+  assertTrue(done);
+  assertEquals(0, calls);
+})();
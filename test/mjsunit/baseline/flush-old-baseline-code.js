@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --allow-natives-syntax
+// Flags: --baseline-batch-compilation-threshold=0 --sparkplug
+// Flags: --no-always-sparkplug --lazy-feedback-allocation
+// Flags: --flush-baseline-code --flush-bytecode --no-stress-flush-code
+// Flags: --bytecode-old-age=6 --baseline-code-old-age=2
+// Flags: --no-flush-code-based-on-time --no-adaptive-bytecode-flushing
+// Flags: --no-turbofan --no-maglev --no-stress-concurrent-inlining
+// Flags: --no-concurrent-sparkplug
+
+function HasBaselineCode(f) {
+  let opt_status = %GetOptimizationStatus(f);
+  return (opt_status & V8OptimizationStatus.kBaseline) !== 0;
+}
+
+function HasByteCode(f) {
+  let opt_status = %GetOptimizationStatus(f);
+  return (opt_status & V8OptimizationStatus.kInterpreted) !== 0;
+}
+
+var x = {b:20, c:30};
+function f() {
+  return x.b + 10;
+}
+
+(async function () {
+  for (let i = 1; i < 50; i++) {
+    f();
+  }
+  assertTrue(HasBaselineCode(f));
+
+  // We need to invoke GC asynchronously and wait for it to finish, so that
+  // it doesn't need to scan the stack. Otherwise, some objects may not be
+  // reclaimed because of conservative stack scanning and the test may not
+  // work as intended.
+  await gc({ type: 'major', execution: 'async' });
+  assertTrue(HasBaselineCode(f));
+
+  // The baseline code is old now, but the bytecode isn't.
+  await gc({ type: 'major', execution: 'async' });
+  assertFalse(HasBaselineCode(f));
+  assertTrue(HasByteCode(f));
+  assertEquals(30, f());
+
+  // The function gets baseline code again once it's hot.
+  for (let i = 1; i < 50; i++) {
+    f();
+  }
+  assertTrue(HasBaselineCode(f));
+})();
@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-always-turbofan --turbofan --maglev
+// Flags: --no-stress-flush-code --inline-block-coverage-counters
+// Files: test/mjsunit/code-coverage-utils.js
+
+(async function () {
+
+  if (isNeverOptimizeLiteMode()) {
+    print("Warning: skipping test that requires optimization in Lite mode.");
+    testRunner.quit(0);
+  }
+
+  %DebugToggleBlockCoverage(true);
+
+  await TestCoverage(
+    "block counters in Maglev and Turbofan code",
+    `
+function f(x) {                           // 0000
+  if (x) { nop(); }                       // 0050
+}                                         // 0100
+%PrepareFunctionForOptimization(f);       // 0150
+f(true); f(false);                        // 0200
+%OptimizeMaglevOnNextCall(f);             // 0250
+f(true); f(false);                        // 0300
+%OptimizeFunctionOnNextCall(f);           // 0350
+f(true); f(false); f(false);              // 0400
+    `,
+    [ {"start":0,"end":449,"count":1},
+      {"start":0,"end":101,"count":7},
+      {"start":59,"end":69,"count":3} ]
+  );
+
+  %DebugToggleBlockCoverage(false);
+
+})();
@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --deopt-loop-detection
+
+// A property load which deopts twice with a wrong map becomes megamorphic.
+(function TestWrongMap() {
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load({x: 1}));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load({x: 1}));
+  assertOptimized(load);
+  assertEquals(2, load({x: 2, a: 1}));
+  assertUnoptimized(load);
+
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load({x: 2, a: 1}));
+  assertOptimized(load);
+  // Deopts at the same site for the same reason.
+  assertEquals(3, load({x: 3, b: 1}));
+  assertUnoptimized(load);
+
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(3, load({x: 3, b: 1}));
+  assertOptimized(load);
+  assertEquals(4, load({x: 4, c: 1}));
+  assertOptimized(load);
+})();
+
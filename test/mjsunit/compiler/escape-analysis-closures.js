@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape --turbo-escape-analysis-closures
+
+// The closure and its context don't escape once {inner} is inlined, but a
+// stack trace captured inside of it has to materialize the closure.
+function outer(x, capture) {
+  function inner(y) {
+    if (capture) return new Error().stack;
+    return x + y;
+  }
+  return inner(1);
+}
+
+%PrepareFunctionForOptimization(outer);
+assertEquals(2, outer(1, false));
+assertEquals(3, outer(2, false));
+%OptimizeFunctionOnNextCall(outer);
+assertEquals(4, outer(3, false));
+assertMatches(/at inner[\s\S]*at outer/, outer(4, true));
+assertEquals(6, outer(5, false));
+
+// The materialized closure keeps its identity across accesses to the frame.
+function outerIdentity() {
+  function inner() {
+    return inner.caller === outerIdentity && inner === inner;
+  }
+  return inner();
+}
+
+%PrepareFunctionForOptimization(outerIdentity);
+assertTrue(outerIdentity());
+assertTrue(outerIdentity());
+%OptimizeFunctionOnNextCall(outerIdentity);
+assertTrue(outerIdentity());
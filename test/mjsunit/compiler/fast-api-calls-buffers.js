@@ -0,0 +1,101 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises ArrayBuffer and ArrayBufferView arguments and object
+// return values of fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// --always-turbofan is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+// Flags: --fast-api-allow-float-in-sim
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function sum_view_bytes(view) {
+  return fast_c_api.sum_view_bytes(view);
+}
+
+function sum_buffer_bytes(buffer) {
+  return fast_c_api.sum_buffer_bytes(buffer);
+}
+
+function create_point(x, y) {
+  return fast_c_api.create_point(x, y);
+}
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  f(...args);
+  assertOptimized(f);
+}
+
+const bytes = new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8]);
+
+// ---------- ArrayBufferView arguments ----------
+
+optimize(sum_view_bytes, bytes);
+fast_c_api.reset_counts();
+assertEquals(36, sum_view_bytes(bytes));
+assertEquals(2 + 3 + 4, sum_view_bytes(bytes.subarray(1, 4)));
+assertEquals(1 + 2 + 3 + 4, sum_view_bytes(new Uint16Array(bytes.buffer, 0, 2)));
+assertEquals(5 + 6 + 7, sum_view_bytes(new DataView(bytes.buffer, 4, 3)));
+assertEquals(0, sum_view_bytes(new Float64Array(0)));
+assertOptimized(sum_view_bytes);
+assertEquals(5, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Views on resizable, shared or detached buffers, and values that aren't
+// views, take the slow path.
+fast_c_api.reset_counts();
+const rab = new ArrayBuffer(4, {maxByteLength: 8});
+new Uint8Array(rab).set([1, 1, 1, 1]);
+assertEquals(4, sum_view_bytes(new Uint8Array(rab)));
+const sab = new SharedArrayBuffer(2);
+new Uint8Array(sab).set([3, 4]);
+assertEquals(7, sum_view_bytes(new Uint8Array(sab)));
+const detached = new ArrayBuffer(4);
+const detached_view = new Uint8Array(detached);
+%ArrayBufferDetach(detached);
+assertEquals(0, sum_view_bytes(detached_view));
+assertEquals(36, sum_view_bytes(bytes.buffer));
+assertThrows(() => sum_view_bytes(1));
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(5, fast_c_api.slow_call_count());
+
+// ---------- ArrayBuffer arguments ----------
+
+optimize(sum_buffer_bytes, bytes.buffer);
+fast_c_api.reset_counts();
+assertEquals(36, sum_buffer_bytes(bytes.buffer));
+assertEquals(0, sum_buffer_bytes(new ArrayBuffer(16)));
+assertOptimized(sum_buffer_bytes);
+assertEquals(2, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+fast_c_api.reset_counts();
+assertEquals(4, sum_buffer_bytes(rab));
+assertEquals(7, sum_buffer_bytes(sab));
+assertEquals(0, sum_buffer_bytes(detached));
+assertEquals(36, sum_buffer_bytes(bytes));
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(4, fast_c_api.slow_call_count());
+
+// ---------- Object return values ----------
+
+optimize(create_point, 1, 2);
+fast_c_api.reset_counts();
+const points = [];
+for (let i = 0; i < 10000; i++) points.push(create_point(i, -i));
+assertOptimized(create_point);
+assertEquals(10000, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+for (let i = 0; i < points.length; i += 997) {
+  assertEquals({x: i, y: -i}, points[i]);
+}
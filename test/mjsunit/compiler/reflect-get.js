@@ -71,3 +71,39 @@
   %OptimizeFunctionOnNextCall(foo);
   assertEquals(1, foo({[Symbol.toPrimitive]() { throw new Error(); }}));
 })();
+
+// Test Reflect.get with a receiver.
+(function() {
+  "use strict";
+  const o = {get x() { return this.y; }, y: 1};
+  function foo(r) { return Reflect.get(o, "x", r); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo(o));
+  assertEquals(2, foo({y: 2}));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo(o));
+  assertEquals(2, foo({y: 2}));
+  assertEquals(undefined, foo(3));
+})();
+
+// Test Reflect.get forwarding from a proxy get trap.
+(function() {
+  "use strict";
+  const handler = {
+    get(target, key, receiver) {
+      return Reflect.get(target, key, receiver);
+    }
+  };
+  const p = new Proxy({get x() { return this.y; }, y: 3}, handler);
+  function foo(p) { return p.x + p.y; }
+
+  %PrepareFunctionForOptimization(handler.get);
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(6, foo(p));
+  assertEquals(6, foo(p));
+  %OptimizeFunctionOnNextCall(handler.get);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(p));
+  assertThrows(() => handler.get(1, "x", p), TypeError);
+})();
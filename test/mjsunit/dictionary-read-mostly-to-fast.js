@@ -0,0 +1,103 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --read-mostly-dictionary-to-fast
+
+// Dictionary-mode objects whose own properties are loaded often without any
+// property being added or deleted go back to fast properties, and objects
+// with the same properties share the resulting map.
+
+function makeDictionary() {
+  const object = {a: 1, b: 2, c: 3, d: 4};
+  delete object.a;
+  return object;
+}
+
+function loadB(object) {
+  return object.b;
+}
+
+function loadKeyed(object, key) {
+  return object[key];
+}
+
+function readOften(load, object, key) {
+  let sum = 0;
+  for (let i = 0; i < 5000; i++) sum += load(object, key);
+  return sum;
+}
+
+(function TestNamedLoads() {
+  const object = makeDictionary();
+  assertFalse(%HasFastProperties(object));
+  assertEquals(5000 * 2, readOften(loadB, object));
+  assertTrue(%HasFastProperties(object));
+  assertEquals(undefined, object.a);
+  assertEquals([2, 3, 4], [object.b, object.c, object.d]);
+  assertEquals(['b', 'c', 'd'], Object.keys(object));
+})();
+
+(function TestKeyedLoads() {
+  // Make the keyed load megamorphic so it goes through the generic load.
+  for (const key of ['p', 'q', 'r', 's', 't']) loadKeyed({[key]: 0}, key);
+  const object = makeDictionary();
+  assertFalse(%HasFastProperties(object));
+  assertEquals(5000 * 3, readOften(loadKeyed, object, 'c'));
+  assertTrue(%HasFastProperties(object));
+})();
+
+(function TestSharedMap() {
+  const first = makeDictionary();
+  const second = makeDictionary();
+  readOften(loadB, first);
+  readOften(loadB, second);
+  assertTrue(%HasFastProperties(first));
+  assertTrue(%HasFastProperties(second));
+  assertTrue(%HaveSameMap(first, second));
+
+  // The shared map keeps working when one of the objects changes.
+  second.b = 'changed';
+  second.e = 5;
+  assertEquals(2, first.b);
+  assertEquals('changed', second.b);
+  assertEquals(undefined, first.e);
+})();
+
+(function TestAdditionsRestartCounting() {
+  const object = makeDictionary();
+  for (let i = 0; i < 5000; i++) {
+    loadB(object);
+    if (i % 500 == 0) object['x' + i] = i;
+  }
+  assertFalse(%HasFastProperties(object));
+  readOften(loadB, object);
+  assertTrue(%HasFastProperties(object));
+})();
+
+(function TestDeletionsRestartCounting() {
+  const object = makeDictionary();
+  for (let i = 0; i < 20; i++) object['x' + i] = i;
+  for (let i = 0; i < 5000; i++) {
+    loadB(object);
+    if (i % 500 == 0) delete object['x' + i / 500];
+  }
+  assertFalse(%HasFastProperties(object));
+})();
+
+(function TestPrototypesStayInDictionaryMode() {
+  const proto = makeDictionary();
+  const object = Object.create(proto);
+  readOften(loadB, proto);
+  assertEquals(2, object.b);
+})();
+
+(function TestAccessors() {
+  const object = makeDictionary();
+  let calls = 0;
+  Object.defineProperty(object, 'g', {get() { calls++; return 7; }});
+  assertEquals(5000 * 2, readOften(loadB, object));
+  assertTrue(%HasFastProperties(object));
+  assertEquals(7, object.g);
+  assertEquals(1, calls);
+})();
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-call-site-infos
+
+// Error stacks are captured as raw frames and only turned into call sites
+// when they are first accessed, which must not be observable.
+
+function thrower(receiver) {
+  return new Error('boom');
+}
+
+class Klass {
+  method() { return thrower(this); }
+}
+
+(function TestFormattedStack() {
+  const error = new Klass().method();
+  const lines = error.stack.split('\n');
+  assertEquals('Error: boom', lines[0]);
+  assertTrue(lines[1].includes('at thrower'));
+  assertTrue(lines[2].includes('at Klass.method'));
+  assertTrue(lines[3].includes('TestFormattedStack'));
+  // The stack is stable once it has been formatted.
+  assertEquals(error.stack, error.stack);
+})();
+
+(function TestPrepareStackTraceSeesCallSites() {
+  const error = new Klass().method();
+  Error.prepareStackTrace = (e, callSites) => callSites;
+  try {
+    const callSites = error.stack;
+    assertEquals('thrower', callSites[0].getFunctionName());
+    assertEquals('method', callSites[1].getMethodName());
+    assertEquals('Klass', callSites[1].getTypeName());
+    assertTrue(callSites[1].getLineNumber() > 0);
+  } finally {
+    Error.prepareStackTrace = undefined;
+  }
+})();
+
+(function TestCaptureStackTrace() {
+  const object = {};
+  function capture() { Error.captureStackTrace(object); }
+  capture();
+  assertTrue(object.stack.includes('at capture'));
+})();
+
+(function TestStackTraceLimit() {
+  const limit = Error.stackTraceLimit;
+  try {
+    Error.stackTraceLimit = 1;
+    const error = new Klass().method();
+    assertEquals(2, error.stack.split('\n').length);
+    Error.stackTraceLimit = 0;
+    assertEquals('Error: boom', new Klass().method().stack);
+  } finally {
+    Error.stackTraceLimit = limit;
+  }
+})();
+
+(function TestManyUnreadErrors() {
+  for (let i = 0; i < 1000; i++) new Klass().method();
+  assertTrue(new Klass().method().stack.includes('at thrower'));
+})();
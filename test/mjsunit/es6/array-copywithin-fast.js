@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// copyWithin moves the elements of fast arrays in one go. Compare it against
+// the generic implementation on array-likes for every elements kind, and
+// check that the fast path is left when the arguments change the array.
+
+function generic(array, ...args) {
+  const object = Object.assign({length: array.length}, array);
+  Array.prototype.copyWithin.call(object, ...args);
+  const result = new Array(array.length);
+  for (let i = 0; i < array.length; i++) {
+    if (i in object) result[i] = object[i];
+  }
+  return result;
+}
+
+const kinds = {
+  smi: i => i,
+  double: i => i + 0.5,
+  object: i => ({i}),
+};
+const argsList = [
+  [0, 3], [3, 0], [0, 3, 10], [5, 2, 40], [2, 5, 40], [-10, 0],
+  [0, -10, -2], [40, 0], [0, 40], [1, 1], [0, 0, 0]
+];
+
+for (const [name, make] of Object.entries(kinds)) {
+  for (const holey of [false, true]) {
+    for (const args of argsList) {
+      const array = [];
+      for (let i = 0; i < 50; i++) array.push(make(i));
+      if (holey) {
+        delete array[4];
+        delete array[20];
+      }
+      const expected = generic(array, ...args);
+      assertSame(array, array.copyWithin(...args));
+      assertEquals(expected.length, array.length);
+      for (let i = 0; i < array.length; i++) {
+        assertEquals(i in expected, i in array, `${name} ${args} ${i}`);
+        assertSame(expected[i], array[i], `${name} ${args} ${i}`);
+      }
+    }
+  }
+}
+
+(function TestCopyOnWrite() {
+  const literal = () => [1, 2, 3, 4, 5, 6, 7, 8];
+  const array = literal();
+  array.copyWithin(0, 4);
+  assertEquals([5, 6, 7, 8, 5, 6, 7, 8], array);
+  assertEquals([1, 2, 3, 4, 5, 6, 7, 8], literal());
+})();
+
+(function TestLengthChangedByArguments() {
+  const array = [0, 1, 2, 3, 4, 5, 6, 7];
+  array.copyWithin(0, {valueOf() { array.length = 4; return 4; }});
+  // The removed elements are deleted from the target range.
+  assertEquals(4, array.length);
+  for (let i = 0; i < 4; i++) assertFalse(i in array);
+})();
+
+(function TestPrototypeElements() {
+  const array = [0, , 2, 3];
+  Array.prototype[1] = 'proto';
+  try {
+    array.copyWithin(0, 1);
+    assertEquals(['proto', 2, 3, 3], array);
+    assertTrue(array.hasOwnProperty(0));
+  } finally {
+    delete Array.prototype[1];
+  }
+})();
+
+(function TestFill() {
+  for (const value of [1, 1.5, {}, 'str', undefined]) {
+    const array = new Array(100).fill(0);
+    array.fill(value, 30, 70);
+    for (let i = 0; i < 100; i++) {
+      assertSame(i >= 30 && i < 70 ? value : 0, array[i]);
+    }
+  }
+})();
@@ -0,0 +1,60 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups of string keys skip the candidates in the bucket chain whose hash
+// differs. Check keys of equal length, keys which are not internalized, and
+// array index keys, while the tables grow.
+
+function key(i) {
+  return 'key_' + String(i).padStart(6, '0');
+}
+
+(function TestManyKeysOfEqualLength() {
+  const map = new Map();
+  const set = new Set();
+  for (let i = 0; i < 5000; i++) {
+    map.set(key(i), i);
+    set.add(key(i));
+  }
+  for (let i = 0; i < 5000; i++) {
+    assertEquals(i, map.get(key(i)));
+    assertTrue(set.has(key(i)));
+  }
+  assertFalse(map.has(key(5000)));
+  assertFalse(set.has(key(-1)));
+})();
+
+(function TestKeysWhichAreNotInternalized() {
+  const map = new Map();
+  const prefix = 'abc'.repeat(10);
+  for (let i = 0; i < 100; i++) map.set(prefix + i, i);
+  for (let i = 0; i < 100; i++) {
+    // Cons and sliced strings, whose hashes are computed on lookup.
+    const cons = prefix.slice(0, 15) + prefix.slice(15) + i;
+    assertEquals(i, map.get(cons));
+    const sliced = ('x' + prefix + i + 'y').slice(1, -1);
+    assertEquals(i, map.get(sliced));
+  }
+  assertEquals(undefined, map.get(prefix + 'z'));
+})();
+
+(function TestArrayIndexKeys() {
+  const map = new Map([['1', 'one'], ['01', 'zero one'], [1, 'number']]);
+  assertEquals('one', map.get('1'));
+  assertEquals('one', map.get(String(1)));
+  assertEquals('zero one', map.get('0' + '1'));
+  assertEquals('number', map.get(1));
+  assertEquals(undefined, map.get('2'));
+})();
+
+(function TestDeleteAndGrow() {
+  const map = new Map();
+  for (let i = 0; i < 1000; i++) map.set(key(i), i);
+  for (let i = 0; i < 1000; i += 2) assertTrue(map.delete(key(i)));
+  for (let i = 1000; i < 3000; i++) map.set(key(i), i);
+  for (let i = 0; i < 3000; i++) {
+    assertEquals(i < 1000 && i % 2 == 0 ? undefined : i, map.get(key(i)));
+  }
+  assertEquals([key(1), 1], map.entries().next().value);
+})();
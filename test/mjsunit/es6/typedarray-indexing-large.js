@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf, lastIndexOf and includes search large typed arrays with SIMD.
+// Check matches at every position around the vector boundaries, starting from
+// unaligned offsets.
+
+const ctors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+const kLength = 200;
+
+function reference(array, value, from, backwards) {
+  if (backwards) {
+    for (let i = from; i >= 0; i--) if (array[i] === value) return i;
+  } else {
+    for (let i = from; i < array.length; i++) if (array[i] === value) return i;
+  }
+  return -1;
+}
+
+for (const ctor of ctors) {
+  const buffer = new ArrayBuffer((kLength + 8) * ctor.BYTES_PER_ELEMENT);
+  for (const offset of [0, 1, 3]) {
+    const array = new ctor(buffer, offset * ctor.BYTES_PER_ELEMENT, kLength);
+    array.fill(1);
+    assertEquals(-1, array.indexOf(2));
+    assertEquals(-1, array.lastIndexOf(2));
+    assertFalse(array.includes(2));
+    for (let i = 0; i < 70; i++) {
+      array[i] = 2;
+      array[kLength - 1 - i] = 2;
+      for (const from of [0, i, i + 1, 50]) {
+        assertEquals(reference(array, 2, from, false), array.indexOf(2, from));
+        assertEquals(reference(array, 2, from, false) != -1,
+                     array.includes(2, from));
+        const back = kLength - 1 - from;
+        assertEquals(reference(array, 2, back, true),
+                     array.lastIndexOf(2, back));
+      }
+      array[i] = 1;
+      array[kLength - 1 - i] = 1;
+    }
+  }
+}
+
+(function TestSignedValues() {
+  const array = new Int8Array(kLength);
+  array[100] = -1;
+  assertEquals(100, array.indexOf(-1));
+  assertEquals(-1, array.indexOf(255));
+  assertEquals(100, array.lastIndexOf(-1));
+  const unsigned = new Uint16Array(kLength);
+  unsigned[150] = 0xffff;
+  assertEquals(150, unsigned.indexOf(0xffff));
+  assertEquals(-1, unsigned.indexOf(-1));
+})();
+
+(function TestFloatValues() {
+  for (const ctor of [Float32Array, Float64Array]) {
+    const array = new ctor(kLength).fill(1.5);
+    array[60] = -0;
+    array[120] = NaN;
+    assertEquals(0, array.indexOf(1.5));
+    assertEquals(60, array.indexOf(0));
+    assertEquals(60, array.lastIndexOf(-0));
+    assertEquals(-1, array.indexOf(NaN));
+    assertEquals(-1, array.lastIndexOf(NaN));
+    assertTrue(array.includes(NaN));
+    assertTrue(array.includes(0, 60));
+    assertFalse(array.includes(0, 61));
+  }
+})();
+
+(function TestBigIntValues() {
+  const array = new BigInt64Array(kLength);
+  array[90] = -5n;
+  assertEquals(90, array.indexOf(-5n));
+  assertEquals(90, array.lastIndexOf(-5n));
+  assertTrue(array.includes(-5n));
+  assertEquals(-1, array.indexOf(-5));
+})();
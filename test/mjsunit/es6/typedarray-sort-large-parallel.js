@@ -0,0 +1,12 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-typed-array-sort
+
+d8.file.execute('test/mjsunit/es6/typedarray-sort-large.js');
+
+// Large enough to be split into chunks for background threads.
+const array = new Int32Array(1 << 20);
+fill(array);
+check(array);
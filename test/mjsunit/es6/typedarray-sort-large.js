@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large typed arrays are radix sorted when there is no comparator. Compare
+// against sorting with a comparator, which does not take that path.
+
+function compare(a, b) {
+  // NaN sorts last, and -0 before +0.
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  if (a < b || (a === b && Object.is(a, -0) && !Object.is(b, -0))) return -1;
+  if (b < a || (a === b && Object.is(b, -0) && !Object.is(a, -0))) return 1;
+  return 0;
+}
+
+let seed = 17;
+function random() {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+}
+
+function fill(array) {
+  const bigint = array instanceof BigInt64Array ||
+      array instanceof BigUint64Array;
+  const special = [0, -0, NaN, Infinity, -Infinity, 1.5, -1.5];
+  for (let i = 0; i < array.length; i++) {
+    let value = Math.floor((random() - 0.5) * 2 ** 40);
+    if (array instanceof Float64Array || array instanceof Float32Array) {
+      if (i % 5 == 0) value = special[i % special.length];
+      else value = value / 1024;
+    }
+    array[i] = bigint ? BigInt(value) : value;
+  }
+  if (bigint) {
+    array[0] = 2n ** 62n;
+    array[1] = -(2n ** 62n);
+  }
+}
+
+function check(array) {
+  const expected = array.slice().sort(compare);
+  assertSame(array, array.sort());
+  for (let i = 0; i < array.length; i++) {
+    if (!Object.is(expected[i], array[i])) {
+      assertEquals(expected[i], array[i], `index ${i}`);
+      assertUnreachable(`index ${i}`);
+    }
+  }
+}
+
+for (const ctor of [Uint8Array, Int8Array, Uint16Array, Int16Array,
+                    Uint32Array, Int32Array, Uint8ClampedArray, Float32Array,
+                    Float64Array, BigInt64Array, BigUint64Array]) {
+  for (const length of [4095, 4096, 10000]) {
+    const array = new ctor(length);
+    fill(array);
+    check(array);
+    // Already sorted input, and subarrays at an offset.
+    check(array);
+    check(new ctor(array.buffer, 8 * ctor.BYTES_PER_ELEMENT, length - 8));
+  }
+}
+
+// Shared buffers are sorted on a copy.
+const shared = new Float64Array(new SharedArrayBuffer(8 * 10000));
+fill(shared);
+check(shared);
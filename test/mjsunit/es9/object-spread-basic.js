@@ -158,3 +158,21 @@ assertEquals(prop.value, 5);
 assertTrue(prop.enumerable);
 assertTrue(prop.configurable);
 assertTrue(prop.writable);
+
+// Later spreads define properties, even over accessors and frozen sources.
+var y = { get a() { return 1; }, ...{ a: 6 }, ...Object.freeze({ b: 7 }) };
+var prop = Object.getOwnPropertyDescriptor(y, 'a');
+assertEquals(prop.value, 6);
+assertTrue(prop.writable);
+var prop = Object.getOwnPropertyDescriptor(y, 'b');
+assertEquals(prop.value, 7);
+assertTrue(prop.configurable);
+assertTrue(prop.writable);
+
+var setterCalled = false;
+Object.defineProperty(Object.prototype, 'c', {
+  set(v) { setterCalled = true; }, configurable: true });
+var y = { ...{}, ...{ c: 8 } };
+assertFalse(setterCalled);
+assertEquals(8, y.c);
+delete Object.prototype.c;
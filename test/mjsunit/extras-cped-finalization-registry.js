@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+
+const {
+  getContinuationPreservedEmbedderData,
+  setContinuationPreservedEmbedderData,
+} = d8.getExtrasBindingObject();
+
+// FinalizationRegistry cleanup callbacks run from a task with the data that
+// was current when the registry was created.
+(async function () {
+  setContinuationPreservedEmbedderData('registry created');
+  let cleanup_called = 0;
+  let fg = new FinalizationRegistry(() => {
+    assertEquals('registry created', getContinuationPreservedEmbedderData());
+    cleanup_called++;
+  });
+
+  setContinuationPreservedEmbedderData('registered');
+  // Only touch the target inside a function, so that no temporary register
+  // keeps it alive.
+  (function () {
+    fg.register({}, 'holdings');
+  })();
+
+  setContinuationPreservedEmbedderData('gc');
+  // Invoke GC asynchronously so that it doesn't scan the stack.
+  await gc({ type: 'major', execution: 'async' });
+
+  setTimeout(() => {
+    assertEquals(1, cleanup_called);
+  }, 0);
+})();
+
+// Awaiting values that are not promises preserves the data as well.
+(async function () {
+  setContinuationPreservedEmbedderData('await');
+  await 1;
+  assertEquals('await', getContinuationPreservedEmbedderData());
+  await undefined;
+  assertEquals('await', getContinuationPreservedEmbedderData());
+})();
+setContinuationPreservedEmbedderData('after await');
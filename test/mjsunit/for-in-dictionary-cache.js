@@ -0,0 +1,94 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The keys of dictionary-mode prototypes are cached on their PrototypeInfo,
+// and for-in over dictionary-mode receivers uses the cached keys of their
+// prototype chain. Check that the keys follow all changes to the objects.
+
+function keysOf(object) {
+  const keys = [];
+  for (const key in object) keys.push(key);
+  return keys;
+}
+
+function makeDictionary(prefix, count) {
+  const object = {};
+  for (let i = 0; i < count; i++) object[prefix + i] = i;
+  delete object[prefix + 0];
+  return object;
+}
+
+(function TestDictionaryReceiver() {
+  const proto = {a: 1, b: 2, c: 3};
+  const receiver = makeDictionary('x', 4);
+  Object.setPrototypeOf(receiver, proto);
+  assertFalse(%HasFastProperties(receiver));
+
+  for (let i = 0; i < 3; i++) {
+    assertEquals(['x1', 'x2', 'x3', 'a', 'b', 'c'], keysOf(receiver));
+  }
+
+  // Own properties shadow the prototype's, even when not enumerable.
+  receiver.b = 4;
+  Object.defineProperty(receiver, 'c', {value: 5, enumerable: false});
+  assertEquals(['x1', 'x2', 'x3', 'b', 'a'], keysOf(receiver));
+  assertEquals(['x1', 'x2', 'x3', 'b', 'a'], keysOf(receiver));
+  delete receiver.b;
+  assertEquals(['x1', 'x2', 'x3', 'a', 'b'], keysOf(receiver));
+
+  proto.d = 6;
+  assertEquals(['x1', 'x2', 'x3', 'a', 'b', 'd'], keysOf(receiver));
+  delete proto.a;
+  assertEquals(['x1', 'x2', 'x3', 'b', 'd'], keysOf(receiver));
+  Object.defineProperty(proto, 'b', {enumerable: false});
+  assertEquals(['x1', 'x2', 'x3', 'd'], keysOf(receiver));
+
+  // Elements of the receiver come first.
+  receiver[0] = 0;
+  assertEquals(['0', 'x1', 'x2', 'x3', 'd'], keysOf(receiver));
+})();
+
+(function TestDictionaryPrototype() {
+  const proto = makeDictionary('p', 5);
+  const receiver = Object.create(proto);
+  receiver.own = 1;
+  const expected = ['p1', 'p2', 'p3', 'p4'];
+
+  for (let i = 0; i < 3; i++) {
+    assertEquals(expected, Object.keys(proto));
+    assertEquals(['own', ...expected], keysOf(receiver));
+  }
+
+  // The result may not share the cached keys.
+  const keys = Object.keys(proto);
+  keys[0] = 'changed';
+  keys.push('added');
+  assertEquals(expected, Object.keys(proto));
+
+  function store(object, key, value) {
+    object[key] = value;
+  }
+  for (let i = 0; i < 3; i++) {
+    store(proto, 'q' + i, i);
+    expected.push('q' + i);
+    assertEquals(expected, Object.keys(proto));
+    assertEquals(['own', ...expected], keysOf(receiver));
+  }
+
+  proto.p1 = 'value';
+  assertEquals(expected, Object.keys(proto));
+  delete proto.p2;
+  expected.splice(1, 1);
+  assertEquals(expected, Object.keys(proto));
+  Object.defineProperty(proto, 'p3', {enumerable: false});
+  expected.splice(1, 1);
+  assertEquals(expected, Object.keys(proto));
+  assertEquals(['own', ...expected], keysOf(receiver));
+  Object.defineProperty(proto, 'p3', {enumerable: true});
+  expected.push('p3');
+  assertEquals(expected.slice(0, 1).concat('p3', expected.slice(1, -1)),
+               Object.keys(proto));
+})();
@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function test() {
+  const N = 256;
+  const sab = new SharedArrayBuffer(N * 4);
+  const i32a = new Int32Array(sab);
+
+  let log = [];
+
+  // Create async waiters on N different locations.
+  for (let i = 0; i < N; ++i) {
+    const result = Atomics.waitAsync(i32a, i, 0);
+    assertEquals(true, result.async);
+    result.value.then(
+      (value) => { assertEquals("ok", value); log.push(i); },
+      () => { assertUnreachable(); });
+  }
+  for (let i = 0; i < N; ++i) {
+    assertEquals(1, %AtomicsNumWaitersForTesting(i32a, i));
+  }
+
+  // Notifying a location without waiters doesn't affect the others.
+  const sab2 = new SharedArrayBuffer(N * 4);
+  assertEquals(0, Atomics.notify(new Int32Array(sab2), 0));
+
+  // Wake up the waiters in reverse order. The Promises are resolved in the
+  // order in which the waiters were woken up.
+  for (let i = N - 1; i >= 0; --i) {
+    assertEquals(1, Atomics.notify(i32a, i));
+    assertEquals(0, %AtomicsNumWaitersForTesting(i32a, i));
+    assertEquals(1, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, i));
+  }
+  assertEquals(0, Atomics.notify(i32a, 0));
+
+  function continuation() {
+    assertEquals(N, log.length);
+    for (let i = 0; i < N; ++i) {
+      assertEquals(N - 1 - i, log[i]);
+    }
+  }
+
+  setTimeout(continuation, 0);
+})();
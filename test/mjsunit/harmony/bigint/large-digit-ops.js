@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Addition, subtraction and bitwise operations on BigInts with enough digits
+// to reach the unrolled and vectorized loops, including negative operands
+// whose low digits are zero (so that the two's complement borrow travels
+// through several digits first).
+
+function make(digits, seed) {
+  let result = 0n;
+  for (let i = 0; i < digits; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    result = (result << 64n) | (BigInt(seed) * 0x100000001n + BigInt(i));
+  }
+  return result;
+}
+
+const values = [];
+for (const digits of [1, 3, 4, 5, 8, 17, 33, 100]) {
+  const x = make(digits, digits);
+  values.push(x, x << 64n, x << 300n, (1n << BigInt(64 * digits)) - 1n);
+}
+
+for (const a of values) {
+  for (const b of values) {
+    for (const [x, y] of [[a, b], [-a, b], [a, -b], [-a, -b]]) {
+      const and = x & y;
+      const or = x | y;
+      const xor = x ^ y;
+      assertEquals(x + y, and + or);
+      assertEquals(xor, or - and);
+      assertEquals(0n, and & xor);
+      assertEquals(~x & ~y, ~or);
+      assertEquals(x, (x + y) - y);
+      assertEquals(y, x ^ xor);
+    }
+  }
+}
@@ -1672,3 +1672,51 @@ function TestHelperPrototypeSurface(helper) {
   assertEquals(Iterator.prototype.constructor, Iterator);
   assertEquals(get.call(), Iterator);
 })();
+
+(function TestChainedHelpers() {
+  const result = longerGen()
+                     .map((x, i) => x + i)
+                     .filter(x => x % 2 == 0)
+                     .flatMap(x => [x, x])
+                     .drop(1)
+                     .take(2);
+  TestHelperPrototypeSurface(result);
+  assertEquals({value: 42, done: false}, result.next());
+  assertEquals({value: 44, done: false}, result.next());
+  assertEquals({value: undefined, done: true}, result.next());
+
+  assertEquals([84, 86, 88, 90],
+               longerGen().map(x => x * 2).filter(x => x > 0).toArray());
+  assertEquals(348, longerGen().map(x => x * 2).reduce((a, b) => a + b));
+  assertEquals(45, longerGen().filter(x => x > 44).find(x => true));
+})();
+
+(function TestChainedHelpersReentrant() {
+  let outer;
+  const inner = gen().map(x => outer.next());
+  outer = inner.map(x => x);
+  assertThrows(() => outer.next(), TypeError);
+  assertEquals([], inner.toArray());
+})();
+
+(function TestChainedHelpersPatchedNext() {
+  const IteratorHelperPrototype = Object.getPrototypeOf(gen().map(x => x));
+  const originalNext = IteratorHelperPrototype.next;
+  let count = 0;
+  IteratorHelperPrototype.next = function() {
+    count++;
+    return originalNext.call(this);
+  };
+  try {
+    assertEquals([42, 43], gen().map(x => x).filter(x => true).toArray());
+    assertEquals(3 * 2, count);
+  } finally {
+    IteratorHelperPrototype.next = originalNext;
+  }
+})();
+
+(function TestDeepHelperChain() {
+  let iter = gen();
+  for (let i = 0; i < 100000; i++) iter = iter.map(x => x);
+  assertThrows(() => iter.next(), RangeError);
+})();
@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --js-finalization-registry-batching
+
+(async function () {
+
+  let batched_calls = [];
+  let batched = new FinalizationRegistry(function (holdings) {
+    batched_calls.push(holdings);
+  }, { batched: true });
+
+  let unbatched_calls = [];
+  let unbatched = new FinalizationRegistry(function (holdings) {
+    unbatched_calls.push(holdings);
+  }, { batched: false });
+
+  // The objects need to be inside a closure so that we can reliably kill them.
+  (function () {
+    for (let i = 0; i < 100; i++) {
+      batched.register({}, i);
+      unbatched.register({}, i);
+    }
+    batched.register({}, "unregistered", batched);
+    batched.unregister(batched);
+  })();
+
+  // We need to invoke GC asynchronously and wait for it to finish, so that
+  // it doesn't need to scan the stack. Otherwise, the objects may not be
+  // reclaimed because of conservative stack scanning and the test may not
+  // work as intended.
+  await gc({ type: 'major', execution: 'async' });
+  assertEquals(0, batched_calls.length);
+  assertEquals(0, unbatched_calls.length);
+
+  // Wait for the cleanup tasks of both registries.
+  await new Promise(resolve=>setTimeout(resolve, 0));
+  await new Promise(resolve=>setTimeout(resolve, 0));
+  await new Promise(resolve=>setTimeout(resolve, 0));
+
+  // The batched registry calls its callback once with all held values.
+  assertEquals(1, batched_calls.length);
+  assertTrue(Array.isArray(batched_calls[0]));
+  assertEquals(100, batched_calls[0].length);
+  assertEquals([...Array(100).keys()],
+               batched_calls[0].sort((a, b) => a - b));
+
+  assertEquals(100, unbatched_calls.length);
+  assertEquals("number", typeof unbatched_calls[0]);
+})();
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --ignition-superinstructions --allow-natives-syntax
+
+// Property chains store each intermediate object in a register which is then
+// used as the receiver of the next load (StarGetNamedProperty).
+function chain(o) {
+  return o.a.b.c;
+}
+
+function test(f) {
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f({a: {b: {c: 3}}}));
+  assertEquals(undefined, f({a: {b: {}}}));
+  assertThrows(() => f({a: {}}), TypeError);
+  %CompileBaseline(f);
+  assertEquals(3, f({a: {b: {c: 3}}}));
+  assertThrows(() => f({a: {}}), TypeError);
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(3, f({a: {b: {c: 3}}}));
+  // Deopts in the middle of the chain.
+  assertEquals(4, f({a: {x: 1, b: {c: 4}}}));
+  %PrepareFunctionForOptimization(f);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(3, f({a: {b: {c: 3}}}));
+  assertEquals(4, f({a: {x: 1, b: {c: 4}}}));
+}
+
+test(chain);
+
+// A getter lazily deopts after the register has been written.
+let deopt = false;
+function getterChain(o) {
+  const x = o.a.b;
+  return [x, o];
+}
+const getter = {
+  get b() {
+    if (deopt) %DeoptimizeFunction(getterChain);
+    return 1;
+  }
+};
+%PrepareFunctionForOptimization(getterChain);
+assertEquals(1, getterChain({a: getter})[0]);
+%OptimizeFunctionOnNextCall(getterChain);
+assertEquals(1, getterChain({a: getter})[0]);
+deopt = true;
+const o = {a: getter};
+const result = getterChain(o);
+assertEquals(1, result[0]);
+assertSame(o, result[1]);
@@ -0,0 +1,36 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings and whitespace are scanned in blocks. Put the interesting
+// characters at every offset relative to a block.
+
+for (let i = 0; i < 40; i++) {
+  const prefix = 'a'.repeat(i);
+  for (const suffix of ['', 'b'.repeat(17), 'ሴ'.repeat(9)]) {
+    const value = prefix + suffix;
+    assertEquals(value, JSON.parse(`"${value}"`));
+    assertEquals(prefix + '"' + suffix, JSON.parse(`"${prefix}\\"${suffix}"`));
+    assertEquals(prefix + '\n' + suffix, JSON.parse(`"${prefix}\\n${suffix}"`));
+    assertEquals(
+        prefix + 'Ā' + suffix, JSON.parse(`"${prefix}\\u0100${suffix}"`));
+    assertThrows(() => JSON.parse(`"${prefix}\n${suffix}"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}\x1f${suffix}"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${value}`), SyntaxError);
+
+    const indent = ' \t\r\n'.repeat(i);
+    assertEquals(
+        {[value]: [value]},
+        JSON.parse(
+            `${indent}{${indent}"${value}"${indent}:${indent}[${indent}` +
+            `"${value}"${indent}]${indent}}${indent}`));
+  }
+}
+
+// Characters outside of Latin1 decide whether a string from a two-byte source
+// stays two-byte.
+assertEquals('x'.repeat(20), JSON.parse(`"${'x'.repeat(20)}"ሴ`.slice(0, -1)));
+const two_byte = 'ሴ' + 'x'.repeat(30);
+assertEquals(two_byte, JSON.parse(`"${two_byte}"`));
+const latin1_in_two_byte = JSON.parse(`["${'\xe9'.repeat(30)}", "ሴ"]`);
+assertEquals('\xe9'.repeat(30), latin1_in_two_byte[0]);
@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects with the same keys get the same map in separate parses.
+const a = JSON.parse('{"id": 1, "name": "a", "tags": []}');
+const b = JSON.parse('{"id": 2, "name": "b", "tags": [1]}');
+assertTrue(%HaveSameMap(a, b));
+assertEquals(2, b.id);
+assertEquals("b", b.name);
+assertEquals([1], b.tags);
+
+// Keys with the same lengths and first characters but different names.
+const c = JSON.parse('{"ix": 1, "nbme": "c", "tbgs": []}');
+assertFalse(%HaveSameMap(a, c));
+assertEquals(["ix", "nbme", "tbgs"], Object.keys(c));
+assertEquals(undefined, c.id);
+
+// A field whose representation changes.
+const d = JSON.parse('{"id": 1.5, "name": {}, "tags": "x"}');
+assertEquals(1.5, d.id);
+assertEquals({}, d.name);
+assertEquals("x", d.tags);
+const e = JSON.parse('{"id": 3, "name": "e", "tags": null}');
+assertTrue(%HaveSameMap(d, e));
+
+// Fewer keys than the cached map.
+const f = JSON.parse('{"id": 4, "name": "f"}');
+assertEquals(["id", "name"], Object.keys(f));
+
+// Elements mixed with named properties.
+const g = JSON.parse('{"0": 1, "id": 5, "name": "g", "tags": []}');
+assertEquals(["0", "id", "name", "tags"], Object.keys(g));
+assertEquals(1, g[0]);
+
+gc();
+const h = JSON.parse('{"id": 6, "name": "h", "tags": []}');
+assertEquals(["id", "name", "tags"], Object.keys(h));
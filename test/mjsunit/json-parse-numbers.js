@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON numbers with up to 19 significant digits are converted with the
+// Eisel-Lemire algorithm, longer ones with the generic conversion. Both have
+// to agree with Number() on every input.
+
+function check(text) {
+  assertSame(Number(text), JSON.parse(text), text);
+  assertSame(Number(text), JSON.parse('[' + text + ']')[0], text);
+}
+
+(function TestSimpleNumbers() {
+  for (const text of ['0', '-0', '0.0', '-0.0', '0e5', '-0E-5', '1.5', '-2.25',
+                      '1234567890', '12345678901', '0.1', '0.3', '1e23',
+                      '8.41e21', '3.14159E+2', '1.0000000000000002',
+                      '123456789012345678', '1234567890123456789',
+                      '12345678901234567890', '0.00000000000000000001']) {
+    check(text);
+  }
+})();
+
+(function TestLimits() {
+  for (const text of ['1.7976931348623157e308', '1.7976931348623159e308',
+                      '2.2250738585072011e-308', '2.2250738585072014e-308',
+                      '4.9406564584124654e-324', '2.4703282292062327e-324',
+                      '2.4703282292062328e-324', '1e-400', '-1e400',
+                      '1e99999999999999999999', '1e-99999999999999999999',
+                      '9007199254740993', '9007199254740995',
+                      '18446744073709551615', '18446744073709551616']) {
+    check(text);
+  }
+})();
+
+(function TestManyDigits() {
+  check('2.' + '2'.repeat(30) + 'e-308');
+  check('9007199254740992.' + '0'.repeat(30) + '1');
+  check('0.' + '0'.repeat(400) + '1e400');
+  check('1' + '0'.repeat(400) + 'e-400');
+})();
+
+(function TestRandomNumbers() {
+  let seed = 17;
+  function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+  }
+  for (let i = 0; i < 1000; i++) {
+    const exponent = Math.floor(random() * 40) - 20;
+    const value = (random() - 0.5) * Math.pow(10, exponent);
+    check(String(value));
+    check(value.toPrecision(1 + Math.floor(random() * 21)));
+    check(value.toExponential(Math.floor(random() * 21)));
+  }
+})();
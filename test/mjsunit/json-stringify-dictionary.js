@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function Dictionary(properties) {
+  // Deleting a property other than the last one normalizes the object.
+  const object = {tmp0: 0, tmp1: 0, ...properties};
+  delete object.tmp0;
+  delete object.tmp1;
+  assertFalse(%HasFastProperties(object));
+  return object;
+}
+
+// Properties keep the order of their creation.
+assertEquals('{"z":1,"y":"two","x":[3]}',
+             JSON.stringify(Dictionary({z: 1, y: 'two', x: [3]})));
+assertEquals('{}', JSON.stringify(Dictionary({})));
+
+// Non-enumerable, symbol and undefined properties are skipped.
+(function TestSkippedProperties() {
+  const object = Dictionary({b: 1, c: undefined});
+  Object.defineProperty(object, 'd', {value: 2, enumerable: false});
+  object[Symbol('e')] = 3;
+  object.f = 4;
+  assertEquals('{"b":1,"f":4}', JSON.stringify(object));
+})();
+
+// Accessors are called.
+(function TestAccessor() {
+  const object = Dictionary({b: 1});
+  Object.defineProperty(
+      object, 'c', {get() { return this.b + 1; }, enumerable: true});
+  assertEquals('{"b":1,"c":2}', JSON.stringify(object));
+})();
+
+// Properties deleted or changed while serializing other properties.
+(function TestMutationDuringSerialization() {
+  const object = Dictionary({b: 1, c: 2, d: 3});
+  object.b = {toJSON() { delete object.c; object.d = 4; return 'b'; }};
+  assertEquals('{"b":"b","d":4}', JSON.stringify(object));
+})();
+
+// A deleted property is looked up on the prototype.
+(function TestDeletedPropertyOnPrototype() {
+  const proto = {c: 'proto'};
+  const object = Object.setPrototypeOf(Dictionary({b: 1, c: 2}), proto);
+  object.b = {toJSON() { delete object.c; return 'b'; }};
+  assertEquals('{"b":"b","c":"proto"}', JSON.stringify(object));
+})();
+
+// Long strings with characters to escape at various positions.
+(function TestLongStrings() {
+  const clean = 'abcdefghijklmnopqrstuvwxyz0123456789'.repeat(10);
+  for (const special of ['"', '\\', '\n', '\x01', ' ', '\ud800',
+                         '\udc00', '😀', 'ÿ']) {
+    for (const position of [0, 1, 15, 16, 17, 31, 100, clean.length]) {
+      const string = clean.slice(0, position) + special + clean.slice(position);
+      const expected = '"' + clean.slice(0, position) +
+          JSON.stringify(special).slice(1, -1) + clean.slice(position) + '"';
+      assertEquals(expected, JSON.stringify(string));
+      assertEquals(string, JSON.parse(JSON.stringify(string)));
+      assertEquals('{"s":' + expected + '}',
+                   JSON.stringify(Dictionary({s: string})));
+    }
+  }
+  // Strings which don't fit into the current part of the result.
+  const long = clean.repeat(100) + '"' + clean.repeat(100) + 'ሴ';
+  assertEquals(long, JSON.parse(JSON.stringify(long)));
+  assertEquals([long, long], JSON.parse(JSON.stringify([long, long])));
+})();
@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+(function TestBoundFunctionChain() {
+  function f(a, b, c, d) {
+    return [this.name, a, b, c, d];
+  }
+  const receiver = { name: 'r' };
+  const g = f.bind(receiver, 1).bind({ name: 'ignored' }, 2);
+
+  function call(x, y) { return g(x, y); }
+
+  %PrepareFunctionForOptimization(call);
+  assertEquals(['r', 1, 2, 3, 4], call(3, 4));
+  assertEquals(['r', 1, 2, 3, 4], call(3, 4));
+  %OptimizeMaglevOnNextCall(call);
+  assertEquals(['r', 1, 2, 3, 4], call(3, 4));
+  assertEquals(['r', 1, 2, 'a', undefined], call('a'));
+})();
+
+(function TestBoundReceivers() {
+  function strict() { 'use strict'; return this; }
+  function sloppy() { return this; }
+  const bound_null = strict.bind(null);
+  const bound_undefined = strict.bind(undefined);
+  const bound_number = strict.bind(42);
+  const sloppy_null = sloppy.bind(null);
+
+  function call() {
+    return [bound_null(), bound_undefined(), bound_number(), sloppy_null()];
+  }
+
+  %PrepareFunctionForOptimization(call);
+  assertEquals([null, undefined, 42, globalThis], call());
+  assertEquals([null, undefined, 42, globalThis], call());
+  %OptimizeMaglevOnNextCall(call);
+  assertEquals([null, undefined, 42, globalThis], call());
+})();
+
+(function TestBoundBuiltin() {
+  const max = Math.max.bind(undefined, 7);
+
+  function call(a, b) { return max(a, b); }
+
+  %PrepareFunctionForOptimization(call);
+  assertEquals(7, call(1, 2));
+  assertEquals(9, call(9, 2));
+  %OptimizeMaglevOnNextCall(call);
+  assertEquals(7, call(1, 2));
+  assertEquals(9, call(1, 9));
+})();
@@ -0,0 +1,62 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+(function TestPrivateFieldsAndBrand() {
+  class Point {
+    #x = 1;
+    #y = 2;
+    #sum() { return this.#x + this.#y; }
+    static sum(p) { return p.#sum(); }
+  }
+
+  function make() { return new Point(); }
+
+  %PrepareFunctionForOptimization(make);
+  assertEquals(3, Point.sum(make()));
+  assertEquals(3, Point.sum(make()));
+  %OptimizeMaglevOnNextCall(make);
+  assertEquals(3, Point.sum(make()));
+  assertThrows(() => Point.sum({}), TypeError);
+})();
+
+(function TestRedefinitionThrows() {
+  class Base {
+    constructor(o) { return o; }
+  }
+  class Stamp extends Base {
+    #x = 1;
+    static has(o) { return #x in o; }
+  }
+
+  function stamp(o) { return new Stamp(o); }
+
+  %PrepareFunctionForOptimization(stamp);
+  stamp({});
+  stamp({});
+  %OptimizeMaglevOnNextCall(stamp);
+  const o = stamp({});
+  assertTrue(Stamp.has(o));
+  assertThrows(() => stamp(o), TypeError);
+  assertFalse(Stamp.has({}));
+})();
+
+(function TestComputedFieldNames() {
+  const key = 'computed';
+  class C {
+    [key] = 42;
+    ['fn'] = () => {};
+  }
+
+  function make() { return new C(); }
+
+  %PrepareFunctionForOptimization(make);
+  make();
+  make();
+  %OptimizeMaglevOnNextCall(make);
+  const c = make();
+  assertEquals(42, c.computed);
+  assertEquals('fn', c.fn.name);
+})();
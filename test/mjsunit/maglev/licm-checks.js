@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --maglev --maglev-licm --no-maglev-loop-peeling
+// Flags: --allow-natives-syntax
+
+// The heap object and map checks of {o}, and the load of {o.x}, don't depend
+// on the loop and are hoisted into the loop's pre-header.
+function sum(o, n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += o.x;
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(10, sum({x: 2}, 5));
+assertEquals(15, sum({x: 3}, 5));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(20, sum({x: 4}, 5));
+assertTrue(isMaglevved(sum));
+
+// Failing checks deopt before the loop.
+assertEquals(0, sum(1, 0));
+assertEquals(NaN, sum({y: 1}, 2));
+assertEquals(3, sum({x: 1}, 3));
+
+// A non-hoisted check keeps the loads of the same object in the loop.
+function sumIf(o, n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    if (i > 0) s += o.x;
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(sumIf);
+assertEquals(8, sumIf({x: 2}, 5));
+%OptimizeMaglevOnNextCall(sumIf);
+assertEquals(8, sumIf({x: 2}, 5));
+assertEquals(0, sumIf(1, 1));
@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-stress-opt
+// Flags: --no-baseline-batch-compilation --use-osr --turbofan
+// Flags: --max-bytecode-size-for-early-opt=0
+// Flags: --osr-from-maglev --osr-from-maglev-hot-loops
+// Flags: --concurrent-osr --concurrent-recompilation
+
+let keep_going = 10000000;  // A counter to avoid test hangs on failure.
+
+function f(n, osr) {
+  let sum = 0;
+  for (let i = 0; i < n && !%CurrentFrameIsTurbofan() && --keep_going; i++) {
+    if (osr) %OptimizeOsr();
+    sum += i;
+  }
+  return sum;
+}
+%PrepareFunctionForOptimization(f);
+
+// OSR once, which records that {f} has a long-running loop.
+assertEquals(45, f(10, true));
+
+// Regular (non-OSR) Maglev code of {f} can OSR into Turbofan.
+%OptimizeMaglevOnNextCall(f);
+assertEquals(45, f(10, false));
+assertTrue(isMaglevved(f) || isTurboFanned(f));
+f(100000000, false);
+assertTrue(keep_going > 0);
@@ -0,0 +1,75 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --maglev --maglev-inlining --maglev-polymorphic-inlining
+// Flags: --allow-natives-syntax
+
+(function TestKnownTargets() {
+  class Circle { area() { return 3 * this.r * this.r; } }
+  class Square { area() { return this.r * this.r; } }
+  function Shape(r, round) {
+    const shape = round ? new Circle() : new Square();
+    shape.r = r;
+    return shape;
+  }
+
+  function area(shape) {
+    return shape.area();
+  }
+
+  const circle = Shape(2, true);
+  const square = Shape(2, false);
+  %PrepareFunctionForOptimization(area);
+  assertEquals(12, area(circle));
+  assertEquals(4, area(square));
+  %OptimizeMaglevOnNextCall(area);
+  assertEquals(12, area(circle));
+  assertEquals(4, area(square));
+  assertTrue(isMaglevved(area));
+
+  // An object with another map deopts before the call.
+  assertEquals(7, area({area() { return 7; }}));
+})();
+
+(function TestClosures() {
+  function makeAdder(n) {
+    return (x) => x + n;
+  }
+  function makeMultiplier(n) {
+    return (x) => x * n;
+  }
+
+  function apply(b, x) {
+    const f = b ? makeAdder(x) : makeMultiplier(x);
+    return f(3);
+  }
+
+  %PrepareFunctionForOptimization(apply);
+  %PrepareFunctionForOptimization(makeAdder);
+  %PrepareFunctionForOptimization(makeMultiplier);
+  assertEquals(5, apply(true, 2));
+  assertEquals(6, apply(false, 2));
+  %OptimizeMaglevOnNextCall(apply);
+  assertEquals(7, apply(true, 4));
+  assertEquals(12, apply(false, 4));
+})();
+
+(function TestDeoptInTarget() {
+  function one() { return 1; }
+  function two(x) { return x + 1; }
+
+  function call(b, x) {
+    const f = b ? one : two;
+    return f(x);
+  }
+
+  %PrepareFunctionForOptimization(call);
+  assertEquals(1, call(true, 1));
+  assertEquals(2, call(false, 1));
+  %OptimizeMaglevOnNextCall(call);
+  assertEquals(1, call(true, 1));
+  assertEquals(2, call(false, 1));
+  // Deopts in the inlined {two}.
+  assertEquals("a1", call(false, "a"));
+})();
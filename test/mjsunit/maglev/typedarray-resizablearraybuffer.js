@@ -812,3 +812,105 @@ assertEquals(4, ByteOffset(ta));
 assertEquals(4, ByteOffset(ta));
 assertOptimized(ByteOffset);
 })();
+
+(function() {
+function Sum_TA_RAB_LengthTracking(ta) {
+  let sum = 0;
+  for (let i = 0; i < ta.length; ++i) {
+    sum += ta[i];
+  }
+  return sum;
+}
+const Sum = Sum_TA_RAB_LengthTracking;
+
+const rab = CreateResizableArrayBuffer(16, 40);
+FillBuffer(rab);
+const ta = new Uint8Array(rab, 8);
+
+%PrepareFunctionForOptimization(Sum);
+assertEquals(92, Sum(ta));
+assertEquals(92, Sum(ta));
+%OptimizeMaglevOnNextCall(Sum);
+assertEquals(92, Sum(ta));
+assertOptimized(Sum);
+rab.resize(32);
+FillBuffer(rab);
+assertEquals(468, Sum(ta));
+rab.resize(10);
+assertEquals(17, Sum(ta));
+rab.resize(4);
+assertEquals(0, Sum(ta));
+assertOptimized(Sum);
+})();
+
+(function() {
+function Store_TA_RAB_LengthTracking(ta, index, value) {
+  ta[index] = value;
+}
+const Store = Store_TA_RAB_LengthTracking;
+
+const rab = CreateResizableArrayBuffer(16, 40);
+const ta = new Int32Array(rab);
+
+%PrepareFunctionForOptimization(Store);
+Store(ta, 0, 1);
+Store(ta, 3, 2);
+%OptimizeMaglevOnNextCall(Store);
+Store(ta, 1, 3);
+assertOptimized(Store);
+assertEquals([1, 3, 0, 2], ToNumbers(ta));
+rab.resize(24);
+Store(ta, 5, 4);
+assertEquals([1, 3, 0, 2, 0, 4], ToNumbers(ta));
+assertOptimized(Store);
+rab.resize(8);
+// Storing out of bounds deopts.
+Store(ta, 5, 5);
+assertEquals([1, 3], ToNumbers(ta));
+})();
+
+(function() {
+function Read_TA_RAB_FixedLength(ta, index) {
+  return ta[index];
+}
+const Get = Read_TA_RAB_FixedLength;
+
+const rab = CreateResizableArrayBuffer(16, 40);
+FillBuffer(rab);
+const ta = new Uint16Array(rab, 0, 4);
+
+%PrepareFunctionForOptimization(Get);
+assertEquals(asU16(0), Get(ta, 0));
+assertEquals(asU16(3), Get(ta, 3));
+%OptimizeMaglevOnNextCall(Get);
+assertEquals(asU16(1), Get(ta, 1));
+assertOptimized(Get);
+rab.resize(40);
+assertEquals(asU16(3), Get(ta, 3));
+assertOptimized(Get);
+// The array is out of bounds, so all accesses deopt.
+rab.resize(6);
+assertEquals(undefined, Get(ta, 0));
+})();
+
+(function() {
+function Read_TA_GSAB_LengthTracking(ta, index) {
+  return ta[index];
+}
+const Get = Read_TA_GSAB_LengthTracking;
+
+const gsab = CreateGrowableSharedArrayBuffer(16, 40);
+FillBuffer(gsab);
+const ta = new Uint8Array(gsab, 4);
+
+%PrepareFunctionForOptimization(Get);
+assertEquals(4, Get(ta, 0));
+assertEquals(15, Get(ta, 11));
+%OptimizeMaglevOnNextCall(Get);
+assertEquals(5, Get(ta, 1));
+assertOptimized(Get);
+gsab.grow(32);
+FillBuffer(gsab);
+assertEquals(31, Get(ta, 27));
+assertOptimized(Get);
+})();
@@ -0,0 +1,24 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --perf-prof-buffered
+// Flags: --compact-code-space --stress-compaction --expose-gc
+// Flags: --allow-natives-syntax
+
+// Code creation and code moves are written to the jitdump file from a
+// background thread.
+
+function add(a, b) {
+  return a + b;
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(7, add(3, 4));
+
+for (let i = 0; i < 3; i++) {
+  gc();
+  assertEquals(11, add(5, 6));
+}
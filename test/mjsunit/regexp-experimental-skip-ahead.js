@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-skip-ahead
+
+// The experimental engine skips input positions at which no match can start.
+// Compare its results with those of the backtracking engine.
+function Test(source, flags, subject) {
+  const linear = new RegExp(source, flags + 'l');
+  const backtracking = new RegExp(source, flags);
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(linear));
+  assertEquals(JSON.stringify(backtracking.exec(subject)),
+               JSON.stringify(linear.exec(subject)));
+  assertEquals(backtracking.lastIndex, linear.lastIndex);
+  assertEquals(subject.replace(new RegExp(source, flags + 'g'), '<$&>'),
+               subject.replace(new RegExp(source, flags + 'gl'), '<$&>'));
+}
+
+const kLong = 'x'.repeat(1000);
+const subjects = [
+  '', 'a', 'abc', 'xxabcxx', kLong + 'abc' + kLong, kLong + 'ab',
+  'ab\nc ab c', kLong + 'b' + kLong + 'cab', 'ÄbcÄbc', '쁰d섊abc쁰d',
+];
+const patterns = [
+  'abc', 'a|b', '[bc]+', 'a.c', 'b*c', '(a)(b)?c', '(?:ab|c)+', '^ab',
+  'c$', '\\bab', '\\Bb', 'ab|x*', 'x*', '(x|y)*?ab', '[^x]', 'Äb', 'd섊',
+  '(?:)', 'a{2,}', '\\w+',
+];
+for (const pattern of patterns) {
+  for (const subject of subjects) {
+    Test(pattern, '', subject);
+    Test(pattern, 'm', subject);
+    Test(pattern, 's', subject);
+    Test(pattern, 'y', subject);
+  }
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replace with a function and a regexp with captures passes the
+// arguments of each match straight from the collected matches.
+
+(function TestArguments() {
+  const calls = [];
+  const result = 'a1b22c333'.replace(/([a-z])(\d+)(x)?/g, function() {
+    calls.push([...arguments]);
+    return arguments[2].length;
+  });
+  assertEquals('123', result);
+  assertEquals([
+    ['a1', 'a', '1', undefined, 0, 'a1b22c333'],
+    ['b22', 'b', '22', undefined, 2, 'a1b22c333'],
+    ['c333', 'c', '333', undefined, 5, 'a1b22c333'],
+  ], calls);
+})();
+
+(function TestReceiver() {
+  'use strict';
+  'ab'.replace(/(.)/g, function() {
+    assertEquals(undefined, this);
+    return '';
+  });
+})();
+
+(function TestNamedGroups() {
+  const result = '2024-01 1999-12'.replace(
+      /(?<year>\d+)-(?<month>\d+)/g,
+      (match, year, month, index, subject, groups) => {
+        assertEquals(year, groups.year);
+        assertEquals(month, groups.month);
+        assertEquals(subject.substring(index, index + match.length), match);
+        return `${groups.month}/${groups.year}`;
+      });
+  assertEquals('01/2024 12/1999', result);
+})();
+
+(function TestCachedResults() {
+  // Long subjects hit the results cache on the second replace.
+  const subject = 'ab'.repeat(0x1000);
+  const re = /(a)(b)/g;
+  for (let i = 0; i < 2; i++) {
+    let count = 0;
+    const result = subject.replace(re, (match, a, b, index) => {
+      assertEquals('a', a);
+      assertEquals('b', b);
+      assertEquals(count++ * 2, index);
+      return b + a;
+    });
+    assertEquals('ba'.repeat(0x1000), result);
+    assertEquals('b', RegExp.$2);
+  }
+})();
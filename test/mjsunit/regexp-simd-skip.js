@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd-skip --no-regexp-tier-up
+
+// Native regexp code scans for the characters which a match can start with.
+// Check matches at all positions relative to the 16-byte vectors, in one-byte
+// and two-byte subjects.
+function Test(regexp, needle, filler) {
+  for (let length = 0; length < 70; length++) {
+    for (const at of [0, 1, 15, 16, 17, 31, 32, length]) {
+      if (at > length) continue;
+      const subject =
+          filler.repeat(at) + needle + filler.repeat(length - at);
+      const expected = subject.indexOf(needle);
+      const match = regexp.exec(subject);
+      assertNotNull(match, `${regexp} on ${subject}`);
+      assertEquals(expected, match.index, `${regexp} on ${subject}`);
+      assertNull(regexp.exec(filler.repeat(length)));
+    }
+  }
+}
+
+// Literal prefixes.
+Test(/abcdef/, 'abcdef', 'x');
+Test(/needle/, 'needle', 'e');
+Test(/xyz/, 'xyz', 'ሴ');
+Test(/ሴ噸ሴ/, 'ሴ噸ሴ', 'y');
+// Characters which only differ above the low 7 bits of the filler.
+Test(/šbc/, 'šbc', 'a');
+Test(/abcd/, 'abcd', 'á');
+Test(/áâãä/, 'áâãä', 'a');
+// Small sets of characters.
+Test(/[ab]ccc/, 'bccc', 'x');
+Test(/(?:foo|bar)baz/, 'barbaz', 'z');
+Test(/(?:foo|bar)baz/, 'foobaz', ' ');
+Test(/[ab]cdef/i, 'Acdef', 'x');
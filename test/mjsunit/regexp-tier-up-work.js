@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1 --regexp-tier-up-work=100
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+function IsInterpreted(re) {
+  return %RegexpHasBytecode(re, kLatin1) && !%RegexpHasNativeCode(re, kLatin1);
+}
+
+function IsCompiled(re) {
+  return !%RegexpHasBytecode(re, kLatin1) && %RegexpHasNativeCode(re, kLatin1);
+}
+
+// A regexp which only runs on a few tiny subjects stays interpreted.
+(function TestTinySubjects() {
+  const re = /^a.$/;
+  for (let i = 0; i < 5; i++) {
+    assertTrue(re.test('ab'));
+    assertTrue(IsInterpreted(re));
+  }
+  // Enough executions accumulate enough work to tier up.
+  for (let i = 0; i < 200; i++) re.test('ab');
+  assertTrue(IsCompiled(re));
+})();
+
+// A single execution which does a lot of work tiers up right away.
+(function TestExpensiveExecution() {
+  const re = /(a|b)*c/;
+  assertFalse(re.test('ab'.repeat(200)));
+  assertTrue(IsInterpreted(re));
+  assertFalse(re.test('ab'));
+  assertTrue(IsCompiled(re));
+})();
+
+// A very long subject tiers up an interpreted regexp as well.
+(function TestLongSubject() {
+  const re = /x/;
+  assertFalse(re.test('a'));
+  assertTrue(IsInterpreted(re));
+  assertTrue(re.test('a'.repeat(2000) + 'x'));
+  assertTrue(IsCompiled(re));
+})();
@@ -4,7 +4,7 @@
 
 // Tier-up behavior differs between slow and fast paths in
 // RegExp.prototype.replace with a function as an argument.
-// Flags: --regexp-tier-up --regexp-tier-up-ticks=1
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1 --regexp-tier-up-work=0
 // Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
 // Flags: --no-enable-experimental-regexp-engine
 
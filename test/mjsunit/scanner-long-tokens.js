@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The scanner skips long identifiers, strings, comments and whitespace runs a
+// block of characters at a time. Check tokens and positions around the block
+// boundaries, by prefixing the source with padding of every length up to two
+// blocks.
+
+function pad(n) {
+  return 'x'.repeat(n);
+}
+
+(function TestIdentifiers() {
+  for (let n = 0; n < 20; n++) {
+    const name = 'a' + pad(n) + 'Z$_09';
+    assertEquals(name, eval(`var ${name} = '${name}'; ${name}`));
+  }
+  // Long keywords are still recognized after skipped blocks.
+  assertTrue(eval('[] instanceof Array'));
+  assertThrows(() => eval('"use strict"; var implements = 1;'), SyntaxError);
+  assertThrows(() => eval('"use strict"; var interface = 1;'), SyntaxError);
+  assertEquals(1, eval('var instanceofx = 1; instanceofx'));
+  assertEquals(2, eval('var abcdefghijkl\\u0041 = 2; abcdefghijklA'));
+  assertEquals(3, eval('var abcdefghijklé = 3; abcdefghijklé'));
+})();
+
+(function TestStrings() {
+  for (let n = 0; n < 20; n++) {
+    const s = pad(n);
+    assertEquals(s + '"\n', eval(`'${s}"\\n'`));
+    assertEquals(s + "'", eval(`"${s}'"`));
+    assertEquals(s + 'é' + s, eval(`'${s}é${s}'`));
+    assertEquals(s + ' ' + s, eval(`'${s} ${s}'`));
+    assertThrows(() => eval(`'${s}\n'`), SyntaxError);
+  }
+})();
+
+(function TestCommentsAndWhitespace() {
+  for (let n = 0; n < 20; n++) {
+    const s = pad(n);
+    assertEquals(1, eval(`// ${s}\n1`));
+    assertEquals(2, eval(`// ${s}  2`));
+    assertEquals(3, eval(`/* ${s} */ 3`));
+    assertEquals(4, eval(`/* ${s} ** / ${s} **/ 4`));
+    // A line terminator in a whitespace run or comment inserts a semicolon.
+    assertEquals(5, eval(`var a = 5${' '.repeat(n)}\n${' '.repeat(n)}a`));
+    assertEquals(6, eval(`var b = 6 /* ${s}\n${s} */ b`));
+    assertEquals(7, eval(`var c = 7 /* ${s}  */ c`));
+    assertThrows(() => eval(`/* ${s} *`), SyntaxError);
+  }
+})();
+
+(function TestPositions() {
+  for (let n = 0; n < 20; n++) {
+    const source = ' '.repeat(n) + `/* ${pad(n)} */'${pad(n)}';` +
+        `${'a' + pad(n)}; throw new Error();`;
+    try {
+      eval(source);
+      assertUnreachable();
+    } catch (e) {
+      assertInstanceof(e, ReferenceError);
+      assertTrue(e.stack.includes(':1:' + (source.indexOf('a') + 1)));
+    }
+  }
+})();
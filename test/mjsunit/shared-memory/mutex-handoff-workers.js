@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-struct --allow-natives-syntax
+// Flags: --js-atomics-mutex-handoff-threshold-ms=0
+
+"use strict";
+
+(function TestUncontendedStats() {
+  let mutex = new Atomics.Mutex();
+  let stats = %AtomicsMutexContentionStatsForTesting();
+  for (let i = 0; i < 10; i++) {
+    Atomics.Mutex.lock(mutex, function() {});
+  }
+  assertEquals(stats, %AtomicsMutexContentionStatsForTesting());
+  // Uncontended locking doesn't change how long contended locking spins.
+  let spinCount = %AtomicsMutexSpinCountForTesting(mutex);
+  assertTrue(spinCount > 0);
+  assertEquals(spinCount, %AtomicsMutexSpinCountForTesting(mutex));
+})();
+
+if (this.Worker) {
+
+(function TestHandOffToParkedWorker() {
+  let workerScript =
+      `onmessage = function({data:msg}) {
+         let before = %AtomicsMutexContentionStatsForTesting();
+         Atomics.Mutex.lock(msg.mutex, function() {
+           msg.box.owner = 'worker';
+         });
+         let after = %AtomicsMutexContentionStatsForTesting();
+         postMessage({
+           contended: after.contended - before.contended,
+           parked: after.parked - before.parked,
+           handedOff: after.handedOff - before.handedOff
+         });
+       };
+       postMessage("started");`;
+
+  let worker = new Worker(workerScript, { type: 'string' });
+  assertEquals("started", worker.getMessage());
+
+  let Box = new SharedStructType(['owner']);
+  let box = new Box();
+  let mutex = new Atomics.Mutex();
+  Atomics.Mutex.lock(mutex, function() {
+    box.owner = 'main';
+    worker.postMessage({ mutex, box });
+    // Wait for the worker to park on the mutex, so that unlocking hands the
+    // mutex over to it.
+    while (%AtomicsSynchronizationPrimitiveNumWaitersForTesting(mutex) !== 1) {}
+  });
+
+  let stats = worker.getMessage();
+  assertEquals('worker', box.owner);
+  assertEquals(1, stats.contended);
+  assertTrue(stats.parked >= 1);
+  assertEquals(1, stats.handedOff);
+  worker.terminate();
+})();
+
+}
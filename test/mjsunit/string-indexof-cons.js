@@ -0,0 +1,76 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long cons strings are searched segment by segment, without flattening them.
+// Check matches within segments, across segments and after many segments.
+
+function naiveIndexOf(subject, search, start) {
+  for (let i = start; i + search.length <= subject.length; i++) {
+    if (subject.substring(i, i + search.length) === search) return i;
+  }
+  return -1;
+}
+
+function buildRope(pieces) {
+  let rope = '';
+  for (const piece of pieces) rope += piece;
+  return rope;
+}
+
+function check(pieces, searches) {
+  const flat = pieces.join('');
+  for (const search of searches) {
+    for (const start of [0, 1, 5, 100, 1000, flat.length - 50]) {
+      if (start < 0) continue;
+      const expected = naiveIndexOf(flat, search, start);
+      assertEquals(expected, buildRope(pieces).indexOf(search, start));
+      assertEquals(expected >= 0, buildRope(pieces).includes(search, start));
+    }
+    const rope = buildRope(pieces);
+    for (const position of [0, 7, 1023, flat.length - search.length]) {
+      assertEquals(flat.startsWith(search, position),
+                   rope.startsWith(search, position));
+      assertEquals(flat.endsWith(search, position + search.length),
+                   rope.endsWith(search, position + search.length));
+    }
+  }
+}
+
+(function TestFewLongSegments() {
+  const pieces = [];
+  for (let i = 0; i < 8; i++) pieces.push('abcdefghij'.repeat(30) + i);
+  check(pieces,
+        ['a', 'j0', '0abc', '7', 'hij4abcde', 'ij7', 'xyz', 'j'.repeat(40)]);
+})();
+
+(function TestManyShortSegments() {
+  const pieces = [];
+  for (let i = 0; i < 500; i++) pieces.push('<td>' + i + '</td>');
+  check(pieces, ['<td>499</td>', '9</td><td>2', '</td><td>10</td>', 'tr']);
+})();
+
+(function TestShortSegmentsBetweenLongOnes() {
+  const long = 'x'.repeat(700);
+  const pieces = [long, 'a', 'b', 'c', long, 'd', long];
+  check(pieces, ['xabcx', 'abc', 'cxxx', 'xdx', 'xxd', 'dxx', 'ab' + long]);
+})();
+
+(function TestTwoByte() {
+  const pieces = [];
+  for (let i = 0; i < 20; i++) pieces.push('中文'.repeat(40) + i);
+  pieces.push('\u{1F60D}');
+  check(pieces, ['文1', '9中', '\u{1F60D}', '\uDE0D', '19\uD83D', '1a']);
+})();
+
+(function TestConstructedConsString() {
+  const rope = %ConstructConsString('a'.repeat(600), 'b'.repeat(600));
+  assertEquals(599, rope.indexOf('ab'));
+  assertTrue(rope.includes('abbb'));
+  assertTrue(rope.startsWith('aab', 598));
+  assertEquals(-1, rope.indexOf('ba'));
+  %FlattenString(rope);
+  assertEquals(599, rope.indexOf('ab'));
+})();
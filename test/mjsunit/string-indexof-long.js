@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches in long one- and two-byte subjects, with matches and near matches
+// (first and last character only) at every position around block boundaries.
+
+function NaiveIndexOf(subject, pattern, start) {
+  outer: for (let i = start; i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[i + j] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+const kFillers = ['a', 'ā'];
+const kPatterns = ['ab', 'abc', 'axb', 'abcdefgh', 'aaaaaaab', 'bāb',
+                   'āĂ', 'a'.repeat(20) + 'b', '\0b'];
+
+for (const filler of kFillers) {
+  for (const pattern of kPatterns) {
+    const near = pattern[0] + filler.repeat(pattern.length - 2) +
+        pattern[pattern.length - 1];
+    for (let position = 0; position < 40; position++) {
+      const subject = filler.repeat(position) + near + filler.repeat(50) +
+                      pattern + filler.repeat(position);
+      const expected = NaiveIndexOf(subject, pattern, 0);
+      assertEquals(expected, subject.indexOf(pattern));
+      assertEquals(expected != -1, subject.includes(pattern));
+      assertEquals(NaiveIndexOf(subject, pattern, position + 1),
+                   subject.indexOf(pattern, position + 1));
+      if (expected != -1) {
+        assertEquals(subject.split(pattern).join(pattern), subject);
+        assertEquals(subject.replaceAll(pattern, '').length,
+                     subject.length - pattern.length *
+                         (subject.split(pattern).length - 1));
+      }
+    }
+  }
+}
+
+// A two-byte pattern never matches in a one-byte subject.
+assertEquals(-1, 'a'.repeat(100).indexOf('aĀ'));
+assertEquals(-1, 'a'.repeat(100).indexOf('ša'));
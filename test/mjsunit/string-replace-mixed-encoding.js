@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replacing in a one-byte subject with two-byte replacements, and the other
+// way around. The result is built in a single pre-sized part, which switches
+// to two-byte encoding when the first two-byte piece is appended.
+
+function check(subject, pattern, replacement) {
+  const expected = subject.split(pattern).join(
+      typeof replacement === 'function' ? replacement() : replacement);
+  assertEquals(expected, subject.replaceAll(pattern, replacement));
+}
+
+const one_byte = 'abc-'.repeat(50) + 'xyz' + '-def'.repeat(50);
+const two_byte = '中文-'.repeat(50) + 'xyz' + '-文中'.repeat(50);
+
+(function TestStringPattern() {
+  check(one_byte, /xyz/g, '中');
+  check(one_byte, /xyz/g, 'ü');
+  check(one_byte, /b/g, '\u{1F60D}');
+  check(two_byte, /xyz/g, 'abc');
+  check(two_byte, /文/g, 'a');
+})();
+
+(function TestSubstitutions() {
+  assertEquals('abc-中xyz中-def',
+               'abc-xyz-def'.replace(/-(xyz)-/, '-中$1中-'));
+  assertEquals('中'.repeat(40) + '[abc]',
+               ('中'.repeat(40) + 'abc').replace(/abc/, '[$&]'));
+  assertEquals('a'.repeat(40) + '<中>',
+               ('a'.repeat(40) + '中').replace(/中/, '<$&>'));
+})();
+
+(function TestFunctionReplacement() {
+  check(one_byte, /xyz/g, () => 'ü中');
+  check(one_byte, /-/g, () => 'é');
+  assertEquals(one_byte.replace('xyz', '中'),
+               one_byte.replace(/xyz/, function() { return '中'; }));
+})();
+
+(function TestSymbolReplace() {
+  const re = /xyz/g;
+  re.exec = function() {
+    const result = RegExp.prototype.exec.call(this, ...arguments);
+    return result;
+  };
+  assertEquals(one_byte.replaceAll('xyz', '中'), one_byte.replace(re, '中'));
+})();
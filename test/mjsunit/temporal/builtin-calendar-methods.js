@@ -0,0 +1,94 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+// Flags: --harmony-temporal
+
+// The built-in calendar and time zone methods are called without entering
+// JavaScript when they are found on built-in calendars and time zones. Check
+// that the methods are still looked up on each use, and that replaced methods
+// and methods of other realms are called as before.
+
+(function TestBuiltinMethods() {
+  const date = new Temporal.PlainDate(2024, 2, 29);
+  assertEquals(2024, date.year);
+  assertEquals(2, date.month);
+  assertEquals('M02', date.monthCode);
+  assertEquals(29, date.day);
+  assertEquals(4, date.dayOfWeek);
+  assertEquals(60, date.dayOfYear);
+  assertEquals(9, date.weekOfYear);
+  assertEquals(29, date.daysInMonth);
+  assertEquals(366, date.daysInYear);
+  assertEquals(true, date.inLeapYear);
+  assertEquals('2025-02-28', date.add({years: 1}).toString());
+  assertEquals('P1M', date.until('2024-03-29', {largestUnit: 'months'})
+                          .toString());
+  assertEquals('2024-03-31', date.with({month: 3, day: 31}).toString());
+  const instant = Temporal.Instant.fromEpochSeconds(0);
+  assertEquals('1970-01-01T00:00:00+00:00',
+               instant.toString({timeZone: 'UTC'}));
+})();
+
+(function TestMethodsAreLookedUp() {
+  const calendar = new Temporal.Calendar('iso8601');
+  const date = new Temporal.PlainDate(2024, 2, 29, calendar);
+  const log = [];
+  for (const name of ['year', 'dateAdd', 'dateUntil', 'dateFromFields']) {
+    const builtin = Temporal.Calendar.prototype[name];
+    Object.defineProperty(calendar, name, {
+      get() {
+        log.push(name);
+        return builtin;
+      },
+      configurable: true
+    });
+  }
+  assertEquals(2024, date.year);
+  assertEquals('2024-03-01', date.add({days: 1}).toString());
+  assertEquals(1, date.until(new Temporal.PlainDate(2024, 3, 29, calendar),
+                             {largestUnit: 'months'}).months);
+  assertEquals('2024-03-29', date.with({month: 3}).toString());
+  assertTrue(log.includes('year'));
+  assertTrue(log.includes('dateAdd'));
+  assertTrue(log.includes('dateUntil'));
+  assertTrue(log.includes('dateFromFields'));
+})();
+
+(function TestReplacedMethods() {
+  const calendar = new Temporal.Calendar('iso8601');
+  calendar.year = function(date) {
+    assertSame(calendar, this);
+    return 1999;
+  };
+  calendar.dateAdd = function(date, duration, options) {
+    return Temporal.Calendar.prototype.dateAdd.call(
+        this, date, duration.negated(), options);
+  };
+  const date = new Temporal.PlainDate(2024, 2, 29, calendar);
+  assertEquals(1999, date.year);
+  assertEquals('2024-02-28', date.add({days: 1}).toString());
+
+  const timeZone = new Temporal.TimeZone('UTC');
+  timeZone.getOffsetNanosecondsFor = () => 3600e9;
+  assertEquals('1970-01-01T01:00:00+01:00',
+               Temporal.Instant.fromEpochSeconds(0).toString({timeZone}));
+})();
+
+(function TestMethodsThrow() {
+  const calendar = new Temporal.Calendar('iso8601');
+  const date = new Temporal.PlainDate(2024, 1, 31, calendar);
+  assertEquals('2024-02-29', date.add({months: 1}).toString());
+  assertThrows(() => date.add({months: 1}, {overflow: 'reject'}), RangeError);
+  assertThrows(() => calendar.year.call({}, date), TypeError);
+})();
+
+(function TestOtherRealm() {
+  const realm = Realm.createAllowCrossRealmAccess();
+  const other = Realm.global(realm).Temporal;
+  const calendar = new Temporal.Calendar('iso8601');
+  calendar.dateAdd = other.Calendar.prototype.dateAdd;
+  const date = new Temporal.PlainDate(2024, 2, 29, calendar);
+  const added = date.add({days: 1});
+  assertEquals('2024-03-01', added.toString());
+  assertSame(other.PlainDate.prototype, Object.getPrototypeOf(added));
+})();
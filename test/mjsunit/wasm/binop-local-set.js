@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Binary operations whose result is stored into a local, also while the old
+// value of the local is still on the stack.
+const builder = new WasmModuleBuilder();
+
+builder.addFunction('add', kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 0,
+      kExprLocalGet, 0
+    ])
+    .exportFunc();
+
+builder.addFunction('addShared', kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 0,
+      kExprLocalGet, 0, kExprI32Sub
+    ])
+    .exportFunc();
+
+builder.addFunction('mulLoop', makeSig([kWasmF64, kWasmI32], [kWasmF64]))
+    .addLocals(kWasmF64, 1)
+    .addBody([
+      ...wasmF64Const(1), kExprLocalSet, 2,
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 2, kExprLocalGet, 0, kExprF64Mul, kExprLocalSet, 2,
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 1,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 2
+    ])
+    .exportFunc();
+
+const {add, addShared, mulLoop} = builder.instantiate().exports;
+assertEquals(5, add(2, 3));
+assertEquals(-1, add(0x7fffffff, 0x80000000));
+assertEquals(-3, addShared(2, 3));
+assertEquals(1024, mulLoop(2, 10));
+assertEquals(1, mulLoop(1, 100));
@@ -0,0 +1,41 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-hot-code-region --liftoff
+// Flags: --wasm-dynamic-tiering --stress-wasm-code-gc
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const kNumFunctions = 20;
+for (let i = 0; i < kNumFunctions; i++) {
+  builder.addFunction('f' + i, kSig_i_i)
+      .addBody([kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add])
+      .exportFunc();
+}
+// Calls all other functions, so that tiered-up code calls into both Liftoff
+// and tiered-up code through the jump table.
+builder.addFunction('sum', kSig_i_i)
+    .addBody([
+      ...wasmI32Const(0),
+      ...[...Array(kNumFunctions).keys()].flatMap(
+          i => [kExprLocalGet, 0, kExprCallFunction, i, kExprI32Add]),
+    ])
+    .exportFunc();
+
+const exports = builder.instantiate().exports;
+const expected = n => kNumFunctions * n + (kNumFunctions - 1) * kNumFunctions / 2;
+
+assertEquals(expected(3), exports.sum(3));
+for (let i = 0; i < kNumFunctions; i += 2) {
+  %WasmTierUpFunction(exports['f' + i]);
+  assertTrue(%IsTurboFanFunction(exports['f' + i]));
+  assertEquals(5 + i, exports['f' + i](5));
+}
+%WasmTierUpFunction(exports.sum);
+assertTrue(%IsTurboFanFunction(exports.sum));
+assertEquals(expected(7), exports.sum(7));
+// Trigger a code GC, which frees the replaced Liftoff code.
+gc();
+assertEquals(expected(11), exports.sum(11));
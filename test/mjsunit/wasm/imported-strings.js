@@ -41,6 +41,10 @@ let interestingStrings = [
   'ab \ud800',         // Lone lead surrogate at the end.
   'ab \udc00',         // Lone trail surrogate at the end.
   'a \udc00\ud800 b',  // Swapped surrogate pair.
+  // Longer than a few words, for word-wise ASCII fast paths.
+  'a longer ascii string that spans several words',
+  'a longer ascii prefix followed by latin\xe91',
+  'a longer ascii prefix followed by \ucccc two-byte',
 ];
 
 function IsSurrogate(codepoint) {
@@ -0,0 +1,107 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation --liftoff-loop-register-locals=4
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const imp = builder.addImport('m', 'f', kSig_i_i);
+
+// Locals 1 to 4 are in registers when entering the loop.
+function loopBody(call) {
+  return [
+    kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 1,
+    kExprLocalGet, 0, kExprI32Const, 2, kExprI32Mul, kExprLocalSet, 2,
+    kExprLocalGet, 0, kExprI32Const, 3, kExprI32Xor, kExprLocalSet, 3,
+    kExprLocalGet, 0, kExprI32Const, 4, kExprI32Sub, kExprLocalSet, 4,
+    kExprLoop, kWasmVoid,
+      // a += b
+      kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 1,
+      // if (a & 1) c ^= a else { c += d; d = f(d) }
+      kExprLocalGet, 1, kExprI32Const, 1, kExprI32And,
+      kExprIf, kWasmVoid,
+        kExprLocalGet, 3, kExprLocalGet, 1, kExprI32Xor, kExprLocalSet, 3,
+      kExprElse,
+        kExprLocalGet, 3, kExprLocalGet, 4, kExprI32Add, kExprLocalSet, 3,
+        kExprLocalGet, 4,
+        ...(call ? [kExprCallFunction, imp] : [kExprI32Const, 1, kExprI32Add]),
+        kExprLocalSet, 4,
+      kExprEnd,
+      // if (--n != 0) continue
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+      kExprBrIf, 0,
+    kExprEnd,
+    kExprLocalGet, 1, kExprLocalGet, 3, kExprI32Xor, kExprLocalGet, 4,
+    kExprI32Add
+  ];
+}
+
+builder.addFunction('loop', kSig_i_i)
+    .addLocals(kWasmI32, 4)
+    .addBody(loopBody(false))
+    .exportFunc();
+builder.addFunction('loopWithCall', kSig_i_i)
+    .addLocals(kWasmI32, 4)
+    .addBody(loopBody(true))
+    .exportFunc();
+
+// A branch to the loop from a nested block, while a value which is not a
+// local is on the stack.
+builder.addFunction('nestedBranch', kSig_i_i)
+    .addLocals(kWasmI32, 2)
+    .addBody([
+      kExprLocalGet, 0, kExprI32Const, 7, kExprI32Add, kExprLocalSet, 1,
+      kExprLocalGet, 1,
+      kExprLoop, kWasmVoid,
+        kExprBlock, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 0, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 2, kExprLocalSet, 1,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 1,
+        kExprEnd,
+      kExprEnd,
+      kExprLocalGet, 1, kExprI32Add
+    ])
+    .exportFunc();
+
+function loop(n, f) {
+  let a = (n + 1) | 0;
+  const b = Math.imul(n, 2);
+  let c = n ^ 3;
+  let d = (n - 4) | 0;
+  do {
+    a = (a + b) | 0;
+    if (a & 1) {
+      c ^= a;
+    } else {
+      c = (c + d) | 0;
+      d = f(d) | 0;
+    }
+    n = (n - 1) | 0;
+  } while (n != 0);
+  return ((a ^ c) + d) | 0;
+}
+
+function nestedBranch(n) {
+  const initial = (n + 7) | 0;
+  let x = initial;
+  do {
+    x = (x + n) | 0;
+    n = (n - 1) | 0;
+  } while (n != 0);
+  return (initial + x) | 0;
+}
+
+const f = x => (x * 3 + 1) | 0;
+const instance = builder.instantiate({m: {f}});
+for (const name of ['loop', 'loopWithCall', 'nestedBranch']) {
+  assertTrue(%IsLiftoffFunction(instance.exports[name]));
+}
+for (const n of [1, 2, 3, 10, 1000]) {
+  assertEquals(loop(n, x => (x + 1) | 0), instance.exports.loop(n));
+  assertEquals(loop(n, f), instance.exports.loopWithCall(n));
+  assertEquals(nestedBranch(n), instance.exports.nestedBranch(n));
+}
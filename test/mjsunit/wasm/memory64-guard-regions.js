@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-memory64-trap-handling --experimental-wasm-memory64
+// Flags: --allow-natives-syntax
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Indexes which are known to be below the size of the guard regions don't need
+// an explicit check in optimized code; out-of-bounds accesses with such indexes
+// must still trap.
+const builder = new WasmModuleBuilder();
+const memory = builder.addMemory64(1, 1);
+
+builder.addFunction('loadExtended', kSig_i_i).addBody([
+  kExprLocalGet, 0,
+  kExprI64UConvertI32,
+  kExprI32LoadMem, 0x40, memory, 0
+]).exportFunc();
+
+builder.addFunction('loadMasked', kSig_i_l).addBody([
+  kExprLocalGet, 0,
+  ...wasmI64Const(0xfffff),
+  kExprI64And,
+  kExprI32LoadMem, 0x40, memory, 0
+]).exportFunc();
+
+builder.addFunction('loadShifted', kSig_i_l).addBody([
+  kExprLocalGet, 0,
+  ...wasmI64Const(40),
+  kExprI64ShrU,
+  kExprI32LoadMem, 0x40, memory, 0
+]).exportFunc();
+
+builder.addFunction('loadUnknown', kSig_i_l).addBody([
+  kExprLocalGet, 0,
+  kExprI32LoadMem, 0x40, memory, 0
+]).exportFunc();
+
+builder.addFunction('store', kSig_v_li).addBody([
+  kExprLocalGet, 0,
+  kExprLocalGet, 1,
+  kExprI32StoreMem, 0x40, memory, 0
+]).exportFunc();
+
+const instance = builder.instantiate();
+const {loadExtended, loadMasked, loadShifted, loadUnknown, store} =
+    instance.exports;
+const kValue = 0x12345678;
+store(16n, kValue);
+
+function test() {
+  assertEquals(kValue, loadExtended(16));
+  assertTraps(kTrapMemOutOfBounds, () => loadExtended(kPageSize));
+  assertTraps(kTrapMemOutOfBounds, () => loadExtended(-1));
+
+  assertEquals(kValue, loadMasked(16n));
+  assertEquals(kValue, loadMasked((1n << 40n) | 16n));
+  assertTraps(kTrapMemOutOfBounds, () => loadMasked(0xffffcn));
+
+  assertEquals(kValue, loadShifted(16n << 40n));
+  assertTraps(kTrapMemOutOfBounds, () => loadShifted(-1n));
+
+  assertEquals(kValue, loadUnknown(16n));
+  assertTraps(kTrapMemOutOfBounds, () => loadUnknown(1n << 50n));
+  assertTraps(kTrapMemOutOfBounds, () => loadUnknown(-4n));
+}
+
+test();
+for (const f of [loadExtended, loadMasked, loadShifted, loadUnknown]) {
+  %WasmTierUpFunction(f);
+}
+test();
@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-to-js-generic-wrapper --wasm-to-js-reuse-tiered-wrappers
+// Flags: --wasm-wrapper-tiering-budget=1 --allow-natives-syntax
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const sig = makeSig([kWasmI32, kWasmI32], [kWasmI32]);
+const impIndex = builder.addImport('m', 'add', sig);
+builder.addFunction('main', sig)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprCallFunction, impIndex])
+    .exportFunc();
+const module = builder.toModule();
+
+function add(a, b) {
+  return a + b;
+}
+
+// The first instance starts with the generic wrapper and tiers up.
+const instance1 = new WebAssembly.Instance(module, {m: {add}});
+assertEquals(1, %CountUnoptimizedWasmToJSWrapper(instance1));
+assertEquals(3, instance1.exports.main(1, 2));
+assertEquals(3, instance1.exports.main(1, 2));
+assertEquals(0, %CountUnoptimizedWasmToJSWrapper(instance1));
+
+// Later instances with an import of the same kind reuse the compiled wrapper.
+const instance2 =
+    new WebAssembly.Instance(module, {m: {add: (a, b) => a - b}});
+assertEquals(0, %CountUnoptimizedWasmToJSWrapper(instance2));
+assertEquals(-1, instance2.exports.main(1, 2));
+
+// Imports of a different kind (here an arity mismatch) don't.
+const instance3 = new WebAssembly.Instance(module, {m: {add: (a) => a}});
+assertEquals(1, %CountUnoptimizedWasmToJSWrapper(instance3));
+assertEquals(1, instance3.exports.main(1, 2));
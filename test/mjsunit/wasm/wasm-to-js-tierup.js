@@ -4,6 +4,7 @@
 
 // Flags: --wasm-to-js-generic-wrapper --wasm-staging --experimental-wasm-type-reflection
 // Flags: --wasm-wrapper-tiering-budget=1 --allow-natives-syntax
+// Flags: --no-wasm-to-js-reuse-tiered-wrappers
 
 d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
 
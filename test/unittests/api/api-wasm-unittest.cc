@@ -162,6 +162,51 @@ TEST_F(ApiWasmTest, WasmCompileToWasmModuleObject) {
   CHECK(!maybe_module.IsEmpty());
 }
 
+TEST_F(ApiWasmTest, WasmCompileWithProfile) {
+  // (func (export "f") (result i32) (i32.const 42))
+  static const uint8_t kModuleBytes[]{
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+      0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,        // type section
+      0x03, 0x02, 0x01, 0x00,                          // function section
+      0x07, 0x05, 0x01, 0x01, 'f',  0x00, 0x00,        // export section
+      0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b,  // code section
+  };
+  Local<Context> context = Context::New(isolate());
+  Context::Scope context_scope(context);
+  MemorySpan<const uint8_t> wire_bytes{kModuleBytes, arraysize(kModuleBytes)};
+  Local<WasmModuleObject> module =
+      WasmModuleObject::Compile(isolate(), wire_bytes).ToLocalChecked();
+  CHECK(context->Global()
+            ->Set(context, NewString("module"), module)
+            .FromJust());
+  RunJS(
+      "const f = new WebAssembly.Instance(module).exports.f;"
+      "for (let i = 0; i < 100; i++) f();");
+
+  OwnedBuffer profile = module->GetProfile();
+  CHECK_LT(0, profile.size);
+  CHECK(!WasmModuleObject::CompileWithProfile(
+             isolate(), wire_bytes, {profile.buffer.get(), profile.size})
+             .IsEmpty());
+
+  // Profiles of other modules and malformed profiles are ignored.
+  OwnedBuffer minimal_profile =
+      WasmModuleObject::Compile(
+          isolate(),
+          {kMinimalWasmModuleBytes, arraysize(kMinimalWasmModuleBytes)})
+          .ToLocalChecked()
+          ->GetProfile();
+  CHECK(!WasmModuleObject::CompileWithProfile(
+             isolate(), wire_bytes,
+             {minimal_profile.buffer.get(), minimal_profile.size})
+             .IsEmpty());
+  const uint8_t kMalformedProfile[]{0xff, 0xff, 0xff};
+  CHECK(!WasmModuleObject::CompileWithProfile(
+             isolate(), wire_bytes,
+             {kMalformedProfile, arraysize(kMalformedProfile)})
+             .IsEmpty());
+}
+
 TEST_F(ApiWasmTest, WasmStreamingSetCallback) {
   TestWasmStreaming(WasmStreamingMoreFunctionsCanBeSerializedCallback,
                     Promise::kPending);
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <vector>
+
 #include "include/v8-context.h"
 #include "include/v8-function.h"
 #include "include/v8-isolate.h"
@@ -140,6 +142,44 @@ TEST_F(DeserializeTest, DeserializeRejectsDifferentSource) {
   }
 }
 
+// Check that isolates share compiled scripts through the process-wide
+// compilation cache.
+TEST_F(DeserializeTest, ProcessCompilationCache) {
+  i::FlagScope<bool> process_compilation_cache(
+      &i::v8_flags.process_compilation_cache, true);
+  const char* kSource = "function processCached() { return 42; }";
+
+  {
+    IsolateAndContextScope scope(this);
+
+    // Compile eagerly, so that the cached script includes processCached().
+    ScriptCompiler::Source source(NewString(kSource));
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kEagerCompile)
+            .ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    // A lazy compile would leave processCached() uncompiled, so it has to
+    // come from the cache.
+    Local<Script> script =
+        Script::Compile(context(), NewString(kSource)).ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+    Local<Value> value = context()
+                             ->Global()
+                             ->Get(context(), NewString("processCached"))
+                             .ToLocalChecked();
+    i::DirectHandle<i::JSFunction> function =
+        i::Cast<i::JSFunction>(Utils::OpenDirectHandle(*value));
+    CHECK(function->shared()->is_compiled());
+    CHECK_EQ(RunGlobalFunc("processCached"), v8::Integer::New(isolate(), 42));
+  }
+}
+
 class DeserializeThread : public base::Thread {
  public:
   explicit DeserializeThread(ScriptCompiler::ConsumeCodeCacheTask* task)
@@ -155,6 +195,142 @@ class DeserializeThread : public base::Thread {
   std::unique_ptr<ScriptCompiler::ConsumeCodeCacheTask> task_;
 };
 
+// Check that the compile hints collected on a script are kept in its code
+// cache, and that the script consumed from the cache continues collecting them.
+TEST_F(DeserializeTest, DeserializeKeepsCompileHints) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+  const char* code = "function lazy1() {} function lazy2() {} lazy1();";
+
+  {
+    IsolateAndContextScope scope(this);
+
+    ScriptCompiler::Source source(NewString(code));
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kProduceCompileHints)
+            .ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+
+    cached_data.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+
+    // Creating the cache doesn't clear the hints.
+    std::vector<int> compile_hints =
+        script->GetCompileHintsCollector()->GetCompileHints(isolate());
+    EXPECT_EQ(std::vector<int>{14}, compile_hints);
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    ScriptCompiler::Source source(NewString(code), cached_data.release());
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!source.GetCachedData()->rejected);
+
+    std::vector<int> compile_hints =
+        script->GetCompileHintsCollector()->GetCompileHints(isolate());
+    EXPECT_EQ(std::vector<int>{14}, compile_hints);
+
+    CHECK(!script->Run(context()).IsEmpty());
+    RunGlobalFunc("lazy2");
+    compile_hints =
+        script->GetCompileHintsCollector()->GetCompileHints(isolate());
+    EXPECT_EQ((std::vector<int>{14, 34}), compile_hints);
+  }
+}
+
+// Check that a code cache delta holds the functions compiled since the cache
+// it builds on, and that it only applies on top of that cache.
+TEST_F(DeserializeTest, CodeCacheDelta) {
+  std::unique_ptr<v8::ScriptCompiler::CachedData> base_cache;
+  std::unique_ptr<v8::ScriptCompiler::CachedData> delta;
+  const char* code =
+      "function foo() {\n"
+      "  let sum = 0;\n"
+      "  for (let i = 0; i < 10; i++) sum += i * i - (i >> 1) + (i & 3);\n"
+      "  return sum;\n"
+      "}\n"
+      "function bar() { return foo() + 1; }\n"
+      "function baz() { return bar() + 1; }\n";
+
+  auto IsCompiled = [&](const char* name) {
+    Local<Value> value =
+        context()->Global()->Get(context(), NewString(name)).ToLocalChecked();
+    i::DirectHandle<i::JSFunction> function =
+        i::Cast<i::JSFunction>(Utils::OpenDirectHandle(*value));
+    return function->shared()->is_compiled();
+  };
+
+  {
+    IsolateAndContextScope scope(this);
+
+    Local<Script> script =
+        Script::Compile(context(), NewString(code)).ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+    CHECK_EQ(RunGlobalFunc("foo"), Integer::New(isolate(), 278));
+    base_cache.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+
+    CHECK_EQ(RunGlobalFunc("bar"), Integer::New(isolate(), 279));
+    std::unique_ptr<v8::ScriptCompiler::CachedData> full_cache(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    delta.reset(ScriptCompiler::CreateCodeCacheDelta(script->GetUnboundScript(),
+                                                     base_cache.get()));
+    ASSERT_NE(delta, nullptr);
+    // The bytecode of foo is not serialized again.
+    EXPECT_LT(delta->length, full_cache->length);
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    ScriptCompiler::Source source(NewString(code), base_cache.release());
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!source.GetCachedData()->rejected);
+    CHECK(!script->Run(context()).IsEmpty());
+    EXPECT_TRUE(IsCompiled("foo"));
+    EXPECT_FALSE(IsCompiled("bar"));
+
+    EXPECT_TRUE(ScriptCompiler::ApplyCodeCacheDelta(script->GetUnboundScript(),
+                                                    delta.get()));
+    EXPECT_FALSE(delta->rejected);
+    EXPECT_TRUE(IsCompiled("foo"));
+    EXPECT_TRUE(IsCompiled("bar"));
+    EXPECT_FALSE(IsCompiled("baz"));
+    CHECK_EQ(RunGlobalFunc("baz"), Integer::New(isolate(), 280));
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    // The delta is rejected when consumed on its own, and when applied to a
+    // script which lacks the functions it builds on.
+    ScriptCompiler::Source source(
+        NewString(code),
+        new ScriptCompiler::CachedData(
+            delta->data, delta->length,
+            ScriptCompiler::CachedData::BufferNotOwned));
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(source.GetCachedData()->rejected);
+    CHECK(!script->Run(context()).IsEmpty());
+    EXPECT_FALSE(IsCompiled("foo"));
+
+    EXPECT_FALSE(ScriptCompiler::ApplyCodeCacheDelta(
+        script->GetUnboundScript(), delta.get()));
+    EXPECT_TRUE(delta->rejected);
+    CHECK_EQ(RunGlobalFunc("baz"), Integer::New(isolate(), 280));
+  }
+}
+
 // Check that off-thread deserialization works.
 TEST_F(DeserializeTest, OffThreadDeserialize) {
   std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
@@ -4,11 +4,21 @@
 
 #include "src/execution/isolate.h"
 
+#include <memory>
+#include <vector>
+
 #include "include/libplatform/libplatform.h"
+#include "include/v8-locker.h"
+#include "include/v8-metrics.h"
 #include "include/v8-platform.h"
+#include "include/v8-script.h"
 #include "include/v8-template.h"
 #include "src/base/platform/semaphore.h"
+#include "src/flags/flags.h"
 #include "src/init/v8.h"
+#include "src/logging/tracing-flags.h"
+#include "src/tracing/tracing-category-observer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -67,6 +77,242 @@ TEST_F(IsolateTest, MemoryPressureNotificationBackground) {
   v8::platform::PumpMessageLoop(internal::V8::GetCurrentPlatform(), isolate());
 }
 
+TEST_F(IsolateTest, IsolatePool) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  IsolatePool pool(params, 2);
+  for (int i = 0; i < 5; i++) {
+    Global<Context> global_context;
+    Isolate* pooled_isolate = pool.Take(&global_context);
+    ASSERT_NE(isolate(), pooled_isolate);
+    {
+      Locker locker(pooled_isolate);
+      Isolate::Scope isolate_scope(pooled_isolate);
+      HandleScope handle_scope(pooled_isolate);
+      ASSERT_FALSE(global_context.IsEmpty());
+      Local<Context> context = global_context.Get(pooled_isolate);
+      Context::Scope context_scope(context);
+      Local<Script> script =
+          Script::Compile(context,
+                          String::NewFromUtf8Literal(pooled_isolate, "6 * 7"))
+              .ToLocalChecked();
+      EXPECT_EQ(42, script->Run(context)
+                        .ToLocalChecked()
+                        ->Int32Value(context)
+                        .FromJust());
+      global_context.Reset();
+    }
+    pooled_isolate->Dispose();
+  }
+}
+
+TEST_F(IsolateTest, GetICStatistics) {
+  std::vector<ICSiteStatistics> sites;
+  EXPECT_FALSE(isolate()->GetICStatistics(&sites));
+
+  i::FlagScope<bool> ic_site_stats(&i::v8_flags.ic_site_stats, true);
+  i::FlagScope<bool> lazy_feedback_allocation(
+      &i::v8_flags.lazy_feedback_allocation, false);
+  i::FlagList::EnforceFlagImplications();
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  Isolate* stats_isolate = Isolate::New(params);
+  {
+    Isolate::Scope isolate_scope(stats_isolate);
+    HandleScope handle_scope(stats_isolate);
+    Local<Context> context = Context::New(stats_isolate);
+    Context::Scope context_scope(context);
+    // Each object literal has a different map, so the load in get() goes
+    // megamorphic.
+    Script::Compile(context,
+                    String::NewFromUtf8Literal(
+                        stats_isolate,
+                        "function get(o) { return o.x; }"
+                        "for (let i = 0; i < 20; i++) {"
+                        "  get({x: 1, ['y' + i]: 2});"
+                        "}"))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+
+    EXPECT_TRUE(stats_isolate->GetICStatistics(&sites));
+    bool found_site = false;
+    for (const ICSiteStatistics& site : sites) {
+      if (site.function_name() != "get") continue;
+      found_site = true;
+      EXPECT_EQ("LoadIC", site.type());
+      EXPECT_TRUE(site.is_megamorphic());
+      EXPECT_LE(5u, site.miss_count());
+      EXPECT_LE(3u, site.transition_count());
+    }
+    EXPECT_TRUE(found_site);
+  }
+  stats_isolate->Dispose();
+  i::TracingFlags::ic_stats.fetch_and(
+      ~v8::tracing::TracingCategoryObserver::ENABLED_BY_SITE_STATS);
+}
+
+TEST_F(IsolateTest, GetDeoptStatistics) {
+  std::vector<DeoptSiteStatistics> deopts;
+  std::vector<OptimizationBailoutStatistics> bailouts;
+  EXPECT_FALSE(isolate()->GetDeoptStatistics(&deopts, &bailouts));
+  if (!i::v8_flags.turbofan) GTEST_SKIP();
+
+  i::FlagScope<bool> deopt_stats(&i::v8_flags.deopt_stats, true);
+  i::FlagScope<bool> allow_natives_syntax(&i::v8_flags.allow_natives_syntax,
+                                          true);
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  Isolate* stats_isolate = Isolate::New(params);
+  {
+    Isolate::Scope isolate_scope(stats_isolate);
+    HandleScope handle_scope(stats_isolate);
+    Local<Context> context = Context::New(stats_isolate);
+    Context::Scope context_scope(context);
+    // The optimized add() only handles Smis, so adding strings deopts.
+    Script::Compile(context,
+                    String::NewFromUtf8Literal(
+                        stats_isolate,
+                        "function add(a, b) { return a + b; }"
+                        "%PrepareFunctionForOptimization(add);"
+                        "add(1, 2);"
+                        "%OptimizeFunctionOnNextCall(add);"
+                        "add(1, 2);"
+                        "add('a', 'b');"))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+
+    EXPECT_TRUE(stats_isolate->GetDeoptStatistics(&deopts, &bailouts));
+    bool found_deopt = false;
+    for (const DeoptSiteStatistics& deopt : deopts) {
+      if (deopt.function_name() != "add") continue;
+      found_deopt = true;
+      EXPECT_EQ("deopt-eager", deopt.kind());
+      EXPECT_FALSE(deopt.reason().empty());
+      EXPECT_LE(0, deopt.script_id());
+      EXPECT_LE(0, deopt.source_position());
+      EXPECT_EQ(1u, deopt.count());
+    }
+    EXPECT_TRUE(found_deopt);
+  }
+  stats_isolate->Dispose();
+}
+
+TEST_F(IsolateTest, GetCompileJobHistograms) {
+  if (!i::v8_flags.turbofan) GTEST_SKIP();
+  i::FlagScope<bool> allow_natives_syntax(&i::v8_flags.allow_natives_syntax,
+                                          true);
+  HandleScope handle_scope(isolate());
+  Local<Context> context = Context::New(isolate());
+  Context::Scope context_scope(context);
+  Script::Compile(context,
+                  String::NewFromUtf8Literal(
+                      isolate(),
+                      "function f(a, b) { return a + b; }"
+                      "%PrepareFunctionForOptimization(f);"
+                      "f(1, 2);"
+                      "%OptimizeFunctionOnNextCall(f);"
+                      "f(1, 2);"))
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+
+  metrics::CompileJobHistograms histograms;
+  isolate()->GetCompileJobHistograms(&histograms);
+  EXPECT_FALSE(histograms.bucket_lower_bounds_in_us.empty());
+  const metrics::CompileJobHistograms::Tier& turbofan =
+      histograms.tiers[static_cast<size_t>(
+          metrics::CompileJob::Tier::kTurbofan)];
+  EXPECT_LE(1u, turbofan.job_count);
+  EXPECT_EQ(turbofan.job_count, turbofan.wall_clock_duration.total_count);
+  EXPECT_EQ(histograms.bucket_lower_bounds_in_us.size(),
+            turbofan.wall_clock_duration.bucket_counts.size());
+}
+
+namespace {
+
+class StartupRecorder final : public metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const metrics::IsolateCreated& event,
+                          ContextId) override {
+    isolate_events_.push_back(event);
+  }
+  void AddMainThreadEvent(const metrics::ContextCreated& event,
+                          ContextId context_id) override {
+    context_events_.push_back(event);
+    context_ids_.push_back(context_id);
+  }
+
+  std::vector<metrics::IsolateCreated> isolate_events_;
+  std::vector<metrics::ContextCreated> context_events_;
+  std::vector<ContextId> context_ids_;
+};
+
+}  // namespace
+
+TEST_F(IsolateTest, StartupMetrics) {
+  auto recorder = std::make_shared<StartupRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  ASSERT_EQ(1u, recorder->isolate_events_.size());
+  const metrics::IsolateCreated& isolate_event = recorder->isolate_events_[0];
+  EXPECT_LE(0, isolate_event.read_only_space_setup_in_us);
+  EXPECT_LE(0, isolate_event.startup_deserialization_in_us);
+  EXPECT_LE(isolate_event.startup_deserialization_in_us,
+            isolate_event.total_wall_clock_duration_in_us);
+
+  {
+    HandleScope handle_scope(isolate());
+    Local<Context> context = Context::New(isolate());
+    ASSERT_EQ(1u, recorder->context_events_.size());
+    const metrics::ContextCreated& context_event =
+        recorder->context_events_[0];
+    EXPECT_TRUE(context_event.success);
+    EXPECT_TRUE(context_event.from_snapshot);
+    EXPECT_LE(context_event.deserialization_in_us,
+              context_event.total_wall_clock_duration_in_us);
+    EXPECT_LE(context_event.embedder_callbacks_in_us,
+              context_event.deserialization_in_us);
+    EXPECT_EQ(metrics::Recorder::GetContextId(context),
+              recorder->context_ids_[0]);
+  }
+}
+
+TEST_F(IsolateTest, GetAllocationPhaseStatistics) {
+  constexpr uint32_t kPhase = 7;
+  HandleScope handle_scope(isolate());
+  Local<Context> context = Context::New(isolate());
+  Context::Scope context_scope(context);
+  {
+    Isolate::AllocationPhaseScope phase_scope(isolate(), kPhase);
+    Script::Compile(context,
+                    String::NewFromUtf8Literal(
+                        isolate(),
+                        "var arrays = [];"
+                        "for (let i = 0; i < 100; i++) {"
+                        "  arrays.push(new Array(1000).fill(i));"
+                        "}"))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+  }
+
+  std::vector<AllocationPhaseStatistics> phases;
+  isolate()->GetAllocationPhaseStatistics(&phases);
+  size_t allocated_bytes = 0;
+  for (const AllocationPhaseStatistics& phase : phases) {
+    if (phase.phase() == kPhase) allocated_bytes = phase.allocated_bytes();
+  }
+  // The arrays alone take up at least 100 * 1000 tagged values.
+  EXPECT_LE(100u * 1000u * i::kTaggedSize, allocated_bytes);
+}
+
 using IncumbentContextTest = TestWithIsolate;
 
 // Check that Isolate::GetIncumbentContext() returns the correct one in basic
@@ -13,6 +13,7 @@
 #include "testing/gtest/include/gtest/gtest.h"
 
 #ifdef V8_TARGET_OS_LINUX
+#include <sched.h>
 #include <sys/sysmacros.h>
 
 #include "src/base/platform/platform-linux.h"
@@ -56,6 +57,14 @@ TEST(OS, GetCurrentProcessId) {
 #endif
 }
 
+TEST(OS, GetCurrentNumaNode) {
+  const int node = OS::GetCurrentNumaNode();
+  EXPECT_LE(-1, node);
+#if !V8_OS_LINUX
+  EXPECT_EQ(-1, node);
+#endif
+}
+
 TEST(OS, RemapPages) {
   if constexpr (OS::IsRemapPageSupported()) {
     const size_t size = base::OS::AllocatePageSize();
@@ -232,6 +241,43 @@ TEST_F(ThreadLocalStorageTest, DoTest) {
   Join();
 }
 
+#if defined(V8_TARGET_OS_LINUX) && !defined(V8_OS_ANDROID)
+namespace {
+
+class AffinityThread final : public Thread {
+ public:
+  AffinityThread() : Thread(Options("AffinityThread")) {}
+
+  void Run() override {
+    cpus_set_.Wait();
+    CPU_ZERO(&affinity_);
+    CHECK_EQ(0, sched_getaffinity(0, sizeof(affinity_), &affinity_));
+  }
+
+  Semaphore cpus_set_{0};
+  cpu_set_t affinity_;
+};
+
+}  // namespace
+
+TEST(ThreadTest, SetCpus) {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  CHECK_EQ(0, sched_getaffinity(0, sizeof(allowed), &allowed));
+  int cpu = 0;
+  while (!CPU_ISSET(cpu, &allowed)) cpu++;
+
+  AffinityThread thread;
+  CHECK(thread.Start());
+  EXPECT_FALSE(thread.SetCpus({-1}));
+  EXPECT_TRUE(thread.SetCpus({cpu}));
+  thread.cpus_set_.Signal();
+  thread.Join();
+  EXPECT_EQ(1, CPU_COUNT(&thread.affinity_));
+  EXPECT_TRUE(CPU_ISSET(cpu, &thread.affinity_));
+}
+#endif  // V8_TARGET_OS_LINUX && !V8_OS_ANDROID
+
 TEST(StackTest, GetStackStart) { EXPECT_NE(nullptr, Stack::GetStackStart()); }
 
 TEST(StackTest, GetCurrentStackPosition) {
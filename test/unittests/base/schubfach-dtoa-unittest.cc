@@ -0,0 +1,134 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmath>
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "test/unittests/gay-shortest.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using SchubfachDtoaTest = ::testing::Test;
+
+namespace base {
+namespace test_schubfach_dtoa {
+
+static const int kBufferSize = 100;
+
+TEST_F(SchubfachDtoaTest, VariousDoubles) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  SchubfachDtoa(1.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  SchubfachDtoa(1.5, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("15", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  SchubfachDtoa(0.1, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(0, point);
+
+  SchubfachDtoa(1e23, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(24, point);
+
+  SchubfachDtoa(5e-324, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5", buffer.begin()));
+  CHECK_EQ(-323, point);
+
+  SchubfachDtoa(1.7976931348623157e308, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("17976931348623157", buffer.begin()));
+  CHECK_EQ(309, point);
+
+  SchubfachDtoa(4294967272.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4294967272", buffer.begin()));
+  CHECK_EQ(10, point);
+
+  SchubfachDtoa(9007199254740991.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("9007199254740991", buffer.begin()));
+  CHECK_EQ(16, point);
+
+  SchubfachDtoa(4.1855804968213567e298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4185580496821357", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  SchubfachDtoa(5.5626846462680035e-309, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5562684646268003", buffer.begin()));
+  CHECK_EQ(-308, point);
+
+  // FastDtoa cannot compute this number.
+  SchubfachDtoa(3.5844466002796428e+298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("35844466002796428", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  // Halfway between two shortest candidates, rounds to even.
+  SchubfachDtoa(665200457475700.25, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("6652004574757002", buffer.begin()));
+  CHECK_EQ(15, point);
+
+  uint64_t smallest_normal64 = 0x0010'0000'0000'0000;
+  SchubfachDtoa(Double(smallest_normal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("22250738585072014", buffer.begin()));
+  CHECK_EQ(-307, point);
+
+  uint64_t largest_denormal64 = 0x000F'FFFF'FFFF'FFFF;
+  SchubfachDtoa(Double(largest_denormal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2225073858507201", buffer.begin()));
+  CHECK_EQ(-307, point);
+}
+
+TEST_F(SchubfachDtoaTest, PowersOfTwo) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  char expected_container[kBufferSize];
+  Vector<char> expected(expected_container, kBufferSize);
+  int length;
+  int point;
+  int expected_length;
+  int expected_point;
+
+  // The lower boundary of powers of two is closer than the upper one.
+  for (int e = -1074; e < 1024; e++) {
+    double v = std::ldexp(1.0, e);
+    SchubfachDtoa(v, buffer, &length, &point);
+    BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, expected, &expected_length,
+               &expected_point);
+    expected[expected_length] = '\0';
+    CHECK_EQ(expected_point, point);
+    CHECK_EQ(0, strcmp(expected.begin(), buffer.begin()));
+  }
+}
+
+TEST_F(SchubfachDtoaTest, GayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    SchubfachDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kSchubfachDtoaMaximalLength, length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+}
+
+}  // namespace test_schubfach_dtoa
+}  // namespace base
+}  // namespace v8
@@ -163,5 +163,22 @@ TEST(ThreadIsolation, InvalidFreeRange) {
   ThreadIsolation::UnregisterJitPage(address1, size);
 }
 
+TEST(ThreadIsolation, NestedWriteScopesDontSwitchPermissions) {
+  ThreadIsolation::Initialize(nullptr);
+
+  const size_t saved_before = RwxMemoryWriteScope::saved_permission_switches();
+  {
+    RwxMemoryWriteScopeForTesting outer_scope;
+    EXPECT_EQ(saved_before, RwxMemoryWriteScope::saved_permission_switches());
+    {
+      RwxMemoryWriteScopeForTesting inner_scope;
+    }
+    {
+      RwxMemoryWriteScopeForTesting inner_scope;
+    }
+  }
+  EXPECT_EQ(saved_before + 4, RwxMemoryWriteScope::saved_permission_switches());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -21,6 +21,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/zone/zone-list-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -851,5 +852,47 @@ TEST_F(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread) {
   dispatcher.AbortAll();
 }
 
+TEST_F(LazyCompileDispatcherTest, EnqueueOverSourceBudget) {
+  FlagScope<unsigned int> budget(
+      &v8_flags.lazy_compile_dispatcher_max_source_kb, 1);
+  MockPlatform platform;
+  LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
+
+  std::string raw_script("(x) { var a = x");
+  while (raw_script.size() < 600) raw_script += " + x";
+  raw_script += "; }";
+  test::ScriptResource* source_1 = new test::ScriptResource(
+      raw_script.c_str(), raw_script.size(), JSParameterCount(1));
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), source_1);
+  test::ScriptResource* source_2 = new test::ScriptResource(
+      raw_script.c_str(), raw_script.size(), JSParameterCount(1));
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), source_2);
+  Handle<SharedFunctionInfo> shared_3 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1);
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared_1));
+  ASSERT_EQ(dispatcher.pending_source_size_, raw_script.size());
+
+  // The second function doesn't fit into the budget and stays lazy, but a
+  // small function still does.
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared_2));
+  ASSERT_FALSE(shared_2->is_compiled());
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_3);
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared_3));
+
+  // Finalizing a job returns its source size to the budget.
+  ASSERT_TRUE(dispatcher.FinishNow(shared_1));
+  ASSERT_TRUE(shared_1->is_compiled());
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2);
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared_2));
+
+  dispatcher.AbortAll();
+  ASSERT_EQ(dispatcher.pending_source_size_, 0u);
+}
+
 }  // namespace internal
 }  // namespace v8
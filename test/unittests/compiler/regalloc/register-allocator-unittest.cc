@@ -4,6 +4,7 @@
 
 #include "src/codegen/assembler-inl.h"
 #include "src/compiler/pipeline.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/backend/instruction-sequence-unittest.h"
 
 namespace v8 {
@@ -693,6 +694,68 @@ TEST_F(RegisterAllocatorTest, ValidMultipleDeferredBlockSpills) {
             GetParallelMoveCount(start_of_b6, Instruction::START, sequence()));
 }
 
+TEST_F(RegisterAllocatorTest, FastModeDiamondManyPhis) {
+  FlagScope<int> fast_mode(
+      &v8_flags.turbo_fast_register_allocation_threshold, 1);
+  constexpr int kPhis = Register::kNumRegisters * 2;
+
+  StartBlock();
+  EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+  StartBlock();
+  VReg t_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    t_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(2));
+
+  StartBlock();
+  VReg f_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    f_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(1));
+
+  StartBlock();
+  TestOperand merged[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    merged[i] = Use(Phi(t_vals[i], f_vals[i]));
+  }
+  Return(EmitCall(Slot(-1), kPhis, merged));
+  EndBlock();
+
+  Allocate();
+}
+
+TEST_F(RegisterAllocatorTest, FastModeMergeOfThreePredecessors) {
+  FlagScope<int> fast_mode(
+      &v8_flags.turbo_fast_register_allocation_threshold, 1);
+
+  StartBlock();  // B0
+  auto var1 = EmitOI(Reg(0));
+  auto var2 = EmitOI(Reg(1));
+  EndBlock(Branch(Reg(var1, 0), 1, 2));
+
+  StartBlock();  // B1
+  EndBlock(Branch(Reg(var2, 1), 2, 3));
+
+  StartBlock();  // B2
+  EmitCall(Slot(-1), Slot(var1));
+  EndBlock(Jump(2));
+
+  StartBlock();  // B3
+  EmitNop();
+  EndBlock(Jump(1));
+
+  StartBlock();  // B4
+  auto phi = Phi(var1, var2, var1);
+  EmitI(Reg(var1), Reg(var2));
+  Return(Reg(phi));
+  EndBlock();
+
+  Allocate();
+}
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
@@ -0,0 +1,110 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/bounds-check-elimination-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class BoundsCheckEliminationReducerTest : public ReducerTest {};
+
+namespace {
+
+struct LoopShape {
+  int32_t initial_value;
+  int32_t step;
+  bool check_other_limit;
+  bool check_word64;
+  bool expect_eliminated;
+  const char* name;
+};
+
+std::ostream& operator<<(std::ostream& os, const LoopShape& shape) {
+  return os << shape.name;
+}
+
+const LoopShape kLoopShapes[] = {
+    {0, 1, false, false, true, "for (i = 0; i < length; i++) check(i)"},
+    {3, 1, false, false, true, "for (i = 3; i < length; i++) check(i)"},
+    {0, 1, false, true, true,
+     "for (i = 0; i < length; i++) check(uint64(i), uint64(length))"},
+    {-1, 1, false, false, false, "for (i = -1; i < length; i++) check(i)"},
+    {0, 2, false, false, false, "for (i = 0; i < length; i += 2) check(i)"},
+    {0, 1, true, false, false,
+     "for (i = 0; i < length; i++) check(i, other_length)"},
+};
+
+}  // namespace
+
+class BoundsCheckEliminationReducerShapeTest
+    : public BoundsCheckEliminationReducerTest,
+      public ::testing::WithParamInterface<LoopShape> {};
+
+TEST_P(BoundsCheckEliminationReducerShapeTest, InductionVariable) {
+  LoopShape shape = GetParam();
+  auto test = CreateFromGraph(1, [&shape](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = V<Word32>::Cast(__ Load(
+        Asm.GetParameter(0), LoadOp::Kind::TaggedBase(),
+        MemoryRepresentation::Int32(), 8));
+    V<Word32> other_length = V<Word32>::Cast(__ Load(
+        Asm.GetParameter(0), LoadOp::Kind::TaggedBase(),
+        MemoryRepresentation::Int32(), 12));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, shape.initial_value);
+    WHILE(__ Int32LessThan(index, length)) {
+      V<Word32> limit = shape.check_other_limit ? other_length : length;
+      V<Word32> check =
+          shape.check_word64
+              ? __ Uint64LessThan(__ ChangeUint32ToUint64(index),
+                                  __ ChangeUint32ToUint64(limit))
+              : __ Uint32LessThan(index, limit);
+      __ DeoptimizeIfNot(check, Asm.BuildFrameState(),
+                         DeoptimizeReason::kOutOfBounds, FeedbackSource{});
+      Asm.Capture(__ output_graph().LastOperation(), "check");
+      index = __ Word32Add(index, shape.step);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  EXPECT_EQ(shape.expect_eliminated, test.GetCapture("check").IsEmpty());
+}
+
+INSTANTIATE_TEST_SUITE_P(BoundsCheckEliminationReducerTest,
+                         BoundsCheckEliminationReducerShapeTest,
+                         ::testing::ValuesIn(kLoopShapes));
+
+TEST_F(BoundsCheckEliminationReducerTest, KeepsOtherDeopts) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = V<Word32>::Cast(__ Load(
+        Asm.GetParameter(0), LoadOp::Kind::TaggedBase(),
+        MemoryRepresentation::Int32(), 8));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    WHILE(__ Int32LessThan(index, length)) {
+      __ DeoptimizeIfNot(__ Uint32LessThan(index, length),
+                         Asm.BuildFrameState(), DeoptimizeReason::kLostPrecision,
+                         FeedbackSource{});
+      Asm.Capture(__ output_graph().LastOperation(), "deopt");
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<BoundsCheckEliminationReducer>();
+
+  EXPECT_FALSE(test.GetCapture("deopt").IsEmpty());
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
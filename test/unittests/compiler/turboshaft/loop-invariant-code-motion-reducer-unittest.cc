@@ -0,0 +1,144 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-invariant-code-motion-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LoopInvariantCodeMotionReducerTest : public ReducerTest {};
+
+#define C(value) value = Asm.CaptureHelperForMacro(#value)
+
+namespace {
+
+const Block& GetFirstLoop(const Graph& graph) {
+  for (const Block& block : graph.blocks()) {
+    if (block.IsLoop()) return block;
+  }
+  UNREACHABLE();
+}
+
+// Blocks are emitted in order, so operations that are emitted before the loop
+// have been hoisted out of it.
+bool IsBeforeLoop(const Graph& graph, const Operation* op) {
+  return graph.BlockIndexOf(*op).id() < GetFirstLoop(graph).index().id();
+}
+
+}  // namespace
+
+TEST_F(LoopInvariantCodeMotionReducerTest, HoistsPureOperations) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> a = V<Word32>::Cast(__ Load(Asm.GetParameter(0),
+                                          LoadOp::Kind::TaggedBase(),
+                                          MemoryRepresentation::Int32(), 8));
+    V<Word32> b = V<Word32>::Cast(__ Load(Asm.GetParameter(0),
+                                          LoadOp::Kind::TaggedBase(),
+                                          MemoryRepresentation::Int32(), 12));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    WHILE(__ Int32LessThan(index, 100)) {
+      V<Word32> C(invariant) = __ Word32Mul(a, b);
+      V<Word32> C(variant) = __ Word32Add(index, invariant);
+      index = variant;
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  const Operation* invariant = test.GetCaptured("invariant");
+  ASSERT_TRUE(invariant->Is<WordBinopOp>());
+  EXPECT_TRUE(IsBeforeLoop(test.graph(), invariant));
+  const Operation* variant = test.GetCaptured("variant");
+  ASSERT_TRUE(variant->Is<WordBinopOp>());
+  EXPECT_FALSE(IsBeforeLoop(test.graph(), variant));
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, KeepsDivisions) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> a = V<Word32>::Cast(__ Load(Asm.GetParameter(0),
+                                          LoadOp::Kind::TaggedBase(),
+                                          MemoryRepresentation::Int32(), 8));
+    V<Word32> b = V<Word32>::Cast(__ Load(Asm.GetParameter(0),
+                                          LoadOp::Kind::TaggedBase(),
+                                          MemoryRepresentation::Int32(), 12));
+
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    WHILE(__ Int32LessThan(index, 100)) {
+      // {b} could be 0, so the division must not be executed if the loop
+      // body isn't.
+      V<Word32> C(division) = __ Int32Div(a, b);
+      index = __ Word32Add(index, division);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  const Operation* division = test.GetCaptured("division");
+  ASSERT_TRUE(division->Is<WordBinopOp>());
+  EXPECT_FALSE(IsBeforeLoop(test.graph(), division));
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, HoistsLoadsFromReadOnlyLoops) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    // The condition of the loop is computed in the loop header.
+    WHILE(__ Int32LessThan(
+        index, Asm.Capture(V<Word32>::Cast(__ Load(
+                               Asm.GetParameter(0), LoadOp::Kind::TaggedBase(),
+                               MemoryRepresentation::Int32(), 8)),
+                           "length"))) {
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  const Operation* length = test.GetCaptured("length");
+  ASSERT_TRUE(length->Is<LoadOp>());
+  EXPECT_TRUE(IsBeforeLoop(test.graph(), length));
+}
+
+TEST_F(LoopInvariantCodeMotionReducerTest, KeepsLoadsInWritingLoops) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    // The condition of the loop is computed in the loop header.
+    WHILE(__ Int32LessThan(
+        index, Asm.Capture(V<Word32>::Cast(__ Load(
+                               Asm.GetParameter(0), LoadOp::Kind::TaggedBase(),
+                               MemoryRepresentation::Int32(), 8)),
+                           "length"))) {
+      // The store could change the value that {length} loads.
+      __ Store(Asm.GetParameter(0), index, StoreOp::Kind::TaggedBase(),
+               MemoryRepresentation::Int32(),
+               WriteBarrierKind::kNoWriteBarrier, 16);
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopInvariantCodeMotionReducer>();
+
+  const Operation* length = test.GetCaptured("length");
+  ASSERT_TRUE(length->Is<LoadOp>());
+  EXPECT_FALSE(IsBeforeLoop(test.graph(), length));
+}
+
+#undef C
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
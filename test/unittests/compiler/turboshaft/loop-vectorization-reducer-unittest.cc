@@ -0,0 +1,144 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LoopVectorizationReducerTest : public ReducerTest {};
+
+namespace {
+
+// Loads the raw data pointer of the {index}th array from the parameter.
+template <typename AssemblerT>
+V<WordPtr> LoadDataPointer(AssemblerT& Asm, int index) {
+  return V<WordPtr>::Cast(__ Load(Asm.GetParameter(0),
+                                  LoadOp::Kind::TaggedBase(),
+                                  MemoryRepresentation::UintPtr(),
+                                  8 + index * kSystemPointerSize));
+}
+
+template <typename AssemblerT>
+V<Word32> LoadLength(AssemblerT& Asm) {
+  return V<Word32>::Cast(__ Load(Asm.GetParameter(0),
+                                 LoadOp::Kind::TaggedBase(),
+                                 MemoryRepresentation::Int32(), 4));
+}
+
+}  // namespace
+
+// for (i = 0; i < length; i++) c[i] = a[i] * b[i];
+TEST_F(LoopVectorizationReducerTest, VectorizesElementWiseLoop) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = LoadLength(Asm);
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    WHILE(__ Int32LessThan(index, length)) {
+      V<WordPtr> offset = __ ChangeInt32ToIntPtr(index);
+      OpIndex a = __ Load(LoadDataPointer(Asm, 0), offset,
+                          LoadOp::Kind::RawAligned(),
+                          MemoryRepresentation::Float64(), 0, 3);
+      OpIndex b = __ Load(LoadDataPointer(Asm, 1), offset,
+                          LoadOp::Kind::RawAligned(),
+                          MemoryRepresentation::Float64(), 0, 3);
+      __ Store(LoadDataPointer(Asm, 2), offset,
+               __ Float64Mul(V<Float64>::Cast(a), V<Float64>::Cast(b)),
+               StoreOp::Kind::RawAligned(), MemoryRepresentation::Float64(),
+               WriteBarrierKind::kNoWriteBarrier, 0, 3);
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopVectorizationReducer>();
+
+  // The vector loop multiplies 2 elements at once, and the scalar loop handles
+  // the remaining element, if any.
+  EXPECT_EQ(test.CountOp(Opcode::kSimd128Binop), 1u);
+  EXPECT_EQ(test.CountOp(Opcode::kFloatBinop), 1u);
+  EXPECT_EQ(test.CountOp(Opcode::kStore), 2u);
+}
+
+// for (i = 0; i < length; i++) sum = (sum + a[i]) | 0;
+TEST_F(LoopVectorizationReducerTest, VectorizesIntegerReduction) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = LoadLength(Asm);
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+    WHILE(__ Int32LessThan(index, length)) {
+      OpIndex a = __ Load(LoadDataPointer(Asm, 0),
+                          __ ChangeInt32ToIntPtr(index),
+                          LoadOp::Kind::RawAligned(),
+                          MemoryRepresentation::Int32(), 0, 2);
+      sum = __ Word32Add(sum, V<Word32>::Cast(a));
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(sum));
+  });
+
+  test.Run<LoopVectorizationReducer>();
+
+  EXPECT_EQ(test.CountOp(Opcode::kSimd128Binop), 1u);
+  // The lanes of the accumulator are added to the sum after the vector loop.
+  EXPECT_EQ(test.CountOp(Opcode::kSimd128ExtractLane), 4u);
+}
+
+// for (i = 0; i < length; i++) sum += a[i];
+TEST_F(LoopVectorizationReducerTest, KeepsFloatReduction) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = LoadLength(Asm);
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    ScopedVariable<Float64, AssemblerT> sum(&Asm, 0.0);
+    WHILE(__ Int32LessThan(index, length)) {
+      OpIndex a = __ Load(LoadDataPointer(Asm, 0),
+                          __ ChangeInt32ToIntPtr(index),
+                          LoadOp::Kind::RawAligned(),
+                          MemoryRepresentation::Float64(), 0, 3);
+      // Reassociating the additions would change the result.
+      sum = __ Float64Add(sum, V<Float64>::Cast(a));
+      index = __ Word32Add(index, 1);
+    }
+    __ Return(__ TagSmi(__ JSTruncateFloat64ToWord32(sum)));
+  });
+
+  test.Run<LoopVectorizationReducer>();
+
+  EXPECT_EQ(test.CountOp(Opcode::kSimd128Binop), 0u);
+}
+
+// for (i = 0; i < length; i += 2) c[i] = a[i];
+TEST_F(LoopVectorizationReducerTest, KeepsLoopsWithOtherSteps) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    V<Word32> length = LoadLength(Asm);
+    ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+    WHILE(__ Int32LessThan(index, length)) {
+      V<WordPtr> offset = __ ChangeInt32ToIntPtr(index);
+      OpIndex a = __ Load(LoadDataPointer(Asm, 0), offset,
+                          LoadOp::Kind::RawAligned(),
+                          MemoryRepresentation::Int32(), 0, 2);
+      __ Store(LoadDataPointer(Asm, 1), offset, a, StoreOp::Kind::RawAligned(),
+               MemoryRepresentation::Int32(),
+               WriteBarrierKind::kNoWriteBarrier, 0, 2);
+      index = __ Word32Add(index, 2);
+    }
+    __ Return(__ TagSmi(index));
+  });
+
+  test.Run<LoopVectorizationReducer>();
+
+  EXPECT_EQ(test.CountOp(Opcode::kStore), 1u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
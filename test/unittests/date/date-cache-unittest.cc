@@ -2,11 +2,16 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 #ifdef V8_INTL_SUPPORT
+#include <memory>
+#include <vector>
+
 #include "src/base/platform/platform.h"
 #include "src/date/date.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "unicode/basictz.h"
 #include "unicode/strenum.h"
 #include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 
 namespace v8 {
 namespace internal {
@@ -103,6 +108,59 @@ TEST(DateCache, AdoptDefaultMixed) {
   t4.Join();
 }
 
+// Offsets which come from the cached transition table must match the ones
+// computed by ICU, in particular around transitions and in the skipped and
+// repeated local times.
+TEST(DateCache, TransitionTable) {
+  std::unique_ptr<icu::TimeZone> saved_default(icu::TimeZone::createDefault());
+  for (const char* name :
+       {"America/New_York", "Europe/London", "Australia/Lord_Howe",
+        "Africa/Casablanca", "America/Sao_Paulo", "Pacific/Apia",
+        "Asia/Kolkata", "Europe/Moscow", "Etc/GMT+5"}) {
+    icu::TimeZone::adoptDefault(icu::TimeZone::createTimeZone(name));
+    std::unique_ptr<icu::BasicTimeZone> timezone(
+        static_cast<icu::BasicTimeZone*>(icu::TimeZone::createDefault()));
+    DateCache date_cache;
+
+    std::vector<int64_t> times;
+    icu::TimeZoneTransition transition;
+    double time = -3e12;  // 1874
+    while (timezone->getNextTransition(time, false, transition) &&
+           transition.getTime() < 4e12) {  // 2096
+      time = transition.getTime();
+      for (int64_t delta : {-7200000, -3600001, -3600000, -1800000, -1, 0, 1,
+                            1800000, 3599999, 3600000, 7200000}) {
+        times.push_back(static_cast<int64_t>(time) + delta);
+      }
+    }
+    for (int64_t t = -8000000000000; t < 8000000000000; t += 3331333331) {
+      times.push_back(t);
+    }
+    // Visit the times out of order, so that the table is extended in both
+    // directions and also replaced.
+    for (size_t i = 0; i < times.size(); i++) {
+      std::swap(times[i], times[(i * 7919) % times.size()]);
+    }
+    for (int64_t t : times) {
+      for (bool is_utc : {true, false}) {
+        UErrorCode status = U_ZERO_ERROR;
+        int32_t raw_offset, dst_offset;
+        if (is_utc) {
+          timezone->getOffset(t, false, raw_offset, dst_offset, status);
+        } else {
+          timezone->getOffsetFromLocal(t, UCAL_TZ_LOCAL_FORMER,
+                                       UCAL_TZ_LOCAL_FORMER, raw_offset,
+                                       dst_offset, status);
+        }
+        CHECK(U_SUCCESS(status));
+        CHECK_EQ(raw_offset + dst_offset,
+                 date_cache.GetLocalOffsetFromOS(t, is_utc));
+      }
+    }
+  }
+  icu::TimeZone::setDefault(*saved_default);
+}
+
 }  // namespace internal
 }  // namespace v8
 
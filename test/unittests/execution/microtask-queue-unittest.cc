@@ -9,7 +9,9 @@
 #include <memory>
 #include <vector>
 
+#include "include/v8-external.h"
 #include "include/v8-function.h"
+#include "include/v8-metrics.h"
 #include "src/heap/factory.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
@@ -75,6 +77,23 @@ namespace {
 void DummyPromiseHook(PromiseHookType type, Local<Promise> promise,
                       Local<Value> parent) {}
 
+void LogEnteredContext(const FunctionCallbackInfo<Value>& info) {
+  auto* log = static_cast<std::vector<Global<v8::Context>>*>(
+      info.Data().As<External>()->Value());
+  log->emplace_back(info.GetIsolate(),
+                    info.GetIsolate()->GetEnteredOrMicrotaskContext());
+}
+
+class MicrotasksRunRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::MicrotasksRun& event,
+                          ContextId) override {
+    events.push_back(event);
+  }
+
+  std::vector<v8::metrics::MicrotasksRun> events;
+};
+
 }  // namespace
 
 class MicrotaskQueueTest : public TestWithNativeContextAndFinalizationRegistry,
@@ -647,6 +666,72 @@ TEST_P(MicrotaskQueueTest, MicrotasksScope) {
   EXPECT_TRUE(ran);
 }
 
+TEST_P(MicrotaskQueueTest, EnteredContextOfBatchedMicrotasks) {
+  microtask_queue()->set_microtasks_policy(MicrotasksPolicy::kExplicit);
+  Local<v8::Context> v8_context1 = v8_isolate()->GetCurrentContext();
+  Local<v8::Context> v8_context2 = v8::Context::New(v8_isolate());
+  DirectHandle<Context> context2 =
+      Utils::OpenDirectHandle(*v8_context2, isolate());
+  context2->native_context()->set_microtask_queue(isolate(), microtask_queue());
+
+  std::vector<Global<v8::Context>> log;
+  Local<External> data = External::New(v8_isolate(), &log);
+  Local<v8::Function> function1 =
+      v8::Function::New(v8_context1, LogEnteredContext, data).ToLocalChecked();
+  Local<v8::Function> function2 =
+      v8::Function::New(v8_context2, LogEnteredContext, data).ToLocalChecked();
+  auto enqueue = [&](Local<v8::Context> context, Local<v8::Function> function) {
+    v8::Context::Scope scope(context);
+    microtask_queue()->EnqueueMicrotask(v8_isolate(), function);
+  };
+
+  // Consecutive microtasks of one context share the entered context, but
+  // callback tasks and other contexts still see the right one.
+  size_t entered_count =
+      isolate()->handle_scope_implementer()->EnteredContextCount();
+  bool callback_ran = false;
+  enqueue(v8_context1, function1);
+  enqueue(v8_context1, function1);
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([&]() {
+    EXPECT_EQ(entered_count,
+              isolate()->handle_scope_implementer()->EnteredContextCount());
+    callback_ran = true;
+  }));
+  enqueue(v8_context1, function1);
+  enqueue(v8_context2, function2);
+  enqueue(v8_context1, function1);
+  EXPECT_EQ(6, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_TRUE(callback_ran);
+  EXPECT_EQ(entered_count,
+            isolate()->handle_scope_implementer()->EnteredContextCount());
+
+  ASSERT_EQ(5u, log.size());
+  Local<v8::Context> expected[] = {v8_context1, v8_context1, v8_context1,
+                                   v8_context2, v8_context1};
+  for (size_t i = 0; i < log.size(); ++i) {
+    EXPECT_EQ(expected[i], log[i].Get(v8_isolate()));
+  }
+
+  v8_context2->DetachGlobal();
+}
+
+TEST_P(MicrotaskQueueTest, MetricsRecorder) {
+  auto recorder = std::make_shared<MicrotasksRunRecorder>();
+  v8_isolate()->SetMetricsRecorder(recorder);
+
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([]() {}));
+  }
+  EXPECT_EQ(3, microtask_queue()->RunMicrotasks(isolate()));
+  ASSERT_EQ(1u, recorder->events.size());
+  EXPECT_EQ(3, recorder->events[0].microtask_count);
+  EXPECT_LE(0, recorder->events[0].wall_clock_duration_in_us);
+
+  // Checkpoints that don't run any microtask are not reported.
+  EXPECT_EQ(0, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(1u, recorder->events.size());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     , MicrotaskQueueTest, ::testing::Values(false, true),
     [](const ::testing::TestParamInfo<MicrotaskQueueTest::ParamType>& info) {
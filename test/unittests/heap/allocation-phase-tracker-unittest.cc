@@ -0,0 +1,73 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/allocation-phase-tracker.h"
+
+#include <algorithm>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+constexpr uint32_t kPhase = 1;
+constexpr uint32_t kOtherPhase = 2;
+}  // namespace
+
+TEST(AllocationPhaseTrackerTest, NoPredictionForDefaultPhase) {
+  AllocationPhaseTracker tracker;
+  EXPECT_EQ(AllocationPhaseTracker::kDefaultPhase, tracker.current_phase());
+  tracker.NotifyGarbageCollection(10.0);
+  EXPECT_FALSE(tracker.ExpectedAllocationForCurrentPhase());
+  EXPECT_FALSE(tracker.SurvivalRateForCurrentPhase());
+}
+
+TEST(AllocationPhaseTrackerTest, NoPredictionBeforeFirstActivation) {
+  AllocationPhaseTracker tracker;
+  tracker.SetPhase(kPhase, 0);
+  EXPECT_EQ(kPhase, tracker.current_phase());
+  EXPECT_FALSE(tracker.ExpectedAllocationForCurrentPhase());
+}
+
+TEST(AllocationPhaseTrackerTest, PredictsAllocationPerActivation) {
+  AllocationPhaseTracker tracker;
+  tracker.SetPhase(kPhase, 1000);
+  tracker.NotifyGarbageCollection(20.0);
+  tracker.SetPhase(kOtherPhase, 5000);
+  tracker.SetPhase(kPhase, 5100);
+  ASSERT_TRUE(tracker.ExpectedAllocationForCurrentPhase());
+  EXPECT_EQ(4000u, *tracker.ExpectedAllocationForCurrentPhase());
+  ASSERT_TRUE(tracker.SurvivalRateForCurrentPhase());
+  EXPECT_DOUBLE_EQ(20.0, *tracker.SurvivalRateForCurrentPhase());
+  // The other phase allocated only 100 bytes.
+  tracker.SetPhase(kOtherPhase, 9100);
+  ASSERT_TRUE(tracker.ExpectedAllocationForCurrentPhase());
+  EXPECT_EQ(100u, *tracker.ExpectedAllocationForCurrentPhase());
+  EXPECT_FALSE(tracker.SurvivalRateForCurrentPhase());
+  // The second activation of the first phase allocated the same amount.
+  tracker.SetPhase(kPhase, 9200);
+  EXPECT_EQ(4000u, *tracker.ExpectedAllocationForCurrentPhase());
+}
+
+TEST(AllocationPhaseTrackerTest, CountsAllocatedBytesPerPhase) {
+  AllocationPhaseTracker tracker;
+  EXPECT_TRUE(tracker.AllocatedBytesPerPhase().empty());
+  tracker.AddAllocatedBytes(10);
+  tracker.SetPhase(kPhase, 0);
+  tracker.AddAllocatedBytes(100);
+  tracker.AddAllocatedBytes(200);
+  tracker.SetPhase(kOtherPhase, 0);
+  tracker.SetPhase(kPhase, 0);
+  tracker.AddAllocatedBytes(1000);
+  auto phases = tracker.AllocatedBytesPerPhase();
+  std::sort(phases.begin(), phases.end());
+  // The other phase didn't allocate anything.
+  ASSERT_EQ(2u, phases.size());
+  EXPECT_EQ(AllocationPhaseTracker::kDefaultPhase, phases[0].first);
+  EXPECT_EQ(10u, phases[0].second);
+  EXPECT_EQ(kPhase, phases[1].first);
+  EXPECT_EQ(1300u, phases[1].second);
+}
+
+}  // namespace v8::internal
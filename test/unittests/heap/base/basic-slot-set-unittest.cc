@@ -6,6 +6,8 @@
 
 #include <limits>
 #include <map>
+#include <thread>
+#include <vector>
 
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -194,5 +196,97 @@ TEST(BasicSlotSet, RemoveRange) {
   TestSlotSet::Delete(set, kBucketsTestPage);
 }
 
+TEST(BasicSlotSet, SparseBuckets) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  const size_t kBucketSize = TestSlotSet::OffsetForBucket(1);
+  // Few slots per bucket keep all buckets sparse.
+  for (size_t bucket = 0; bucket < kBucketsTestPage; bucket++) {
+    for (size_t i = 0; i < 3; i++) {
+      set->Insert<TestSlotSet::AccessMode::ATOMIC>(bucket * kBucketSize +
+                                                   i * 5 * kTestGranularity);
+    }
+  }
+  set->Remove(5 * kTestGranularity);
+  set->Insert<TestSlotSet::AccessMode::NON_ATOMIC>(7 * kTestGranularity);
+  set->Insert<TestSlotSet::AccessMode::ATOMIC>(0);
+  EXPECT_TRUE(set->Lookup(0));
+  EXPECT_FALSE(set->Lookup(5 * kTestGranularity));
+  EXPECT_TRUE(set->Lookup(7 * kTestGranularity));
+  EXPECT_TRUE(set->Lookup(10 * kTestGranularity));
+  EXPECT_FALSE(set->Lookup(kTestGranularity));
+
+  size_t slots = 0;
+  size_t count = set->Iterate(
+      0, 0, kBucketsTestPage,
+      [&slots](uintptr_t slot) {
+        ++slots;
+        return slot % (2 * kTestGranularity) == 0 ? KEEP_SLOT : REMOVE_SLOT;
+      },
+      TestSlotSet::FREE_EMPTY_BUCKETS);
+  EXPECT_EQ(3 * kBucketsTestPage, slots);
+  for (size_t i = 0; i < kTestPageSize; i += kTestGranularity) {
+    const size_t offset_in_bucket = i % kBucketSize;
+    const bool expected =
+        (offset_in_bucket == 0 || offset_in_bucket == 10 * kTestGranularity ||
+         (i == 7 * kTestGranularity)) &&
+        i % (2 * kTestGranularity) == 0;
+    EXPECT_EQ(expected, set->Lookup(i));
+  }
+  EXPECT_EQ(2 * kBucketsTestPage, count);
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
+TEST(BasicSlotSet, SparseBucketTurnsIntoBitmap) {
+  for (const auto access_mode : {TestSlotSet::AccessMode::ATOMIC,
+                                 TestSlotSet::AccessMode::NON_ATOMIC}) {
+    TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+    static constexpr size_t kSlots = 2 * TestSlotSet::SparseBucket::kCapacity;
+    for (size_t i = 0; i < kSlots; i++) {
+      if (access_mode == TestSlotSet::AccessMode::ATOMIC) {
+        set->Insert<TestSlotSet::AccessMode::ATOMIC>(i * 3 * kTestGranularity);
+      } else {
+        set->Insert<TestSlotSet::AccessMode::NON_ATOMIC>(i * 3 *
+                                                         kTestGranularity);
+      }
+    }
+    for (size_t i = 0; i < 3 * kSlots; i++) {
+      EXPECT_EQ(i % 3 == 0, set->Lookup(i * kTestGranularity));
+    }
+    size_t count = set->Iterate(
+        0, 0, kBucketsTestPage, [](uintptr_t slot) { return KEEP_SLOT; },
+        TestSlotSet::KEEP_EMPTY_BUCKETS);
+    EXPECT_EQ(kSlots, count);
+    TestSlotSet::Delete(set, kBucketsTestPage);
+  }
+}
+
+TEST(BasicSlotSet, ConcurrentInsertIntoSparseBucket) {
+  static constexpr size_t kThreads = 4;
+  static constexpr size_t kSlotsPerThread =
+      TestSlotSet::SparseBucket::kCapacity;
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; t++) {
+    threads.emplace_back([set, t]() {
+      // All threads insert the same slots plus some of their own into the
+      // first bucket, forcing it to turn into a bitmap along the way.
+      for (size_t i = 0; i < kSlotsPerThread; i++) {
+        set->Insert<TestSlotSet::AccessMode::ATOMIC>(i * kTestGranularity);
+        set->Insert<TestSlotSet::AccessMode::ATOMIC>(
+            (kSlotsPerThread * (t + 1) + i) * kTestGranularity);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  size_t count = set->Iterate(
+      0, 0, kBucketsTestPage, [](uintptr_t slot) { return KEEP_SLOT; },
+      TestSlotSet::KEEP_EMPTY_BUCKETS);
+  EXPECT_EQ((kThreads + 1) * kSlotsPerThread, count);
+  for (size_t i = 0; i < (kThreads + 1) * kSlotsPerThread; i++) {
+    EXPECT_TRUE(set->Lookup(i * kTestGranularity));
+  }
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
 }  // namespace base
 }  // namespace heap
@@ -145,4 +145,48 @@ TEST_F(IncrementalMarkingScheduleTest, GetCurrentStepInfo) {
   EXPECT_NE(step_info.scheduled_delta_bytes(), 0);
 }
 
+TEST_F(IncrementalMarkingScheduleTest,
+       MutatorUtilizationUnboundedWhenNotConfigured) {
+  auto schedule =
+      IncrementalMarkingSchedule::CreateWithDefaultMinimumMarkedBytesPerStep();
+  schedule->NotifyIncrementalMarkingStart();
+  EXPECT_FALSE(schedule->HasMinimumMutatorUtilization());
+  EXPECT_EQ(v8::base::TimeDelta::Max(),
+            schedule->GetMaxStepDurationForMutatorUtilization(
+                v8::base::TimeTicks::Now()));
+}
+
+TEST_F(IncrementalMarkingScheduleTest, MutatorUtilizationBudget) {
+  auto schedule =
+      IncrementalMarkingSchedule::CreateWithDefaultMinimumMarkedBytesPerStep();
+  schedule->NotifyIncrementalMarkingStart();
+  // At least 70% mutator utilization over 10ms leaves 3ms for steps.
+  schedule->SetMinimumMutatorUtilization(
+      v8::base::TimeDelta::FromMilliseconds(10), 0.7);
+  const auto start = v8::base::TimeTicks::Now();
+  EXPECT_EQ(3, schedule->GetMaxStepDurationForMutatorUtilization(start)
+                   .InMilliseconds());
+  schedule->NotifyMutatorThreadStep(start,
+                                    v8::base::TimeDelta::FromMilliseconds(2));
+  const auto after_first_step =
+      start + v8::base::TimeDelta::FromMilliseconds(2);
+  EXPECT_EQ(1, schedule->GetMaxStepDurationForMutatorUtilization(
+                       after_first_step)
+                   .InMilliseconds());
+  schedule->NotifyMutatorThreadStep(after_first_step,
+                                    v8::base::TimeDelta::FromMilliseconds(2));
+  const auto after_second_step =
+      after_first_step + v8::base::TimeDelta::FromMilliseconds(2);
+  EXPECT_TRUE(
+      schedule->GetMaxStepDurationForMutatorUtilization(after_second_step)
+          .IsZero());
+  EXPECT_DOUBLE_EQ(0.6, schedule->GetMinimumObservedMutatorUtilization());
+  // Once both steps left the window the full budget is available again.
+  EXPECT_EQ(3, schedule
+                   ->GetMaxStepDurationForMutatorUtilization(
+                       after_second_step +
+                       v8::base::TimeDelta::FromMilliseconds(10))
+                   .InMilliseconds());
+}
+
 }  // namespace heap::base
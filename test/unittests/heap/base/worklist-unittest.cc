@@ -330,5 +330,81 @@ TEST(WorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsEmpty());
 }
 
+TEST(WorkListTest, SegmentMoveHalfTo) {
+  auto segment = CreateTemporarySegment(kMinSegmentSize);
+  auto other = CreateTemporarySegment(kMinSegmentSize);
+  SomeObject objects[4];
+  for (SomeObject& object : objects) {
+    segment->Push(&object);
+  }
+  segment->MoveHalfTo(other.get());
+  EXPECT_EQ(2u, segment->Size());
+  EXPECT_EQ(2u, other->Size());
+  // The oldest entries are moved, the newest ones stay.
+  SomeObject* retrieved = nullptr;
+  segment->Pop(&retrieved);
+  EXPECT_EQ(&objects[3], retrieved);
+  segment->Pop(&retrieved);
+  EXPECT_EQ(&objects[2], retrieved);
+  other->Pop(&retrieved);
+  EXPECT_EQ(&objects[1], retrieved);
+  other->Pop(&retrieved);
+  EXPECT_EQ(&objects[0], retrieved);
+}
+
+TEST(WorkListTest, WorkStealingDonatesHalfOfPushSegment) {
+  TestWorklist worklist;
+  TestWorklist::Local busy(worklist,
+                           TestWorklist::Local::WorkStealing::kEnabled);
+  TestWorklist::Local idle(worklist,
+                           TestWorklist::Local::WorkStealing::kEnabled);
+  SomeObject dummy;
+  for (size_t i = 0; i < 10; i++) {
+    busy.Push(&dummy);
+  }
+  SomeObject* retrieved = nullptr;
+  EXPECT_FALSE(idle.Pop(&retrieved));
+  EXPECT_EQ(1u, idle.idle_events());
+  EXPECT_TRUE(worklist.HasStealRequests());
+  EXPECT_TRUE(worklist.IsEmpty());
+  // The next push splits the private push segment.
+  busy.Push(&dummy);
+  EXPECT_EQ(1u, busy.donations());
+  EXPECT_FALSE(worklist.HasStealRequests());
+  EXPECT_EQ(1u, worklist.Size());
+  EXPECT_EQ(6u, busy.PushSegmentSize());
+  size_t stolen = 0;
+  while (idle.Pop(&retrieved)) {
+    EXPECT_EQ(&dummy, retrieved);
+    stolen++;
+  }
+  EXPECT_EQ(5u, stolen);
+  EXPECT_EQ(1u, idle.steals());
+  while (busy.Pop(&retrieved)) {
+  }
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
+TEST(WorkListTest, WorkStealingDisabledKeepsWorkPrivate) {
+  TestWorklist worklist;
+  TestWorklist::Local busy(worklist);
+  TestWorklist::Local idle(worklist,
+                           TestWorklist::Local::WorkStealing::kEnabled);
+  SomeObject dummy;
+  for (size_t i = 0; i < 10; i++) {
+    busy.Push(&dummy);
+  }
+  SomeObject* retrieved = nullptr;
+  EXPECT_FALSE(idle.Pop(&retrieved));
+  busy.Push(&dummy);
+  EXPECT_EQ(0u, busy.donations());
+  EXPECT_TRUE(worklist.IsEmpty());
+  // Publishing withdraws the pending request.
+  idle.Publish();
+  EXPECT_FALSE(worklist.HasStealRequests());
+  while (busy.Pop(&retrieved)) {
+  }
+}
+
 }  // namespace base
 }  // namespace heap
@@ -10,6 +10,7 @@
 #include "src/heap/cppgc/garbage-collector.h"
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/heap-page.h"
+#include "src/heap/cppgc/heap-space.h"
 #include "src/heap/cppgc/marker.h"
 #include "src/heap/cppgc/stats-collector.h"
 #include "test/unittests/heap/cppgc/tests.h"
@@ -75,7 +76,8 @@ class CompactorTest : public testing::TestWithPlatform {
   void StartCompaction() {
     compactor().EnableForNextGCForTesting();
     compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
-                                          StackState::kNoHeapPointers);
+                                          StackState::kNoHeapPointers,
+                                          Compactor::Trigger::kMemoryReducing);
     EXPECT_TRUE(compactor().IsEnabledForTesting());
   }
 
@@ -100,6 +102,26 @@ class CompactorTest : public testing::TestWithPlatform {
     heap()->sweeper().FinishIfRunning();
   }
 
+  // Leaves `kNumObjects` live objects spread over pages that are otherwise
+  // only filled with garbage, and sweeps the garbage onto the free list.
+  template <int kNumObjects>
+  void FragmentSpace(CompactableHolder<kNumObjects>& holder,
+                     size_t garbage_per_object) {
+    for (int i = 0; i < kNumObjects; ++i) {
+      for (size_t j = 0; j < garbage_per_object; ++j) {
+        MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+      }
+      holder.objects[i] =
+          MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+    }
+    heap()->CollectGarbage(GCConfig::PreciseAtomicConfig());
+  }
+
+  NormalPageSpace& compactable_space() {
+    return NormalPageSpace::From(*heap()->raw_heap().CustomSpace(
+        CustomSpaceIndex(CompactableCustomSpace::kSpaceIndex)));
+  }
+
   Heap* heap() { return Heap::From(heap_.get()); }
   cppgc::AllocationHandle& GetAllocationHandle() {
     return heap_->GetAllocationHandle();
@@ -253,5 +275,47 @@ TEST_F(CompactorTest, OnStackSlotShouldBeFiltered) {
   EndGC();
 }
 
+TEST_F(CompactorTest, FragmentedSpaceIsCompacted) {
+  static constexpr int kNumObjects = 1024;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  FragmentSpace(*holder, 15);
+  const size_t pages_before_compaction = compactable_space().size();
+  compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
+                                        StackState::kNoHeapPointers,
+                                        Compactor::Trigger::kFragmentation);
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  heap()->StartIncrementalGarbageCollection(
+      GCConfig::PreciseIncrementalConfig());
+  EndGC();
+  EXPECT_TRUE(compactor().WasCompacted(compactable_space()));
+  EXPECT_LT(compactable_space().size(), pages_before_compaction);
+  const HeapStatistics::CompactionStatistics& stats = compactor().statistics();
+  EXPECT_EQ(1u, stats.compacting_gcs);
+  EXPECT_EQ(1u, stats.candidate_spaces);
+  EXPECT_EQ(1u, stats.compacted_spaces);
+  EXPECT_LE(kNumObjects * (sizeof(CompactableGCed) + sizeof(HeapObjectHeader)),
+            stats.evacuated_bytes);
+  EXPECT_EQ(Compactor::kDefaultEvacuationBudget,
+            stats.evacuation_budget_bytes);
+  EXPECT_EQ(stats.compacted_spaces,
+            heap()->CollectStatistics(HeapStatistics::kBrief)
+                .compaction_stats.compacted_spaces);
+}
+
+TEST_F(CompactorTest, DenseSpaceIsNotCompactedForFragmentation) {
+  static constexpr int kNumObjects = 1024;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  FragmentSpace(*holder, 0);
+  compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
+                                        StackState::kNoHeapPointers,
+                                        Compactor::Trigger::kFragmentation);
+  EXPECT_FALSE(compactor().IsEnabledForTesting());
+  EXPECT_EQ(0u, compactor().statistics().compacting_gcs);
+}
+
 }  // namespace internal
 }  // namespace cppgc
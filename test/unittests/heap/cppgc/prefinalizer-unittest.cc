@@ -4,6 +4,9 @@
 
 #include "include/cppgc/prefinalizer.h"
 
+#include <atomic>
+#include <vector>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
 #include "include/cppgc/persistent.h"
@@ -369,5 +372,78 @@ TEST_F(PrefinalizerTest, VirtualPrefinalizer) {
   EXPECT_LT(0u, GCedInherited::prefinalizer_count_);
 }
 
+namespace {
+
+class GCedWithConcurrentPrefinalizer
+    : public GarbageCollected<GCedWithConcurrentPrefinalizer> {
+  CPPGC_USING_CONCURRENT_PRE_FINALIZER(GCedWithConcurrentPrefinalizer,
+                                       PreFinalizer);
+
+ public:
+  void Trace(Visitor*) const {}
+  void PreFinalizer() {
+    prefinalizer_callcount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static std::atomic<size_t> prefinalizer_callcount;
+};
+std::atomic<size_t> GCedWithConcurrentPrefinalizer::prefinalizer_callcount{0};
+
+class GCedObservingConcurrentPrefinalizers
+    : public GarbageCollected<GCedObservingConcurrentPrefinalizers> {
+  CPPGC_USING_PRE_FINALIZER(GCedObservingConcurrentPrefinalizers,
+                            PreFinalizer);
+
+ public:
+  void Trace(Visitor*) const {}
+  void PreFinalizer() {
+    observed_concurrent_prefinalizers =
+        GCedWithConcurrentPrefinalizer::prefinalizer_callcount.load(
+            std::memory_order_relaxed);
+  }
+
+  static size_t observed_concurrent_prefinalizers;
+};
+size_t GCedObservingConcurrentPrefinalizers::observed_concurrent_prefinalizers =
+    0;
+
+}  // namespace
+
+TEST_F(PrefinalizerTest, ConcurrentPrefinalizerCalledOnDeadObjects) {
+  static constexpr size_t kNumObjects = 1000;
+  GCedWithConcurrentPrefinalizer::prefinalizer_callcount = 0;
+  std::vector<Persistent<GCedWithConcurrentPrefinalizer>> live_objects;
+  for (size_t i = 0; i < kNumObjects; ++i) {
+    auto* object = MakeGarbageCollected<GCedWithConcurrentPrefinalizer>(
+        GetAllocationHandle());
+    if (i % 2) live_objects.emplace_back(object);
+  }
+  PreciseGC();
+  EXPECT_EQ(kNumObjects / 2,
+            GCedWithConcurrentPrefinalizer::prefinalizer_callcount.load());
+  PreciseGC();
+  EXPECT_EQ(kNumObjects / 2,
+            GCedWithConcurrentPrefinalizer::prefinalizer_callcount.load());
+  live_objects.clear();
+  PreciseGC();
+  EXPECT_EQ(kNumObjects,
+            GCedWithConcurrentPrefinalizer::prefinalizer_callcount.load());
+}
+
+TEST_F(PrefinalizerTest, ConcurrentPrefinalizersRunBeforeOtherPrefinalizers) {
+  static constexpr size_t kNumObjects = 500;
+  GCedWithConcurrentPrefinalizer::prefinalizer_callcount = 0;
+  GCedObservingConcurrentPrefinalizers::observed_concurrent_prefinalizers = 0;
+  MakeGarbageCollected<GCedObservingConcurrentPrefinalizers>(
+      GetAllocationHandle());
+  for (size_t i = 0; i < kNumObjects; ++i) {
+    MakeGarbageCollected<GCedWithConcurrentPrefinalizer>(GetAllocationHandle());
+  }
+  PreciseGC();
+  EXPECT_EQ(
+      kNumObjects,
+      GCedObservingConcurrentPrefinalizers::observed_concurrent_prefinalizers);
+}
+
 }  // namespace internal
 }  // namespace cppgc
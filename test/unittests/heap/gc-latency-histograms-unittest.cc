@@ -0,0 +1,81 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-latency-histograms.h"
+
+#include <limits>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+using Phase = GCLatencyHistograms::Phase;
+using Thread = GCLatencyHistograms::Thread;
+
+}  // namespace
+
+TEST(GCLatencyHistogramsTest, BucketsAreContiguous) {
+  EXPECT_EQ(0, GCLatencyHistograms::BucketLowerBound(0));
+  for (size_t i = 1; i < GCLatencyHistograms::kNumBuckets; ++i) {
+    const int64_t lower_bound = GCLatencyHistograms::BucketLowerBound(i);
+    EXPECT_LT(GCLatencyHistograms::BucketLowerBound(i - 1), lower_bound);
+    EXPECT_EQ(i, GCLatencyHistograms::BucketIndex(lower_bound));
+    EXPECT_EQ(i - 1, GCLatencyHistograms::BucketIndex(lower_bound - 1));
+  }
+}
+
+TEST(GCLatencyHistogramsTest, RelativeBucketErrorIsBounded) {
+  for (size_t i = GCLatencyHistograms::kSubBuckets;
+       i < GCLatencyHistograms::kNumBuckets - 1; ++i) {
+    const int64_t lower_bound = GCLatencyHistograms::BucketLowerBound(i);
+    const int64_t width =
+        GCLatencyHistograms::BucketLowerBound(i + 1) - lower_bound;
+    EXPECT_LE(width * static_cast<int64_t>(GCLatencyHistograms::kSubBuckets),
+              lower_bound);
+  }
+}
+
+TEST(GCLatencyHistogramsTest, LargeAndNegativeValuesAreClamped) {
+  EXPECT_EQ(0u, GCLatencyHistograms::BucketIndex(-1));
+  EXPECT_EQ(GCLatencyHistograms::kNumBuckets - 1,
+            GCLatencyHistograms::BucketIndex(
+                int64_t{1} << GCLatencyHistograms::kMaxValueBits));
+  EXPECT_EQ(GCLatencyHistograms::kNumBuckets - 1,
+            GCLatencyHistograms::BucketIndex(
+                std::numeric_limits<int64_t>::max()));
+}
+
+TEST(GCLatencyHistogramsTest, AddSample) {
+  GCLatencyHistograms histograms;
+  histograms.AddSample(Phase::kEvacuation, Thread::kMainThread,
+                       base::TimeDelta::FromMicroseconds(3));
+  histograms.AddSample(Phase::kEvacuation, Thread::kMainThread,
+                       base::TimeDelta::FromMicroseconds(1000));
+  histograms.AddSample(Phase::kEvacuation, Thread::kBackground,
+                       base::TimeDelta::FromMicroseconds(20));
+  v8::metrics::GarbageCollectionLatencyHistograms result;
+  histograms.CopyTo(&result);
+  ASSERT_EQ(GCLatencyHistograms::kNumBuckets,
+            result.bucket_lower_bounds_in_us.size());
+  const auto& main_thread =
+      result.main_thread[static_cast<size_t>(Phase::kEvacuation)];
+  ASSERT_EQ(GCLatencyHistograms::kNumBuckets, main_thread.bucket_counts.size());
+  EXPECT_EQ(2u, main_thread.total_count);
+  EXPECT_EQ(1003, main_thread.total_duration_in_us);
+  EXPECT_EQ(1000, main_thread.max_duration_in_us);
+  EXPECT_EQ(1u, main_thread.bucket_counts[3]);
+  EXPECT_EQ(1u, main_thread.bucket_counts[GCLatencyHistograms::BucketIndex(
+                    1000)]);
+  const auto& background =
+      result.background[static_cast<size_t>(Phase::kEvacuation)];
+  EXPECT_EQ(1u, background.total_count);
+  EXPECT_EQ(20, background.max_duration_in_us);
+  EXPECT_EQ(0u,
+            result.main_thread[static_cast<size_t>(Phase::kSweeping)]
+                .total_count);
+}
+
+}  // namespace v8::internal
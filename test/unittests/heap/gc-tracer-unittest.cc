@@ -598,4 +598,37 @@ TEST_F(GCTracerTest, RecordScavengerHistograms) {
   GcHistogram::CleanUp();
 }
 
+TEST_F(GCTracerTest, LatencyHistograms) {
+  if (v8_flags.stress_incremental_marking) return;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  v8::metrics::GarbageCollectionLatencyHistograms before;
+  isolate()->GetGCLatencyHistograms(&before);
+  tracer->current_.scopes[GCTracer::Scope::MC_MARK_ROOTS] =
+      base::TimeDelta::FromMicroseconds(5);
+  tracer->current_.scopes[GCTracer::Scope::MC_SWEEP] =
+      base::TimeDelta::FromMicroseconds(100);
+  tracer->current_.scopes[GCTracer::Scope::MC_BACKGROUND_SWEEPING] =
+      base::TimeDelta::FromMicroseconds(300);
+  tracer->RecordLatencyHistograms();
+  v8::metrics::GarbageCollectionLatencyHistograms after;
+  isolate()->GetGCLatencyHistograms(&after);
+  using Phase = v8::metrics::GarbageCollectionLatencyHistograms::Phase;
+  const auto& roots =
+      after.main_thread[static_cast<size_t>(Phase::kRootMarking)];
+  const auto& roots_before =
+      before.main_thread[static_cast<size_t>(Phase::kRootMarking)];
+  EXPECT_EQ(roots_before.total_count + 1, roots.total_count);
+  EXPECT_EQ(roots_before.bucket_counts[5] + 1, roots.bucket_counts[5]);
+  const auto& sweeping =
+      after.background[static_cast<size_t>(Phase::kSweeping)];
+  const auto& sweeping_before =
+      before.background[static_cast<size_t>(Phase::kSweeping)];
+  EXPECT_EQ(sweeping_before.total_duration_in_us + 300,
+            sweeping.total_duration_in_us);
+  EXPECT_LE(300, sweeping.max_duration_in_us);
+  EXPECT_EQ(GCLatencyHistograms::kNumBuckets,
+            after.bucket_lower_bounds_in_us.size());
+}
+
 }  // namespace v8::internal
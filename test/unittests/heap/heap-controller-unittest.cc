@@ -52,6 +52,24 @@ TEST_F(MemoryControllerTest, HeapGrowingFactor) {
                     V8Controller::DynamicGrowingFactor(400, 1, 4.0));
 }
 
+TEST_F(MemoryControllerTest, HeapGrowingFactorWithPauseBudget) {
+  // 30ms of GC per second corresponds to the default target utilization.
+  CheckEqualRounded(
+      V8HeapTrait::kTargetMutatorUtilization,
+      V8Controller::TargetMutatorUtilizationFromPauseBudget(30));
+  CheckEqualRounded(0.5,
+                    V8Controller::TargetMutatorUtilizationFromPauseBudget(900));
+  CheckEqualRounded(0.999,
+                    V8Controller::TargetMutatorUtilizationFromPauseBudget(0.1));
+  // A tighter budget trades memory for less GC time.
+  const double tight = V8Controller::DynamicGrowingFactor(
+      100, 1, 4.0, V8Controller::TargetMutatorUtilizationFromPauseBudget(10));
+  const double loose = V8Controller::DynamicGrowingFactor(
+      100, 1, 4.0, V8Controller::TargetMutatorUtilizationFromPauseBudget(100));
+  EXPECT_LT(V8Controller::DynamicGrowingFactor(100, 1, 4.0), tight);
+  EXPECT_GT(V8Controller::DynamicGrowingFactor(100, 1, 4.0), loose);
+}
+
 TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
   CheckEqualRounded(1.3, V8Controller::MaxGrowingFactor(V8HeapTrait::kMinSize));
   CheckEqualRounded(1.600,
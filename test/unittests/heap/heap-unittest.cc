@@ -15,7 +15,10 @@
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/memory-allocator.h"
+#include "src/heap/memory-reducer.h"
 #include "src/heap/minor-mark-sweep.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
@@ -23,6 +26,7 @@
 #include "src/heap/trusted-range.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -363,6 +367,40 @@ TEST_F(HeapTest, CollectingAllAvailableGarbageShrinksNewSpace) {
 }
 
 // Test that HAllocateObject will always return an object in new-space.
+TEST_F(HeapTest, LoadHintReleasesAndRecommitsPooledPages) {
+  Heap* heap = i_isolate()->heap();
+  MemoryReducer* memory_reducer = heap->memory_reducer();
+  if (!memory_reducer) return;
+  MemoryAllocator::Pool* pool = heap->memory_allocator()->pool();
+  pool->ReleasePooledChunks();
+  const size_t kPagesPerStep =
+      static_cast<size_t>(v8_flags.memory_reducer_idle_decommit_pages);
+  const size_t kPages = 2 * kPagesPerStep;
+  EXPECT_EQ(kPages, heap->memory_allocator()->PrecommitPooledPages(
+                        heap->old_space(), kPages));
+  EXPECT_EQ(kPages, pool->NumberOfCommittedChunks());
+
+  v8_isolate()->SetLoadHint(LoadHint::kIdle);
+  EXPECT_EQ(kPagesPerStep, memory_reducer->ReleasePooledPagesStep());
+  EXPECT_EQ(kPages - kPagesPerStep, pool->NumberOfCommittedChunks());
+  EXPECT_EQ(kPagesPerStep, memory_reducer->ReleasePooledPagesStep());
+  EXPECT_EQ(0u, pool->NumberOfCommittedChunks());
+  EXPECT_EQ(0u, memory_reducer->ReleasePooledPagesStep());
+
+  HeapStatistics stats;
+  v8_isolate()->GetHeapStatistics(&stats);
+  EXPECT_EQ(0u, stats.pooled_memory_size());
+  EXPECT_LE(kPages * PageMetadata::kPageSize,
+            stats.idle_decommitted_memory_size());
+
+  // The pages released while idle are recommitted ahead of demand.
+  v8_isolate()->SetLoadHint(LoadHint::kLoadExpected);
+  EXPECT_EQ(kPages, pool->NumberOfCommittedChunks());
+  v8_isolate()->GetHeapStatistics(&stats);
+  EXPECT_EQ(kPages * PageMetadata::kPageSize, stats.pooled_memory_size());
+  v8_isolate()->SetLoadHint(LoadHint::kDefault);
+}
+
 TEST_F(HeapTest, OptimizedAllocationAlwaysInNewSpace) {
   if (v8_flags.single_generation) return;
   v8_flags.allow_natives_syntax = true;
@@ -402,6 +440,53 @@ TEST_F(HeapTest, OptimizedAllocationAlwaysInNewSpace) {
   CHECK(Heap::InYoungGeneration(*o));
 }
 
+namespace {
+constexpr char kParsePretenuringSource[] =
+    "var kept = [];"
+    "var payload = JSON.stringify(Array.from({length: 4096},"
+    "    (_, i) => ({id: i, name: 'item' + i})));"
+    "function parseAndKeep() {"
+    "  var value = JSON.parse(payload);"
+    "  kept.push(value);"
+    "  return value;"
+    "}"
+    "function parseAndDrop() { return JSON.parse(payload); }";
+}  // namespace
+
+TEST_F(HeapTest, JsonParsePretenuringForSurvivingPayloads) {
+  if (v8_flags.single_generation || !v8_flags.parse_pretenuring) return;
+  if (v8_flags.stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope(isolate());
+  v8::HandleScope scope(reinterpret_cast<v8::Isolate*>(isolate()));
+  RunJS(kParsePretenuringSource);
+  PretenuringHandler* handler = heap()->pretenuring_handler();
+  const size_t pretenured_bytes_before = handler->pretenured_parse_bytes();
+  // Payloads start out in the young generation until they are known to
+  // survive.
+  for (int i = 0; i < 4; ++i) {
+    v8::Local<v8::Value> result = RunJS("parseAndKeep()");
+    CHECK(Heap::InYoungGeneration(*v8::Utils::OpenDirectHandle(*result)));
+    InvokeMinorGC();
+  }
+  v8::Local<v8::Value> result = RunJS("parseAndKeep()");
+  CHECK(!Heap::InYoungGeneration(*v8::Utils::OpenDirectHandle(*result)));
+  CHECK_LT(pretenured_bytes_before, handler->pretenured_parse_bytes());
+}
+
+TEST_F(HeapTest, JsonParsePretenuringSkipsDyingPayloads) {
+  if (v8_flags.single_generation || !v8_flags.parse_pretenuring) return;
+  if (v8_flags.stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope(isolate());
+  v8::HandleScope scope(reinterpret_cast<v8::Isolate*>(isolate()));
+  RunJS(kParsePretenuringSource);
+  for (int i = 0; i < 4; ++i) {
+    RunJS("parseAndDrop(); undefined");
+    InvokeMinorGC();
+  }
+  v8::Local<v8::Value> result = RunJS("parseAndDrop()");
+  CHECK(Heap::InYoungGeneration(*v8::Utils::OpenDirectHandle(*result)));
+}
+
 namespace {
 template <RememberedSetType direction>
 static size_t GetRememberedSetSize(Tagged<HeapObject> obj) {
@@ -464,6 +549,38 @@ TEST_F(HeapTest, RememberedSet_InsertOnPromotingObjectToOld) {
   }
 }
 
+TEST_F(HeapTest, SlowPathCounters) {
+  if (v8_flags.single_generation) return;
+  v8_flags.write_barrier_slow_path_sampling_interval = 1;
+  ManualGCScope manual_gc_scope(isolate());
+  Factory* factory = isolate()->factory();
+  HandleScope scope(isolate());
+  HeapStatistics before;
+  v8_isolate()->GetHeapStatistics(&before);
+
+  // Storing a young object into an old one records an old-to-new slot.
+  DirectHandle<FixedArray> old_array =
+      factory->NewFixedArray(1, AllocationType::kOld);
+  DirectHandle<HeapNumber> young_number = factory->NewHeapNumber(42);
+  CHECK(Heap::InYoungGeneration(*young_number));
+  old_array->set(0, *young_number);
+
+  // Allocating more than fits into a LAB refills it.
+  for (int j = 0; j < 1000; j++) {
+    HandleScope inner_scope(isolate());
+    factory->NewFixedArray(100);
+  }
+
+  HeapStatistics after;
+  v8_isolate()->GetHeapStatistics(&after);
+  EXPECT_LT(before.generational_write_barrier_slow_paths(),
+            after.generational_write_barrier_slow_paths());
+  EXPECT_LT(before.allocation_slow_paths_lab_exhausted() +
+                before.allocation_slow_paths_observer_step(),
+            after.allocation_slow_paths_lab_exhausted() +
+                after.allocation_slow_paths_observer_step());
+}
+
 TEST_F(HeapTest, Regress978156) {
   if (!v8_flags.incremental_marking) return;
   if (v8_flags.single_generation) return;
@@ -595,5 +712,35 @@ TEST_F(HeapTest, Regress341769455) {
 #endif  // V8_COMPRESS_POINTERS
 }
 
+TEST_F(HeapTest, FlushScriptLineEnds) {
+  if (!v8_flags.flush_script_line_ends) return;
+  if (isolate()->NeedsSourcePositions()) return;
+  ManualGCScope manual_gc_scope(isolate());
+  HandleScope scope(isolate());
+
+  v8::Local<v8::Value> result = RunJS(
+      "function f() {\n"
+      "  return 1;\n"
+      "}\n"
+      "f;");
+  DirectHandle<JSFunction> function = Cast<JSFunction>(
+      v8::Utils::OpenDirectHandle(*v8::Local<v8::Function>::Cast(result)));
+  DirectHandle<Script> script(Cast<Script>(function->shared()->script()),
+                              isolate());
+  const int position = function->shared()->EndPosition() - 1;
+
+  Script::InitLineEnds(isolate(), script);
+  CHECK(script->has_line_ends());
+  InvokeMemoryReducingMajorGCs();
+  CHECK(!script->has_line_ends());
+
+  // Positions are still resolved correctly once the line ends are recomputed.
+  Script::PositionInfo info;
+  CHECK(Script::GetPositionInfo(script, position, &info));
+  CHECK(script->has_line_ends());
+  CHECK_EQ(2, info.line);
+  CHECK_EQ(0, info.column);
+}
+
 }  // namespace internal
 }  // namespace v8
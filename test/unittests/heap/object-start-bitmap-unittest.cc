@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/object-start-bitmap.h"
+
+#include <memory>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+constexpr size_t kPageSize = size_t{1} << kPageSizeBits;
+}  // namespace
+
+TEST(ObjectStartBitmapTest, EmptyBitmap) {
+  auto bitmap = std::make_unique<ObjectStartBitmap>();
+  EXPECT_FALSE(bitmap->Contains(0));
+  EXPECT_EQ(ObjectStartBitmap::kNotFound, bitmap->FindPreviousObjectStart(0));
+  EXPECT_EQ(ObjectStartBitmap::kNotFound,
+            bitmap->FindPreviousObjectStart(kPageSize - 1));
+}
+
+TEST(ObjectStartBitmapTest, FindPreviousObjectStart) {
+  auto bitmap = std::make_unique<ObjectStartBitmap>();
+  const size_t kFirst = 16 * kTaggedSize;
+  const size_t kSecond = 1000 * kTaggedSize;
+  bitmap->Set(kFirst);
+  bitmap->Set(kSecond);
+  EXPECT_TRUE(bitmap->Contains(kFirst));
+  EXPECT_FALSE(bitmap->Contains(kFirst + kTaggedSize));
+  EXPECT_EQ(ObjectStartBitmap::kNotFound,
+            bitmap->FindPreviousObjectStart(kFirst - 1));
+  EXPECT_EQ(kFirst, bitmap->FindPreviousObjectStart(kFirst));
+  // Inner pointers don't need to be aligned.
+  EXPECT_EQ(kFirst, bitmap->FindPreviousObjectStart(kFirst + 1));
+  EXPECT_EQ(kFirst, bitmap->FindPreviousObjectStart(kSecond - 1));
+  EXPECT_EQ(kSecond, bitmap->FindPreviousObjectStart(kSecond));
+  EXPECT_EQ(kSecond, bitmap->FindPreviousObjectStart(kPageSize - 1));
+}
+
+TEST(ObjectStartBitmapTest, CellBoundaries) {
+  auto bitmap = std::make_unique<ObjectStartBitmap>();
+  const size_t kCellSize = kBitsPerSystemPointer * kTaggedSize;
+  const size_t kLastInCell = kCellSize - kTaggedSize;
+  bitmap->Set(kLastInCell);
+  EXPECT_EQ(kLastInCell, bitmap->FindPreviousObjectStart(kLastInCell));
+  EXPECT_EQ(kLastInCell, bitmap->FindPreviousObjectStart(kCellSize));
+  bitmap->Set(kCellSize);
+  EXPECT_EQ(kCellSize, bitmap->FindPreviousObjectStart(kCellSize));
+  const size_t kLast = kPageSize - kTaggedSize;
+  bitmap->Set(kLast);
+  EXPECT_EQ(kLast, bitmap->FindPreviousObjectStart(kLast));
+}
+
+TEST(ObjectStartBitmapTest, Clear) {
+  auto bitmap = std::make_unique<ObjectStartBitmap>();
+  bitmap->Set(kTaggedSize);
+  bitmap->Clear();
+  EXPECT_FALSE(bitmap->Contains(kTaggedSize));
+  EXPECT_EQ(ObjectStartBitmap::kNotFound,
+            bitmap->FindPreviousObjectStart(kPageSize - 1));
+}
+
+}  // namespace v8::internal
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <memory>
+#include <vector>
 
 #include "include/v8-inspector.h"
 #include "include/v8-local-handle.h"
@@ -411,5 +412,51 @@ TEST_F(InspectorTest, NoInterruptWhileBuildingConsoleMessages) {
   CHECK(recorder.WasInvoked);
 }
 
+TEST_F(InspectorTest, SampledConsoleStackTraces) {
+  v8::Isolate* isolate = v8_isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  class SamplingClient : public v8_inspector::V8InspectorClient {
+   public:
+    int consoleStackTraceSamplingInterval(int contextGroupId) override {
+      return 3;
+    }
+    void consoleAPIMessage(int contextGroupId,
+                           v8::Isolate::MessageErrorLevel level,
+                           const StringView& message, const StringView& url,
+                           unsigned lineNumber, unsigned columnNumber,
+                           v8_inspector::V8StackTrace* stackTrace) override {
+      frame_counts.push_back(stackTrace->frames().size());
+    }
+
+    std::vector<size_t> frame_counts;
+  } client;
+  std::unique_ptr<v8_inspector::V8InspectorImpl> inspector(
+      new v8_inspector::V8InspectorImpl(isolate, &client));
+  V8ContextInfo context_info(v8_context(), 1, toStringView(""));
+  inspector->contextCreated(context_info);
+
+  TestChannel channel;
+  std::unique_ptr<V8InspectorSession> session = inspector->connect(
+      1, &channel, toStringView("{}"), v8_inspector::V8Inspector::kFullyTrusted,
+      v8_inspector::V8Inspector::kNotWaitingForDebugger);
+  reinterpret_cast<v8_inspector::V8InspectorSessionImpl*>(session.get())
+      ->runtimeAgent()
+      ->enable();
+
+  RunJS(
+      "function log() { console.log('message'); }"
+      "function outer() { log(); }"
+      "for (let i = 0; i < 6; i++) outer();");
+
+  ASSERT_EQ(6u, client.frame_counts.size());
+  EXPECT_LT(1u, client.frame_counts[0]);
+  EXPECT_EQ(1u, client.frame_counts[1]);
+  EXPECT_EQ(1u, client.frame_counts[2]);
+  EXPECT_LT(1u, client.frame_counts[3]);
+  EXPECT_EQ(1u, client.frame_counts[4]);
+  EXPECT_EQ(1u, client.frame_counts[5]);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -34,6 +34,8 @@ using ToBooleanMode = BytecodeArrayBuilder::ToBooleanMode;
 
 TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   FlagScope<bool> const_tracking_let(&i::v8_flags.const_tracking_let, true);
+  FlagScope<bool> superinstructions(&i::v8_flags.ignition_superinstructions,
+                                    true);
 
   FeedbackVectorSpec feedback_spec(zone());
   BytecodeArrayBuilder builder(zone(), 1, 131, &feedback_spec);
@@ -158,6 +160,10 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
                        BytecodeArrayBuilder::kMutableSlot)
       .StoreContextSlot(Register::current_context(), &let_var, 0);
 
+  // Emit a Star which is fused with the following load.
+  builder.StoreAccumulatorInRegister(other)
+      .LoadNamedProperty(other, name, load_slot.ToInt());
+
   // Emit load / store property operations.
   builder.LoadNamedProperty(reg, name, load_slot.ToInt())
       .LoadNamedPropertyFromSuper(reg, name, load_slot.ToInt())
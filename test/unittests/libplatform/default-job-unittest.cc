@@ -294,6 +294,63 @@ TEST(DefaultJobTest, AcquireTaskId) {
   EXPECT_EQ(5U, state->AcquireTaskId());
 }
 
+// Time that passes only with the progress of the job in AdaptiveConcurrency,
+// so that additional workers never increase the job's throughput.
+std::atomic<size_t> completed_work_items{0};
+std::atomic<size_t> max_running_workers_at_end{0};
+double ProgressTime() { return completed_work_items.load() * 1e-5; }
+
+// Verify that with adaptive concurrency, workers that don't increase the
+// throughput of the job are returned.
+TEST(DefaultJobTest, AdaptiveConcurrency) {
+  static constexpr size_t kMaxTask = 4;
+  static constexpr size_t kNumWorkItems = 500000;
+  DefaultPlatform platform(kMaxTask, IdleTaskSupport::kDisabled, nullptr,
+                           PriorityMode::kDontApply,
+                           JobConcurrencyMode::kAdaptive);
+  platform.SetTimeFunctionForTesting(ProgressTime);
+  completed_work_items = 0;
+  max_running_workers_at_end = 0;
+
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      ++running_workers;
+      while (!delegate->ShouldYield()) {
+        size_t done = ++completed_work_items;
+        if (done >= kNumWorkItems) break;
+        if (done >= kNumWorkItems - 1000) {
+          size_t running = running_workers.load();
+          size_t max = max_running_workers_at_end.load();
+          while (running > max &&
+                 !max_running_workers_at_end.compare_exchange_weak(max,
+                                                                   running)) {
+          }
+        }
+        delegate->NotifyProgress(1);
+      }
+      --running_workers;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return completed_work_items.load() < kNumWorkItems ? kMaxTask : 0;
+    }
+
+   private:
+    std::atomic<size_t> running_workers{0};
+  };
+
+  auto job = std::make_unique<JobTest>();
+  auto handle = platform.PostJob(TaskPriority::kUserVisible, std::move(job));
+  handle->Join();
+
+  EXPECT_LE(kNumWorkItems, completed_work_items.load());
+  // The limit can be probed at one worker more than needed.
+  EXPECT_GE(2u, max_running_workers_at_end.load());
+}
+
 }  // namespace default_job_unittest
 }  // namespace platform
 }  // namespace v8
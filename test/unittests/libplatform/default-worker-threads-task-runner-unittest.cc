@@ -114,6 +114,124 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, StealTasksFromBusyWorker) {
+  static constexpr int kNumTasks = 16;
+  DefaultWorkerThreadsTaskRunner runner(2, RealTime);
+
+  base::Semaphore blocker_started(0);
+  base::Semaphore unblock(0);
+  base::Semaphore all_done(0);
+  std::atomic_int count{0};
+
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocker_started.Signal();
+    unblock.Wait();
+  }));
+  blocker_started.Wait();
+
+  // Half of these tasks are queued for the blocked worker. The other worker
+  // has to steal them for all tasks to run.
+  for (int i = 0; i < kNumTasks; i++) {
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      if (++count == kNumTasks) all_done.Signal();
+    }));
+  }
+  all_done.Wait();
+  ASSERT_EQ(kNumTasks, count);
+
+  unblock.Signal();
+  runner.Terminate();
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskFromManyThreads) {
+  static constexpr int kNumThreads = 4;
+  static constexpr int kTasksPerThread = 1000;
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime);
+
+  base::Semaphore all_done(0);
+  std::atomic_int count{0};
+
+  class PostingThread final : public base::Thread {
+   public:
+    PostingThread(DefaultWorkerThreadsTaskRunner* runner,
+                  std::function<void()> f)
+        : Thread(Options("PostingThread")), runner_(runner), f_(f) {}
+
+    void Run() override {
+      for (int i = 0; i < kTasksPerThread; i++) {
+        runner_->PostTask(std::make_unique<TestTask>(f_));
+      }
+    }
+
+   private:
+    DefaultWorkerThreadsTaskRunner* runner_;
+    std::function<void()> f_;
+  };
+
+  std::vector<std::unique_ptr<PostingThread>> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.push_back(std::make_unique<PostingThread>(&runner, [&] {
+      if (++count == kNumThreads * kTasksPerThread) all_done.Signal();
+    }));
+    CHECK(threads.back()->Start());
+  }
+  for (auto& thread : threads) thread->Join();
+  all_done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(kNumThreads * kTasksPerThread, count);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, FairnessBetweenTaskSources) {
+  static constexpr int kNumTasks = 10;
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+  int source_a = 0;
+  int source_b = 0;
+
+  base::Semaphore blocker_started(0);
+  base::Semaphore unblock(0);
+  base::Semaphore all_done(0);
+  std::vector<int> order;
+
+  {
+    DefaultWorkerThreadsTaskRunner::TaskSourceScope scope(&source_a);
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      blocker_started.Signal();
+      unblock.Wait();
+    }));
+    blocker_started.Wait();
+    for (int i = 0; i < kNumTasks; i++) {
+      runner.PostTask(std::make_unique<TestTask>([&] {
+        order.push_back(0);
+        if (order.size() == kNumTasks + 1) all_done.Signal();
+      }));
+    }
+  }
+  {
+    DefaultWorkerThreadsTaskRunner::TaskSourceScope scope(&source_b);
+    runner.PostTask(std::make_unique<TestTask>([&] {
+      order.push_back(1);
+      if (order.size() == kNumTasks + 1) all_done.Signal();
+    }));
+  }
+  unblock.Signal();
+  all_done.Wait();
+
+  // The single task of the second source doesn't wait for all tasks of the
+  // first source.
+  ASSERT_EQ(kNumTasks + 1UL, order.size());
+  ASSERT_EQ(0, order[0]);
+  ASSERT_EQ(1, order[1]);
+
+  runner.Terminate();
+  auto stats = runner.GetTaskSourceStats();
+  ASSERT_EQ(2UL, stats.size());
+  ASSERT_EQ(kNumTasks + 1UL, stats[&source_a].num_tasks);
+  ASSERT_EQ(1UL, stats[&source_b].num_tasks);
+  ASSERT_LE(0, stats[&source_b].queue_time);
+  ASSERT_LE(0, stats[&source_b].run_time);
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
@@ -16,6 +16,7 @@
 #include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
 #include "src/tracing/tracing-category-observer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -293,6 +294,40 @@ TEST_F(RuntimeCallStatsTest, RenameTimer) {
   EXPECT_EQ(50, counter2()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, SampledMode) {
+  FlagScope<unsigned> sampling_interval(&v8_flags.rcs_sampling_interval, 2);
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLED_COUNTERS,
+      std::memory_order_relaxed);
+  for (int i = 0; i < 4; i++) {
+    RCS_SCOPE(stats(), counter_id());
+    Sleep(50);
+    {
+      RCS_SCOPE(stats(), counter_id2());
+      Sleep(100);
+    }
+  }
+  // Every entry is counted, but only the first and third outermost entries
+  // are timed, together with their nested entries.
+  EXPECT_EQ(4, counter()->count());
+  EXPECT_EQ(4, counter2()->count());
+  EXPECT_EQ(100, counter()->time().InMicroseconds());
+  EXPECT_EQ(200, counter2()->time().InMicroseconds());
+
+  // The API scales the times up by the sampling interval.
+  std::vector<v8::RuntimeCallCounterStatistics> counters;
+  EXPECT_TRUE(v8_isolate()->GetRuntimeCallStats(&counters));
+  bool found_counter = false;
+  for (v8::RuntimeCallCounterStatistics& entry : counters) {
+    EXPECT_LT(0u, entry.count());
+    if (strcmp(entry.name(), counter()->name()) != 0) continue;
+    found_counter = true;
+    EXPECT_EQ(4u, entry.count());
+    EXPECT_EQ(200, entry.time_in_microseconds());
+  }
+  EXPECT_TRUE(found_counter);
+}
+
 TEST_F(RuntimeCallStatsTest, BasicPrintAndSnapshot) {
   std::ostringstream out;
   stats()->Print(out);
@@ -473,5 +473,61 @@ TEST_F(StrtodTest, RandomStrtod) {
   }
 }
 
+TEST_F(StrtodTest, EiselLemireStrtod) {
+  double result;
+  CHECK(EiselLemireStrtod(1, 0, &result));
+  CHECK_EQ(1.0, result);
+  CHECK(EiselLemireStrtod(0, 100, &result));
+  CHECK_EQ(0.0, result);
+  CHECK(EiselLemireStrtod(1, 23, &result));
+  CHECK_EQ(1e23, result);
+  CHECK(EiselLemireStrtod(17976931348623157, 292, &result));
+  CHECK_EQ(1.7976931348623157e308, result);
+  CHECK(EiselLemireStrtod(17976931348623159, 292, &result));
+  CHECK_EQ(V8_INFINITY, result);
+  CHECK(EiselLemireStrtod(22250738585072014, -324, &result));
+  CHECK_EQ(2.2250738585072014e-308, result);
+  CHECK(EiselLemireStrtod(49406564584124654, -340, &result));
+  CHECK_EQ(4.9406564584124654e-324, result);
+  CHECK(EiselLemireStrtod(24703282292062327, -340, &result));
+  CHECK_EQ(0.0, result);
+  CHECK(EiselLemireStrtod(24703282292062328, -340, &result));
+  CHECK_EQ(4.9406564584124654e-324, result);
+  // Halfway between 2^53 and 2^53 + 2 rounds to even.
+  CHECK(EiselLemireStrtod(9007199254740993, 0, &result));
+  CHECK_EQ(9007199254740992.0, result);
+  CHECK(EiselLemireStrtod(9007199254740995, 0, &result));
+  CHECK_EQ(9007199254740996.0, result);
+  CHECK(EiselLemireStrtod(uint64_t{18446744073709551615u}, 0, &result));
+  CHECK_EQ(18446744073709551616.0, result);
+  CHECK(EiselLemireStrtod(1, 400, &result));
+  CHECK_EQ(V8_INFINITY, result);
+  CHECK(EiselLemireStrtod(1, -400, &result));
+  CHECK_EQ(0.0, result);
+}
+
+TEST_F(StrtodTest, RandomEiselLemireStrtod) {
+  base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 1; length <= 19; length++) {
+    for (int i = 0; i < 50; ++i) {
+      uint64_t significand = 0;
+      int pos = 0;
+      for (int j = 0; j < length; ++j) {
+        int digit = rng.NextInt(j == 0 ? 9 : 10) + (j == 0 ? 1 : 0);
+        buffer[pos++] = digit + '0';
+        significand = significand * 10 + digit;
+      }
+      int exponent = DeterministicRandom() % (308 * 2 + 1) - 308 - length;
+      buffer[pos] = '\0';
+      Vector<const char> vector(buffer, pos);
+      double result;
+      if (EiselLemireStrtod(significand, exponent, &result)) {
+        CHECK(CheckDouble(vector, exponent, result));
+      }
+    }
+  }
+}
+
 }  // namespace base
 }  // namespace v8
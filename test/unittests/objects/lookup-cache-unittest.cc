@@ -0,0 +1,124 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/lookup-cache.h"
+
+#include <string>
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/objects/lookup-cache-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/transitions-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using DescriptorLookupCacheTest = TestWithContext;
+
+TEST_F(DescriptorLookupCacheTest, Length) {
+  DescriptorLookupCache* cache = i_isolate()->descriptor_lookup_cache();
+  EXPECT_TRUE(base::bits::IsPowerOfTwo(cache->length()));
+  EXPECT_GE(static_cast<uint32_t>(cache->length()),
+            v8_flags.descriptor_lookup_cache_size.value());
+}
+
+TEST_F(DescriptorLookupCacheTest, UpdateLookupClear) {
+  DescriptorLookupCache* cache = i_isolate()->descriptor_lookup_cache();
+  DirectHandle<Map> map = i_isolate()->factory()->NewMap(
+      i_isolate()->object_function(), JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  std::vector<Handle<String>> names;
+  for (int i = 0; i < 4 * cache->length(); i++) {
+    names.push_back(i_isolate()->factory()->InternalizeUtf8String(
+        ("name" + std::to_string(i)).c_str()));
+  }
+
+  cache->Clear();
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(DescriptorLookupCache::kAbsent, cache->Lookup(*map, *names[i]));
+    cache->Update(*map, *names[i], static_cast<int>(i));
+    EXPECT_EQ(static_cast<int>(i), cache->Lookup(*map, *names[i]));
+  }
+  // Each update only evicts the least recently updated entry of its set, so
+  // the last kWays updates are all still cached.
+  for (size_t i = names.size() - DescriptorLookupCache::kWays;
+       i < names.size(); i++) {
+    EXPECT_EQ(static_cast<int>(i), cache->Lookup(*map, *names[i]));
+  }
+  // Negative results are cached too.
+  cache->Update(*map, *names[0], DescriptorArray::kNotFound);
+  EXPECT_EQ(DescriptorArray::kNotFound, cache->Lookup(*map, *names[0]));
+
+  cache->Clear();
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(DescriptorLookupCache::kAbsent, cache->Lookup(*map, *names[i]));
+  }
+}
+
+using TransitionLookupCacheTest = TestWithContext;
+
+TEST_F(TransitionLookupCacheTest, UpdateLookupInvalidate) {
+  TransitionLookupCache* cache = i_isolate()->transition_lookup_cache();
+  Factory* factory = i_isolate()->factory();
+  DirectHandle<Map> map = factory->NewMap(
+      i_isolate()->object_function(), JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  DirectHandle<Map> target = factory->NewMap(
+      i_isolate()->object_function(), JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  Handle<String> name = factory->InternalizeUtf8String("name");
+
+  cache->Clear();
+  EXPECT_TRUE(cache->Lookup(*map, *name, PropertyKind::kData, NONE).is_null());
+  cache->Update(*map, *name, PropertyKind::kData, NONE, *target);
+  EXPECT_EQ(*target, cache->Lookup(*map, *name, PropertyKind::kData, NONE));
+  // Kind and attributes are part of the key.
+  EXPECT_TRUE(
+      cache->Lookup(*map, *name, PropertyKind::kAccessor, NONE).is_null());
+  EXPECT_TRUE(
+      cache->Lookup(*map, *name, PropertyKind::kData, READ_ONLY).is_null());
+
+  cache->Invalidate(*map, *name);
+  EXPECT_TRUE(cache->Lookup(*map, *name, PropertyKind::kData, NONE).is_null());
+
+  cache->Update(*map, *name, PropertyKind::kData, NONE, *target);
+  cache->Clear();
+  EXPECT_TRUE(cache->Lookup(*map, *name, PropertyKind::kData, NONE).is_null());
+}
+
+TEST_F(TransitionLookupCacheTest, SearchTransition) {
+  // Give the initial map of {} more transitions than kMinTransitions.
+  RunJS(
+      "var objects = [];"
+      "for (let i = 0; i < 64; i++) {"
+      "  let o = {};"
+      "  o['transition' + i] = i;"
+      "  objects.push(o);"
+      "}");
+  TransitionLookupCache* cache = i_isolate()->transition_lookup_cache();
+  Factory* factory = i_isolate()->factory();
+  DirectHandle<Map> map(
+      i_isolate()->native_context()->object_function()->initial_map(),
+      i_isolate());
+  Handle<String> name = factory->InternalizeUtf8String("transition42");
+
+  cache->Clear();
+  Tagged<Map> target = TransitionsAccessor(i_isolate(), *map)
+                           .SearchTransition(*name, PropertyKind::kData, NONE);
+  ASSERT_FALSE(target.is_null());
+  EXPECT_EQ(target, cache->Lookup(*map, *name, PropertyKind::kData, NONE));
+  EXPECT_EQ(target, TransitionsAccessor(i_isolate(), *map)
+                        .SearchTransition(*name, PropertyKind::kData, NONE));
+
+  // Missing transitions are not cached.
+  Handle<String> missing = factory->InternalizeUtf8String("missing");
+  EXPECT_TRUE(TransitionsAccessor(i_isolate(), *map)
+                  .SearchTransition(*missing, PropertyKind::kData, NONE)
+                  .is_null());
+  EXPECT_TRUE(
+      cache->Lookup(*map, *missing, PropertyKind::kData, NONE).is_null());
+}
+
+}  // namespace internal
+}  // namespace v8
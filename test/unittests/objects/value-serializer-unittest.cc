@@ -3425,6 +3425,146 @@ TEST_F(ValueSerializerTestWithWasm, ComplexObjectWithManyTransfer) {
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+class ValueSerializerTestWithOutOfBandContents : public ValueSerializerTest {
+ protected:
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithOutOfBandContents* test)
+        : test_(test) {}
+
+    Maybe<bool> WriteArrayBufferContentsOutOfBand(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer,
+        uint32_t* contents_id) override {
+      if (array_buffer->ByteLength() < kMinOutOfBandLength) return Just(false);
+      *contents_id = static_cast<uint32_t>(test_->contents_.size());
+      test_->contents_.push_back(array_buffer->GetBackingStore());
+      return Just(true);
+    }
+
+    bool WriteChunk(Isolate* isolate, const uint8_t* data,
+                    size_t size) override {
+      test_->chunks_.emplace_back(data, data + size);
+      return true;
+    }
+
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandContents* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithOutOfBandContents* test)
+        : test_(test) {}
+
+    MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t contents_id) override {
+      CHECK_LT(contents_id, test_->contents_.size());
+      return ArrayBuffer::New(isolate, test_->contents_[contents_id]);
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandContents* test_;
+  };
+
+  static constexpr size_t kMinOutOfBandLength = 64;
+
+  ValueSerializerTestWithOutOfBandContents()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  // Serializes in streaming mode and returns the chunks passed to the
+  // delegate followed by the remainder returned by Release().
+  std::vector<uint8_t> StreamingEncodeTest(const char* source,
+                                           size_t chunk_size) {
+    Local<Value> input_value = EvaluateScriptForInput(source);
+    Context::Scope scope(serialization_context());
+    TryCatch try_catch(isolate());
+    ValueSerializer serializer(isolate(), &serializer_delegate_);
+    serializer.SetChunkSize(chunk_size);
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(serialization_context(), input_value)
+              .FromMaybe(false));
+    CHECK(!try_catch.HasCaught());
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    std::vector<uint8_t> result;
+    for (const std::vector<uint8_t>& chunk : chunks_) {
+      result.insert(result.end(), chunk.begin(), chunk.end());
+    }
+    result.insert(result.end(), buffer.first, buffer.first + buffer.second);
+    serializer_delegate_.FreeBufferMemory(buffer.first);
+    return result;
+  }
+
+  std::vector<std::shared_ptr<BackingStore>> contents_;
+  std::vector<std::vector<uint8_t>> chunks_;
+
+ private:
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, RoundTripArrayBuffer) {
+  RoundTripTest(
+      "const buffer = new Uint8Array(100).fill(7).buffer;"
+      "({ a: buffer, b: buffer, small: new Uint8Array([1, 2]).buffer })");
+  ASSERT_EQ(1u, contents_.size());
+  ExpectScriptTrue("result.a instanceof ArrayBuffer");
+  ExpectScriptTrue("result.a === result.b");
+  ExpectScriptTrue("new Uint8Array(result.a).every(x => x === 7)");
+  ExpectScriptTrue("new Uint8Array(result.small).toString() === '1,2'");
+
+  // The contents are shared with the deserialized buffer rather than copied.
+  ExpectScriptTrue("new Uint8Array(result.a)[0] = 3; true");
+  EXPECT_EQ(3, static_cast<uint8_t*>(contents_[0]->Data())[0]);
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, RoundTripTypedArray) {
+  RoundTripTest("({ f: new Float64Array(32).fill(0.5), d: new DataView("
+                "new ArrayBuffer(128), 8, 16) })");
+  ASSERT_EQ(2u, contents_.size());
+  ExpectScriptTrue("result.f instanceof Float64Array");
+  ExpectScriptTrue("result.f.every(x => x === 0.5)");
+  ExpectScriptTrue("result.d instanceof DataView");
+  ExpectScriptTrue("result.d.byteOffset === 8");
+  ExpectScriptTrue("result.d.byteLength === 16");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, ResizableArrayBufferInline) {
+  RoundTripTest("new ArrayBuffer(100, { maxByteLength: 200 })");
+  EXPECT_EQ(0u, contents_.size());
+  ExpectScriptTrue("result.resizable");
+  ExpectScriptTrue("result.byteLength === 100");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, StreamingChunks) {
+  // Small array buffers are serialized inline in streaming mode, and large
+  // strings are passed to the delegate without being buffered.
+  const char* source =
+      "({ s: 'x'.repeat(1000), t: '\\u1234'.repeat(300),"
+      "   a: Array.from({length: 200}, (_, i) => i),"
+      "   b: new Uint8Array([1, 2, 3]) })";
+  std::vector<uint8_t> streamed = StreamingEncodeTest(source, 128);
+  EXPECT_GT(chunks_.size(), 1u);
+  EXPECT_EQ(EncodeTest(source), streamed);
+  DecodeTest(streamed);
+  ExpectScriptTrue("result.s === 'x'.repeat(1000)");
+  ExpectScriptTrue("result.t === '\\u1234'.repeat(300)");
+  ExpectScriptTrue("result.a.length === 200 && result.a[199] === 199");
+  ExpectScriptTrue("result.b.toString() === '1,2,3'");
+}
+
 class ValueSerializerTestWithLimitedMemory : public ValueSerializerTest {
  protected:
 // GMock doesn't use the "override" keyword.
@@ -1272,10 +1272,12 @@ TEST_F(RegExpTest, MacroAssembler) {
       factory->NewStringFromTwoByte(base::Vector<const base::uc16>(str1, 6))
           .ToHandleChecked();
 
+  uint32_t work = 0;
   CHECK_EQ(IrregexpInterpreter::SUCCESS,
            IrregexpInterpreter::MatchInternal(
                isolate(), *array, *f1_16, captures, 5, 5, 0,
-               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit));
+               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit,
+               &work));
   CHECK_EQ(0, captures[0]);
   CHECK_EQ(3, captures[1]);
   CHECK_EQ(1, captures[2]);
@@ -1291,7 +1293,8 @@ TEST_F(RegExpTest, MacroAssembler) {
   CHECK_EQ(IrregexpInterpreter::FAILURE,
            IrregexpInterpreter::MatchInternal(
                isolate(), *array, *f2_16, captures, 5, 5, 0,
-               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit));
+               RegExp::CallOrigin::kFromRuntime, JSRegExp::kNoBacktrackLimit,
+               &work));
   // Failed matches don't alter output registers.
   CHECK_EQ(0, captures[0]);
   CHECK_EQ(0, captures[1]);
@@ -495,6 +495,50 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, Utf8DecoderMixedText) {
+  // The Utf8Decoder skips runs of ASCII and decodes well-formed sequences
+  // without the DFA. Check that it agrees with the other decoder on text which
+  // mixes both, also with ill-formed sequences at every position.
+  const std::vector<uint8_t> pieces[] = {
+      {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+       'o', 'p', 'q', 'r', 's'},
+      {' '},
+      {0xC3, 0xA9},              // U+00E9
+      {0xCE, 0xBA},              // U+03BA
+      {0xE4, 0xB8, 0xAD},        // U+4E2D
+      {0xEF, 0xBF, 0xBF},        // U+FFFF
+      {0xF0, 0x9F, 0x98, 0x8D},  // U+1F60D
+      {0xF4, 0x8F, 0xBF, 0xBF},  // U+10FFFF
+  };
+  const std::vector<uint8_t> ill_formed[] = {
+      {0x80}, {0xC0, 0xAF}, {0xE0, 0x80, 0xAF}, {0xED, 0xA0, 0x80},
+      {0xE4, 0xB8}, {0xF4, 0x90, 0x80, 0x80}, {0xFF},
+  };
+
+  std::vector<uint8_t> text;
+  for (int i = 0; i < 64; i++) {
+    const std::vector<uint8_t>& piece = pieces[(i * 5) % arraysize(pieces)];
+    text.insert(text.end(), piece.begin(), piece.end());
+  }
+
+  for (size_t position = 0; position <= text.size(); position++) {
+    for (const std::vector<uint8_t>& bad : ill_formed) {
+      std::vector<uint8_t> bytes(text.begin(), text.begin() + position);
+      bytes.insert(bytes.end(), bad.begin(), bad.end());
+      bytes.insert(bytes.end(), text.begin() + position, text.end());
+
+      std::vector<unibrow::uchar> expected;
+      DecodeNormally(bytes, &expected);
+      std::vector<unibrow::uchar> output;
+      DecodeUtf16(bytes, &output);
+      CHECK_EQ(expected.size(), output.size());
+      for (size_t i = 0; i < expected.size(); i++) {
+        CHECK_EQ(expected[i], output[i]);
+      }
+    }
+  }
+}
+
 class UnicodeWithGCTest : public TestWithHeapInternals {};
 
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)               \
@@ -0,0 +1,48 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/stacks.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8::internal::wasm {
+
+using StackPoolTest = TestWithIsolate;
+
+TEST_F(StackPoolTest, ReusesFinishedStacks) {
+  StackPool pool;
+  std::unique_ptr<StackMemory> stack = pool.GetOrAllocate(i_isolate());
+  StackMemory* raw_stack = stack.get();
+  EXPECT_EQ(0u, pool.Size());
+
+  pool.Add(i_isolate(), std::move(stack));
+  EXPECT_LT(0u, pool.Size());
+
+  std::unique_ptr<StackMemory> reused = pool.GetOrAllocate(i_isolate());
+  EXPECT_EQ(raw_stack, reused.get());
+  EXPECT_EQ(0u, pool.Size());
+
+  pool.Add(i_isolate(), std::move(reused));
+  pool.ReleaseFinishedStacks(i_isolate());
+  EXPECT_EQ(0u, pool.Size());
+}
+
+TEST_F(StackPoolTest, AccountsForGrownSegments) {
+  // Leave room for the stack to grow.
+  FlagScope<int> stack_size(&v8_flags.stack_size,
+                            4 * v8_flags.wasm_stack_switching_stack_size);
+  StackPool pool;
+  std::unique_ptr<StackMemory> stack = pool.GetOrAllocate(i_isolate());
+  size_t initial_size = stack->allocated_size();
+  ASSERT_TRUE(stack->Grow(kNullAddress));
+  size_t grown_size = stack->allocated_size();
+  EXPECT_LT(initial_size, grown_size);
+
+  // The stack keeps its grown segment in the pool.
+  pool.Add(i_isolate(), std::move(stack));
+  std::unique_ptr<StackMemory> reused = pool.GetOrAllocate(i_isolate());
+  EXPECT_EQ(grown_size, reused->allocated_size());
+  EXPECT_EQ(0u, pool.Size());
+}
+
+}  // namespace v8::internal::wasm
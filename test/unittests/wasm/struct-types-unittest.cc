@@ -43,6 +43,50 @@ TEST_F(StructTypesTest, Packing) {
   EXPECT_EQ(9u, type->field_offset(4));
 }
 
+TEST_F(StructTypesTest, PackingIntoSeveralGaps) {
+  StructType::Builder builder(this->zone(), 9);
+  builder.AddField(kWasmI16, true);
+  builder.AddField(kWasmI32, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI32, true);
+  builder.AddField(kWasmI16, true);
+  builder.AddField(kWasmI32, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI8, true);
+  StructType* type = builder.Build();
+  EXPECT_EQ(RoundUp(20u, kTaggedSize), type->total_fields_size());
+  EXPECT_EQ(0u, type->field_offset(0));
+  EXPECT_EQ(4u, type->field_offset(1));
+  EXPECT_EQ(2u, type->field_offset(2));
+  EXPECT_EQ(8u, type->field_offset(3));
+  EXPECT_EQ(12u, type->field_offset(4));
+  EXPECT_EQ(16u, type->field_offset(5));
+  // The gap at offset 3 is still used after a bigger gap was introduced at
+  // offset 14.
+  EXPECT_EQ(3u, type->field_offset(6));
+  EXPECT_EQ(14u, type->field_offset(7));
+  EXPECT_EQ(15u, type->field_offset(8));
+}
+
+TEST_F(StructTypesTest, SubtypingSafeOffsets) {
+  const ValueType fields[] = {kWasmI8,  kWasmI64, kWasmI16, kWasmF64,
+                              kWasmI8,  kWasmI32, kWasmI8,  kWasmI16,
+                              kWasmI64, kWasmI8,  kWasmI8,  kWasmI32};
+  constexpr uint32_t kNumFields = arraysize(fields);
+  StructType::Builder full_builder(this->zone(), kNumFields);
+  for (ValueType field : fields) full_builder.AddField(field, true);
+  StructType* full = full_builder.Build();
+  for (uint32_t prefix = 1; prefix < kNumFields; prefix++) {
+    StructType::Builder builder(this->zone(), prefix);
+    for (uint32_t i = 0; i < prefix; i++) builder.AddField(fields[i], true);
+    StructType* type = builder.Build();
+    for (uint32_t i = 0; i < prefix; i++) {
+      EXPECT_EQ(full->field_offset(i), type->field_offset(i));
+    }
+  }
+}
+
 TEST_F(StructTypesTest, CopyingOffsets) {
   StructType::Builder builder(this->zone(), 5);
   builder.AddField(kWasmI64, true);
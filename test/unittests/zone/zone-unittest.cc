@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,37 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReusesSegments) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(16);
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  size_t pooled = allocator.GetPooledMemory();
+  EXPECT_LT(0u, pooled);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(16);
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+    EXPECT_EQ(pooled, allocator.GetCurrentMemoryUsage());
+    EXPECT_EQ(1u, allocator.GetSegmentPoolHits());
+  }
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+TEST_F(ZoneTest, SegmentPoolCanBeDisabled) {
+  FLAG_VALUE_SCOPE(zone_segment_pool_size, size_t{0});
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(16);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8
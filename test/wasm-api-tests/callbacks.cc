@@ -328,6 +328,25 @@ TEST_F(WasmCapiTest, DirectCallCapiFunctionWithManyArgs) {
   EXPECT_EQ(a3 + 1, results[12].f64());
   EXPECT_EQ(a0 + 1, results[13].i32());
 }
+
+TEST_F(WasmCapiTest, RepeatedCallsFromHost) {
+  // Build the following function:
+  // int32 plus_one(int32 arg0) { return arg0 + 1; }
+  uint8_t code[] = {WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_ONE)};
+  AddExportedFunction(base::CStrVector("plus_one"), code, sizeof(code),
+                      wasm_i_i_sig());
+  Instantiate(nullptr);
+  Func* plus_one = GetExportedFunction(0);
+  // The first call prepares the C wrapper, later calls reuse it.
+  Val args[] = {Val::i32(0)};
+  Val results[1];
+  for (int32_t i = 0; i < 1000; i++) {
+    args[0] = Val::i32(i);
+    own<Trap> trap = plus_one->call(args, results);
+    EXPECT_EQ(nullptr, trap);
+    EXPECT_EQ(i + 1, results[0].i32());
+  }
+}
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
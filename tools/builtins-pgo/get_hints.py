@@ -85,8 +85,6 @@ def parse_log_file(log_file):
           builtin_name = fields[1]
           block_id = int(fields[2])
           count = float(fields[3])
-          if block_id == 0 and count > max_execution_count:
-            max_execution_count = count
           if builtin_name not in block_counts:
             block_counts[builtin_name] = []
           while len(block_counts[builtin_name]) <= block_id:
@@ -110,6 +108,10 @@ def parse_log_file(log_file):
   except IOError as e:
     print(f"Cannot read from {log_file}. {e.strerror}.")
     sys.exit(1)
+  # The log may contain several runs, whose counts are added up above.
+  for counts in block_counts.values():
+    if counts[0] > max_execution_count:
+      max_execution_count = counts[0]
   return [block_counts, branches, builtin_hashes, max_execution_count]
 
 
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can
+# be found in the LICENSE file.
+"""
+Generates a builtins PGO profile from an embedder's own d8 workloads.
+
+Usage: profile_workloads.py --d8-path D8 --output PROFILE
+           [--workload "script.js arg..."]... [--workload-dir DIR]
+           [--d8-flag FLAG]... [get_hints.py options]
+
+where:
+    1. D8 is a d8 built with v8_enable_builtins_profiling = true.
+    2. Each --workload is a d8 command line (scripts and their arguments) that
+       is representative of the deployment. Every .js file in --workload-dir
+       is run as a workload as well.
+    3. PROFILE is the profile to write. Build V8 with
+       v8_builtins_profiling_log_file set to it, and without
+       v8_enable_builtins_profiling, to optimize and reorder the builtins for
+       these workloads.
+
+The block counts of all workloads are added up before the hints are computed,
+so a workload which runs longer weighs more. Use combine_hints.py on separate
+profiles instead to weigh the workloads explicitly.
+"""
+
+from pathlib import Path
+import argparse
+import shlex
+import subprocess
+import sys
+import tempfile
+
+
+def main():
+  args = parse_arguments()
+  workloads = [shlex.split(workload) for workload in args.workload]
+  if args.workload_dir:
+    workloads += [[str(path)]
+                  for path in sorted(args.workload_dir.glob("*.js"))]
+  if not workloads:
+    print("No workloads given, use --workload or --workload-dir.")
+    sys.exit(1)
+  d8_path = args.d8_path.absolute()
+  assert d8_path.exists(), "Could not find d8 path!"
+
+  with tempfile.TemporaryDirectory() as temp_dir:
+    log_paths = []
+    for index, workload in enumerate(workloads):
+      log_path = Path(temp_dir) / f"workload{index}.pgo"
+      run([d8_path, f"--turbo-profiling-output={log_path}"] + args.d8_flag +
+          workload)
+      assert log_path.exists(), f"Workload {workload} produced no profile!"
+      log_paths.append(log_path)
+
+    combined_log_path = Path(temp_dir) / "v8.builtins.pgo"
+    with combined_log_path.open("w") as combined_log:
+      for log_path in log_paths:
+        combined_log.write(log_path.read_text())
+
+    get_hints_path = (tools_pgo_dir() / "get_hints.py").absolute()
+    run([
+        sys.executable, '-u', get_hints_path, '--min',
+        str(args.min), '--ratio',
+        str(args.ratio), combined_log_path,
+        args.output.absolute()
+    ])
+  assert args.output.exists(), "Could not find profile path!"
+
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(
+      description=('Generate a builtins PGO profile from d8 workloads.'))
+  parser.add_argument(
+      '--d8-path',
+      required=True,
+      help='path to a d8 built with v8_enable_builtins_profiling = true',
+      type=Path)
+  parser.add_argument(
+      '--workload',
+      action='append',
+      default=[],
+      help='d8 command line to profile, e.g. "main.js -- --requests=1000"')
+  parser.add_argument(
+      '--workload-dir',
+      help='directory of .js files which are each profiled as a workload',
+      type=Path)
+  parser.add_argument(
+      '--d8-flag',
+      action='append',
+      default=[],
+      help='flag passed to d8 for every workload, e.g. --max-lazy')
+  parser.add_argument(
+      '--min',
+      type=int,
+      default=1000,
+      help='see get_hints.py')
+  parser.add_argument(
+      '--ratio',
+      type=int,
+      default=40,
+      help='see get_hints.py')
+  parser.add_argument(
+      '--output', required=True, help='profile to write', type=Path)
+  return parser.parse_args()
+
+
+def tools_pgo_dir():
+  return Path(__file__).parent
+
+
+def run(cmd, **kwargs):
+  print(f"# CMD: {cmd} {kwargs}")
+  subprocess.run(cmd, **kwargs, check=True)
+
+
+if __name__ == '__main__':
+  main()
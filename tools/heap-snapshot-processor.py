@@ -43,13 +43,134 @@ class Edge:
     self.to_node = to_node
 
 
+# Layout of the JSON format, which the binary format shares.
+NODE_FIELDS = [
+    'type', 'name', 'id', 'self_size', 'edge_count', 'trace_node_id',
+    'detachedness'
+]
+NODE_TYPES = [
+    'hidden', 'array', 'string', 'object', 'code', 'closure', 'regexp',
+    'number', 'native', 'synthetic', 'concatenated string', 'sliced string',
+    'symbol', 'bigint', 'object shape'
+]
+EDGE_FIELDS = ['type', 'name_or_index', 'to_node']
+EDGE_TYPES = [
+    'context', 'element', 'property', 'internal', 'hidden', 'shortcut', 'weak'
+]
+LOCATION_FIELDS = ['object_index', 'script_id', 'line', 'column']
+
+BINARY_MAGIC = b'V8HS'
+BINARY_VERSION = 1
+
+
+class BinaryReader:
+
+  def __init__(self, data):
+    self.data = data
+    self.pos = 0
+
+  def varint(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.data[self.pos]
+      self.pos += 1
+      result |= (byte & 0x7F) << shift
+      if byte < 0x80:
+        return result
+      shift += 7
+
+  def bytes(self, length):
+    result = self.data[self.pos:self.pos + length]
+    self.pos += length
+    return result
+
+
+# Reads a snapshot written with v8::HeapSnapshot::kBinary into the same shape
+# as a JSON snapshot, so that DevTools can load the result once it is written
+# out as JSON.
+def load_binary(data):
+  reader = BinaryReader(data)
+  reader.bytes(len(BINARY_MAGIC))
+  version = reader.varint()
+  if version != BINARY_VERSION:
+    raise Exception(f'Unsupported binary snapshot version {version}')
+  node_count = reader.varint()
+  edge_count = reader.varint()
+  string_count = reader.varint()
+  strings = [
+      reader.bytes(reader.varint()).decode('utf-8', errors='replace')
+      for _ in range(string_count)
+  ]
+  nodes = [reader.varint() for _ in range(node_count * len(NODE_FIELDS))]
+  edges = [reader.varint() for _ in range(edge_count * len(EDGE_FIELDS))]
+  # Edges refer to node ordinals, the JSON format to offsets in 'nodes'.
+  to_node_ix = EDGE_FIELDS.index('to_node')
+  for i in range(to_node_ix, len(edges), len(EDGE_FIELDS)):
+    edges[i] *= len(NODE_FIELDS)
+  location_count = reader.varint()
+  locations = [
+      reader.varint() for _ in range(location_count * len(LOCATION_FIELDS))
+  ]
+  object_index_ix = LOCATION_FIELDS.index('object_index')
+  for i in range(object_index_ix, len(locations), len(LOCATION_FIELDS)):
+    locations[i] *= len(NODE_FIELDS)
+
+  meta = {
+      'node_fields': NODE_FIELDS,
+      'node_types': [NODE_TYPES] + ['string'] + ['number'] * 5,
+      'edge_fields': EDGE_FIELDS,
+      'edge_types': [EDGE_TYPES, 'string_or_number', 'node'],
+      'trace_function_info_fields': [
+          'function_id', 'name', 'script_name', 'script_id', 'line', 'column'
+      ],
+      'trace_node_fields': [
+          'id', 'function_info_index', 'count', 'size', 'children'
+      ],
+      'sample_fields': ['timestamp_us', 'last_assigned_id'],
+      'location_fields': LOCATION_FIELDS,
+  }
+  return {
+      'snapshot': {
+          'meta': meta,
+          'node_count': node_count,
+          'edge_count': edge_count,
+          'trace_function_count': 0,
+      },
+      'nodes': nodes,
+      'edges': edges,
+      'trace_function_infos': [],
+      'trace_tree': [],
+      'samples': [],
+      'locations': locations,
+      'strings': strings,
+  }
+
+
+def load(path):
+  with open(path, 'rb') as f:
+    data = f.read()
+  if data.startswith(BINARY_MAGIC):
+    return load_binary(data)
+  return json.loads(data)
+
+
 def main():
-  if len(sys.argv) != 2:
+  args = sys.argv[1:]
+  json_output = None
+  if len(args) == 3 and args[1] == '--to-json':
+    json_output = args[2]
+  elif len(args) != 1:
     print("Usage: python3 heap-snapshot-processor.py snapshot.heapsnapshot")
+    print("       python3 heap-snapshot-processor.py snapshot.bin "
+          "--to-json snapshot.heapsnapshot")
     exit(1)
 
-  f = open(sys.argv[1])
-  data = json.load(f)
+  data = load(args[0])
+  if json_output:
+    with open(json_output, 'w') as f:
+      json.dump(data, f, separators=(',', ':'))
+    return
 
   # Documentation of the format (caveat: documentation for name_or_index is
   # wrong):
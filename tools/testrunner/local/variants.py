@@ -44,6 +44,9 @@ ALL_VARIANT_FLAGS = {
         "--no-wasm-to-js-generic-wrapper",
         "--no-liftoff",
     ]],
+    # Builds the Turboshaft graph from the Maglev graph rather than from the
+    # bytecode, to test that route before it becomes the default.
+    "turboshaft_from_maglev": [["--turboshaft-from-maglev"]],
     "concurrent_sparkplug": [["--concurrent-sparkplug", "--sparkplug"]],
     "always_sparkplug": [["--always-sparkplug", "--sparkplug"]],
     # This combines two orthogonal variants always_sparkplug and
@@ -143,6 +146,10 @@ INCOMPATIBLE_FLAGS_PER_VARIANT = {
         "--liftoff-only",
         "--wasm-dynamic-tiering"
     ],
+    "turboshaft_from_maglev": [
+        "--jitless", "--no-turbofan", "--no-maglev",
+        "--maglev-inline-api-calls"
+    ],
     "concurrent_sparkplug": ["--jitless"],
     "maglev": ["--jitless", "--no-maglev"],
     "maglev_future": ["--jitless", "--no-maglev", "--no-maglev-future"],
@@ -18,6 +18,11 @@ export class Isolate {
     this.samples = new Map();
 
     this.peakAllocatedMemory = 0;
+    // Peak memory kept in the zone segment pool, and the pool hits and misses
+    // at the end of the trace.
+    this.peakPooledMemory = 0;
+    this.poolHits = 0;
+    this.poolMisses = 0;
 
     // Maps zone name to their max memory consumption.
     this.zonePeakMemory = Object.create(null);
@@ -35,6 +40,8 @@ export class Isolate {
   getLabel() {
     let label = `${this.address}: `;
     label += ` peak=${formatBytes(this.peakAllocatedMemory)}`;
+    label += ` pooled=${formatBytes(this.peakPooledMemory)}`;
+    label += ` pool_hits=${this.poolHits} pool_misses=${this.poolMisses}`;
     label += ` time=[${this.start}, ${this.end}] ms`;
     return label;
   }
@@ -53,6 +60,11 @@ export class Isolate {
       this.peakUsageTime = time;
       this.peakAllocatedMemory = allocated;
     }
+    this.peakPooledMemory = Math.max(this.peakPooledMemory, sample.pooled);
+    if (time == this.end) {
+      this.poolHits = sample.poolHits;
+      this.poolMisses = sample.poolMisses;
+    }
 
     const sample_zones = sample.zones;
     if (sample_zones !== undefined) {
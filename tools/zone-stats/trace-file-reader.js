@@ -169,6 +169,10 @@ defineCustomElement('trace-file-reader', (templateText) =>
       allocated: entry_stats.allocated,
       used: entry_stats.used,
       freed: entry_stats.freed,
+      // Older traces don't report the zone segment pool.
+      pooled: entry_stats.pooled ?? 0,
+      poolHits: entry_stats.pool_hits ?? 0,
+      poolMisses: entry_stats.pool_misses ?? 0,
       zones: zones
     };
     isolate_data.samples.set(time, sample);